@@ -29,7 +29,6 @@
 #include <Ren/Context.h>
 #include <Sys/AssetFile.h>
 #include <Sys/Json.h>
-#include <Sys/MemBuf.h>
 #include <Sys/ScopeExit.h>
 #include <Sys/ThreadPool.h>
 #include <Sys/Time_.h>
@@ -617,6 +616,12 @@ void BaseState::Enter() {
         return true;
     });
 
+    cmdline_ui_->RegisterCommand("s_bvhRefit", [this](Ren::Span<const Eng::CmdlineUI::ArgData> args) -> bool {
+        const bool refit = scene_manager_->bvh_update_mode() != Eng::eBVHUpdateMode::Refit;
+        scene_manager_->set_bvh_update_mode(refit ? Eng::eBVHUpdateMode::Refit : Eng::eBVHUpdateMode::Reinsert);
+        return true;
+    });
+
     // Initialize first draw list
     UpdateFrame(0);
 }
@@ -655,13 +660,10 @@ bool BaseState::LoadScene(std::string_view name) {
 
         const size_t scene_size = in_scene.size();
 
-        std::unique_ptr<uint8_t[]> scene_data(new uint8_t[scene_size]);
-        in_scene.Read((char *)&scene_data[0], scene_size);
-
-        Sys::MemBuf mem(&scene_data[0], scene_size);
-        std::istream in_stream(&mem);
+        std::unique_ptr<char[]> scene_data(new char[scene_size]);
+        in_scene.Read(&scene_data[0], scene_size);
 
-        if (!js_scene.Read(in_stream)) {
+        if (!js_scene.Read(std::string_view{&scene_data[0], scene_size})) {
             throw std::runtime_error("Cannot load scene!");
         }
     }
@@ -1769,9 +1771,6 @@ void BaseState::Draw_PT(const Ren::Tex2DRef &target) {
         pt_result_ = {};
     }
 
-    using namespace std::placeholders;
-    auto parallel_for = std::bind(&Sys::ThreadPool::ParallelFor<Ray::ParallelForFunction>, threads_, _1, _2, _3);
-
     if (ray_reg_ctx_.empty()) {
         if (Ray::RendererSupportsMultithreading(ray_renderer_->type())) {
             const int TileSize = 64;
@@ -1796,9 +1795,14 @@ void BaseState::Draw_PT(const Ren::Tex2DRef &target) {
                 ray_renderer_->UpdateSpatialCache(*ray_scene_, ray_reg_ctx_[i][j]);
             };
 
+            auto resolve_cache_job = [this](const int pass, const int block) {
+                ray_renderer_->ResolveSpatialCacheBlock(*ray_scene_, pass, block);
+            };
+
             render_tasks_ = std::make_unique<Sys::TaskList>();
             render_and_denoise_tasks_ = std::make_unique<Sys::TaskList>();
             update_cache_tasks_ = std::make_unique<Sys::TaskList>();
+            resolve_cache_tasks_ = std::make_unique<Sys::TaskList>();
 
             std::vector<Sys::SmallVector<short, 128>> render_task_ids;
 
@@ -1811,6 +1815,20 @@ void BaseState::Draw_PT(const Ren::Tex2DRef &target) {
                 }
             }
 
+            // Blocks of each resolve pass wait for all blocks of the previous one (through an empty task)
+            short resolve_pass_barrier = -1;
+            for (int pass = 0; pass < ray_renderer_->spatial_cache_resolve_passes(); ++pass) {
+                const short next_pass_barrier = resolve_cache_tasks_->AddTask([]() {});
+                for (int i = 0; i < ray_renderer_->spatial_cache_blocks_count(); ++i) {
+                    const short id = resolve_cache_tasks_->AddTask(resolve_cache_job, pass, i);
+                    if (resolve_pass_barrier != -1) {
+                        resolve_cache_tasks_->AddDependency(id, resolve_pass_barrier);
+                    }
+                    resolve_cache_tasks_->AddDependency(next_pass_barrier, id);
+                }
+                resolve_pass_barrier = next_pass_barrier;
+            }
+
             std::vector<Sys::SmallVector<short, 128>> denoise_task_ids[16];
 
             for (int i = 0; i < int(ray_reg_ctx_.size()); ++i) {
@@ -1872,6 +1890,7 @@ void BaseState::Draw_PT(const Ren::Tex2DRef &target) {
 
             render_tasks_->Sort();
             update_cache_tasks_->Sort();
+            resolve_cache_tasks_->Sort();
             render_and_denoise_tasks_->Sort();
             assert(!render_and_denoise_tasks_->HasCycles());
         } else {
@@ -1884,7 +1903,8 @@ void BaseState::Draw_PT(const Ren::Tex2DRef &target) {
         if (viewer_->app_params.ref_name.empty()) {
             // Unfortunatedly has to happen in lockstep with rendering
             threads_->Enqueue(*update_cache_tasks_).wait();
-            ray_renderer_->ResolveSpatialCache(*ray_scene_, parallel_for);
+            // Rendering reads resolved cache, so it can not start until the last resolve pass is finished
+            threads_->Enqueue(*resolve_cache_tasks_).wait();
         }
         if (viewer_->app_params.pt_denoise && ray_reg_ctx_[0][0].iteration > 1) {
             threads_->Enqueue(*render_and_denoise_tasks_).wait();
@@ -68,7 +68,7 @@ class BaseState : public Eng::ViewerState {
     Ray::unet_filter_properties_t unet_props_ = {};
     Sys::ThreadPool *threads_ = nullptr;
     std::unique_ptr<Sys::TaskList> render_tasks_, render_and_denoise_tasks_;
-    std::unique_ptr<Sys::TaskList> update_cache_tasks_;
+    std::unique_ptr<Sys::TaskList> update_cache_tasks_, resolve_cache_tasks_;
     Eng::render_settings_t orig_settings_;
 
     Gui::Renderer *ui_renderer_ = nullptr;
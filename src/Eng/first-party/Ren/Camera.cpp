@@ -1,7 +1,14 @@
 #include "Camera.h"
 
+#include <cassert>
 #include <cstring>
 
+#if defined(__ARM_NEON__) || defined(__arm__) || defined(__aarch64__) || defined(_M_ARM) || defined(_M_ARM64)
+#include <arm_neon.h>
+#elif defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
 Ren::Plane::Plane(const Vec3f &v0, const Vec3f &v1, const Vec3f &v2) : n(Uninitialize) {
     const Vec3f e1 = v1 - v0, e2 = v2 - v0;
 
@@ -154,6 +161,104 @@ Ren::eVisResult Ren::Frustum::CheckVisibility(const Vec3f &bbox_min, const Vec3f
     return res;
 }
 
+int Ren::PackedFrustums::Add(const Frustum &f) {
+    assert(frustums_count < MaxFrustums);
+    for (int pl = 0; pl < f.planes_count; ++pl) {
+        n[0][planes_count] = f.planes[pl].n[0];
+        n[1][planes_count] = f.planes[pl].n[1];
+        n[2][planes_count] = f.planes[pl].n[2];
+        d[planes_count] = f.planes[pl].d;
+        frustum_bit[planes_count] = (1u << frustums_count);
+        ++planes_count;
+    }
+    // pad with planes that never cull anything, so tests below always process blocks of 4
+    for (int i = planes_count; i < ((planes_count + 3) & ~3); ++i) {
+        n[0][i] = n[1][i] = n[2][i] = 0.0f;
+        d[i] = 1.0f;
+        frustum_bit[i] = 0;
+    }
+    return frustums_count++;
+}
+
+uint32_t Ren::PackedFrustums::CheckVisibility(const Vec3f &bbox_min, const Vec3f &bbox_max,
+                                              uint32_t &out_full_mask) const {
+    const float epsilon = 0.002f;
+
+    const Vec3f c = 0.5f * (bbox_min + bbox_max), e = 0.5f * (bbox_max - bbox_min);
+
+    // plane test using distances of the nearest and the farthest box corners (4 planes at a time, padding planes
+    // have zero normal and positive distance, so they never contribute)
+    uint32_t invisible_mask = 0, partial_mask = 0;
+#if defined(__ARM_NEON__) || defined(__arm__) || defined(__aarch64__) || defined(_M_ARM) || defined(_M_ARM64)
+    const float32x4_t vc0 = vdupq_n_f32(c[0]), vc1 = vdupq_n_f32(c[1]), vc2 = vdupq_n_f32(c[2]);
+    const float32x4_t ve0 = vdupq_n_f32(e[0]), ve1 = vdupq_n_f32(e[1]), ve2 = vdupq_n_f32(e[2]);
+    const float32x4_t vneg_eps = vdupq_n_f32(-epsilon);
+
+    uint32x4_t vinvisible = vdupq_n_u32(0), vpartial = vdupq_n_u32(0);
+    for (int i = 0; i < planes_count; i += 4) {
+        const float32x4_t n0 = vld1q_f32(&n[0][i]), n1 = vld1q_f32(&n[1][i]), n2 = vld1q_f32(&n[2][i]);
+
+        const float32x4_t dist =
+            vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(n0, vc0), vmulq_f32(n1, vc1)), vmulq_f32(n2, vc2)),
+                      vld1q_f32(&d[i]));
+        const float32x4_t radius = vaddq_f32(vaddq_f32(vmulq_f32(vabsq_f32(n0), ve0), vmulq_f32(vabsq_f32(n1), ve1)),
+                                             vmulq_f32(vabsq_f32(n2), ve2));
+
+        const uint32x4_t bits = vld1q_u32(&frustum_bit[i]);
+        vinvisible = vorrq_u32(vinvisible, vandq_u32(vcltq_f32(vaddq_f32(dist, radius), vneg_eps), bits));
+        vpartial = vorrq_u32(vpartial, vandq_u32(vcltq_f32(vsubq_f32(dist, radius), vneg_eps), bits));
+    }
+
+    invisible_mask = vgetq_lane_u32(vinvisible, 0) | vgetq_lane_u32(vinvisible, 1) | vgetq_lane_u32(vinvisible, 2) |
+                     vgetq_lane_u32(vinvisible, 3);
+    partial_mask = vgetq_lane_u32(vpartial, 0) | vgetq_lane_u32(vpartial, 1) | vgetq_lane_u32(vpartial, 2) |
+                   vgetq_lane_u32(vpartial, 3);
+#elif defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    const __m128 vc0 = _mm_set1_ps(c[0]), vc1 = _mm_set1_ps(c[1]), vc2 = _mm_set1_ps(c[2]);
+    const __m128 ve0 = _mm_set1_ps(e[0]), ve1 = _mm_set1_ps(e[1]), ve2 = _mm_set1_ps(e[2]);
+    const __m128 vneg_eps = _mm_set1_ps(-epsilon);
+    const __m128 vabs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+    __m128i vinvisible = _mm_setzero_si128(), vpartial = _mm_setzero_si128();
+    for (int i = 0; i < planes_count; i += 4) {
+        const __m128 n0 = _mm_load_ps(&n[0][i]), n1 = _mm_load_ps(&n[1][i]), n2 = _mm_load_ps(&n[2][i]);
+
+        const __m128 dist = _mm_add_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(n0, vc0), _mm_mul_ps(n1, vc1)), _mm_mul_ps(n2, vc2)), _mm_load_ps(&d[i]));
+        const __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(n0, vabs_mask), ve0),
+                                                    _mm_mul_ps(_mm_and_ps(n1, vabs_mask), ve1)),
+                                         _mm_mul_ps(_mm_and_ps(n2, vabs_mask), ve2));
+
+        const __m128i bits = _mm_load_si128(reinterpret_cast<const __m128i *>(&frustum_bit[i]));
+        vinvisible = _mm_or_si128(
+            vinvisible, _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(_mm_add_ps(dist, radius), vneg_eps)), bits));
+        vpartial = _mm_or_si128(
+            vpartial, _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(_mm_sub_ps(dist, radius), vneg_eps)), bits));
+    }
+
+    // horizontal OR
+    vinvisible = _mm_or_si128(vinvisible, _mm_shuffle_epi32(vinvisible, _MM_SHUFFLE(1, 0, 3, 2)));
+    vinvisible = _mm_or_si128(vinvisible, _mm_shuffle_epi32(vinvisible, _MM_SHUFFLE(2, 3, 0, 1)));
+    vpartial = _mm_or_si128(vpartial, _mm_shuffle_epi32(vpartial, _MM_SHUFFLE(1, 0, 3, 2)));
+    vpartial = _mm_or_si128(vpartial, _mm_shuffle_epi32(vpartial, _MM_SHUFFLE(2, 3, 0, 1)));
+
+    invisible_mask = uint32_t(_mm_cvtsi128_si32(vinvisible));
+    partial_mask = uint32_t(_mm_cvtsi128_si32(vpartial));
+#else
+    for (int i = 0; i < planes_count; ++i) {
+        const float dist = n[0][i] * c[0] + n[1][i] * c[1] + n[2][i] * c[2] + d[i];
+        const float radius = std::abs(n[0][i]) * e[0] + std::abs(n[1][i]) * e[1] + std::abs(n[2][i]) * e[2];
+
+        invisible_mask |= (dist + radius < -epsilon) ? frustum_bit[i] : 0;
+        partial_mask |= (dist - radius < -epsilon) ? frustum_bit[i] : 0;
+    }
+#endif
+
+    const uint32_t visible_mask = ((1u << frustums_count) - 1) & ~invisible_mask;
+    out_full_mask = visible_mask & ~partial_mask;
+    return visible_mask;
+}
+
 Ren::Camera::Camera(const Vec3f &center, const Vec3f &target, const Vec3f &up)
     : is_orthographic_(false), angle_(0), aspect_(0), near_(0), far_(0) {
     SetupView(center, target, up);
@@ -35,6 +35,25 @@ struct Frustum {
     [[nodiscard]] eVisResult CheckVisibility(const Vec3f &bbox_min, const Vec3f &bbox_max) const;
 };
 
+// Planes of several frustums packed in SoA layout, bounding box is tested against all of them at once
+struct PackedFrustums {
+    static const int MaxFrustums = 8;
+    static const int MaxPlanes = MaxFrustums * 8;
+
+    alignas(16) float n[3][MaxPlanes];
+    alignas(16) float d[MaxPlanes];
+    alignas(16) uint32_t frustum_bit[MaxPlanes];
+    int frustums_count = 0, planes_count = 0;
+
+    void Clear() { frustums_count = planes_count = 0; }
+    // returns index of added frustum
+    int Add(const Frustum &f);
+
+    // Returns mask of frustums from which box is (at least partially) visible, 'out_full_mask' receives mask of
+    // frustums from which box is fully visible (same results as Frustum::CheckVisibility)
+    uint32_t CheckVisibility(const Vec3f &bbox_min, const Vec3f &bbox_max, uint32_t &out_full_mask) const;
+};
+
 class Camera {
   protected:
     Mat4f view_matrix_;
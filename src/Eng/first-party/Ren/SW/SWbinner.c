@@ -0,0 +1,123 @@
+#include "SWbinner.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "SWrasterize.h"
+
+void swBinnerInit(SWbinner *b) {
+    memset(b, 0, sizeof(SWbinner));
+    b->tris = malloc(SW_BINNER_MAX_TRIANGLES * sizeof(b->tris[0]));
+}
+
+void swBinnerDestroy(SWbinner *b) {
+    for (SWint i = 0; i < b->w * b->h; i++) {
+        free(b->bins[i].tris);
+    }
+    free(b->bins);
+    free(b->tris);
+    memset(b, 0, sizeof(SWbinner));
+}
+
+void swBinnerBegin(SWbinner *b, SWworkers *w, SWprogram *p, SWframebuffer *f,
+                   const SWint interp_mode, const SWint b_depth_test,
+                   const SWint b_depth_write, const SWint b_blend) {
+    const SWint bins_w = (f->w + SW_BIN_SIZE - 1) / SW_BIN_SIZE,
+                bins_h = (f->h + SW_BIN_SIZE - 1) / SW_BIN_SIZE;
+    if (bins_w * bins_h > b->w * b->h) {
+        b->bins = realloc(b->bins, bins_w * bins_h * sizeof(SWbin));
+        memset(&b->bins[b->w * b->h], 0, (bins_w * bins_h - b->w * b->h) * sizeof(SWbin));
+    } else {
+        /* release lists of bins that are not used anymore */
+        for (SWint i = bins_w * bins_h; i < b->w * b->h; i++) {
+            free(b->bins[i].tris);
+            memset(&b->bins[i], 0, sizeof(SWbin));
+        }
+    }
+    b->w = bins_w;
+    b->h = bins_h;
+
+    b->workers = w;
+    b->p = p;
+    b->f = f;
+    b->interp_mode = interp_mode;
+    b->b_depth_test = b_depth_test;
+    b->b_depth_write = b_depth_write;
+    b->b_blend = b_blend;
+}
+
+void swBinnerAddTriangle(SWbinner *b, SWfloat vs_out[][SW_MAX_VTX_ATTRIBS], const SWint _0,
+                         const SWint _1, const SWint _2) {
+    const SWframebuffer *f = b->f;
+    SWint p0[2], p1[2], p2[2], min[2], max[2];
+
+    _swProjectOnScreen(f, vs_out[_0], p0);
+    _swProjectOnScreen(f, vs_out[_1], p1);
+    _swProjectOnScreen(f, vs_out[_2], p2);
+
+    min[0] = sw_min(p0[0], sw_min(p1[0], p2[0]));
+    min[1] = sw_min(p0[1], sw_min(p1[1], p2[1]));
+    max[0] = sw_max(p0[0], sw_max(p1[0], p2[0]));
+    max[1] = sw_max(p0[1], sw_max(p1[1], p2[1]));
+
+    if (min[0] >= f->w || min[1] >= f->h || max[0] < 0 || max[1] < 0) {
+        return;
+    }
+
+    /* same backface test as in rasterizer */
+    const SWint area =
+        (p0[0] - p1[0]) * (p2[1] - p0[1]) - (p2[0] - p0[0]) * (p0[1] - p1[1]);
+    if (area <= 0) {
+        return;
+    }
+
+    if (b->num_tris == SW_BINNER_MAX_TRIANGLES) {
+        swBinnerFlush(b);
+    }
+
+    const SWuint tri_index = b->num_tris++;
+    const size_t attribs_size = b->p->v_out_size * sizeof(SWfloat);
+    memcpy(b->tris[tri_index][0], vs_out[_0], attribs_size);
+    memcpy(b->tris[tri_index][1], vs_out[_1], attribs_size);
+    memcpy(b->tris[tri_index][2], vs_out[_2], attribs_size);
+
+    const SWint bin_min[2] = {sw_max(min[0], 0) / SW_BIN_SIZE, sw_max(min[1], 0) / SW_BIN_SIZE},
+                bin_max[2] = {sw_min(max[0], f->w - 1) / SW_BIN_SIZE,
+                              sw_min(max[1], f->h - 1) / SW_BIN_SIZE};
+
+    for (SWint y = bin_min[1]; y <= bin_max[1]; y++) {
+        for (SWint x = bin_min[0]; x <= bin_max[0]; x++) {
+            SWbin *bin = &b->bins[y * b->w + x];
+            if (bin->count == bin->capacity) {
+                bin->capacity = bin->capacity ? 2 * bin->capacity : 64;
+                bin->tris = realloc(bin->tris, bin->capacity * sizeof(SWuint));
+            }
+            bin->tris[bin->count++] = tri_index;
+        }
+    }
+}
+
+static void _swBinnerRasterizeBin(void *arg, const SWint i) {
+    SWbinner *b = (SWbinner *)arg;
+    SWbin *bin = &b->bins[i];
+    if (!bin->count) {
+        return;
+    }
+
+    const SWint x = (i % b->w) * SW_BIN_SIZE, y = (i / b->w) * SW_BIN_SIZE;
+    const SWint rect[4] = {x, y, x + SW_BIN_SIZE, y + SW_BIN_SIZE};
+
+    for (SWuint j = 0; j < bin->count; j++) {
+        _swProcessTriangle(b->p, b->f, b->tris[bin->tris[j]], 0, 1, 2, b->interp_mode,
+                           b->b_depth_test, b->b_depth_write, b->b_blend, rect);
+    }
+    bin->count = 0;
+}
+
+void swBinnerFlush(SWbinner *b) {
+    if (!b->num_tris) {
+        return;
+    }
+    swWorkersParallelFor(b->workers, b->w * b->h, _swBinnerRasterizeBin, b);
+    b->num_tris = 0;
+}
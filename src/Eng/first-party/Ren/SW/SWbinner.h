@@ -0,0 +1,44 @@
+#ifndef SW_BINNER_H
+#define SW_BINNER_H
+
+#include "SWframebuffer.h"
+#include "SWprogram.h"
+#include "SWworkers.h"
+
+/* must be a multiple of SW_TILE_SIZE */
+#define SW_BIN_SIZE 64
+/* triangles are flushed when this limit is reached */
+#define SW_BINNER_MAX_TRIANGLES 8192
+
+typedef struct SWbin {
+    SWuint *tris;
+    SWuint count, capacity;
+} SWbin;
+
+/* Screen-space triangle binning, triangles are set up on calling thread,
+   bins are rasterized in parallel (triangle order inside bin is preserved) */
+typedef struct SWbinner {
+    SWfloat (*tris)[3][SW_MAX_VTX_ATTRIBS];
+    SWuint num_tris;
+
+    SWbin *bins;
+    SWint w, h; /* in bins */
+
+    /* state of current draw call */
+    SWworkers *workers;
+    SWprogram *p;
+    SWframebuffer *f;
+    SWint interp_mode, b_depth_test, b_depth_write, b_blend;
+} SWbinner;
+
+void swBinnerInit(SWbinner *b);
+void swBinnerDestroy(SWbinner *b);
+
+void swBinnerBegin(SWbinner *b, SWworkers *w, SWprogram *p, SWframebuffer *f,
+                   SWint interp_mode, SWint b_depth_test, SWint b_depth_write,
+                   SWint b_blend);
+void swBinnerAddTriangle(SWbinner *b, SWfloat vs_out[][SW_MAX_VTX_ATTRIBS], SWint _0,
+                         SWint _1, SWint _2);
+void swBinnerFlush(SWbinner *b);
+
+#endif /* SW_BINNER_H */
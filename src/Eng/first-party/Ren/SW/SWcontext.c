@@ -33,6 +33,9 @@ void swCtxInit(SWcontext *ctx, const SWint w, const SWint h) {
 
     swCPUInfoInit(&ctx->cpu_info);
 
+    swWorkersInit(&ctx->workers, 1);
+    swBinnerInit(&ctx->binner);
+
     extern SWfloat _sw_ubyte_to_float_table[256];
     if (_sw_ubyte_to_float_table[1] == 0) {
         SWint i;
@@ -56,9 +59,16 @@ void swCtxDestroy(SWcontext *ctx) {
         swCtxDeleteTexture(ctx, i);
     }
     swCPUInfoDestroy(&ctx->cpu_info);
+    swBinnerDestroy(&ctx->binner);
+    swWorkersDestroy(&ctx->workers);
     memset(ctx, 0, sizeof(SWcontext));
 }
 
+void swCtxSetNumThreads(SWcontext *ctx, const SWint num_threads) {
+    swWorkersDestroy(&ctx->workers);
+    swWorkersInit(&ctx->workers, num_threads);
+}
+
 /*************************************************************************************************/
 
 SWint swCtxCreateBuffer(SWcontext *ctx) {
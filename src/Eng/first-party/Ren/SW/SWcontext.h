@@ -1,12 +1,14 @@
 #ifndef SW_CONTEXT_H
 #define SW_CONTEXT_H
 
+#include "SWbinner.h"
 #include "SWbuffer.h"
 #include "SWcore.h"
 #include "SWcpu.h"
 #include "SWframebuffer.h"
 #include "SWprogram.h"
 #include "SWtexture.h"
+#include "SWworkers.h"
 
 /* render flags */
 #define DEPTH_TEST_ENABLED (1 << 0)
@@ -40,11 +42,16 @@ struct SWcontext {
     SWfloat curve_tolerance;
 
     SWcpu_info cpu_info;
+
+    SWworkers workers;
+    SWbinner binner;
 };
 
 void swCtxInit(SWcontext *ctx, SWint w, SWint h);
 void swCtxDestroy(SWcontext *ctx);
 
+void swCtxSetNumThreads(SWcontext *ctx, SWint num_threads);
+
 /* Vertex buffer operations */
 SWint swCtxCreateBuffer(SWcontext *ctx);
 void swCtxDeleteBuffer(SWcontext *ctx, SWint buf);
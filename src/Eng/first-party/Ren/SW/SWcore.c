@@ -182,6 +182,8 @@ SWint swGetInteger(const SWenum what) {
         return SW_UNIFORM_BUF_SIZE / (4 * sizeof(SWfloat));
     } else if (what == SW_NUM_CPUS) {
         return sw_cur_context->cpu_info.num_cpus;
+    } else if (what == SW_NUM_THREADS) {
+        return sw_cur_context->workers.num_threads;
     } else if (what == SW_PHYSICAL_MEMORY) {
         return (SWint)(sw_cur_context->cpu_info.physical_memory * 1024);
     } else {
@@ -207,6 +209,12 @@ const char *swGetString(const SWenum what) {
     }
 }
 
+void swSetInteger(const SWenum what, const SWint val) {
+    if (what == SW_NUM_THREADS) {
+        swCtxSetNumThreads(sw_cur_context, val);
+    }
+}
+
 void swSetFloat(const SWenum what, const SWfloat val) {
     if (what == SW_CURVE_TOLERANCE) {
         sw_cur_context->curve_tolerance = val;
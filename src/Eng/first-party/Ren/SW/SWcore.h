@@ -57,6 +57,7 @@ typedef enum SWenum {
     SW_CPU_VENDOR,
     SW_CPU_MODEL,
     SW_NUM_CPUS,
+    SW_NUM_THREADS,
 } SWenum;
 
 #define SW_TILE_SIZE 8
@@ -126,6 +127,7 @@ SWint swGetInteger(SWenum what);
 SWfloat swGetFloat(SWenum what);
 const char *swGetString(SWenum what);
 
+void swSetInteger(SWenum what, SWint val);
 void swSetFloat(SWenum what, SWfloat val);
 
 #endif /* SW_CORE_H */
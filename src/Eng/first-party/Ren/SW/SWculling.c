@@ -5,24 +5,39 @@
 
 SWint _swProcessTrianglesIndexed_Ref(SWcull_ctx *ctx, const void *attribs, const SWuint *indices, SWuint stride,
                                      SWuint index_count, const SWfloat *xform, SWint is_occluder);
+void _swSetupTrianglesIndexed_Ref(SWcull_ctx *ctx, const void *attribs, const SWuint *indices, SWuint stride,
+                                  SWuint index_count, const SWfloat *xform);
+void _swRasterizeTriangles_Ref(SWcull_ctx *ctx, const SWcull_tri *tris, const SWuint *tri_indices, SWuint count);
 SWint _swCullCtxTestRect_Ref(const SWcull_ctx *ctx, const SWfloat p_min[2], const SWfloat p_max[3],
                              const SWfloat w_min);
 void _swCullCtxClearBuf_Ref(SWcull_ctx *ctx);
 void _swCullCtxDebugDepth_Ref(const SWcull_ctx *ctx, SWfloat *out_depth);
+void _swCullCtxUpdateHiZ_Ref(SWcull_ctx *ctx, SWint block_row_beg, SWint block_row_end);
 
 #if defined(__aarch64__) || defined(_M_ARM) || defined(_M_ARM64)
 SWint _swProcessTrianglesIndexed_NEON(SWcull_ctx *ctx, const void *attribs, const SWuint *indices, SWuint stride,
                                       SWuint index_count, const SWfloat *xform, SWint is_occluder);
+void _swSetupTrianglesIndexed_NEON(SWcull_ctx *ctx, const void *attribs, const SWuint *indices, SWuint stride,
+                                   SWuint index_count, const SWfloat *xform);
+void _swRasterizeTriangles_NEON(SWcull_ctx *ctx, const SWcull_tri *tris, const SWuint *tri_indices, SWuint count);
 SWint _swCullCtxTestRect_NEON(const SWcull_ctx *ctx, const SWfloat p_min[2], const SWfloat p_max[3],
                               const SWfloat w_min);
 void _swCullCtxClearBuf_NEON(SWcull_ctx *ctx);
 void _swCullCtxDebugDepth_NEON(const SWcull_ctx *ctx, SWfloat *out_depth);
+void _swCullCtxUpdateHiZ_NEON(SWcull_ctx *ctx, SWint block_row_beg, SWint block_row_end);
 #else // defined(__aarch64__) || defined(_M_ARM) || defined(_M_ARM64)
 SWint _swProcessTrianglesIndexed_SSE2(SWcull_ctx *ctx, const void *attribs, const SWuint *indices, SWuint stride,
                                       SWuint index_count, const SWfloat *xform, SWint is_occluder);
 SWint _swProcessTrianglesIndexed_AVX2(SWcull_ctx *ctx, const void *attribs, const SWuint *indices, SWuint stride,
                                       SWuint index_count, const SWfloat *xform, SWint is_occluder);
 
+void _swSetupTrianglesIndexed_SSE2(SWcull_ctx *ctx, const void *attribs, const SWuint *indices, SWuint stride,
+                                   SWuint index_count, const SWfloat *xform);
+void _swRasterizeTriangles_SSE2(SWcull_ctx *ctx, const SWcull_tri *tris, const SWuint *tri_indices, SWuint count);
+void _swSetupTrianglesIndexed_AVX2(SWcull_ctx *ctx, const void *attribs, const SWuint *indices, SWuint stride,
+                                   SWuint index_count, const SWfloat *xform);
+void _swRasterizeTriangles_AVX2(SWcull_ctx *ctx, const SWcull_tri *tris, const SWuint *tri_indices, SWuint count);
+
 SWint _swCullCtxTestRect_SSE2(const SWcull_ctx *ctx, const SWfloat p_min[2], const SWfloat p_max[3],
                               const SWfloat w_min);
 SWint _swCullCtxTestRect_AVX2(const SWcull_ctx *ctx, const SWfloat p_min[2], const SWfloat p_max[3],
@@ -34,13 +49,20 @@ void _swCullCtxClearBuf_AVX2(SWcull_ctx *ctx);
 void _swCullCtxDebugDepth_SSE2(const SWcull_ctx *ctx, SWfloat *out_depth);
 void _swCullCtxDebugDepth_AVX2(const SWcull_ctx *ctx, SWfloat *out_depth);
 
+void _swCullCtxUpdateHiZ_SSE2(SWcull_ctx *ctx, SWint block_row_beg, SWint block_row_end);
+void _swCullCtxUpdateHiZ_AVX2(SWcull_ctx *ctx, SWint block_row_beg, SWint block_row_end);
+
 #if !defined(_MSC_VER) || _MSC_VER > 1916
 SWint _swProcessTrianglesIndexed_AVX512(SWcull_ctx *ctx, const void *attribs, const SWuint *indices, SWuint stride,
                                         SWuint index_count, const SWfloat *xform, SWint is_occluder);
+void _swSetupTrianglesIndexed_AVX512(SWcull_ctx *ctx, const void *attribs, const SWuint *indices, SWuint stride,
+                                     SWuint index_count, const SWfloat *xform);
+void _swRasterizeTriangles_AVX512(SWcull_ctx *ctx, const SWcull_tri *tris, const SWuint *tri_indices, SWuint count);
 SWint _swCullCtxTestRect_AVX512(const SWcull_ctx *ctx, const SWfloat p_min[2], const SWfloat p_max[3],
                                 const SWfloat w_min);
 void _swCullCtxClearBuf_AVX512(SWcull_ctx *ctx);
 void _swCullCtxDebugDepth_AVX512(const SWcull_ctx *ctx, SWfloat *out_depth);
+void _swCullCtxUpdateHiZ_AVX512(SWcull_ctx *ctx, SWint block_row_beg, SWint block_row_end);
 #endif
 #endif // defined(__aarch64__) || defined(_M_ARM) || defined(_M_ARM64)
 
@@ -48,6 +70,13 @@ void swCullCtxInit(SWcull_ctx *ctx, const SWint w, const SWint h, SWfloat near_c
     swCPUInfoInit(&ctx->cpu_info);
 
     ctx->ztiles = NULL;
+    ctx->hiz = NULL;
+    ctx->bin_tris = NULL;
+    ctx->bin_tris_count = ctx->bin_tris_capacity = 0;
+    ctx->bin_tri_indices = NULL;
+    ctx->bin_tri_indices_capacity = 0;
+    ctx->bin_offsets = NULL;
+    ctx->bin_count = ctx->bin_offsets_capacity = 0;
     swCullCtxResize(ctx, w, h, near_clip);
 
     swCullCtxClear(ctx);
@@ -56,6 +85,10 @@ void swCullCtxInit(SWcull_ctx *ctx, const SWint w, const SWint h, SWfloat near_c
 void swCullCtxDestroy(SWcull_ctx *ctx) {
     swCPUInfoDestroy(&ctx->cpu_info);
     sw_aligned_free(ctx->ztiles);
+    free(ctx->hiz);
+    free(ctx->bin_tris);
+    free(ctx->bin_tri_indices);
+    free(ctx->bin_offsets);
     memset(ctx, 0, sizeof(SWcull_ctx));
 }
 
@@ -74,43 +107,58 @@ void swCullCtxResize(SWcull_ctx *ctx, const SWint w, const SWint h, SWfloat near
     ctx->tile_size_y = 4;
     ctx->subtile_size_y = 4;
     ctx->tri_indexed_proc = (SWCullTrianglesIndexedProcType)&_swProcessTrianglesIndexed_NEON;
+    ctx->setup_tris_proc = &_swSetupTrianglesIndexed_NEON;
+    ctx->rast_tris_proc = &_swRasterizeTriangles_NEON;
     ctx->test_rect_proc = &_swCullCtxTestRect_NEON;
     ctx->clear_buf_proc = &_swCullCtxClearBuf_NEON;
     ctx->debug_depth_proc = (SWCullDebugDepthProcType)&_swCullCtxDebugDepth_NEON;
+    ctx->update_hiz_proc = &_swCullCtxUpdateHiZ_NEON;
 #else
 #if !defined(_MSC_VER) || _MSC_VER > 1916
     if (ctx->cpu_info.avx512_supported) {
         ctx->tile_size_y = 16;
         ctx->subtile_size_y = 4;
         ctx->tri_indexed_proc = (SWCullTrianglesIndexedProcType)&_swProcessTrianglesIndexed_AVX512;
+        ctx->setup_tris_proc = &_swSetupTrianglesIndexed_AVX512;
+        ctx->rast_tris_proc = &_swRasterizeTriangles_AVX512;
         ctx->test_rect_proc = &_swCullCtxTestRect_AVX512;
         ctx->clear_buf_proc = &_swCullCtxClearBuf_AVX512;
         ctx->debug_depth_proc = (SWCullDebugDepthProcType)&_swCullCtxDebugDepth_AVX512;
+        ctx->update_hiz_proc = &_swCullCtxUpdateHiZ_AVX512;
     } else
 #endif
 	if (ctx->cpu_info.avx2_supported) {
         ctx->tile_size_y = 8;
         ctx->subtile_size_y = 4;
         ctx->tri_indexed_proc = (SWCullTrianglesIndexedProcType)&_swProcessTrianglesIndexed_AVX2;
+        ctx->setup_tris_proc = &_swSetupTrianglesIndexed_AVX2;
+        ctx->rast_tris_proc = &_swRasterizeTriangles_AVX2;
         ctx->test_rect_proc = &_swCullCtxTestRect_AVX2;
         ctx->clear_buf_proc = &_swCullCtxClearBuf_AVX2;
         ctx->debug_depth_proc = (SWCullDebugDepthProcType)&_swCullCtxDebugDepth_AVX2;
+        ctx->update_hiz_proc = &_swCullCtxUpdateHiZ_AVX2;
     } else if (ctx->cpu_info.sse2_supported) {
         ctx->tile_size_y = 4;
         ctx->subtile_size_y = 4;
         ctx->tri_indexed_proc = (SWCullTrianglesIndexedProcType)&_swProcessTrianglesIndexed_SSE2;
+        ctx->setup_tris_proc = &_swSetupTrianglesIndexed_SSE2;
+        ctx->rast_tris_proc = &_swRasterizeTriangles_SSE2;
         ctx->test_rect_proc = &_swCullCtxTestRect_SSE2;
         ctx->clear_buf_proc = &_swCullCtxClearBuf_SSE2;
         ctx->debug_depth_proc = (SWCullDebugDepthProcType)&_swCullCtxDebugDepth_SSE2;
+        ctx->update_hiz_proc = &_swCullCtxUpdateHiZ_SSE2;
     } else
 #endif
     {
         ctx->tile_size_y = 1;
         ctx->subtile_size_y = 1;
         ctx->tri_indexed_proc = (SWCullTrianglesIndexedProcType)&_swProcessTrianglesIndexed_Ref;
+        ctx->setup_tris_proc = &_swSetupTrianglesIndexed_Ref;
+        ctx->rast_tris_proc = &_swRasterizeTriangles_Ref;
         ctx->test_rect_proc = &_swCullCtxTestRect_Ref;
         ctx->clear_buf_proc = &_swCullCtxClearBuf_Ref;
         ctx->debug_depth_proc = (SWCullDebugDepthProcType)&_swCullCtxDebugDepth_Ref;
+        ctx->update_hiz_proc = &_swCullCtxUpdateHiZ_Ref;
     }
 
     assert((w % SW_CULL_SUBTILE_X == 0) && (h % ctx->subtile_size_y == 0));
@@ -126,6 +174,18 @@ void swCullCtxResize(SWcull_ctx *ctx, const SWint w, const SWint h, SWfloat near
     sw_aligned_free(ctx->ztiles);
     ctx->ztiles = sw_aligned_malloc(ctx->ztiles_mem_size, 64);
 
+    ctx->bin_tile_beg = 0;
+    ctx->bin_tile_end = ctx->tile_w * ctx->tile_h;
+
+    ctx->hiz_tiles_y = sw_max(SW_CULL_HIZ_BLOCK_SIZE_Y / ctx->tile_size_y, 1);
+    ctx->hiz_w = (ctx->tile_w + SW_CULL_HIZ_TILES_X - 1) / SW_CULL_HIZ_TILES_X;
+    ctx->hiz_h = (ctx->tile_h + ctx->hiz_tiles_y - 1) / ctx->hiz_tiles_y;
+    free(ctx->hiz);
+    ctx->hiz = (SWfloat *)malloc(ctx->hiz_w * ctx->hiz_h * sizeof(SWfloat));
+    for (SWint i = 0; i < ctx->hiz_w * ctx->hiz_h; i++) {
+        ctx->hiz[i] = -1;
+    }
+
     assert((uintptr_t)ctx->size_ivec4 % 16 == 0);
     __m128i *size_ivec4 = (__m128i *)ctx->size_ivec4;
     (*size_ivec4) = _mm128_setr_epi32(ctx->w, ctx->w, ctx->h, ctx->h);
@@ -148,7 +208,13 @@ void swCullCtxResize(SWcull_ctx *ctx, const SWint w, const SWint h, SWfloat near
     ctx->near_clip = near_clip;
 }
 
-void swCullCtxClear(SWcull_ctx *ctx) { (*ctx->clear_buf_proc)(ctx); }
+void swCullCtxClear(SWcull_ctx *ctx) {
+    (*ctx->clear_buf_proc)(ctx);
+    // matches cleared value of zmin[0]
+    for (SWint i = 0; i < ctx->hiz_w * ctx->hiz_h; i++) {
+        ctx->hiz[i] = -1;
+    }
+}
 
 void swCullCtxSubmitCullSurfs(SWcull_ctx *ctx, SWcull_surf *surfs, const SWuint count) {
     for (SWuint i = 0; i < count; i++) {
@@ -168,6 +234,110 @@ void swCullCtxSubmitCullSurfs(SWcull_ctx *ctx, SWcull_surf *surfs, const SWuint
     }
 }
 
+void _swCullCtxReserveBinTris(SWcull_ctx *ctx, const SWuint count) {
+    if (ctx->bin_tris_count + count > ctx->bin_tris_capacity) {
+        ctx->bin_tris_capacity = sw_max(2 * ctx->bin_tris_capacity, ctx->bin_tris_count + count);
+        ctx->bin_tris = (SWcull_tri *)realloc(ctx->bin_tris, ctx->bin_tris_capacity * sizeof(SWcull_tri));
+    }
+}
+
+// bins are aligned to rows of coarse blocks, so each bin can update its part of coarse level
+static SWint _swCullCtxBinBlockRow(const SWcull_ctx *ctx, const SWint bin) {
+    return (bin * ctx->hiz_h) / ctx->bin_count;
+}
+
+// index of a bin which contains block row (inverse of _swCullCtxBinBlockRow)
+static SWint _swCullCtxBlockRowBin(const SWcull_ctx *ctx, const SWint block_row) {
+    return ((block_row + 1) * ctx->bin_count + ctx->hiz_h - 1) / ctx->hiz_h - 1;
+}
+
+void swCullCtxBinCullSurfs(SWcull_ctx *ctx, const SWcull_surf *surfs, const SWuint count, const SWint bin_count) {
+    //
+    // Set up all occluder triangles once
+    //
+    ctx->bin_tris_count = 0;
+    for (SWuint i = 0; i < count; i++) {
+        const SWcull_surf *s = &surfs[i];
+        if (s->type != SW_OCCLUDER) {
+            continue;
+        }
+
+        if (s->indices) {
+            if (s->prim_type == SW_TRIANGLES) {
+                if (s->index_type == SW_UNSIGNED_INT) {
+                    (*ctx->setup_tris_proc)(ctx, s->attribs, (const SWuint *)s->indices, s->stride, s->count,
+                                            s->xform);
+                } else {
+                    assert(0);
+                }
+            }
+        }
+    }
+
+    //
+    // Distribute triangles between bins (keeping submission order inside of each bin)
+    //
+    ctx->bin_count = bin_count;
+    if (bin_count + 1 > ctx->bin_offsets_capacity) {
+        ctx->bin_offsets_capacity = bin_count + 1;
+        ctx->bin_offsets = (SWuint *)realloc(ctx->bin_offsets, ctx->bin_offsets_capacity * sizeof(SWuint));
+    }
+    memset(ctx->bin_offsets, 0, (bin_count + 1) * sizeof(SWuint));
+
+    for (SWuint i = 0; i < ctx->bin_tris_count; i++) {
+        const SWcull_tri *tri = &ctx->bin_tris[i];
+        const SWint bin_beg = _swCullCtxBlockRowBin(ctx, (tri->tile_row_ndx / ctx->tile_w) / ctx->hiz_tiles_y),
+                    bin_end = _swCullCtxBlockRowBin(ctx, (tri->tile_end_row_ndx / ctx->tile_w - 1) / ctx->hiz_tiles_y);
+        for (SWint bin = bin_beg; bin <= bin_end; bin++) {
+            ++ctx->bin_offsets[bin + 1];
+        }
+    }
+    for (SWint bin = 0; bin < bin_count; bin++) {
+        ctx->bin_offsets[bin + 1] += ctx->bin_offsets[bin];
+    }
+
+    const SWuint indices_count = ctx->bin_offsets[bin_count];
+    if (indices_count > ctx->bin_tri_indices_capacity) {
+        ctx->bin_tri_indices_capacity = sw_max(2 * ctx->bin_tri_indices_capacity, indices_count);
+        ctx->bin_tri_indices =
+            (SWuint *)realloc(ctx->bin_tri_indices, ctx->bin_tri_indices_capacity * sizeof(SWuint));
+    }
+
+    // offsets are shifted by one bin here, scatter moves them back to bin beginnings
+    for (SWint bin = bin_count; bin > 0; bin--) {
+        ctx->bin_offsets[bin] = ctx->bin_offsets[bin - 1];
+    }
+    for (SWuint i = 0; i < ctx->bin_tris_count; i++) {
+        const SWcull_tri *tri = &ctx->bin_tris[i];
+        const SWint bin_beg = _swCullCtxBlockRowBin(ctx, (tri->tile_row_ndx / ctx->tile_w) / ctx->hiz_tiles_y),
+                    bin_end = _swCullCtxBlockRowBin(ctx, (tri->tile_end_row_ndx / ctx->tile_w - 1) / ctx->hiz_tiles_y);
+        for (SWint bin = bin_beg; bin <= bin_end; bin++) {
+            ctx->bin_tri_indices[ctx->bin_offsets[bin + 1]++] = i;
+        }
+    }
+}
+
+void swCullCtxRasterizeBin(SWcull_ctx *ctx, const SWint bin) {
+    assert(bin < ctx->bin_count);
+    const SWint block_row_beg = _swCullCtxBinBlockRow(ctx, bin);
+    const SWint block_row_end = _swCullCtxBinBlockRow(ctx, bin + 1);
+    if (block_row_beg == block_row_end) {
+        return;
+    }
+
+    // local copy with narrowed tile range, triangles that cross bin border are clipped by rows
+    SWcull_ctx bin_ctx = (*ctx);
+    bin_ctx.bin_tile_beg = block_row_beg * ctx->hiz_tiles_y * ctx->tile_w;
+    bin_ctx.bin_tile_end = sw_min(block_row_end * ctx->hiz_tiles_y, ctx->tile_h) * ctx->tile_w;
+
+    const SWuint tri_beg = ctx->bin_offsets[bin], tri_end = ctx->bin_offsets[bin + 1];
+    (*ctx->rast_tris_proc)(&bin_ctx, ctx->bin_tris, &ctx->bin_tri_indices[tri_beg], tri_end - tri_beg);
+
+    (*ctx->update_hiz_proc)(ctx, block_row_beg, block_row_end);
+}
+
+void swCullCtxUpdateHiZ(SWcull_ctx *ctx) { (*ctx->update_hiz_proc)(ctx, 0, ctx->hiz_h); }
+
 SWint swCullCtxTestRect(SWcull_ctx *ctx, const SWfloat p_min[2], const SWfloat p_max[3], const SWfloat w_min) {
     return (*ctx->test_rect_proc)(ctx, p_min, p_max, w_min);
 }
@@ -12,6 +12,10 @@
 
 #define SW_CULL_QUICK_MASK
 
+/* coarse depth level block size (in tiles and pixels) */
+#define SW_CULL_HIZ_TILES_X 4
+#define SW_CULL_HIZ_BLOCK_SIZE_Y 32
+
 typedef enum SWsurf_type { SW_OCCLUDER = 0, SW_OCCLUDEE } SWsurf_type;
 
 typedef struct SWcull_surf {
@@ -25,6 +29,17 @@ typedef struct SWcull_surf {
     SWint visible;
 } SWcull_surf;
 
+/* occluder triangle after clipping, projection and edge/depth setup, can be rasterized into any bin */
+typedef struct SWcull_tri {
+    SWint tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx;
+    SWint bb_width, bb_height;
+    SWint slope_tile_delta[3], event_start[3], slope_fp[3];
+    SWfloat zmin, zmax;
+    SWfloat z_px_dx, z_px_dy, z_plane_offset;
+    SWfloat z_tile_dx, z_tile_dy;
+    SWint mid_vtx_right, flat_bottom;
+} SWcull_tri;
+
 /************************************************************************/
 
 struct SWcull_ctx;
@@ -33,11 +48,20 @@ typedef SWint (*SWCullTrianglesIndexedProcType)(struct SWcull_ctx *ctx,
                                                 const SWuint *indices, SWuint stride,
                                                 SWuint index_count, const SWfloat *xform,
                                                 SWint is_occluder);
+typedef void (*SWCullSetupTrianglesIndexedProcType)(struct SWcull_ctx *ctx,
+                                                   const void *attribs,
+                                                   const SWuint *indices, SWuint stride,
+                                                   SWuint index_count, const SWfloat *xform);
+typedef void (*SWCullRasterizeTrianglesProcType)(struct SWcull_ctx *ctx,
+                                                 const SWcull_tri *tris,
+                                                 const SWuint *tri_indices, SWuint count);
 typedef SWint (*SWCullRectProcType)(const struct SWcull_ctx *ctx, const SWfloat p_min[2],
                                     const SWfloat p_max[3], const SWfloat w_min);
 typedef void (*SWCullClearBufferProcType)(struct SWcull_ctx *ctx);
 typedef void (*SWCullDebugDepthProcType)(const struct SWcull_ctx *ctx,
                                          SWfloat *out_depth);
+typedef void (*SWCullUpdateHiZProcType)(struct SWcull_ctx *ctx, SWint block_row_beg,
+                                        SWint block_row_end);
 
 enum eClipPlane { Left, Right, Top, Bottom, Near, _PlanesCount };
 
@@ -53,10 +77,30 @@ typedef struct SWcull_ctx {
     void *ztiles;
     SWuint ztiles_mem_size;
 
+    /* range of tiles that can be modified by occluders (narrowed for binned rasterization) */
+    SWint bin_tile_beg, bin_tile_end;
+
+    /* coarse depth level, stores min of zmin[0] over block of tiles */
+    SWint hiz_tiles_y;
+    SWint hiz_w, hiz_h;
+    SWfloat *hiz;
+
+    /* occluder triangles set up by swCullCtxBinCullSurfs, indices of triangles that touch
+       bin i are stored in bin_tri_indices[bin_offsets[i]..bin_offsets[i + 1]) */
+    SWcull_tri *bin_tris;
+    SWuint bin_tris_count, bin_tris_capacity;
+    SWuint *bin_tri_indices;
+    SWuint bin_tri_indices_capacity;
+    SWuint *bin_offsets;
+    SWint bin_count, bin_offsets_capacity;
+
     SWCullTrianglesIndexedProcType tri_indexed_proc;
+    SWCullSetupTrianglesIndexedProcType setup_tris_proc;
+    SWCullRasterizeTrianglesProcType rast_tris_proc;
     SWCullRectProcType test_rect_proc;
     SWCullClearBufferProcType clear_buf_proc;
     SWCullDebugDepthProcType debug_depth_proc;
+    SWCullUpdateHiZProcType update_hiz_proc;
 
     ALIGNED(SWint size_ivec4[4], 16);
     ALIGNED(SWfloat half_size_vec4[4], 16);
@@ -71,9 +115,43 @@ void swCullCtxResize(SWcull_ctx *ctx, SWint w, SWint h, SWfloat near_clip);
 void swCullCtxClear(SWcull_ctx *ctx);
 void swCullCtxSubmitCullSurfs(SWcull_ctx *ctx, SWcull_surf *surfs, SWuint count);
 
+/* Sets up occluder triangles once and distributes them between bin_count horizontal bands of
+   tiles (occludees are skipped) */
+void swCullCtxBinCullSurfs(SWcull_ctx *ctx, const SWcull_surf *surfs, SWuint count,
+                           SWint bin_count);
+/* Rasterizes triangles of one bin, different bins can be processed in parallel, result is the
+   same as with swCullCtxSubmitCullSurfs */
+void swCullCtxRasterizeBin(SWcull_ctx *ctx, SWint bin);
+/* Rebuilds coarse depth level (done automatically by swCullCtxRasterizeBin) */
+void swCullCtxUpdateHiZ(SWcull_ctx *ctx);
+
 SWint swCullCtxTestRect(SWcull_ctx *ctx, const SWfloat p_min[2], const SWfloat p_max[3],
                         SWfloat w_min);
 
 void swCullCtxDebugDepth(SWcull_ctx *ctx, SWfloat *out_depth);
 
+sw_inline SWint _swCullCtxRowInBin(const SWcull_ctx *ctx, const SWint tile_row_ndx) {
+    return tile_row_ndx >= ctx->bin_tile_beg && tile_row_ndx < ctx->bin_tile_end;
+}
+
+/* Returns 0 if depth z is behind occluders in all coarse blocks touched by tile rectangle
+   (max bounds are exclusive and must be greater than min ones) */
+sw_inline SWint _swCullCtxTestHiZ(const SWcull_ctx *ctx, const SWint tile_min_x,
+                                  const SWint tile_min_y, const SWint tile_max_x,
+                                  const SWint tile_max_y, const SWfloat z) {
+    const SWint block_min_x = tile_min_x / SW_CULL_HIZ_TILES_X,
+                block_max_x = (tile_max_x - 1) / SW_CULL_HIZ_TILES_X;
+    const SWint block_min_y = tile_min_y / ctx->hiz_tiles_y,
+                block_max_y = (tile_max_y - 1) / ctx->hiz_tiles_y;
+    for (SWint y = block_min_y; y <= block_max_y; y++) {
+        const SWfloat *hiz_row = &ctx->hiz[y * ctx->hiz_w];
+        for (SWint x = block_min_x; x <= block_max_x; x++) {
+            if (!(z < hiz_row[x])) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
 #endif /* SW_CULLING_H */
\ No newline at end of file
@@ -389,9 +389,12 @@ SWint _swRasterizeTriangle_Ref(SWcull_ctx *ctx, SWint tile_row_ndx,
 
             assert(tile_row_ndx + start <= tile_count &&
                    tile_row_ndx + end <= tile_count);
-            const SWint res = _swProcessScanline_Ref(
-                ztiles, start, end, 2 /* left_event */, 1, 0 /* right_event*/, 1,
-                tri_event, tile_row_ndx, zmin, zmax, z0, z_dx, is_occluder);
+            SWint res = 0;
+            if (_swCullCtxRowInBin(ctx, tile_row_ndx)) {
+                res = _swProcessScanline_Ref(ztiles, start, end, 2 /* left_event */, 1,
+                                             0 /* right_event*/, 1, tri_event, tile_row_ndx,
+                                             zmin, zmax, z0, z_dx, is_occluder);
+            }
             if (res && !is_occluder) {
                 return 1;
             }
@@ -425,8 +428,10 @@ SWint _swRasterizeTriangle_Ref(SWcull_ctx *ctx, SWint tile_row_ndx,
             assert(tile_row_ndx + start <= tile_count &&
                    tile_row_ndx + end <= tile_count);
 
-            SWint res;
-            if (mid_vtx_right) {
+            SWint res = 0;
+            if (!_swCullCtxRowInBin(ctx, tile_row_ndx)) {
+                // outside of current bin
+            } else if (mid_vtx_right) {
                 res = _swProcessScanline_Ref(
                     ztiles, start, end, 2 /* left_event */, 1, 0 /* right_event*/, 2,
                     tri_event, tile_row_ndx, zmin, zmax, z0, z_dx, is_occluder);
@@ -466,10 +471,13 @@ SWint _swRasterizeTriangle_Ref(SWcull_ctx *ctx, SWint tile_row_ndx,
 
                 assert(tile_row_ndx + start <= tile_count &&
                        tile_row_ndx + end <= tile_count);
-                const SWint res = _swProcessScanline_Ref(
-                    ztiles, start, end, mid_vtx_right + 1 /* left_event */, 1,
-                    mid_vtx_right + 0 /* right_event*/, 1, tri_event, tile_row_ndx, zmin,
-                    zmax, z0, z_dx, is_occluder);
+                SWint res = 0;
+                if (_swCullCtxRowInBin(ctx, tile_row_ndx)) {
+                    res = _swProcessScanline_Ref(
+                        ztiles, start, end, mid_vtx_right + 1 /* left_event */, 1,
+                        mid_vtx_right + 0 /* right_event*/, 1, tri_event, tile_row_ndx, zmin,
+                        zmax, z0, z_dx, is_occluder);
+                }
                 if (res && !is_occluder) {
                     return 1;
                 }
@@ -513,10 +521,13 @@ SWint _swRasterizeTriangle_Ref(SWcull_ctx *ctx, SWint tile_row_ndx,
 
                 assert(tile_row_ndx + start <= tile_count &&
                        tile_row_ndx + end <= tile_count);
-                const SWint res = _swProcessScanline_Ref(
-                    ztiles, start, end, mid_vtx_right + 1 /* left_event */, 1,
-                    mid_vtx_right + 0 /* right_event*/, 1, tri_event, tile_row_ndx, zmin,
-                    zmax, z0, z_dx, is_occluder);
+                SWint res = 0;
+                if (_swCullCtxRowInBin(ctx, tile_row_ndx)) {
+                    res = _swProcessScanline_Ref(
+                        ztiles, start, end, mid_vtx_right + 1 /* left_event */, 1,
+                        mid_vtx_right + 0 /* right_event*/, 1, tri_event, tile_row_ndx, zmin,
+                        zmax, z0, z_dx, is_occluder);
+                }
                 if (res && !is_occluder) {
                     return 1;
                 }
@@ -544,8 +555,11 @@ SWint _swRasterizeTriangle_Ref(SWcull_ctx *ctx, SWint tile_row_ndx,
 #undef UPDATE_TILE_EVENTS_Y
 }
 
+void _swCullCtxReserveBinTris(SWcull_ctx *ctx, SWuint count);
+
+// with setup_only set triangle is appended to ctx->bin_tris instead of being rasterized
 SWint _swProcessTriangle_Ref(SWcull_ctx *ctx, SWfloat v0[3], SWfloat v1[3], SWfloat v2[3],
-                             SWint is_occluder) {
+                             SWint is_occluder, const SWint setup_only) {
     //const SWint tile_count = ctx->tile_w * ctx->tile_h;
 
     SWint bb_min[2], bb_max[2];
@@ -684,6 +698,38 @@ SWint _swProcessTriangle_Ref(SWcull_ctx *ctx, SWfloat v0[3], SWfloat v1[3], SWfl
     SWint bbox_top_ndx = bb_tile_min[0] + bb_tile_max[1] * ctx->tile_w;
     SWint bbox_mid_ndx = bb_tile_min[0] + bb_mid_tile_y * ctx->tile_w;
 
+    if (setup_only) {
+        // triangle will be rasterized later by each bin it touches
+        _swCullCtxReserveBinTris(ctx, 1);
+        SWcull_tri *tri = &ctx->bin_tris[ctx->bin_tris_count++];
+        tri->tile_row_ndx = bbox_bottom_ndx;
+        tri->tile_mid_row_ndx = bbox_mid_ndx;
+        tri->tile_end_row_ndx = bbox_top_ndx;
+        tri->bb_width = bb_tile_max[0] - bb_tile_min[0];
+        tri->bb_height = bb_tile_max[1] - bb_tile_min[1];
+        for (SWint e = 0; e < 3; e++) {
+            tri->slope_tile_delta[e] = slope_tile_delta[e];
+            tri->event_start[e] = event_start[e];
+            tri->slope_fp[e] = slopei_fp[e];
+        }
+        tri->zmin = zmin;
+        tri->zmax = zmax;
+        tri->z_px_dx = z_px_dx;
+        tri->z_px_dy = z_px_dy;
+        tri->z_plane_offset = z_plane_offset;
+        tri->z_tile_dx = z_tile_dx;
+        tri->z_tile_dy = z_tile_dy;
+        tri->mid_vtx_right = sw_abs(mid_vtx_right);
+        tri->flat_bottom = (bb_min[1] == mid_pixel[1]);
+        return is_occluder;
+    }
+
+    if (!is_occluder && !_swCullCtxTestHiZ(ctx, bb_tile_min[0], bb_tile_min[1],
+                                           bb_tile_max[0], bb_tile_max[1], zmax)) {
+        // triangle is behind occluders in all coarse blocks it touches
+        return 0;
+    }
+
     SWint res = 0;
 
     { // Rasterize triangle
@@ -726,10 +772,11 @@ SWint _swProcessTriangle_Ref(SWcull_ctx *ctx, SWfloat v0[3], SWfloat v1[3], SWfl
 #define SIMD_WIDTH 1
 #define SW_MAX_CLIPPED (8 * SIMD_WIDTH)
 
-SWint _swProcessTrianglesIndexed_Ref(SWcull_ctx *ctx, const void *attribs,
-                                     const SWuint *indices, const SWuint stride,
-                                     const SWuint index_count, const SWfloat *xform,
-                                     SWint is_occluder) {
+static SWint _swProcessTrianglesIndexedEx_Ref(SWcull_ctx *ctx, const void *attribs,
+                                              const SWuint *indices, const SWuint stride,
+                                              const SWuint index_count,
+                                              const SWfloat *xform, SWint is_occluder,
+                                              const SWint setup_only) {
     union {
         __m128 vec;
         float f32[4];
@@ -899,7 +946,7 @@ SWint _swProcessTrianglesIndexed_Ref(SWcull_ctx *ctx, const void *attribs,
             SWfloat v1[3] = {vX[1], vY[1], vW[1]};
             SWfloat v2[3] = {vX[2], vY[2], vW[2]};
 
-            res |= _swProcessTriangle_Ref(ctx, v0, v1, v2, is_occluder);
+            res |= _swProcessTriangle_Ref(ctx, v0, v1, v2, is_occluder, setup_only);
             if (res && !is_occluder) {
                 return 1;
             }
@@ -909,6 +956,47 @@ SWint _swProcessTrianglesIndexed_Ref(SWcull_ctx *ctx, const void *attribs,
     return res;
 }
 
+SWint _swProcessTrianglesIndexed_Ref(SWcull_ctx *ctx, const void *attribs,
+                                     const SWuint *indices, const SWuint stride,
+                                     const SWuint index_count, const SWfloat *xform,
+                                     SWint is_occluder) {
+    return _swProcessTrianglesIndexedEx_Ref(ctx, attribs, indices, stride, index_count, xform,
+                                            is_occluder, 0);
+}
+
+void _swSetupTrianglesIndexed_Ref(SWcull_ctx *ctx, const void *attribs,
+                                  const SWuint *indices, const SWuint stride,
+                                  const SWuint index_count, const SWfloat *xform) {
+    _swProcessTrianglesIndexedEx_Ref(ctx, attribs, indices, stride, index_count, xform, 1, 1);
+}
+
+void _swRasterizeTriangles_Ref(SWcull_ctx *ctx, const SWcull_tri *tris,
+                               const SWuint *tri_indices, const SWuint count) {
+    for (SWuint i = 0; i < count; i++) {
+        const SWcull_tri *tri = &tris[tri_indices[i]];
+
+        SWint slope_tile_delta[3] = {tri->slope_tile_delta[0], tri->slope_tile_delta[1],
+                                     tri->slope_tile_delta[2]};
+        SWint event_start[3] = {tri->event_start[0], tri->event_start[1],
+                                tri->event_start[2]};
+
+        SWfloat z0[4] = {
+            tri->z_plane_offset + tri->z_px_dy * 0 + tri->z_px_dx * 0 * SW_CULL_SUBTILE_X,
+            tri->z_plane_offset + tri->z_px_dy * 0 + tri->z_px_dx * 1 * SW_CULL_SUBTILE_X,
+            tri->z_plane_offset + tri->z_px_dy * 0 + tri->z_px_dx * 2 * SW_CULL_SUBTILE_X,
+            tri->z_plane_offset + tri->z_px_dy * 0 + tri->z_px_dx * 3 * SW_CULL_SUBTILE_X};
+
+        // Skip empty areas for big triangles
+        const SWint tight_traversal = tri->bb_width > 3 && tri->bb_height > 3;
+
+        _swRasterizeTriangle_Ref(ctx, tri->tile_row_ndx, tri->tile_mid_row_ndx,
+                                 tri->tile_end_row_ndx, tri->bb_width, slope_tile_delta,
+                                 event_start, tri->zmin, tri->zmax, z0, tri->z_tile_dx,
+                                 tri->z_tile_dy, tri->mid_vtx_right, tight_traversal,
+                                 tri->flat_bottom, 1);
+    }
+}
+
 SWint _swCullCtxTestRect_Ref(const SWcull_ctx *ctx, const SWfloat p_min[2],
                              const SWfloat p_max[3], const SWfloat w_min) {
 #define SIMD_TILE_PAD _mm128_setr_epi32(0, SW_CULL_TILE_SIZE_X - 1, 0, SW_CULL_TILE_SIZE_Y - 1)
@@ -965,6 +1053,17 @@ SWint _swCullCtxTestRect_Ref(const SWcull_ctx *ctx, const SWfloat p_min[2],
 
     const SWfloat z_max = 1 / w_min;
 
+    if (tile_max_x <= tile_min_x || tile_row_end <= tile_row_ndx) {
+        // rectangle is outside of the screen
+        return 0;
+    }
+
+    if (!_swCullCtxTestHiZ(ctx, tile_min_x, tile_row_ndx / ctx->tile_w, tile_max_x,
+                           tile_row_end / ctx->tile_w, z_max)) {
+        // rectangle is behind occluders in all coarse blocks
+        return 0;
+    }
+
     while (1) {
         SWint px_x[4];
         memcpy(px_x, start_px_x, 4 * sizeof(SWint));
@@ -1052,6 +1151,33 @@ void _swCullCtxDebugDepth_Ref(const SWcull_ctx *ctx, SWfloat *out_depth) {
     }
 }
 
+void _swCullCtxUpdateHiZ_Ref(SWcull_ctx *ctx, const SWint block_row_beg,
+                             const SWint block_row_end) {
+    const SWztile *ztiles = (SWztile *)ctx->ztiles;
+
+    for (SWint by = block_row_beg; by < block_row_end; by++) {
+        const SWint tile_y_beg = by * ctx->hiz_tiles_y;
+        const SWint tile_y_end = sw_min(tile_y_beg + ctx->hiz_tiles_y, ctx->tile_h);
+        for (SWint bx = 0; bx < ctx->hiz_w; bx++) {
+            const SWint tile_x_beg = bx * SW_CULL_HIZ_TILES_X;
+            const SWint tile_x_end = sw_min(tile_x_beg + SW_CULL_HIZ_TILES_X, ctx->tile_w);
+
+            SWfloat zmin = FLT_MAX;
+            for (SWint ty = tile_y_beg; ty < tile_y_end; ty++) {
+                for (SWint tx = tile_x_beg; tx < tile_x_end; tx++) {
+                    const SWztile *tile = &ztiles[ty * ctx->tile_w + tx];
+                    for (SWint j = 0; j < 4; j++) {
+                        if (tile->zmin[0][j] < zmin) {
+                            zmin = tile->zmin[0][j];
+                        }
+                    }
+                }
+            }
+            ctx->hiz[by * ctx->hiz_w + bx] = zmin;
+        }
+    }
+}
+
 void _swCullCtxClearBuf_Ref(SWcull_ctx *ctx) {
     SWztile *ztiles = (SWztile *)ctx->ztiles;
 
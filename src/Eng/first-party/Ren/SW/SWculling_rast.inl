@@ -259,8 +259,45 @@ void NAME(_swComputeDepthPlane)(const __mXXX vX[3], const __mXXX vY[3],
                    SW_CULL_SUBTILE_Y * 3, SW_CULL_SUBTILE_Y * 3, SW_CULL_SUBTILE_Y * 3)
 #endif
 
+static SWint NAME(_swRasterizeTriangle)(
+    SWcull_ctx *ctx, const SWint tile_row_ndx, const SWint tile_mid_row_ndx,
+    const SWint tile_end_row_ndx, const SWint bb_width, const SWint bb_height,
+    const SWint tri_ndx, SWint slope_tile_delta[], SWint event_start[], SWint slope[],
+    const __mXXX *tri_zmin, const __mXXX *tri_zmax, __mXXX *z0, const SWfloat zx,
+    const SWfloat zy, const SWint mid_vtx_right, const SWint flat_bottom,
+    const SWint is_occluder) {
+#define RASTERIZE_ARGS                                                                   \
+    ctx, tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx, bb_width, tri_ndx,            \
+        slope_tile_delta, event_start, slope, tri_zmin, tri_zmax, z0, zx, zy, flat_bottom
+    // Skip empty areas for big triangles
+    if (bb_width > 3 && bb_height > 3) {
+        if (mid_vtx_right) {
+            return is_occluder
+                       ? NAME(_swRasterizeTriangleOccluder_tight_mid_right)(RASTERIZE_ARGS)
+                       : NAME(_swRasterizeTriangle_tight_mid_right)(RASTERIZE_ARGS);
+        } else {
+            return is_occluder
+                       ? NAME(_swRasterizeTriangleOccluder_tight_mid_left)(RASTERIZE_ARGS)
+                       : NAME(_swRasterizeTriangle_tight_mid_left)(RASTERIZE_ARGS);
+        }
+    } else {
+        if (mid_vtx_right) {
+            return is_occluder ? NAME(_swRasterizeTriangleOccluder_mid_right)(RASTERIZE_ARGS)
+                               : NAME(_swRasterizeTriangle_mid_right)(RASTERIZE_ARGS);
+        } else {
+            return is_occluder ? NAME(_swRasterizeTriangleOccluder_mid_left)(RASTERIZE_ARGS)
+                               : NAME(_swRasterizeTriangle_mid_left)(RASTERIZE_ARGS);
+        }
+    }
+#undef RASTERIZE_ARGS
+}
+
+void _swCullCtxReserveBinTris(SWcull_ctx *ctx, SWuint count);
+
+// with setup_only set triangles are appended to ctx->bin_tris instead of being rasterized
 SWint NAME(_swProcessTriangleBatch)(SWcull_ctx *ctx, __mXXX vX[3], __mXXX vY[3],
-                                    __mXXX vZ[3], SWuint tri_mask, SWint is_occluder) {
+                                    __mXXX vZ[3], SWuint tri_mask, SWint is_occluder,
+                                    const SWint setup_only) {
     // find triangle bounds
     __mXXXi bb_px_min_x =
         _mmXXX_cvttps_epi32(_mmXXX_min_ps(vX[0], _mmXXX_min_ps(vX[1], vX[2])));
@@ -455,21 +492,14 @@ SWint NAME(_swProcessTriangleBatch)(SWcull_ctx *ctx, __mXXX vX[3], __mXXX vY[3],
     bb_mid_ndx.vec = _mmXXX_add_epi32(
         bb_tile_min_x, _mmXXX_mullo_epi32(mid_tile_y, _mmXXX_set1_epi32(ctx->tile_w)));
 
+    if (setup_only) {
+        _swCullCtxReserveBinTris(ctx, SIMD_WIDTH);
+    }
+
     while (tri_mask) {
         const SWint tri_ndx = _swGetFirstBit(tri_mask);
         tri_mask &= tri_mask - 1;
 
-        const __mXXX tri_zmin = _mmXXX_set1_ps(zmin.f32[tri_ndx]);
-        const __mXXX tri_zmax = _mmXXX_set1_ps(zmax.f32[tri_ndx]);
-
-        __mXXX z0 = _mmXXX_fmadd_ps(
-            _mmXXX_set1_ps(z_px_dx.f32[tri_ndx]), SIMD_SUB_TILE_COL_OFFSET_F,
-            _mmXXX_fmadd_ps(_mmXXX_set1_ps(z_px_dy.f32[tri_ndx]),
-                            SIMD_SUB_TILE_ROW_OFFSET_F,
-                            _mmXXX_set1_ps(z_plane_offset.f32[tri_ndx])));
-        const SWfloat zx = z_tile_dx.f32[tri_ndx];
-        const SWfloat zy = z_tile_dy.f32[tri_ndx];
-
         const SWint tri_bb_width = bb_tile_size_x.i32[tri_ndx];
         const SWint tri_bb_height = bb_tile_size_y.i32[tri_ndx];
 
@@ -477,72 +507,58 @@ SWint NAME(_swProcessTriangleBatch)(SWcull_ctx *ctx, __mXXX vX[3], __mXXX vY[3],
         const SWint tile_mid_row_ndx = bb_mid_ndx.i32[tri_ndx];
         const SWint tile_end_row_ndx = bb_top_ndx.i32[tri_ndx];
 
-        const SWint tri_mid_vtx_right = (mid_vtx_right >> tri_ndx) & 1;
-        const SWint tri_flat_bottom = (flat_bottom >> tri_ndx) & 1;
-
-        SWint res;
-        if (tri_bb_width > 3 && tri_bb_height > 3) {
-            if (tri_mid_vtx_right) {
-                if (is_occluder) {
-                    res = NAME(_swRasterizeTriangleOccluder_tight_mid_right)(
-                        ctx, tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx,
-                        tri_bb_width, tri_ndx, slope_tile_delta[0].i32,
-                        event_start[0].i32, slope_fp[0].i32, &tri_zmin, &tri_zmax, &z0,
-                        zx, zy, tri_flat_bottom);
-                } else {
-                    res = NAME(_swRasterizeTriangle_tight_mid_right)(
-                        ctx, tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx,
-                        tri_bb_width, tri_ndx, slope_tile_delta[0].i32,
-                        event_start[0].i32, slope_fp[0].i32, &tri_zmin, &tri_zmax, &z0,
-                        zx, zy, tri_flat_bottom);
-                }
-            } else {
-                if (is_occluder) {
-                    res = NAME(_swRasterizeTriangleOccluder_tight_mid_left)(
-                        ctx, tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx,
-                        tri_bb_width, tri_ndx, slope_tile_delta[0].i32,
-                        event_start[0].i32, slope_fp[0].i32, &tri_zmin, &tri_zmax, &z0,
-                        zx, zy, tri_flat_bottom);
-                } else {
-                    res = NAME(_swRasterizeTriangle_tight_mid_left)(
-                        ctx, tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx,
-                        tri_bb_width, tri_ndx, slope_tile_delta[0].i32,
-                        event_start[0].i32, slope_fp[0].i32, &tri_zmin, &tri_zmax, &z0,
-                        zx, zy, tri_flat_bottom);
-                }
+        if (setup_only) {
+            // triangle will be rasterized later by each bin it touches
+            SWcull_tri *tri = &ctx->bin_tris[ctx->bin_tris_count++];
+            tri->tile_row_ndx = tile_row_ndx;
+            tri->tile_mid_row_ndx = tile_mid_row_ndx;
+            tri->tile_end_row_ndx = tile_end_row_ndx;
+            tri->bb_width = tri_bb_width;
+            tri->bb_height = tri_bb_height;
+            for (SWint e = 0; e < 3; e++) {
+                tri->slope_tile_delta[e] = slope_tile_delta[e].i32[tri_ndx];
+                tri->event_start[e] = event_start[e].i32[tri_ndx];
+                tri->slope_fp[e] = slope_fp[e].i32[tri_ndx];
             }
-        } else {
-            if (tri_mid_vtx_right) {
-                if (is_occluder) {
-                    res = NAME(_swRasterizeTriangleOccluder_mid_right)(
-                        ctx, tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx,
-                        tri_bb_width, tri_ndx, slope_tile_delta[0].i32,
-                        event_start[0].i32, slope_fp[0].i32, &tri_zmin, &tri_zmax, &z0,
-                        zx, zy, tri_flat_bottom);
-                } else {
-                    res = NAME(_swRasterizeTriangle_mid_right)(
-                        ctx, tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx,
-                        tri_bb_width, tri_ndx, slope_tile_delta[0].i32,
-                        event_start[0].i32, slope_fp[0].i32, &tri_zmin, &tri_zmax, &z0,
-                        zx, zy, tri_flat_bottom);
-                }
-            } else {
-                if (is_occluder) {
-                    res = NAME(_swRasterizeTriangleOccluder_mid_left)(
-                        ctx, tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx,
-                        tri_bb_width, tri_ndx, slope_tile_delta[0].i32,
-                        event_start[0].i32, slope_fp[0].i32, &tri_zmin, &tri_zmax, &z0,
-                        zx, zy, tri_flat_bottom);
-                } else {
-                    res = NAME(_swRasterizeTriangle_mid_left)(
-                        ctx, tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx,
-                        tri_bb_width, tri_ndx, slope_tile_delta[0].i32,
-                        event_start[0].i32, slope_fp[0].i32, &tri_zmin, &tri_zmax, &z0,
-                        zx, zy, tri_flat_bottom);
-                }
+            tri->zmin = zmin.f32[tri_ndx];
+            tri->zmax = zmax.f32[tri_ndx];
+            tri->z_px_dx = z_px_dx.f32[tri_ndx];
+            tri->z_px_dy = z_px_dy.f32[tri_ndx];
+            tri->z_plane_offset = z_plane_offset.f32[tri_ndx];
+            tri->z_tile_dx = z_tile_dx.f32[tri_ndx];
+            tri->z_tile_dy = z_tile_dy.f32[tri_ndx];
+            tri->mid_vtx_right = (mid_vtx_right >> tri_ndx) & 1;
+            tri->flat_bottom = (flat_bottom >> tri_ndx) & 1;
+            continue;
+        }
+
+        if (!is_occluder) {
+            // skip triangles that are behind occluders in all coarse blocks they touch
+            const SWint tri_tile_min_x = tile_row_ndx % ctx->tile_w;
+            const SWint tri_tile_min_y = tile_row_ndx / ctx->tile_w;
+            if (!_swCullCtxTestHiZ(ctx, tri_tile_min_x, tri_tile_min_y,
+                                   tri_tile_min_x + tri_bb_width,
+                                   tri_tile_min_y + tri_bb_height, zmax.f32[tri_ndx])) {
+                continue;
             }
         }
 
+        const __mXXX tri_zmin = _mmXXX_set1_ps(zmin.f32[tri_ndx]);
+        const __mXXX tri_zmax = _mmXXX_set1_ps(zmax.f32[tri_ndx]);
+
+        __mXXX z0 = _mmXXX_fmadd_ps(
+            _mmXXX_set1_ps(z_px_dx.f32[tri_ndx]), SIMD_SUB_TILE_COL_OFFSET_F,
+            _mmXXX_fmadd_ps(_mmXXX_set1_ps(z_px_dy.f32[tri_ndx]),
+                            SIMD_SUB_TILE_ROW_OFFSET_F,
+                            _mmXXX_set1_ps(z_plane_offset.f32[tri_ndx])));
+        const SWfloat zx = z_tile_dx.f32[tri_ndx];
+        const SWfloat zy = z_tile_dy.f32[tri_ndx];
+
+        const SWint res = NAME(_swRasterizeTriangle)(
+            ctx, tile_row_ndx, tile_mid_row_ndx, tile_end_row_ndx, tri_bb_width,
+            tri_bb_height, tri_ndx, slope_tile_delta[0].i32, event_start[0].i32,
+            slope_fp[0].i32, &tri_zmin, &tri_zmax, &z0, zx, zy,
+            (mid_vtx_right >> tri_ndx) & 1, (flat_bottom >> tri_ndx) & 1, is_occluder);
         if (res && !is_occluder) {
             return 1;
         }
@@ -556,10 +572,11 @@ SWint _swClipPolygon(const __m128 in_vtx[], const SWint in_vtx_count, const __m1
 
 #define SW_MAX_CLIPPED (8 * SIMD_WIDTH)
 
-SWint NAME(_swProcessTrianglesIndexed)(SWcull_ctx *ctx, const void *attribs,
-                                       const SWuint *indices, const SWuint stride,
-                                       const SWuint index_count, const SWfloat *xform,
-                                       const SWint is_occluder) {
+static SWint NAME(_swProcessTrianglesIndexedEx)(SWcull_ctx *ctx, const void *attribs,
+                                                const SWuint *indices, const SWuint stride,
+                                                const SWuint index_count,
+                                                const SWfloat *xform, const SWint is_occluder,
+                                                const SWint setup_only) {
     union {
         __m128 vec;
         float f32[4];
@@ -781,8 +798,9 @@ SWint NAME(_swProcessTrianglesIndexed)(SWcull_ctx *ctx, const void *attribs,
             continue;
         }
 
-        const SWint res = NAME(_swProcessTriangleBatch)(
-            ctx, &vX[0].vec, &vY[0].vec, &vW[0].vec, tri_mask, is_occluder);
+        const SWint res =
+            NAME(_swProcessTriangleBatch)(ctx, &vX[0].vec, &vY[0].vec, &vW[0].vec, tri_mask,
+                                          is_occluder, setup_only);
         if (res && !is_occluder) {
             return 1;
         }
@@ -791,6 +809,51 @@ SWint NAME(_swProcessTrianglesIndexed)(SWcull_ctx *ctx, const void *attribs,
     return is_occluder;
 }
 
+SWint NAME(_swProcessTrianglesIndexed)(SWcull_ctx *ctx, const void *attribs,
+                                       const SWuint *indices, const SWuint stride,
+                                       const SWuint index_count, const SWfloat *xform,
+                                       const SWint is_occluder) {
+    return NAME(_swProcessTrianglesIndexedEx)(ctx, attribs, indices, stride, index_count,
+                                              xform, is_occluder, 0);
+}
+
+void NAME(_swSetupTrianglesIndexed)(SWcull_ctx *ctx, const void *attribs,
+                                    const SWuint *indices, const SWuint stride,
+                                    const SWuint index_count, const SWfloat *xform) {
+    NAME(_swProcessTrianglesIndexedEx)(ctx, attribs, indices, stride, index_count, xform, 1,
+                                       1);
+}
+
+void NAME(_swRasterizeTriangles)(SWcull_ctx *ctx, const SWcull_tri *tris,
+                                 const SWuint *tri_indices, const SWuint count) {
+    for (SWuint i = 0; i < count; i++) {
+        const SWcull_tri *tri = &tris[tri_indices[i]];
+
+        // rasterizer expects per-edge values with SIMD_WIDTH stride
+        SWint slope_tile_delta[3 * SIMD_WIDTH], event_start[3 * SIMD_WIDTH],
+            slope_fp[3 * SIMD_WIDTH];
+        for (SWint e = 0; e < 3; e++) {
+            slope_tile_delta[e * SIMD_WIDTH] = tri->slope_tile_delta[e];
+            event_start[e * SIMD_WIDTH] = tri->event_start[e];
+            slope_fp[e * SIMD_WIDTH] = tri->slope_fp[e];
+        }
+
+        const __mXXX tri_zmin = _mmXXX_set1_ps(tri->zmin);
+        const __mXXX tri_zmax = _mmXXX_set1_ps(tri->zmax);
+
+        __mXXX z0 = _mmXXX_fmadd_ps(
+            _mmXXX_set1_ps(tri->z_px_dx), SIMD_SUB_TILE_COL_OFFSET_F,
+            _mmXXX_fmadd_ps(_mmXXX_set1_ps(tri->z_px_dy), SIMD_SUB_TILE_ROW_OFFSET_F,
+                            _mmXXX_set1_ps(tri->z_plane_offset)));
+
+        NAME(_swRasterizeTriangle)(ctx, tri->tile_row_ndx, tri->tile_mid_row_ndx,
+                                   tri->tile_end_row_ndx, tri->bb_width, tri->bb_height, 0,
+                                   slope_tile_delta, event_start, slope_fp, &tri_zmin,
+                                   &tri_zmax, &z0, tri->z_tile_dx, tri->z_tile_dy,
+                                   tri->mid_vtx_right, tri->flat_bottom, 1);
+    }
+}
+
 SWint NAME(_swCullCtxTestRect)(const SWcull_ctx *ctx, const SWfloat p_min[2],
                                const SWfloat p_max[3], const SWfloat w_min) {
 #define SIMD_TILE_PAD                                                                    \
@@ -846,7 +909,23 @@ SWint NAME(_swCullCtxTestRect)(const SWcull_ctx *ctx, const SWfloat p_min[2],
     __mXXXi px_y = _mmXXX_add_epi32(_mmXXX_set1_epi32(tile_bboxi.i32[2]),
                                     SIMD_SUB_TILE_ROW_OFFSET_I);
 
-    __mXXX z_max = _mmXXX_div_ps(_mmXXX_set1_ps(1), _mmXXX_set1_ps(w_min));
+    union {
+        __mXXX vec;
+        SWfloat f32[SIMD_WIDTH];
+    } z_max_lanes;
+    z_max_lanes.vec = _mmXXX_div_ps(_mmXXX_set1_ps(1), _mmXXX_set1_ps(w_min));
+    const __mXXX z_max = z_max_lanes.vec;
+
+    if (tile_max_x <= tile_min_x || tile_row_end <= tile_row_ndx) {
+        // rectangle is outside of the screen
+        return 0;
+    }
+
+    if (!_swCullCtxTestHiZ(ctx, tile_min_x, tile_row_ndx / ctx->tile_w, tile_max_x,
+                           tile_row_end / ctx->tile_w, z_max_lanes.f32[0])) {
+        // rectangle is behind occluders in all coarse blocks
+        return 0;
+    }
 
     while (1) {
         __mXXXi px_x = start_px_x;
@@ -952,3 +1031,30 @@ void NAME(_swCullCtxClearBuf)(SWcull_ctx *ctx) {
 #endif
     }
 }
+
+void NAME(_swCullCtxUpdateHiZ)(SWcull_ctx *ctx, const SWint block_row_beg,
+                               const SWint block_row_end) {
+    const SWztile *ztiles = (SWztile *)ctx->ztiles;
+
+    for (SWint by = block_row_beg; by < block_row_end; by++) {
+        const SWint tile_y_beg = by * ctx->hiz_tiles_y;
+        const SWint tile_y_end = sw_min(tile_y_beg + ctx->hiz_tiles_y, ctx->tile_h);
+        for (SWint bx = 0; bx < ctx->hiz_w; bx++) {
+            const SWint tile_x_beg = bx * SW_CULL_HIZ_TILES_X;
+            const SWint tile_x_end = sw_min(tile_x_beg + SW_CULL_HIZ_TILES_X, ctx->tile_w);
+
+            SWfloat zmin = FLT_MAX;
+            for (SWint ty = tile_y_beg; ty < tile_y_end; ty++) {
+                for (SWint tx = tile_x_beg; tx < tile_x_end; tx++) {
+                    const SWztile *tile = &ztiles[ty * ctx->tile_w + tx];
+                    for (SWint j = 0; j < SIMD_WIDTH; j++) {
+                        if (tile->zmin[0].f32[j] < zmin) {
+                            zmin = tile->zmin[0].f32[j];
+                        }
+                    }
+                }
+            }
+            ctx->hiz[by * ctx->hiz_w + bx] = zmin;
+        }
+    }
+}
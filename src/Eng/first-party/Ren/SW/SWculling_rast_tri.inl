@@ -60,13 +60,16 @@ SWint TRI_FUNC_NAME(SWcull_ctx *ctx, SWint tile_row_ndx, SWint tile_mid_row_ndx,
             end_event += end_delta;
 #endif // TIGHT_TRANVERSAL
 
+            SWint res = 0;
+            if (_swCullCtxRowInBin(ctx, tile_row_ndx)) {
 #ifdef IS_OCCLUDER
-            const SWint res = NAME(_swProcessScanlineOccluder_L1R1)(
+                res = NAME(_swProcessScanlineOccluder_L1R1)(
 #else
-            const SWint res = NAME(_swProcessScanline_L1R1)(
+                res = NAME(_swProcessScanline_L1R1)(
 #endif
-                (SWztile *)ctx->ztiles, start, end, 2 /* left_event */,
-                0 /* right_event*/, tri_event, tile_row_ndx, tri_zmin, tri_zmax, z0, zx);
+                    (SWztile *)ctx->ztiles, start, end, 2 /* left_event */,
+                    0 /* right_event*/, tri_event, tile_row_ndx, tri_zmin, tri_zmax, z0, zx);
+            }
 #ifndef IS_OCCLUDER
             if (res) {
                 return 1;
@@ -98,23 +101,26 @@ SWint TRI_FUNC_NAME(SWcull_ctx *ctx, SWint tile_row_ndx, SWint tile_mid_row_ndx,
             end_event += end_delta;
 #endif // TIGHT_TRANVERSAL
 
+            SWint res = 0;
+            if (_swCullCtxRowInBin(ctx, tile_row_ndx)) {
 #if MID_VTX_RIGHT
 #ifdef IS_OCCLUDER
-            const SWint res = NAME(_swProcessScanlineOccluder_L1R2)(
+                res = NAME(_swProcessScanlineOccluder_L1R2)(
 #else
-            const SWint res = NAME(_swProcessScanline_L1R2)(
+                res = NAME(_swProcessScanline_L1R2)(
 #endif
-                (SWztile *)ctx->ztiles, start, end, 2 /* left_event */,
-                0 /* right_event*/, tri_event, tile_row_ndx, tri_zmin, tri_zmax, z0, zx);
+                    (SWztile *)ctx->ztiles, start, end, 2 /* left_event */,
+                    0 /* right_event*/, tri_event, tile_row_ndx, tri_zmin, tri_zmax, z0, zx);
 #else // MID_VTX_RIGHT
 #ifdef IS_OCCLUDER
-            const SWint res = NAME(_swProcessScanlineOccluder_L2R1)(
+                res = NAME(_swProcessScanlineOccluder_L2R1)(
 #else
-            const SWint res = NAME(_swProcessScanline_L2R1)(
+                res = NAME(_swProcessScanline_L2R1)(
 #endif
-                (SWztile *)ctx->ztiles, start, end, 2 /* left_event */,
-                0 /* right_event*/, tri_event, tile_row_ndx, tri_zmin, tri_zmax, z0, zx);
+                    (SWztile *)ctx->ztiles, start, end, 2 /* left_event */,
+                    0 /* right_event*/, tri_event, tile_row_ndx, tri_zmin, tri_zmax, z0, zx);
 #endif // MID_VTX_RIGHT
+            }
 #ifndef IS_OCCLUDER
             if (res) {
                 return 1;
@@ -147,16 +153,18 @@ SWint TRI_FUNC_NAME(SWcull_ctx *ctx, SWint tile_row_ndx, SWint tile_mid_row_ndx,
                 end_event += end_delta;
 #endif // TIGHT_TRANVERSAL
 
+                SWint res = 0;
+                if (_swCullCtxRowInBin(ctx, tile_row_ndx)) {
 #ifdef IS_OCCLUDER
-                const SWint res = NAME(_swProcessScanlineOccluder_L1R1)(
+                    res = NAME(_swProcessScanlineOccluder_L1R1)(
 #else
-                const SWint res = NAME(_swProcessScanline_L1R1)(
+                    res = NAME(_swProcessScanline_L1R1)(
 #endif
-                    (SWztile *)ctx->ztiles, start, end,
-                    MID_VTX_RIGHT + 1 /* left_event */,
-                    MID_VTX_RIGHT + 0 /* right_event*/, tri_event, tile_row_ndx, tri_zmin,
-                    tri_zmax, z0, zx);
-
+                        (SWztile *)ctx->ztiles, start, end,
+                        MID_VTX_RIGHT + 1 /* left_event */,
+                        MID_VTX_RIGHT + 0 /* right_event*/, tri_event, tile_row_ndx, tri_zmin,
+                        tri_zmax, z0, zx);
+                }
 #ifndef IS_OCCLUDER
                 if (res) {
                     return 1;
@@ -199,15 +207,18 @@ SWint TRI_FUNC_NAME(SWcull_ctx *ctx, SWint tile_row_ndx, SWint tile_mid_row_ndx,
                 end_event += end_delta;
 #endif // TIGHT_TRANVERSAL
 
+                SWint res = 0;
+                if (_swCullCtxRowInBin(ctx, tile_row_ndx)) {
 #ifdef IS_OCCLUDER
-                const SWint res = NAME(_swProcessScanlineOccluder_L1R1)(
+                    res = NAME(_swProcessScanlineOccluder_L1R1)(
 #else
-                const SWint res = NAME(_swProcessScanline_L1R1)(
+                    res = NAME(_swProcessScanline_L1R1)(
 #endif
-                    (SWztile *)ctx->ztiles, start, end,
-                    MID_VTX_RIGHT + 1 /* left_event */,
-                    MID_VTX_RIGHT + 0 /* right_event*/, tri_event, tile_row_ndx, tri_zmin,
-                    tri_zmax, z0, zx);
+                        (SWztile *)ctx->ztiles, start, end,
+                        MID_VTX_RIGHT + 1 /* left_event */,
+                        MID_VTX_RIGHT + 0 /* right_event*/, tri_event, tile_row_ndx, tri_zmin,
+                        tri_zmax, z0, zx);
+                }
 #ifndef IS_OCCLUDER
                 if (res) {
                     return 1;
@@ -428,6 +428,8 @@ void swProgDrawTrianglesArray(SWprogram *p, SWcontext *ctx, const SWuint first,
             ? ((ctx->render_flags & FAST_PERSPECTIVE_CORRECTION) ? 2 : 1)
             : 0;
     const SWint num_corr_attrs = (interp_mode == 0) ? 3 : p->v_out_size;
+    const SWint b_binned = ctx->workers.num_threads > 1;
+    const SWint full_rect[4] = {0, 0, f->w, f->h};
 
     SWint i;
     SWuint j;
@@ -437,6 +439,11 @@ void swProgDrawTrianglesArray(SWprogram *p, SWcontext *ctx, const SWuint first,
         return;
     }
 
+    if (b_binned) {
+        swBinnerBegin(&ctx->binner, &ctx->workers, p, f, interp_mode, b_depth_test,
+                      b_depth_write, b_blend);
+    }
+
     for (j = first; j < first + count; j += 3) {
         /* transform vertices */
         (*p->v_proc)(p->vertex_attributes, j, p->uniforms, vs_out[0]);
@@ -449,21 +456,20 @@ void swProgDrawTrianglesArray(SWprogram *p, SWcontext *ctx, const SWuint first,
             vs_out, vs_out, 0, 1, 2, out_verts, p->v_out_size, num_corr_attrs);
 
         for (i = 1; i < num_verts - 1; i++) {
-            if (interp_mode == 0) {
-                _swProcessTriangle_nocorrect(p, f, vs_out, out_verts[0], out_verts[i],
-                                             out_verts[i + 1], b_depth_test,
-                                             b_depth_write, b_blend);
-            } else if (interp_mode == 1) {
-                _swProcessTriangle_correct(p, f, vs_out, out_verts[0], out_verts[i],
-                                           out_verts[i + 1], b_depth_test, b_depth_write,
-                                           b_blend);
+            if (b_binned) {
+                swBinnerAddTriangle(&ctx->binner, vs_out, out_verts[0], out_verts[i],
+                                    out_verts[i + 1]);
             } else {
-                _swProcessTriangle_fast(p, f, vs_out, out_verts[0], out_verts[i],
-                                        out_verts[i + 1], b_depth_test, b_depth_write,
-                                        b_blend);
+                _swProcessTriangle(p, f, vs_out, out_verts[0], out_verts[i], out_verts[i + 1],
+                                   interp_mode, b_depth_test, b_depth_write, b_blend,
+                                   full_rect);
             }
         }
     }
+
+    if (b_binned) {
+        swBinnerFlush(&ctx->binner);
+    }
 }
 
 void swProgDrawTriangleStripArray(SWprogram *p, SWcontext *ctx, const SWuint first,
@@ -477,6 +483,8 @@ void swProgDrawTriangleStripArray(SWprogram *p, SWcontext *ctx, const SWuint fir
             ? ((ctx->render_flags & FAST_PERSPECTIVE_CORRECTION) ? 2 : 1)
             : 0;
     const SWint num_corr_attrs = (interp_mode == 0) ? 3 : p->v_out_size;
+    const SWint b_binned = ctx->workers.num_threads > 1;
+    const SWint full_rect[4] = {0, 0, f->w, f->h};
 
     SWfloat vs_out[3][SW_MAX_VTX_ATTRIBS];
     SWint _0 = 0, _1 = 1, _2 = 2, is_odd = 1;
@@ -487,6 +495,11 @@ void swProgDrawTriangleStripArray(SWprogram *p, SWcontext *ctx, const SWuint fir
         return;
     }
 
+    if (b_binned) {
+        swBinnerBegin(&ctx->binner, &ctx->workers, p, f, interp_mode, b_depth_test,
+                      b_depth_write, b_blend);
+    }
+
     for (SWuint j = first; j < first + count - 2; j++) {
         is_odd = !is_odd;
 
@@ -499,18 +512,13 @@ void swProgDrawTriangleStripArray(SWprogram *p, SWcontext *ctx, const SWuint fir
             vs_out, vs_out2, _0, _1, _2, out_verts, p->v_out_size, num_corr_attrs);
 
         for (SWint i = 1; i < num_verts - 1; i++) {
-            if (interp_mode == 0) {
-                _swProcessTriangle_nocorrect(p, f, vs_out2, out_verts[0], out_verts[i],
-                                             out_verts[i + 1], b_depth_test,
-                                             b_depth_write, b_blend);
-            } else if (interp_mode == 1) {
-                _swProcessTriangle_correct(p, f, vs_out2, out_verts[0], out_verts[i],
-                                           out_verts[i + 1], b_depth_test, b_depth_write,
-                                           b_blend);
+            if (b_binned) {
+                swBinnerAddTriangle(&ctx->binner, vs_out2, out_verts[0], out_verts[i],
+                                    out_verts[i + 1]);
             } else {
-                _swProcessTriangle_fast(p, f, vs_out2, out_verts[0], out_verts[i],
-                                        out_verts[i + 1], b_depth_test, b_depth_write,
-                                        b_blend);
+                _swProcessTriangle(p, f, vs_out2, out_verts[0], out_verts[i], out_verts[i + 1],
+                                   interp_mode, b_depth_test, b_depth_write, b_blend,
+                                   full_rect);
             }
         }
 
@@ -522,6 +530,10 @@ void swProgDrawTriangleStripArray(SWprogram *p, SWcontext *ctx, const SWuint fir
             sw_swap(_0, _1, SWint);
         }
     }
+
+    if (b_binned) {
+        swBinnerFlush(&ctx->binner);
+    }
 }
 
 void swProgDrawTrianglesIndexed(SWprogram *p, SWcontext *ctx, const SWuint count,
@@ -536,6 +548,8 @@ void swProgDrawTrianglesIndexed(SWprogram *p, SWcontext *ctx, const SWuint count
             ? ((ctx->render_flags & FAST_PERSPECTIVE_CORRECTION) ? 2 : 1)
             : 0;
     const SWint num_corr_attrs = (interp_mode == 0) ? 3 : p->v_out_size;
+    const SWint b_binned = ctx->workers.num_threads > 1;
+    const SWint full_rect[4] = {0, 0, f->w, f->h};
 
     SWuint index1 = 0, index2 = 0, index3 = 0;
     SWfloat vs_out[16][SW_MAX_VTX_ATTRIBS];
@@ -549,6 +563,11 @@ void swProgDrawTrianglesIndexed(SWprogram *p, SWcontext *ctx, const SWuint count
         indices = (char *)b->data + (uintptr_t)indices;
     }
 
+    if (b_binned) {
+        swBinnerBegin(&ctx->binner, &ctx->workers, p, f, interp_mode, b_depth_test,
+                      b_depth_write, b_blend);
+    }
+
     for (SWuint j = 0; j < count; j += 3) {
         if (index_type == SW_UNSIGNED_BYTE) {
             index1 = (SWuint) * ((SWubyte *)indices + j);
@@ -575,21 +594,20 @@ void swProgDrawTrianglesIndexed(SWprogram *p, SWcontext *ctx, const SWuint count
             vs_out, vs_out, 0, 1, 2, out_verts, p->v_out_size, num_corr_attrs);
 
         for (SWint i = 1; i < num_verts - 1; i++) {
-            if (interp_mode == 0) {
-                _swProcessTriangle_nocorrect(p, f, vs_out, out_verts[0], out_verts[i],
-                                             out_verts[i + 1], b_depth_test,
-                                             b_depth_write, b_blend);
-            } else if (interp_mode == 1) {
-                _swProcessTriangle_correct(p, f, vs_out, out_verts[0], out_verts[i],
-                                           out_verts[i + 1], b_depth_test, b_depth_write,
-                                           b_blend);
+            if (b_binned) {
+                swBinnerAddTriangle(&ctx->binner, vs_out, out_verts[0], out_verts[i],
+                                    out_verts[i + 1]);
             } else {
-                _swProcessTriangle_fast(p, f, vs_out, out_verts[0], out_verts[i],
-                                        out_verts[i + 1], b_depth_test, b_depth_write,
-                                        b_blend);
+                _swProcessTriangle(p, f, vs_out, out_verts[0], out_verts[i], out_verts[i + 1],
+                                   interp_mode, b_depth_test, b_depth_write, b_blend,
+                                   full_rect);
             }
         }
     }
+
+    if (b_binned) {
+        swBinnerFlush(&ctx->binner);
+    }
 }
 
 void swProgDrawTriangleStripIndexed(SWprogram *p, SWcontext *ctx, const SWuint count,
@@ -603,6 +621,8 @@ void swProgDrawTriangleStripIndexed(SWprogram *p, SWcontext *ctx, const SWuint c
             ? ((ctx->render_flags & FAST_PERSPECTIVE_CORRECTION) ? 2 : 1)
             : 0;
     const SWint num_corr_attrs = (interp_mode == 0) ? 3 : p->v_out_size;
+    const SWint b_binned = ctx->workers.num_threads > 1;
+    const SWint full_rect[4] = {0, 0, f->w, f->h};
 
     SWuint index1 = 0, index2 = 0;
 
@@ -631,6 +651,11 @@ void swProgDrawTriangleStripIndexed(SWprogram *p, SWcontext *ctx, const SWuint c
     (*p->v_proc)(p->vertex_attributes, index1, p->uniforms, vs_out[0]);
     (*p->v_proc)(p->vertex_attributes, index2, p->uniforms, vs_out[1]);
 
+    if (b_binned) {
+        swBinnerBegin(&ctx->binner, &ctx->workers, p, f, interp_mode, b_depth_test,
+                      b_depth_write, b_blend);
+    }
+
     for (SWuint j = 0; j < count - 2; j++) {
         is_odd = !is_odd;
         SWuint index3 = _swGetIndex(index_type, j + 2, indices);
@@ -644,18 +669,13 @@ void swProgDrawTriangleStripIndexed(SWprogram *p, SWcontext *ctx, const SWuint c
             vs_out, vs_out2, _0, _1, _2, out_verts, p->v_out_size, num_corr_attrs);
 
         for (SWint i = 1; i < num_verts - 1; i++) {
-            if (interp_mode == 0) {
-                _swProcessTriangle_nocorrect(p, f, vs_out2, out_verts[0], out_verts[i],
-                                             out_verts[i + 1], b_depth_test,
-                                             b_depth_write, b_blend);
-            } else if (interp_mode == 1) {
-                _swProcessTriangle_correct(p, f, vs_out2, out_verts[0], out_verts[i],
-                                           out_verts[i + 1], b_depth_test, b_depth_write,
-                                           b_blend);
+            if (b_binned) {
+                swBinnerAddTriangle(&ctx->binner, vs_out2, out_verts[0], out_verts[i],
+                                    out_verts[i + 1]);
             } else {
-                _swProcessTriangle_fast(p, f, vs_out2, out_verts[0], out_verts[i],
-                                        out_verts[i + 1], b_depth_test, b_depth_write,
-                                        b_blend);
+                _swProcessTriangle(p, f, vs_out2, out_verts[0], out_verts[i], out_verts[i + 1],
+                                   interp_mode, b_depth_test, b_depth_write, b_blend,
+                                   full_rect);
             }
         }
 
@@ -667,4 +687,8 @@ void swProgDrawTriangleStripIndexed(SWprogram *p, SWcontext *ctx, const SWuint c
             sw_swap(_0, _1, SWint);
         }
     }
+
+    if (b_binned) {
+        swBinnerFlush(&ctx->binner);
+    }
 }
@@ -180,7 +180,8 @@ sw_inline void _swProcessPixel_correct(SWprogram *p, SWframebuffer *f, SWint ix,
 sw_inline void _swProcessTriangle_correct(SWprogram *p, SWframebuffer *f,
                                           SWfloat vs_out[3][SW_MAX_VTX_ATTRIBS], SWint _0,
                                           SWint _1, SWint _2, SWint b_depth_test,
-                                          SWint b_depth_write, SWint b_blend) {
+                                          SWint b_depth_write, SWint b_blend,
+                                          const SWint rect[4]) {
     SWint x, y, p0[2], p1[2], p2[2];
     SWint min[2], max[2];
     SWfloat *pos0 = vs_out[_0], *pos1 = vs_out[_1], *pos2 = vs_out[_2];
@@ -212,6 +213,12 @@ sw_inline void _swProcessTriangle_correct(SWprogram *p, SWframebuffer *f,
     if (max[1] >= f->h)
         max[1] = f->h - 1;
 
+    /* restrict to target region (rect[0] and rect[1] are tile-aligned) */
+    min[0] = sw_max(min[0], rect[0]);
+    min[1] = sw_max(min[1], rect[1]);
+    max[0] = sw_min(max[0], rect[2]);
+    max[1] = sw_min(max[1], rect[3]);
+
     min[0] &= ~(SW_TILE_SIZE - 1);
     min[1] &= ~(SW_TILE_SIZE - 1);
 
@@ -373,7 +380,7 @@ sw_inline void _swProcessTriangle_nocorrect(SWprogram *p, SWframebuffer *f,
                                             SWfloat vs_out[3][SW_MAX_VTX_ATTRIBS],
                                             SWint _0, SWint _1, SWint _2,
                                             SWint b_depth_test, SWint b_depth_write,
-                                            SWint b_blend) {
+                                            SWint b_blend, const SWint rect[4]) {
     SWint i, x, y, p0[2], p1[2], p2[2];
     SWint min[2], max[2];
     SWfloat *pos0 = vs_out[_0], *pos1 = vs_out[_1], *pos2 = vs_out[_2];
@@ -407,6 +414,12 @@ sw_inline void _swProcessTriangle_nocorrect(SWprogram *p, SWframebuffer *f,
     if (max[1] >= f->h)
         max[1] = f->h - 1;
 
+    /* restrict to target region (rect[0] and rect[1] are tile-aligned) */
+    min[0] = sw_max(min[0], rect[0]);
+    min[1] = sw_max(min[1], rect[1]);
+    max[0] = sw_min(max[0], rect[2]);
+    max[1] = sw_min(max[1], rect[3]);
+
     min[0] &= ~(SW_TILE_SIZE - 1);
     min[1] &= ~(SW_TILE_SIZE - 1);
 
@@ -611,7 +624,8 @@ sw_inline void _swProcessPixel_fast(SWprogram *p, SWframebuffer *f, SWint ix, SW
 sw_inline void _swProcessTriangle_fast(SWprogram *p, SWframebuffer *f,
                                        SWfloat vs_out[3][SW_MAX_VTX_ATTRIBS], SWint _0,
                                        SWint _1, SWint _2, SWint b_depth_test,
-                                       SWint b_depth_write, SWint b_blend) {
+                                       SWint b_depth_write, SWint b_blend,
+                                       const SWint rect[4]) {
     SWint i, x, y, p0[2], p1[2], p2[2];
     SWint min[2], max[2];
     SWfloat *pos0 = vs_out[_0], *pos1 = vs_out[_1], *pos2 = vs_out[_2];
@@ -645,6 +659,12 @@ sw_inline void _swProcessTriangle_fast(SWprogram *p, SWframebuffer *f,
     if (max[1] >= f->h)
         max[1] = f->h - 1;
 
+    /* restrict to target region (rect[0] and rect[1] are tile-aligned) */
+    min[0] = sw_max(min[0], rect[0]);
+    min[1] = sw_max(min[1], rect[1]);
+    max[0] = sw_min(max[0], rect[2]);
+    max[1] = sw_min(max[1], rect[3]);
+
     min[0] &= ~(SW_TILE_SIZE - 1);
     min[1] &= ~(SW_TILE_SIZE - 1);
 
@@ -846,6 +866,22 @@ sw_inline void _swProcessTriangle_fast(SWprogram *p, SWframebuffer *f,
     }
 }
 
+sw_inline void _swProcessTriangle(SWprogram *p, SWframebuffer *f,
+                                  SWfloat vs_out[][SW_MAX_VTX_ATTRIBS], SWint _0, SWint _1,
+                                  SWint _2, SWint interp_mode, SWint b_depth_test,
+                                  SWint b_depth_write, SWint b_blend, const SWint rect[4]) {
+    if (interp_mode == 0) {
+        _swProcessTriangle_nocorrect(p, f, vs_out, _0, _1, _2, b_depth_test, b_depth_write,
+                                     b_blend, rect);
+    } else if (interp_mode == 1) {
+        _swProcessTriangle_correct(p, f, vs_out, _0, _1, _2, b_depth_test, b_depth_write,
+                                   b_blend, rect);
+    } else {
+        _swProcessTriangle_fast(p, f, vs_out, _0, _1, _2, b_depth_test, b_depth_write,
+                                b_blend, rect);
+    }
+}
+
 #define PLANE_DOT(x, y)                                                                  \
     ((x)[0] * (y)[0] + (x)[1] * (y)[1] + (x)[2] * (y)[2] + (x)[3] * (y)[3])
 
@@ -0,0 +1,187 @@
+#include "SWworkers.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+
+typedef HANDLE sw_thread_t;
+typedef CRITICAL_SECTION sw_mutex_t;
+typedef CONDITION_VARIABLE sw_cond_t;
+
+#define sw_mutex_init(m) InitializeCriticalSection(m)
+#define sw_mutex_destroy(m) DeleteCriticalSection(m)
+#define sw_mutex_lock(m) EnterCriticalSection(m)
+#define sw_mutex_unlock(m) LeaveCriticalSection(m)
+
+#define sw_cond_init(c) InitializeConditionVariable(c)
+#define sw_cond_destroy(c) ((void)(c))
+#define sw_cond_wait(c, m) SleepConditionVariableCS(c, m, INFINITE)
+#define sw_cond_broadcast(c) WakeAllConditionVariable(c)
+#define sw_cond_signal(c) WakeConditionVariable(c)
+#else
+#include <pthread.h>
+
+typedef pthread_t sw_thread_t;
+typedef pthread_mutex_t sw_mutex_t;
+typedef pthread_cond_t sw_cond_t;
+
+#define sw_mutex_init(m) pthread_mutex_init(m, NULL)
+#define sw_mutex_destroy(m) pthread_mutex_destroy(m)
+#define sw_mutex_lock(m) pthread_mutex_lock(m)
+#define sw_mutex_unlock(m) pthread_mutex_unlock(m)
+
+#define sw_cond_init(c) pthread_cond_init(c, NULL)
+#define sw_cond_destroy(c) pthread_cond_destroy(c)
+#define sw_cond_wait(c, m) pthread_cond_wait(c, m)
+#define sw_cond_broadcast(c) pthread_cond_broadcast(c)
+#define sw_cond_signal(c) pthread_cond_signal(c)
+#endif
+
+struct SWworkers_impl {
+    sw_thread_t threads[SW_MAX_THREADS];
+    SWint num_threads;
+
+    sw_mutex_t mtx;
+    sw_cond_t job_cv, done_cv;
+
+    /* current job (protected by mtx) */
+    sw_job_proc proc;
+    void *arg;
+    SWint count, next, done;
+    SWuint generation;
+    SWint stop;
+};
+
+/* Grabs and executes job items until none left, mutex must be locked */
+static void _swWorkersRunJob(struct SWworkers_impl *impl) {
+    while (impl->next < impl->count) {
+        const SWint i = impl->next++;
+        sw_mutex_unlock(&impl->mtx);
+        (*impl->proc)(impl->arg, i);
+        sw_mutex_lock(&impl->mtx);
+        if (++impl->done == impl->count) {
+            sw_cond_signal(&impl->done_cv);
+        }
+    }
+}
+
+static void _swWorkerLoop(struct SWworkers_impl *impl) {
+    SWuint seen_generation = 0;
+
+    sw_mutex_lock(&impl->mtx);
+    for (;;) {
+        while (!impl->stop && impl->generation == seen_generation) {
+            sw_cond_wait(&impl->job_cv, &impl->mtx);
+        }
+        if (impl->stop) {
+            break;
+        }
+        seen_generation = impl->generation;
+        _swWorkersRunJob(impl);
+    }
+    sw_mutex_unlock(&impl->mtx);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI _swWorkerThreadProc(LPVOID param) {
+    _swWorkerLoop((struct SWworkers_impl *)param);
+    return 0;
+}
+#else
+static void *_swWorkerThreadProc(void *param) {
+    _swWorkerLoop((struct SWworkers_impl *)param);
+    return NULL;
+}
+#endif
+
+void swWorkersInit(SWworkers *w, SWint num_threads) {
+    w->num_threads = 1;
+    w->impl = NULL;
+
+    num_threads = sw_min(num_threads, SW_MAX_THREADS);
+    if (num_threads <= 1) {
+        return;
+    }
+
+    struct SWworkers_impl *impl = (struct SWworkers_impl *)calloc(1, sizeof(struct SWworkers_impl));
+    sw_mutex_init(&impl->mtx);
+    sw_cond_init(&impl->job_cv);
+    sw_cond_init(&impl->done_cv);
+
+    /* calling thread is used as one of workers */
+    for (SWint i = 0; i < num_threads - 1; i++) {
+#ifdef _WIN32
+        impl->threads[i] = CreateThread(NULL, 0, _swWorkerThreadProc, impl, 0, NULL);
+        if (!impl->threads[i]) {
+            break;
+        }
+#else
+        if (pthread_create(&impl->threads[i], NULL, _swWorkerThreadProc, impl) != 0) {
+            break;
+        }
+#endif
+        impl->num_threads++;
+    }
+
+    w->num_threads = impl->num_threads + 1;
+    w->impl = impl;
+}
+
+void swWorkersDestroy(SWworkers *w) {
+    struct SWworkers_impl *impl = w->impl;
+    if (impl) {
+        sw_mutex_lock(&impl->mtx);
+        impl->stop = 1;
+        sw_cond_broadcast(&impl->job_cv);
+        sw_mutex_unlock(&impl->mtx);
+
+        for (SWint i = 0; i < impl->num_threads; i++) {
+#ifdef _WIN32
+            WaitForSingleObject(impl->threads[i], INFINITE);
+            CloseHandle(impl->threads[i]);
+#else
+            pthread_join(impl->threads[i], NULL);
+#endif
+        }
+
+        sw_cond_destroy(&impl->done_cv);
+        sw_cond_destroy(&impl->job_cv);
+        sw_mutex_destroy(&impl->mtx);
+        free(impl);
+    }
+    w->num_threads = 1;
+    w->impl = NULL;
+}
+
+void swWorkersParallelFor(SWworkers *w, const SWint count, sw_job_proc proc, void *arg) {
+    struct SWworkers_impl *impl = w->impl;
+    if (!impl || count <= 1) {
+        for (SWint i = 0; i < count; i++) {
+            (*proc)(arg, i);
+        }
+        return;
+    }
+
+    sw_mutex_lock(&impl->mtx);
+    assert(impl->done == impl->count && "Nested calls are not supported!");
+    impl->proc = proc;
+    impl->arg = arg;
+    impl->count = count;
+    impl->next = impl->done = 0;
+    impl->generation++;
+    sw_cond_broadcast(&impl->job_cv);
+
+    _swWorkersRunJob(impl);
+    while (impl->done != impl->count) {
+        sw_cond_wait(&impl->done_cv, &impl->mtx);
+    }
+    sw_mutex_unlock(&impl->mtx);
+}
@@ -0,0 +1,23 @@
+#ifndef SW_WORKERS_H
+#define SW_WORKERS_H
+
+#include "SWcore.h"
+
+#define SW_MAX_THREADS 64
+
+typedef void (*sw_job_proc)(void *arg, SWint i);
+
+struct SWworkers_impl;
+
+typedef struct SWworkers {
+    SWint num_threads; /* including calling thread */
+    struct SWworkers_impl *impl;
+} SWworkers;
+
+void swWorkersInit(SWworkers *w, SWint num_threads);
+void swWorkersDestroy(SWworkers *w);
+
+/* Calls proc(arg, i) for i in [0, count), calling thread participates and returns when all calls finished */
+void swWorkersParallelFor(SWworkers *w, SWint count, sw_job_proc proc, void *arg);
+
+#endif /* SW_WORKERS_H */
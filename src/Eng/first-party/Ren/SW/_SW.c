@@ -1,4 +1,5 @@
 
+#include "SWbinner.c"
 #include "SWbuffer.c"
 #include "SWcompress.c"
 #include "SWcontext.c"
@@ -9,6 +10,7 @@
 #include "SWprogram.c"
 #include "SWrasterize.c"
 #include "SWtexture.c"
+#include "SWworkers.c"
 #include "SWzbuffer.c"
 
 #include "SWculling.c"
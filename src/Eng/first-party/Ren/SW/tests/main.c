@@ -3,18 +3,22 @@
 
 void test_buffer();
 void test_context();
+void test_culling();
 void test_framebuffer();
 void test_pixels();
 void test_program();
+void test_rasterize();
 void test_texture();
 void test_zbuffer();
 
 int main() {
     test_buffer();
     test_context();
+    test_culling();
     test_framebuffer();
     test_pixels();
     test_program();
+    test_rasterize();
     test_texture();
     test_zbuffer();
 }
\ No newline at end of file
@@ -0,0 +1,221 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "test_common.h"
+
+#include <string.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "../SW.h"
+
+static double _time_ms() {
+#ifdef _WIN32
+    LARGE_INTEGER freq, t;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&t);
+    return 1000.0 * (double)t.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return 1000.0 * (double)t.tv_sec + 0.000001 * (double)t.tv_nsec;
+#endif
+}
+
+static SWfloat _rand_float(SWuint *state) {
+    (*state) = (*state) * 1664525u + 1013904223u;
+    return (SWfloat)((*state) >> 8) / 16777216.0f;
+}
+
+/* random triangles in view space, position is (x, y, z) */
+static void _gen_triangles(SWfloat *attribs, SWuint *indices, const int tri_count,
+                           const SWfloat size, SWuint *rand_state) {
+    for (int i = 0; i < tri_count; i++) {
+        const SWfloat z = 1.0f + 20.0f * _rand_float(rand_state);
+        const SWfloat cx = z * (2.4f * _rand_float(rand_state) - 1.2f),
+                      cy = z * (2.4f * _rand_float(rand_state) - 1.2f);
+        for (int j = 0; j < 3; j++) {
+            SWfloat *v = &attribs[(i * 3 + j) * 3];
+            v[0] = cx + z * size * (2 * _rand_float(rand_state) - 1);
+            v[1] = cy + z * size * (2 * _rand_float(rand_state) - 1);
+            v[2] = z + 0.5f * _rand_float(rand_state);
+        }
+        /* make triangles front facing */
+        const SWfloat *v0 = &attribs[(i * 3 + 0) * 3], *v1 = &attribs[(i * 3 + 1) * 3],
+                      *v2 = &attribs[(i * 3 + 2) * 3];
+        const int flip = (v1[0] / v1[2] - v0[0] / v0[2]) * (v2[1] / v2[2] - v0[1] / v0[2]) -
+                             (v2[0] / v2[2] - v0[0] / v0[2]) * (v1[1] / v1[2] - v0[1] / v0[2]) <
+                         0;
+        indices[i * 3 + 0] = i * 3 + 0;
+        indices[i * 3 + 1] = i * 3 + (flip ? 2 : 1);
+        indices[i * 3 + 2] = i * 3 + (flip ? 1 : 2);
+    }
+}
+
+static void _init_surf(SWcull_surf *s, const SWsurf_type type, const SWfloat *attribs,
+                       const SWuint *indices, const SWuint count, const SWfloat *xform) {
+    memset(s, 0, sizeof(SWcull_surf));
+    s->type = type;
+    s->prim_type = SW_TRIANGLES;
+    s->index_type = SW_UNSIGNED_INT;
+    s->attribs = attribs;
+    s->indices = indices;
+    s->stride = 3 * sizeof(SWfloat);
+    s->count = count;
+    s->xform = xform;
+}
+
+void test_culling() {
+    printf("Test culling            | ");
+
+    const int W = 640, H = 360;
+    const int OccluderSurfCount = 16, OccluderTriCount = 256;
+    const int OccludeeTriCount = 4000;
+
+    /* w = z, x and y are passed through */
+    const SWfloat xform[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0};
+
+    SWuint rand_state = 4321;
+
+    SWfloat *occluder_attribs = malloc(OccluderSurfCount * OccluderTriCount * 3 * 3 * sizeof(SWfloat));
+    SWuint *occluder_indices = malloc(OccluderSurfCount * OccluderTriCount * 3 * sizeof(SWuint));
+    for (int i = 0; i < OccluderSurfCount; i++) {
+        /* mix of big and small occluders */
+        _gen_triangles(&occluder_attribs[i * OccluderTriCount * 3 * 3],
+                       &occluder_indices[i * OccluderTriCount * 3], OccluderTriCount,
+                       (i % 4) ? 0.1f : 0.8f, &rand_state);
+        for (int j = 0; j < OccluderTriCount * 3; j++) {
+            occluder_indices[i * OccluderTriCount * 3 + j] += i * OccluderTriCount * 3;
+        }
+    }
+
+    SWcull_surf occluders[16];
+    for (int i = 0; i < OccluderSurfCount; i++) {
+        _init_surf(&occluders[i], SW_OCCLUDER, occluder_attribs,
+                   &occluder_indices[i * OccluderTriCount * 3], OccluderTriCount * 3, xform);
+    }
+
+    SWfloat *occludee_attribs = malloc(OccludeeTriCount * 3 * 3 * sizeof(SWfloat));
+    SWuint *occludee_indices = malloc(OccludeeTriCount * 3 * sizeof(SWuint));
+    _gen_triangles(occludee_attribs, occludee_indices, OccludeeTriCount, 0.02f, &rand_state);
+
+    SWcull_ctx ref_ctx = {0}, ctx = {0};
+    swCullCtxInit(&ref_ctx, W, H, 0.5f);
+    swCullCtxInit(&ctx, W, H, 0.5f);
+
+    /* reference result is produced serially without coarse depth level */
+    swCullCtxSubmitCullSurfs(&ref_ctx, occluders, OccluderSurfCount);
+
+    SWfloat *ref_depth = malloc(W * H * sizeof(SWfloat));
+    SWfloat *depth = malloc(W * H * sizeof(SWfloat));
+    swCullCtxDebugDepth(&ref_ctx, ref_depth);
+
+    const int bin_counts[] = {1, 2, 3, 7, 64};
+    for (int i = 0; i < sizeof(bin_counts) / sizeof(bin_counts[0]); i++) {
+        swCullCtxClear(&ctx);
+        swCullCtxBinCullSurfs(&ctx, occluders, OccluderSurfCount, bin_counts[i]);
+        /* bins are independent, so order should not matter */
+        for (int bin = bin_counts[i] - 1; bin >= 0; bin--) {
+            swCullCtxRasterizeBin(&ctx, bin);
+        }
+
+        { /* binned rasterization gives the same depth */
+            swCullCtxDebugDepth(&ctx, depth);
+            require(memcmp(ref_depth, depth, W * H * sizeof(SWfloat)) == 0);
+        }
+
+        { /* some of coarse blocks are fully covered */
+            int covered_count = 0;
+            for (int j = 0; j < ctx.hiz_w * ctx.hiz_h; j++) {
+                covered_count += (ctx.hiz[j] > 0);
+            }
+            require(covered_count > 0);
+        }
+
+        { /* coarse depth level does not change visibility of occludees */
+            int occluded_count = 0;
+            for (int j = 0; j < OccludeeTriCount; j++) {
+                SWcull_surf ref_surf, surf;
+                _init_surf(&ref_surf, SW_OCCLUDEE, occludee_attribs, &occludee_indices[j * 3], 3,
+                           xform);
+                _init_surf(&surf, SW_OCCLUDEE, occludee_attribs, &occludee_indices[j * 3], 3,
+                           xform);
+
+                swCullCtxSubmitCullSurfs(&ref_ctx, &ref_surf, 1);
+                swCullCtxSubmitCullSurfs(&ctx, &surf, 1);
+                require(ref_surf.visible == surf.visible);
+
+                occluded_count += !surf.visible;
+            }
+            require(occluded_count > 0 && occluded_count < OccludeeTriCount);
+        }
+
+        { /* coarse depth level does not change result of rect tests */
+            SWuint rect_rand_state = 1234;
+            for (int j = 0; j < 10000; j++) {
+                const SWfloat x = 2.2f * _rand_float(&rect_rand_state) - 1.1f,
+                              y = 2.2f * _rand_float(&rect_rand_state) - 1.1f;
+                const SWfloat w = 0.4f * _rand_float(&rect_rand_state),
+                              h = 0.4f * _rand_float(&rect_rand_state);
+                const SWfloat p_min[2] = {x, y}, p_max[3] = {x + w, y + h, 0};
+                const SWfloat w_min = 1.0f + 25.0f * _rand_float(&rect_rand_state);
+
+                require(swCullCtxTestRect(&ref_ctx, p_min, p_max, w_min) ==
+                        swCullCtxTestRect(&ctx, p_min, p_max, w_min));
+            }
+        }
+    }
+
+    free(depth);
+    free(ref_depth);
+
+    printf("OK\n");
+
+    { // occluders throughput (bins are processed one after another, so it is a total amount of work)
+        const int FrameCount = 64;
+
+        double t1 = _time_ms();
+        for (int j = 0; j < FrameCount; j++) {
+            swCullCtxClear(&ref_ctx);
+            swCullCtxSubmitCullSurfs(&ref_ctx, occluders, OccluderSurfCount);
+        }
+        double t2 = _time_ms();
+        printf("\tOccluders (%ix%i, %i tris, serial): %.2fms\n", W, H,
+               OccluderSurfCount * OccluderTriCount, (t2 - t1) / FrameCount);
+
+        const int bench_bin_counts[] = {1, 8, 64};
+        for (int i = 0; i < sizeof(bench_bin_counts) / sizeof(bench_bin_counts[0]); i++) {
+            t1 = _time_ms();
+            for (int j = 0; j < FrameCount; j++) {
+                swCullCtxClear(&ctx);
+                swCullCtxBinCullSurfs(&ctx, occluders, OccluderSurfCount, bench_bin_counts[i]);
+                for (int bin = 0; bin < bench_bin_counts[i]; bin++) {
+                    swCullCtxRasterizeBin(&ctx, bin);
+                }
+            }
+            t2 = _time_ms();
+            printf("\tOccluders (%ix%i, %i tris, %i bins): %.2fms\n", W, H,
+                   OccluderSurfCount * OccluderTriCount, bench_bin_counts[i],
+                   (t2 - t1) / FrameCount);
+        }
+    }
+
+    swCullCtxDestroy(&ctx);
+    swCullCtxDestroy(&ref_ctx);
+
+    free(occludee_indices);
+    free(occludee_attribs);
+    free(occluder_indices);
+    free(occluder_attribs);
+}
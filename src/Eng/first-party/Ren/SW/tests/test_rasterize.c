@@ -0,0 +1,207 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "test_common.h"
+
+#include <string.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "../SW.h"
+
+static double _time_ms() {
+#ifdef _WIN32
+    LARGE_INTEGER freq, t;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&t);
+    return 1000.0 * (double)t.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return 1000.0 * (double)t.tv_sec + 0.000001 * (double)t.tv_nsec;
+#endif
+}
+
+enum { A_POS, A_COL };
+
+enum { V_COL };
+
+static VSHADER raster_test_vs(VS_IN, VS_OUT) {
+    ((void)uniforms);
+
+    const SWfloat *pos = V_FATTR(A_POS), *col = V_FATTR(A_COL);
+    V_POS_OUT[0] = pos[0];
+    V_POS_OUT[1] = pos[1];
+    V_POS_OUT[2] = pos[2];
+    V_POS_OUT[3] = 1;
+
+    V_FVARYING(V_COL)[0] = col[0];
+    V_FVARYING(V_COL)[1] = col[1];
+    V_FVARYING(V_COL)[2] = col[2];
+    V_FVARYING(V_COL)[3] = col[3];
+}
+
+static FSHADER raster_test_fs(FS_IN, FS_OUT) {
+    ((void)uniforms);
+    ((void)b_discard);
+
+    const SWfloat *col = F_FVARYING_IN(V_COL);
+
+    /* some arbitrary shading work */
+    SWfloat k = 0;
+    for (int i = 0; i < 8; i++) {
+        k += col[i % 3] * col[(i + 1) % 3] * (1.0f / 8);
+    }
+
+    F_COL_OUT[0] = col[0] * (0.5f + 0.5f * k);
+    F_COL_OUT[1] = col[1] * (0.5f + 0.5f * k);
+    F_COL_OUT[2] = col[2] * (0.5f + 0.5f * k);
+    F_COL_OUT[3] = col[3];
+}
+
+static SWfloat _rand_float(SWuint *state) {
+    (*state) = (*state) * 1664525u + 1013904223u;
+    return (SWfloat)((*state) >> 8) / 16777216.0f;
+}
+
+/* random triangles with position (3 floats) and color (4 floats) per vertex */
+static SWfloat *_gen_triangles(const int tri_count, const SWfloat size) {
+    SWfloat *attribs = malloc(tri_count * 3 * 7 * sizeof(SWfloat));
+    SWuint rand_state = 12345;
+    for (int i = 0; i < tri_count; i++) {
+        const SWfloat cx = 2.2f * _rand_float(&rand_state) - 1.1f,
+                      cy = 2.2f * _rand_float(&rand_state) - 1.1f,
+                      cz = _rand_float(&rand_state);
+        const SWfloat r = _rand_float(&rand_state), g = _rand_float(&rand_state),
+                      b = _rand_float(&rand_state), a = 0.25f + 0.5f * _rand_float(&rand_state);
+        for (int j = 0; j < 3; j++) {
+            SWfloat *v = &attribs[(i * 3 + j) * 7];
+            v[0] = cx + size * (2 * _rand_float(&rand_state) - 1);
+            v[1] = cy + size * (2 * _rand_float(&rand_state) - 1);
+            v[2] = cz;
+            v[3] = r;
+            v[4] = g;
+            v[5] = b;
+            v[6] = a;
+        }
+        /* make winding consistent */
+        const SWfloat *v0 = &attribs[(i * 3 + 0) * 7], *v1 = &attribs[(i * 3 + 1) * 7],
+                      *v2 = &attribs[(i * 3 + 2) * 7];
+        if ((v1[0] - v0[0]) * (v2[1] - v0[1]) - (v2[0] - v0[0]) * (v1[1] - v0[1]) < 0) {
+            SWfloat tmp[7];
+            memcpy(tmp, &attribs[(i * 3 + 1) * 7], sizeof(tmp));
+            memcpy(&attribs[(i * 3 + 1) * 7], &attribs[(i * 3 + 2) * 7], sizeof(tmp));
+            memcpy(&attribs[(i * 3 + 2) * 7], tmp, sizeof(tmp));
+        }
+    }
+    return attribs;
+}
+
+static void _draw_triangles(const SWfloat *attribs, const int tri_count, const int blend) {
+    swClearColor(0, 0, 0, 1);
+    swClearDepth(1);
+
+    if (blend) {
+        swEnable(SW_BLEND);
+        swDisable(SW_DEPTH_WRITE);
+    } else {
+        swDisable(SW_BLEND);
+        swEnable(SW_DEPTH_WRITE);
+    }
+
+    swVertexAttribPointer(A_POS, 3 * sizeof(SWfloat), 7 * sizeof(SWfloat), &attribs[0]);
+    swVertexAttribPointer(A_COL, 4 * sizeof(SWfloat), 7 * sizeof(SWfloat), &attribs[3]);
+    swDrawArrays(SW_TRIANGLES, 0, 3 * tri_count);
+}
+
+void test_rasterize() {
+    printf("Test rasterize          | ");
+
+    const int W = 640, H = 360;
+
+    SWcontext *prev_ctx = NULL;
+    {
+        extern SWcontext *sw_cur_context;
+        prev_ctx = sw_cur_context;
+    }
+
+    SWcontext *ctx = swCreateContext(W, H);
+    swMakeCurrent(ctx);
+
+    SWint program = swCreateProgram();
+    swUseProgram(program);
+    swInitProgram(raster_test_vs, raster_test_fs, 4);
+
+    require(swGetInteger(SW_NUM_THREADS) == 1);
+
+    { // binned rasterization gives the same result as serial one
+        const int TriCount = 2000;
+        SWfloat *attribs = _gen_triangles(TriCount, 0.15f);
+
+        SWubyte *ref_pixels = malloc(W * H * 4);
+        SWfloat *ref_depth = malloc(W * H * sizeof(SWfloat));
+
+        for (int blend = 0; blend < 2; blend++) {
+            swSetInteger(SW_NUM_THREADS, 1);
+            _draw_triangles(attribs, TriCount, blend);
+            memcpy(ref_pixels, swGetPixelDataRef(swGetCurFramebuffer()), W * H * 4);
+            memcpy(ref_depth, swGetDepthDataRef(swGetCurFramebuffer()), W * H * sizeof(SWfloat));
+
+            const int threads[] = {2, 3, 8};
+            for (int i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+                swSetInteger(SW_NUM_THREADS, threads[i]);
+                require(swGetInteger(SW_NUM_THREADS) == threads[i]);
+
+                _draw_triangles(attribs, TriCount, blend);
+                require(memcmp(ref_pixels, swGetPixelDataRef(swGetCurFramebuffer()), W * H * 4) == 0);
+                require(memcmp(ref_depth, swGetDepthDataRef(swGetCurFramebuffer()),
+                               W * H * sizeof(SWfloat)) == 0);
+            }
+        }
+
+        free(ref_depth);
+        free(ref_pixels);
+        free(attribs);
+    }
+
+    printf("OK\n");
+
+    { // throughput benchmark
+        const int TriCount = 20000, FrameCount = 8;
+        SWfloat *attribs = _gen_triangles(TriCount, 0.05f);
+
+        const int num_threads[] = {1, 2, 4, swGetInteger(SW_NUM_CPUS)};
+        for (int i = 0; i < sizeof(num_threads) / sizeof(num_threads[0]); i++) {
+            if (i == 3 && num_threads[i] <= 4) {
+                break;
+            }
+            swSetInteger(SW_NUM_THREADS, num_threads[i]);
+
+            const double t1 = _time_ms();
+            for (int j = 0; j < FrameCount; j++) {
+                _draw_triangles(attribs, TriCount, 0);
+            }
+            const double t2 = _time_ms();
+            const double ms_per_frame = (t2 - t1) / FrameCount;
+            printf("\tRasterization (%ix%i, %i tris, %i threads): %.2fms (%.2f Mtris/s)\n", W, H,
+                   TriCount, num_threads[i], ms_per_frame, 0.001 * TriCount / ms_per_frame);
+        }
+
+        free(attribs);
+    }
+
+    swDeleteProgram(program);
+    swDeleteContext(ctx);
+    swMakeCurrent(prev_ctx);
+}
@@ -2247,6 +2247,78 @@ void Emit_BC4_Block_SSE2(uint8_t block[16], uint8_t *&out_data) {
 
     EmitAlphaOnlyIndices_SSE2(block, min_alpha, max_alpha, out_data);
 }
+
+// Two horizontally adjacent blocks are encoded at once (color blocks are expected to have interleaved rows)
+template <int Channels> void Extract4x4Blocks2_AVX2(const uint8_t src[], int stride, uint8_t dst[128]);
+template <int SrcChannels> void ExtractChannel4x4Blocks2_AVX2(const uint8_t src[], int stride, uint8_t dst[32]);
+template <bool UseAlpha = false, bool Is_YCoCg = false>
+void GetMinMaxColorByBBox_AVX2(const uint8_t blocks[128], uint8_t min_color[8], uint8_t max_color[8]);
+void ScaleYCoCg_AVX2(uint8_t blocks[128], uint8_t min_color[8], uint8_t max_color[8]);
+void InsetYCoCgBBox_AVX2(uint8_t min_color[8], uint8_t max_color[8]);
+void SelectYCoCgDiagonal_AVX2(const uint8_t blocks[128], uint8_t min_color[8], uint8_t max_color[8]);
+void GetColorIndices_AVX2(const uint8_t blocks[128], const uint8_t min_color[8], const uint8_t max_color[8],
+                          uint32_t out_indices[2]);
+void GetAlphaIndices_AVX2(const uint8_t blocks[128], const uint8_t min_alpha[2], const uint8_t max_alpha[2],
+                          uint8_t out_indices[12]);
+void EmitAlphaOnlyBlocks2_AVX2(const uint8_t blocks[32], uint8_t out_data[16]);
+
+void Emit_BC1_Blocks2_AVX2(const uint8_t blocks[128], uint8_t *&out_data) {
+    uint8_t min_color[8], max_color[8];
+    GetMinMaxColorByBBox_AVX2(blocks, min_color, max_color);
+
+    uint32_t indices[2];
+    GetColorIndices_AVX2(blocks, min_color, max_color, indices);
+
+    for (int i = 0; i < 2; ++i) {
+        push_u16(rgb888_to_rgb565(&max_color[4 * i]), out_data);
+        push_u16(rgb888_to_rgb565(&min_color[4 * i]), out_data);
+        push_u32(indices[i], out_data);
+    }
+}
+
+template <bool Is_YCoCg> void Emit_BC3_Blocks2_AVX2(uint8_t blocks[128], uint8_t *&out_data) {
+    uint8_t min_color[8], max_color[8];
+    GetMinMaxColorByBBox_AVX2<true /* UseAlpha */, Is_YCoCg>(blocks, min_color, max_color);
+    if (Is_YCoCg) {
+        ScaleYCoCg_AVX2(blocks, min_color, max_color);
+        InsetYCoCgBBox_AVX2(min_color, max_color);
+        SelectYCoCgDiagonal_AVX2(blocks, min_color, max_color);
+    }
+
+    const uint8_t min_alpha[2] = {min_color[3], min_color[7]}, max_alpha[2] = {max_color[3], max_color[7]};
+
+    uint8_t alpha_indices[12];
+    GetAlphaIndices_AVX2(blocks, min_alpha, max_alpha, alpha_indices);
+
+    uint32_t color_indices[2];
+    GetColorIndices_AVX2(blocks, min_color, max_color, color_indices);
+
+    for (int i = 0; i < 2; ++i) {
+        //
+        // Write alpha block
+        //
+
+        push_u8(max_alpha[i], out_data);
+        push_u8(min_alpha[i], out_data);
+
+        memcpy(out_data, &alpha_indices[6 * i], 6);
+        out_data += 6;
+
+        //
+        // Write color block
+        //
+
+        push_u16(rgb888_to_rgb565(&max_color[4 * i]), out_data);
+        push_u16(rgb888_to_rgb565(&min_color[4 * i]), out_data);
+        push_u32(color_indices[i], out_data);
+    }
+}
+
+// NOTE: BC5 block is the same as two consecutive BC4 blocks
+void Emit_BC4_Blocks2_AVX2(const uint8_t blocks[32], uint8_t *&out_data) {
+    EmitAlphaOnlyBlocks2_AVX2(blocks, out_data);
+    out_data += 2 * BlockSize_BC4;
+}
 #endif
 
 } // namespace Ren
@@ -2305,10 +2377,19 @@ void Ren::CompressImage_BC1(const uint8_t img_src[], const int w, const int h, u
     }
 #else
     if (g_CpuFeatures.sse2_supported && g_CpuFeatures.ssse3_supported) {
+        const bool use_avx2 = g_CpuFeatures.avx2_supported;
         for (int j = 0; j < h_aligned; j += 4, img_src += 4 * w * SrcChannels) {
             const int w_limited =
                 (SrcChannels == 3 && j == h_aligned - 4 && h_aligned == h) ? w_aligned - 4 : w_aligned;
-            for (int i = 0; i < w_limited; i += 4) {
+            int i = 0;
+            if (use_avx2) {
+                alignas(32) uint8_t blocks[128];
+                for (; i + 8 <= w_limited; i += 8) {
+                    Extract4x4Blocks2_AVX2<SrcChannels>(&img_src[i * SrcChannels], w * SrcChannels, blocks);
+                    Emit_BC1_Blocks2_AVX2(blocks, p_out);
+                }
+            }
+            for (; i < w_limited; i += 4) {
                 Extract4x4Block_SSSE3<SrcChannels>(&img_src[i * SrcChannels], w * SrcChannels, block);
                 Emit_BC1_Block_SSE2(block, p_out);
             }
@@ -2390,8 +2471,17 @@ void Ren::CompressImage_BC3(const uint8_t img_src[], const int w, const int h, u
     }
 #else
     if (g_CpuFeatures.sse2_supported && g_CpuFeatures.ssse3_supported) {
+        const bool use_avx2 = g_CpuFeatures.avx2_supported;
         for (int j = 0; j < h_aligned; j += 4, img_src += w * 4 * 4) {
-            for (int i = 0; i < w_aligned; i += 4) {
+            int i = 0;
+            if (use_avx2) {
+                alignas(32) uint8_t blocks[128];
+                for (; i + 8 <= w_aligned; i += 8) {
+                    Extract4x4Blocks2_AVX2<4 /* Channels */>(&img_src[i * 4], w * 4, blocks);
+                    Emit_BC3_Blocks2_AVX2<Is_YCoCg>(blocks, p_out);
+                }
+            }
+            for (; i < w_aligned; i += 4) {
                 Extract4x4Block_SSSE3<4 /* SrcChannels */>(&img_src[i * 4], w * 4, block);
                 Emit_BC3_Block_SSE2<Is_YCoCg>(block, p_out);
             }
@@ -2466,8 +2556,23 @@ void Ren::CompressImage_BC4(const uint8_t img_src[], const int w, const int h, u
     }
 #else
     if (g_CpuFeatures.sse2_supported) {
+        const bool use_avx2 = g_CpuFeatures.avx2_supported;
         for (int j = 0; j < h_aligned; j += 4, img_src += w * 4 * SrcChannels) {
-            for (int i = 0; i < w_aligned; i += 4) {
+            int i = 0;
+            if (use_avx2) {
+                alignas(32) uint8_t blocks[32];
+                for (; i + 8 <= w_aligned; i += 8) {
+                    if (SrcChannels == 1) {
+                        ExtractChannel4x4Blocks2_AVX2<1 /* SrcChannels */>(&img_src[i], w, blocks);
+                    } else {
+                        Extract4x4Block_Ref<SrcChannels, 1>(&img_src[i * SrcChannels], w * SrcChannels, &blocks[0]);
+                        Extract4x4Block_Ref<SrcChannels, 1>(&img_src[(i + 4) * SrcChannels], w * SrcChannels,
+                                                            &blocks[16]);
+                    }
+                    Emit_BC4_Blocks2_AVX2(blocks, p_out);
+                }
+            }
+            for (; i < w_aligned; i += 4) {
                 Extract4x4Block_Ref<SrcChannels, 1>(&img_src[i * SrcChannels], w * SrcChannels, block);
                 Emit_BC4_Block_SSE2(block, p_out);
             }
@@ -2520,7 +2625,9 @@ template void Ren::CompressImage_BC4<1 /* SrcChannels */>(const uint8_t img_src[
 
 template <int SrcChannels>
 void Ren::CompressImage_BC5(const uint8_t img_src[], const int w, const int h, uint8_t img_dst[], int dst_pitch) {
-    alignas(16) uint8_t block1[16] = {}, block2[16] = {};
+    // NOTE: both blocks are kept in contiguous memory to be encoded at once with AVX2
+    alignas(32) uint8_t blocks[32] = {};
+    uint8_t *block1 = &blocks[0], *block2 = &blocks[16];
     uint8_t *p_out = img_dst;
 
     const int w_aligned = w - (w % 4);
@@ -2558,12 +2665,21 @@ void Ren::CompressImage_BC5(const uint8_t img_src[], const int w, const int h, u
     }
 #else
     if (g_CpuFeatures.sse2_supported) {
+        const bool use_avx2 = g_CpuFeatures.avx2_supported;
         for (int j = 0; j < h_aligned; j += 4, img_src += w * 4 * SrcChannels) {
             for (int i = 0; i < w_aligned; i += 4) {
-                Extract4x4Block_Ref<SrcChannels, 1>(&img_src[i * SrcChannels + 0], w * SrcChannels, block1);
-                Extract4x4Block_Ref<SrcChannels, 1>(&img_src[i * SrcChannels + 1], w * SrcChannels, block2);
-                Emit_BC4_Block_SSE2(block1, p_out);
-                Emit_BC4_Block_SSE2(block2, p_out);
+                if (use_avx2 && SrcChannels == 2) {
+                    ExtractChannel4x4Blocks2_AVX2<2 /* SrcChannels */>(&img_src[i * 2], w * 2, blocks);
+                } else {
+                    Extract4x4Block_Ref<SrcChannels, 1>(&img_src[i * SrcChannels + 0], w * SrcChannels, block1);
+                    Extract4x4Block_Ref<SrcChannels, 1>(&img_src[i * SrcChannels + 1], w * SrcChannels, block2);
+                }
+                if (use_avx2) {
+                    Emit_BC4_Blocks2_AVX2(blocks, p_out);
+                } else {
+                    Emit_BC4_Block_SSE2(block1, p_out);
+                    Emit_BC4_Block_SSE2(block2, p_out);
+                }
             }
             // process last (incomplete) column
             if (w_aligned != w) {
@@ -2571,8 +2687,12 @@ void Ren::CompressImage_BC5(const uint8_t img_src[], const int w, const int h, u
                                                               w % 4, 4, block1);
                 ExtractIncomplete4x4Block_Ref<SrcChannels, 1>(&img_src[w_aligned * SrcChannels + 1], w * SrcChannels,
                                                               w % 4, 4, block2);
-                Emit_BC4_Block_SSE2(block1, p_out);
-                Emit_BC4_Block_SSE2(block2, p_out);
+                if (use_avx2) {
+                    Emit_BC4_Blocks2_AVX2(blocks, p_out);
+                } else {
+                    Emit_BC4_Block_SSE2(block1, p_out);
+                    Emit_BC4_Block_SSE2(block2, p_out);
+                }
             }
             p_out += pitch_pad;
         }
@@ -2582,8 +2702,12 @@ void Ren::CompressImage_BC5(const uint8_t img_src[], const int w, const int h, u
                                                           _MIN(4, w - i), h % 4, block1);
             ExtractIncomplete4x4Block_Ref<SrcChannels, 1>(&img_src[i * SrcChannels + 1], w * SrcChannels,
                                                           _MIN(4, w - i), h % 4, block2);
-            Emit_BC4_Block_SSE2(block1, p_out);
-            Emit_BC4_Block_SSE2(block2, p_out);
+            if (use_avx2) {
+                Emit_BC4_Blocks2_AVX2(blocks, p_out);
+            } else {
+                Emit_BC4_Block_SSE2(block1, p_out);
+                Emit_BC4_Block_SSE2(block2, p_out);
+            }
         }
     } else {
         for (int j = 0; j < h_aligned; j += 4, img_src += w * 4 * SrcChannels) {
@@ -2,12 +2,15 @@
 #include "Utils.h"
 
 #include <cassert>
+#include <cstring>
 
 #include <immintrin.h>
 #include <xmmintrin.h>
 
 #include "CPUFeatures.h"
 
+#define _ABS(x) ((x) < 0 ? -(x) : (x))
+
 void Ren::CopyYChannel_32px(const uint8_t *y_src, const int y_stride, const int w, const int h, uint8_t *y_dst) {
     assert(g_CpuFeatures.avx_supported);
     auto *py_dst = reinterpret_cast<__m256i *>(y_dst);
@@ -76,4 +79,580 @@ void Ren::CopyYChannel_32px(const uint8_t *y_src, const int y_stride, const int
     }
 }
 
-#endif
\ No newline at end of file
+//
+// Internal functions
+//
+
+// AVX2 versions of BCn encoding functions from Utils_SSE2.cpp. Two blocks are processed at once (one per 128-bit lane),
+// all per-lane operations are kept identical to SSE2 versions to produce bit-exact results.
+// Color blocks are stored with interleaved rows (row of first block, row of second block etc.)
+
+namespace Ren {
+void InsetYCoCgBBox_SSE2(uint8_t min_color[4], uint8_t max_color[4]);
+
+static __m256i _mm256_combine_si128(const __m128i lo, const __m128i hi) {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+static __m256i _mm256_load2_si32(const uint8_t src[8]) {
+    uint32_t lo, hi;
+    memcpy(&lo, &src[0], 4);
+    memcpy(&hi, &src[4], 4);
+    return _mm256_setr_epi32(int(lo), 0, 0, 0, int(hi), 0, 0, 0);
+}
+
+static void _mm256_store2_si32(uint8_t dst[8], const __m256i val) {
+    const uint32_t lo = _mm256_extract_epi32(val, 0), hi = _mm256_extract_epi32(val, 4);
+    memcpy(&dst[0], &lo, 4);
+    memcpy(&dst[4], &hi, 4);
+}
+
+// WARNING: Reads 4 bytes outside of second block in 3 channels case!
+template <int Channels> void Extract4x4Blocks2_AVX2(const uint8_t src[], const int stride, uint8_t dst[128]) {
+    // Copy rgb values and zero out alpha
+    const __m256i RGB_to_RGBA = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, //
+                                                 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    for (int j = 0; j < 4; j++) {
+        __m256i rgba;
+        if constexpr (Channels == 4) {
+            rgba = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        } else if constexpr (Channels == 3) {
+            const __m256i rgb = _mm256_combine_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src)),
+                                                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 12)));
+            rgba = _mm256_shuffle_epi8(rgb, RGB_to_RGBA);
+        }
+
+        _mm256_store_si256(reinterpret_cast<__m256i *>(dst), rgba);
+
+        src += stride;
+        dst += 2 * 4 * 4;
+    }
+}
+
+template void Extract4x4Blocks2_AVX2<4 /* Channels */>(const uint8_t src[], const int stride, uint8_t dst[128]);
+template void Extract4x4Blocks2_AVX2<3 /* Channels */>(const uint8_t src[], const int stride, uint8_t dst[128]);
+
+// Extracts two single-channel blocks, either two adjacent blocks (1 channel) or both channels of one block (2 channels)
+template <int SrcChannels> void ExtractChannel4x4Blocks2_AVX2(const uint8_t src[], const int stride, uint8_t dst[32]) {
+    static_assert(SrcChannels == 1 || SrcChannels == 2, "!");
+    int64_t rows[4];
+    for (int j = 0; j < 4; j++) {
+        memcpy(&rows[j], src, 8);
+        src += stride;
+    }
+    __m256i vals = _mm256_setr_epi64x(rows[0], rows[1], rows[2], rows[3]);
+    if constexpr (SrcChannels == 1) {
+        // separate 4-pixel groups of two blocks
+        const __m256i SeparateBlocks = _mm256_setr_epi8(0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15, //
+                                                        0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15);
+        vals = _mm256_shuffle_epi8(vals, SeparateBlocks);
+    } else if constexpr (SrcChannels == 2) {
+        // deinterleave channels
+        const __m256i SeparateChannels = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15, //
+                                                          0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+        vals = _mm256_shuffle_epi8(vals, SeparateChannels);
+    }
+    vals = _mm256_permute4x64_epi64(vals, _MM_SHUFFLE(3, 1, 2, 0));
+    _mm256_store_si256(reinterpret_cast<__m256i *>(dst), vals);
+}
+
+template void ExtractChannel4x4Blocks2_AVX2<1 /* SrcChannels */>(const uint8_t src[], const int stride,
+                                                                  uint8_t dst[32]);
+template void ExtractChannel4x4Blocks2_AVX2<2 /* SrcChannels */>(const uint8_t src[], const int stride,
+                                                                  uint8_t dst[32]);
+
+template <bool UseAlpha, bool Is_YCoCg>
+void GetMinMaxColorByBBox_AVX2(const uint8_t blocks[128], uint8_t min_color[8], uint8_t max_color[8]) {
+    __m256i min_col = _mm256_set1_epi8(-1 /* 255 */);
+    __m256i max_col = _mm256_set1_epi8(0);
+
+    const auto *_4px_lines = reinterpret_cast<const __m256i *>(blocks);
+
+    for (int i = 0; i < 4; i++) {
+        min_col = _mm256_min_epu8(min_col, _4px_lines[i]);
+        max_col = _mm256_max_epu8(max_col, _4px_lines[i]);
+    }
+
+    // Find horizontal min/max values
+    min_col = _mm256_min_epu8(min_col, _mm256_srli_si256(min_col, 8));
+    min_col = _mm256_min_epu8(min_col, _mm256_srli_si256(min_col, 4));
+
+    max_col = _mm256_max_epu8(max_col, _mm256_srli_si256(max_col, 8));
+    max_col = _mm256_max_epu8(max_col, _mm256_srli_si256(max_col, 4));
+
+    if constexpr (!Is_YCoCg) {
+        __m256i min_col_16 = _mm256_unpacklo_epi8(min_col, _mm256_setzero_si256());
+        __m256i max_col_16 = _mm256_unpacklo_epi8(max_col, _mm256_setzero_si256());
+        __m256i inset = _mm256_sub_epi16(max_col_16, min_col_16);
+        if constexpr (!UseAlpha) {
+            inset = _mm256_srli_epi16(inset, 4);
+        } else {
+            const __m256i CoCgInsetMul = _mm256_set_epi16(1, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2);
+            inset = _mm256_mullo_epi16(inset, CoCgInsetMul);
+            inset = _mm256_srli_epi16(inset, 5);
+        }
+        min_col_16 = _mm256_add_epi16(min_col_16, inset);
+        max_col_16 = _mm256_sub_epi16(max_col_16, inset);
+        min_col = _mm256_packus_epi16(min_col_16, min_col_16);
+        max_col = _mm256_packus_epi16(max_col_16, max_col_16);
+    }
+
+    _mm256_store2_si32(min_color, min_col);
+    _mm256_store2_si32(max_color, max_col);
+}
+
+template void GetMinMaxColorByBBox_AVX2<false /* UseAlpha */, false /* Is_YCoCg */>(const uint8_t blocks[128],
+                                                                                    uint8_t min_color[8],
+                                                                                    uint8_t max_color[8]);
+template void GetMinMaxColorByBBox_AVX2<true /* UseAlpha */, false /* Is_YCoCg */>(const uint8_t blocks[128],
+                                                                                   uint8_t min_color[8],
+                                                                                   uint8_t max_color[8]);
+template void GetMinMaxColorByBBox_AVX2<true /* UseAlpha */, true /* Is_YCoCg */>(const uint8_t blocks[128],
+                                                                                  uint8_t min_color[8],
+                                                                                  uint8_t max_color[8]);
+
+void ScaleYCoCg_AVX2(uint8_t blocks[128], uint8_t min_color[8], uint8_t max_color[8]) {
+    int scale[2];
+    for (int k = 0; k < 2; ++k) {
+        uint8_t *_min_color = &min_color[4 * k], *_max_color = &max_color[4 * k];
+
+        int m0 = _ABS(_min_color[0] - 128);
+        int m1 = _ABS(_min_color[1] - 128);
+        int m2 = _ABS(_max_color[0] - 128);
+        int m3 = _ABS(_max_color[1] - 128);
+
+        // clang-format off
+        if (m1 > m0) m0 = m1;
+        if (m3 > m2) m2 = m3;
+        if (m2 > m0) m0 = m2;
+        // clang-format on
+
+        static const int s0 = 128 / 2 - 1;
+        static const int s1 = 128 / 4 - 1;
+
+        const int mask0 = -(m0 <= s0);
+        const int mask1 = -(m0 <= s1);
+        scale[k] = 1 + (1 & mask0) + (2 & mask1);
+
+        _min_color[0] = (_min_color[0] - 128) * scale[k] + 128;
+        _min_color[1] = (_min_color[1] - 128) * scale[k] + 128;
+        _min_color[2] = (scale[k] - 1) * 8;
+
+        _max_color[0] = (_max_color[0] - 128) * scale[k] + 128;
+        _max_color[1] = (_max_color[1] - 128) * scale[k] + 128;
+        _max_color[2] = (scale[k] - 1) * 8;
+    }
+
+    const __m256i YCoCgScaleBias = _mm256_set1_epi32(0x00008080);
+
+    const __m256i _scale =
+        _mm256_combine_si128(_mm_set1_epi32((1 << 16) | scale[0]), _mm_set1_epi32((1 << 16) | scale[1]));
+    const __m256i _mask = _mm256_combine_si128(_mm_set1_epi32(int(0xffff0000u | (~(scale[0] - 1) & 0xff) * 0x0101)),
+                                               _mm_set1_epi32(int(0xffff0000u | (~(scale[1] - 1) & 0xff) * 0x0101)));
+
+    auto *_4px_lines = reinterpret_cast<__m256i *>(blocks);
+
+    for (int i = 0; i < 4; i++) {
+        __m256i cur_col = _mm256_load_si256(&_4px_lines[i]);
+
+        cur_col = _mm256_add_epi8(cur_col, YCoCgScaleBias);
+        cur_col = _mm256_mullo_epi16(cur_col, _scale);
+        cur_col = _mm256_and_si256(cur_col, _mask);
+        cur_col = _mm256_sub_epi8(cur_col, YCoCgScaleBias);
+
+        _mm256_store_si256(&_4px_lines[i], cur_col);
+    }
+}
+
+void InsetYCoCgBBox_AVX2(uint8_t min_color[8], uint8_t max_color[8]) {
+    // only endpoints are processed here, SSE2 version is good enough
+    InsetYCoCgBBox_SSE2(&min_color[0], &max_color[0]);
+    InsetYCoCgBBox_SSE2(&min_color[4], &max_color[4]);
+}
+
+void SelectYCoCgDiagonal_AVX2(const uint8_t blocks[128], uint8_t min_color[8], uint8_t max_color[8]) {
+    const __m256i CoCgMask = _mm256_set1_epi32(0x0000ffff);
+    const __m256i CoCgDiagonalMask = _mm256_setr_epi32(0x0000ff00, 0, 0, 0, 0x0000ff00, 0, 0, 0);
+    const __m256i Ones_i16 = _mm256_set1_epi16(1);
+    const __m256i Eights_i16 = _mm256_set1_epi16(8);
+
+    // load blocks
+    const __m256i line0 = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks));
+    const __m256i line1 = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks + 32));
+    const __m256i line2 = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks + 64));
+    const __m256i line3 = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks + 96));
+
+    // mask out everything except CoCg channels
+    const __m256i line0_CoCg = _mm256_and_si256(line0, CoCgMask);
+    const __m256i line1_CoCg = _mm256_and_si256(line1, CoCgMask);
+    const __m256i line2_CoCg = _mm256_and_si256(line2, CoCgMask);
+    const __m256i line3_CoCg = _mm256_and_si256(line3, CoCgMask);
+
+    // merge pairs of CoCg channels
+    const __m256i line01_CoCg = _mm256_or_si256(line0_CoCg, _mm256_slli_si256(line1_CoCg, 2));
+    const __m256i line23_CoCg = _mm256_or_si256(line2_CoCg, _mm256_slli_si256(line3_CoCg, 2));
+
+    __m256i min_col = _mm256_load2_si32(min_color);
+    __m256i max_col = _mm256_load2_si32(max_color);
+
+    __m256i mid = _mm256_avg_epu8(min_col, max_col);
+    mid = _mm256_shufflelo_epi16(mid, _MM_SHUFFLE(0, 0, 0, 0));
+    mid = _mm256_shuffle_epi32(mid, _MM_SHUFFLE(0, 0, 0, 0));
+
+    __m256i tmp1 = _mm256_max_epu8(mid, line01_CoCg);
+    __m256i tmp3 = _mm256_max_epu8(mid, line23_CoCg);
+    tmp1 = _mm256_cmpeq_epi8(tmp1, line01_CoCg);
+    tmp3 = _mm256_cmpeq_epi8(tmp3, line23_CoCg);
+
+    __m256i tmp0 = _mm256_srli_si256(tmp1, 1);
+    __m256i tmp2 = _mm256_srli_si256(tmp3, 1);
+
+    tmp0 = _mm256_xor_si256(tmp0, tmp1);
+    tmp2 = _mm256_xor_si256(tmp2, tmp3);
+    tmp0 = _mm256_and_si256(tmp0, Ones_i16);
+    tmp2 = _mm256_and_si256(tmp2, Ones_i16);
+
+    tmp0 = _mm256_add_epi16(tmp0, tmp2);
+    tmp0 = _mm256_sad_epu8(tmp0, _mm256_setzero_si256());
+    tmp1 = _mm256_shuffle_epi32(tmp0, _MM_SHUFFLE(1, 0, 3, 2));
+
+    tmp0 = _mm256_add_epi16(tmp0, tmp1);
+    tmp0 = _mm256_cmpgt_epi16(tmp0, Eights_i16);
+    tmp0 = _mm256_and_si256(tmp0, CoCgDiagonalMask);
+
+    min_col = _mm256_xor_si256(min_col, max_col);
+    tmp0 = _mm256_and_si256(tmp0, min_col);
+    max_col = _mm256_xor_si256(max_col, tmp0);
+    min_col = _mm256_xor_si256(min_col, max_col);
+
+    _mm256_store2_si32(min_color, min_col);
+    _mm256_store2_si32(max_color, max_col);
+}
+
+void GetColorIndices_AVX2(const uint8_t blocks[128], const uint8_t min_color[8], const uint8_t max_color[8],
+                          uint32_t out_indices[2]) {
+    const __m256i RGB565Mask = _mm256_setr_epi32(0x00f8fcf8, 0, 0x00f8fcf8, 0, 0x00f8fcf8, 0, 0x00f8fcf8, 0);
+    // multiplier used to emulate division by 3
+    const __m256i DivBy3_i16 = _mm256_set1_epi16((1 << 16) / 3 + 1);
+    const __m256i Ones_i16 = _mm256_set1_epi16(1);
+    const __m256i Twos_i16 = _mm256_set1_epi16(2);
+    const __m256i Zeroes_256 = _mm256_setzero_si256();
+
+    __m256i result = _mm256_setzero_si256();
+
+    // Find 4 colors on the line through min - max color
+    // compute color0 (max_color)
+    __m256i color0 = _mm256_load2_si32(max_color);
+    color0 = _mm256_and_si256(color0, RGB565Mask);
+    color0 = _mm256_unpacklo_epi8(color0, Zeroes_256);
+    __m256i rb = _mm256_shufflelo_epi16(color0, _MM_SHUFFLE(3, 2, 3, 0));
+    __m256i g = _mm256_shufflelo_epi16(color0, _MM_SHUFFLE(3, 3, 1, 3));
+    rb = _mm256_srli_epi16(rb, 5);
+    g = _mm256_srli_epi16(g, 6);
+    color0 = _mm256_or_si256(color0, rb);
+    color0 = _mm256_or_si256(color0, g);
+
+    // compute color1 (min_color)
+    __m256i color1 = _mm256_load2_si32(min_color);
+    color1 = _mm256_and_si256(color1, RGB565Mask);
+    color1 = _mm256_unpacklo_epi8(color1, Zeroes_256);
+    rb = _mm256_shufflelo_epi16(color1, _MM_SHUFFLE(3, 2, 3, 0));
+    g = _mm256_shufflelo_epi16(color1, _MM_SHUFFLE(3, 3, 1, 3));
+    rb = _mm256_srli_epi16(rb, 5);
+    g = _mm256_srli_epi16(g, 6);
+    color1 = _mm256_or_si256(color1, rb);
+    color1 = _mm256_or_si256(color1, g);
+
+    // compute and pack color3
+    __m256i color3 = _mm256_add_epi16(color1, color1);
+    color3 = _mm256_add_epi16(color0, color3);
+    color3 = _mm256_mulhi_epi16(color3, DivBy3_i16);
+    color3 = _mm256_packus_epi16(color3, Zeroes_256);
+    color3 = _mm256_shuffle_epi32(color3, _MM_SHUFFLE(1, 0, 1, 0));
+
+    // compute and pack color2
+    __m256i color2 = _mm256_add_epi16(color0, color0);
+    color2 = _mm256_add_epi16(color2, color1);
+    color2 = _mm256_mulhi_epi16(color2, DivBy3_i16);
+    color2 = _mm256_packus_epi16(color2, Zeroes_256);
+    color2 = _mm256_shuffle_epi32(color2, _MM_SHUFFLE(1, 0, 1, 0));
+
+    // pack color1
+    color1 = _mm256_packus_epi16(color1, Zeroes_256);
+    color1 = _mm256_shuffle_epi32(color1, _MM_SHUFFLE(1, 0, 1, 0));
+
+    // pack color0
+    color0 = _mm256_packus_epi16(color0, Zeroes_256);
+    color0 = _mm256_shuffle_epi32(color0, _MM_SHUFFLE(1, 0, 1, 0));
+
+    for (int i = 64; i >= 0; i -= 64) {
+        // load 4 colors (interleaved with zeroes)
+        __m256i line = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks + i));
+        __m256i color_hi = _mm256_unpacklo_epi32(line, Zeroes_256);
+        __m256i color_lo = _mm256_unpackhi_epi32(line, Zeroes_256);
+
+        // compute the sum of abs diff for each color
+        __m256i d_hi = _mm256_sad_epu8(color_hi, color0);
+        __m256i d_lo = _mm256_sad_epu8(color_lo, color0);
+        __m256i d0 = _mm256_packs_epi32(d_hi, d_lo);
+        d_hi = _mm256_sad_epu8(color_hi, color1);
+        d_lo = _mm256_sad_epu8(color_lo, color1);
+        __m256i d1 = _mm256_packs_epi32(d_hi, d_lo);
+        d_hi = _mm256_sad_epu8(color_hi, color2);
+        d_lo = _mm256_sad_epu8(color_lo, color2);
+        __m256i d2 = _mm256_packs_epi32(d_hi, d_lo);
+        d_hi = _mm256_sad_epu8(color_hi, color3);
+        d_lo = _mm256_sad_epu8(color_lo, color3);
+        __m256i d3 = _mm256_packs_epi32(d_hi, d_lo);
+
+        // load next 4 colors
+        line = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks + i + 32));
+        color_hi = _mm256_unpacklo_epi32(line, Zeroes_256);
+        color_lo = _mm256_unpackhi_epi32(line, Zeroes_256);
+
+        // compute the sum of abs diff for each color and combine with prev result
+        d_hi = _mm256_sad_epu8(color_hi, color0);
+        d_lo = _mm256_sad_epu8(color_lo, color0);
+        d_lo = _mm256_packs_epi32(d_hi, d_lo);
+        d0 = _mm256_packs_epi32(d0, d_lo);
+        d_hi = _mm256_sad_epu8(color_hi, color1);
+        d_lo = _mm256_sad_epu8(color_lo, color1);
+        d_lo = _mm256_packs_epi32(d_hi, d_lo);
+        d1 = _mm256_packs_epi32(d1, d_lo);
+        d_hi = _mm256_sad_epu8(color_hi, color2);
+        d_lo = _mm256_sad_epu8(color_lo, color2);
+        d_lo = _mm256_packs_epi32(d_hi, d_lo);
+        d2 = _mm256_packs_epi32(d2, d_lo);
+        d_hi = _mm256_sad_epu8(color_hi, color3);
+        d_lo = _mm256_sad_epu8(color_lo, color3);
+        d_lo = _mm256_packs_epi32(d_hi, d_lo);
+        d3 = _mm256_packs_epi32(d3, d_lo);
+
+        // compare the distances
+        const __m256i b0 = _mm256_cmpgt_epi16(d0, d3);
+        const __m256i b1 = _mm256_cmpgt_epi16(d1, d2);
+        const __m256i b2 = _mm256_cmpgt_epi16(d0, d2);
+        const __m256i b3 = _mm256_cmpgt_epi16(d1, d3);
+        const __m256i b4 = _mm256_cmpgt_epi16(d2, d3);
+
+        // compute color index
+        const __m256i x0 = _mm256_and_si256(b2, b1);
+        const __m256i x1 = _mm256_and_si256(b3, b0);
+        const __m256i x2 = _mm256_and_si256(b4, b0);
+        __m256i index_bit0 = _mm256_or_si256(x0, x1);
+        index_bit0 = _mm256_and_si256(index_bit0, Twos_i16);
+        const __m256i index_bit1 = _mm256_and_si256(x2, Ones_i16);
+        const __m256i index = _mm256_or_si256(index_bit1, index_bit0);
+
+        // pack index into result
+        __m256i index_hi = _mm256_shuffle_epi32(index, _MM_SHUFFLE(1, 0, 3, 2));
+        index_hi = _mm256_unpacklo_epi16(index_hi, Zeroes_256);
+        index_hi = _mm256_slli_epi32(index_hi, 8);
+        const __m256i index_lo = _mm256_unpacklo_epi16(index, Zeroes_256);
+        result = _mm256_slli_epi32(result, 16);
+        result = _mm256_or_si256(result, index_hi);
+        result = _mm256_or_si256(result, index_lo);
+    }
+
+    // pack 16 2-bit color indices into a single 32-bit value
+    __m256i result1 = _mm256_shuffle_epi32(result, _MM_SHUFFLE(0, 3, 2, 1));
+    __m256i result2 = _mm256_shuffle_epi32(result, _MM_SHUFFLE(1, 0, 3, 2));
+    __m256i result3 = _mm256_shuffle_epi32(result, _MM_SHUFFLE(2, 1, 0, 3));
+    result1 = _mm256_slli_epi32(result1, 2);
+    result2 = _mm256_slli_epi32(result2, 4);
+    result3 = _mm256_slli_epi32(result3, 6);
+    result = _mm256_or_si256(result, result1);
+    result = _mm256_or_si256(result, result2);
+    result = _mm256_or_si256(result, result3);
+
+    out_indices[0] = uint32_t(_mm256_extract_epi32(result, 0));
+    out_indices[1] = uint32_t(_mm256_extract_epi32(result, 4));
+}
+
+// Returns 3-bit indices of each block packed into 24 bits of each 64-bit part, min/max are 16-bit values broadcasted
+// over each 128-bit lane
+__m256i PackAlphaIndices_AVX2(const __m256i alpha, const __m256i min, const __m256i max) {
+    // multiplier used to emulate division by 7
+    const __m256i DivBy7_i16 = _mm256_set1_epi16((1 << 16) / 7 + 1);
+    // multiplier used to emulate division by 14
+    const __m256i DivBy14_i16 = _mm256_set1_epi16((1 << 16) / 14 + 1);
+    const __m256i ScaleBy_66554400_i16 = _mm256_setr_epi16(6, 6, 5, 5, 4, 4, 0, 0, 6, 6, 5, 5, 4, 4, 0, 0);
+    const __m256i ScaleBy_11223300_i16 = _mm256_setr_epi16(1, 1, 2, 2, 3, 3, 0, 0, 1, 1, 2, 2, 3, 3, 0, 0);
+
+    const __m256i Ones_i8 = _mm256_set1_epi8(1);
+    const __m256i Twos_i8 = _mm256_set1_epi8(2);
+    const __m256i Sevens_i8 = _mm256_set1_epi8(7);
+
+    // compute midpoint offset between any two interpolated alpha values
+    __m256i mid = _mm256_sub_epi16(max, min);
+    mid = _mm256_mulhi_epi16(mid, DivBy14_i16);
+
+    // compute first midpoint
+    __m256i ab1 = min;
+    ab1 = _mm256_add_epi16(ab1, mid);
+    ab1 = _mm256_packus_epi16(ab1, ab1);
+
+    // compute the next three midpoints
+    const __m256i max456 = _mm256_mullo_epi16(max, ScaleBy_66554400_i16);
+    const __m256i min123 = _mm256_mullo_epi16(min, ScaleBy_11223300_i16);
+    __m256i ab234 = _mm256_add_epi16(max456, min123);
+    ab234 = _mm256_mulhi_epi16(ab234, DivBy7_i16);
+    ab234 = _mm256_add_epi16(ab234, mid);
+    __m256i ab2 = _mm256_shuffle_epi32(ab234, _MM_SHUFFLE(0, 0, 0, 0));
+    ab2 = _mm256_packus_epi16(ab2, ab2);
+    __m256i ab3 = _mm256_shuffle_epi32(ab234, _MM_SHUFFLE(1, 1, 1, 1));
+    ab3 = _mm256_packus_epi16(ab3, ab3);
+    __m256i ab4 = _mm256_shuffle_epi32(ab234, _MM_SHUFFLE(2, 2, 2, 2));
+    ab4 = _mm256_packus_epi16(ab4, ab4);
+
+    // compute the last three midpoints
+    const __m256i max123 = _mm256_mullo_epi16(max, ScaleBy_11223300_i16);
+    const __m256i min456 = _mm256_mullo_epi16(min, ScaleBy_66554400_i16);
+    __m256i ab567 = _mm256_add_epi16(max123, min456);
+    ab567 = _mm256_mulhi_epi16(ab567, DivBy7_i16);
+    ab567 = _mm256_add_epi16(ab567, mid);
+    __m256i ab5 = _mm256_shuffle_epi32(ab567, _MM_SHUFFLE(2, 2, 2, 2));
+    ab5 = _mm256_packus_epi16(ab5, ab5);
+    __m256i ab6 = _mm256_shuffle_epi32(ab567, _MM_SHUFFLE(1, 1, 1, 1));
+    ab6 = _mm256_packus_epi16(ab6, ab6);
+    __m256i ab7 = _mm256_shuffle_epi32(ab567, _MM_SHUFFLE(0, 0, 0, 0));
+    ab7 = _mm256_packus_epi16(ab7, ab7);
+
+    // compare the alpha values to the midpoints
+    __m256i b1 = _mm256_min_epu8(ab1, alpha);
+    b1 = _mm256_cmpeq_epi8(b1, alpha);
+    b1 = _mm256_and_si256(b1, Ones_i8);
+    __m256i b2 = _mm256_min_epu8(ab2, alpha);
+    b2 = _mm256_cmpeq_epi8(b2, alpha);
+    b2 = _mm256_and_si256(b2, Ones_i8);
+    __m256i b3 = _mm256_min_epu8(ab3, alpha);
+    b3 = _mm256_cmpeq_epi8(b3, alpha);
+    b3 = _mm256_and_si256(b3, Ones_i8);
+    __m256i b4 = _mm256_min_epu8(ab4, alpha);
+    b4 = _mm256_cmpeq_epi8(b4, alpha);
+    b4 = _mm256_and_si256(b4, Ones_i8);
+    __m256i b5 = _mm256_min_epu8(ab5, alpha);
+    b5 = _mm256_cmpeq_epi8(b5, alpha);
+    b5 = _mm256_and_si256(b5, Ones_i8);
+    __m256i b6 = _mm256_min_epu8(ab6, alpha);
+    b6 = _mm256_cmpeq_epi8(b6, alpha);
+    b6 = _mm256_and_si256(b6, Ones_i8);
+    __m256i b7 = _mm256_min_epu8(ab7, alpha);
+    b7 = _mm256_cmpeq_epi8(b7, alpha);
+    b7 = _mm256_and_si256(b7, Ones_i8);
+
+    // compute alpha indices
+    __m256i index = _mm256_adds_epu8(b1, b2);
+    index = _mm256_adds_epu8(index, b3);
+    index = _mm256_adds_epu8(index, b4);
+    index = _mm256_adds_epu8(index, b5);
+    index = _mm256_adds_epu8(index, b6);
+    index = _mm256_adds_epu8(index, b7);
+
+    // convert natural index ordering to DXT index ordering
+    index = _mm256_adds_epu8(index, Ones_i8);
+    index = _mm256_and_si256(index, Sevens_i8);
+    __m256i swapMinMax = _mm256_cmpgt_epi8(Twos_i8, index);
+    swapMinMax = _mm256_and_si256(swapMinMax, Ones_i8);
+    index = _mm256_xor_si256(index, swapMinMax);
+
+    // pack the 16 3-bit indices into 6 bytes
+    __m256i index0 = _mm256_and_si256(index, _mm256_set1_epi64x(7 << 0));
+    __m256i index1 = _mm256_srli_epi64(index, 8 - 3);
+    index1 = _mm256_and_si256(index1, _mm256_set1_epi64x(7 << 3));
+    __m256i index2 = _mm256_srli_epi64(index, 16 - 6);
+    index2 = _mm256_and_si256(index2, _mm256_set1_epi64x(7 << 6));
+    __m256i index3 = _mm256_srli_epi64(index, 24 - 9);
+    index3 = _mm256_and_si256(index3, _mm256_set1_epi64x(7 << 9));
+    __m256i index4 = _mm256_srli_epi64(index, 32 - 12);
+    index4 = _mm256_and_si256(index4, _mm256_set1_epi64x(7 << 12));
+    __m256i index5 = _mm256_srli_epi64(index, 40 - 15);
+    index5 = _mm256_and_si256(index5, _mm256_set1_epi64x(7 << 15));
+    __m256i index6 = _mm256_srli_epi64(index, 48 - 18);
+    index6 = _mm256_and_si256(index6, _mm256_set1_epi64x(7 << 18));
+    __m256i index7 = _mm256_srli_epi64(index, 56 - 21);
+    index7 = _mm256_and_si256(index7, _mm256_set1_epi64x(7 << 21));
+    index = _mm256_or_si256(index0, index1);
+    index = _mm256_or_si256(index, index2);
+    index = _mm256_or_si256(index, index3);
+    index = _mm256_or_si256(index, index4);
+    index = _mm256_or_si256(index, index5);
+    index = _mm256_or_si256(index, index6);
+    index = _mm256_or_si256(index, index7);
+
+    return index;
+}
+
+void GetAlphaIndicesInternal_AVX2(const __m256i alpha, const uint8_t min_alpha[2], const uint8_t max_alpha[2],
+                                  uint8_t out_indices[12]) {
+    const __m256i max = _mm256_combine_si128(_mm_set1_epi16(max_alpha[0]), _mm_set1_epi16(max_alpha[1]));
+    const __m256i min = _mm256_combine_si128(_mm_set1_epi16(min_alpha[0]), _mm_set1_epi16(min_alpha[1]));
+
+    const __m256i index = PackAlphaIndices_AVX2(alpha, min, max);
+
+    // each 64-bit part holds 24 bits (3 bytes) of indices
+    const uint32_t packed[4] = {uint32_t(_mm256_extract_epi32(index, 0)), uint32_t(_mm256_extract_epi32(index, 2)),
+                                uint32_t(_mm256_extract_epi32(index, 4)), uint32_t(_mm256_extract_epi32(index, 6))};
+    for (int i = 0; i < 4; ++i) {
+        memcpy(&out_indices[3 * i], &packed[i], 3);
+    }
+}
+
+void GetAlphaIndices_AVX2(const uint8_t blocks[128], const uint8_t min_alpha[2], const uint8_t max_alpha[2],
+                          uint8_t out_indices[12]) {
+    __m256i line0 = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks));
+    __m256i line1 = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks + 32));
+    __m256i line2 = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks + 64));
+    __m256i line3 = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks + 96));
+
+    line0 = _mm256_srli_epi32(line0, 24);
+    line1 = _mm256_srli_epi32(line1, 24);
+    line2 = _mm256_srli_epi32(line2, 24);
+    line3 = _mm256_srli_epi32(line3, 24);
+
+    const __m256i line01 = _mm256_packus_epi16(line0, line1);
+    const __m256i line23 = _mm256_packus_epi16(line2, line3);
+
+    // pack all 16 alpha values of each block
+    const __m256i alpha = _mm256_packus_epi16(line01, line23);
+
+    GetAlphaIndicesInternal_AVX2(alpha, min_alpha, max_alpha, out_indices);
+}
+
+// Encodes two single-channel blocks, min/max values never leave vector registers
+void EmitAlphaOnlyBlocks2_AVX2(const uint8_t blocks[32], uint8_t out_data[16]) {
+    const __m256i alpha = _mm256_load_si256(reinterpret_cast<const __m256i *>(blocks));
+
+    // Find horizontal min/max values
+    __m256i min_col = _mm256_min_epu8(alpha, _mm256_srli_si256(alpha, 8));
+    min_col = _mm256_min_epu8(min_col, _mm256_srli_si256(min_col, 4));
+    min_col = _mm256_min_epu8(min_col, _mm256_srli_si256(min_col, 2));
+    min_col = _mm256_min_epu8(min_col, _mm256_srli_si256(min_col, 1));
+
+    __m256i max_col = _mm256_max_epu8(alpha, _mm256_srli_si256(alpha, 8));
+    max_col = _mm256_max_epu8(max_col, _mm256_srli_si256(max_col, 4));
+    max_col = _mm256_max_epu8(max_col, _mm256_srli_si256(max_col, 2));
+    max_col = _mm256_max_epu8(max_col, _mm256_srli_si256(max_col, 1));
+
+    // broadcast first byte of each lane as 16-bit value
+    const __m256i BroadcastFirstByte = _mm256_setr_epi8(0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, //
+                                                        0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1);
+    const __m256i min = _mm256_shuffle_epi8(min_col, BroadcastFirstByte);
+    const __m256i max = _mm256_shuffle_epi8(max_col, BroadcastFirstByte);
+
+    // each 64-bit part holds 24 bits (3 bytes) of indices, merge them into 48 bits
+    __m256i index = PackAlphaIndices_AVX2(alpha, min, max);
+    index = _mm256_or_si256(index, _mm256_slli_epi64(_mm256_srli_si256(index, 8), 24));
+
+    // block layout is max alpha, min alpha, indices
+    __m256i block = _mm256_and_si256(_mm256_unpacklo_epi8(max_col, min_col), _mm256_set1_epi64x(0xffff));
+    block = _mm256_or_si256(block, _mm256_slli_epi64(index, 16));
+    block = _mm256_permute4x64_epi64(block, _MM_SHUFFLE(3, 1, 2, 0));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out_data), _mm256_castsi256_si128(block));
+}
+} // namespace Ren
+
+#undef _ABS
+
+#endif
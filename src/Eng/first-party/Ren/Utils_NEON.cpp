@@ -2,6 +2,7 @@
 #include "Utils.h"
 
 #include <cassert>
+#include <cstring>
 
 #include <arm_neon.h>
 
@@ -830,8 +831,11 @@ void EmitAlphaIndicesInternal_NEON(uint8x16_t alpha, const uint8_t min_alpha, co
     index = vorrq_s32(index, index6);
     index = vorrq_s32(index, index7);
 
-    vst1q_lane_s32(reinterpret_cast<int32_t *>(out_data), index, 0);
-    vst1q_lane_s32(reinterpret_cast<int32_t *>(out_data + 3), index, 2);
+    // write exactly 6 bytes (blocks can be compressed concurrently into adjacent memory)
+    const int32_t index_lo = vgetq_lane_s32(index, 0);
+    const int32_t index_hi = vgetq_lane_s32(index, 2);
+    memcpy(out_data, &index_lo, 3);
+    memcpy(out_data + 3, &index_hi, 3);
 
     out_data += 6;
 }
@@ -740,9 +740,11 @@ void EmitAlphaIndicesInternal_SSE2(__m128i alpha, const uint8_t min_alpha, const
     index = _mm_or_si128(index, index6);
     index = _mm_or_si128(index, index7);
 
-    _mm_storeu_si32(out_data, index);
-    index = _mm_shuffle_epi32(index, _MM_SHUFFLE(1, 0, 3, 2));
-    _mm_storeu_si32(out_data + 3, index);
+    // write exactly 6 bytes (blocks can be compressed concurrently into adjacent memory)
+    const uint32_t index_lo = _mm_cvtsi128_si32(index);
+    const uint32_t index_hi = _mm_cvtsi128_si32(_mm_shuffle_epi32(index, _MM_SHUFFLE(1, 0, 3, 2)));
+    memcpy(out_data, &index_lo, 3);
+    memcpy(out_data + 3, &index_hi, 3);
 
     out_data += 6;
 }
@@ -5,6 +5,7 @@
 
 void test_anim();
 void test_buffer();
+void test_camera();
 void test_freelist_alloc();
 void test_hashmap();
 void test_material();
@@ -25,6 +26,7 @@ int main() {
 
     test_anim();
     test_buffer();
+    test_camera();
     test_freelist_alloc();
     test_hashmap();
     test_material();
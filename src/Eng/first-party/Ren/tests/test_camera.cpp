@@ -0,0 +1,74 @@
+#include "test_common.h"
+
+#include "../Camera.h"
+
+namespace {
+float rand_float(uint32_t &state) {
+    state = state * 1664525u + 1013904223u;
+    return float(state >> 8) / 16777216.0f;
+}
+} // namespace
+
+void test_camera() {
+    using namespace Ren;
+
+    printf("Test camera             | ");
+
+    { // packed frustums give the same result as individual ones
+        Frustum frustums[PackedFrustums::MaxFrustums];
+        int frustums_count = 0;
+
+        Camera cam(Vec3f{0.0f, 1.0f, 0.0f}, Vec3f{1.0f, 0.5f, 2.0f}, Vec3f{0.0f, 1.0f, 0.0f});
+        cam.Perspective(eZRange::OneToZero, 60.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        cam.UpdatePlanes();
+        frustums[frustums_count++] = cam.frustum();
+
+        // frustum split in several slices
+        cam.ExtractSubFrustums(1, 1, 4, &frustums[frustums_count]);
+        frustums_count += 4;
+
+        Camera shadow_cam(Vec3f{10.0f, 20.0f, 10.0f}, Vec3f{0.0f, 0.0f, 0.0f}, Vec3f{0.0f, 1.0f, 0.0f});
+        shadow_cam.Orthographic(eZRange::OneToZero, -20.0f, 20.0f, 20.0f, -20.0f, 0.0f, 50.0f);
+        shadow_cam.UpdatePlanes();
+        frustums[frustums_count++] = shadow_cam.frustum();
+
+        // frustum with extra planes
+        frustums[frustums_count] = shadow_cam.frustum();
+        frustums[frustums_count].planes[6] =
+            Plane{Vec3f{0.0f, 0.0f, 0.0f}, Vec3f{0.0f, 0.0f, 1.0f}, Vec3f{1.0f, 0.0f, 0.0f}};
+        frustums[frustums_count++].planes_count = 7;
+
+        PackedFrustums packed;
+        for (int i = 0; i < frustums_count; ++i) {
+            require(packed.Add(frustums[i]) == i);
+        }
+        require(packed.frustums_count == frustums_count);
+
+        uint32_t rand_state = 12345;
+        int visible_count = 0, full_count = 0;
+        for (int i = 0; i < 10000; ++i) {
+            const auto center = Vec3f{100.0f * rand_float(rand_state) - 50.0f, 100.0f * rand_float(rand_state) - 50.0f,
+                                      100.0f * rand_float(rand_state) - 50.0f};
+            const auto extents =
+                Vec3f{5.0f * rand_float(rand_state), 5.0f * rand_float(rand_state), 5.0f * rand_float(rand_state)};
+
+            uint32_t full_mask = 0;
+            const uint32_t visible_mask = packed.CheckVisibility(center - extents, center + extents, full_mask);
+            for (int j = 0; j < frustums_count; ++j) {
+                const eVisResult res = frustums[j].CheckVisibility(center - extents, center + extents);
+                require(((visible_mask >> j) & 1) == (res != eVisResult::Invisible));
+                require(((full_mask >> j) & 1) == (res == eVisResult::FullyVisible));
+
+                visible_count += (res != eVisResult::Invisible);
+                full_count += (res == eVisResult::FullyVisible);
+            }
+            require((visible_mask >> frustums_count) == 0);
+        }
+        require(visible_count > 0 && full_count > 0);
+
+        packed.Clear();
+        require(packed.frustums_count == 0 && packed.planes_count == 0);
+    }
+
+    printf("OK\n");
+}
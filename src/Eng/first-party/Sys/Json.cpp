@@ -8,6 +8,392 @@
 #include <limits>
 #include <stdexcept>
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <emmintrin.h>
+#define JS_USE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define JS_USE_NEON
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Sys {
+namespace JsInternal {
+const int MaxNestingLevel = 512;
+
+inline bool IsSpace(const char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+inline bool IsDigit(const char c) { return c >= '0' && c <= '9'; }
+
+inline int ctz(const uint64_t x) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return int(index);
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+#if defined(JS_USE_SSE2)
+// Returns bitmask of 16 bytes which are equal to one of the characters
+inline uint64_t MatchWhitespace16(const char *p) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    const __m128i is_ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')),
+                                                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))),
+                                       _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')),
+                                                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r'))));
+    return uint64_t(_mm_movemask_epi8(is_ws));
+}
+inline uint64_t MatchQuoteOrEscape16(const char *p) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    const __m128i is_special =
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\"')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')));
+    return uint64_t(_mm_movemask_epi8(is_special));
+}
+const int MaskBitsPerChar = 1;
+const uint64_t FullMask16 = 0xffff;
+#elif defined(JS_USE_NEON)
+// NEON has no movemask, narrowing shift produces 4 bits per byte instead
+inline uint64_t ToMask(const uint8x16_t cmp) {
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4)), 0);
+}
+inline uint64_t MatchWhitespace16(const char *p) {
+    const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    const uint8x16_t is_ws = vorrq_u8(vorrq_u8(vceqq_u8(chunk, vdupq_n_u8(' ')), vceqq_u8(chunk, vdupq_n_u8('\t'))),
+                                      vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('\n')), vceqq_u8(chunk, vdupq_n_u8('\r'))));
+    return ToMask(is_ws);
+}
+inline uint64_t MatchQuoteOrEscape16(const char *p) {
+    const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    return ToMask(vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('\"')), vceqq_u8(chunk, vdupq_n_u8('\\'))));
+}
+const int MaskBitsPerChar = 4;
+const uint64_t FullMask16 = 0xffffffffffffffff;
+#endif
+
+inline const char *SkipWhitespace(const char *p, const char *end) {
+    // most of the time there is no (or single) whitespace character
+    if (p == end || !IsSpace(*p)) {
+        return p;
+    }
+    ++p;
+#if defined(JS_USE_SSE2) || defined(JS_USE_NEON)
+    while (end - p >= 16) {
+        const uint64_t not_ws = ~MatchWhitespace16(p) & FullMask16;
+        if (not_ws) {
+            return p + ctz(not_ws) / MaskBitsPerChar;
+        }
+        p += 16;
+    }
+#endif
+    while (p != end && IsSpace(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+inline const char *FindQuoteOrEscape(const char *p, const char *end) {
+#if defined(JS_USE_SSE2) || defined(JS_USE_NEON)
+    while (end - p >= 16) {
+        const uint64_t mask = MatchQuoteOrEscape16(p);
+        if (mask) {
+            return p + ctz(mask) / MaskBitsPerChar;
+        }
+        p += 16;
+    }
+#endif
+    while (p != end && *p != '\"' && *p != '\\') {
+        ++p;
+    }
+    return p;
+}
+
+// Recursive descent parser working on contiguous memory (strings are not copied until they are put into the tree)
+template <typename Alloc> class BufParser {
+    const char *cur_, *end_;
+    std::string scratch_;
+
+  public:
+    BufParser(const char *beg, const char *end) : cur_(beg), end_(end) {}
+
+    bool ParseElement(JsElementT<Alloc> &out, const Alloc &alloc, const int level) {
+        cur_ = SkipWhitespace(cur_, end_);
+        if (cur_ == end_) {
+            return false;
+        }
+        const char c = *cur_;
+        if (c == '\"') {
+            std::string_view str;
+            if (!ParseString(str)) {
+                return false;
+            }
+            out = JsElementT<Alloc>{str, alloc};
+            return true;
+        } else if (c == '[') {
+            out = JsElementT<Alloc>{JsType::Array, alloc};
+            return ParseArray(out.as_arr(), level + 1);
+        } else if (c == '{') {
+            out = JsElementT<Alloc>{JsType::Object, alloc};
+            return ParseObject(out.as_obj(), level + 1);
+        } else if (IsDigit(c) || c == '-') {
+            double val;
+            if (!ParseNumber(val)) {
+                return false;
+            }
+            out = JsElementT<Alloc>{val};
+            return true;
+        }
+        JsLiteralType lit;
+        if (!ParseLiteral(lit)) {
+            return false;
+        }
+        out = JsElementT<Alloc>{lit};
+        return true;
+    }
+
+    bool ParseArray(JsArrayT<Alloc> &out, const int level) {
+        if (level > MaxNestingLevel) {
+            std::cerr << "JsArray::Read(): Nesting level is too deep" << std::endl;
+            return false;
+        }
+        cur_ = SkipWhitespace(cur_, end_);
+        if (cur_ == end_ || *cur_ != '[') {
+            std::cerr << "JsArray::Read(): Expected '['" << std::endl;
+            return false;
+        }
+        cur_ = SkipWhitespace(cur_ + 1, end_);
+        if (cur_ != end_ && *cur_ == ']') {
+            ++cur_;
+            return true;
+        }
+        while (cur_ != end_) {
+            JsElementT<Alloc> &el = out.elements.emplace_back(JsLiteralType::Null);
+            if (!ParseElement(el, out.elements.get_allocator(), level)) {
+                return false;
+            }
+            cur_ = SkipWhitespace(cur_, end_);
+            if (cur_ == end_) {
+                break;
+            }
+            const char c = *cur_++;
+            if (c == ']') {
+                return true;
+            } else if (c != ',') {
+                std::cerr << "JsArray::Read(): Expected ']' instead of " << c << std::endl;
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool ParseObject(JsObjectT<Alloc> &out, const int level) {
+        if (level > MaxNestingLevel) {
+            std::cerr << "JsObject::Read(): Nesting level is too deep" << std::endl;
+            return false;
+        }
+        cur_ = SkipWhitespace(cur_, end_);
+        if (cur_ == end_ || *cur_ != '{') {
+            std::cerr << "JsObject::Read(): Expected '{'" << std::endl;
+            return false;
+        }
+        cur_ = SkipWhitespace(cur_ + 1, end_);
+        if (cur_ != end_ && *cur_ == '}') {
+            ++cur_;
+            return true;
+        }
+        while (cur_ != end_) {
+            std::string_view key;
+            if (!ParseString(key)) {
+                return false;
+            }
+            cur_ = SkipWhitespace(cur_, end_);
+            if (cur_ == end_ || *cur_ != ':') {
+                return false;
+            }
+            ++cur_;
+
+            const size_t i = out.Insert(key, JsLiteral{JsLiteralType::Null});
+            if (!ParseElement(out.elements[i].second, out.elements.get_allocator(), level)) {
+                return false;
+            }
+
+            cur_ = SkipWhitespace(cur_, end_);
+            if (cur_ == end_) {
+                break;
+            }
+            const char c = *cur_++;
+            if (c == '}') {
+                return true;
+            } else if (c != ',') {
+                return false;
+            }
+            cur_ = SkipWhitespace(cur_, end_);
+        }
+        return false;
+    }
+
+    // Resulting string is either located in parsed buffer or in scratch memory (must be used before next call)
+    bool ParseString(std::string_view &out) {
+        cur_ = SkipWhitespace(cur_, end_);
+        if (cur_ == end_ || *cur_ != '\"') {
+            std::cerr << "JsString::Read(): Expected '\"'" << std::endl;
+            return false;
+        }
+        const char *beg = ++cur_;
+        const char *p = FindQuoteOrEscape(beg, end_);
+        if (p == end_) {
+            return false;
+        }
+        if (*p == '\"') {
+            // fast path (no escape sequences)
+            out = std::string_view(beg, size_t(p - beg));
+            cur_ = p + 1;
+            return true;
+        }
+
+        scratch_.assign(beg, p);
+        while (p != end_) {
+            if (*p == '\"') {
+                out = scratch_;
+                cur_ = p + 1;
+                return true;
+            }
+            // escape sequence
+            if (++p == end_) {
+                break;
+            }
+            if (*p == '\"' || *p == '\\' || *p == '/') {
+                scratch_ += *p;
+            } else {
+                // keep unknown sequences as is (same as stream version)
+                scratch_ += '\\';
+                scratch_ += *p;
+            }
+            beg = ++p;
+            p = FindQuoteOrEscape(beg, end_);
+            scratch_.append(beg, p);
+        }
+        return false;
+    }
+
+    bool ParseNumber(double &out) {
+        static const double Pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                       1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+        const char *beg = cur_, *p = cur_;
+        const bool negative = (p != end_ && *p == '-');
+        if (negative) {
+            ++p;
+        }
+
+        // leading zeros are not allowed
+        if (p != end_ && *p == '0' && (p + 1) != end_ && IsDigit(*(p + 1))) {
+            return false;
+        }
+
+        uint64_t mantissa = 0;
+        int digits = 0, exponent = 0;
+        bool truncated = false;
+        while (p != end_ && IsDigit(*p)) {
+            if (mantissa < 1000000000000000000ull) {
+                mantissa = mantissa * 10 + uint64_t(*p - '0');
+            } else {
+                ++exponent;
+                truncated = true;
+            }
+            ++digits;
+            ++p;
+        }
+        if (!digits) {
+            return false;
+        }
+        if (p != end_ && *p == '.') {
+            ++p;
+            // fraction must contain at least one digit
+            if (p == end_ || !IsDigit(*p)) {
+                return false;
+            }
+            while (p != end_ && IsDigit(*p)) {
+                if (mantissa < 1000000000000000000ull) {
+                    mantissa = mantissa * 10 + uint64_t(*p - '0');
+                    --exponent;
+                } else {
+                    truncated = true;
+                }
+                ++digits;
+                ++p;
+            }
+        }
+        if (p != end_ && (*p == 'e' || *p == 'E')) {
+            ++p;
+            bool exp_negative = false;
+            if (p != end_ && (*p == '-' || *p == '+')) {
+                exp_negative = (*p == '-');
+                ++p;
+            }
+            if (p == end_ || !IsDigit(*p)) {
+                return false;
+            }
+            int exp_val = 0;
+            while (p != end_ && IsDigit(*p)) {
+                exp_val = std::min(exp_val * 10 + (*p - '0'), 100000);
+                ++p;
+            }
+            exponent += exp_negative ? -exp_val : exp_val;
+        }
+        cur_ = p;
+
+        if (!truncated && mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22) {
+            // exact conversion is possible
+            double val = double(mantissa);
+            if (exponent < 0) {
+                val /= Pow10[-exponent];
+            } else {
+                val *= Pow10[exponent];
+            }
+            out = negative ? -val : val;
+            return true;
+        }
+
+        // slow path
+        char buf[128];
+        const size_t len = size_t(p - beg);
+        if (len < sizeof(buf)) {
+            memcpy(buf, beg, len);
+            buf[len] = '\0';
+            out = strtod(buf, nullptr);
+        } else {
+            out = strtod(std::string(beg, p).c_str(), nullptr);
+        }
+        return true;
+    }
+
+    bool ParseLiteral(JsLiteralType &out) {
+        cur_ = SkipWhitespace(cur_, end_);
+        const size_t left = size_t(end_ - cur_);
+        if (left >= 4 && memcmp(cur_, "null", 4) == 0) {
+            out = JsLiteralType::Null;
+            cur_ += 4;
+            return true;
+        } else if (left >= 4 && memcmp(cur_, "true", 4) == 0) {
+            out = JsLiteralType::True;
+            cur_ += 4;
+            return true;
+        } else if (left >= 5 && memcmp(cur_, "false", 5) == 0) {
+            out = JsLiteralType::False;
+            cur_ += 5;
+            return true;
+        }
+        std::cerr << "JsLiteral::Read(): null, true or false expected" << std::endl;
+        return false;
+    }
+};
+} // namespace JsInternal
+} // namespace Sys
+
 bool Sys::JsLiteral::Read(std::istream &in) {
     char c;
     while (in.read(&c, 1) && isspace(c))
@@ -62,29 +448,29 @@ void Sys::JsNumber::Write(std::ostream &out, const JsFlags /*flags*/) const {
 /////////////////////////////////////////////////////////////////
 
 template <typename Alloc> bool Sys::JsStringT<Alloc>::Read(std::istream &in) {
-    char cur, prev = 0;
+    char cur;
     while (in.read(&cur, 1) && isspace(cur))
         ;
     if (cur != '\"') {
         std::cerr << "JsString::Read(): Expected '\"' instead of " << cur << std::endl;
         return false;
     }
+    bool escape = false;
     while (in.read(&cur, 1)) {
-        if (cur == '\"' && prev != '\\')
-            break;
-        if (prev == '\\') {
-            char new_c = 0;
-            if (cur == '\"' || cur == '\\' || cur == '/' || cur == '\t' || cur == '\n' || cur == '\r' || cur == '\f' ||
-                cur == '\b') {
-                new_c = cur;
-            }
-            if (new_c) {
-                val.pop_back();
-                val += new_c;
+        if (escape) {
+            if (cur != '\"' && cur != '\\' && cur != '/') {
+                // keep unknown sequences as is
+                val += '\\';
             }
+            val += cur;
+            escape = false;
+        } else if (cur == '\\') {
+            escape = true;
+        } else if (cur == '\"') {
+            break;
+        } else {
+            val += cur;
         }
-        val += cur;
-        prev = cur;
     }
     return true;
 }
@@ -203,6 +589,11 @@ template <typename Alloc> void Sys::JsArrayT<Alloc>::Write(std::ostream &out, Js
     out << ident_str << ']';
 }
 
+template <typename Alloc> bool Sys::JsArrayT<Alloc>::Read(std::string_view in) {
+    JsInternal::BufParser<Alloc> parser(in.data(), in.data() + in.size());
+    return parser.ParseArray(*this, 1);
+}
+
 template struct Sys::JsArrayT<std::allocator<char>>;
 template struct Sys::JsArrayT<Sys::MultiPoolAllocator<char>>;
 
@@ -348,6 +739,11 @@ template <typename Alloc> void Sys::JsObjectT<Alloc>::Write(std::ostream &out, J
     out << ident_str << '}';
 }
 
+template <typename Alloc> bool Sys::JsObjectT<Alloc>::Read(std::string_view in) {
+    JsInternal::BufParser<Alloc> parser(in.data(), in.data() + in.size());
+    return parser.ParseObject(*this, 1);
+}
+
 template struct Sys::JsObjectT<std::allocator<char>>;
 template struct Sys::JsObjectT<Sys::MultiPoolAllocator<char>>;
 
@@ -654,6 +1050,11 @@ template <typename Alloc> bool Sys::JsElementT<Alloc>::Read(std::istream &in, co
     }
 }
 
+template <typename Alloc> bool Sys::JsElementT<Alloc>::Read(std::string_view in, const Alloc &alloc) {
+    JsInternal::BufParser<Alloc> parser(in.data(), in.data() + in.size());
+    return parser.ParseElement(*this, alloc, 0);
+}
+
 template <typename Alloc> void Sys::JsElementT<Alloc>::Write(std::ostream &out, const JsFlags flags) const {
     if (type_ == JsType::Literal) {
         reinterpret_cast<const JsLiteral &>(data_).Write(out, flags);
@@ -2,6 +2,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -123,6 +124,7 @@ template <typename Alloc> struct JsArrayT {
     void Push(JsElementT<Alloc> &&el);
 
     bool Read(std::istream &in);
+    bool Read(std::string_view in);
     void Write(std::ostream &out, JsFlags flags = {}) const;
 
     Alloc get_allocator() { return elements.get_allocator(); }
@@ -161,6 +163,7 @@ template <typename Alloc> struct JsObjectT {
     size_t Insert(std::string_view s, JsElementT<Alloc> &&el);
 
     bool Read(std::istream &in);
+    bool Read(std::string_view in);
     void Write(std::ostream &out, JsFlags flags = {}) const;
 
     Alloc get_allocator() { return elements.get_allocator(); }
@@ -228,6 +231,8 @@ template <typename Alloc> struct JsElementT {
     [[nodiscard]] bool Equals(const JsElementT &rhs, double eps) const;
 
     bool Read(std::istream &in, const Alloc &alloc = Alloc());
+    // Parses contiguous buffer (much faster than reading from stream)
+    bool Read(std::string_view in, const Alloc &alloc = Alloc());
     void Write(std::ostream &out, JsFlags flags = {}) const;
 };
 
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cassert>
+#include <cstdint>
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <future>
@@ -12,6 +14,7 @@
 #include <stdexcept>
 #include <thread>
 
+#include "InplaceFunction.h"
 #include "SmallVector.h"
 
 #ifdef _WIN32
@@ -41,6 +44,7 @@
 
 namespace Sys {
 enum class eThreadPriority { Low, Normal, High };
+enum class eThreadPoolMode { SharedQueue, WorkStealing };
 
 struct Task {
     std::function<void()> func;
@@ -49,6 +53,8 @@ struct Task {
 
     Task() = default;
     Task(const Task &rhs) : func(rhs.func), dependents(rhs.dependents), dependencies(rhs.dependencies.load()) {}
+    Task(Task &&rhs) noexcept
+        : func(std::move(rhs.func)), dependents(std::move(rhs.dependents)), dependencies(rhs.dependencies.load()) {}
 };
 
 struct TaskList {
@@ -111,10 +117,90 @@ struct TaskList {
     bool HasCycles() const { return tasks_order.size() != tasks.size(); }
 };
 
+// Chase-Lev deque with fixed capacity, only owning thread is allowed to Push/Pop, any thread can Steal
+template <typename T, int Capacity> class WorkStealingDeque {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be power of two!");
+
+    alignas(64) std::atomic<int64_t> top_ = {};
+    alignas(64) std::atomic<int64_t> bottom_ = {};
+    alignas(64) std::atomic<T *> items_[Capacity] = {};
+
+  public:
+    bool Push(T *item) {
+        const int64_t b = bottom_.load(std::memory_order_relaxed);
+        const int64_t t = top_.load(std::memory_order_acquire);
+        if (b - t >= Capacity) {
+            return false;
+        }
+        items_[b & (Capacity - 1)].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    T *Pop() {
+        const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+        if (t > b) {
+            // deque is empty
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T *item = items_[b & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (t == b) {
+            // last item, race against thieves
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    T *Steal() {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+        T *item = items_[t & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            // lost the race
+            return nullptr;
+        }
+        return item;
+    }
+
+    bool Empty() const {
+        return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+    }
+};
+
+// Function object stored inside of preallocated task (must be small enough)
+using InplaceTask = InplaceFunction<void(), 64>;
+
+// Lightweight replacement for std::future used with allocation-free submission
+class TaskCounter {
+    friend class ThreadPool;
+    std::atomic_int count_ = {};
+
+  public:
+    TaskCounter() = default;
+    TaskCounter(const TaskCounter &rhs) = delete;
+    TaskCounter &operator=(const TaskCounter &rhs) = delete;
+
+    // NOTE: seq_cst is required here, decrement and waiters check (ExecuteLight) together with
+    // waiters increment and this check (Wait) would allow lost wakeup with weaker ordering
+    bool done() const { return count_.load(std::memory_order_seq_cst) == 0; }
+};
+
 class ThreadPool {
   public:
     explicit ThreadPool(int threads_count, eThreadPriority priority = eThreadPriority::Normal,
-                        const char *threads_name = nullptr);
+                        const char *threads_name = nullptr, eThreadPoolMode mode = eThreadPoolMode::SharedQueue);
     ~ThreadPool();
 
     template <class F, class... Args>
@@ -125,7 +211,13 @@ class ThreadPool {
 
     template <class UnaryFunction> void ParallelFor(int from, int to, UnaryFunction &&f);
 
+    // Allocation-free submission (task is executed in place if preallocated storage is exhausted)
+    template <class F> void Dispatch(TaskCounter &counter, F &&f);
+    // Wait for counter to reach zero (executes pending tasks meanwhile)
+    void Wait(TaskCounter &counter);
+
     int workers_count() const { return int(workers_.size()); }
+    eThreadPoolMode mode() const { return mode_; }
 
     bool SetPriority(int i, eThreadPriority priority);
     bool SetPriority(const eThreadPriority priority) {
@@ -137,6 +229,7 @@ class ThreadPool {
     }
 
   private:
+    eThreadPoolMode mode_;
     Sys::SmallVector<std::thread, 64> workers_;
     std::deque<SmallVector<Task, 16>> task_lists_;
     std::atomic_int active_tasks_ = {};
@@ -145,11 +238,101 @@ class ThreadPool {
     std::mutex q_mtx_;
     std::condition_variable condition_;
     bool stop_;
+
+    struct QueuedTask {
+        bool is_light = false;
+    };
+
+    // allocation-free tasks
+    struct LightTask : QueuedTask {
+        InplaceTask func;
+        TaskCounter *counter = nullptr;
+        LightTask *next = nullptr;
+        std::atomic<uint32_t> next_free = {};
+
+        LightTask() { is_light = true; }
+    };
+    static const int LightTasksCount = 4096;
+
+    std::unique_ptr<LightTask[]> light_tasks_;
+    std::atomic<uint64_t> light_free_head_ = {}; // (tag << 32) | (index + 1)
+    LightTask *light_head_ = nullptr, *light_tail_ = nullptr; // guarded by q_mtx_
+    std::atomic_int light_count_ = {};
+
+    std::mutex wait_mtx_;
+    std::condition_variable wait_condition_;
+    std::atomic_int waiters_count_ = {};
+
+    LightTask *AllocLightTask();
+    void FreeLightTask(LightTask *t);
+    void SubmitLight(LightTask *t);
+    void PushLight_nolock(LightTask *t);
+    LightTask *PopLight_nolock();
+    LightTask *PopLight();
+    void ExecuteLight(LightTask *t);
+
+    // work-stealing mode
+    struct TaskGroup;
+    struct GroupTask : QueuedTask {
+        Task task;
+        TaskGroup *group = nullptr;
+
+        GroupTask() = default;
+        explicit GroupTask(const Task &_task) : task(_task) {}
+        explicit GroupTask(Task &&_task) : task(std::move(_task)) {}
+    };
+    struct TaskGroup {
+        SmallVector<GroupTask, 16> tasks;
+        std::atomic_int refs = {};
+    };
+    struct alignas(64) WorkerQueue {
+        WorkStealingDeque<QueuedTask, 4096> deque;
+        uint32_t rand_state = 0;
+    };
+    static const int InjectedBatchSize = 32;
+    static const int SpinsBeforeSleep = 64;
+
+    std::unique_ptr<WorkerQueue[]> queues_;
+    int queues_count_ = 0;
+    std::deque<QueuedTask *> injected_; // tasks submitted from outside of the pool (guarded by q_mtx_)
+    std::atomic_int injected_count_ = {}, sleeping_count_ = {}, outstanding_tasks_ = {};
+
+    struct WorkerTLS {
+        const ThreadPool *pool = nullptr;
+        int index = -1;
+    };
+    static WorkerTLS &tl_worker() {
+        static thread_local WorkerTLS tls;
+        return tls;
+    }
+    // index of worker of this pool we are running on (or -1)
+    int CurrentWorker() const { return tl_worker().pool == this ? tl_worker().index : -1; }
+
+    void WorkStealingLoop(int worker);
+    QueuedTask *FindWork(int worker);
+    void Execute(int worker, QueuedTask *t);
+    void Submit(int worker, QueuedTask *t);
+    void SubmitGroup(TaskGroup *group);
+    void WakeWorkers(int count);
+    template <class TL> std::future<void> EnqueueWS(TL &&task_list);
 };
 
 // the constructor just launches some amount of workers_
-inline ThreadPool::ThreadPool(const int threads_count, const eThreadPriority priority, const char *threads_name)
-    : stop_(false) {
+inline ThreadPool::ThreadPool(const int threads_count, const eThreadPriority priority, const char *threads_name,
+                              const eThreadPoolMode mode)
+    : mode_(mode), stop_(false) {
+    light_tasks_ = std::make_unique<LightTask[]>(LightTasksCount);
+    for (int i = 0; i < LightTasksCount; ++i) {
+        light_tasks_[i].next_free = uint32_t(i + 1 < LightTasksCount ? i + 2 : 0);
+    }
+    light_free_head_ = 1;
+    if (mode_ == eThreadPoolMode::WorkStealing) {
+        queues_ = std::make_unique<WorkerQueue[]>(threads_count);
+        queues_count_ = threads_count;
+        for (int i = 0; i < threads_count; ++i) {
+            queues_[i].rand_state = 0x9e3779b9u * uint32_t(i + 1);
+        }
+    }
     for (int i = 0; i < threads_count; ++i) {
         workers_.emplace_back([this, i, threads_name] {
             char name_buf[64] = "Worker thread";
@@ -159,20 +342,29 @@ inline ThreadPool::ThreadPool(const int threads_count, const eThreadPriority pri
             //__itt_thread_set_name(name_buf);
             // OPTICK_THREAD(name_buf);
 
+            if (mode_ == eThreadPoolMode::WorkStealing) {
+                tl_worker() = {this, i};
+                WorkStealingLoop(i);
+                return;
+            }
+
             for (;;) {
                 std::function<void()> task;
                 Task *cur_tasks = nullptr;
                 SmallVector<short, 8> dependents;
+                LightTask *light_task = nullptr;
 
                 {
                     std::unique_lock<std::mutex> lock(q_mtx_);
                     condition_.wait(lock, [this] { return stop_ || active_tasks_ != 0; });
-                    if (stop_ && task_lists_.empty()) {
+                    if (stop_ && task_lists_.empty() && !light_head_) {
                         return;
                     }
 
+                    light_task = PopLight_nolock();
+
                     // Find task we can execute
-                    for (int l = 0; l < int(task_lists_.size()) && !task; ++l) {
+                    for (int l = 0; l < int(task_lists_.size()) && !task && !light_task; ++l) {
                         auto &list = task_lists_[l];
                         for (int i = int(list.size()) - 1; i >= 0; --i) {
                             if (list[i].func && list[i].dependencies == 0) {
@@ -193,10 +385,12 @@ inline ThreadPool::ThreadPool(const int threads_count, const eThreadPriority pri
                         task_lists_.pop_front();
                     }
 
-                    assert(!task_lists_.empty() || active_tasks_ == 0);
+                    assert(!task_lists_.empty() || light_task || active_tasks_ == 0);
                 }
 
-                if (task) {
+                if (light_task) {
+                    ExecuteLight(light_task);
+                } else if (task) {
                     task();
 
                     for (const int i : dependents) {
@@ -249,6 +443,13 @@ std::future<typename std::invoke_result_t<F, Args...>> ThreadPool::Enqueue(F &&f
         std::make_shared<std::packaged_task<return_type()>>(std::bind(std::forward<F>(f), std::forward<Args>(args)...));
 
     std::future<return_type> res = task->get_future();
+    if (mode_ == eThreadPoolMode::WorkStealing) {
+        auto *group = new TaskGroup;
+        group->tasks.resize(1);
+        group->tasks[0].task.func = [task]() { (*task)(); };
+        SubmitGroup(group);
+        return res;
+    }
     {
         std::unique_lock<std::mutex> lock(q_mtx_);
 
@@ -269,6 +470,10 @@ std::future<typename std::invoke_result_t<F, Args...>> ThreadPool::Enqueue(F &&f
 }
 
 inline std::future<void> ThreadPool::Enqueue(const TaskList &task_list) {
+    if (mode_ == eThreadPoolMode::WorkStealing) {
+        return EnqueueWS(task_list);
+    }
+
     auto final_task = std::make_shared<std::packaged_task<void()>>([]() {});
 
     std::future<void> res = final_task->get_future();
@@ -303,6 +508,10 @@ inline std::future<void> ThreadPool::Enqueue(const TaskList &task_list) {
 }
 
 inline std::future<void> ThreadPool::Enqueue(TaskList &&task_list) {
+    if (mode_ == eThreadPoolMode::WorkStealing) {
+        return EnqueueWS(std::move(task_list));
+    }
+
     auto final_task = std::make_shared<std::packaged_task<void()>>([]() {});
 
     std::future<void> res = final_task->get_future();
@@ -337,18 +546,370 @@ inline std::future<void> ThreadPool::Enqueue(TaskList &&task_list) {
 }
 
 template <class UnaryFunction> inline void ThreadPool::ParallelFor(const int from, const int to, UnaryFunction &&f) {
-    TaskList loop_tasks;
-
+    TaskCounter counter;
     for (int i = from; i < to; ++i) {
-        loop_tasks.AddTask(f, i);
-        loop_tasks.tasks_order.push_back(i - from);
+        Dispatch(counter, [&f, i]() { f(i); });
+    }
+    Wait(counter);
+}
+
+template <class F> void ThreadPool::Dispatch(TaskCounter &counter, F &&f) {
+    LightTask *t = AllocLightTask();
+    if (!t) {
+        // pool is saturated
+        f();
+        return;
+    }
+    t->func = std::forward<F>(f);
+    t->counter = &counter;
+    counter.count_.fetch_add(1, std::memory_order_relaxed);
+    SubmitLight(t);
+}
+
+inline void ThreadPool::Wait(TaskCounter &counter) {
+    const int worker = (mode_ == eThreadPoolMode::WorkStealing) ? CurrentWorker() : -1;
+
+    int spins = 0;
+    while (!counter.done()) {
+        QueuedTask *t = (worker != -1) ? FindWork(worker) : PopLight();
+        if (t) {
+            Execute(worker, t);
+            spins = 0;
+            continue;
+        }
+        if (++spins < SpinsBeforeSleep) {
+            std::this_thread::yield();
+            continue;
+        }
+        spins = 0;
+
+        std::unique_lock<std::mutex> lock(wait_mtx_);
+        ++waiters_count_;
+        wait_condition_.wait(lock, [&counter] { return counter.done(); });
+        --waiters_count_;
+    }
+}
+
+inline ThreadPool::LightTask *ThreadPool::AllocLightTask() {
+    uint64_t head = light_free_head_.load(std::memory_order_acquire);
+    for (;;) {
+        const uint32_t index = uint32_t(head & 0xffffffff);
+        if (!index) {
+            return nullptr;
+        }
+        const uint64_t new_head =
+            (((head >> 32u) + 1) << 32u) | light_tasks_[index - 1].next_free.load(std::memory_order_relaxed);
+        if (light_free_head_.compare_exchange_weak(head, new_head, std::memory_order_acquire,
+                                                   std::memory_order_acquire)) {
+            return &light_tasks_[index - 1];
+        }
+    }
+}
+
+inline void ThreadPool::FreeLightTask(LightTask *t) {
+    const uint32_t index = uint32_t(t - light_tasks_.get()) + 1;
+    uint64_t head = light_free_head_.load(std::memory_order_relaxed);
+    for (;;) {
+        t->next_free.store(uint32_t(head & 0xffffffff), std::memory_order_relaxed);
+        const uint64_t new_head = (((head >> 32u) + 1) << 32u) | index;
+        if (light_free_head_.compare_exchange_weak(head, new_head, std::memory_order_release,
+                                                   std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+inline void ThreadPool::SubmitLight(LightTask *t) {
+    ++outstanding_tasks_;
+    if (mode_ == eThreadPoolMode::WorkStealing) {
+        const int worker = CurrentWorker();
+        if (worker != -1) {
+            Submit(worker, t);
+            return;
+        }
+    }
+    {
+        std::unique_lock<std::mutex> lock(q_mtx_);
+
+        // don't allow enqueueing after stopping the pool
+        if (stop_) {
+            --outstanding_tasks_;
+            --t->counter->count_;
+            t->func = nullptr;
+            FreeLightTask(t);
+            throw std::runtime_error("Enqueue on stopped ThreadPool");
+        }
+
+        PushLight_nolock(t);
+        ++active_tasks_;
+    }
+    if (mode_ == eThreadPoolMode::WorkStealing) {
+        WakeWorkers(1);
+    } else {
+        condition_.notify_one();
+    }
+}
+
+inline void ThreadPool::PushLight_nolock(LightTask *t) {
+    t->next = nullptr;
+    if (light_tail_) {
+        light_tail_->next = t;
+    } else {
+        light_head_ = t;
+    }
+    light_tail_ = t;
+    ++light_count_;
+}
+
+inline ThreadPool::LightTask *ThreadPool::PopLight_nolock() {
+    LightTask *ret = light_head_;
+    if (ret) {
+        light_head_ = ret->next;
+        if (!light_head_) {
+            light_tail_ = nullptr;
+        }
+        --light_count_;
+        --active_tasks_;
+    }
+    return ret;
+}
+
+inline ThreadPool::LightTask *ThreadPool::PopLight() {
+    if (light_count_.load(std::memory_order_relaxed) == 0) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(q_mtx_);
+    return PopLight_nolock();
+}
+
+inline void ThreadPool::ExecuteLight(LightTask *t) {
+    t->func();
+    t->func = nullptr;
+
+    TaskCounter *counter = t->counter;
+    FreeLightTask(t);
+    // counter must not be accessed after decrement (it may be already destroyed by waiting thread)
+    if (counter->count_.fetch_sub(1, std::memory_order_seq_cst) == 1 && waiters_count_.load() != 0) {
+        { // waiting thread could be between predicate check and actual sleep
+            std::lock_guard<std::mutex> lock(wait_mtx_);
+        }
+        wait_condition_.notify_all();
+    }
+
+    if (outstanding_tasks_.fetch_sub(1) == 1 && mode_ == eThreadPoolMode::WorkStealing) {
+        std::lock_guard<std::mutex> lock(q_mtx_);
+        if (stop_) {
+            condition_.notify_all();
+        }
+    }
+}
+
+template <class TL> inline std::future<void> ThreadPool::EnqueueWS(TL &&task_list) {
+    auto final_task = std::make_shared<std::packaged_task<void()>>([]() {});
+    std::future<void> res = final_task->get_future();
+
+    const int tasks_count = int(task_list.tasks_order.size());
+
+    // Same layout as in shared queue mode: final task goes first, then tasks in reversed order
+    auto *group = new TaskGroup;
+    group->tasks.reserve(tasks_count + 1);
+    group->tasks.emplace_back().task.func = [final_task]() { (*final_task)(); };
+    group->tasks[0].task.dependencies = tasks_count;
+
+    for (int i = tasks_count - 1; i >= 0; --i) {
+        Task *dst;
+        if constexpr (std::is_rvalue_reference_v<TL &&>) {
+            dst = &group->tasks.emplace_back(std::move(task_list.tasks[task_list.tasks_order[i]])).task;
+        } else {
+            dst = &group->tasks.emplace_back(task_list.tasks[task_list.tasks_order[i]]).task;
+        }
+        for (short &k : dst->dependents) {
+            k = short(tasks_count - task_list.tasks_pos[k]);
+        }
+        dst->dependents.push_back(0);
+    }
+
+    SubmitGroup(group);
+    return res;
+}
+
+inline void ThreadPool::SubmitGroup(TaskGroup *group) {
+    const int worker = CurrentWorker();
+
+    SmallVector<QueuedTask *, 16> ready;
+    for (GroupTask &t : group->tasks) {
+        t.group = group;
+        if (t.task.dependencies == 0) {
+            ready.push_back(&t);
+        }
+    }
+    group->refs = int(group->tasks.size());
+    outstanding_tasks_ += int(group->tasks.size());
+
+    if (worker != -1) {
+        // first task to execute is the last one
+        for (QueuedTask *t : ready) {
+            Submit(worker, t);
+        }
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(q_mtx_);
+
+        // don't allow enqueueing after stopping the pool
+        if (stop_) {
+            outstanding_tasks_ -= int(group->tasks.size());
+            delete group;
+            throw std::runtime_error("Enqueue on stopped ThreadPool");
+        }
+
+        // tasks are taken from the back of the queue
+        for (int i = int(ready.size()) - 1; i >= 0; --i) {
+            injected_.push_front(ready[i]);
+        }
+        injected_count_ += int(ready.size());
+        active_tasks_ += int(ready.size());
+    }
+    WakeWorkers(int(ready.size()));
+}
+
+inline void ThreadPool::Submit(const int worker, QueuedTask *t) {
+    ++active_tasks_;
+    if (worker == -1 || !queues_[worker].deque.Push(t)) {
+        // fallback to global queue
+        std::lock_guard<std::mutex> lock(q_mtx_);
+        if (t->is_light) {
+            PushLight_nolock(static_cast<LightTask *>(t));
+        } else {
+            injected_.push_front(t);
+            ++injected_count_;
+        }
+    }
+    WakeWorkers(1);
+}
+
+inline void ThreadPool::WakeWorkers(const int count) {
+    if (sleeping_count_.load() == 0) {
+        return;
+    }
+    { // sleeping thread could be between predicate check and actual sleep
+        std::lock_guard<std::mutex> lock(q_mtx_);
+    }
+    if (count == 1) {
+        condition_.notify_one();
+    } else {
+        condition_.notify_all();
+    }
+}
+
+inline ThreadPool::QueuedTask *ThreadPool::FindWork(const int worker) {
+    WorkerQueue &own = queues_[worker];
+    if (QueuedTask *t = own.deque.Pop()) {
+        --active_tasks_;
+        return t;
+    }
+
+    if (QueuedTask *t = PopLight()) {
+        return t;
+    }
+
+    if (injected_count_.load(std::memory_order_relaxed) != 0) {
+        std::lock_guard<std::mutex> lock(q_mtx_);
+        if (!injected_.empty()) {
+            QueuedTask *ret = injected_.back();
+            injected_.pop_back();
+            // grab more tasks to make them available for stealing
+            int moved = 0;
+            while (!injected_.empty() && moved < InjectedBatchSize && own.deque.Push(injected_.back())) {
+                injected_.pop_back();
+                ++moved;
+            }
+            injected_count_ -= (moved + 1);
+            --active_tasks_;
+            return ret;
+        }
+    }
+
+    const int workers_count = queues_count_;
+    if (workers_count > 1) {
+        // xorshift
+        own.rand_state ^= own.rand_state << 13;
+        own.rand_state ^= own.rand_state >> 17;
+        own.rand_state ^= own.rand_state << 5;
+
+        const int start = int(own.rand_state % uint32_t(workers_count));
+        for (int i = 0; i < workers_count; ++i) {
+            const int victim = (start + i) % workers_count;
+            if (victim == worker) {
+                continue;
+            }
+            if (QueuedTask *t = queues_[victim].deque.Steal()) {
+                --active_tasks_;
+                return t;
+            }
+        }
     }
 
-    if (loop_tasks.tasks.empty()) {
+    return nullptr;
+}
+
+inline void ThreadPool::Execute(const int worker, QueuedTask *_t) {
+    if (_t->is_light) {
+        ExecuteLight(static_cast<LightTask *>(_t));
         return;
     }
 
-    Enqueue(loop_tasks).wait();
+    auto *t = static_cast<GroupTask *>(_t);
+    TaskGroup *group = t->group;
+
+    t->task.func();
+    t->task.func = nullptr;
+
+    for (const short i : t->task.dependents) {
+        GroupTask &dependent = group->tasks[i];
+        if (dependent.task.dependencies.fetch_sub(1) == 1) {
+            // released task goes into our own queue (most likely it uses data that is hot in cache)
+            Submit(worker, &dependent);
+        }
+    }
+
+    if (group->refs.fetch_sub(1) == 1) {
+        delete group;
+    }
+
+    if (outstanding_tasks_.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(q_mtx_);
+        if (stop_) {
+            condition_.notify_all();
+        }
+    }
+}
+
+inline void ThreadPool::WorkStealingLoop(const int worker) {
+    int spins = 0;
+    for (;;) {
+        if (QueuedTask *t = FindWork(worker)) {
+            Execute(worker, t);
+            spins = 0;
+            continue;
+        }
+
+        if (active_tasks_ != 0 || ++spins < SpinsBeforeSleep) {
+            // some task is about to become available (or other thread is being slow)
+            std::this_thread::yield();
+            continue;
+        }
+        spins = 0;
+
+        std::unique_lock<std::mutex> lock(q_mtx_);
+        ++sleeping_count_;
+        condition_.wait(lock, [this] { return active_tasks_ != 0 || (stop_ && outstanding_tasks_ == 0); });
+        --sleeping_count_;
+        if (stop_ && outstanding_tasks_ == 0) {
+            return;
+        }
+    }
 }
 
 // the destructor joins all threads
@@ -362,6 +923,7 @@ inline ThreadPool::~ThreadPool() {
         worker.join();
     }
     assert(active_tasks_ == 0);
+    assert(outstanding_tasks_ == 0);
 }
 
 } // namespace Sys
@@ -1,5 +1,7 @@
 #include "test_common.h"
 
+#include <chrono>
+#include <iostream>
 #include <sstream>
 
 #include "../Json.h"
@@ -74,6 +76,44 @@ static const char json_example3[] = "{\n"
 
 static const char json_example4[] =
     "[\"Sunday\", \"Monday\", \"Tuesday\", \"Wednesday\", \"Thursday\", \"Friday\", \"Saturday\"]";
+
+static const char json_example5[] = "{\"numbers\": [0, -1, 1.5, -0.25, 1e3, 2.5E-3, 123456789012345678901234, 0.1, "
+                                     "3.14159265358979323846, 1e-300],\n"
+                                     "\"literals\": [true, false, null],\n"
+                                     "\"strings\": [\"\", \"with \\\"quotes\\\"\", \"a\\\\b\", \"a\\/b\", "
+                                     "\"long string which does not fit in single simd register\"],\n"
+                                     "\"empty_obj\": {}, \"empty_arr\": [ ]}";
+
+// Something that resembles scene file
+std::string GenerateLargeJson(const int objects_count) {
+    using namespace Sys;
+
+    JsArray js_objects;
+    for (int i = 0; i < objects_count; ++i) {
+        JsObject js_obj;
+        js_obj["name"] = JsString{"object_" + std::to_string(i)};
+        JsObject js_tr;
+        JsArray js_pos;
+        js_pos.Push(JsNumber{double(i) * 0.25});
+        js_pos.Push(JsNumber{-double(i) / 3.0});
+        js_pos.Push(JsNumber{double(i % 17)});
+        js_tr["pos"] = std::move(js_pos);
+        js_tr["scale"] = JsNumber{1.0};
+        js_obj["transform"] = std::move(js_tr);
+        JsObject js_dr;
+        js_dr["mesh_file"] = JsString{"models/object_" + std::to_string(i % 100) + ".mesh"};
+        js_dr["visible"] = JsLiteral{(i % 2) ? JsLiteralType::True : JsLiteralType::False};
+        js_obj["drawable"] = std::move(js_dr);
+        js_objects.Push(std::move(js_obj));
+    }
+    JsObject js_scene;
+    js_scene["objects"] = std::move(js_objects);
+    js_scene["name"] = JsString{"benchmark_scene"};
+
+    std::stringstream ss;
+    js_scene.Write(ss);
+    return ss.str();
+}
 } // namespace
 
 void test_json() {
@@ -106,6 +146,18 @@ void test_json() {
             require(s2 == JsString{"asd111"});
         }
 
+        { // JsString with escape sequences
+            // escaped backslash must not affect following quote, escaped quote must be kept once
+            std::stringstream ss("\"a\\\\\" \"with \\\"quotes\\\"\" \"a\\/b\"");
+            JsString s1, s2, s3;
+            require(s1.Read(ss));
+            require(s1.val == "a\\");
+            require(s2.Read(ss));
+            require(s2.val == "with \"quotes\"");
+            require(s3.Read(ss));
+            require(s3.val == "a/b");
+        }
+
         { // JsString pooled
             Sys::MultiPoolAllocator<char> my_alloc(32, 512);
 
@@ -735,5 +787,95 @@ void test_json() {
         }
     }
 
+    { // Buffer parsing gives the same result as stream parsing
+        for (const char *example : {json_example, json_example2, json_example3, json_example4, json_example5}) {
+            JsElement el1(JsLiteralType::Null), el2(JsLiteralType::Null);
+            std::stringstream ss(example);
+            require(el1.Read(ss));
+            require(el2.Read(std::string_view{example}));
+            require(el1 == el2);
+
+            Sys::MultiPoolAllocator<char> my_alloc(32, 512);
+            JsElementP el3(JsLiteralType::Null);
+            require(el3.Read(std::string_view{example}, my_alloc));
+            std::stringstream ss1, ss3;
+            el1.Write(ss1);
+            el3.Write(ss3);
+            require(ss1.str() == ss3.str());
+        }
+
+        JsElement el(JsLiteralType::Null);
+        require(el.Read(std::string_view{json_example5}));
+        const JsObject &root = el.as_obj();
+        const JsArray &numbers = root.at("numbers").as_arr();
+        require(numbers.Size() == 10);
+        require(numbers[0].as_num().val == 0.0);
+        require(numbers[1].as_num().val == -1.0);
+        require(numbers[2].as_num().val == 1.5);
+        require(numbers[3].as_num().val == -0.25);
+        require(numbers[4].as_num().val == 1000.0);
+        require(numbers[5].as_num().val == 2.5e-3);
+        require(numbers[6].as_num().val == 123456789012345678901234.0);
+        require(numbers[7].as_num().val == 0.1);
+        require(numbers[8].as_num().val == 3.14159265358979323846);
+        require(numbers[9].as_num().val == 1e-300);
+        const JsArray &literals = root.at("literals").as_arr();
+        require(literals[0].as_lit().val == JsLiteralType::True);
+        require(literals[1].as_lit().val == JsLiteralType::False);
+        require(literals[2].as_lit().val == JsLiteralType::Null);
+        const JsArray &strings = root.at("strings").as_arr();
+        require(strings[0].as_str().val.empty());
+        require(strings[1].as_str().val == "with \"quotes\"");
+        require(strings[2].as_str().val == "a\\b");
+        require(strings[3].as_str().val == "a/b");
+        require(strings[4].as_str().val == "long string which does not fit in single simd register");
+        require(root.at("empty_obj").as_obj().Size() == 0);
+        require(root.at("empty_arr").as_arr().Size() == 0);
+
+        JsObject obj;
+        require(obj.Read(std::string_view{json_example2}));
+        require(obj.Has("glossary"));
+        JsArray arr;
+        require(arr.Read(std::string_view{json_example4}));
+        require(arr.Size() == 7);
+    }
+
+    { // Buffer parsing of malformed input
+        const char *bad_examples[] = {"", "{", "[1, 2", "{\"a\" 1}", "{\"a\": }", "[1 2]", "\"unterminated", "nul", "-",
+                                      "1.", "[1., 2]", "012", "-012", "00", ".5"};
+        for (const char *example : bad_examples) {
+            JsElement el(JsLiteralType::Null);
+            std::cerr.setstate(std::ios_base::failbit); // suppress error messages
+            const bool res = el.Read(std::string_view{example});
+            std::cerr.clear();
+            require(!res);
+        }
+    }
+
     printf("OK\n");
+
+    { // Throughput benchmark
+        using namespace std::chrono;
+
+        const std::string large_json = GenerateLargeJson(20000);
+        const double size_mb = double(large_json.size()) / (1024.0 * 1024.0);
+
+        Sys::MultiPoolAllocator<char> my_alloc(32, 512);
+
+        const auto t1 = high_resolution_clock::now();
+        JsElementP el1(JsLiteralType::Null);
+        {
+            std::stringstream ss(large_json);
+            require(el1.Read(ss, my_alloc));
+        }
+        const auto t2 = high_resolution_clock::now();
+        JsElementP el2(JsLiteralType::Null);
+        require(el2.Read(std::string_view{large_json}, my_alloc));
+        const auto t3 = high_resolution_clock::now();
+        require(el1 == el2);
+
+        const double stream_s = duration<double>(t2 - t1).count(), buf_s = duration<double>(t3 - t2).count();
+        printf("\tParsing %.2f MB: stream %.2f MB/s, buffer %.2f MB/s\n", size_mb, size_mb / stream_s,
+               size_mb / buf_s);
+    }
 }
@@ -1,10 +1,111 @@
 #include "test_common.h"
 
+#include <chrono>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "../ThreadPool.h"
 
+namespace {
+// Mix of small ParallelFor jobs (tiles-like) and independent tasks pushed from several external threads (frontend-like)
+double run_contention_scenario(Sys::ThreadPool &threads, const int iterations) {
+    using namespace std::chrono;
+
+    std::atomic<uint64_t> sink = {};
+    const auto t1 = high_resolution_clock::now();
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 2; ++p) {
+        producers.emplace_back([&]() {
+            for (int it = 0; it < iterations; ++it) {
+                std::vector<std::future<void>> events;
+                for (int j = 0; j < 64; ++j) {
+                    events.push_back(threads.Enqueue([&sink, j]() { sink += uint64_t(j); }));
+                }
+                for (std::future<void> &e : events) {
+                    e.wait();
+                }
+            }
+        });
+    }
+
+    for (int it = 0; it < iterations; ++it) {
+        threads.ParallelFor(0, 1024, [&sink](const int i) {
+            uint64_t val = uint64_t(i);
+            for (int k = 0; k < 64; ++k) {
+                val = val * 6364136223846793005ull + 1442695040888963407ull;
+            }
+            sink += val;
+        });
+    }
+
+    for (std::thread &t : producers) {
+        t.join();
+    }
+
+    return duration<double, std::milli>(high_resolution_clock::now() - t1).count();
+}
+
+void bench_thread_pool_contention() {
+    using namespace Sys;
+
+    const int threads_count = std::max(int(std::thread::hardware_concurrency()), 2);
+    const int Iterations = 16;
+
+    double time_ms[2] = {};
+    for (const eThreadPoolMode mode : {eThreadPoolMode::SharedQueue, eThreadPoolMode::WorkStealing}) {
+        ThreadPool threads(threads_count, eThreadPriority::Normal, nullptr, mode);
+        run_contention_scenario(threads, 1); // warmup
+        time_ms[int(mode)] = run_contention_scenario(threads, Iterations);
+    }
+
+    printf("\tContention (%i threads): shared queue %.2fms, work-stealing %.2fms\n", threads_count, time_ms[0],
+           time_ms[1]);
+}
+
+void bench_thread_pool_submission() {
+    using namespace Sys;
+    using namespace std::chrono;
+
+    const int threads_count = std::max(int(std::thread::hardware_concurrency()), 2);
+    const int TasksCount = 2048, Iterations = 16;
+
+    for (const eThreadPoolMode mode : {eThreadPoolMode::SharedQueue, eThreadPoolMode::WorkStealing}) {
+        ThreadPool threads(threads_count, eThreadPriority::Normal, nullptr, mode);
+
+        std::atomic_int sink = {};
+        double future_ms = 0.0, counter_ms = 0.0;
+        for (int it = 0; it < Iterations + 1; ++it) {
+            const auto t1 = high_resolution_clock::now();
+            std::vector<std::future<void>> events;
+            events.reserve(TasksCount);
+            for (int i = 0; i < TasksCount; ++i) {
+                events.push_back(threads.Enqueue([&sink, i]() { sink += i; }));
+            }
+            for (std::future<void> &e : events) {
+                e.wait();
+            }
+            const auto t2 = high_resolution_clock::now();
+            TaskCounter counter;
+            for (int i = 0; i < TasksCount; ++i) {
+                threads.Dispatch(counter, [&sink, i]() { sink += i; });
+            }
+            threads.Wait(counter);
+            const auto t3 = high_resolution_clock::now();
+            if (it) { // skip warmup
+                future_ms += duration<double, std::milli>(t2 - t1).count();
+                counter_ms += duration<double, std::milli>(t3 - t2).count();
+            }
+        }
+
+        printf("\tSubmission (%s, %i tasks): future %.2fms, counter %.2fms\n",
+               mode == eThreadPoolMode::SharedQueue ? "shared queue" : "work-stealing", TasksCount,
+               future_ms / Iterations, counter_ms / Iterations);
+    }
+}
+} // namespace
+
 void test_thread_pool() {
     using namespace Sys;
 
@@ -28,7 +129,8 @@ void test_thread_pool() {
     // Normal sorting:       [A][B][C][D][E][F][G][H][I][J]
     // 'Keep close' sorting: [A][B][E][C][F][H][D][G][I][J]
 
-    { // test normal sorting
+    for (const eThreadPoolMode mode : {eThreadPoolMode::SharedQueue, eThreadPoolMode::WorkStealing}) {
+        // test normal sorting
         TaskList task_list;
 
         bool A_finished = false, B_finished = false, C_finished = false, D_finished = false, E_finished = false,
@@ -97,14 +199,15 @@ void test_thread_pool() {
 
         require(task_list.tasks_order[9] == J_id);
 
-        ThreadPool threads(16);
+        ThreadPool threads(16, eThreadPriority::Normal, nullptr, mode);
         threads.Enqueue(std::move(task_list)).wait();
 
         require(A_finished && B_finished && C_finished && D_finished && E_finished && F_finished && G_finished &&
                 H_finished && I_finished && J_finished);
     }
 
-    { // test 'close' sorting
+    for (const eThreadPoolMode mode : {eThreadPoolMode::SharedQueue, eThreadPoolMode::WorkStealing}) {
+        // test 'close' sorting
         TaskList task_list;
 
         bool A_finished = false, B_finished = false, C_finished = false, D_finished = false, E_finished = false,
@@ -170,17 +273,18 @@ void test_thread_pool() {
         require(task_list.tasks_order[8] == I_id);
         require(task_list.tasks_order[9] == J_id);
 
-        ThreadPool threads(16);
+        ThreadPool threads(16, eThreadPriority::Normal, nullptr, mode);
         threads.Enqueue(std::move(task_list)).wait();
 
         require(A_finished && B_finished && C_finished && D_finished && E_finished && F_finished && G_finished &&
                 H_finished && I_finished && J_finished);
     }
 
-    { // parallel for wrapper
+    for (const eThreadPoolMode mode : {eThreadPoolMode::SharedQueue, eThreadPoolMode::WorkStealing}) {
+        // parallel for wrapper
         int data[128] = {};
 
-        ThreadPool threads(16);
+        ThreadPool threads(16, eThreadPriority::Normal, nullptr, mode);
         threads.ParallelFor(0, 64, [&](const int i) { ++data[i]; });
         threads.ParallelFor(64, 128, [&](const int i) { ++data[i]; });
 
@@ -189,5 +293,73 @@ void test_thread_pool() {
         }
     }
 
+    for (const eThreadPoolMode mode : {eThreadPoolMode::SharedQueue, eThreadPoolMode::WorkStealing}) {
+        // nested parallel for
+        std::atomic_int data[64][64] = {};
+
+        ThreadPool threads(4, eThreadPriority::Normal, nullptr, mode);
+        threads.ParallelFor(0, 64, [&](const int i) {
+            threads.ParallelFor(0, 64, [&](const int j) { ++data[i][j]; });
+        });
+
+        for (int i = 0; i < 64; ++i) {
+            for (int j = 0; j < 64; ++j) {
+                require(data[i][j] == 1);
+            }
+        }
+    }
+
+    { // tasks enqueued from many threads
+        ThreadPool threads(8, eThreadPriority::Normal, nullptr, eThreadPoolMode::WorkStealing);
+
+        std::atomic_int counter = {};
+        std::vector<std::thread> producers;
+        for (int i = 0; i < 4; ++i) {
+            producers.emplace_back([&]() {
+                std::vector<std::future<int>> results;
+                for (int j = 0; j < 256; ++j) {
+                    results.push_back(threads.Enqueue([&counter](const int k) { ++counter; return k; }, j));
+                }
+                for (int j = 0; j < 256; ++j) {
+                    require(results[j].get() == j);
+                }
+            });
+        }
+        for (std::thread &t : producers) {
+            t.join();
+        }
+        require(counter == 4 * 256);
+    }
+
+    for (const eThreadPoolMode mode : {eThreadPoolMode::SharedQueue, eThreadPoolMode::WorkStealing}) {
+        // allocation-free submission
+        ThreadPool threads(4, eThreadPriority::Normal, nullptr, mode);
+
+        int data[8192] = {};
+        TaskCounter counter;
+        require(counter.done());
+        for (int i = 0; i < 8192; ++i) { // more than preallocated tasks
+            threads.Dispatch(counter, [&data, i]() { data[i] = i; });
+        }
+        threads.Wait(counter);
+        require(counter.done());
+        for (int i = 0; i < 8192; ++i) {
+            require(data[i] == i);
+        }
+
+        // dispatch from inside of the pool
+        std::atomic_int sum = {};
+        threads.Dispatch(counter, [&]() {
+            for (int i = 0; i < 16; ++i) {
+                threads.Dispatch(counter, [&sum, i]() { sum += i; });
+            }
+        });
+        threads.Wait(counter);
+        require(sum == 120);
+    }
+
     printf("OK\n");
+
+    bench_thread_pool_contention();
+    bench_thread_pool_submission();
 }
@@ -129,7 +129,6 @@ class Renderer {
         uint32_t base_vertex;
         int32_t rt_sh_index;
         int32_t li_index;
-        std::atomic_uint8_t visited_mask;
     };
     std::unique_ptr<ProcessedObjData[]> proc_objects_;
     int proc_objects_capacity_ = 0;
@@ -145,6 +144,24 @@ class Renderer {
         VisObjStorage(VisObjStorage &&rhs) noexcept : objects(std::move(rhs.objects)), count(rhs.count.load()) {}
     };
     Ren::HashMap32<uint32_t, VisObjStorage> temp_visible_objects_, temp_rt_visible_objects_;
+    Ren::HashMap32<uint32_t, VisObjStorage> temp_sh_visible_objects_[4];
+    struct GatherView {
+        Ren::Vec3f cam_pos;
+        uint64_t comp_mask = 0;
+        Ren::HashMap32<uint32_t, VisObjStorage> *out_visible_objects = nullptr;
+    };
+    struct GatherSubtree {
+        uint32_t index;
+        uint32_t visible_mask, full_mask;
+    };
+    std::vector<GatherSubtree> temp_subtree_roots_;
+    struct BatchFragment {
+        std::vector<CustomDrawBatch> custom_batches;
+        std::vector<BasicDrawBatch> basic_batches;
+        std::vector<TexEntry> visible_textures;
+    };
+    std::vector<BatchFragment> temp_batch_fragments_;
+    std::vector<uint32_t> temp_batch_objects_;
     DynArray<BBox> decals_boxes_;
     BackendInfo backend_info_;
     uint64_t backend_cpu_start_ = 0, backend_cpu_end_ = 0;
@@ -156,6 +173,8 @@ class Renderer {
     std::vector<SortSpan64> temp_sort_spans_64_[2];
 
     std::vector<float> temp_depth;
+    std::vector<SWcull_surf> temp_occluder_surfs_;
+    std::vector<Ren::Mat4f> temp_occluder_xforms_;
 
     struct ShadowFrustumCache {
         bool valid = false;
@@ -336,15 +355,22 @@ class Renderer {
     void AddDebugVelocityPass(FgResRef velocity, FgResRef &output_tex);
 
     void GatherDrawables(const SceneData &scene, const Ren::Camera &cam, const Ren::Camera &ext_cam, DrawList &list);
+    void GatherObjectsForViews(const Ren::PackedFrustums &frustums, Ren::Span<const GatherView> views,
+                               const SceneData &scene, const Ren::Mat4f &clip_from_identity, SWcull_ctx *cull_ctx,
+                               uint32_t cull_views_mask);
+    template <typename F> int BuildBatchFragments(F &&build_fragment);
 
     void UpdatePixelFilterTable(ePixelFilter filter, float filter_width);
 
     // Parallel Jobs
-    static void GatherObjectsForZSlice_Job(const Ren::Frustum &frustum, const SceneData &scene,
-                                           const Ren::Vec3f &cam_pos, const Ren::Mat4f &clip_from_identity,
-                                           uint64_t comp_mask, SWcull_ctx *cull_ctx, uint8_t visit_mask,
-                                           ProcessedObjData proc_objects[],
-                                           Ren::HashMap32<uint32_t, VisObjStorage> &out_visible_objects2);
+    static uint32_t CheckBoxVisibility(const Ren::PackedFrustums &frustums, const Ren::Vec3f &bbox_min,
+                                       const Ren::Vec3f &bbox_max, const Ren::Vec3f &cull_cam_pos,
+                                       const Ren::Mat4f &clip_from_identity, SWcull_ctx *cull_ctx,
+                                       uint32_t cull_views_mask, uint32_t visible_mask, uint32_t &inout_full_mask);
+    static void GatherObjectsForViews_Job(const Ren::PackedFrustums &frustums, Ren::Span<const GatherView> views,
+                                          const SceneData &scene, const GatherSubtree &subtree,
+                                          const Ren::Vec3f &cull_cam_pos, const Ren::Mat4f &clip_from_identity,
+                                          SWcull_ctx *cull_ctx, uint32_t cull_views_mask);
     static void ClusterItemsForZSlice_Job(int slice, const Ren::Frustum *sub_frustums, const BBox *decals_boxes,
                                           const LightSource *light_sources, Ren::Span<const uint32_t> litem_to_lsource,
                                           const DrawList &list, CellData out_cells[], ItemData out_items[],
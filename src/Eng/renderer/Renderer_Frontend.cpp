@@ -1,5 +1,6 @@
 #include "Renderer.h"
 
+#include <algorithm>
 #include <cfloat>
 
 #include <Ren/Context.h>
@@ -94,6 +95,7 @@ uint32_t __push_skeletal_mesh(uint32_t skinned_buf_vtx_offset, const Eng::AnimSt
 uint32_t __record_texture(std::vector<Eng::TexEntry> &storage, const Ren::Tex2DRef &tex, int prio, uint16_t distance);
 void __record_textures(std::vector<Eng::TexEntry> &storage, const Ren::Material *mat, bool is_animated,
                        uint16_t distance);
+void __merge_textures(std::vector<Eng::TexEntry> &storage, Ren::Span<const Eng::TexEntry> entries);
 
 extern const Ren::Vec2f PMJSamples64[64];
 
@@ -179,6 +181,30 @@ __itt_string_handle *itt_proc_occluders_str = __itt_string_handle_create("Proces
 #define _CROSS(x, y)                                                                                                   \
     {(x)[1] * (y)[2] - (x)[2] * (y)[1], (x)[2] * (y)[0] - (x)[0] * (y)[2], (x)[0] * (y)[1] - (x)[1] * (y)[0]}
 
+template <typename F> int Eng::Renderer::BuildBatchFragments(F &&build_fragment) {
+    // Objects are split into fixed chunks (not per thread) to keep the result deterministic
+    const int ObjectsPerFragment = 64;
+
+    const int objects_count = int(temp_batch_objects_.size());
+    const int fragments_count = (objects_count + ObjectsPerFragment - 1) / ObjectsPerFragment;
+    if (int(temp_batch_fragments_.size()) < fragments_count) {
+        temp_batch_fragments_.resize(fragments_count);
+    }
+
+    threads_.ParallelFor(0, fragments_count, [&](const int i) {
+        BatchFragment &fr = temp_batch_fragments_[i];
+        fr.custom_batches.clear();
+        fr.basic_batches.clear();
+        fr.visible_textures.clear();
+
+        for (int j = i * ObjectsPerFragment; j < std::min((i + 1) * ObjectsPerFragment, objects_count); ++j) {
+            build_fragment(temp_batch_objects_[j], fr);
+        }
+    });
+
+    return fragments_count;
+}
+
 void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &cam, const Ren::Camera &ext_cam,
                                     DrawList &list) {
     using namespace RendererInternal;
@@ -287,9 +313,6 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
     }
     memset(proc_objects_.get(), 0xff, sizeof(ProcessedObjData) * scene.objects.size());
 
-    Ren::Frustum rt_z_frustums[ITEM_GRID_RES_Z];
-    list.ext_cam.ExtractSubFrustums(1, 1, ITEM_GRID_RES_Z, rt_z_frustums);
-
     // retrieve pointers to components for fast access
     const auto *transforms = (Transform *)scene.comp_store[CompTransform]->SequentialData();
     const auto *drawables = (Drawable *)scene.comp_store[CompDrawable]->SequentialData();
@@ -326,8 +349,13 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
 
     const Mat4f &cull_view_from_world = view_from_world, &cull_clip_from_view = list.draw_cam.proj_matrix();
 
+    temp_occluder_surfs_.clear();
+    temp_occluder_xforms_.clear();
+    // reserved upfront, so pointers to matrices stay valid during gathering
+    temp_occluder_xforms_.reserve(scene.comp_store[CompOccluder]->Count());
+
     if (scene.root_node != 0xffffffff) {
-        // Rasterize occluder meshes
+        // Gather occluder meshes
         stack[stack_size++] = scene.root_node;
 
         while (stack_size && culling_enabled) {
@@ -360,17 +388,17 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
                         continue;
                     }
 
-                    const Mat4f view_from_object = cull_view_from_world * tr.world_from_object,
-                                clip_from_object = cull_clip_from_view * view_from_object;
+                    const Mat4f view_from_object = cull_view_from_world * tr.world_from_object;
+
+                    assert(temp_occluder_xforms_.size() < temp_occluder_xforms_.capacity());
+                    const Mat4f &clip_from_object =
+                        temp_occluder_xforms_.emplace_back(cull_clip_from_view * view_from_object);
 
                     const Occluder &occ = occluders[obj.components[CompOccluder]];
                     const Mesh *mesh = occ.mesh.get();
 
-                    SWcull_surf surf[64];
-                    int surf_count = 0;
-
                     for (const auto &grp : mesh->groups()) {
-                        SWcull_surf *_surf = &surf[surf_count++];
+                        SWcull_surf *_surf = &temp_occluder_surfs_.emplace_back();
 
                         _surf->type = SW_OCCLUDER;
                         _surf->prim_type = SW_TRIANGLES;
@@ -382,13 +410,19 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
                         _surf->count = SWuint(grp.num_indices);
                         _surf->xform = ValuePtr(clip_from_object);
                     }
-
-                    swCullCtxSubmitCullSurfs(&cull_ctx_, surf, surf_count);
                 }
             }
         }
     }
 
+    if (!temp_occluder_surfs_.empty()) {
+        // Set up occluder triangles once, then rasterize them in parallel, each bin is a horizontal band of the
+        // culling buffer
+        const int bin_count = 2 * (threads_.workers_count() + 1);
+        swCullCtxBinCullSurfs(&cull_ctx_, temp_occluder_surfs_.data(), SWuint(temp_occluder_surfs_.size()), bin_count);
+        threads_.ParallelFor(0, bin_count, [&](const int bin) { swCullCtxRasterizeBin(&cull_ctx_, bin); });
+    }
+
     OPTICK_POP();
     __itt_task_end(__g_itt_domain);
 
@@ -401,46 +435,25 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
     const uint64_t main_gather_start = Sys::GetTimeUs();
 
     if (scene.root_node != 0xffffffff) {
-        Ren::Frustum z_frustums[ITEM_GRID_RES_Z];
-        list.draw_cam.ExtractSubFrustums(1, 1, ITEM_GRID_RES_Z, z_frustums);
+        // Main and RT views are gathered in a single pass
+        Ren::PackedFrustums frustums;
+        GatherView views[2];
 
-        std::future<void> futures[2 * ITEM_GRID_RES_Z];
+        frustums.Add(list.draw_cam.frustum());
+        views[0].cam_pos = list.draw_cam.world_position();
+        views[0].comp_mask = (CompDrawableBit | CompDecalBit | CompLightSourceBit | CompProbeBit);
+        views[0].out_visible_objects = &temp_visible_objects_;
 
-        const uint64_t CompMask = (CompDrawableBit | CompDecalBit | CompLightSourceBit | CompProbeBit);
-        for (auto it = temp_visible_objects_.begin(); it != temp_visible_objects_.end(); ++it) {
-            it->val.objects.clear();
-            it->val.count = 0;
-        }
-        for (auto it = scene.object_counts.cbegin(); it != scene.object_counts.cend(); ++it) {
-            VisObjStorage &s = temp_visible_objects_[it->key & CompMask];
-            s.objects.resize(s.objects.size() + it->val);
-        }
-        for (int i = 0; i < ITEM_GRID_RES_Z; ++i) {
-            futures[i] = threads_.Enqueue(GatherObjectsForZSlice_Job, std::ref(z_frustums[i]), std::ref(scene),
-                                          list.draw_cam.world_position(), clip_from_identity, CompMask, &cull_ctx_,
-                                          0b00000001, proc_objects_.get(), std::ref(temp_visible_objects_));
-        }
+        frustums.Add(list.ext_cam.frustum());
+        views[1].cam_pos = list.draw_cam.world_position();
+        views[1].comp_mask = (CompAccStructureBit | CompLightSourceBit);
+        views[1].out_visible_objects = &temp_rt_visible_objects_;
 
-        const uint64_t RTCompMask = (CompAccStructureBit | CompLightSourceBit);
-        for (auto it = temp_rt_visible_objects_.begin(); it != temp_rt_visible_objects_.end(); ++it) {
-            it->val.objects.clear();
-            it->val.count = 0;
-        }
-        for (auto it = scene.object_counts.cbegin(); it != scene.object_counts.cend(); ++it) {
-            VisObjStorage &s = temp_rt_visible_objects_[it->key & RTCompMask];
-            s.objects.resize(s.objects.size() + it->val);
-        }
-        for (int i = 0; i < ITEM_GRID_RES_Z; ++i) {
-            futures[ITEM_GRID_RES_Z + i] = threads_.Enqueue(
-                GatherObjectsForZSlice_Job, std::ref(rt_z_frustums[i]), std::ref(scene), list.draw_cam.world_position(),
-                Ren::Mat4f{}, RTCompMask, nullptr, 0b00000010, proc_objects_.get(), std::ref(temp_rt_visible_objects_));
-        }
+        GatherObjectsForViews(frustums, views, scene, clip_from_identity, &cull_ctx_, 0b00000001);
 
         /////
 
-        for (int i = 0; i < ITEM_GRID_RES_Z; ++i) {
-            futures[i].wait();
-        }
+        temp_batch_objects_.clear();
 
         for (auto it = temp_visible_objects_.begin(); it != temp_visible_objects_.end(); ++it) {
             if (it->key & CompDrawableBit) {
@@ -454,10 +467,6 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
                     }
                     const Mesh *mesh = dr.mesh.get();
 
-                    const float cam_dist = Distance(cam.world_position(), 0.5f * (tr.bbox_min_ws + tr.bbox_max_ws));
-                    const auto cam_dist_u8 = (uint8_t)std::min(255 * cam_dist / 500.0f, 255.0f);
-                    const uint16_t cam_dist_u16 = uint16_t(0xffffu * (cam_dist / 500.0f));
-
                     uint32_t base_vertex = mesh->attribs_buf1().sub.offset / 16;
 
                     if (obj.comp_mask & CompAnimStateBit) {
@@ -468,79 +477,8 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
 
                     __push_ellipsoids(dr, tr.world_from_object, list);
 
-                    const uint32_t indices_start = mesh->indices_buf().sub.offset;
-                    const Ren::Span<const Ren::TriGroup> groups = mesh->groups();
-                    for (int j = 0; j < int(groups.size()); ++j) {
-                        const Ren::TriGroup &grp = groups[j];
-
-                        const MaterialRef &front_mat =
-                            (j >= dr.material_override.size()) ? grp.front_mat : dr.material_override[j].first;
-
-                        __record_textures(list.visible_textures, front_mat.get(), (obj.comp_mask & CompAnimStateBit),
-                                          cam_dist_u16);
-
-                        if (!deferred_shading || (front_mat->flags & eMatFlags::CustomShaded)) {
-                            CustomDrawBatch &fwd_batch = list.custom_batches.emplace_back();
-
-                            fwd_batch.alpha_blend_bit = (front_mat->flags & eMatFlags::AlphaBlend) ? 1 : 0;
-                            fwd_batch.pipe_id = front_mat->pipelines[pipeline_index].index();
-                            fwd_batch.alpha_test_bit = (front_mat->flags & eMatFlags::AlphaTest) ? 1 : 0;
-                            fwd_batch.depth_write_bit = (front_mat->flags & eMatFlags::DepthWrite) ? 1 : 0;
-                            fwd_batch.two_sided_bit = (front_mat->flags & eMatFlags::TwoSided) ? 1 : 0;
-                            if (!ctx_.capabilities.bindless_texture) {
-                                fwd_batch.mat_id = uint32_t(front_mat.index());
-                            } else {
-                                fwd_batch.mat_id = 0;
-                            }
-                            fwd_batch.cam_dist = (front_mat->flags & eMatFlags::AlphaBlend) ? uint32_t(cam_dist_u8) : 0;
-                            fwd_batch.indices_offset = (indices_start + grp.byte_offset) / sizeof(uint32_t);
-                            fwd_batch.base_vertex = base_vertex;
-                            fwd_batch.indices_count = grp.num_indices;
-                            fwd_batch.instance_index = i.index;
-                            fwd_batch.material_index = int32_t(front_mat.index());
-                            fwd_batch.instance_count = 1;
-                        }
-
-                        { // detph fill and gbuffer draw (in deferred mode)
-                            list.basic_batches.reserve(list.basic_batches.size() + 3);
-                            BasicDrawBatch &base_batch = list.basic_batches.emplace_back();
-
-                            base_batch.type_bits = BasicDrawBatch::TypeSimple;
-                            if (obj.comp_mask & CompAnimStateBit) {
-                                base_batch.type_bits = BasicDrawBatch::TypeSkinned;
-                            } else if (obj.comp_mask & CompVegStateBit) {
-                                base_batch.type_bits = BasicDrawBatch::TypeVege;
-                            }
-
-                            base_batch.alpha_blend_bit = (front_mat->flags & eMatFlags::AlphaBlend) ? 1 : 0;
-                            base_batch.alpha_test_bit = (front_mat->flags & eMatFlags::AlphaTest) ? 1 : 0;
-                            base_batch.moving_bit = (obj.last_change_mask & CompTransformBit) ? 1 : 0;
-                            base_batch.two_sided_bit = (front_mat->flags & eMatFlags::TwoSided) ? 1 : 0;
-                            base_batch.indices_offset = (indices_start + grp.byte_offset) / sizeof(uint32_t);
-                            base_batch.base_vertex = base_vertex;
-                            base_batch.indices_count = grp.num_indices;
-                            base_batch.instance_index = i.index;
-                            base_batch.material_index = int32_t(front_mat.index());
-                            base_batch.instance_count = 1;
-
-                            if (front_mat->flags & eMatFlags::Emissive) {
-                                BasicDrawBatch &emissive_batch = list.basic_batches.emplace_back(base_batch);
-                                emissive_batch.emissive_bit = 1;
-                            }
-
-                            const MaterialRef &back_mat =
-                                (j >= dr.material_override.size()) ? grp.back_mat : dr.material_override[j].second;
-                            if (front_mat != back_mat) {
-                                __record_textures(list.visible_textures, back_mat.get(),
-                                                  (obj.comp_mask & CompAnimStateBit), cam_dist_u16);
-
-                                BasicDrawBatch &back_batch = list.basic_batches.emplace_back(base_batch);
-                                back_batch.back_sided_bit = 1;
-                                back_batch.alpha_test_bit = (back_mat->flags & eMatFlags::AlphaTest) ? 1 : 0;
-                                back_batch.material_index = int32_t(back_mat.index());
-                            }
-                        }
-                    }
+                    // batches are created later in parallel
+                    temp_batch_objects_.push_back(i.index);
                 }
             }
             if (lighting_enabled && (it->key & CompLightSourceBit) && litem_to_lsource_.size() < MAX_LIGHTS_TOTAL) {
@@ -656,8 +594,100 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
             }
         }
 
-        for (int i = ITEM_GRID_RES_Z; i < 2 * ITEM_GRID_RES_Z; ++i) {
-            futures[i].wait();
+        const int main_fragments_count = BuildBatchFragments([&](const uint32_t obj_index, BatchFragment &fr) {
+            const SceneObject &obj = scene.objects[obj_index];
+
+            const Transform &tr = transforms[obj.components[CompTransform]];
+            const Drawable &dr = drawables[obj.components[CompDrawable]];
+            const Mesh *mesh = dr.mesh.get();
+
+            const float cam_dist = Distance(cam.world_position(), 0.5f * (tr.bbox_min_ws + tr.bbox_max_ws));
+            const auto cam_dist_u8 = (uint8_t)std::min(255 * cam_dist / 500.0f, 255.0f);
+            const uint16_t cam_dist_u16 = uint16_t(0xffffu * (cam_dist / 500.0f));
+
+            const uint32_t base_vertex = proc_objects_[obj_index].base_vertex;
+
+            const uint32_t indices_start = mesh->indices_buf().sub.offset;
+            const Ren::Span<const Ren::TriGroup> groups = mesh->groups();
+            for (int j = 0; j < int(groups.size()); ++j) {
+                const Ren::TriGroup &grp = groups[j];
+
+                const MaterialRef &front_mat =
+                    (j >= dr.material_override.size()) ? grp.front_mat : dr.material_override[j].first;
+
+                __record_textures(fr.visible_textures, front_mat.get(), (obj.comp_mask & CompAnimStateBit),
+                                  cam_dist_u16);
+
+                if (!deferred_shading || (front_mat->flags & eMatFlags::CustomShaded)) {
+                    CustomDrawBatch &fwd_batch = fr.custom_batches.emplace_back();
+
+                    fwd_batch.alpha_blend_bit = (front_mat->flags & eMatFlags::AlphaBlend) ? 1 : 0;
+                    fwd_batch.pipe_id = front_mat->pipelines[pipeline_index].index();
+                    fwd_batch.alpha_test_bit = (front_mat->flags & eMatFlags::AlphaTest) ? 1 : 0;
+                    fwd_batch.depth_write_bit = (front_mat->flags & eMatFlags::DepthWrite) ? 1 : 0;
+                    fwd_batch.two_sided_bit = (front_mat->flags & eMatFlags::TwoSided) ? 1 : 0;
+                    if (!ctx_.capabilities.bindless_texture) {
+                        fwd_batch.mat_id = uint32_t(front_mat.index());
+                    } else {
+                        fwd_batch.mat_id = 0;
+                    }
+                    fwd_batch.cam_dist = (front_mat->flags & eMatFlags::AlphaBlend) ? uint32_t(cam_dist_u8) : 0;
+                    fwd_batch.indices_offset = (indices_start + grp.byte_offset) / sizeof(uint32_t);
+                    fwd_batch.base_vertex = base_vertex;
+                    fwd_batch.indices_count = grp.num_indices;
+                    fwd_batch.instance_index = obj_index;
+                    fwd_batch.material_index = int32_t(front_mat.index());
+                    fwd_batch.instance_count = 1;
+                }
+
+                { // detph fill and gbuffer draw (in deferred mode)
+                    fr.basic_batches.reserve(fr.basic_batches.size() + 3);
+                    BasicDrawBatch &base_batch = fr.basic_batches.emplace_back();
+
+                    base_batch.type_bits = BasicDrawBatch::TypeSimple;
+                    if (obj.comp_mask & CompAnimStateBit) {
+                        base_batch.type_bits = BasicDrawBatch::TypeSkinned;
+                    } else if (obj.comp_mask & CompVegStateBit) {
+                        base_batch.type_bits = BasicDrawBatch::TypeVege;
+                    }
+
+                    base_batch.alpha_blend_bit = (front_mat->flags & eMatFlags::AlphaBlend) ? 1 : 0;
+                    base_batch.alpha_test_bit = (front_mat->flags & eMatFlags::AlphaTest) ? 1 : 0;
+                    base_batch.moving_bit = (obj.last_change_mask & CompTransformBit) ? 1 : 0;
+                    base_batch.two_sided_bit = (front_mat->flags & eMatFlags::TwoSided) ? 1 : 0;
+                    base_batch.indices_offset = (indices_start + grp.byte_offset) / sizeof(uint32_t);
+                    base_batch.base_vertex = base_vertex;
+                    base_batch.indices_count = grp.num_indices;
+                    base_batch.instance_index = obj_index;
+                    base_batch.material_index = int32_t(front_mat.index());
+                    base_batch.instance_count = 1;
+
+                    if (front_mat->flags & eMatFlags::Emissive) {
+                        BasicDrawBatch &emissive_batch = fr.basic_batches.emplace_back(base_batch);
+                        emissive_batch.emissive_bit = 1;
+                    }
+
+                    const MaterialRef &back_mat =
+                        (j >= dr.material_override.size()) ? grp.back_mat : dr.material_override[j].second;
+                    if (front_mat != back_mat) {
+                        __record_textures(fr.visible_textures, back_mat.get(), (obj.comp_mask & CompAnimStateBit),
+                                          cam_dist_u16);
+
+                        BasicDrawBatch &back_batch = fr.basic_batches.emplace_back(base_batch);
+                        back_batch.back_sided_bit = 1;
+                        back_batch.alpha_test_bit = (back_mat->flags & eMatFlags::AlphaTest) ? 1 : 0;
+                        back_batch.material_index = int32_t(back_mat.index());
+                    }
+                }
+            }
+        });
+
+        // Merge fragments in order, so the result does not depend on threads count
+        for (int i = 0; i < main_fragments_count; ++i) {
+            const BatchFragment &fr = temp_batch_fragments_[i];
+            list.custom_batches.insert(list.custom_batches.end(), fr.custom_batches.begin(), fr.custom_batches.end());
+            list.basic_batches.insert(list.basic_batches.end(), fr.basic_batches.begin(), fr.basic_batches.end());
+            __merge_textures(list.visible_textures, fr.visible_textures);
         }
 
         VisObjStorage &rt_objects = temp_rt_visible_objects_[CompAccStructureBit];
@@ -827,7 +857,18 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
         const float max_dist = Distance(scene.nodes[0].bbox_min, scene.nodes[0].bbox_max);
         const Vec3f view_dir = list.draw_cam.view_dir();
 
-        // Gather drawables for each cascade
+        uint64_t CompMask = CompDrawableBit;
+        if (rt_shadows_enabled) {
+            CompMask |= CompAccStructureBit;
+        }
+
+        // Cascades are set up first, then drawables for all of them are gathered in a single pass
+        Ren::PackedFrustums casc_frustums;
+        GatherView casc_views[4];
+        int casc_indices[4] = {};
+        ShadowList *casc_lists[4] = {};
+        float casc_dim_thres[4] = {};
+
         for (int casc = 0; casc < 4; ++casc) {
             Mat4f tmp_cam_world_from_clip;
             Vec3f bounding_center;
@@ -1092,51 +1133,33 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
                 sun_shadow_cache_[casc].clip_from_world = sh_clip_from_world;
             }
 
-            const int ZSliceCount = (casc + 1) * 6;
-            Ren::Frustum z_frustums[24];
-
-            const float z_beg = -sh_clip_frustum.planes[sh_clip_frustum.planes_count - 2].d;
-            const float z_end = sh_clip_frustum.planes[sh_clip_frustum.planes_count - 1].d;
-
-            for (int i = 0; i < ZSliceCount; ++i) {
-                z_frustums[i] = sh_clip_frustum;
-
-                const float k_near = float(i) / ZSliceCount;
-                const float k_far = float(i + 1) / ZSliceCount;
+            const int view_index = casc_frustums.Add(sh_clip_frustum);
 
-                z_frustums[i].planes[sh_clip_frustum.planes_count - 2].d = -(z_beg + k_near * (z_end - z_beg));
-                z_frustums[i].planes[sh_clip_frustum.planes_count - 1].d = z_beg + k_far * (z_end - z_beg);
-            }
+            GatherView &view = casc_views[view_index];
+            view.cam_pos = shadow_cam.world_position();
+            view.comp_mask = CompMask;
+            view.out_visible_objects = &temp_sh_visible_objects_[view_index];
 
-            std::future<void> futures[24];
+            casc_indices[view_index] = casc;
+            casc_lists[view_index] = &sh_list;
+            casc_dim_thres[view_index] = object_dim_thres;
+        }
 
-            uint64_t CompMask = CompDrawableBit;
-            if (rt_shadows_enabled) {
-                CompMask |= CompAccStructureBit;
-            }
-            for (auto it = temp_visible_objects_.begin(); it != temp_visible_objects_.end(); ++it) {
-                it->val.objects.clear();
-                it->val.count = 0;
-            }
-            for (auto it = scene.object_counts.cbegin(); it != scene.object_counts.cend(); ++it) {
-                VisObjStorage &s = temp_visible_objects_[it->key & CompMask];
-                s.objects.resize(s.objects.size() + it->val);
-            }
-            for (int i = 0; i < ZSliceCount; ++i) {
-                futures[i] =
-                    threads_.Enqueue(GatherObjectsForZSlice_Job, std::ref(z_frustums[i]), std::ref(scene),
-                                     shadow_cam.world_position(), Ren::Mat4f{}, CompMask, nullptr, (0b00000100 << casc),
-                                     proc_objects_.get(), std::ref(temp_visible_objects_));
-            }
+        if (casc_frustums.frustums_count) {
+            GatherObjectsForViews(casc_frustums, Ren::Span<const GatherView>{casc_views, casc_frustums.frustums_count},
+                                  scene, Ren::Mat4f{}, nullptr, 0);
+        }
 
-            for (int i = 0; i < ZSliceCount; ++i) {
-                futures[i].wait();
-            }
+        for (int view_index = 0; view_index < casc_frustums.frustums_count; ++view_index) {
+            const int casc = casc_indices[view_index];
+            const float object_dim_thres = casc_dim_thres[view_index];
+            ShadowList &sh_list = *casc_lists[view_index];
 
-            /////
+            temp_batch_objects_.clear();
 
-            for (auto it = temp_visible_objects_.begin(); it != temp_visible_objects_.end(); ++it) {
-                for (const VisObj i : Ren::Span<VisObj>{it->val.objects.data(), it->val.count.load()}) {
+            const Ren::HashMap32<uint32_t, VisObjStorage> &visible_objects = temp_sh_visible_objects_[view_index];
+            for (auto it = visible_objects.cbegin(); it != visible_objects.cend(); ++it) {
+                for (const VisObj i : Ren::Span<const VisObj>{it->val.objects.data(), it->val.count.load()}) {
                     const SceneObject &obj = scene.objects[i.index];
 
                     const Transform &tr = transforms[obj.components[CompTransform]];
@@ -1217,67 +1240,83 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
                         }
                     }
 
-                    const Ren::Span<const Ren::TriGroup> groups = mesh->groups();
-                    for (int j = 0; j < int(groups.size()); ++j) {
-                        const Ren::TriGroup &grp = groups[j];
+                    // batches are created later in parallel
+                    temp_batch_objects_.push_back(i.index);
+                }
+            }
 
-                        const MaterialRef &front_mat =
-                            (j >= dr.material_override.size()) ? grp.front_mat : dr.material_override[j].first;
+            const int fragments_count = BuildBatchFragments([&](const uint32_t obj_index, BatchFragment &fr) {
+                const SceneObject &obj = scene.objects[obj_index];
 
-                        if ((front_mat->flags & eMatFlags::AlphaBlend) == 0) {
-                            if ((front_mat->flags & eMatFlags::AlphaTest) && front_mat->textures.size() > 4 &&
-                                front_mat->textures[4]) {
-                                // assume only the fourth texture gives transparency
-                                __record_texture(list.visible_textures, front_mat->textures[4], 0, 0xffffu);
-                            }
+                const Drawable &dr = drawables[obj.components[CompDrawable]];
+                const Mesh *mesh = dr.mesh.get();
 
-                            list.basic_batches.reserve(list.shadow_batches.size() + 2);
-                            BasicDrawBatch &batch = list.shadow_batches.emplace_back();
+                const Ren::Span<const Ren::TriGroup> groups = mesh->groups();
+                for (int j = 0; j < int(groups.size()); ++j) {
+                    const Ren::TriGroup &grp = groups[j];
 
-                            batch.type_bits = BasicDrawBatch::TypeSimple;
-                            // we do not care if it is skinned
-                            if (obj.comp_mask & CompVegStateBit) {
-                                batch.type_bits = BasicDrawBatch::TypeVege;
-                            }
+                    const MaterialRef &front_mat =
+                        (j >= dr.material_override.size()) ? grp.front_mat : dr.material_override[j].first;
 
-                            const MaterialRef &back_mat =
-                                (j >= dr.material_override.size()) ? grp.back_mat : dr.material_override[j].second;
-
-                            const bool simple_twosided = (front_mat->flags & eMatFlags::TwoSided) ||
-                                                         (!(front_mat->flags & eMatFlags::AlphaTest) &&
-                                                          !(back_mat->flags & eMatFlags::AlphaTest));
-
-                            batch.alpha_test_bit = (front_mat->flags & eMatFlags::AlphaTest) ? 1 : 0;
-                            batch.moving_bit = 0;
-                            batch.two_sided_bit = simple_twosided ? 1 : 0;
-                            batch.indices_offset =
-                                (mesh->indices_buf().sub.offset + grp.byte_offset) / sizeof(uint32_t);
-                            batch.base_vertex = proc_objects_[i.index].base_vertex;
-                            batch.indices_count = grp.num_indices;
-                            batch.instance_index = i.index;
-                            batch.material_index = ((front_mat->flags & eMatFlags::AlphaTest) ||
-                                                    (batch.type_bits == BasicDrawBatch::TypeVege))
-                                                       ? int32_t(front_mat.index())
-                                                       : 0;
-                            batch.instance_count = 1;
-
-                            if (!simple_twosided && front_mat != back_mat) {
-                                if ((back_mat->flags & eMatFlags::AlphaTest) && back_mat->textures.size() > 4 &&
-                                    back_mat->textures[4]) {
-                                    // assume only the fourth texture gives transparency
-                                    __record_texture(list.visible_textures, back_mat->textures[4], 0, 0xffffu);
-                                }
+                    if ((front_mat->flags & eMatFlags::AlphaBlend) == 0) {
+                        if ((front_mat->flags & eMatFlags::AlphaTest) && front_mat->textures.size() > 4 &&
+                            front_mat->textures[4]) {
+                            // assume only the fourth texture gives transparency
+                            __record_texture(fr.visible_textures, front_mat->textures[4], 0, 0xffffu);
+                        }
 
-                                BasicDrawBatch &back_batch = list.shadow_batches.emplace_back(batch);
-                                back_batch.back_sided_bit = 1;
-                                back_batch.alpha_test_bit = (back_mat->flags & eMatFlags::AlphaTest) ? 1 : 0;
-                                back_batch.material_index = int32_t(back_mat.index());
+                        fr.basic_batches.reserve(fr.basic_batches.size() + 2);
+                        BasicDrawBatch &batch = fr.basic_batches.emplace_back();
+
+                        batch.type_bits = BasicDrawBatch::TypeSimple;
+                        // we do not care if it is skinned
+                        if (obj.comp_mask & CompVegStateBit) {
+                            batch.type_bits = BasicDrawBatch::TypeVege;
+                        }
+
+                        const MaterialRef &back_mat =
+                            (j >= dr.material_override.size()) ? grp.back_mat : dr.material_override[j].second;
+
+                        const bool simple_twosided = (front_mat->flags & eMatFlags::TwoSided) ||
+                                                     (!(front_mat->flags & eMatFlags::AlphaTest) &&
+                                                      !(back_mat->flags & eMatFlags::AlphaTest));
+
+                        batch.alpha_test_bit = (front_mat->flags & eMatFlags::AlphaTest) ? 1 : 0;
+                        batch.moving_bit = 0;
+                        batch.two_sided_bit = simple_twosided ? 1 : 0;
+                        batch.indices_offset =
+                            (mesh->indices_buf().sub.offset + grp.byte_offset) / sizeof(uint32_t);
+                        batch.base_vertex = proc_objects_[obj_index].base_vertex;
+                        batch.indices_count = grp.num_indices;
+                        batch.instance_index = obj_index;
+                        batch.material_index = ((front_mat->flags & eMatFlags::AlphaTest) ||
+                                                (batch.type_bits == BasicDrawBatch::TypeVege))
+                                                   ? int32_t(front_mat.index())
+                                                   : 0;
+                        batch.instance_count = 1;
+
+                        if (!simple_twosided && front_mat != back_mat) {
+                            if ((back_mat->flags & eMatFlags::AlphaTest) && back_mat->textures.size() > 4 &&
+                                back_mat->textures[4]) {
+                                // assume only the fourth texture gives transparency
+                                __record_texture(fr.visible_textures, back_mat->textures[4], 0, 0xffffu);
                             }
+
+                            BasicDrawBatch &back_batch = fr.basic_batches.emplace_back(batch);
+                            back_batch.back_sided_bit = 1;
+                            back_batch.alpha_test_bit = (back_mat->flags & eMatFlags::AlphaTest) ? 1 : 0;
+                            back_batch.material_index = int32_t(back_mat.index());
                         }
                     }
                 }
-            }
+            });
 
+            sh_list.shadow_batch_start = uint32_t(list.shadow_batches.size());
+            for (int i = 0; i < fragments_count; ++i) {
+                const BatchFragment &fr = temp_batch_fragments_[i];
+                list.shadow_batches.insert(list.shadow_batches.end(), fr.basic_batches.begin(), fr.basic_batches.end());
+                __merge_textures(list.visible_textures, fr.visible_textures);
+            }
             sh_list.shadow_batch_count = uint32_t(list.shadow_batches.size()) - sh_list.shadow_batch_start;
         }
     }
@@ -1923,6 +1962,11 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
         list.frontend_info.shadow_gather_time_us = uint32_t(drawables_sort_start - shadow_gather_start);
         list.frontend_info.drawables_sort_time_us = uint32_t(items_assignment_start - drawables_sort_start);
         list.frontend_info.items_assignment_time_us = uint32_t(iteration_end - items_assignment_start);
+        list.frontend_info.bvh_update_time_us = scene.bvh_stats.update_time_us;
+        list.frontend_info.bvh_rebuild_time_us = scene.bvh_stats.rebuild_time_us;
+        list.frontend_info.bvh_rebuilds_count = scene.bvh_stats.rebuilds_count;
+        list.frontend_info.bvh_quality =
+            scene.bvh_stats.cost > 0.0f ? scene.bvh_stats.built_cost / scene.bvh_stats.cost : 1.0f;
     }
 
     ++frame_index_;
@@ -1931,119 +1975,181 @@ void Eng::Renderer::GatherDrawables(const SceneData &scene, const Ren::Camera &c
     __itt_task_end(__g_itt_domain);
 }
 
-void Eng::Renderer::GatherObjectsForZSlice_Job(const Ren::Frustum &frustum, const SceneData &scene,
-                                               const Ren::Vec3f &cam_pos, const Ren::Mat4f &clip_from_identity,
-                                               const uint64_t comp_mask, SWcull_ctx *cull_ctx, const uint8_t visit_mask,
-                                               ProcessedObjData proc_objects[],
-                                               Ren::HashMap32<uint32_t, VisObjStorage> &out_visible_objects2) {
+void Eng::Renderer::GatherObjectsForViews(const Ren::PackedFrustums &frustums, Ren::Span<const GatherView> views,
+                                          const SceneData &scene, const Ren::Mat4f &clip_from_identity,
+                                          SWcull_ctx *cull_ctx, const uint32_t cull_views_mask) {
+    OPTICK_EVENT();
+
+    for (const GatherView &v : views) {
+        for (auto it = v.out_visible_objects->begin(); it != v.out_visible_objects->end(); ++it) {
+            it->val.objects.clear();
+            it->val.count = 0;
+        }
+        for (const ObjArchetype &arch : scene.archetypes.archetypes()) {
+            VisObjStorage &s = (*v.out_visible_objects)[arch.comp_mask & v.comp_mask];
+            s.objects.resize(s.objects.size() + arch.objects.size());
+        }
+    }
+
+    // occlusion test is done from the position of the first view that requests it
+    Ren::Vec3f cull_cam_pos;
+    for (int i = 0; i < int(views.size()); ++i) {
+        if (cull_views_mask & (1u << i)) {
+            cull_cam_pos = views[i].cam_pos;
+            break;
+        }
+    }
+
+    // Split hierarchy into subtrees, that are traversed in parallel (all views at once)
+    const int SubtreesPerThread = 4;
+    const size_t target_count = size_t(SubtreesPerThread) * (threads_.workers_count() + 1);
+
+    temp_subtree_roots_.clear();
+    temp_subtree_roots_.push_back({scene.root_node, (1u << frustums.frustums_count) - 1, 0});
+    bool split = true;
+    while (split && temp_subtree_roots_.size() < target_count) {
+        split = false;
+        for (size_t i = 0, count = temp_subtree_roots_.size(); i < count && temp_subtree_roots_.size() < target_count;
+             ++i) {
+            GatherSubtree &subtree = temp_subtree_roots_[i];
+            const bvh_node_t &n = scene.nodes[subtree.index];
+            if (n.leaf_node || !subtree.visible_mask) {
+                continue;
+            }
+            // nodes above subtree roots are not visited by jobs, so they are tested here
+            uint32_t full_mask = subtree.full_mask;
+            const uint32_t visible_mask =
+                CheckBoxVisibility(frustums, n.bbox_min, n.bbox_max, cull_cam_pos, clip_from_identity, cull_ctx,
+                                   cull_views_mask, subtree.visible_mask, full_mask);
+            if (!visible_mask) {
+                subtree.visible_mask = 0;
+                continue;
+            }
+            subtree = {n.left_child, visible_mask, full_mask};
+            temp_subtree_roots_.push_back({n.right_child, visible_mask, full_mask});
+            split = true;
+        }
+        // remove culled subtrees
+        temp_subtree_roots_.erase(std::remove_if(temp_subtree_roots_.begin(), temp_subtree_roots_.end(),
+                                                 [](const GatherSubtree &s) { return s.visible_mask == 0; }),
+                                  temp_subtree_roots_.end());
+    }
+
+    threads_.ParallelFor(0, int(temp_subtree_roots_.size()), [&](const int i) {
+        GatherObjectsForViews_Job(frustums, views, scene, temp_subtree_roots_[i], cull_cam_pos, clip_from_identity,
+                                  cull_ctx, cull_views_mask);
+    });
+}
+
+uint32_t Eng::Renderer::CheckBoxVisibility(const Ren::PackedFrustums &frustums, const Ren::Vec3f &bbox_min,
+                                           const Ren::Vec3f &bbox_max, const Ren::Vec3f &cull_cam_pos,
+                                           const Ren::Mat4f &clip_from_identity, SWcull_ctx *cull_ctx,
+                                           const uint32_t cull_views_mask, uint32_t visible_mask,
+                                           uint32_t &inout_full_mask) {
+    using namespace RendererInternal;
+
+    if (visible_mask & ~inout_full_mask) {
+        uint32_t tested_full_mask = 0;
+        visible_mask &= (frustums.CheckVisibility(bbox_min, bbox_max, tested_full_mask) | inout_full_mask);
+        inout_full_mask |= (tested_full_mask & visible_mask);
+    }
+
+    if (cull_ctx && (visible_mask & cull_views_mask)) {
+        // do not question visibility of the box in which we are inside
+        if (cull_cam_pos[0] < bbox_min[0] - 0.5f || cull_cam_pos[1] < bbox_min[1] - 0.5f ||
+            cull_cam_pos[2] < bbox_min[2] - 0.5f || cull_cam_pos[0] > bbox_max[0] + 0.5f ||
+            cull_cam_pos[1] > bbox_max[1] + 0.5f || cull_cam_pos[2] > bbox_max[2] + 0.5f) {
+            const float bbox_points[8][3] = {BBOX_POINTS(bbox_min, bbox_max)};
+
+            SWcull_surf surf;
+
+            surf.type = SW_OCCLUDEE;
+            surf.prim_type = SW_TRIANGLES;
+            surf.index_type = SW_UNSIGNED_INT;
+            surf.attribs = &bbox_points[0][0];
+            surf.indices = &bbox_indices[0];
+            surf.stride = 3 * sizeof(float);
+            surf.count = 36;
+            surf.xform = ValuePtr(clip_from_identity);
+
+            swCullCtxSubmitCullSurfs(cull_ctx, &surf, 1);
+
+            if (surf.visible == 0) {
+                visible_mask &= ~cull_views_mask;
+            }
+        }
+    }
+
+    return visible_mask;
+}
+
+void Eng::Renderer::GatherObjectsForViews_Job(const Ren::PackedFrustums &frustums, Ren::Span<const GatherView> views,
+                                              const SceneData &scene, const GatherSubtree &subtree,
+                                              const Ren::Vec3f &cull_cam_pos, const Ren::Mat4f &clip_from_identity,
+                                              SWcull_ctx *cull_ctx, const uint32_t cull_views_mask) {
     using namespace RendererInternal;
     using namespace Ren;
 
     OPTICK_EVENT();
 
+    assert(int(views.size()) == frustums.frustums_count);
+
     // retrieve pointers to components for fast access
     const auto *transforms = (Transform *)scene.comp_store[CompTransform]->SequentialData();
 
-    uint32_t stack[MAX_STACK_SIZE];
+    struct {
+        uint32_t index;
+        uint32_t visible_mask; // views from which node is (at least partially) visible
+        uint32_t full_mask;    // views from which node is fully visible (frustum check is skipped)
+    } stack[MAX_STACK_SIZE];
     uint32_t stack_size = 0;
 
     // Gather meshes and lights, skip occluded and frustum culled
-    stack_size = 0;
-    stack[stack_size++] = scene.root_node;
+    stack[stack_size++] = {subtree.index, subtree.visible_mask, subtree.full_mask};
 
     while (stack_size) {
-        const uint32_t cur = stack[--stack_size] & IndexBits;
-        uint32_t skip_frustum_check = stack[stack_size] & SkipFrustumCheckBit;
-        const bvh_node_t *n = &scene.nodes[cur];
-
-        const float bbox_points[8][3] = {BBOX_POINTS(n->bbox_min, n->bbox_max)};
-        eVisResult cam_visibility = eVisResult::PartiallyVisible;
-        if (!skip_frustum_check) {
-            cam_visibility = frustum.CheckVisibility(bbox_points);
-            if (cam_visibility == eVisResult::FullyVisible) {
-                skip_frustum_check = SkipFrustumCheckBit;
-            }
-        }
-
-        if (cull_ctx && cam_visibility != eVisResult::Invisible) {
-            // do not question visibility of the node in which we are inside
-            if (cam_pos[0] < n->bbox_min[0] - 0.5f || cam_pos[1] < n->bbox_min[1] - 0.5f ||
-                cam_pos[2] < n->bbox_min[2] - 0.5f || cam_pos[0] > n->bbox_max[0] + 0.5f ||
-                cam_pos[1] > n->bbox_max[1] + 0.5f || cam_pos[2] > n->bbox_max[2] + 0.5f) {
-                SWcull_surf surf;
-
-                surf.type = SW_OCCLUDEE;
-                surf.prim_type = SW_TRIANGLES;
-                surf.index_type = SW_UNSIGNED_INT;
-                surf.attribs = &bbox_points[0][0];
-                surf.indices = &bbox_indices[0];
-                surf.stride = 3 * sizeof(float);
-                surf.count = 36;
-                surf.xform = ValuePtr(clip_from_identity);
-
-                swCullCtxSubmitCullSurfs(cull_ctx, &surf, 1);
-
-                if (surf.visible == 0) {
-                    cam_visibility = eVisResult::Invisible;
-                }
-            }
-        }
-
-        if (cam_visibility == eVisResult::Invisible) {
+        const auto cur = stack[--stack_size];
+        const bvh_node_t *n = &scene.nodes[cur.index];
+
+        uint32_t full_mask = cur.full_mask;
+        uint32_t visible_mask = CheckBoxVisibility(frustums, n->bbox_min, n->bbox_max, cull_cam_pos,
+                                                   clip_from_identity, cull_ctx, cull_views_mask, cur.visible_mask,
+                                                   full_mask);
+        if (!visible_mask) {
             continue;
         }
 
         if (!n->leaf_node) {
-            stack[stack_size++] = skip_frustum_check | n->left_child;
-            stack[stack_size++] = skip_frustum_check | n->right_child;
+            stack[stack_size++] = {n->left_child, visible_mask, full_mask};
+            stack[stack_size++] = {n->right_child, visible_mask, full_mask};
         } else {
             const SceneObject &obj = scene.objects[n->prim_index];
 
-            if (obj.comp_mask & comp_mask) {
-                const Transform &tr = transforms[obj.components[CompTransform]];
+            // skip views that are not interested in this object
+            for (int i = 0; i < int(views.size()); ++i) {
+                if ((obj.comp_mask & views[i].comp_mask) == 0) {
+                    visible_mask &= ~(1u << i);
+                }
+            }
+            if (!visible_mask) {
+                continue;
+            }
 
-                const float bbox_points[8][3] = {BBOX_POINTS(tr.bbox_min_ws, tr.bbox_max_ws)};
+            const Transform &tr = transforms[obj.components[CompTransform]];
 
-                if (!skip_frustum_check) {
-                    // Node has slightly enlarged bounds, so we need to check object's bounding box here
-                    cam_visibility = frustum.CheckVisibility(bbox_points);
-                    if (cam_visibility == eVisResult::Invisible) {
-                        continue;
-                    }
-                }
+            // Node has slightly enlarged bounds, so we need to check object's bounding box here
+            visible_mask = CheckBoxVisibility(frustums, tr.bbox_min_ws, tr.bbox_max_ws, cull_cam_pos,
+                                              clip_from_identity, cull_ctx, cull_views_mask, visible_mask, full_mask);
 
-                if (cull_ctx && cam_visibility != eVisResult::Invisible) {
-                    // do not question visibility of the object in which we are inside
-                    if (cam_pos[0] < tr.bbox_min_ws[0] - 0.5f || cam_pos[1] < tr.bbox_min_ws[1] - 0.5f ||
-                        cam_pos[2] < tr.bbox_min_ws[2] - 0.5f || cam_pos[0] > tr.bbox_max_ws[0] + 0.5f ||
-                        cam_pos[1] > tr.bbox_max_ws[1] + 0.5f || cam_pos[2] > tr.bbox_max_ws[2] + 0.5f) {
-                        SWcull_surf surf;
-
-                        surf.type = SW_OCCLUDEE;
-                        surf.prim_type = SW_TRIANGLES;
-                        surf.index_type = SW_UNSIGNED_INT;
-                        surf.attribs = &bbox_points[0][0];
-                        surf.indices = &bbox_indices[0];
-                        surf.stride = 3 * sizeof(float);
-                        surf.count = 36;
-                        surf.xform = ValuePtr(clip_from_identity);
-
-                        swCullCtxSubmitCullSurfs(cull_ctx, &surf, 1);
-
-                        if (surf.visible == 0) {
-                            cam_visibility = eVisResult::Invisible;
-                        }
-                    }
-                }
+            // each object is reached only once per traversal, so no synchronization beyond the counter is needed
+            for (int i = 0; i < int(views.size()) && visible_mask; ++i) {
+                if (visible_mask & (1u << i)) {
+                    visible_mask &= ~(1u << i);
 
-                if (cam_visibility != eVisResult::Invisible) {
-                    const uint8_t mask = proc_objects[n->prim_index].visited_mask.fetch_and(~visit_mask);
-                    if (mask & visit_mask) {
-                        VisObjStorage &s = out_visible_objects2[obj.comp_mask & comp_mask];
-                        const uint32_t index2 = s.count.fetch_add(1);
-                        s.objects[index2] = {n->prim_index,
-                                             Distance2(cam_pos, 0.5f * (tr.bbox_max_ws + tr.bbox_min_ws))};
-                    }
+                    VisObjStorage &s = (*views[i].out_visible_objects)[obj.comp_mask & views[i].comp_mask];
+                    const uint32_t index2 = s.count.fetch_add(1);
+                    s.objects[index2] = {n->prim_index,
+                                         Distance2(views[i].cam_pos, 0.5f * (tr.bbox_max_ws + tr.bbox_min_ws))};
                 }
             }
         }
@@ -2561,6 +2667,22 @@ void RendererInternal::__record_textures(std::vector<Eng::TexEntry> &storage, co
     }
 }
 
+void RendererInternal::__merge_textures(std::vector<Eng::TexEntry> &storage,
+                                        Ren::Span<const Eng::TexEntry> entries) {
+    // both lists are sorted, so search range shrinks as we go
+    auto entry = storage.begin();
+    for (const Eng::TexEntry &e : entries) {
+        entry = std::lower_bound(entry, storage.end(), e.index,
+                                 [](const Eng::TexEntry &t1, const uint32_t t2) { return t1.index < t2; });
+        if (entry == storage.end() || entry->index != e.index) {
+            entry = storage.insert(entry, {e.index});
+        }
+
+        entry->prio = e.prio;
+        entry->cam_dist = std::min(entry->cam_dist, e.cam_dist);
+    }
+}
+
 #undef BBOX_POINTS
 #undef _CROSS
 
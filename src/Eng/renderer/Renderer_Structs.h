@@ -340,6 +340,8 @@ struct FrontendInfo {
     uint64_t start_timepoint_us = 0, end_timepoint_us = 0;
     uint32_t occluders_time_us = 0, main_gather_time_us = 0, shadow_gather_time_us = 0, drawables_sort_time_us = 0,
              items_assignment_time_us = 0;
+    uint32_t bvh_update_time_us = 0, bvh_rebuild_time_us = 0, bvh_rebuilds_count = 0;
+    float bvh_quality = 1.0f; // SAH cost of freshly built hierarchy divided by current one
 };
 
 struct pass_info_t {
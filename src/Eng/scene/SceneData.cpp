@@ -1,10 +1,39 @@
 #include "SceneData.h"
 
+#include <algorithm>
+
 #if defined(REN_VK_BACKEND)
 #include <Ren/DescriptorPool.h>
 #include <Ren/VKCtx.h>
 #endif
 
+const Eng::ObjArchetype *Eng::ObjArchetypeStorage::Find(const uint32_t comp_mask) const {
+    // number of archetypes is small, linear search is fine
+    for (const ObjArchetype &arch : archetypes_) {
+        if (arch.comp_mask == comp_mask) {
+            return &arch;
+        }
+    }
+    return nullptr;
+}
+
+void Eng::ObjArchetypeStorage::Insert(const uint32_t obj_index, const SceneObject &obj) {
+    auto it = std::find_if(begin(archetypes_), end(archetypes_),
+                           [&obj](const ObjArchetype &arch) { return arch.comp_mask == obj.comp_mask; });
+    if (it == end(archetypes_)) {
+        it = archetypes_.emplace(it);
+        it->comp_mask = obj.comp_mask;
+    }
+
+    ObjArchetype &arch = *it;
+    arch.objects.push_back(obj_index);
+    for (int i = 0; i < MAX_COMPONENT_TYPES; ++i) {
+        if (obj.comp_mask & (1u << i)) {
+            arch.components[i].push_back(obj.components[i]);
+        }
+    }
+}
+
 Eng::PersistentGpuData::PersistentGpuData() = default;
 
 Eng::PersistentGpuData::~PersistentGpuData() { Release(); }
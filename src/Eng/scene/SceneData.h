@@ -76,6 +76,34 @@ struct SceneObject {
 };
 // static_assert(sizeof(SceneObject) == 156 + 4, "!");
 
+// Objects with the same set of components, indices of their components are kept in dense columns
+struct ObjArchetype {
+    uint32_t comp_mask = 0;
+    std::vector<uint32_t> objects;
+    std::vector<uint32_t> components[MAX_COMPONENT_TYPES]; // only columns from comp_mask are used
+};
+
+// Groups objects by comp_mask, so objects with specific components can be iterated without touching SceneObject
+class ObjArchetypeStorage {
+    std::vector<ObjArchetype> archetypes_;
+
+  public:
+    [[nodiscard]] Ren::Span<const ObjArchetype> archetypes() const { return archetypes_; }
+    [[nodiscard]] const ObjArchetype *Find(uint32_t comp_mask) const;
+
+    void Insert(uint32_t obj_index, const SceneObject &obj);
+    void Clear() { archetypes_.clear(); }
+
+    // Calls func(const ObjArchetype &) for each archetype that has all components from comp_mask
+    template <typename F> void ForEach(const uint32_t comp_mask, F &&func) const {
+        for (const ObjArchetype &arch : archetypes_) {
+            if ((arch.comp_mask & comp_mask) == comp_mask && !arch.objects.empty()) {
+                func(arch);
+            }
+        }
+    }
+};
+
 struct bvh_node_t { // NOLINT
     Ren::Vec3f bbox_min;
     union {
@@ -103,6 +131,18 @@ struct bvh_node_t { // NOLINT
 };
 static_assert(sizeof(bvh_node_t) == 36, "!");
 
+enum class eBVHUpdateMode {
+    Reinsert, // moved objects are removed and reinserted into hierarchy
+    Refit     // node bounds are refitted, hierarchy is rebuilt in background when quality degrades
+};
+
+struct bvh_stats_t {
+    uint32_t update_time_us = 0, rebuild_time_us = 0;
+    uint32_t rebuilds_count = 0;
+    // SAH cost of current hierarchy and of the hierarchy right after (re)build
+    float cost = 0.0f, built_cost = 0.0f;
+};
+
 struct mesh_t {
     uint32_t node_index, node_count;
     uint32_t tris_index, tris_count;
@@ -278,11 +318,12 @@ struct SceneData {
 
     std::vector<SceneObject> objects;
     Ren::HashMap32<Ren::String, uint32_t> name_to_object;
-    Ren::HashMap32<uint32_t, uint32_t> object_counts;
+    ObjArchetypeStorage archetypes;
 
     std::vector<bvh_node_t> nodes;
     std::vector<uint32_t> free_nodes;
     uint32_t root_node = 0xffffffff;
+    bvh_stats_t bvh_stats;
 
     uint32_t update_counter = 0;
 };
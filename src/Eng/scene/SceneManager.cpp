@@ -1,5 +1,6 @@
 #include "SceneManager.h"
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <functional>
@@ -411,12 +412,7 @@ void Eng::SceneManager::LoadScene(const Sys::JsObjectP &js_scene, const Ren::Bit
             scene_data_.name_to_object[obj.name] = uint32_t(scene_data_.objects.size() - 1);
         }
 
-        uint32_t *count = scene_data_.object_counts.Find(obj.comp_mask);
-        if (count) {
-            ++(*count);
-        } else {
-            scene_data_.object_counts.Insert(obj.comp_mask, 1);
-        }
+        scene_data_.archetypes.Insert(uint32_t(scene_data_.objects.size() - 1), obj);
     }
 
     if (js_scene.Has("environment")) {
@@ -599,6 +595,11 @@ void Eng::SceneManager::SaveScene(Sys::JsObjectP &js_scene) {
 void Eng::SceneManager::ClearScene() {
     using namespace SceneManagerInternal;
 
+    if (bvh_rebuild_.done.valid()) {
+        bvh_rebuild_.done.wait();
+        bvh_rebuild_.done = {};
+    }
+
     scene_data_.name = {};
 
     for (auto &obj : scene_data_.objects) {
@@ -625,10 +626,13 @@ void Eng::SceneManager::ClearScene() {
 
     scene_data_.objects.clear();
     scene_data_.name_to_object.clear();
+    scene_data_.archetypes.Clear();
     scene_data_.lm_splitter.Clear();
     // scene_data_.probe_storage.Clear();
     scene_data_.nodes.clear();
     scene_data_.free_nodes.clear();
+    scene_data_.root_node = 0xffffffff;
+    scene_data_.bvh_stats = {};
     scene_data_.update_counter = 0;
 
     for (auto &range : scene_data_.mat_update_ranges) {
@@ -811,16 +815,17 @@ void Eng::SceneManager::LoadMeshBuffers() {
     auto *drawables = (Eng::Drawable *)scene_data_.comp_store[Eng::CompDrawable]->SequentialData();
     auto *acc_structs = (Eng::AccStructure *)scene_data_.comp_store[Eng::CompAccStructure]->SequentialData();
 
-    for (const Eng::SceneObject &obj : scene_data_.objects) {
-        if (bool(obj.comp_mask & Eng::CompDrawableBit)) {
-            Eng::Drawable &dr = drawables[obj.components[Eng::CompDrawable]];
-            Ren::Mesh *mesh = dr.mesh.get();
+    scene_data_.archetypes.ForEach(Eng::CompDrawableBit, [&](const Eng::ObjArchetype &arch) {
+        for (const uint32_t i : arch.components[Eng::CompDrawable]) {
+            Ren::Mesh *mesh = drawables[i].mesh.get();
             assert(mesh->type() == Ren::eMeshType::Simple);
             mesh->InitBufferData(ren_ctx_.api_ctx(), scene_data_.persistent_data.vertex_buf1,
                                  scene_data_.persistent_data.vertex_buf2, scene_data_.persistent_data.indices_buf);
         }
-        if (bool(obj.comp_mask & Eng::CompAccStructureBit)) {
-            Eng::AccStructure &acc = acc_structs[obj.components[Eng::CompAccStructure]];
+    });
+    scene_data_.archetypes.ForEach(Eng::CompAccStructureBit, [&](const Eng::ObjArchetype &arch) {
+        for (const uint32_t i : arch.components[Eng::CompAccStructure]) {
+            Eng::AccStructure &acc = acc_structs[i];
             Ren::Mesh *mesh = acc.mesh.get();
             assert(mesh->type() == Ren::eMeshType::Simple);
             mesh->InitBufferData(ren_ctx_.api_ctx(), scene_data_.persistent_data.vertex_buf1,
@@ -831,23 +836,23 @@ void Eng::SceneManager::LoadMeshBuffers() {
                 mesh->blas = Build_SWRT_BLAS(acc);
             }
         }
-    }
+    });
 }
 
 void Eng::SceneManager::ReleaseMeshBuffers(const bool immediate) {
     auto *drawables = (Eng::Drawable *)scene_data_.comp_store[Eng::CompDrawable]->SequentialData();
     auto *acc_structs = (Eng::AccStructure *)scene_data_.comp_store[Eng::CompAccStructure]->SequentialData();
 
-    for (const Eng::SceneObject &obj : scene_data_.objects) {
-        if (bool(obj.comp_mask & Eng::CompDrawableBit)) {
-            Eng::Drawable &dr = drawables[obj.components[Eng::CompDrawable]];
-            Ren::Mesh *mesh = dr.mesh.get();
+    scene_data_.archetypes.ForEach(Eng::CompDrawableBit, [&](const Eng::ObjArchetype &arch) {
+        for (const uint32_t i : arch.components[Eng::CompDrawable]) {
+            Ren::Mesh *mesh = drawables[i].mesh.get();
             assert(mesh->type() == Ren::eMeshType::Simple);
             mesh->ReleaseBufferData();
         }
-        if (bool(obj.comp_mask & Eng::CompAccStructureBit)) {
-            Eng::AccStructure &acc = acc_structs[obj.components[Eng::CompAccStructure]];
-            Ren::Mesh *mesh = acc.mesh.get();
+    });
+    scene_data_.archetypes.ForEach(Eng::CompAccStructureBit, [&](const Eng::ObjArchetype &arch) {
+        for (const uint32_t i : arch.components[Eng::CompAccStructure]) {
+            Ren::Mesh *mesh = acc_structs[i].mesh.get();
             assert(mesh->type() == Ren::eMeshType::Simple);
             mesh->ReleaseBufferData();
             if (immediate && mesh->blas) {
@@ -855,7 +860,7 @@ void Eng::SceneManager::ReleaseMeshBuffers(const bool immediate) {
             }
             mesh->blas = {};
         }
-    }
+    });
 
     if (immediate) {
         for (Ren::BufferRef &b : scene_data_.persistent_data.hwrt.rt_blas_buffers) {
@@ -1759,48 +1764,68 @@ bool Eng::SceneManager::UpdateInstanceBuffer() {
 }
 
 void Eng::SceneManager::UpdateInstanceBufferRange(const uint32_t obj_beg, const uint32_t obj_end) {
-    using namespace SceneManagerInternal;
-
-    const auto *transforms = (Transform *)scene_data_.comp_store[CompTransform]->SequentialData();
-    const auto *drawables = (Drawable *)scene_data_.comp_store[CompDrawable]->SequentialData();
-    const auto *lightmaps = (Lightmap *)scene_data_.comp_store[CompLightmap]->SequentialData();
-    const auto *vegs = (VegState *)scene_data_.comp_store[CompVegState]->SequentialData();
-
     const uint32_t total_data_to_update = sizeof(InstanceData) * (obj_end - obj_beg + 1);
     Ren::BufferRef temp_stage_buf =
         ren_ctx_.LoadBuffer("Instance Update Stage Buf", Ren::eBufType::Upload, total_data_to_update);
     auto *instance_stage = (InstanceData *)temp_stage_buf->Map();
 
-    for (uint32_t i = obj_beg; i <= obj_end; ++i) {
-        SceneObject &obj = scene_data_.objects[i];
-        assert(obj.comp_mask & CompTransformBit);
+    FillInstanceData(scene_data_, obj_beg, obj_end, instance_stage);
 
-        const Transform &tr = transforms[obj.components[CompTransform]];
-        const Ren::Mat4f world_from_object_trans = Transpose(tr.world_from_object);
-        const Ren::Mat4f prev_world_from_object_trans = Transpose(tr.world_from_object_prev);
+    temp_stage_buf->Unmap();
 
-        InstanceData &instance = instance_stage[i - obj_beg];
-        memcpy(&instance.model_matrix[0][0], ValuePtr(world_from_object_trans), 12 * sizeof(float));
-        memcpy(&instance.prev_model_matrix[0][0], ValuePtr(prev_world_from_object_trans), 12 * sizeof(float));
+    scene_data_.persistent_data.instance_buf->UpdateSubRegion(obj_beg * sizeof(InstanceData), total_data_to_update,
+                                                              *temp_stage_buf, 0, ren_ctx_.current_cmd_buf());
+}
 
-        if (obj.comp_mask & CompDrawableBit) {
-            const Drawable &dr = drawables[obj.components[CompDrawable]];
-            instance.vis_mask = uint8_t(dr.vis_mask);
-        }
+void Eng::SceneManager::FillInstanceData(const SceneData &scene, const uint32_t obj_beg, const uint32_t obj_end,
+                                         InstanceData out_instances[]) {
+    using namespace SceneManagerInternal;
 
-        if (obj.comp_mask & CompLightmapBit) {
-            const Lightmap &lm = lightmaps[obj.components[CompLightmap]];
-            memcpy(&instance.lmap_transform[0], ValuePtr(lm.xform), 4 * sizeof(float));
-        } else if (obj.comp_mask & CompVegStateBit) {
-            const VegState &vs = vegs[obj.components[CompVegState]];
-            __init_wind_params(vs, scene_data_.env, tr.object_from_world, instance);
-        }
-    }
+    const auto *transforms = (const Transform *)scene.comp_store[CompTransform]->SequentialData();
+    const auto *drawables = (const Drawable *)scene.comp_store[CompDrawable]->SequentialData();
+    const auto *lightmaps = (const Lightmap *)scene.comp_store[CompLightmap]->SequentialData();
+    const auto *vegs = (const VegState *)scene.comp_store[CompVegState]->SequentialData();
 
-    temp_stage_buf->Unmap();
+    [[maybe_unused]] uint32_t written_count = 0;
 
-    scene_data_.persistent_data.instance_buf->UpdateSubRegion(obj_beg * sizeof(InstanceData), total_data_to_update,
-                                                              *temp_stage_buf, 0, ren_ctx_.current_cmd_buf());
+    scene.archetypes.ForEach(CompTransformBit, [&](const ObjArchetype &arch) {
+        // objects are added in index order, so indices within archetype are sorted
+        const auto first = std::lower_bound(begin(arch.objects), end(arch.objects), obj_beg);
+        const auto last = std::upper_bound(first, end(arch.objects), obj_end);
+
+        const bool has_drawable = (arch.comp_mask & CompDrawableBit) != 0;
+        const bool has_lightmap = (arch.comp_mask & CompLightmapBit) != 0;
+        const bool has_veg_state = (arch.comp_mask & CompVegStateBit) != 0;
+
+        for (auto it = first; it != last; ++it) {
+            const size_t j = size_t(it - begin(arch.objects));
+
+            const Transform &tr = transforms[arch.components[CompTransform][j]];
+            const Ren::Mat4f world_from_object_trans = Transpose(tr.world_from_object);
+            const Ren::Mat4f prev_world_from_object_trans = Transpose(tr.world_from_object_prev);
+
+            InstanceData &instance = out_instances[*it - obj_beg];
+            memcpy(&instance.model_matrix[0][0], ValuePtr(world_from_object_trans), 12 * sizeof(float));
+            memcpy(&instance.prev_model_matrix[0][0], ValuePtr(prev_world_from_object_trans), 12 * sizeof(float));
+
+            if (has_drawable) {
+                const Drawable &dr = drawables[arch.components[CompDrawable][j]];
+                instance.vis_mask = uint8_t(dr.vis_mask);
+            }
+
+            if (has_lightmap) {
+                const Lightmap &lm = lightmaps[arch.components[CompLightmap][j]];
+                memcpy(&instance.lmap_transform[0], ValuePtr(lm.xform), 4 * sizeof(float));
+            } else if (has_veg_state) {
+                const VegState &vs = vegs[arch.components[CompVegState][j]];
+                __init_wind_params(vs, scene.env, tr.object_from_world, instance);
+            }
+        }
+        written_count += uint32_t(last - first);
+    });
+
+    // every object in range is expected to have transform
+    assert(written_count == obj_end - obj_beg + 1);
 }
 
 void Eng::SceneManager::ClearGICache(Ren::CommandBuffer _cmd_buf) {
@@ -2,6 +2,7 @@
 
 #include <condition_variable>
 #include <deque>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -83,6 +84,7 @@ struct assets_context_t {
     std::unique_ptr<SceneManagerInternal::AssetCache> cache;
     Sys::MultiPoolAllocator<char> *mp_alloc;
     Sys::ThreadPool *p_threads;
+    Sys::ThreadPool *p_tex_threads;
     Sys::DynLib spirv_compiler;
     std::mutex cache_mtx;
 };
@@ -115,6 +117,9 @@ class SceneManager {
 
     void set_load_flags(const Ren::Bitmask<eSceneLoadFlags> load_flags) { scene_data_.load_flags = load_flags; }
 
+    eBVHUpdateMode bvh_update_mode() const { return bvh_update_mode_; }
+    void set_bvh_update_mode(eBVHUpdateMode mode);
+
     Eng::SceneObject *GetObject(const uint32_t i) { return &scene_data_.objects[i]; }
 
     uint32_t FindObject(std::string_view name) {
@@ -195,6 +200,20 @@ class SceneManager {
     static bool WriteProbeCache(const char *out_folder, const char *scene_name, const Ren::ProbeStorage &probes,
                                 const Eng::CompStorage *light_probe_storage, Ren::ILog *log);
 
+    // Writes instance data of objects [obj_beg, obj_end] (all of them must have transform component)
+    static void FillInstanceData(const SceneData &scene, uint32_t obj_beg, uint32_t obj_end,
+                                 InstanceData out_instances[]);
+
+    static void BuildSceneBVH(Ren::Span<const Phy::prim_t> prims, Ren::Span<const uint32_t> prim_objects,
+                              std::vector<bvh_node_t> &out_nodes);
+    static double CalcSceneBVHAreaSum(Ren::Span<const bvh_node_t> nodes, uint32_t root_node);
+    // Refits parents of (already updated) leaves, returns change of nodes surface area sum
+    static double RefitSceneBVH(Ren::Span<bvh_node_t> nodes, Ren::Span<const uint32_t> leaf_nodes);
+    // Refits all interior nodes of freshly built hierarchy
+    static void RefitSceneBVH(Ren::Span<bvh_node_t> nodes);
+    // Checks if refitted hierarchy degraded enough to be rebuilt
+    static bool NeedsSceneBVHRebuild(const bvh_stats_t &stats);
+
   private:
     void PostloadDrawable(const Sys::JsObjectP &js_comp_obj, void *comp, Ren::Vec3f obj_bbox[2]);
     void PostloadOccluder(const Sys::JsObjectP &js_comp_obj, void *comp, Ren::Vec3f obj_bbox[2]);
@@ -241,6 +260,8 @@ class SceneManager {
 
     void RebuildSceneBVH();
     void RemoveNode(uint32_t node_index);
+    void StartSceneBVHRebuild();
+    bool FinishSceneBVHRebuild(bool wait);
 
     Ren::Context &ren_ctx_;
     Eng::ShaderLoader &sh_;
@@ -259,6 +280,16 @@ class SceneManager {
     std::vector<uint32_t> changed_objects_, last_changed_objects_;
     std::vector<uint32_t> instance_data_to_update_;
 
+    eBVHUpdateMode bvh_update_mode_ = eBVHUpdateMode::Reinsert;
+    std::vector<uint32_t> bvh_refit_leaves_;
+    double bvh_area_sum_ = 0.0; // sum of node surface areas (refit mode only)
+
+    struct {
+        std::future<void> done;
+        std::vector<bvh_node_t> nodes;
+        uint32_t time_us = 0;
+    } bvh_rebuild_;
+
     std::unique_ptr<Eng::CompStorage> default_comp_storage_[Eng::MAX_COMPONENT_TYPES];
     std::function<PostLoadFunc> component_post_load_[Eng::MAX_COMPONENT_TYPES];
 
@@ -311,6 +342,7 @@ class SceneManager {
                                      uint32_t parent_index, std::vector<gpu_light_cwbvh_node_t> &out_nodes);
     static uint32_t ConvertToBVH2(Ren::Span<const gpu_bvh_node_t> nodes, std::vector<gpu_bvh2_node_t> &out_nodes);
 
+
     std::vector<char> temp_buf;
 
     // bool cur_lm_indir_ = false;
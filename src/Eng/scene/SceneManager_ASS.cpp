@@ -434,10 +434,16 @@ void LoadDB(const char *out_folder, Sys::JsObjectP &out_js_assets_db) {
 
     int i = 0;
     for (; i < 3; i++) {
-        std::ifstream in_file(file_names[i], std::ios::binary);
+        std::ifstream in_file(file_names[i], std::ios::binary | std::ios::ate);
         if (in_file) {
+            const size_t in_file_size = size_t(in_file.tellg());
+            in_file.seekg(0, std::ios::beg);
+
+            std::string in_file_data(in_file_size, '\0');
+            in_file.read(&in_file_data[0], in_file_size);
+
             try {
-                if (out_js_assets_db.Read(in_file)) {
+                if (out_js_assets_db.Read(in_file_data)) {
                     if (!out_js_assets_db.Has("version")) {
                         out_js_assets_db.elements.clear();
                     } else {
@@ -891,6 +897,9 @@ bool Eng::SceneManager::PrepareAssets(const char *in_folder, const char *out_fol
     // Sys::ThreadPool additional_threads(8);
     // ctx.p_threads = &additional_threads;
 
+    // NOTE: texture compression is split into light tasks, which are safe to wait for from inside of worker thread
+    ctx.p_tex_threads = p_threads;
+
     if (p_threads) {
         std::deque<std::future<void>> events;
         ReadAllFiles_MT_r(ctx, in_folder, convert_file, p_threads, events);
@@ -932,13 +941,18 @@ bool Eng::SceneManager::HConvGLTFToMesh(assets_context_t &ctx, const char *in_fi
 
     ctx.log->Info("Prep %s", out_file);
 
-    std::ifstream src_stream(in_file, std::ios::binary);
+    std::ifstream src_stream(in_file, std::ios::binary | std::ios::ate);
     if (!src_stream) {
         return false;
     }
+    const size_t src_size = size_t(src_stream.tellg());
+    src_stream.seekg(0, std::ios::beg);
+
+    std::string src_data(src_size, '\0');
+    src_stream.read(&src_data[0], src_size);
 
     Sys::JsObject js_gltf;
-    if (!js_gltf.Read(src_stream)) {
+    if (!js_gltf.Read(src_data)) {
         ctx.log->Error("Failed to parse %s", in_file);
         return false;
     }
@@ -1336,14 +1350,20 @@ bool Eng::SceneManager::HPreprocessJson(assets_context_t &ctx, const char *in_fi
 
     ctx.log->Info("Prep %s", out_file);
 
-    std::ifstream src_stream(in_file, std::ios::binary);
+    std::ifstream src_stream(in_file, std::ios::binary | std::ios::ate);
     if (!src_stream) {
         return false;
     }
+    const size_t src_size = size_t(src_stream.tellg());
+    src_stream.seekg(0, std::ios::beg);
+
+    std::string src_data(src_size, '\0');
+    src_stream.read(&src_data[0], src_size);
+
     std::ofstream dst_stream(out_file, std::ios::binary);
 
     Sys::JsElement js_root_el(Sys::JsLiteralType::Null);
-    if (!js_root_el.Read(src_stream)) {
+    if (!js_root_el.Read(src_data)) {
         ctx.log->Error("Failed to parse %s", in_file);
         return false;
     }
@@ -313,7 +313,7 @@ bool Write_RGBM(Ren::Span<const float> data, const int w, const int h, const int
 }
 
 bool Write_DDS_Mips(const uint8_t *const *mipmaps, const int *widths, const int *heights, const int mip_count,
-                    const int channels, const bool use_YCoCg, const char *out_file) {
+                    const int channels, const bool use_YCoCg, const char *out_file, Sys::ThreadPool *p_threads) {
     //
     // Compress mip images
     //
@@ -322,36 +322,67 @@ bool Write_DDS_Mips(const uint8_t *const *mipmaps, const int *widths, const int
 
     const bool use_BC3 = (channels == 4) || use_YCoCg;
 
+    int block_size;
+    if (channels == 1) {
+        block_size = Ren::BlockSize_BC4;
+    } else if (channels == 2) {
+        block_size = Ren::BlockSize_BC5;
+    } else if (!use_BC3) {
+        block_size = Ren::BlockSize_BC1;
+    } else {
+        block_size = Ren::BlockSize_BC3;
+    }
+
+    // Mip levels are split into bands of block rows, which are compressed independently
+    static const int BandBlocksCount = 2048;
+
+    struct band_t {
+        int mip, y, h;
+    };
+    std::vector<band_t> bands;
+
     for (int i = 0; i < mip_count; i++) {
+        const int blocks_w = (widths[i] + 3) / 4;
+        compressed_size[i] = block_size * blocks_w * ((heights[i] + 3) / 4);
+        compressed_data[i] = std::make_unique<uint8_t[]>(compressed_size[i]);
+        compressed_size_total += compressed_size[i];
+
+        const int band_h = 4 * std::max(BandBlocksCount / blocks_w, 1);
+        for (int y = 0; y < heights[i]; y += band_h) {
+            bands.push_back({i, y, std::min(band_h, heights[i] - y)});
+        }
+    }
+
+    auto compress_band = [&](const int band_index) {
+        const band_t &band = bands[band_index];
+        const int w = widths[band.mip];
+
+        const uint8_t *src = mipmaps[band.mip] + band.y * w * channels;
+        uint8_t *dst = compressed_data[band.mip].get() + (band.y / 4) * ((w + 3) / 4) * block_size;
+
         if (channels == 1) {
-            compressed_size[i] = Ren::GetRequiredMemory_BC4(widths[i], heights[i], 1);
-            // NOTE: 1 byte is added due to BC4/BC5 compression write outside of memory block
-            compressed_data[i] = std::make_unique<uint8_t[]>(compressed_size[i] + 1);
-            Ren::CompressImage_BC4(mipmaps[i], widths[i], heights[i], compressed_data[i].get());
+            Ren::CompressImage_BC4(src, w, band.h, dst);
         } else if (channels == 2) {
-            compressed_size[i] = Ren::GetRequiredMemory_BC5(widths[i], heights[i], 1);
-            // NOTE: 1 byte is added due to BC4/BC5 compression write outside of memory block
-            compressed_data[i] = std::make_unique<uint8_t[]>(compressed_size[i] + 1);
-            Ren::CompressImage_BC5(mipmaps[i], widths[i], heights[i], compressed_data[i].get());
+            Ren::CompressImage_BC5(src, w, band.h, dst);
         } else if (channels == 3) {
             if (use_YCoCg) {
-                compressed_size[i] = Ren::GetRequiredMemory_BC3(widths[i], heights[i], 1);
-                compressed_data[i] = std::make_unique<uint8_t[]>(compressed_size[i]);
-                auto temp_YCoCg = Ren::ConvertRGB_to_CoCgxY(mipmaps[i], widths[i], heights[i]);
-                Ren::CompressImage_BC3<true /* Is_YCoCg */>(temp_YCoCg.get(), widths[i], heights[i],
-                                                            compressed_data[i].get());
+                auto temp_YCoCg = Ren::ConvertRGB_to_CoCgxY(src, w, band.h);
+                Ren::CompressImage_BC3<true /* Is_YCoCg */>(temp_YCoCg.get(), w, band.h, dst);
             } else {
-                compressed_size[i] = Ren::GetRequiredMemory_BC1(widths[i], heights[i], 1);
-                compressed_data[i] = std::make_unique<uint8_t[]>(compressed_size[i]);
-                Ren::CompressImage_BC1<3>(mipmaps[i], widths[i], heights[i], compressed_data[i].get());
+                Ren::CompressImage_BC1<3>(src, w, band.h, dst);
             }
         } else {
             assert(channels == 4);
-            compressed_size[i] = Ren::GetRequiredMemory_BC3(widths[i], heights[i], 1);
-            compressed_data[i] = std::make_unique<uint8_t[]>(compressed_size[i]);
-            Ren::CompressImage_BC3(mipmaps[i], widths[i], heights[i], compressed_data[i].get());
+            Ren::CompressImage_BC3(src, w, band.h, dst);
+        }
+    };
+
+    if (p_threads) {
+        p_threads->ParallelFor(0, int(bands.size()), compress_band);
+    } else {
+        for (int i = 0; i < int(bands.size()); i++) {
+            compress_band(i);
         }
-        compressed_size_total += compressed_size[i];
     }
 
     //
@@ -392,7 +423,7 @@ bool Write_DDS_Mips(const uint8_t *const *mipmaps, const int *widths, const int
 }
 
 bool Write_DDS(const uint8_t *image_data, const int w, const int h, const int channels, const bool flip_y,
-               const bool use_YCoCg, const char *out_file, uint8_t out_avg_color[4]) {
+               const bool use_YCoCg, const char *out_file, uint8_t out_avg_color[4], Sys::ThreadPool *p_threads) {
     // Check if resolution is power of two
     const bool store_mipmaps = (unsigned(w) & unsigned(w - 1)) == 0 && (unsigned(h) & unsigned(h - 1)) == 0;
 
@@ -449,7 +480,7 @@ bool Write_DDS(const uint8_t *image_data, const int w, const int h, const int ch
         _mipmaps[i] = mipmaps[i].get();
     }
 
-    return Write_DDS_Mips(_mipmaps, widths, heights, mip_count, channels, use_YCoCg, out_file);
+    return Write_DDS_Mips(_mipmaps, widths, heights, mip_count, channels, use_YCoCg, out_file, p_threads);
 }
 
 bool Write_KTX_DXT(const uint8_t *image_data, const int w, const int h, const int channels, const bool is_rgbm,
@@ -576,7 +607,7 @@ int WriteImage(const uint8_t *out_data, const int w, const int h, const int chan
         }
     } else if (strstr(name, ".dds")) {
         res = 1;
-        Write_DDS(out_data, w, h, channels, flip_y, false, name, nullptr);
+        Write_DDS(out_data, w, h, channels, flip_y, false, name, nullptr, nullptr);
     }
     return res;
 }
@@ -975,8 +1006,8 @@ bool Eng::SceneManager::HConvToDDS(assets_context_t &ctx, const char *in_file, c
     const bool use_YCoCg = (tex.image_type == eImageType::Color);
 
     uint8_t average_color[4] = {};
-    const bool res =
-        Write_DDS(image_data, width, height, channels, false /* flip_y */, use_YCoCg, out_file, average_color);
+    const bool res = Write_DDS(image_data, width, height, channels, false /* flip_y */, use_YCoCg, out_file,
+                               average_color, ctx.p_tex_threads);
     if (res) {
         std::lock_guard<std::mutex> _(ctx.cache_mtx);
         ctx.cache->WriteTextureAverage(in_file, average_color);
@@ -1137,7 +1168,7 @@ bool Eng::SceneManager::HConvImgToDDS(assets_context_t &ctx, const char *in_file
         return false;
     }
 
-    return Write_DDS_Mips(_mipmaps, widths, heights, mips_count, 4, false, out_file);
+    return Write_DDS_Mips(_mipmaps, widths, heights, mips_count, 4, false, out_file, ctx.p_tex_threads);
 }
 
 bool Eng::SceneManager::WriteProbeCache(const char *out_folder, const char *scene_name, const Ren::ProbeStorage &probes,
@@ -7,6 +7,8 @@
 #include <Ren/Context.h>
 #include <Sys/BinaryTree.h>
 #include <Sys/MonoAlloc.h>
+#include <Sys/ThreadPool.h>
+#include <Sys/Time_.h>
 
 #include <optick/optick.h>
 #include <vtune/ittnotify.h>
@@ -15,11 +17,13 @@ extern __itt_domain *__g_itt_domain;
 namespace SceneManagerInternal {
 const float BoundsMargin = 0.2f;
 
-float surface_area(const Eng::bvh_node_t &n) {
-    const Ren::Vec3f d = n.bbox_max - n.bbox_min;
+float surface_area(const Ren::Vec3f &bbox_min, const Ren::Vec3f &bbox_max) {
+    const Ren::Vec3f d = bbox_max - bbox_min;
     return d[0] * d[1] + d[0] * d[2] + d[1] * d[2];
 }
 
+float surface_area(const Eng::bvh_node_t &n) { return surface_area(n.bbox_min, n.bbox_max); }
+
 float surface_area_of_union(const Eng::bvh_node_t &n1, const Eng::bvh_node_t &n2) {
     const Ren::Vec3f d = Max(n1.bbox_max, n2.bbox_max) - Min(n1.bbox_min, n2.bbox_max);
     return d[0] * d[1] + d[0] * d[2] + d[1] * d[2];
@@ -89,6 +93,9 @@ uint32_t EncodeOctDir(const Ren::Vec3f &d) {
 
 Phy::Vec3f adapt(const Ren::Vec3f &v) { return Phy::Vec3f{v[0], v[1], v[2]}; }
 
+// Background rebuild is started when SAH cost grows by this factor after refits
+const float BVHRebuildThreshold = 1.2f;
+
 __itt_string_handle *itt_rebuild_bvh_str = __itt_string_handle_create("SceneManager::RebuildSceneBVH");
 __itt_string_handle *itt_update_bvh_str = __itt_string_handle_create("SceneManager::UpdateBVH");
 } // namespace SceneManagerInternal
@@ -98,24 +105,57 @@ void Eng::SceneManager::RebuildSceneBVH() {
 
     __itt_task_begin(__g_itt_domain, __itt_null, __itt_null, itt_rebuild_bvh_str);
 
+    // drop result of background rebuild (if any), it is outdated
+    if (bvh_rebuild_.done.valid()) {
+        bvh_rebuild_.done.wait();
+        bvh_rebuild_.done = {};
+    }
+
+    const uint64_t t1_us = Sys::GetTimeUs();
+
     auto *transforms = (Transform *)scene_data_.comp_store[CompTransform]->SequentialData();
 
     std::vector<Phy::prim_t> primitives;
+    std::vector<uint32_t> prim_objects;
     primitives.reserve(scene_data_.objects.size());
+    prim_objects.reserve(scene_data_.objects.size());
 
-    for (const SceneObject &obj : scene_data_.objects) {
+    for (uint32_t i = 0; i < uint32_t(scene_data_.objects.size()); ++i) {
+        const SceneObject &obj = scene_data_.objects[i];
         if (obj.comp_mask & CompTransformBit) {
             const Transform &tr = transforms[obj.components[CompTransform]];
             const Ren::Vec3f d = tr.bbox_max_ws - tr.bbox_min_ws;
             primitives.push_back(
                 {0, 0, 0, adapt(tr.bbox_min_ws - BoundsMargin * d), adapt(tr.bbox_max_ws + BoundsMargin * d)});
+            prim_objects.push_back(i);
         }
     }
 
-    scene_data_.nodes.clear();
-    scene_data_.root_node = 0xffffffff;
+    BuildSceneBVH(primitives, prim_objects, scene_data_.nodes);
+    scene_data_.free_nodes.clear();
+    scene_data_.root_node = scene_data_.nodes.empty() ? 0xffffffff : 0;
+
+    for (uint32_t i = 0; i < uint32_t(scene_data_.nodes.size()); ++i) {
+        const bvh_node_t &n = scene_data_.nodes[i];
+        if (n.leaf_node) {
+            transforms[scene_data_.objects[n.prim_index].components[CompTransform]].node_index = i;
+        }
+    }
+
+    bvh_area_sum_ = CalcSceneBVHAreaSum(scene_data_.nodes, scene_data_.root_node);
+
+    bvh_stats_t &stats = scene_data_.bvh_stats;
+    stats.cost = stats.built_cost =
+        scene_data_.nodes.empty() ? 0.0f : float(bvh_area_sum_ / surface_area(scene_data_.nodes[0]));
+    stats.rebuild_time_us = uint32_t(Sys::GetTimeUs() - t1_us);
+
+    __itt_task_end(__g_itt_domain);
+}
 
-    if (primitives.empty()) {
+void Eng::SceneManager::BuildSceneBVH(Ren::Span<const Phy::prim_t> prims, Ren::Span<const uint32_t> prim_objects,
+                                      std::vector<bvh_node_t> &out_nodes) {
+    out_nodes.clear();
+    if (prims.empty()) {
         return;
     }
 
@@ -123,21 +163,22 @@ void Eng::SceneManager::RebuildSceneBVH() {
         std::vector<uint32_t> indices;
         Phy::Vec3f min = Phy::Vec3f{std::numeric_limits<float>::max()},
                    max = Phy::Vec3f{std::numeric_limits<float>::lowest()};
+        uint32_t parent = 0xffffffff;
         prims_coll_t() = default;
-        prims_coll_t(std::vector<uint32_t> &&_indices, const Phy::Vec3f &_min, const Phy::Vec3f &_max)
-            : indices(std::move(_indices)), min(_min), max(_max) {}
+        prims_coll_t(std::vector<uint32_t> &&_indices, const Phy::Vec3f &_min, const Phy::Vec3f &_max,
+                     const uint32_t _parent)
+            : indices(std::move(_indices)), min(_min), max(_max), parent(_parent) {}
     };
 
     std::deque<prims_coll_t> prim_lists;
     prim_lists.emplace_back();
 
-    size_t nodes_count = scene_data_.nodes.size();
-    scene_data_.root_node = uint32_t(nodes_count);
+    size_t nodes_count = 0;
 
-    for (size_t i = 0; i < primitives.size(); i++) {
+    for (size_t i = 0; i < prims.size(); i++) {
         prim_lists.back().indices.push_back(uint32_t(i));
-        prim_lists.back().min = Min(prim_lists.back().min, primitives[i].bbox_min);
-        prim_lists.back().max = Max(prim_lists.back().max, primitives[i].bbox_max);
+        prim_lists.back().min = Min(prim_lists.back().min, prims[i].bbox_min);
+        prim_lists.back().max = Max(prim_lists.back().max, prims[i].bbox_max);
     }
 
     Phy::split_settings_t s;
@@ -145,42 +186,24 @@ void Eng::SceneManager::RebuildSceneBVH() {
     s.min_primitives_in_leaf = 1;
 
     while (!prim_lists.empty()) {
-        Phy::split_data_t split_data = SplitPrimitives_SAH(&primitives[0], prim_lists.back().indices,
+        Phy::split_data_t split_data = SplitPrimitives_SAH(prims.data(), prim_lists.back().indices,
                                                            prim_lists.back().min, prim_lists.back().max, s);
+        // parent is tracked explicitly to avoid searching for it
+        const uint32_t parent_index = prim_lists.back().parent;
         prim_lists.pop_back();
 
-        const auto leaf_index = uint32_t(scene_data_.nodes.size());
-        uint32_t parent_index = 0xffffffff;
-
-        if (leaf_index) {
-            // skip bound checks in debug mode
-            const bvh_node_t *_out_nodes = &scene_data_.nodes[0];
-            for (uint32_t i = leaf_index - 1; i >= scene_data_.root_node; i--) {
-                if (_out_nodes[i].left_child == leaf_index || _out_nodes[i].right_child == leaf_index) {
-                    parent_index = uint32_t(i);
-                    break;
-                }
-            }
-        }
+        const auto node_index = uint32_t(out_nodes.size());
 
         if (split_data.right_indices.empty()) {
             const Phy::Vec3f bbox_min = split_data.left_bounds[0], bbox_max = split_data.left_bounds[1];
 
-            const auto new_node_index = (uint32_t)scene_data_.nodes.size();
-
-            for (const uint32_t i : split_data.left_indices) {
-                Transform &tr = transforms[scene_data_.objects[i].components[CompTransform]];
-                tr.node_index = new_node_index;
-            }
-
             assert(split_data.left_indices.size() == 1 && "Wrong split!");
 
-            scene_data_.nodes.emplace_back();
-            bvh_node_t &n = scene_data_.nodes.back();
+            bvh_node_t &n = out_nodes.emplace_back();
 
             n.bbox_min = Ren::Vec3f{bbox_min[0], bbox_min[1], bbox_min[2]};
             n.leaf_node = 1;
-            n.prim_index = split_data.left_indices[0];
+            n.prim_index = prim_objects[split_data.left_indices[0]];
             n.bbox_max = Ren::Vec3f{bbox_max[0], bbox_max[1], bbox_max[2]};
             n.sep_axis = 0;
             n.prim_count = uint32_t(split_data.left_indices.size());
@@ -199,8 +222,7 @@ void Eng::SceneManager::RebuildSceneBVH() {
             const Phy::Vec3f bbox_min = Min(split_data.left_bounds[0], split_data.right_bounds[0]),
                              bbox_max = Max(split_data.left_bounds[1], split_data.right_bounds[1]);
 
-            scene_data_.nodes.emplace_back();
-            bvh_node_t &n = scene_data_.nodes.back();
+            bvh_node_t &n = out_nodes.emplace_back();
 
             n.bbox_min = Ren::Vec3f{bbox_min[0], bbox_min[1], bbox_min[2]};
             n.leaf_node = 0;
@@ -211,26 +233,116 @@ void Eng::SceneManager::RebuildSceneBVH() {
             n.parent = parent_index;
 
             prim_lists.emplace_front(std::move(split_data.left_indices), split_data.left_bounds[0],
-                                     split_data.left_bounds[1]);
+                                     split_data.left_bounds[1], node_index);
             prim_lists.emplace_front(std::move(split_data.right_indices), split_data.right_bounds[0],
-                                     split_data.right_bounds[1]);
+                                     split_data.right_bounds[1], node_index);
 
             nodes_count += 2;
         }
     }
+}
+
+double Eng::SceneManager::CalcSceneBVHAreaSum(Ren::Span<const bvh_node_t> nodes, const uint32_t root_node) {
+    using namespace SceneManagerInternal;
+
+    if (root_node == 0xffffffff) {
+        return 0.0;
+    }
+
+    double area_sum = 0.0;
+
+    Ren::SmallVector<uint32_t, 128> stack;
+    stack.push_back(root_node);
+    while (!stack.empty()) {
+        const bvh_node_t &n = nodes[stack.back()];
+        stack.pop_back();
+
+        area_sum += surface_area(n);
+        if (!n.leaf_node) {
+            stack.push_back(n.left_child);
+            stack.push_back(n.right_child);
+        }
+    }
+
+    return area_sum;
+}
+
+void Eng::SceneManager::StartSceneBVHRebuild() {
+    using namespace SceneManagerInternal;
+
+    const auto *transforms = (const Transform *)scene_data_.comp_store[CompTransform]->SequentialData();
 
-    /*{   // reorder objects
-        uint32_t j, k;
-        for (uint32_t i = 0; i < (uint32_t)objects_.size(); i++) {
-            while (i != (j = obj_indices[i])) {
-                k = obj_indices[j];
-                std::swap(objects_[j], objects_[k]);
-                std::swap(obj_indices[i], obj_indices[j]);
+    // snapshot of current bounds, tree is built from it in background
+    std::vector<Phy::prim_t> primitives;
+    std::vector<uint32_t> prim_objects;
+    primitives.reserve(scene_data_.objects.size());
+    prim_objects.reserve(scene_data_.objects.size());
+
+    for (uint32_t i = 0; i < uint32_t(scene_data_.objects.size()); ++i) {
+        const SceneObject &obj = scene_data_.objects[i];
+        if (obj.comp_mask & CompTransformBit) {
+            const Transform &tr = transforms[obj.components[CompTransform]];
+            const Ren::Vec3f d = tr.bbox_max_ws - tr.bbox_min_ws;
+            primitives.push_back(
+                {0, 0, 0, adapt(tr.bbox_min_ws - BoundsMargin * d), adapt(tr.bbox_max_ws + BoundsMargin * d)});
+            prim_objects.push_back(i);
+        }
+    }
+
+    bvh_rebuild_.done = threads_.Enqueue(
+        [this, primitives = std::move(primitives), prim_objects = std::move(prim_objects)]() {
+            OPTICK_EVENT("SceneManager::BuildSceneBVH");
+            const uint64_t t1_us = Sys::GetTimeUs();
+            BuildSceneBVH(primitives, prim_objects, bvh_rebuild_.nodes);
+            bvh_rebuild_.time_us = uint32_t(Sys::GetTimeUs() - t1_us);
+        });
+}
+
+bool Eng::SceneManager::FinishSceneBVHRebuild(const bool wait) {
+    using namespace SceneManagerInternal;
+
+    if (!bvh_rebuild_.done.valid() ||
+        (!wait && bvh_rebuild_.done.wait_for(std::chrono::seconds(0)) != std::future_status::ready)) {
+        return false;
+    }
+    bvh_rebuild_.done.get();
+
+    // swap in new hierarchy
+    std::swap(scene_data_.nodes, bvh_rebuild_.nodes);
+    scene_data_.free_nodes.clear();
+    scene_data_.root_node = scene_data_.nodes.empty() ? 0xffffffff : 0;
+
+    auto *transforms = (Transform *)scene_data_.comp_store[CompTransform]->SequentialData();
+
+    // objects could move since snapshot was taken, leaves are updated and whole tree is refitted
+    for (uint32_t i = 0; i < uint32_t(scene_data_.nodes.size()); ++i) {
+        bvh_node_t &n = scene_data_.nodes[i];
+        if (n.leaf_node) {
+            Transform &tr = transforms[scene_data_.objects[n.prim_index].components[CompTransform]];
+            tr.node_index = i;
+
+            const bool is_fully_inside =
+                tr.bbox_min_ws[0] >= n.bbox_min[0] && tr.bbox_min_ws[1] >= n.bbox_min[1] &&
+                tr.bbox_min_ws[2] >= n.bbox_min[2] && tr.bbox_max_ws[0] <= n.bbox_max[0] &&
+                tr.bbox_max_ws[1] <= n.bbox_max[1] && tr.bbox_max_ws[2] <= n.bbox_max[2];
+            if (!is_fully_inside) {
+                const Ren::Vec3f d = tr.bbox_max_ws - tr.bbox_min_ws;
+                n.bbox_min = tr.bbox_min_ws - BoundsMargin * d;
+                n.bbox_max = tr.bbox_max_ws + BoundsMargin * d;
             }
         }
-    }*/
+    }
+    RefitSceneBVH(scene_data_.nodes);
 
-    __itt_task_end(__g_itt_domain);
+    bvh_area_sum_ = CalcSceneBVHAreaSum(scene_data_.nodes, scene_data_.root_node);
+
+    bvh_stats_t &stats = scene_data_.bvh_stats;
+    stats.cost = stats.built_cost =
+        scene_data_.nodes.empty() ? 0.0f : float(bvh_area_sum_ / surface_area(scene_data_.nodes[0]));
+    stats.rebuild_time_us = bvh_rebuild_.time_us;
+    ++stats.rebuilds_count;
+
+    return true;
 }
 
 void Eng::SceneManager::RemoveNode(const uint32_t node_index) {
@@ -277,6 +389,63 @@ void Eng::SceneManager::RemoveNode(const uint32_t node_index) {
     scene_data_.free_nodes.push_back(node_index);
 }
 
+double Eng::SceneManager::RefitSceneBVH(Ren::Span<bvh_node_t> nodes, Ren::Span<const uint32_t> leaf_nodes) {
+    using namespace SceneManagerInternal;
+
+    double area_delta = 0.0;
+
+    // All leaves are updated at this point, so walk up stops as soon as node bounds are not changed
+    for (const uint32_t leaf : leaf_nodes) {
+        uint32_t parent = nodes[leaf].parent;
+        while (parent != 0xffffffff) {
+            bvh_node_t &n = nodes[parent];
+
+            const Ren::Vec3f old_min = n.bbox_min, old_max = n.bbox_max;
+            update_bbox(nodes.data(), n);
+            if (n.bbox_min == old_min && n.bbox_max == old_max) {
+                break;
+            }
+            area_delta += surface_area(n) - surface_area(old_min, old_max);
+
+            parent = n.parent;
+        }
+    }
+
+    return area_delta;
+}
+
+void Eng::SceneManager::RefitSceneBVH(Ren::Span<bvh_node_t> nodes) {
+    using namespace SceneManagerInternal;
+
+    // children are always placed after parent
+    for (int i = int(nodes.size()) - 1; i >= 0; --i) {
+        if (!nodes[i].leaf_node) {
+            update_bbox(nodes.data(), nodes[i]);
+        }
+    }
+}
+
+bool Eng::SceneManager::NeedsSceneBVHRebuild(const bvh_stats_t &stats) {
+    using namespace SceneManagerInternal;
+    return stats.cost > BVHRebuildThreshold * stats.built_cost;
+}
+
+void Eng::SceneManager::set_bvh_update_mode(const eBVHUpdateMode mode) {
+    using namespace SceneManagerInternal;
+
+    if (mode == eBVHUpdateMode::Refit && bvh_update_mode_ != eBVHUpdateMode::Refit) {
+        // area sum is not tracked in reinsert mode, current hierarchy becomes the reference
+        bvh_area_sum_ = CalcSceneBVHAreaSum(scene_data_.nodes, scene_data_.root_node);
+
+        bvh_stats_t &stats = scene_data_.bvh_stats;
+        stats.cost = stats.built_cost =
+            (scene_data_.root_node == 0xffffffff)
+                ? 0.0f
+                : float(bvh_area_sum_ / surface_area(scene_data_.nodes[scene_data_.root_node]));
+    }
+    bvh_update_mode_ = mode;
+}
+
 void Eng::SceneManager::UpdateObjects() {
     using namespace SceneManagerInternal;
 
@@ -288,6 +457,11 @@ void Eng::SceneManager::UpdateObjects() {
 
     scene_data_.update_counter++;
 
+    const uint64_t t1_us = Sys::GetTimeUs();
+
+    // Pick up hierarchy that was rebuilt in background
+    FinishSceneBVHRebuild(false /* wait */);
+
     // instance_data_to_update_.clear();
 
     bvh_node_t *nodes = scene_data_.nodes.data();
@@ -343,6 +517,18 @@ void Eng::SceneManager::UpdateObjects() {
                 if (is_fully_inside) {
                     // Update is not needed (object is still inside of node bounds)
                     obj.change_mask ^= CompTransformBit;
+                } else if (bvh_update_mode_ == eBVHUpdateMode::Refit) {
+                    // Object is out of node bounds, update leaf (parents are refitted below)
+                    bvh_node_t &leaf = nodes[tr.node_index];
+                    bvh_area_sum_ -= surface_area(leaf);
+
+                    const Ren::Vec3f d = tr.bbox_max_ws - tr.bbox_min_ws;
+                    leaf.bbox_min = tr.bbox_min_ws - BoundsMargin * d;
+                    leaf.bbox_max = tr.bbox_max_ws + BoundsMargin * d;
+                    bvh_area_sum_ += surface_area(leaf);
+
+                    bvh_refit_leaves_.push_back(tr.node_index);
+                    obj.change_mask ^= CompTransformBit;
                 } else {
                     // Object is out of node bounds, remove node and re-insert it later
                     RemoveNode(tr.node_index);
@@ -354,6 +540,11 @@ void Eng::SceneManager::UpdateObjects() {
         }
     }
 
+    if (!bvh_refit_leaves_.empty()) {
+        bvh_area_sum_ += RefitSceneBVH(scene_data_.nodes, bvh_refit_leaves_);
+        bvh_refit_leaves_.clear();
+    }
+
     uint32_t *free_nodes = scene_data_.free_nodes.data();
     uint32_t free_nodes_pos = 0;
 
@@ -544,6 +735,20 @@ void Eng::SceneManager::UpdateObjects() {
     scene_data_.free_nodes.erase(scene_data_.free_nodes.begin(), scene_data_.free_nodes.begin() + free_nodes_pos);
     last_changed_objects_ = std::move(changed_objects_);
 
+    bvh_stats_t &stats = scene_data_.bvh_stats;
+    // SAH cost is tracked only in refit mode (reinsertion keeps hierarchy quality on its own)
+    if (bvh_update_mode_ == eBVHUpdateMode::Refit && scene_data_.root_node != 0xffffffff) {
+        if (free_nodes_pos) {
+            // hierarchy was changed by reinsertion of objects that had no leaf
+            bvh_area_sum_ = CalcSceneBVHAreaSum(scene_data_.nodes, scene_data_.root_node);
+        }
+        stats.cost = float(bvh_area_sum_ / surface_area(nodes[scene_data_.root_node]));
+        if (!bvh_rebuild_.done.valid() && NeedsSceneBVHRebuild(stats)) {
+            StartSceneBVHRebuild();
+        }
+    }
+    stats.update_time_us = uint32_t(Sys::GetTimeUs() - t1_us);
+
     __itt_task_end(__g_itt_domain);
 }
 
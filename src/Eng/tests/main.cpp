@@ -14,6 +14,8 @@ __itt_domain *__g_itt_domain = __itt_domain_create("Global");
 
 // void test_object_pool();
 void test_cmdline();
+void test_archetypes();
+void test_scene_bvh();
 void test_materials(Sys::ThreadPool &threads, bool full, std::string_view device_name, int validation_level,
                     bool nohwrt, bool nosubgroup);
 
@@ -86,6 +88,8 @@ int main(int argc, char *argv[]) {
 
     // test_object_pool();
     test_cmdline();
+    test_archetypes();
+    test_scene_bvh();
     puts(" ---------------");
     test_materials(mt_run_pool, full, device_name, validation_level, nohwrt, nosubgroup);
 
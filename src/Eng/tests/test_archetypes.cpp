@@ -0,0 +1,250 @@
+#include "test_common.h"
+
+#include <chrono>
+#include <random>
+
+#include "../scene/SceneManager.h"
+
+namespace {
+struct FakeComp {
+    float val;
+    float padding[15];
+};
+
+template <typename T> class VecCompStorage : public Eng::CompStorage {
+  public:
+    std::vector<T> data;
+
+    [[nodiscard]] std::string_view name() const override { return T::name(); }
+
+    uint32_t Create() override {
+        data.emplace_back();
+        return uint32_t(data.size() - 1);
+    }
+    void Delete(uint32_t) override {}
+
+    [[nodiscard]] const void *Get(const uint32_t i) const override { return &data[i]; }
+    [[nodiscard]] void *Get(const uint32_t i) override { return &data[i]; }
+
+    [[nodiscard]] uint32_t First() const override { return data.empty() ? 0xffffffff : 0; }
+    [[nodiscard]] uint32_t Next(const uint32_t i) const override {
+        return (i + 1 < uint32_t(data.size())) ? i + 1 : 0xffffffff;
+    }
+    [[nodiscard]] int Count() const override { return int(data.size()); }
+
+    void ReadFromJs(const Sys::JsObjectP &, void *) override {}
+    void WriteToJs(const void *, Sys::JsObjectP &) const override {}
+
+    [[nodiscard]] const void *SequentialData() const override { return data.data(); }
+    [[nodiscard]] void *SequentialData() override { return data.data(); }
+};
+
+void test_instance_data_fill(double &out_obj_ms, double &out_arch_ms) {
+    using namespace Eng;
+
+    const int ObjCount = 100000;
+    const uint32_t Masks[] = {CompTransformBit, CompTransformBit | CompDrawableBit,
+                              CompTransformBit | CompDrawableBit | CompLightmapBit,
+                              CompTransformBit | CompDrawableBit | CompAccStructureBit,
+                              CompTransformBit | CompLightSourceBit, CompTransformBit | CompLightmapBit};
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, std::size(Masks) - 1);
+    std::uniform_real_distribution<float> fdist(-100.0f, 100.0f);
+
+    VecCompStorage<Transform> transforms;
+    VecCompStorage<Eng::Drawable> drawables;
+    VecCompStorage<Lightmap> lightmaps;
+    VecCompStorage<VegState> vegs;
+
+    auto scene = std::make_unique<SceneData>();
+    scene->comp_store[CompTransform] = &transforms;
+    scene->comp_store[CompDrawable] = &drawables;
+    scene->comp_store[CompLightmap] = &lightmaps;
+    scene->comp_store[CompVegState] = &vegs;
+
+    for (int i = 0; i < ObjCount; ++i) {
+        SceneObject &obj = scene->objects.emplace_back();
+        obj.comp_mask = Masks[dist(gen)];
+
+        obj.components[CompTransform] = transforms.Create();
+        Transform &tr = transforms.data.back();
+        tr.world_from_object = Translate(Ren::Mat4f{1.0f}, Ren::Vec3f{fdist(gen), fdist(gen), fdist(gen)});
+        tr.world_from_object_prev = Translate(Ren::Mat4f{1.0f}, Ren::Vec3f{fdist(gen), fdist(gen), fdist(gen)});
+
+        if (obj.comp_mask & CompDrawableBit) {
+            obj.components[CompDrawable] = drawables.Create();
+            if (i % 3) {
+                drawables.data.back().vis_mask = Eng::Drawable::eVisibility::Camera;
+            }
+        }
+        if (obj.comp_mask & CompLightmapBit) {
+            obj.components[CompLightmap] = lightmaps.Create();
+            lightmaps.data.back().xform = Ren::Vec4f{fdist(gen), fdist(gen), fdist(gen), fdist(gen)};
+        }
+
+        scene->archetypes.Insert(uint32_t(i), obj);
+    }
+
+    std::vector<InstanceData> ref_instances(ObjCount), instances(ObjCount);
+
+    const int Iterations = 16;
+
+    // per-object loop, as it was done before archetypes were introduced
+    const auto t1 = std::chrono::high_resolution_clock::now();
+    for (int it = 0; it < Iterations; ++it) {
+        for (int i = 0; i < ObjCount; ++i) {
+            const SceneObject &obj = scene->objects[i];
+            require(obj.comp_mask & CompTransformBit);
+
+            const Transform &tr = transforms.data[obj.components[CompTransform]];
+            const Ren::Mat4f world_from_object_trans = Transpose(tr.world_from_object);
+            const Ren::Mat4f prev_world_from_object_trans = Transpose(tr.world_from_object_prev);
+
+            InstanceData &instance = ref_instances[i];
+            memcpy(&instance.model_matrix[0][0], ValuePtr(world_from_object_trans), 12 * sizeof(float));
+            memcpy(&instance.prev_model_matrix[0][0], ValuePtr(prev_world_from_object_trans), 12 * sizeof(float));
+
+            if (obj.comp_mask & CompDrawableBit) {
+                instance.vis_mask = uint8_t(drawables.data[obj.components[CompDrawable]].vis_mask);
+            }
+            if (obj.comp_mask & CompLightmapBit) {
+                memcpy(&instance.lmap_transform[0], ValuePtr(lightmaps.data[obj.components[CompLightmap]].xform),
+                       4 * sizeof(float));
+            }
+        }
+    }
+    const auto t2 = std::chrono::high_resolution_clock::now();
+    for (int it = 0; it < Iterations; ++it) {
+        SceneManager::FillInstanceData(*scene, 0, ObjCount - 1, instances.data());
+    }
+    const auto t3 = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < ObjCount; ++i) {
+        const InstanceData &ref = ref_instances[i], &inst = instances[i];
+        require(memcmp(ref.model_matrix, inst.model_matrix, sizeof(ref.model_matrix)) == 0);
+        require(memcmp(ref.prev_model_matrix, inst.prev_model_matrix, sizeof(ref.prev_model_matrix)) == 0);
+        require(ref.vis_mask == inst.vis_mask);
+        require(memcmp(ref.lmap_transform, inst.lmap_transform, sizeof(ref.lmap_transform)) == 0);
+    }
+
+    { // partial range (used for incremental updates)
+        const uint32_t RangeBeg = 1234, RangeEnd = 5678;
+        std::vector<InstanceData> range_instances(RangeEnd - RangeBeg + 1);
+        SceneManager::FillInstanceData(*scene, RangeBeg, RangeEnd, range_instances.data());
+        for (uint32_t i = RangeBeg; i <= RangeEnd; ++i) {
+            require(memcmp(ref_instances[i].model_matrix, range_instances[i - RangeBeg].model_matrix,
+                           sizeof(InstanceData::model_matrix)) == 0);
+        }
+    }
+
+    for (int i = 0; i < MAX_COMPONENT_TYPES; ++i) {
+        scene->comp_store[i] = nullptr;
+    }
+
+    out_obj_ms = std::chrono::duration<double, std::milli>(t2 - t1).count() / Iterations;
+    out_arch_ms = std::chrono::duration<double, std::milli>(t3 - t2).count() / Iterations;
+}
+} // namespace
+
+void test_archetypes() {
+    using namespace Eng;
+
+    printf("Test archetypes         | ");
+
+    const int ObjCount = 100000;
+    const uint32_t ReqMask = CompTransformBit | CompDrawableBit;
+    const uint32_t Masks[] = {CompTransformBit,
+                              CompTransformBit | CompDrawableBit,
+                              CompTransformBit | CompDrawableBit | CompAccStructureBit,
+                              CompTransformBit | CompLightSourceBit,
+                              CompTransformBit | CompDrawableBit | CompLightSourceBit,
+                              CompTransformBit | CompProbeBit};
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, std::size(Masks) - 1);
+
+    std::vector<SceneObject> objects(ObjCount);
+    std::vector<FakeComp> comps[MAX_COMPONENT_TYPES];
+    ObjArchetypeStorage archetypes;
+
+    double expected_sum = 0;
+    int expected_count = 0;
+    for (int i = 0; i < ObjCount; ++i) {
+        SceneObject &obj = objects[i];
+        obj.comp_mask = Masks[dist(gen)];
+        for (int j = 0; j < MAX_COMPONENT_TYPES; ++j) {
+            if (obj.comp_mask & (1u << j)) {
+                obj.components[j] = uint32_t(comps[j].size());
+                comps[j].push_back(FakeComp{float(i % 1000)});
+            }
+        }
+        if ((obj.comp_mask & ReqMask) == ReqMask) {
+            expected_sum += comps[CompTransform][obj.components[CompTransform]].val +
+                            comps[CompDrawable][obj.components[CompDrawable]].val;
+            ++expected_count;
+        }
+        archetypes.Insert(uint32_t(i), obj);
+    }
+
+    require(archetypes.archetypes().size() == std::size(Masks));
+    for (const uint32_t mask : Masks) {
+        const ObjArchetype *arch = archetypes.Find(mask);
+        require(arch != nullptr);
+        require(arch->comp_mask == mask);
+        for (size_t i = 0; i < arch->objects.size(); ++i) {
+            const SceneObject &obj = objects[arch->objects[i]];
+            require(obj.comp_mask == mask);
+            require(arch->components[CompTransform][i] == obj.components[CompTransform]);
+        }
+    }
+    require(archetypes.Find(CompDrawableBit) == nullptr);
+
+    const int Iterations = 64;
+
+    double aos_sum = 0;
+    int aos_count = 0;
+    const auto t1 = std::chrono::high_resolution_clock::now();
+    for (int it = 0; it < Iterations; ++it) {
+        aos_sum = 0;
+        aos_count = 0;
+        for (const SceneObject &obj : objects) {
+            if ((obj.comp_mask & ReqMask) != ReqMask) {
+                continue;
+            }
+            aos_sum += comps[CompTransform][obj.components[CompTransform]].val +
+                       comps[CompDrawable][obj.components[CompDrawable]].val;
+            ++aos_count;
+        }
+    }
+    const auto t2 = std::chrono::high_resolution_clock::now();
+
+    double soa_sum = 0;
+    int soa_count = 0;
+    for (int it = 0; it < Iterations; ++it) {
+        soa_sum = 0;
+        soa_count = 0;
+        archetypes.ForEach(ReqMask, [&](const ObjArchetype &arch) {
+            const std::vector<uint32_t> &transforms = arch.components[CompTransform];
+            const std::vector<uint32_t> &drawables = arch.components[CompDrawable];
+            for (size_t i = 0; i < arch.objects.size(); ++i) {
+                soa_sum += comps[CompTransform][transforms[i]].val + comps[CompDrawable][drawables[i]].val;
+            }
+            soa_count += int(arch.objects.size());
+        });
+    }
+    const auto t3 = std::chrono::high_resolution_clock::now();
+
+    require(aos_count == expected_count && soa_count == expected_count);
+    require(aos_sum == expected_sum && soa_sum == expected_sum);
+
+    double inst_obj_ms = 0, inst_arch_ms = 0;
+    test_instance_data_fill(inst_obj_ms, inst_arch_ms);
+
+    printf("OK\n");
+
+    const double aos_ms = std::chrono::duration<double, std::milli>(t2 - t1).count() / Iterations;
+    const double soa_ms = std::chrono::duration<double, std::milli>(t3 - t2).count() / Iterations;
+    printf("\tIteration (%i objects): objects %.3fms, archetypes %.3fms\n", ObjCount, aos_ms, soa_ms);
+    printf("\tInstance data (%i objects): objects %.3fms, archetypes %.3fms\n", ObjCount, inst_obj_ms, inst_arch_ms);
+}
@@ -0,0 +1,190 @@
+#include "test_common.h"
+
+#include <random>
+
+#include <Phy/BVHSplit.h>
+
+#include "../scene/SceneManager.h"
+
+namespace {
+float surface_area(const Ren::Vec3f &bbox_min, const Ren::Vec3f &bbox_max) {
+    const Ren::Vec3f d = bbox_max - bbox_min;
+    return d[0] * d[1] + d[0] * d[2] + d[1] * d[2];
+}
+
+bool is_inside(const Eng::bvh_node_t &inner, const Eng::bvh_node_t &outer) {
+    return inner.bbox_min[0] >= outer.bbox_min[0] && inner.bbox_min[1] >= outer.bbox_min[1] &&
+           inner.bbox_min[2] >= outer.bbox_min[2] && inner.bbox_max[0] <= outer.bbox_max[0] &&
+           inner.bbox_max[1] <= outer.bbox_max[1] && inner.bbox_max[2] <= outer.bbox_max[2];
+}
+
+// Checks links and bounds, fills leaf index of each object
+void check_hierarchy(const std::vector<Eng::bvh_node_t> &nodes, const int objects_count,
+                     std::vector<uint32_t> &out_leaves) {
+    out_leaves.assign(objects_count, 0xffffffff);
+
+    std::vector<uint32_t> stack = {0};
+    require(nodes[0].parent == 0xffffffff);
+    while (!stack.empty()) {
+        const uint32_t i = stack.back();
+        stack.pop_back();
+
+        const Eng::bvh_node_t &n = nodes[i];
+        if (n.leaf_node) {
+            require(n.prim_index < uint32_t(objects_count));
+            require(out_leaves[n.prim_index] == 0xffffffff);
+            out_leaves[n.prim_index] = i;
+        } else {
+            for (const uint32_t ch : {uint32_t(n.left_child), uint32_t(n.right_child)}) {
+                require(ch > i);
+                require(nodes[ch].parent == i);
+                require(is_inside(nodes[ch], n));
+                stack.push_back(ch);
+            }
+        }
+    }
+
+    for (const uint32_t leaf : out_leaves) {
+        require(leaf != 0xffffffff);
+    }
+}
+
+float calc_cost(const std::vector<Eng::bvh_node_t> &nodes) {
+    return float(Eng::SceneManager::CalcSceneBVHAreaSum(nodes, 0) / surface_area(nodes[0].bbox_min, nodes[0].bbox_max));
+}
+} // namespace
+
+void test_scene_bvh() {
+    using namespace Eng;
+
+    printf("Test scene BVH          | ");
+
+    const int ObjCount = 2000;
+
+    std::mt19937 gen(123);
+    std::uniform_real_distribution<float> pos_dist(-100.0f, 100.0f), size_dist(0.5f, 2.0f), jitter_dist(-0.5f, 0.5f);
+
+    std::vector<Ren::Vec3f> bbox_min(ObjCount), bbox_max(ObjCount);
+    for (int i = 0; i < ObjCount; ++i) {
+        bbox_min[i] = Ren::Vec3f{pos_dist(gen), pos_dist(gen), pos_dist(gen)};
+        bbox_max[i] = bbox_min[i] + Ren::Vec3f{size_dist(gen), size_dist(gen), size_dist(gen)};
+    }
+
+    auto build = [&](std::vector<bvh_node_t> &out_nodes) {
+        std::vector<Phy::prim_t> prims;
+        std::vector<uint32_t> prim_objects;
+        for (int i = 0; i < ObjCount; ++i) {
+            prims.push_back({0, 0, 0, Phy::Vec3f{bbox_min[i][0], bbox_min[i][1], bbox_min[i][2]},
+                             Phy::Vec3f{bbox_max[i][0], bbox_max[i][1], bbox_max[i][2]}});
+            prim_objects.push_back(uint32_t(i));
+        }
+        SceneManager::BuildSceneBVH(prims, prim_objects, out_nodes);
+    };
+
+    // moves object and updates its leaf (same as it is done in refit mode), returns change of leaf area
+    auto move_object = [&](std::vector<bvh_node_t> &tree, const uint32_t leaf, const int obj,
+                           const Ren::Vec3f &new_pos) -> double {
+        const Ren::Vec3f size = bbox_max[obj] - bbox_min[obj];
+        bbox_min[obj] = new_pos;
+        bbox_max[obj] = new_pos + size;
+
+        bvh_node_t &n = tree[leaf];
+        const double old_area = surface_area(n.bbox_min, n.bbox_max);
+        n.bbox_min = bbox_min[obj];
+        n.bbox_max = bbox_max[obj];
+        return surface_area(n.bbox_min, n.bbox_max) - old_area;
+    };
+
+    std::vector<bvh_node_t> nodes;
+    build(nodes);
+    require_return(nodes.size() == 2 * ObjCount - 1);
+
+    std::vector<uint32_t> leaves;
+    check_hierarchy(nodes, ObjCount, leaves);
+
+    bvh_stats_t stats;
+    double area_sum = SceneManager::CalcSceneBVHAreaSum(nodes, 0);
+    stats.cost = stats.built_cost = calc_cost(nodes);
+    require(stats.built_cost > 0.0f);
+    require(!SceneManager::NeedsSceneBVHRebuild(stats));
+
+    { // rebuild threshold
+        bvh_stats_t test_stats;
+        test_stats.built_cost = 10.0f;
+        test_stats.cost = 11.9f;
+        require(!SceneManager::NeedsSceneBVHRebuild(test_stats));
+        test_stats.cost = 12.1f;
+        require(SceneManager::NeedsSceneBVHRebuild(test_stats));
+    }
+
+    { // small movement, incremental area sum matches full recalculation, quality stays acceptable
+        std::vector<uint32_t> refit_leaves;
+        for (int i = 0; i < ObjCount; i += 10) {
+            const auto offset = Ren::Vec3f{jitter_dist(gen), jitter_dist(gen), jitter_dist(gen)};
+            area_sum += move_object(nodes, leaves[i], i, bbox_min[i] + offset);
+            refit_leaves.push_back(leaves[i]);
+        }
+        area_sum += SceneManager::RefitSceneBVH(nodes, refit_leaves);
+        check_hierarchy(nodes, ObjCount, leaves);
+
+        const double ref_area_sum = SceneManager::CalcSceneBVHAreaSum(nodes, 0);
+        require(std::abs(area_sum - ref_area_sum) < 1e-4 * ref_area_sum);
+
+        stats.cost = float(area_sum / surface_area(nodes[0].bbox_min, nodes[0].bbox_max));
+        require(!SceneManager::NeedsSceneBVHRebuild(stats));
+    }
+
+    { // objects are scattered, refitted hierarchy degrades past threshold
+        int steps = 0;
+        while (!SceneManager::NeedsSceneBVHRebuild(stats) && steps < 10) {
+            std::vector<uint32_t> refit_leaves;
+            for (int i = steps % 4; i < ObjCount; i += 4) {
+                area_sum +=
+                    move_object(nodes, leaves[i], i, Ren::Vec3f{pos_dist(gen), pos_dist(gen), pos_dist(gen)});
+                refit_leaves.push_back(leaves[i]);
+            }
+            area_sum += SceneManager::RefitSceneBVH(nodes, refit_leaves);
+            stats.cost = float(area_sum / surface_area(nodes[0].bbox_min, nodes[0].bbox_max));
+            ++steps;
+        }
+        require(SceneManager::NeedsSceneBVHRebuild(stats));
+        check_hierarchy(nodes, ObjCount, leaves);
+
+        const double ref_area_sum = SceneManager::CalcSceneBVHAreaSum(nodes, 0);
+        require(std::abs(area_sum - ref_area_sum) < 1e-4 * ref_area_sum);
+    }
+
+    { // background rebuild, tree is built from snapshot while objects keep moving
+        std::vector<bvh_node_t> new_nodes;
+        build(new_nodes);
+
+        // movement after snapshot
+        for (int i = 0; i < ObjCount; i += 7) {
+            const auto offset = Ren::Vec3f{jitter_dist(gen), jitter_dist(gen), jitter_dist(gen)};
+            move_object(nodes, leaves[i], i, bbox_min[i] + offset);
+        }
+
+        // swap in new hierarchy, update leaves and refit whole tree
+        std::vector<uint32_t> new_leaves;
+        check_hierarchy(new_nodes, ObjCount, new_leaves);
+        for (int i = 0; i < ObjCount; ++i) {
+            bvh_node_t &leaf = new_nodes[new_leaves[i]];
+            leaf.bbox_min = bbox_min[i];
+            leaf.bbox_max = bbox_max[i];
+        }
+        SceneManager::RefitSceneBVH(new_nodes);
+        check_hierarchy(new_nodes, ObjCount, new_leaves);
+
+        const float degraded_cost = stats.cost;
+        stats.cost = stats.built_cost = calc_cost(new_nodes);
+        require(stats.cost < degraded_cost);
+        require(!SceneManager::NeedsSceneBVHRebuild(stats));
+
+        // rebuilt hierarchy is as good as one built from scratch
+        std::vector<bvh_node_t> ref_nodes;
+        build(ref_nodes);
+        require(stats.cost < 1.05f * calc_cost(ref_nodes));
+    }
+
+    printf("OK\n");
+}
@@ -71,6 +71,13 @@ void Eng::DebugFrameUI::UpdateInfo(const FrontendInfo &frontend_info, const Back
     front_info_smooth_.items_assignment_time_ms += k * us_to_ms(frontend_info.items_assignment_time_us);
     front_info_smooth_.total_time_ms *= alpha;
     front_info_smooth_.total_time_ms += k * us_to_ms(frontend_info.end_timepoint_us - frontend_info.start_timepoint_us);
+    front_info_smooth_.bvh_update_time_ms *= alpha;
+    front_info_smooth_.bvh_update_time_ms += k * us_to_ms(frontend_info.bvh_update_time_us);
+    front_info_smooth_.bvh_quality *= alpha;
+    front_info_smooth_.bvh_quality += k * frontend_info.bvh_quality;
+    // rebuild happens occasionally, last value is shown as is
+    front_info_smooth_.bvh_rebuild_time_ms = us_to_ms(frontend_info.bvh_rebuild_time_us);
+    front_info_smooth_.bvh_rebuilds_count = frontend_info.bvh_rebuilds_count;
 
     back_info_smooth_.passes_info.resize(backend_info.passes_info.size());
     for (int i = 0; i < int(backend_info.passes_info.size()); ++i) {
@@ -227,6 +234,26 @@ void Eng::DebugFrameUI::DrawCompact(Gui::Renderer *r) {
         font_small_->DrawText(r, text_buffer, Gui::Vec2f{-1, vertical_offset}, text_color, font_scale, parent_);
     }
 
+    { // scene hierarchy update
+        vertical_offset -= font_height;
+        font_small_->DrawText(r, delimiter, Gui::Vec2f{-1, vertical_offset}, text_color, font_scale, parent_);
+
+        vertical_offset -= font_height;
+        snprintf(text_buffer, sizeof(text_buffer), "         BVH UPDATE: %.3f ms",
+                 front_info_smooth_.bvh_update_time_ms);
+        font_small_->DrawText(r, text_buffer, Gui::Vec2f{-1, vertical_offset}, text_color, font_scale, parent_);
+
+        vertical_offset -= font_height;
+        snprintf(text_buffer, sizeof(text_buffer), "        BVH REBUILD: %.3f ms (%u)",
+                 front_info_smooth_.bvh_rebuild_time_ms, front_info_smooth_.bvh_rebuilds_count);
+        font_small_->DrawText(r, text_buffer, Gui::Vec2f{-1, vertical_offset}, text_color, font_scale, parent_);
+
+        vertical_offset -= font_height;
+        snprintf(text_buffer, sizeof(text_buffer), "        BVH QUALITY: %.1f%%",
+                 100.0f * front_info_smooth_.bvh_quality);
+        font_small_->DrawText(r, text_buffer, Gui::Vec2f{-1, vertical_offset}, text_color, font_scale, parent_);
+    }
+
     { // renderer backend performance
         vertical_offset -= font_height;
         font_small_->DrawText(r, delimiter, Gui::Vec2f{-1, vertical_offset}, text_color, font_scale, parent_);
@@ -50,6 +50,8 @@ class DebugFrameUI final : public Gui::BaseElement {
         float occluders_time_ms = 0, main_gather_time_ms = 0, shadow_gather_time_ms = 0, drawables_sort_time_ms = 0,
               items_assignment_time_ms = 0;
         float total_time_ms = 0;
+        float bvh_update_time_ms = 0, bvh_rebuild_time_ms = 0, bvh_quality = 1;
+        uint32_t bvh_rebuilds_count = 0;
     } front_info_smooth_;
 
     struct pass_info_smooth_t {
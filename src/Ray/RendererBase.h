@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstring>
+#include <iosfwd>
 #include <memory>
 
 #include "Config.h"
@@ -48,6 +49,18 @@ bool RendererSupportsMultithreading(eRendererType rt);
 /// Returns whether this type of renderer supports hardware raytracing
 bool RendererSupportsHWRT(eRendererType rt);
 
+/// Precision of UNet denoiser computations (CPU only)
+enum class eUNetPrecision {
+    // full precision weights and tensors
+    FP32,
+    // intermediate tensors are kept in bfloat16 (halves memory traffic, 8 bits of mantissa)
+    BF16,
+    // intermediate tensors are kept in IEEE half-precision (halves memory traffic, 11 bits of mantissa)
+    FP16,
+    // weights are quantized to int8 with per output channel scale (4x smaller), tensors are kept in fp32
+    Int8
+};
+
 /// Renderer settings
 struct settings_t {
     int w = 0, h = 0;
@@ -56,6 +69,19 @@ struct settings_t {
     bool use_hwrt = true;
     bool use_bindless = true;
     bool use_spatial_cache = false;
+    // CPU only: precision of UNet denoiser weights and intermediate tensors
+    eUNetPrecision unet_precision = eUNetPrecision::FP32;
+    // CPU only: use quantized wide BVH nodes (half the size of full precision ones, but need decoding)
+    bool use_compressed_bvh = false;
+    // CPU only: trace coherent ray packets together instead of one ray at a time (incoherent ones are unaffected)
+    bool use_packet_traversal = false;
+    // CPU only: amount of texture memory (in megabytes) kept resident, the rest is paged from disk (0 - disabled)
+    int tex_page_budget_mb = 0;
+    // CPU only: file used for texture paging (temporary file is created if not set)
+    const char *tex_page_file = nullptr;
+    // CPU only: keep accumulation, output and auxiliary buffers in reduced precision (framebuffer takes 46 instead of
+    // 114 bytes per pixel, images are available through GetPixels, GetRawPixels and GetAUXPixels only)
+    bool use_compact_buffers = false;
     int validation_level = 0;
 
     VulkanDevice vk_device = {};
@@ -82,13 +108,17 @@ class RegionContext {
   public:
     int iteration = 0; ///< Number of rendered samples per pixel
     int cache_iteration = 0;
+    /// Number of samples rendered elsewhere (CPU only, allows to split samples between several renderers)
+    int base_iteration = 0;
 
     explicit RegionContext(const rect_t &rect) : rect_(rect) {}
+    RegionContext(const rect_t &rect, const int first_sample)
+        : rect_(rect), iteration(first_sample), base_iteration(first_sample) {}
 
     const rect_t &rect() const { return rect_; }
 
     /// Clear region context (used to start again)
-    void Clear() { iteration = 0; }
+    void Clear() { iteration = base_iteration; }
 };
 
 class ILog;
@@ -152,15 +182,43 @@ class RendererBase {
     /// Returns size of rendered image
     virtual std::pair<int, int> size() const = 0;
 
-    /// Returns pointer to rendered image
+    /// Returns pointer to rendered image (empty if image is not stored in full precision, e.g. with compact buffers,
+    /// GetPixels can be used instead)
     virtual color_data_rgba_t get_pixels_ref() const = 0;
 
-    /// Returns pointer to 'raw' untonemapped image
+    /// Returns pointer to 'raw' untonemapped image (empty if image is not stored in full precision, e.g. with compact
+    /// buffers, GetRawPixels can be used instead)
     virtual color_data_rgba_t get_raw_pixels_ref() const = 0;
 
-    /// Returns pointer to auxiliary image buffers
+    /// Returns pointer to auxiliary image buffers (empty if buffer is not stored in full precision, e.g. with compact
+    /// buffers, GetAUXPixels can be used instead)
     virtual color_data_rgba_t get_aux_pixels_ref(eAUXBuffer buf) const = 0;
 
+    /** @brief Copies rendered image to user-provided memory (works regardless of how image is stored)
+        @param out_pixels destination memory (w * h pixels are written)
+        @param out_pitch row pitch of destination memory (in pixels)
+    */
+    virtual void GetPixels(color_rgba_t out_pixels[], const int out_pitch) const {
+        CopyPixels(get_pixels_ref(), out_pixels, out_pitch);
+    }
+
+    /** @brief Copies 'raw' untonemapped image to user-provided memory (works regardless of how image is stored)
+        @param out_pixels destination memory (w * h pixels are written)
+        @param out_pitch row pitch of destination memory (in pixels)
+    */
+    virtual void GetRawPixels(color_rgba_t out_pixels[], const int out_pitch) const {
+        CopyPixels(get_raw_pixels_ref(), out_pixels, out_pitch);
+    }
+
+    /** @brief Copies auxiliary image buffer to user-provided memory (works regardless of how buffer is stored)
+        @param buf buffer type
+        @param out_pixels destination memory (w * h pixels are written)
+        @param out_pitch row pitch of destination memory (in pixels)
+    */
+    virtual void GetAUXPixels(const eAUXBuffer buf, color_rgba_t out_pixels[], const int out_pitch) const {
+        CopyPixels(get_aux_pixels_ref(buf), out_pixels, out_pitch);
+    }
+
     /// Returns pointer to SH data
     virtual const shl1_data_t *get_sh_data_ref() const = 0;
 
@@ -219,6 +277,23 @@ class RendererBase {
         const SceneBase &scene,
         const std::function<void(int, int, ParallelForFunction &&)> &parallel_for = parallel_for_serial) = 0;
 
+    /// Returns number of passes spatial radiance cache is resolved in
+    virtual int spatial_cache_resolve_passes() const { return 1; }
+
+    /// Returns number of blocks each pass of spatial radiance cache resolve is split into
+    virtual int spatial_cache_blocks_count() const { return 1; }
+
+    /** @brief Resolve single block of spatial radiance cache (blocks of the same pass can be resolved in parallel with
+               each other, next pass can start only when all blocks of the previous one are finished, none of them
+               can run in parallel with cache update or RenderScene)
+        @param scene reference to a scene
+        @param pass index of a resolve pass
+        @param block index of a block (each block must be resolved once per pass after cache update)
+    */
+    virtual void ResolveSpatialCacheBlock(const SceneBase &scene, int /*pass*/, int /*block*/) {
+        ResolveSpatialCache(scene);
+    }
+
     /** @brief Reset spatial radiance cache
         @param scene reference to a scene
     */
@@ -234,15 +309,55 @@ class RendererBase {
         unsigned long long time_primary_shadow_us;
         unsigned long long time_secondary_sort_us;
         unsigned long long time_secondary_trace_us;
+        unsigned long long time_secondary_trace_single_us, time_secondary_trace_packet_us;
+        unsigned long long secondary_rays_single, secondary_rays_packet;
+        unsigned long long primary_rays, primary_shadow_rays;
+        unsigned long long secondary_rays, secondary_shadow_rays;
         unsigned long long time_secondary_shade_us;
         unsigned long long time_secondary_shadow_us;
         unsigned long long time_denoise_us;
         unsigned long long time_cache_update_us;
         unsigned long long time_cache_resolve_us;
+        unsigned long long tex_page_hits, tex_page_misses;
+        unsigned long long tex_block_hits, tex_block_misses;
     };
     virtual void GetStats(stats_t &st) = 0;
     virtual void ResetStats() = 0;
 
+    /** @brief Write render progress (accumulated image, region iterations and spatial cache) to a stream
+        @param scene reference to a scene being rendered
+        @param regions image regions used for rendering
+        @param out output stream
+        @return true on success, false if failed or not supported by backend
+    */
+    virtual bool SaveCheckpoint(const SceneBase & /*scene*/, Span<const RegionContext> /*regions*/,
+                                std::ostream & /*out*/) const {
+        return false;
+    }
+
+    /** @brief Restore render progress previously written with SaveCheckpoint
+        @param scene reference to a scene being rendered (must be set up the same way as on save)
+        @param regions image regions used for rendering (must match the ones passed on save)
+        @param in input stream
+        @return true on success, false if checkpoint is invalid or not supported by backend
+    */
+    virtual bool LoadCheckpoint(const SceneBase & /*scene*/, Span<RegionContext> /*regions*/, std::istream & /*in*/) {
+        return false;
+    }
+
+    /** @brief Add render progress of other renderer (e.g. in other process) to this one
+        Samples are weighted by their per-pixel count, so adaptive sampling results are merged correctly.
+        Sample ranges of the same region must be adjacent, regions that were not rendered are ignored.
+        @param scene reference to a scene being rendered
+        @param regions image regions used for rendering (must match the ones passed on save)
+        @param in input stream with data written by SaveCheckpoint
+        @return true on success, false if checkpoint is invalid or not supported by backend
+    */
+    virtual bool MergeCheckpoint(const SceneBase & /*scene*/, Span<RegionContext> /*regions*/,
+                                 std::istream & /*in*/) {
+        return false;
+    }
+
     /** @brief Initialize UNet filter (neural denoiser)
         @param alias_memory enable tensom memory aliasing (to lower memory usage)
         @param out_props output filter properties
@@ -250,5 +365,16 @@ class RendererBase {
     virtual unet_filter_properties_t
     InitUNetFilter(bool alias_memory,
                    const std::function<void(int, int, ParallelForFunction &&)> &parallel_for = parallel_for_serial) = 0;
+
+  protected:
+    void CopyPixels(const color_data_rgba_t &data, color_rgba_t out_pixels[], const int out_pitch) const {
+        if (!data.ptr) {
+            return;
+        }
+        const std::pair<int, int> sz = size();
+        for (int y = 0; y < sz.second; ++y) {
+            memcpy(&out_pixels[y * out_pitch], &data.ptr[y * data.pitch], sz.first * sizeof(color_rgba_t));
+        }
+    }
 };
 } // namespace Ray
\ No newline at end of file
@@ -414,9 +414,12 @@ class SceneBase {
 
     /** @brief Adds mesh to scene
         @param m mesh description
+        @param parallel_for function used to parallelize acceleration structure build
         @return New mesh index
     */
-    virtual MeshHandle AddMesh(const mesh_desc_t &m) = 0;
+    virtual MeshHandle
+    AddMesh(const mesh_desc_t &m,
+            const std::function<void(int, int, ParallelForFunction &&)> &parallel_for = parallel_for_serial) = 0;
 
     /** @brief Removes mesh with specific index from scene
         @param i mesh index
@@ -463,6 +466,18 @@ class SceneBase {
     */
     virtual void SetMeshInstanceTransform(MeshInstanceHandle mi, const float *xform) = 0;
 
+    /** @brief Sets transformations of multiple mesh instances at once
+        @param mi mesh instance handles
+        @param xforms array of 16 floats per instance holding transformation matrices
+        @param parallel_for function used to parallelize acceleration structure rebuild
+
+        Top-level acceleration structure is updated right away (refitted when possible, always rebuilt
+        with hardware raytracing), no need to call Finalize afterwards.
+    */
+    virtual void SetMeshInstanceTransforms(
+        Span<const MeshInstanceHandle> mi, Span<const float> xforms,
+        const std::function<void(int, int, ParallelForFunction &&)> &parallel_for = parallel_for_serial) = 0;
+
     /** @brief Removes mesh instance from scene
         @param mi mesh instance handle
 
@@ -474,6 +489,26 @@ class SceneBase {
     virtual void
     Finalize(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for = parallel_for_serial) = 0;
 
+    /** @brief Saves finalized scene into binary cache file
+        @param file_name path to cache file
+        @param inputs_hash hash of scene inputs (see HashInputs), stored in file for validation
+        @return true on success
+
+        Cache contains geometry with prebuilt acceleration structures, materials, lights and environment.
+        Textures and cameras are not stored. Not supported by all backends.
+    */
+    virtual bool SaveCache(const char * /*file_name*/, uint64_t /*inputs_hash*/) const { return false; }
+
+    /** @brief Loads scene from binary cache file previously written with SaveCache
+        @param file_name path to cache file
+        @param inputs_hash hash of scene inputs, loading fails if it does not match the stored one
+        @return true on success
+
+        Scene must not contain any geometry, materials or lights. Textures must be added in the same order as
+        when cache was saved. File is memory-mapped and used in place, Finalize must not be called afterwards.
+    */
+    virtual bool LoadCache(const char * /*file_name*/, uint64_t /*inputs_hash*/) { return false; }
+
     /** @brief Adds camera to a scene
         @param c camera description
         @return New camera handle
@@ -514,4 +549,14 @@ class SceneBase {
     /// Overall BVH node count in scene
     virtual uint32_t node_count() const = 0;
 };
+
+/** @brief Calculates hash of scene inputs used to validate scene cache
+    @param m mesh, material description or raw data
+    @param seed hash of previous inputs (allows chaining of multiple inputs)
+    @return Combined hash value
+*/
+uint64_t HashInputs(const mesh_desc_t &m, uint64_t seed = 0);
+uint64_t HashInputs(const shading_node_desc_t &m, uint64_t seed = 0);
+uint64_t HashInputs(const principled_mat_desc_t &m, uint64_t seed = 0);
+uint64_t HashInputs(Span<const uint8_t> data, uint64_t seed = 0);
 } // namespace Ray
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Minimal JSON reader, just enough to load previously saved benchmark results
+struct JsValue {
+    enum class eType { Null, Bool, Number, String, Array, Object } type = eType::Null;
+
+    bool boolean = false;
+    double number = 0.0;
+    std::string str;
+    std::vector<JsValue> arr;
+    std::map<std::string, JsValue> obj;
+
+    const JsValue *Find(const char *key) const {
+        const auto it = obj.find(key);
+        return it != obj.end() ? &it->second : nullptr;
+    }
+    double NumberOr(const char *key, const double def) const {
+        const JsValue *val = Find(key);
+        return (val && val->type == eType::Number) ? val->number : def;
+    }
+    const char *StringOr(const char *key, const char *def) const {
+        const JsValue *val = Find(key);
+        return (val && val->type == eType::String) ? val->str.c_str() : def;
+    }
+};
+
+class JsReader {
+    const char *p_, *end_;
+
+    void SkipSpaces() {
+        while (p_ != end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r')) {
+            ++p_;
+        }
+    }
+
+    bool Expect(const char c) {
+        SkipSpaces();
+        if (p_ == end_ || *p_ != c) {
+            return false;
+        }
+        ++p_;
+        return true;
+    }
+
+    bool ReadString(std::string &out) {
+        if (!Expect('"')) {
+            return false;
+        }
+        while (p_ != end_ && *p_ != '"') {
+            if (*p_ == '\\') {
+                if (++p_ == end_) {
+                    return false;
+                }
+                // only simple escapes are expected here
+                switch (*p_) {
+                case 'n':
+                    out += '\n';
+                    break;
+                case 't':
+                    out += '\t';
+                    break;
+                default:
+                    out += *p_;
+                }
+            } else {
+                out += *p_;
+            }
+            ++p_;
+        }
+        return p_ != end_ && *(p_++) == '"';
+    }
+
+    bool ReadLiteral(const char *lit) {
+        const size_t len = strlen(lit);
+        if (size_t(end_ - p_) < len || strncmp(p_, lit, len) != 0) {
+            return false;
+        }
+        p_ += len;
+        return true;
+    }
+
+    bool ReadValue(JsValue &out, const int depth) {
+        SkipSpaces();
+        if (p_ == end_ || depth > 64) {
+            return false;
+        }
+        if (*p_ == '{') {
+            out.type = JsValue::eType::Object;
+            ++p_;
+            if (Expect('}')) {
+                return true;
+            }
+            do {
+                std::string key;
+                SkipSpaces();
+                if (!ReadString(key) || !Expect(':') || !ReadValue(out.obj[key], depth + 1)) {
+                    return false;
+                }
+            } while (Expect(','));
+            return Expect('}');
+        } else if (*p_ == '[') {
+            out.type = JsValue::eType::Array;
+            ++p_;
+            if (Expect(']')) {
+                return true;
+            }
+            do {
+                out.arr.emplace_back();
+                if (!ReadValue(out.arr.back(), depth + 1)) {
+                    return false;
+                }
+            } while (Expect(','));
+            return Expect(']');
+        } else if (*p_ == '"') {
+            out.type = JsValue::eType::String;
+            return ReadString(out.str);
+        } else if (*p_ == 't' || *p_ == 'f') {
+            out.type = JsValue::eType::Bool;
+            out.boolean = (*p_ == 't');
+            return ReadLiteral(out.boolean ? "true" : "false");
+        } else if (*p_ == 'n') {
+            out.type = JsValue::eType::Null;
+            return ReadLiteral("null");
+        }
+
+        // strtod needs null-terminated string, which is guaranteed by std::string passed to Parse
+        char *num_end = nullptr;
+        out.type = JsValue::eType::Number;
+        out.number = strtod(p_, &num_end);
+        if (num_end == p_ || num_end > end_) {
+            return false;
+        }
+        p_ = num_end;
+        return true;
+    }
+
+  public:
+    bool Parse(const std::string &str, JsValue &out) {
+        p_ = str.c_str();
+        end_ = p_ + str.size();
+        if (!ReadValue(out, 0)) {
+            return false;
+        }
+        SkipSpaces();
+        return p_ == end_;
+    }
+};
@@ -0,0 +1,484 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+#include "../Ray.h"
+
+#include "../tests/test_scene.h"
+#include "../tests/thread_pool.h"
+#include "../tests/utils.h"
+#include "json.h"
+
+// Renders bundled test scenes with each requested CPU backend and reports per-stage throughput.
+// Must be run from 'tests' folder (test data is loaded from there).
+//
+// Usage: bench_Ray [--arch <name>]... [--scene <name>]... [--samples <count>] [--res <w> <h>] [-j <threads>]
+//                  [--out <file>] [--baseline <file>] [--threshold [<metric>=]<fraction>]...
+
+bool g_stop_on_fail = false;
+std::atomic_bool g_tests_success{true};
+std::atomic_bool g_log_contains_errors{false};
+bool g_catch_flt_exceptions = false;
+bool g_minimal_output = true;
+std::mutex g_stdout_mtx;
+
+namespace {
+const struct {
+    const char *name;
+    eTestScene scene;
+    int min_samples;
+    float variance_threshold; // adaptive sampling leaves converged pixels out of primary ray packets
+} g_scenes[] = {{"standard", eTestScene::Standard, -1, 0.0f},
+                {"sphere_light", eTestScene::Standard_SphereLight, -1, 0.0f},
+                {"mesh_lights", eTestScene::Standard_MeshLights, -1, 0.0f},
+                {"sun_light", eTestScene::Standard_SunLight, -1, 0.0f},
+                {"dof", eTestScene::Standard_DOF0, -1, 0.0f},
+                {"glass_ball", eTestScene::Standard_GlassBall1, -1, 0.0f},
+                {"adaptive", eTestScene::Standard, 8, 0.004f}};
+
+// Meshes used to measure BVH construction time
+const char *g_bvh_meshes[] = {"test_data/meshes/mat_test/base.bin",        "test_data/meshes/mat_test/model.bin",
+                              "test_data/meshes/mat_test/core.bin",        "test_data/meshes/mat_test/subsurf_bar.bin",
+                              "test_data/meshes/mat_test/text.bin",        "test_data/meshes/mat_test/glassball.bin",
+                              "test_data/meshes/mat_test/two_sided.bin",   "test_data/meshes/mat_test/env.bin"};
+
+const char *g_default_archs[] = {"REF", "SSE2", "SSE41", "AVX", "AVX2", "AVX512", "NEON"};
+
+struct stage_t {
+    const char *name;
+    double mrays_per_sec;
+};
+
+struct scene_result_t {
+    std::string scene;
+    double time_ms = 0.0;
+    unsigned long long rays = 0;
+    std::vector<stage_t> stages;
+    double denoise_ms_per_mpix = 0.0;
+    double tex_block_hit_rate = 0.0;
+};
+
+struct arch_result_t {
+    std::string arch;
+    double bvh_build_ms = 0.0;
+    std::vector<scene_result_t> scenes;
+};
+
+double MraysPerSec(const unsigned long long rays, const unsigned long long time_us) {
+    // rays per microsecond are millions of rays per second
+    return time_us ? double(rays) / double(time_us) : 0.0;
+}
+
+std::vector<Ray::RegionContext> CreateRegions(const int w, const int h) {
+    static const int BucketSize = 16;
+
+    std::vector<Ray::RegionContext> regions;
+    for (int y = 0; y < h; y += BucketSize) {
+        for (int x = 0; x < w; x += BucketSize) {
+            regions.emplace_back(Ray::rect_t{x, y, std::min(w - x, BucketSize), std::min(h - y, BucketSize)});
+        }
+    }
+    return regions;
+}
+
+double MeasureBVHBuild(ThreadPool &threads, Ray::RendererBase &renderer) {
+    using namespace std::chrono;
+    using namespace std::placeholders;
+
+    static const int RepeatCount = 3;
+
+    std::vector<std::tuple<std::vector<float>, std::vector<uint32_t>, std::vector<uint32_t>>> meshes;
+    for (const char *file_name : g_bvh_meshes) {
+        meshes.emplace_back(LoadBIN(file_name));
+        if (std::get<1>(meshes.back()).empty()) {
+            fprintf(stderr, "Failed to load %s\n", file_name);
+            meshes.pop_back();
+        }
+    }
+
+    static const float Identity[] = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+                                     0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+
+    // the best of several runs is taken to reduce noise
+    double best_time_ms = 0.0;
+    for (int i = 0; i < RepeatCount; ++i) {
+        auto scene = std::unique_ptr<Ray::SceneBase>(renderer.CreateScene());
+
+        Ray::shading_node_desc_t mat_desc;
+        mat_desc.type = Ray::eShadingNode::Diffuse;
+        const Ray::MaterialHandle mat = scene->AddMaterial(mat_desc);
+
+        const auto time_start = high_resolution_clock::now();
+        for (const auto &mesh : meshes) {
+            const std::vector<float> &attrs = std::get<0>(mesh);
+            const std::vector<uint32_t> &indices = std::get<1>(mesh);
+
+            Ray::mesh_desc_t mesh_desc;
+            mesh_desc.prim_type = Ray::ePrimType::TriangleList;
+            mesh_desc.vtx_positions = {attrs, 0, 8};
+            mesh_desc.vtx_normals = {attrs, 3, 8};
+            mesh_desc.vtx_uvs = {attrs, 6, 8};
+            mesh_desc.vtx_indices = indices;
+
+            const Ray::mat_group_desc_t groups[] = {{mat, 0, indices.size()}};
+            mesh_desc.groups = groups;
+
+            const Ray::MeshHandle mesh_handle = scene->AddMesh(mesh_desc);
+            scene->AddMeshInstance(mesh_handle, Identity);
+        }
+        scene->Finalize(std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, &threads, _1, _2, _3));
+
+        const double time_ms = duration<double, std::milli>{high_resolution_clock::now() - time_start}.count();
+        if (i == 0 || time_ms < best_time_ms) {
+            best_time_ms = time_ms;
+        }
+    }
+    return best_time_ms;
+}
+
+scene_result_t RenderScene(ThreadPool &threads, Ray::RendererBase &renderer, const char *scene_name,
+                           const eTestScene test_scene, const int min_samples, const float variance_threshold,
+                           const int sample_count) {
+    using namespace std::chrono;
+    using namespace std::placeholders;
+
+    Ray::principled_mat_desc_t metal_mat_desc;
+    metal_mat_desc.base_texture = Ray::TextureHandle{0};
+    metal_mat_desc.roughness = 1.0f;
+    metal_mat_desc.roughness_texture = Ray::TextureHandle{2};
+    metal_mat_desc.metallic = 1.0f;
+    metal_mat_desc.metallic_texture = Ray::TextureHandle{3};
+    metal_mat_desc.normal_map = Ray::TextureHandle{1};
+
+    const char *textures[] = {
+        "test_data/textures/gold-scuffed_basecolor-boosted.tga", "test_data/textures/gold-scuffed_normal.tga",
+        "test_data/textures/gold-scuffed_roughness.tga", "test_data/textures/gold-scuffed_metallic.tga"};
+
+    auto scene = std::unique_ptr<Ray::SceneBase>(renderer.CreateScene());
+    setup_test_scene(threads, *scene, min_samples, variance_threshold, metal_mat_desc, textures, test_scene);
+
+    auto parallel_for = std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, &threads, _1, _2, _3);
+
+    const auto sz = renderer.size();
+    std::vector<Ray::RegionContext> regions = CreateRegions(sz.first, sz.second);
+
+    auto render_sample = [&]() {
+        if (renderer.is_spatial_caching_enabled()) {
+            parallel_for(0, int(regions.size()), [&](const int i) { renderer.UpdateSpatialCache(*scene, regions[i]); });
+            renderer.ResolveSpatialCache(*scene, parallel_for);
+        }
+        parallel_for(0, int(regions.size()), [&](const int i) { renderer.RenderScene(*scene, regions[i]); });
+    };
+
+    // warm up caches (first sample also touches all memory for the first time)
+    render_sample();
+    renderer.ResetStats();
+
+    const auto time_start = high_resolution_clock::now();
+    for (int i = 0; i < sample_count; ++i) {
+        render_sample();
+    }
+    const auto time_end = high_resolution_clock::now();
+
+    Ray::RendererBase::stats_t st;
+    renderer.GetStats(st);
+
+    scene_result_t ret;
+    ret.scene = scene_name;
+    ret.time_ms = duration<double, std::milli>{time_end - time_start}.count();
+    ret.rays = st.primary_rays + st.primary_shadow_rays + st.secondary_rays + st.secondary_shadow_rays;
+
+    // total throughput is measured by wall time, stage throughput is per thread (stage times are summed)
+    ret.stages.push_back({"total", ret.time_ms > 0.0 ? double(ret.rays) / (1000.0 * ret.time_ms) : 0.0});
+    ret.stages.push_back({"primary_ray_gen", MraysPerSec(st.primary_rays, st.time_primary_ray_gen_us)});
+    ret.stages.push_back({"primary_trace", MraysPerSec(st.primary_rays, st.time_primary_trace_us)});
+    ret.stages.push_back({"primary_shade", MraysPerSec(st.primary_rays, st.time_primary_shade_us)});
+    ret.stages.push_back({"primary_shadow", MraysPerSec(st.primary_shadow_rays, st.time_primary_shadow_us)});
+    ret.stages.push_back({"secondary_sort", MraysPerSec(st.secondary_rays, st.time_secondary_sort_us)});
+    ret.stages.push_back({"secondary_trace", MraysPerSec(st.secondary_rays, st.time_secondary_trace_us)});
+    ret.stages.push_back({"secondary_shade", MraysPerSec(st.secondary_rays, st.time_secondary_shade_us)});
+    ret.stages.push_back({"secondary_shadow", MraysPerSec(st.secondary_shadow_rays, st.time_secondary_shadow_us)});
+
+    // share of compressed texture fetches served from the decoded blocks cache
+    const unsigned long long tex_block_fetches = st.tex_block_hits + st.tex_block_misses;
+    ret.tex_block_hit_rate = tex_block_fetches ? double(st.tex_block_hits) / double(tex_block_fetches) : 0.0;
+
+    // NLM denoising of the final image (time is per thread, like stage timings)
+    renderer.ResetStats();
+    parallel_for(0, int(regions.size()), [&](const int i) { renderer.DenoiseImage(regions[i]); });
+    renderer.GetStats(st);
+    ret.denoise_ms_per_mpix = (double(st.time_denoise_us) / 1000.0) / (double(sz.first) * sz.second / 1000000.0);
+
+    return ret;
+}
+
+std::string WriteJSON(const std::vector<arch_result_t> &results, const int w, const int h, const int sample_count,
+                      const int threads_count) {
+    std::ostringstream ss;
+    ss.precision(6);
+
+    ss << "{\n";
+    ss << "    \"version\": \"" << Ray::Version() << "\",\n";
+    ss << "    \"width\": " << w << ",\n";
+    ss << "    \"height\": " << h << ",\n";
+    ss << "    \"samples\": " << sample_count << ",\n";
+    ss << "    \"threads\": " << threads_count << ",\n";
+    ss << "    \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const arch_result_t &res = results[i];
+        ss << (i ? ",\n" : "\n") << "        {\n";
+        ss << "            \"arch\": \"" << res.arch << "\",\n";
+        ss << "            \"bvh_build_ms\": " << res.bvh_build_ms << ",\n";
+        ss << "            \"scenes\": [";
+        for (size_t j = 0; j < res.scenes.size(); ++j) {
+            const scene_result_t &sc = res.scenes[j];
+            ss << (j ? ",\n" : "\n") << "                {\n";
+            ss << "                    \"scene\": \"" << sc.scene << "\",\n";
+            ss << "                    \"time_ms\": " << sc.time_ms << ",\n";
+            ss << "                    \"rays\": " << sc.rays << ",\n";
+            ss << "                    \"denoise_ms_per_mpix\": " << sc.denoise_ms_per_mpix << ",\n";
+            ss << "                    \"tex_block_hit_rate\": " << sc.tex_block_hit_rate << ",\n";
+            ss << "                    \"mrays_per_sec\": {";
+            for (size_t k = 0; k < sc.stages.size(); ++k) {
+                ss << (k ? ",\n" : "\n") << "                        \"" << sc.stages[k].name
+                   << "\": " << sc.stages[k].mrays_per_sec;
+            }
+            ss << "\n                    }\n";
+            ss << "                }";
+        }
+        ss << "\n            ]\n";
+        ss << "        }";
+    }
+    ss << "\n    ]\n";
+    ss << "}\n";
+
+    return ss.str();
+}
+
+struct threshold_t {
+    std::string metric; // empty for default
+    double value;
+};
+
+double FindThreshold(const std::vector<threshold_t> &thresholds, const char *metric) {
+    double ret = 0.1;
+    for (const threshold_t &t : thresholds) {
+        if (t.metric.empty() || t.metric == metric) {
+            ret = t.value;
+        }
+    }
+    return ret;
+}
+
+// Returns number of regressed metrics
+int CompareWithBaseline(const std::vector<arch_result_t> &results, const JsValue &baseline,
+                        const std::vector<threshold_t> &thresholds) {
+    int regressions_count = 0;
+
+    // lower_is_better is set for timings, throughput values are compared the other way round
+    auto compare = [&](const char *arch, const char *scene, const char *metric, const double base_val,
+                       const double val, const bool lower_is_better) {
+        if (base_val <= 0.0) {
+            return;
+        }
+        const double threshold = FindThreshold(thresholds, metric);
+        const double change = (val - base_val) / base_val;
+        const bool regressed = lower_is_better ? (change > threshold) : (change < -threshold);
+        fprintf(stderr, "%-8s %-14s %-18s %10.3f -> %10.3f (%+6.1f%%)%s\n", arch, scene, metric, base_val, val,
+                100.0 * change, regressed ? " REGRESSION" : "");
+        regressions_count += regressed ? 1 : 0;
+    };
+
+    const JsValue *base_results = baseline.Find("results");
+    if (!base_results || base_results->type != JsValue::eType::Array) {
+        fprintf(stderr, "Baseline has no results!\n");
+        return 1;
+    }
+
+    for (const arch_result_t &res : results) {
+        const auto base_arch =
+            std::find_if(std::begin(base_results->arr), std::end(base_results->arr),
+                         [&](const JsValue &v) { return res.arch == v.StringOr("arch", ""); });
+        if (base_arch == std::end(base_results->arr)) {
+            fprintf(stderr, "%-8s is missing in baseline (skipped)\n", res.arch.c_str());
+            continue;
+        }
+        compare(res.arch.c_str(), "-", "bvh_build", base_arch->NumberOr("bvh_build_ms", 0.0), res.bvh_build_ms, true);
+
+        const JsValue *base_scenes = base_arch->Find("scenes");
+        for (const scene_result_t &sc : res.scenes) {
+            const JsValue *base_scene = nullptr;
+            for (size_t i = 0; base_scenes && i < base_scenes->arr.size(); ++i) {
+                if (sc.scene == base_scenes->arr[i].StringOr("scene", "")) {
+                    base_scene = &base_scenes->arr[i];
+                }
+            }
+            const JsValue *base_stages = base_scene ? base_scene->Find("mrays_per_sec") : nullptr;
+            if (!base_stages) {
+                fprintf(stderr, "%-8s %-14s is missing in baseline (skipped)\n", res.arch.c_str(), sc.scene.c_str());
+                continue;
+            }
+            for (const stage_t &stage : sc.stages) {
+                compare(res.arch.c_str(), sc.scene.c_str(), stage.name, base_stages->NumberOr(stage.name, 0.0),
+                        stage.mrays_per_sec, false);
+            }
+            compare(res.arch.c_str(), sc.scene.c_str(), "denoise", base_scene->NumberOr("denoise_ms_per_mpix", 0.0),
+                    sc.denoise_ms_per_mpix, true);
+        }
+    }
+
+    return regressions_count;
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+    std::vector<const char *> archs, scenes;
+    const char *out_file = nullptr, *baseline_file = nullptr;
+    std::vector<threshold_t> thresholds;
+    int w = 256, h = 256, sample_count = 64, threads_count = int(std::thread::hardware_concurrency());
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--arch") == 0 && (++i != argc)) {
+            archs.push_back(argv[i]);
+        } else if (strcmp(argv[i], "--scene") == 0 && (++i != argc)) {
+            scenes.push_back(argv[i]);
+        } else if (strcmp(argv[i], "--samples") == 0 && (++i != argc)) {
+            sample_count = atoi(argv[i]);
+        } else if (strcmp(argv[i], "--res") == 0 && (i + 2 < argc)) {
+            w = atoi(argv[++i]);
+            h = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-j") == 0 && (++i != argc)) {
+            threads_count = atoi(argv[i]);
+        } else if (strcmp(argv[i], "--out") == 0 && (++i != argc)) {
+            out_file = argv[i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && (++i != argc)) {
+            baseline_file = argv[i];
+        } else if (strcmp(argv[i], "--threshold") == 0 && (++i != argc)) {
+            const char *delim = strchr(argv[i], '=');
+            if (delim) {
+                thresholds.push_back({std::string(argv[i], size_t(delim - argv[i])), atof(delim + 1)});
+            } else {
+                thresholds.push_back({std::string(), atof(argv[i])});
+            }
+        } else {
+            fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return -1;
+        }
+    }
+
+    if (archs.empty()) {
+        archs.assign(std::begin(g_default_archs), std::end(g_default_archs));
+    }
+    if (scenes.empty()) {
+        for (const auto &sc : g_scenes) {
+            scenes.push_back(sc.name);
+        }
+    }
+    if (w <= 0 || h <= 0 || sample_count <= 0 || threads_count <= 0) {
+        fprintf(stderr, "Invalid arguments!\n");
+        return -1;
+    }
+
+    ThreadPool threads(threads_count);
+
+    std::vector<arch_result_t> results;
+    for (const char *arch : archs) {
+        const Ray::eRendererType rt = Ray::RendererTypeFromName(arch);
+        if ((Ray::RendererGPU & Ray::Bitmask<Ray::eRendererType>{rt}) == rt) {
+            // stage timings are gathered by CPU backends only
+            fprintf(stderr, "%-8s skipped (not a CPU backend)\n", arch);
+            continue;
+        }
+
+        Ray::settings_t s;
+        s.w = w;
+        s.h = h;
+        s.use_hwrt = false;
+
+        using namespace std::placeholders;
+        auto parallel_for = std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, &threads, _1, _2, _3);
+
+        auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+        if (!renderer || renderer->type() != rt) {
+            // skip unsupported (we fell back to some other renderer)
+            fprintf(stderr, "%-8s skipped (not supported)\n", arch);
+            continue;
+        }
+
+        arch_result_t res;
+        res.arch = Ray::RendererTypeName(rt);
+        res.bvh_build_ms = MeasureBVHBuild(threads, *renderer);
+        fprintf(stderr, "%-8s BVH build: %.3f ms\n", res.arch.c_str(), res.bvh_build_ms);
+
+        for (const char *scene_name : scenes) {
+            const int scenes_count = int(sizeof(g_scenes) / sizeof(g_scenes[0]));
+            int scene_index = 0;
+            while (scene_index < scenes_count && strcmp(g_scenes[scene_index].name, scene_name) != 0) {
+                ++scene_index;
+            }
+            if (scene_index == scenes_count) {
+                fprintf(stderr, "Unknown scene: %s\n", scene_name);
+                return -1;
+            }
+
+            res.scenes.push_back(RenderScene(threads, *renderer, g_scenes[scene_index].name,
+                                             g_scenes[scene_index].scene, g_scenes[scene_index].min_samples,
+                                             g_scenes[scene_index].variance_threshold, sample_count));
+
+            const scene_result_t &sc = res.scenes.back();
+            fprintf(stderr, "%-8s %-14s %8.1f ms, %7.2f Mrays/s, denoise %.1f ms/Mpx\n", res.arch.c_str(),
+                    sc.scene.c_str(), sc.time_ms, sc.stages[0].mrays_per_sec, sc.denoise_ms_per_mpix);
+        }
+        results.push_back(std::move(res));
+    }
+
+    if (!g_tests_success || g_log_contains_errors) {
+        fprintf(stderr, "Scene setup failed (see test_data/errors.txt)!\n");
+        return -1;
+    }
+
+    const std::string json = WriteJSON(results, w, h, sample_count, threads_count);
+    if (out_file) {
+        std::ofstream out_stream(out_file, std::ios::binary);
+        out_stream << json;
+        if (!out_stream) {
+            fprintf(stderr, "Failed to write %s\n", out_file);
+            return -1;
+        }
+    } else {
+        fputs(json.c_str(), stdout);
+    }
+
+    if (baseline_file) {
+        std::ifstream in_stream(baseline_file, std::ios::binary);
+        const std::string baseline_str((std::istreambuf_iterator<char>(in_stream)), std::istreambuf_iterator<char>());
+
+        JsValue baseline;
+        if (!in_stream.is_open() || !JsReader{}.Parse(baseline_str, baseline)) {
+            fprintf(stderr, "Failed to read baseline %s\n", baseline_file);
+            return -1;
+        }
+        if (int(baseline.NumberOr("samples", 0)) != sample_count || int(baseline.NumberOr("width", 0)) != w ||
+            int(baseline.NumberOr("height", 0)) != h || int(baseline.NumberOr("threads", 0)) != threads_count) {
+            fprintf(stderr, "Warning: baseline was recorded with different settings!\n");
+        }
+
+        const int regressions_count = CompareWithBaseline(results, baseline, thresholds);
+        if (regressions_count) {
+            fprintf(stderr, "%i metric(s) regressed!\n", regressions_count);
+            return 1;
+        }
+        fprintf(stderr, "No regressions\n");
+    }
+
+    return 0;
+}
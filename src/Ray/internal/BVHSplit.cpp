@@ -6,10 +6,12 @@
 #include <algorithm>
 
 #include "SmallVector.h"
+#include "simd/aligned_allocator.h"
 
 namespace Ray {
 const int BinningThreshold = 1024;
 const int BinsCount = 256;
+const int BinningChunkSize = 16384;
 
 const float SpatialSplitAlpha = 0.00001f;
 const int NumSpatialSplitBins = 256;
@@ -136,7 +138,8 @@ bbox_t GetClippedAABB(const Ref::fvec3 &_v0, const Ref::fvec3 &_v1, const Ref::f
 Ray::split_data_t Ray::SplitPrimitives_SAH(const prim_t *primitives, Span<const uint32_t> prim_indices,
                                            const vtx_attribute_t &positions, const Ref::fvec4 &bbox_min,
                                            const Ref::fvec4 &bbox_max, const Ref::fvec4 &root_min,
-                                           const Ref::fvec4 &root_max, const bvh_settings_t &s) {
+                                           const Ref::fvec4 &root_max, const bvh_settings_t &s,
+                                           const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
     const int num_prims = int(prim_indices.size());
     const bbox_t whole_box = {bbox_min, bbox_max};
 
@@ -166,28 +169,64 @@ Ray::split_data_t Ray::SplitPrimitives_SAH(const prim_t *primitives, Span<const
     bbox_t res_left_bounds, res_right_bounds;
 
     if (num_prims > BinningThreshold) {
+        struct bin_t {
+            bbox_t bounds;
+            int prim_count = 0;
+        };
+
+        float bounds_min[3], bins_scale[3];
         for (int axis = 0; axis < 3; ++axis) {
-            const float bounds_min = whole_box.min[axis];
+            bounds_min[axis] = whole_box.min[axis];
             const float bounds_max = whole_box.max[axis];
-            if (bounds_max - bounds_min < FLT_EPS) {
-                // flat box
-                continue;
-            }
-
-            const float Scale = float(BinsCount) / (bounds_max - bounds_min);
+            // zero scale marks flat box
+            bins_scale[axis] = (bounds_max - bounds_min[axis] < FLT_EPS)
+                                   ? 0.0f
+                                   : float(BinsCount) / (bounds_max - bounds_min[axis]);
+        }
 
-            struct bin_t {
-                bbox_t bounds;
-                int prim_count = 0;
-            } bins[BinsCount];
+        // Primitives are binned in chunks, bins of all chunks are merged afterwards
+        const int chunks_count = (num_prims + BinningChunkSize - 1) / BinningChunkSize;
+        std::vector<bin_t, aligned_allocator<bin_t, alignof(bin_t)>> chunk_bins(size_t(chunks_count) * 3 * BinsCount);
 
-            for (int i = 0; i < num_prims; ++i) {
+        auto bin_chunk = [&](const int chunk) {
+            bin_t *bins = &chunk_bins[size_t(chunk) * 3 * BinsCount];
+            const int beg = chunk * BinningChunkSize, end = std::min(beg + BinningChunkSize, num_prims);
+            for (int i = beg; i < end; ++i) {
                 const prim_t &p = primitives[prim_indices[i]];
-                const int bin_ndx = std::min(BinsCount - 1, int((p.bbox_min[axis] - bounds_min) * Scale));
+                for (int axis = 0; axis < 3; ++axis) {
+                    if (bins_scale[axis] == 0.0f) {
+                        continue;
+                    }
+                    const int bin_ndx =
+                        std::min(BinsCount - 1, int((p.bbox_min[axis] - bounds_min[axis]) * bins_scale[axis]));
 
-                bins[bin_ndx].prim_count++;
-                bins[bin_ndx].bounds.min = min(bins[bin_ndx].bounds.min, p.bbox_min);
-                bins[bin_ndx].bounds.max = max(bins[bin_ndx].bounds.max, p.bbox_max);
+                    bin_t &bin = bins[axis * BinsCount + bin_ndx];
+                    bin.prim_count++;
+                    bin.bounds.min = min(bin.bounds.min, p.bbox_min);
+                    bin.bounds.max = max(bin.bounds.max, p.bbox_max);
+                }
+            }
+        };
+        if (chunks_count > 1) {
+            parallel_for(0, chunks_count, bin_chunk);
+        } else {
+            bin_chunk(0);
+        }
+
+        for (int axis = 0; axis < 3; ++axis) {
+            if (bins_scale[axis] == 0.0f) {
+                // flat box
+                continue;
+            }
+
+            bin_t *bins = &chunk_bins[size_t(axis) * BinsCount];
+            for (int chunk = 1; chunk < chunks_count; ++chunk) {
+                const bin_t *chunk_bin = &chunk_bins[(size_t(chunk) * 3 + axis) * BinsCount];
+                for (int i = 0; i < BinsCount; ++i) {
+                    bins[i].prim_count += chunk_bin[i].prim_count;
+                    bins[i].bounds.min = min(bins[i].bounds.min, chunk_bin[i].bounds.min);
+                    bins[i].bounds.max = max(bins[i].bounds.max, chunk_bin[i].bounds.max);
+                }
             }
 
             float area_left[BinsCount - 1], area_right[BinsCount - 1];
@@ -209,30 +248,67 @@ Ray::split_data_t Ray::SplitPrimitives_SAH(const prim_t *primitives, Span<const
                 area_right[BinsCount - i - 2] = prims_right ? box_right.surface_area() : 0.0f;
             }
 
-            const float scale = (bounds_max - bounds_min) / float(BinsCount);
+            const float scale = (whole_box.max[axis] - bounds_min[axis]) / float(BinsCount);
             for (int i = 0; i < BinsCount - 1; ++i) {
                 const float sah = float(count_left[i]) * area_left[i] + float(count_right[i]) * area_right[i];
                 if (sah < res_sah) {
                     res_sah = sah;
                     div_axis = axis;
-                    div_pos = bounds_min + scale * float(i + 1);
+                    div_pos = bounds_min[axis] + scale * float(i + 1);
                 }
             }
         }
 
         std::vector<uint32_t> left_indices, right_indices;
         if (div_axis != -1) {
-            for (int i = 0; i < num_prims; ++i) {
-                const prim_t &p = primitives[prim_indices[i]];
-                if (p.bbox_min[div_axis] < div_pos) {
-                    left_indices.push_back(prim_indices[i]);
-                    res_left_bounds.min = min(res_left_bounds.min, p.bbox_min);
-                    res_left_bounds.max = max(res_left_bounds.max, p.bbox_max);
-                } else {
-                    right_indices.push_back(prim_indices[i]);
-                    res_right_bounds.min = min(res_right_bounds.min, p.bbox_min);
-                    res_right_bounds.max = max(res_right_bounds.max, p.bbox_max);
+            struct partition_t {
+                std::vector<uint32_t> left_indices, right_indices;
+                bbox_t left_bounds, right_bounds;
+            };
+            std::vector<partition_t, aligned_allocator<partition_t, alignof(partition_t)>> partitions(chunks_count);
+
+            auto partition_chunk = [&](const int chunk) {
+                partition_t &part = partitions[chunk];
+                const int beg = chunk * BinningChunkSize, end = std::min(beg + BinningChunkSize, num_prims);
+                for (int i = beg; i < end; ++i) {
+                    const prim_t &p = primitives[prim_indices[i]];
+                    if (p.bbox_min[div_axis] < div_pos) {
+                        part.left_indices.push_back(prim_indices[i]);
+                        part.left_bounds.min = min(part.left_bounds.min, p.bbox_min);
+                        part.left_bounds.max = max(part.left_bounds.max, p.bbox_max);
+                    } else {
+                        part.right_indices.push_back(prim_indices[i]);
+                        part.right_bounds.min = min(part.right_bounds.min, p.bbox_min);
+                        part.right_bounds.max = max(part.right_bounds.max, p.bbox_max);
+                    }
+                }
+            };
+
+            if (chunks_count > 1) {
+                parallel_for(0, chunks_count, partition_chunk);
+
+                // chunks are merged in order, so result is the same as with sequential partitioning
+                size_t left_count = 0, right_count = 0;
+                for (const partition_t &part : partitions) {
+                    left_count += part.left_indices.size();
+                    right_count += part.right_indices.size();
+                }
+                left_indices.reserve(left_count);
+                right_indices.reserve(right_count);
+                for (const partition_t &part : partitions) {
+                    left_indices.insert(end(left_indices), begin(part.left_indices), end(part.left_indices));
+                    right_indices.insert(end(right_indices), begin(part.right_indices), end(part.right_indices));
+                    res_left_bounds.min = min(res_left_bounds.min, part.left_bounds.min);
+                    res_left_bounds.max = max(res_left_bounds.max, part.left_bounds.max);
+                    res_right_bounds.min = min(res_right_bounds.min, part.right_bounds.min);
+                    res_right_bounds.max = max(res_right_bounds.max, part.right_bounds.max);
                 }
+            } else {
+                partition_chunk(0);
+                left_indices = std::move(partitions[0].left_indices);
+                right_indices = std::move(partitions[0].right_indices);
+                res_left_bounds = partitions[0].left_bounds;
+                res_right_bounds = partitions[0].right_bounds;
             }
         } else {
             left_indices.assign(prim_indices.begin(), prim_indices.end());
@@ -17,9 +17,12 @@ struct split_data_t {
     Ref::fvec4 left_bounds[2], right_bounds[2];
 };
 
+// Binning of large lists is split into chunks which are processed using parallel_for (result does not depend on it)
 split_data_t SplitPrimitives_SAH(const prim_t *primitives, Span<const uint32_t> prim_indices,
                                  const vtx_attribute_t &positions, const Ref::fvec4 &bbox_min,
                                  const Ref::fvec4 &bbox_max, const Ref::fvec4 &root_min,
-                                 const Ref::fvec4 &root_max, const bvh_settings_t &s);
+                                 const Ref::fvec4 &root_max, const bvh_settings_t &s,
+                                 const std::function<void(int, int, ParallelForFunction &&)> &parallel_for =
+                                     parallel_for_serial);
 
 } // namespace Ray
\ No newline at end of file
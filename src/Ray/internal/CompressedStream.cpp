@@ -0,0 +1,147 @@
+#include "CompressedStream.h"
+
+#include <cstring>
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+
+#include "inflate/Deflate.h"
+#include "inflate/Inflate.h"
+
+namespace Ray {
+namespace {
+// values are regrouped in portions of this size (independently of chunk boundaries)
+const size_t ShufflePortion = 64 * 1024;
+// marks chunk stored without compression
+const uint32_t ChunkStoredBit = 0x80000000;
+} // namespace
+} // namespace Ray
+
+void Ray::CompressedWriter::WriteRaw(const uint8_t *data, size_t size) {
+    while (size) {
+        const size_t portion = std::min(size, ChunkSize - chunk_.size());
+        chunk_.insert(chunk_.end(), data, data + portion);
+        if (chunk_.size() == ChunkSize) {
+            FlushChunk();
+        }
+        data += portion;
+        size -= portion;
+    }
+}
+
+void Ray::CompressedWriter::FlushChunk() {
+    if (chunk_.empty()) {
+        return;
+    }
+
+    Deflate(chunk_, packed_);
+
+    uint32_t header[2] = {uint32_t(chunk_.size()), uint32_t(packed_.size())};
+    const std::vector<uint8_t> *payload = &packed_;
+    if (packed_.size() >= chunk_.size()) {
+        // incompressible data
+        header[1] = uint32_t(chunk_.size()) | ChunkStoredBit;
+        payload = &chunk_;
+    }
+
+    out_.write(reinterpret_cast<const char *>(header), sizeof(header));
+    out_.write(reinterpret_cast<const char *>(payload->data()), std::streamsize(payload->size()));
+    failed_ |= !out_.good();
+
+    chunk_.clear();
+}
+
+void Ray::CompressedWriter::Write(const void *_data, size_t size, const int elem_size) {
+    const auto *data = reinterpret_cast<const uint8_t *>(_data);
+    if (elem_size <= 1) {
+        WriteRaw(data, size);
+        return;
+    }
+
+    const size_t count = size / elem_size;
+    for (size_t i = 0; i < count; i += ShufflePortion) {
+        const size_t portion = std::min(count - i, ShufflePortion);
+        shuffled_.resize(portion * elem_size);
+        for (int j = 0; j < elem_size; ++j) {
+            for (size_t k = 0; k < portion; ++k) {
+                shuffled_[j * portion + k] = data[(i + k) * elem_size + j];
+            }
+        }
+        WriteRaw(shuffled_.data(), shuffled_.size());
+    }
+    // trailing bytes (if any) are written as is
+    WriteRaw(data + count * elem_size, size - count * elem_size);
+}
+
+bool Ray::CompressedWriter::Finish() {
+    FlushChunk();
+    out_.flush();
+    return !failed_ && out_.good();
+}
+
+bool Ray::CompressedReader::ReadChunk() {
+    uint32_t header[2];
+    if (!in_.read(reinterpret_cast<char *>(header), sizeof(header))) {
+        return false;
+    }
+
+    const uint32_t raw_size = header[0], packed_size = (header[1] & ~ChunkStoredBit);
+    if (raw_size > CompressedWriter::ChunkSize || packed_size > 2 * CompressedWriter::ChunkSize) {
+        // corrupted data
+        return false;
+    }
+
+    chunk_.resize(raw_size);
+    chunk_pos_ = 0;
+
+    if (header[1] & ChunkStoredBit) {
+        return packed_size == raw_size && in_.read(reinterpret_cast<char *>(chunk_.data()), raw_size);
+    }
+
+    packed_.resize(packed_size);
+    if (!in_.read(reinterpret_cast<char *>(packed_.data()), packed_size)) {
+        return false;
+    }
+
+    Inflater inflater;
+    inflater.Feed(packed_);
+    return inflater.Inflate(chunk_) == int(raw_size);
+}
+
+bool Ray::CompressedReader::ReadRaw(uint8_t *data, size_t size) {
+    while (size && !failed_) {
+        if (chunk_pos_ == chunk_.size() && !ReadChunk()) {
+            failed_ = true;
+            break;
+        }
+        const size_t portion = std::min(size, chunk_.size() - chunk_pos_);
+        memcpy(data, &chunk_[chunk_pos_], portion);
+        chunk_pos_ += portion;
+        data += portion;
+        size -= portion;
+    }
+    return !failed_;
+}
+
+bool Ray::CompressedReader::Read(void *_data, size_t size, const int elem_size) {
+    auto *data = reinterpret_cast<uint8_t *>(_data);
+    if (elem_size <= 1) {
+        return ReadRaw(data, size);
+    }
+
+    const size_t count = size / elem_size;
+    for (size_t i = 0; i < count; i += ShufflePortion) {
+        const size_t portion = std::min(count - i, ShufflePortion);
+        shuffled_.resize(portion * elem_size);
+        if (!ReadRaw(shuffled_.data(), shuffled_.size())) {
+            return false;
+        }
+        for (int j = 0; j < elem_size; ++j) {
+            for (size_t k = 0; k < portion; ++k) {
+                data[(i + k) * elem_size + j] = shuffled_[j * portion + k];
+            }
+        }
+    }
+    return ReadRaw(data + count * elem_size, size - count * elem_size);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+#include <iosfwd>
+#include <vector>
+
+namespace Ray {
+// Stream of independently compressed chunks (memory usage does not depend on the amount of data written)
+class CompressedWriter {
+    std::ostream &out_;
+    std::vector<uint8_t> chunk_, packed_, shuffled_;
+    bool failed_ = false;
+
+    void WriteRaw(const uint8_t *data, size_t size);
+    void FlushChunk();
+
+  public:
+    static const uint32_t ChunkSize = 1024 * 1024;
+
+    explicit CompressedWriter(std::ostream &out) : out_(out) {}
+
+    /** @brief Append data to stream
+        @param elem_size size of single value, bytes of values are regrouped by their significance
+                         (makes floating point data much more compressible)
+    */
+    void Write(const void *data, size_t size, int elem_size = 1);
+
+    /// Flushes pending data, returns false if any write failed
+    bool Finish();
+};
+
+class CompressedReader {
+    std::istream &in_;
+    std::vector<uint8_t> chunk_, packed_, shuffled_;
+    size_t chunk_pos_ = 0;
+    bool failed_ = false;
+
+    bool ReadRaw(uint8_t *data, size_t size);
+    bool ReadChunk();
+
+  public:
+    explicit CompressedReader(std::istream &in) : in_(in) {}
+
+    /// Reads data written with CompressedWriter::Write (elem_size must match), returns false on error
+    bool Read(void *data, size_t size, int elem_size = 1);
+};
+} // namespace Ray
@@ -4,15 +4,50 @@
 
 namespace Ray {
 namespace NS {
-void ClearBorders(const rect_t &rect, int w, int h, bool downscaled, int out_channels, float output[]) {
+force_inline float load_tensor(const float v) { return v; }
+force_inline float load_tensor(const bf16_t v) { return bf16_to_float(v); }
+force_inline float load_tensor(const f16_t v) { return f16_to_float(v); }
+
+template <int S> force_inline fvec<S> load_tensor(const float *p) { return fvec<S>{p}; }
+template <int S> force_inline fvec<S> load_tensor(const bf16_t *p) {
+    static_assert(sizeof(bf16_t) == sizeof(uint16_t), "!");
+    return load_bf16<S>(&p->bits);
+}
+template <int S> force_inline fvec<S> load_tensor(const f16_t *p) {
+    static_assert(sizeof(f16_t) == sizeof(uint16_t), "!");
+    return load_f16<S>(&p->bits);
+}
+
+force_inline void store_tensor(float &dst, const float v) { dst = v; }
+force_inline void store_tensor(bf16_t &dst, const float v) { dst = float_to_bf16(v); }
+force_inline void store_tensor(f16_t &dst, const float v) { dst = float_to_f16(v); }
+
+// Weights are kept either in fp32 or in int8 (quantized symmetrically, per output channel scales follow the biases)
+force_inline float load_weight(const float v) { return v; }
+force_inline float load_weight(const int8_t v) { return float(v); }
+
+template <int S> force_inline fvec<S> load_weights(const float *p) { return fvec<S>{p}; }
+template <int S> force_inline fvec<S> load_weights(const float *p, vector_aligned_tag) {
+    return fvec<S>{p, vector_aligned};
+}
+template <int S> force_inline fvec<S> load_weights(const int8_t *p) { return load_i8<S>(p); }
+template <int S> force_inline fvec<S> load_weights(const int8_t *p, vector_aligned_tag) { return load_i8<S>(p); }
+
+force_inline float weights_scale(const float *, const float *, int, int) { return 1.0f; }
+force_inline float weights_scale(const int8_t *, const float biases[], const int out_channels, const int i) {
+    return biases[out_channels + i];
+}
+
+template <typename T>
+void ClearBorders(const rect_t &rect, int w, int h, bool downscaled, int out_channels, T output[]) {
     if (!downscaled) {
         for (int y = rect.y; y < rect.y + rect.h; ++y) {
             for (int i = 0; i < out_channels; ++i) {
                 if (rect.x == 0) {
-                    output[out_channels * ((y + 1) * (w + 2) + 0) + i] = 0.0f;
+                    output[out_channels * ((y + 1) * (w + 2) + 0) + i] = T{};
                 }
                 if (rect.x + rect.w == w) {
-                    output[out_channels * ((y + 1) * (w + 2) + w + 1) + i] = 0.0f;
+                    output[out_channels * ((y + 1) * (w + 2) + w + 1) + i] = T{};
                 }
             }
         }
@@ -24,10 +59,10 @@ void ClearBorders(const rect_t &rect, int w, int h, bool downscaled, int out_cha
         for (int x = rect_x; x < rect_x + rect_w; ++x) {
             for (int i = 0; i < out_channels; ++i) {
                 if (rect.y == 0) {
-                    output[out_channels * (x + 0) + i] = 0.0f;
+                    output[out_channels * (x + 0) + i] = T{};
                 }
                 if (rect.y + rect.h == h) {
-                    output[out_channels * ((h + 1) * (w + 2) + x + 0) + i] = 0.0f;
+                    output[out_channels * ((h + 1) * (w + 2) + x + 0) + i] = T{};
                 }
             }
         }
@@ -35,10 +70,10 @@ void ClearBorders(const rect_t &rect, int w, int h, bool downscaled, int out_cha
         for (int y = (rect.y / 2); y < (rect.y + rect.h + 1) / 2; ++y) {
             for (int i = 0; i < out_channels; ++i) {
                 if (rect.x == 0) {
-                    output[out_channels * ((y + 1) * ((w + 1) / 2 + 2) + 0) + i] = 0.0f;
+                    output[out_channels * ((y + 1) * ((w + 1) / 2 + 2) + 0) + i] = T{};
                 }
                 if (rect.x + rect.w == w) {
-                    output[out_channels * ((y + 1) * ((w + 1) / 2 + 2) + (w + 1) / 2 + 1) + i] = 0.0f;
+                    output[out_channels * ((y + 1) * ((w + 1) / 2 + 2) + (w + 1) / 2 + 1) + i] = T{};
                 }
             }
         }
@@ -50,10 +85,10 @@ void ClearBorders(const rect_t &rect, int w, int h, bool downscaled, int out_cha
         for (int x = rect_x; x < rect_x + rect_w; ++x) {
             for (int i = 0; i < out_channels; ++i) {
                 if (rect.y == 0) {
-                    output[out_channels * (x + 0) + i] = 0.0f;
+                    output[out_channels * (x + 0) + i] = T{};
                 }
                 if (rect.y + rect.h == h) {
-                    output[out_channels * (((h + 1) / 2 + 1) * ((w + 1) / 2 + 2) + x) + i] = 0.0f;
+                    output[out_channels * (((h + 1) / 2 + 1) * ((w + 1) / 2 + 2) + x) + i] = T{};
                 }
             }
         }
@@ -112,10 +147,10 @@ template <ePostOp PostOp> force_inline float output(float val) {
 } // namespace transfer
 
 template <int RowsPortion, int S, int InChannels, int OutChannels, int OutPxPitch, ePostOp PostOp,
-          eActivation Activation>
-void Convolution3x3_Direct_ProcessRows(int y, const float *__restrict data, const rect_t &rect, int w, int h,
-                                       int stride, const float *__restrict weights, const float *__restrict biases,
-                                       float *__restrict output, const int output_stride) {
+          eActivation Activation, typename TIn, typename TOut, typename TW>
+void Convolution3x3_Direct_ProcessRows(int y, const TIn *__restrict data, const rect_t &rect, int w, int h,
+                                       int stride, const TW *__restrict weights, const float *__restrict biases,
+                                       TOut *__restrict output, const int output_stride) {
     static_assert((InChannels % S) == 0, "!");
     static_assert(RowsPortion <= 8, "!");
 
@@ -139,50 +174,55 @@ void Convolution3x3_Direct_ProcessRows(int y, const float *__restrict data, cons
                 if (RowsPortion == 8) {
                     UNROLLED_FOR(k, 8, {
                         val[k % RowsPortion] =
-                            fmadd(fvec<S>{&weights[i * InChannels * 9 + 0 * InChannels + j], vector_aligned},
-                                  fvec<S>{&data[ii[k + 0] + j]}, val[k % RowsPortion]);
+                            fmadd(load_weights<S>(&weights[i * InChannels * 9 + 0 * InChannels + j], vector_aligned),
+                                  load_tensor<S>(&data[ii[k + 0] + j]), val[k % RowsPortion]);
                         val[k % RowsPortion] =
-                            fmadd(fvec<S>{&weights[i * InChannels * 9 + 3 * InChannels + j], vector_aligned},
-                                  fvec<S>{&data[ii[k + 1] + j]}, val[k % RowsPortion]);
+                            fmadd(load_weights<S>(&weights[i * InChannels * 9 + 3 * InChannels + j], vector_aligned),
+                                  load_tensor<S>(&data[ii[k + 1] + j]), val[k % RowsPortion]);
                         val[k % RowsPortion] =
-                            fmadd(fvec<S>{&weights[i * InChannels * 9 + 6 * InChannels + j], vector_aligned},
-                                  fvec<S>{&data[ii[k + 2] + j]}, val[k % RowsPortion]);
+                            fmadd(load_weights<S>(&weights[i * InChannels * 9 + 6 * InChannels + j], vector_aligned),
+                                  load_tensor<S>(&data[ii[k + 2] + j]), val[k % RowsPortion]);
                     })
                 } else if (RowsPortion == 4) {
                     UNROLLED_FOR(k, 4, {
                         val[k % RowsPortion] =
-                            fmadd(fvec<S>{&weights[i * InChannels * 9 + 0 * InChannels + j], vector_aligned},
-                                  fvec<S>{&data[ii[k + 0] + j]}, val[k % RowsPortion]);
+                            fmadd(load_weights<S>(&weights[i * InChannels * 9 + 0 * InChannels + j], vector_aligned),
+                                  load_tensor<S>(&data[ii[k + 0] + j]), val[k % RowsPortion]);
                         val[k % RowsPortion] =
-                            fmadd(fvec<S>{&weights[i * InChannels * 9 + 3 * InChannels + j], vector_aligned},
-                                  fvec<S>{&data[ii[k + 1] + j]}, val[k % RowsPortion]);
+                            fmadd(load_weights<S>(&weights[i * InChannels * 9 + 3 * InChannels + j], vector_aligned),
+                                  load_tensor<S>(&data[ii[k + 1] + j]), val[k % RowsPortion]);
                         val[k % RowsPortion] =
-                            fmadd(fvec<S>{&weights[i * InChannels * 9 + 6 * InChannels + j], vector_aligned},
-                                  fvec<S>{&data[ii[k + 2] + j]}, val[k % RowsPortion]);
+                            fmadd(load_weights<S>(&weights[i * InChannels * 9 + 6 * InChannels + j], vector_aligned),
+                                  load_tensor<S>(&data[ii[k + 2] + j]), val[k % RowsPortion]);
                     })
                 } else {
                     for (int k = 0; k < RowsPortion; ++k) {
-                        val[k] = fmadd(fvec<S>{&weights[i * InChannels * 9 + 0 * InChannels + j], vector_aligned},
-                                       fvec<S>{&data[ii[k + 0] + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&weights[i * InChannels * 9 + 3 * InChannels + j], vector_aligned},
-                                       fvec<S>{&data[ii[k + 1] + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&weights[i * InChannels * 9 + 6 * InChannels + j], vector_aligned},
-                                       fvec<S>{&data[ii[k + 2] + j]}, val[k]);
+                        val[k] =
+                            fmadd(load_weights<S>(&weights[i * InChannels * 9 + 0 * InChannels + j], vector_aligned),
+                                  load_tensor<S>(&data[ii[k + 0] + j]), val[k]);
+                        val[k] =
+                            fmadd(load_weights<S>(&weights[i * InChannels * 9 + 3 * InChannels + j], vector_aligned),
+                                  load_tensor<S>(&data[ii[k + 1] + j]), val[k]);
+                        val[k] =
+                            fmadd(load_weights<S>(&weights[i * InChannels * 9 + 6 * InChannels + j], vector_aligned),
+                                  load_tensor<S>(&data[ii[k + 2] + j]), val[k]);
                     }
                 }
             }
 
+            const float scale = weights_scale(weights, biases, OutChannels, i);
             for (int k = 0; k < RowsPortion; ++k) {
-                float final_val = biases[i] + hsum(val[k]);
+                float final_val = biases[i] + scale * hsum(val[k]);
                 if (Activation == eActivation::ReLU) {
                     final_val = fmaxf(0.0f, final_val);
                 }
 
                 if (PostOp == ePostOp::Downscale) {
-                    float &out = output[OutPxPitch * (((y + k) / 2) * output_stride + (x / 2)) + i];
-                    out = fmaxf(out, final_val);
+                    TOut &out = output[OutPxPitch * (((y + k) / 2) * output_stride + (x / 2)) + i];
+                    store_tensor(out, fmaxf(load_tensor(out), final_val));
                 } else {
-                    output[OutPxPitch * ((y + k) * output_stride + x) + i] = transfer::output<PostOp>(final_val);
+                    store_tensor(output[OutPxPitch * ((y + k) * output_stride + x) + i],
+                                 transfer::output<PostOp>(final_val));
                 }
             }
         }
@@ -192,11 +232,11 @@ void Convolution3x3_Direct_ProcessRows(int y, const float *__restrict data, cons
 }
 
 template <int RowsPortion, int S, int InChannels1, int InChannels2, int OutChannels, ePreOp PreOp1, ePostOp PostOp,
-          eActivation Activation>
-void ConvolutionConcat3x3_Direct_ProcessRows(int y, const float *__restrict data1, const float *__restrict data2,
+          eActivation Activation, typename T, typename TW>
+void ConvolutionConcat3x3_Direct_ProcessRows(int y, const T *__restrict data1, const T *__restrict data2,
                                              const rect_t &rect, int w, int h, int stride1, int stride2,
-                                             const float *__restrict weights, const float *__restrict biases,
-                                             float *__restrict output, int output_stride) {
+                                             const TW *__restrict weights, const float *__restrict biases,
+                                             T *__restrict output, int output_stride) {
     static_assert((InChannels1 % S) == 0 && (InChannels2 % S) == 0, "!");
     static_assert(RowsPortion <= 8, "!");
 
@@ -237,30 +277,39 @@ void ConvolutionConcat3x3_Direct_ProcessRows(int y, const float *__restrict data
         for (int i = 0; i < OutChannels; ++i) {
             fvec<S> val[8] = {};
 
-            const float *p_weights = &weights[i * (InChannels1 + InChannels2) * 9];
+            const TW *p_weights = &weights[i * (InChannels1 + InChannels2) * 9];
             for (int j = 0; j < InChannels1; j += S) {
                 UNROLLED_FOR(k, 8, {
                     if (k < RowsPortion) {
-                        val[k] = fmadd(fvec<S>{&p_weights[0 * InChannels1 + j], vector_aligned},
-                                       fvec<S>{&data1[ii1[k + 0] + ((add + 0) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[1 * InChannels1 + j], vector_aligned},
-                                       fvec<S>{&data1[ii1[k + 0] + ((add + 1) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[2 * InChannels1 + j], vector_aligned},
-                                       fvec<S>{&data1[ii1[k + 0] + ((add + 2) / div1) * InChannels1 + j]}, val[k]);
-
-                        val[k] = fmadd(fvec<S>{&p_weights[3 * InChannels1 + j], vector_aligned},
-                                       fvec<S>{&data1[ii1[k + 1] + ((add + 0) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[4 * InChannels1 + j], vector_aligned},
-                                       fvec<S>{&data1[ii1[k + 1] + ((add + 1) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[5 * InChannels1 + j], vector_aligned},
-                                       fvec<S>{&data1[ii1[k + 1] + ((add + 2) / div1) * InChannels1 + j]}, val[k]);
-
-                        val[k] = fmadd(fvec<S>{&p_weights[6 * InChannels1 + j], vector_aligned},
-                                       fvec<S>{&data1[ii1[k + 2] + ((add + 0) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[7 * InChannels1 + j], vector_aligned},
-                                       fvec<S>{&data1[ii1[k + 2] + ((add + 1) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[8 * InChannels1 + j], vector_aligned},
-                                       fvec<S>{&data1[ii1[k + 2] + ((add + 2) / div1) * InChannels1 + j]}, val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[0 * InChannels1 + j], vector_aligned),
+                                       load_tensor<S>(&data1[ii1[k + 0] + ((add + 0) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[1 * InChannels1 + j], vector_aligned),
+                                       load_tensor<S>(&data1[ii1[k + 0] + ((add + 1) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[2 * InChannels1 + j], vector_aligned),
+                                       load_tensor<S>(&data1[ii1[k + 0] + ((add + 2) / div1) * InChannels1 + j]),
+                                       val[k]);
+
+                        val[k] = fmadd(load_weights<S>(&p_weights[3 * InChannels1 + j], vector_aligned),
+                                       load_tensor<S>(&data1[ii1[k + 1] + ((add + 0) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[4 * InChannels1 + j], vector_aligned),
+                                       load_tensor<S>(&data1[ii1[k + 1] + ((add + 1) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[5 * InChannels1 + j], vector_aligned),
+                                       load_tensor<S>(&data1[ii1[k + 1] + ((add + 2) / div1) * InChannels1 + j]),
+                                       val[k]);
+
+                        val[k] = fmadd(load_weights<S>(&p_weights[6 * InChannels1 + j], vector_aligned),
+                                       load_tensor<S>(&data1[ii1[k + 2] + ((add + 0) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[7 * InChannels1 + j], vector_aligned),
+                                       load_tensor<S>(&data1[ii1[k + 2] + ((add + 1) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[8 * InChannels1 + j], vector_aligned),
+                                       load_tensor<S>(&data1[ii1[k + 2] + ((add + 2) / div1) * InChannels1 + j]),
+                                       val[k]);
                     }
                 })
             }
@@ -268,40 +317,41 @@ void ConvolutionConcat3x3_Direct_ProcessRows(int y, const float *__restrict data
             for (int j = 0; j < 3 * InChannels2; j += S) {
                 if (RowsPortion == 8) {
                     UNROLLED_FOR(k, 8, {
-                        val[k] = fmadd(fvec<S>{&p_weights[0 * InChannels2 + j], vector_aligned},
-                                       fvec<S>{&data2[ii2[k + 0] + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[3 * InChannels2 + j], vector_aligned},
-                                       fvec<S>{&data2[ii2[k + 1] + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[6 * InChannels2 + j], vector_aligned},
-                                       fvec<S>{&data2[ii2[k + 2] + j]}, val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[0 * InChannels2 + j], vector_aligned),
+                                       load_tensor<S>(&data2[ii2[k + 0] + j]), val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[3 * InChannels2 + j], vector_aligned),
+                                       load_tensor<S>(&data2[ii2[k + 1] + j]), val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[6 * InChannels2 + j], vector_aligned),
+                                       load_tensor<S>(&data2[ii2[k + 2] + j]), val[k]);
                     })
                 } else if (RowsPortion == 4) {
                     UNROLLED_FOR(k, 4, {
-                        val[k] = fmadd(fvec<S>{&p_weights[0 * InChannels2 + j], vector_aligned},
-                                       fvec<S>{&data2[ii2[k + 0] + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[3 * InChannels2 + j], vector_aligned},
-                                       fvec<S>{&data2[ii2[k + 1] + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[6 * InChannels2 + j], vector_aligned},
-                                       fvec<S>{&data2[ii2[k + 2] + j]}, val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[0 * InChannels2 + j], vector_aligned),
+                                       load_tensor<S>(&data2[ii2[k + 0] + j]), val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[3 * InChannels2 + j], vector_aligned),
+                                       load_tensor<S>(&data2[ii2[k + 1] + j]), val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[6 * InChannels2 + j], vector_aligned),
+                                       load_tensor<S>(&data2[ii2[k + 2] + j]), val[k]);
                     })
                 } else {
                     for (int k = 0; k < RowsPortion; ++k) {
-                        val[k] = fmadd(fvec<S>{&p_weights[0 * InChannels2 + j], vector_aligned},
-                                       fvec<S>{&data2[ii2[k + 0] + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[3 * InChannels2 + j], vector_aligned},
-                                       fvec<S>{&data2[ii2[k + 1] + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[6 * InChannels2 + j], vector_aligned},
-                                       fvec<S>{&data2[ii2[k + 2] + j]}, val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[0 * InChannels2 + j], vector_aligned),
+                                       load_tensor<S>(&data2[ii2[k + 0] + j]), val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[3 * InChannels2 + j], vector_aligned),
+                                       load_tensor<S>(&data2[ii2[k + 1] + j]), val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[6 * InChannels2 + j], vector_aligned),
+                                       load_tensor<S>(&data2[ii2[k + 2] + j]), val[k]);
                     }
                 }
             }
 
+            const float scale = weights_scale(weights, biases, OutChannels, i);
             for (int k = 0; k < RowsPortion; ++k) {
-                float final_val = biases[i] + hsum(val[k]);
+                float final_val = biases[i] + scale * hsum(val[k]);
                 if (Activation == eActivation::ReLU) {
                     final_val = fmaxf(0.0f, final_val);
                 }
-                output[OutChannels * ((y + k) * output_stride + x) + i] = final_val;
+                store_tensor(output[OutChannels * ((y + k) * output_stride + x) + i], final_val);
             }
         }
     }
@@ -311,10 +361,10 @@ void ConvolutionConcat3x3_Direct_ProcessRows(int y, const float *__restrict data
 }
 
 template <int S, int InChannels1, int InChannels2, int InChannels3, int PxPitch, int OutChannels, ePreOp PreOp1,
-          ePreOp PreOp2, ePreOp PreOp3, ePostOp PostOp, eActivation Activation>
+          ePreOp PreOp2, ePreOp PreOp3, ePostOp PostOp, eActivation Activation, typename TOut, typename TW>
 void Convolution3x3_GEMM(const float data1[], const float data2[], const float data3[], const rect_t &rect, int in_w,
-                         int in_h, int w, int h, int stride, const float weights[], const float biases[],
-                         float output[], int output_stride) {
+                         int in_h, int w, int h, int stride, const TW weights[], const float biases[],
+                         TOut output[], int output_stride) {
     static_assert(S == 4 || S == 8 || S == 16, "!");
     if (!output_stride) {
         if (PostOp == ePostOp::Downscale) {
@@ -326,8 +376,8 @@ void Convolution3x3_GEMM(const float data1[], const float data2[], const float d
 
     if (PostOp == ePostOp::Downscale) {
         for (int y = (rect.y / 2); y < (rect.y + rect.h + 1) / 2; ++y) {
-            float *ptr = &output[OutChannels * (y * output_stride + (rect.x / 2))];
-            std::fill(ptr, ptr + ((rect.w + 1) / 2) * OutChannels, 0.0f);
+            TOut *ptr = &output[OutChannels * (y * output_stride + (rect.x / 2))];
+            std::fill(ptr, ptr + ((rect.w + 1) / 2) * OutChannels, TOut{});
         }
     }
 
@@ -401,14 +451,17 @@ void Convolution3x3_GEMM(const float data1[], const float data2[], const float d
 
                 int j = 0;
                 for (; j < InChannels * 9 - S + 1; j += S) {
-                    val = fmadd(fvec<S>{&weights[i * InChannels * 9 + j]}, fvec<S>{&input[j], vector_aligned}, val);
+                    val = fmadd(load_weights<S>(&weights[i * InChannels * 9 + j]), fvec<S>{&input[j], vector_aligned},
+                                val);
                 }
 
+                const float scale = weights_scale(weights, biases, OutChannels, i);
+
                 float final_val = biases[i];
-                final_val += hsum(val);
+                final_val += scale * hsum(val);
 
                 for (; j < InChannels * 9; ++j) {
-                    final_val += weights[i * InChannels * 9 + j] * input[j];
+                    final_val += scale * load_weight(weights[i * InChannels * 9 + j]) * input[j];
                 }
 
                 if (Activation == eActivation::ReLU) {
@@ -416,10 +469,10 @@ void Convolution3x3_GEMM(const float data1[], const float data2[], const float d
                 }
 
                 if (PostOp == ePostOp::Downscale) {
-                    float &out = output[OutChannels * ((y / 2) * ((w + 1) / 2) + (x / 2)) + i];
-                    out = fmaxf(out, final_val);
+                    TOut &out = output[OutChannels * ((y / 2) * ((w + 1) / 2) + (x / 2)) + i];
+                    store_tensor(out, fmaxf(load_tensor(out), final_val));
                 } else {
-                    output[OutChannels * (y * output_stride + x) + i] = final_val;
+                    store_tensor(output[OutChannels * (y * output_stride + x) + i], final_val);
                 }
             }
 
@@ -671,12 +724,12 @@ void ConvolutionConcat3x3_GEMM(const float *__restrict data1, const float *__res
 
 template <int RowsPortion, int S, int InChannels1, int InChannels2, int InChannels3, int InChannels4, int PxPitch234,
           int OutChannels, ePreOp PreOp1, ePreOp PreOp2, ePreOp PreOp3, ePreOp PreOp4, ePostOp PostOp,
-          eActivation Activation>
-void ConvolutionConcat3x3_1Direct_2GEMM_ProcessRows(int y, const float data1[], const float data2[],
-                                                    const float data3[], const float data4[], const rect_t &rect, int w,
-                                                    int h, int w234, int h234, int stride1, int stride234,
-                                                    const float *__restrict weights, const float biases[],
-                                                    float *__restrict output, int output_stride) {
+          eActivation Activation, typename T, typename TW>
+void ConvolutionConcat3x3_1Direct_2GEMM_ProcessRows(int y, const T data1[], const float data2[], const float data3[],
+                                                    const float data4[], const rect_t &rect, int w, int h, int w234,
+                                                    int h234, int stride1, int stride234,
+                                                    const TW *__restrict weights, const float biases[],
+                                                    T *__restrict output, int output_stride) {
     const int div1 = (PreOp1 == ePreOp::Upscale) ? 2 : 1;
 
 #define index1(y, x) InChannels1 *((y)*stride1 + (x))
@@ -776,30 +829,39 @@ void ConvolutionConcat3x3_1Direct_2GEMM_ProcessRows(int y, const float data1[],
         for (int i = 0; i < OutChannels; ++i) {
             fvec<S> val[8] = {};
 
-            const float *p_weights = &weights[i * (InChannels1 + InChannels234) * 9];
+            const TW *p_weights = &weights[i * (InChannels1 + InChannels234) * 9];
             for (int j = 0; j < InChannels1; j += S) {
                 UNROLLED_FOR(k, 8, {
                     if (k < RowsPortion) {
-                        val[k] = fmadd(fvec<S>{&p_weights[0 * InChannels1 + j]},
-                                       fvec<S>{&data1[ii1[k + 0] + ((add + 0) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[1 * InChannels1 + j]},
-                                       fvec<S>{&data1[ii1[k + 0] + ((add + 1) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[2 * InChannels1 + j]},
-                                       fvec<S>{&data1[ii1[k + 0] + ((add + 2) / div1) * InChannels1 + j]}, val[k]);
-
-                        val[k] = fmadd(fvec<S>{&p_weights[3 * InChannels1 + j]},
-                                       fvec<S>{&data1[ii1[k + 1] + ((add + 0) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[4 * InChannels1 + j]},
-                                       fvec<S>{&data1[ii1[k + 1] + ((add + 1) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[5 * InChannels1 + j]},
-                                       fvec<S>{&data1[ii1[k + 1] + ((add + 2) / div1) * InChannels1 + j]}, val[k]);
-
-                        val[k] = fmadd(fvec<S>{&p_weights[6 * InChannels1 + j]},
-                                       fvec<S>{&data1[ii1[k + 2] + ((add + 0) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[7 * InChannels1 + j]},
-                                       fvec<S>{&data1[ii1[k + 2] + ((add + 1) / div1) * InChannels1 + j]}, val[k]);
-                        val[k] = fmadd(fvec<S>{&p_weights[8 * InChannels1 + j]},
-                                       fvec<S>{&data1[ii1[k + 2] + ((add + 2) / div1) * InChannels1 + j]}, val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[0 * InChannels1 + j]),
+                                       load_tensor<S>(&data1[ii1[k + 0] + ((add + 0) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[1 * InChannels1 + j]),
+                                       load_tensor<S>(&data1[ii1[k + 0] + ((add + 1) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[2 * InChannels1 + j]),
+                                       load_tensor<S>(&data1[ii1[k + 0] + ((add + 2) / div1) * InChannels1 + j]),
+                                       val[k]);
+
+                        val[k] = fmadd(load_weights<S>(&p_weights[3 * InChannels1 + j]),
+                                       load_tensor<S>(&data1[ii1[k + 1] + ((add + 0) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[4 * InChannels1 + j]),
+                                       load_tensor<S>(&data1[ii1[k + 1] + ((add + 1) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[5 * InChannels1 + j]),
+                                       load_tensor<S>(&data1[ii1[k + 1] + ((add + 2) / div1) * InChannels1 + j]),
+                                       val[k]);
+
+                        val[k] = fmadd(load_weights<S>(&p_weights[6 * InChannels1 + j]),
+                                       load_tensor<S>(&data1[ii1[k + 2] + ((add + 0) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[7 * InChannels1 + j]),
+                                       load_tensor<S>(&data1[ii1[k + 2] + ((add + 1) / div1) * InChannels1 + j]),
+                                       val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[8 * InChannels1 + j]),
+                                       load_tensor<S>(&data1[ii1[k + 2] + ((add + 2) / div1) * InChannels1 + j]),
+                                       val[k]);
                     }
                 })
             }
@@ -810,11 +872,12 @@ void ConvolutionConcat3x3_1Direct_2GEMM_ProcessRows(int y, const float data1[],
             for (; j < InChannels234 * 9 - S + 1; j += S) {
                 UNROLLED_FOR(k, 8, {
                     if (k < RowsPortion) {
-                        val[k] = fmadd(fvec<S>{&p_weights[j]}, fvec<S>{&input234[k][j]}, val[k]);
+                        val[k] = fmadd(load_weights<S>(&p_weights[j]), fvec<S>{&input234[k][j]}, val[k]);
                     }
                 })
             }
 
+            const float scale = weights_scale(weights, biases, OutChannels, i);
             for (int k = 0; k < RowsPortion; ++k) {
                 fvec<S> last_input = 0.0f;
                 UNROLLED_FOR(l, 16, {
@@ -822,13 +885,13 @@ void ConvolutionConcat3x3_1Direct_2GEMM_ProcessRows(int y, const float data1[],
                         last_input.template set<l>(input234[k][j + l]);
                     }
                 })
-                val[k] = fmadd(fvec<S>{&p_weights[j]}, last_input, val[k]);
+                val[k] = fmadd(load_weights<S>(&p_weights[j]), last_input, val[k]);
 
-                float final_val = biases[i] + hsum(val[k]);
+                float final_val = biases[i] + scale * hsum(val[k]);
                 if (Activation == eActivation::ReLU) {
                     final_val = std::max(0.0f, final_val);
                 }
-                output[OutChannels * ((y + k) * output_stride + x) + i] = final_val;
+                store_tensor(output[OutChannels * ((y + k) * output_stride + x) + i], final_val);
             }
         }
 
@@ -7,6 +7,7 @@
 #include <cstring>
 
 #include <deque>
+#include <functional>
 #include <vector>
 
 #include "BVHSplit.h"
@@ -260,7 +261,8 @@ bool Ray::PreprocessTri(const float *p, int stride, tri_accel_t *out_acc) {
 uint32_t Ray::PreprocessMesh(const vtx_attribute_t &positions, Span<const uint32_t> vtx_indices, const int base_vertex,
                              const bvh_settings_t &s, std::vector<bvh_node_t> &out_nodes,
                              aligned_vector<tri_accel_t> &out_tris, std::vector<uint32_t> &out_tri_indices,
-                             aligned_vector<mtri_accel_t> &out_tris2) {
+                             aligned_vector<mtri_accel_t> &out_tris2,
+                             const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
     assert(!vtx_indices.empty() && vtx_indices.size() % 3 == 0);
 
     aligned_vector<prim_t> primitives;
@@ -297,7 +299,7 @@ uint32_t Ray::PreprocessMesh(const vtx_attribute_t &positions, Span<const uint32
     const size_t indices_start = out_tri_indices.size();
     uint32_t num_out_nodes;
     if (!s.use_fast_bvh_build || s.primitive_alignment != 1) {
-        num_out_nodes = PreprocessPrims_SAH(primitives, positions, s, out_nodes, out_tri_indices);
+        num_out_nodes = PreprocessPrims_SAH(primitives, positions, s, out_nodes, out_tri_indices, parallel_for);
     } else {
         num_out_nodes = PreprocessPrims_HLBVH(primitives, out_nodes, out_tri_indices);
     }
@@ -489,34 +491,49 @@ uint32_t Ray::EmitLBVH(const prim_t *prims, const uint32_t *indices, const uint3
     return root_node_index;
 }
 
-uint32_t Ray::PreprocessPrims_SAH(Span<const prim_t> prims, const vtx_attribute_t &positions, const bvh_settings_t &s,
-                                  std::vector<bvh_node_t> &out_nodes, std::vector<uint32_t> &out_indices) {
-    struct prims_coll_t {
-        std::vector<uint32_t> indices;
-        Ref::fvec4 min = {FLT_MAX, FLT_MAX, FLT_MAX, 0.0f}, max = {-FLT_MAX, -FLT_MAX, -FLT_MAX, 0.0f};
-        prims_coll_t() = default;
-        prims_coll_t(std::vector<uint32_t> &&_indices, const Ref::fvec4 &_min, const Ref::fvec4 &_max)
-            : indices(std::move(_indices)), min(_min), max(_max) {}
-    };
+namespace Ray {
+// Lists with less primitives are built as independent subtrees
+const size_t SAHSubtreePrimsThreshold = 4096;
+
+struct prims_coll_t {
+    std::vector<uint32_t> indices;
+    Ref::fvec4 min = {FLT_MAX, FLT_MAX, FLT_MAX, 0.0f}, max = {-FLT_MAX, -FLT_MAX, -FLT_MAX, 0.0f};
+    prims_coll_t() = default;
+    prims_coll_t(std::vector<uint32_t> &&_indices, const Ref::fvec4 &_min, const Ref::fvec4 &_max)
+        : indices(std::move(_indices)), min(_min), max(_max) {}
+};
+
+struct sah_subtree_t {
+    prims_coll_t prims;
+    uint32_t root_index = 0;
+    std::vector<bvh_node_t> nodes;
+    std::vector<uint32_t> indices;
+};
 
+void EmitPrims_SAH(const prim_t *prims, prims_coll_t &&root, const Ref::fvec4 &root_min, const Ref::fvec4 &root_max,
+                   const vtx_attribute_t &positions, const bvh_settings_t &s,
+                   const std::function<void(int, int, ParallelForFunction &&)> &parallel_for,
+                   std::vector<bvh_node_t> &out_nodes, std::vector<uint32_t> &out_indices,
+                   std::vector<sah_subtree_t> *out_subtrees) {
     std::deque<prims_coll_t, aligned_allocator<prims_coll_t, alignof(prims_coll_t)>> prim_lists;
-    prim_lists.emplace_back();
+    prim_lists.emplace_back(std::move(root));
 
     size_t num_nodes = out_nodes.size();
-    const auto root_node_index = uint32_t(num_nodes);
-
-    for (uint32_t j = 0; j < uint32_t(prims.size()); j++) {
-        prim_lists.back().indices.push_back(j);
-        prim_lists.back().min = min(prim_lists.back().min, prims[j].bbox_min);
-        prim_lists.back().max = max(prim_lists.back().max, prims[j].bbox_max);
-    }
-
-    Ref::fvec4 root_min = prim_lists.back().min, root_max = prim_lists.back().max;
 
     while (!prim_lists.empty()) {
+        if (out_subtrees && prim_lists.back().indices.size() <= SAHSubtreePrimsThreshold) {
+            // node is filled later, when subtree is built
+            out_subtrees->emplace_back();
+            out_subtrees->back().prims = std::move(prim_lists.back());
+            out_subtrees->back().root_index = uint32_t(out_nodes.size());
+            out_nodes.emplace_back();
+            prim_lists.pop_back();
+            continue;
+        }
+
         split_data_t split_data =
-            SplitPrimitives_SAH(prims.data(), prim_lists.back().indices, positions, prim_lists.back().min,
-                                prim_lists.back().max, root_min, root_max, s);
+            SplitPrimitives_SAH(prims, prim_lists.back().indices, positions, prim_lists.back().min,
+                                prim_lists.back().max, root_min, root_max, s, parallel_for);
         prim_lists.pop_back();
 
         if (split_data.right_indices.empty()) {
@@ -567,6 +584,65 @@ uint32_t Ray::PreprocessPrims_SAH(Span<const prim_t> prims, const vtx_attribute_
             num_nodes += 2;
         }
     }
+}
+} // namespace Ray
+
+uint32_t Ray::PreprocessPrims_SAH(Span<const prim_t> prims, const vtx_attribute_t &positions, const bvh_settings_t &s,
+                                  std::vector<bvh_node_t> &out_nodes, std::vector<uint32_t> &out_indices,
+                                  const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
+    prims_coll_t root;
+    for (uint32_t j = 0; j < uint32_t(prims.size()); j++) {
+        root.indices.push_back(j);
+        root.min = min(root.min, prims[j].bbox_min);
+        root.max = max(root.max, prims[j].bbox_max);
+    }
+
+    const auto root_node_index = uint32_t(out_nodes.size());
+    const Ref::fvec4 root_min = root.min, root_max = root.max;
+
+    if (size_t(prims.size()) <= SAHSubtreePrimsThreshold) {
+        EmitPrims_SAH(prims.data(), std::move(root), root_min, root_max, positions, s, parallel_for, out_nodes,
+                      out_indices, nullptr);
+        return uint32_t(out_nodes.size() - root_node_index);
+    }
+
+    // Top levels are built sequentially (splitting of large lists is parallelized internally),
+    // smaller lists are deferred and built independently
+    std::vector<sah_subtree_t> subtrees;
+    EmitPrims_SAH(prims.data(), std::move(root), root_min, root_max, positions, s, parallel_for, out_nodes,
+                  out_indices, &subtrees);
+
+    parallel_for(0, int(subtrees.size()), [&](const int i) {
+        sah_subtree_t &st = subtrees[i];
+        EmitPrims_SAH(prims.data(), std::move(st.prims), root_min, root_max, positions, s, parallel_for_serial,
+                      st.nodes, st.indices, nullptr);
+    });
+
+    // Stitch subtrees together (result does not depend on the order of execution)
+    for (const sah_subtree_t &st : subtrees) {
+        while (out_indices.size() % s.primitive_alignment) {
+            out_indices.push_back(out_indices.back());
+        }
+
+        // subtree root goes into reserved node, the rest is appended
+        const auto nodes_offset = uint32_t(out_nodes.size() - 1);
+        const auto indices_offset = uint32_t(out_indices.size());
+        for (size_t i = 0; i < st.nodes.size(); ++i) {
+            bvh_node_t n = st.nodes[i];
+            if (n.prim_index & LEAF_NODE_BIT) {
+                n.prim_index += indices_offset;
+            } else {
+                n.left_child += nodes_offset;
+                n.right_child += nodes_offset;
+            }
+            if (i == 0) {
+                out_nodes[st.root_index] = n;
+            } else {
+                out_nodes.push_back(n);
+            }
+        }
+        out_indices.insert(out_indices.end(), st.indices.begin(), st.indices.end());
+    }
 
     return uint32_t(out_nodes.size() - root_node_index);
 }
@@ -857,6 +933,82 @@ uint32_t Ray::FlattenBVH_r(Span<const bvh_node_t> nodes, const uint32_t node_ind
     return new_node_index;
 }
 
+void Ray::QuantizeBVHNode(const wbvh_node_t &node, qwbvh_node_t &out_node) {
+    memcpy(out_node.child, node.child, sizeof(node.child));
+
+    // leaf node keeps its own bounds in the first slot
+    const bool is_leaf = (node.child[0] & LEAF_NODE_BIT) != 0;
+
+    out_node.child_mask = 0;
+    float bbox_min[3] = {FLT_MAX, FLT_MAX, FLT_MAX}, bbox_max[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (int i = 0; i < 8; ++i) {
+        if (is_leaf ? (i == 0) : (node.child[i] != 0x7fffffff)) {
+            out_node.child_mask |= (1u << i);
+            for (int j = 0; j < 3; ++j) {
+                bbox_min[j] = fminf(bbox_min[j], node.bbox_min[j][i]);
+                bbox_max[j] = fmaxf(bbox_max[j], node.bbox_max[j][i]);
+            }
+        }
+    }
+
+    uint8_t qmin[3][8] = {}, qmax[3][8] = {};
+    for (int j = 0; j < 3; ++j) {
+        if (!out_node.child_mask) {
+            bbox_min[j] = bbox_max[j] = 0.0f;
+        }
+
+        // smallest power-of-two step that covers whole node with 255 steps
+        int exp = 0;
+        frexpf((bbox_max[j] - bbox_min[j]) / 255.0f, &exp);
+        // keep step in normal range
+        exp = std::max(exp, -100);
+        while (bbox_min[j] + 255.0f * ldexpf(1.0f, exp) < bbox_max[j]) {
+            ++exp;
+        }
+        const float step = ldexpf(1.0f, exp);
+
+        out_node.bbox_origin[j] = bbox_min[j];
+        out_node.bbox_exp[j] = int8_t(exp);
+
+        for (int i = 0; i < 8; ++i) {
+            if ((out_node.child_mask & (1u << i)) == 0) {
+                continue;
+            }
+
+            // round conservatively, decoded box must fully enclose the original one
+            int q = int(clamp(floorf((node.bbox_min[j][i] - bbox_min[j]) / step), 0.0f, 255.0f));
+            while (q > 0 && bbox_min[j] + float(q) * step > node.bbox_min[j][i]) {
+                --q;
+            }
+            qmin[j][i] = uint8_t(q);
+
+            q = int(clamp(ceilf((node.bbox_max[j][i] - bbox_min[j]) / step), 0.0f, 255.0f));
+            while (q < 255 && bbox_min[j] + float(q) * step < node.bbox_max[j][i]) {
+                ++q;
+            }
+            qmax[j][i] = uint8_t(q);
+        }
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        out_node.ch_bbox0[i] = uint32_t(qmin[0][i]) | (uint32_t(qmin[1][i]) << 8) | (uint32_t(qmin[2][i]) << 16) |
+                               (uint32_t(qmax[0][i]) << 24);
+        out_node.ch_bbox1[i] = uint32_t(qmax[1][i]) | (uint32_t(qmax[2][i]) << 8);
+    }
+}
+
+void Ray::DequantizeBVHNode(const qwbvh_node_t &node, float out_bbox_min[3][8], float out_bbox_max[3][8]) {
+    for (int j = 0; j < 3; ++j) {
+        const float step = ldexpf(1.0f, node.bbox_exp[j]);
+        for (int i = 0; i < 8; ++i) {
+            const uint32_t qmin = (node.ch_bbox0[i] >> (8 * j)) & 0xff;
+            const uint32_t qmax = (j == 0) ? (node.ch_bbox0[i] >> 24) : ((node.ch_bbox1[i] >> (8 * (j - 1))) & 0xff);
+            out_bbox_min[j][i] = node.bbox_origin[j] + float(qmin) * step;
+            out_bbox_max[j][i] = node.bbox_origin[j] + float(qmax) * step;
+        }
+    }
+}
+
 uint32_t Ray::FlattenLightBVH_r(Span<const light_bvh_node_t> nodes, const uint32_t node_index,
                                 aligned_vector<light_wbvh_node_t> &out_nodes) {
     const light_bvh_node_t &cur_node = nodes[node_index];
@@ -1186,6 +1338,48 @@ uint32_t Ray::FlattenLightBVH_r(Span<const light_bvh_node_t> nodes, const uint32
     return new_node_index;
 }
 
+namespace Ray {
+float surface_area(const bvh_node_t &n) {
+    const float d[3] = {n.bbox_max[0] - n.bbox_min[0], n.bbox_max[1] - n.bbox_min[1], n.bbox_max[2] - n.bbox_min[2]};
+    return 2.0f * (d[0] * d[1] + d[0] * d[2] + d[1] * d[2]);
+}
+} // namespace Ray
+
+float Ray::CalcBVHCost(Span<const bvh_node_t> nodes) {
+    float cost = 0.0f;
+    for (const bvh_node_t &n : nodes) {
+        cost += surface_area(n) * float((n.prim_index & LEAF_NODE_BIT) ? (n.prim_count & PRIM_COUNT_BITS) : 1);
+    }
+    return cost / fmaxf(surface_area(nodes[0]), FLT_EPS);
+}
+
+void Ray::RefitBVH(Span<const prim_t> prims, Span<const uint32_t> indices, Span<bvh_node_t> nodes) {
+    // children are always placed after parent, so tree can be updated bottom-up in one pass
+    for (auto i = uint32_t(nodes.size()); i-- > 0;) {
+        bvh_node_t &n = nodes[i];
+
+        Ref::fvec4 bbox_min = {FLT_MAX, FLT_MAX, FLT_MAX, 0.0f}, bbox_max = {-FLT_MAX, -FLT_MAX, -FLT_MAX, 0.0f};
+        if (n.prim_index & LEAF_NODE_BIT) {
+            const uint32_t prim_index = (n.prim_index & PRIM_INDEX_BITS);
+            for (uint32_t j = prim_index; j < prim_index + (n.prim_count & PRIM_COUNT_BITS); ++j) {
+                const prim_t &p = prims[indices[j]];
+                bbox_min = min(bbox_min, p.bbox_min);
+                bbox_max = max(bbox_max, p.bbox_max);
+            }
+        } else {
+            const bvh_node_t &left = nodes[n.left_child & LEFT_CHILD_BITS],
+                             &right = nodes[n.right_child & RIGHT_CHILD_BITS];
+            bbox_min = min(Ref::fvec4{left.bbox_min[0], left.bbox_min[1], left.bbox_min[2], 0.0f},
+                           Ref::fvec4{right.bbox_min[0], right.bbox_min[1], right.bbox_min[2], 0.0f});
+            bbox_max = max(Ref::fvec4{left.bbox_max[0], left.bbox_max[1], left.bbox_max[2], 0.0f},
+                           Ref::fvec4{right.bbox_max[0], right.bbox_max[1], right.bbox_max[2], 0.0f});
+        }
+
+        memcpy(n.bbox_min, value_ptr(bbox_min), 3 * sizeof(float));
+        memcpy(n.bbox_max, value_ptr(bbox_max), 3 * sizeof(float));
+    }
+}
+
 uint32_t Ray::ConvertToBVH2(Span<const bvh_node_t> nodes, std::vector<bvh2_node_t> &out_nodes) {
     const uint32_t out_index = uint32_t(out_nodes.size());
 
@@ -31,6 +31,11 @@
 #define Ray_InterlockedExchangeAdd(x, y) _InterlockedExchangeAdd((long *)(x), y)
 #define Ray_InterlockedCompareExchange(x, y, z) _InterlockedCompareExchange((long *)(x), y, z)
 #define Ray_InterlockedCompareExchange64(x, y, z) _InterlockedCompareExchange64((long long *)(x), y, z)
+#ifdef _M_IX86
+#define Ray_AtomicLoad64(x) _InterlockedCompareExchange64((long long *)(x), 0, 0)
+#else
+#define Ray_AtomicLoad64(x) (*(volatile long long *)(x))
+#endif
 
 static_assert(sizeof(long) == 4, "!");
 static_assert(sizeof(long long) == 8, "!");
@@ -55,6 +60,7 @@ force_inline unsigned char _BitScanForward64(unsigned long *Index, unsigned __in
 #define Ray_InterlockedExchangeAdd __sync_fetch_and_add
 #define Ray_InterlockedCompareExchange(dst, exch, comp) __sync_val_compare_and_swap(dst, comp, exch)
 #define Ray_InterlockedCompareExchange64(dst, exch, comp) __sync_val_compare_and_swap(dst, comp, exch)
+#define Ray_AtomicLoad64(x) __atomic_load_n(x, __ATOMIC_RELAXED)
 
 #endif
 
@@ -125,6 +131,19 @@ struct alignas(32) wbvh_node_t {
 };
 static_assert(sizeof(wbvh_node_t) == 224, "!");
 
+// Quantized version of wbvh_node_t, child bounds are stored as 8-bit offsets from node origin in power-of-two steps
+// (so they are restored exactly with a single multiply-add). Bounds of each child are interleaved to be loaded for
+// several children at once.
+struct alignas(16) qwbvh_node_t {
+    uint32_t child[8];
+    uint32_t ch_bbox0[8]; // [min.x, min.y, min.z, max.x]
+    uint32_t ch_bbox1[8]; // [max.y, max.z, -, -]
+    float bbox_origin[3];
+    int8_t bbox_exp[3]; // quantization step is 2^bbox_exp
+    uint8_t child_mask; // valid children bits
+};
+static_assert(sizeof(qwbvh_node_t) == 112, "!");
+
 struct light_wbvh_node_t : public wbvh_node_t {
     float flux[8];
     uint32_t axis[8];
@@ -311,7 +330,9 @@ bool PreprocessTri(const float *p, int stride, tri_accel_t *out_acc);
 uint32_t PreprocessMesh(const vtx_attribute_t &positions, Span<const uint32_t> vtx_indices, int base_vertex,
                         const bvh_settings_t &s, std::vector<bvh_node_t> &out_nodes,
                         aligned_vector<tri_accel_t> &out_tris, std::vector<uint32_t> &out_indices,
-                        aligned_vector<mtri_accel_t> &out_tris2);
+                        aligned_vector<mtri_accel_t> &out_tris2,
+                        const std::function<void(int, int, ParallelForFunction &&)> &parallel_for =
+                            parallel_for_serial);
 
 // Recursively builds linear bvh for a set of primitives
 uint32_t EmitLBVH_r(const prim_t *prims, const uint32_t *indices, const uint32_t *morton_codes, uint32_t prim_index,
@@ -320,15 +341,21 @@ uint32_t EmitLBVH_r(const prim_t *prims, const uint32_t *indices, const uint32_t
 uint32_t EmitLBVH(const prim_t *prims, const uint32_t *indices, const uint32_t *morton_codes, uint32_t prim_index,
                   uint32_t prim_count, uint32_t index_offset, int bit_index, std::vector<bvh_node_t> &out_nodes);
 
-// Builds SAH-based BVH for a set of primitives, slow
+// Builds SAH-based BVH for a set of primitives, slow (large sets are split into subtrees built using parallel_for)
 uint32_t PreprocessPrims_SAH(Span<const prim_t> prims, const vtx_attribute_t &positions, const bvh_settings_t &s,
-                             std::vector<bvh_node_t> &out_nodes, std::vector<uint32_t> &out_indices);
+                             std::vector<bvh_node_t> &out_nodes, std::vector<uint32_t> &out_indices,
+                             const std::function<void(int, int, ParallelForFunction &&)> &parallel_for =
+                                 parallel_for_serial);
 
 // Builds linear BVH for a set of primitives, fast
 uint32_t PreprocessPrims_HLBVH(Span<const prim_t> prims, std::vector<bvh_node_t> &out_nodes,
                                std::vector<uint32_t> &out_indices);
 
 uint32_t FlattenBVH_r(Span<const bvh_node_t> nodes, uint32_t node_index, aligned_vector<wbvh_node_t> &out_nodes);
+// Converts wide node into quantized one (decoded child bounds always enclose original ones)
+void QuantizeBVHNode(const wbvh_node_t &node, qwbvh_node_t &out_node);
+// Restores child bounds of quantized node
+void DequantizeBVHNode(const qwbvh_node_t &node, float out_bbox_min[3][8], float out_bbox_max[3][8]);
 uint32_t FlattenLightBVH_r(Span<const light_bvh_node_t> nodes, uint32_t node_index,
                            aligned_vector<light_wbvh_node_t> &out_nodes);
 uint32_t FlattenLightBVH_r(Span<const light_bvh_node_t> nodes, uint32_t node_index,
@@ -336,6 +363,14 @@ uint32_t FlattenLightBVH_r(Span<const light_bvh_node_t> nodes, uint32_t node_ind
 
 uint32_t ConvertToBVH2(Span<const bvh_node_t> nodes, std::vector<bvh2_node_t> &out_nodes);
 
+// Full TLAS rebuild is triggered when tree quality gets worse than this (relative to freshly built tree)
+const float TLASRebuildThreshold = 1.2f;
+
+// SAH cost of the tree (relative to its root)
+float CalcBVHCost(Span<const bvh_node_t> nodes);
+// Recalculates node bounds keeping tree topology (leaf nodes refer to prims through indices)
+void RefitBVH(Span<const prim_t> prims, Span<const uint32_t> indices, Span<bvh_node_t> nodes);
+
 bool NaiivePluckerTest(const float p[9], const float o[3], const float d[3]);
 
 const int FILTER_TABLE_SIZE = 1024;
@@ -419,6 +454,81 @@ force_inline float to_norm_float(uint8_t v) {
     return ret.f - 1.0f;
 }
 
+// Brain floating point value (upper half of fp32), used as reduced-precision storage
+struct bf16_t {
+    uint16_t bits;
+};
+
+force_inline float bf16_to_float(const bf16_t v) {
+    union {
+        uint32_t i;
+        float f;
+    } ret = {uint32_t(v.bits) << 16};
+    return ret.f;
+}
+
+force_inline bf16_t float_to_bf16(const float v) {
+    union {
+        float f;
+        uint32_t i;
+    } val = {v};
+    if ((val.i & 0x7fffffff) > 0x7f800000) {
+        // keep NaN quiet (rounding could turn it into infinity)
+        return bf16_t{uint16_t((val.i >> 16) | 0x0040)};
+    }
+    // round to nearest even
+    val.i += 0x7fff + ((val.i >> 16) & 1);
+    return bf16_t{uint16_t(val.i >> 16)};
+}
+
+// IEEE half-precision value, used as reduced-precision storage
+struct f16_t {
+    uint16_t bits;
+};
+
+force_inline float f16_to_float(const f16_t v) {
+    union {
+        uint32_t i;
+        float f;
+    } ret = {uint32_t(v.bits & 0x7fff) << 13};
+    // rebias exponent with multiplication (handles denormals)
+    ret.f *= 5.192296858534828e+33f; // 2^112
+    if ((v.bits & 0x7fff) > 0x7bff) {
+        ret.i |= 255 << 23; // Inf/NaN
+    }
+    ret.i |= uint32_t(v.bits & 0x8000) << 16;
+    return ret.f;
+}
+
+force_inline f16_t float_to_f16(const float v) {
+    union {
+        float f;
+        uint32_t i;
+    } val = {v};
+    const uint32_t sign = val.i & 0x80000000;
+    val.i ^= sign;
+
+    uint16_t ret;
+    if (val.i >= ((127 + 16) << 23)) {
+        // overflow goes to infinity, NaN is kept quiet
+        ret = (val.i > 0x7f800000) ? 0x7e00 : 0x7c00;
+    } else if (val.i < (113 << 23)) {
+        // denormal (addition of magic value does the rounding)
+        union {
+            uint32_t i;
+            float f;
+        } magic = {((127 - 15) + (23 - 10) + 1) << 23};
+        val.f += magic.f;
+        ret = uint16_t(val.i - magic.i);
+    } else {
+        // rebias exponent and round to nearest even
+        const uint32_t mant_odd = (val.i >> 13) & 1;
+        val.i += (uint32_t(15 - 127) << 23) + 0xfff + mant_odd;
+        ret = uint16_t(val.i >> 13);
+    }
+    return f16_t{uint16_t(ret | (sign >> 16))};
+}
+
 force_inline void rgbe_to_rgb(const uint8_t rgbe[4], float out_rgb[3]) {
     const float f = std::exp2(float(rgbe[3]) - 128.0f);
     out_rgb[0] = to_norm_float(rgbe[0]) * f;
@@ -426,6 +536,47 @@ force_inline void rgbe_to_rgb(const uint8_t rgbe[4], float out_rgb[3]) {
     out_rgb[2] = to_norm_float(rgbe[2]) * f;
 }
 
+// Packed color with shared exponent (9-bit mantissas, 5-bit exponent), holds non-negative values only
+struct rgb9e5_t {
+    uint32_t bits;
+};
+
+force_inline rgb9e5_t rgb_to_rgb9e5(const float rgb[3]) {
+    const float MaxValue = (511.0f / 512.0f) * 65536.0f;
+
+    float c[3];
+    for (int i = 0; i < 3; ++i) {
+        // negative values and NaNs are flushed to zero
+        c[i] = (rgb[i] > 0.0f) ? fminf(rgb[i], MaxValue) : 0.0f;
+    }
+    const float max_c = fmaxf(fmaxf(c[0], c[1]), c[2]);
+
+    int exp;
+    std::frexp(max_c, &exp);
+    int shared_exp = (exp < -15 ? -15 : exp) + 15;
+    float scale = std::ldexp(1.0f, 24 - shared_exp);
+    if (int(max_c * scale + 0.5f) == 512) {
+        ++shared_exp;
+        scale *= 0.5f;
+    }
+
+    uint32_t bits = uint32_t(shared_exp) << 27;
+    for (int i = 0; i < 3; ++i) {
+        bits |= uint32_t(c[i] * scale + 0.5f) << (9 * i);
+    }
+    return rgb9e5_t{bits};
+}
+
+force_inline void rgb9e5_to_rgb(const rgb9e5_t v, float out_rgb[3]) {
+    union {
+        uint32_t i;
+        float f;
+    } scale = {((v.bits >> 27) + 127 - 24) << 23};
+    out_rgb[0] = float(v.bits & 0x1ff) * scale.f;
+    out_rgb[1] = float((v.bits >> 9) & 0x1ff) * scale.f;
+    out_rgb[2] = float((v.bits >> 18) & 0x1ff) * scale.f;
+}
+
 void CanonicalToDir(const float p[2], float y_rotation, float out_d[3]);
 void DirToCanonical(const float d[3], float y_rotation, float out_p[2]);
 
@@ -495,6 +646,52 @@ inline cache_voxel_t unpack_voxel_data(const packed_cache_voxel_t &v) {
     return ret;
 }
 
+// Small direct-mapped buffer that merges contributions to the same voxel locally, so that shared
+// voxels receive one set of atomic additions per flush instead of one per sample
+struct cache_voxel_accum_t {
+    static const int SlotsCount = 64;
+    uint32_t entries[SlotsCount];
+    packed_cache_voxel_t data[SlotsCount];
+
+    cache_voxel_accum_t() {
+        for (int i = 0; i < SlotsCount; ++i) {
+            entries[i] = HASH_GRID_INVALID_CACHE_ENTRY;
+        }
+    }
+};
+
+inline void flush_cache_voxel(packed_cache_voxel_t &voxel, const packed_cache_voxel_t &data) {
+    for (int i = 0; i < 4; ++i) {
+        if (data.v[i]) {
+            Ray_InterlockedExchangeAdd(&voxel.v[i], data.v[i]);
+        }
+    }
+}
+
+inline void accumulate_cache_voxel(cache_voxel_accum_t &accum, Span<packed_cache_voxel_t> voxels,
+                                   const uint32_t cache_entry, const packed_cache_voxel_t &data) {
+    const uint32_t slot = cache_entry % cache_voxel_accum_t::SlotsCount;
+    if (accum.entries[slot] != cache_entry) {
+        if (accum.entries[slot] != HASH_GRID_INVALID_CACHE_ENTRY) {
+            flush_cache_voxel(voxels[accum.entries[slot]], accum.data[slot]);
+        }
+        accum.entries[slot] = cache_entry;
+        accum.data[slot] = {};
+    }
+    for (int i = 0; i < 4; ++i) {
+        accum.data[slot].v[i] += data.v[i];
+    }
+}
+
+inline void flush_cache_voxels(cache_voxel_accum_t &accum, Span<packed_cache_voxel_t> voxels) {
+    for (int i = 0; i < cache_voxel_accum_t::SlotsCount; ++i) {
+        if (accum.entries[i] != HASH_GRID_INVALID_CACHE_ENTRY) {
+            flush_cache_voxel(voxels[accum.entries[i]], accum.data[i]);
+            accum.entries[i] = HASH_GRID_INVALID_CACHE_ENTRY;
+        }
+    }
+}
+
 struct cache_grid_params_t {
     float cam_pos_curr[3] = {0.0f, 0.0f, 0.0f}, cam_pos_prev[3] = {0.0f, 0.0f, 0.0f};
     float log_base = RAD_CACHE_GRID_LOGARITHM_BASE;
@@ -518,6 +715,7 @@ struct scene_data_t {
     const vertex_t *vertices;
     const bvh2_node_t *nodes;
     const wbvh_node_t *wnodes;
+    const qwbvh_node_t *qwnodes;
     const tri_accel_t *tris;
     const uint32_t *tri_indices;
     const mtri_accel_t *mtris;
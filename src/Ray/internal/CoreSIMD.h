@@ -39,6 +39,9 @@ using TexStorageRGB = TexStorageSwizzled<uint8_t, 3>;
 using TexStorageRG = TexStorageSwizzled<uint8_t, 2>;
 using TexStorageR = TexStorageSwizzled<uint8_t, 1>;
 } // namespace Cpu
+// View transform LUTs (defined in TonemapRef.cpp)
+extern const int LUT_DIMS;
+extern const uint32_t *transform_luts[];
 namespace NS {
 // Up to 4x4 rays
 // [ 0] [ 1] [ 4] [ 5]
@@ -170,6 +173,10 @@ void SampleMeshInTextureSpace(int iteration, int obj_index, int uv_layer, const
 template <int S>
 int SortRays_CPU(Span<ray_data_t<S>> rays, const float root_min[3], const float cell_size[3], ivec<S> *hash_values,
                  uint32_t *scan_values, ray_chunk_t *chunks, ray_chunk_t *chunks_temp);
+// Moves packets coherent enough for packet traversal to the front, returns their count
+template <int S>
+int PartitionCoherentRays(Span<ray_data_t<S>> rays, Span<hit_data_t<S>> inters, const float cell_size[3],
+                          bool allow_packets, int out_rays_count[2]);
 template <int S>
 int SortRays_GPU(Span<ray_data_t<S>> rays, const float root_min[3], const float cell_size[3], ivec<S> *hash_values,
                  int *head_flags, uint32_t *scan_values, ray_chunk_t *chunks, ray_chunk_t *chunks_temp,
@@ -210,9 +217,9 @@ bool Traverse_TLAS_WithStack_ClosestHit(const fvec<S> ro[3], const fvec<S> rd[3]
                                         const ivec<S> &ray_mask, const bvh_node_t *nodes, uint32_t node_index,
                                         const mesh_instance_t *mesh_instances, const mesh_t *meshes,
                                         const tri_accel_t *tris, const uint32_t *tri_indices, hit_data_t<S> &inter);
-template <int S>
+template <int S, typename Node>
 bool Traverse_TLAS_WithStack_ClosestHit(const fvec<S> ro[3], const fvec<S> rd[3], const uvec<S> &ray_flags,
-                                        const ivec<S> &ray_mask, const wbvh_node_t *nodes, uint32_t node_index,
+                                        const ivec<S> &ray_mask, const Node *nodes, uint32_t node_index,
                                         const mesh_instance_t *mesh_instances, const mesh_t *meshes,
                                         const mtri_accel_t *mtris, const uint32_t *tri_indices, hit_data_t<S> &inter);
 template <int S>
@@ -221,19 +228,29 @@ ivec<S> Traverse_TLAS_WithStack_AnyHit(const fvec<S> ro[3], const fvec<S> rd[3],
                                        const mesh_instance_t *mesh_instances, const mesh_t *meshes,
                                        const tri_accel_t *tris, const tri_mat_data_t *materials,
                                        const uint32_t *tri_indices, hit_data_t<S> &inter);
-template <int S>
+template <int S, typename Node>
 ivec<S> Traverse_TLAS_WithStack_AnyHit(const fvec<S> ro[3], const fvec<S> rd[3], int ray_type, const ivec<S> &ray_mask,
-                                       const wbvh_node_t *nodes, uint32_t node_index,
+                                       const Node *nodes, uint32_t node_index,
                                        const mesh_instance_t *mesh_instances, const mesh_t *meshes,
                                        const mtri_accel_t *mtris, const tri_mat_data_t *materials,
                                        const uint32_t *tri_indices, hit_data_t<S> &inter);
+// wide bvh traversal with the whole packet visiting the same nodes (pays off for coherent rays only)
+template <int S, typename Node>
+bool Traverse_TLAS_WithStack_ClosestHit_Packet(const fvec<S> ro[3], const fvec<S> rd[3], const uvec<S> &ray_flags,
+                                               const ivec<S> &ray_mask, const Node *nodes, uint32_t node_index,
+                                               const mesh_instance_t *mesh_instances, const mtri_accel_t *mtris,
+                                               const uint32_t *tri_indices, hit_data_t<S> &inter);
+template <int S, typename Node>
+bool Traverse_BLAS_WithStack_ClosestHit_Packet(const fvec<S> ro[3], const fvec<S> rd[3], const ivec<S> &ray_mask,
+                                               const Node *nodes, uint32_t node_index, const mtri_accel_t *mtris,
+                                               int obj_index, hit_data_t<S> &inter);
 // traditional bvh traversal with stack for inner nodes
 template <int S>
 bool Traverse_BLAS_WithStack_ClosestHit(const fvec<S> ro[3], const fvec<S> rd[3], const ivec<S> &ray_mask,
                                         const bvh_node_t *nodes, uint32_t node_index, const tri_accel_t *tris,
                                         const uint32_t *tri_indices, int obj_index, hit_data_t<S> &inter);
-template <int S>
-bool Traverse_BLAS_WithStack_ClosestHit(const float ro[3], const float rd[3], const wbvh_node_t *nodes,
+template <int S, typename Node>
+bool Traverse_BLAS_WithStack_ClosestHit(const float ro[3], const float rd[3], const Node *nodes,
                                         uint32_t node_index, const mtri_accel_t *mtris, const uint32_t *tri_indices,
                                         int &inter_prim_index, float &inter_t, float &inter_u, float &inter_v);
 // returns 0 - no hit, 1 - hit, 2 - solid hit (no need to check for transparency)
@@ -242,8 +259,8 @@ ivec<S> Traverse_BLAS_WithStack_AnyHit(const fvec<S> ro[3], const fvec<S> rd[3],
                                        const bvh_node_t *nodes, uint32_t node_index, const tri_accel_t *tris,
                                        const tri_mat_data_t *materials, const uint32_t *tri_indices, int obj_index,
                                        hit_data_t<S> &inter);
-template <int S>
-int Traverse_BLAS_WithStack_AnyHit(const float ro[3], const float rd[3], const wbvh_node_t *nodes, uint32_t node_index,
+template <int S, typename Node>
+int Traverse_BLAS_WithStack_AnyHit(const float ro[3], const float rd[3], const Node *nodes, uint32_t node_index,
                                    const mtri_accel_t *mtris, const tri_mat_data_t *materials,
                                    const uint32_t *tri_indices, int &inter_prim_index, float &inter_t, float &inter_u,
                                    float &inter_v);
@@ -343,7 +360,7 @@ void SampleLatlong_RGBE(const Cpu::TexStorageRGBA &storage, uint32_t index, cons
 template <int S>
 void IntersectScene(ray_data_t<S> &r, int min_transp_depth, int max_transp_depth, const uint32_t rand_seq[],
                     uint32_t rand_seed, int iteration, const scene_data_t &sc, uint32_t root_index,
-                    const Cpu::TexStorageBase *const textures[], hit_data_t<S> &inter);
+                    bool packet_traversal, const Cpu::TexStorageBase *const textures[], hit_data_t<S> &inter);
 template <int S>
 void IntersectScene(const shadow_ray_t<S> &r, int max_transp_depth, const scene_data_t &sc, uint32_t node_index,
                     const uint32_t rand_seq[], uint32_t rand_seed, int iteration,
@@ -368,8 +385,9 @@ fvec<S> EvalTriLightFactor(const fvec<S> P[3], const fvec<S> ro[3], const ivec<S
 
 template <int S>
 void TraceRays(Span<ray_data_t<S>> rays, int min_transp_depth, int max_transp_depth, const scene_data_t &sc,
-               uint32_t root_index, bool trace_lights, const Cpu::TexStorageBase *const textures[],
-               const uint32_t rand_seq[], uint32_t random_seed, int iteration, Span<hit_data_t<S>> out_inter);
+               uint32_t root_index, bool trace_lights, bool packet_traversal,
+               const Cpu::TexStorageBase *const textures[], const uint32_t rand_seq[], uint32_t random_seed,
+               int iteration, Span<hit_data_t<S>> out_inter);
 template <int S>
 void TraceShadowRays(Span<const shadow_ray_t<S>> rays, int max_transp_depth, float clamp_val, const scene_data_t &sc,
                      uint32_t root_index, const uint32_t rand_seq[], uint32_t random_seed, int iteration,
@@ -507,22 +525,36 @@ void SpatialCacheUpdate(const cache_grid_params_t &params, Span<const hit_data_t
                         Span<packed_cache_voxel_t> voxels_curr);
 
 template <int S, int InChannels, int OutChannels, int OutPxPitch = OutChannels, ePostOp PostOp = ePostOp::None,
-          eActivation Activation = eActivation::ReLU>
-void Convolution3x3_Direct(const float data[], const rect_t &rect, int w, int h, int stride, const float weights[],
-                           const float biases[], float output[], int output_stride);
+          eActivation Activation = eActivation::ReLU, typename TIn, typename TOut, typename TW>
+void Convolution3x3_Direct(const TIn data[], const rect_t &rect, int w, int h, int stride, const TW weights[],
+                           const float biases[], TOut output[], int output_stride);
 
 template <int S, int InChannels1, int InChannels2, int OutChannels, ePreOp PreOp1 = ePreOp::None,
-          ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU>
-void ConvolutionConcat3x3_Direct(const float data1[], const float data2[], const rect_t &rect, int w, int h,
-                                 int stride1, int stride2, const float weights[], const float biases[], float output[],
+          ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU, typename T, typename TW>
+void ConvolutionConcat3x3_Direct(const T data1[], const T data2[], const rect_t &rect, int w, int h, int stride1,
+                                 int stride2, const TW weights[], const float biases[], T output[],
                                  int output_stride);
 template <int S, int InChannels1, int InChannels2, int InChannels3, int InChannels4, int PxPitch2, int OutChannels,
           Ray::ePreOp PreOp1, Ray::ePreOp PreOp2, Ray::ePreOp PreOp3, Ray::ePreOp PreOp4, Ray::ePostOp PostOp,
-          Ray::eActivation Activation>
-void ConvolutionConcat3x3_1Direct_2GEMM(const float data1[], const float data2[], const float data3[],
-                                        const float data4[], const rect_t &rect, int w, int h, int w2, int h2,
-                                        int stride1, int stride2, const float weights[], const float biases[],
-                                        float output[], int output_stride);
+          Ray::eActivation Activation, typename T, typename TW>
+void ConvolutionConcat3x3_1Direct_2GEMM(const T data1[], const float data2[], const float data3[], const float data4[],
+                                        const rect_t &rect, int w, int h, int w2, int h2, int stride1, int stride2,
+                                        const TW weights[], const float biases[], T output[], int output_stride);
+
+// Accumulation of new samples, variance estimation and tonemapping (fused into a single pass over region)
+template <int S>
+void ResolveRegion(const rect_t &rect, int w, int iteration, float exposure, float mix_factor, float half_mix_factor,
+                   bool accumulate_half, eViewTransform view_transform, float inv_gamma, float variance_threshold,
+                   const color_rgba_t new_color[], color_rgba_t full_buf[], color_rgba_t half_buf[],
+                   color_rgba_t raw_filtered_buf[], color_rgba_t variance_buf[], color_rgba_t final_buf[],
+                   uint16_t required_samples[]);
+
+// Denoising
+template <int S, int WINDOW_SIZE = 7, int NEIGHBORHOOD_SIZE = 3>
+void JointNLMFilter(const color_rgba_t input[], const rect_t &rect, int input_stride, float alpha, float damping,
+                    const color_rgba_t variance[], const color_rgba_t feature0[], float feature0_weight,
+                    const color_rgba_t feature1[], float feature1_weight, const rect_t &output_rect, int output_stride,
+                    color_rgba_t output[]);
 
 class SIMDPolicyBase {
   public:
@@ -553,10 +585,11 @@ class SIMDPolicyBase {
 
     static force_inline void TraceRays(Span<RayDataType> rays, int min_transp_depth, int max_transp_depth,
                                        const scene_data_t &sc, uint32_t root_index, bool trace_lights,
-                                       const Cpu::TexStorageBase *const textures[], const uint32_t rand_seq[],
-                                       const uint32_t rand_seed, const int iteration, Span<HitDataType> out_inter) {
-        NS::TraceRays<RPSize>(rays, min_transp_depth, max_transp_depth, sc, root_index, trace_lights, textures,
-                              rand_seq, rand_seed, iteration, out_inter);
+                                       bool packet_traversal, const Cpu::TexStorageBase *const textures[],
+                                       const uint32_t rand_seq[], const uint32_t rand_seed, const int iteration,
+                                       Span<HitDataType> out_inter) {
+        NS::TraceRays<RPSize>(rays, min_transp_depth, max_transp_depth, sc, root_index, trace_lights,
+                              packet_traversal, textures, rand_seq, rand_seed, iteration, out_inter);
     }
 
     static force_inline void TraceShadowRays(Span<const ShadowRayType> rays, int max_transp_depth, float clamp_val,
@@ -574,6 +607,28 @@ class SIMDPolicyBase {
         return NS::SortRays_CPU<RPSize>(rays, root_min, cell_size, hash_values, scan_values, chunks, chunks_temp);
     }
 
+    static force_inline int PartitionCoherentRays(Span<RayDataType> rays, Span<HitDataType> inters,
+                                                  const float cell_size[3], const bool allow_packets,
+                                                  int out_rays_count[2]) {
+        return NS::PartitionCoherentRays<RPSize>(rays, inters, cell_size, allow_packets, out_rays_count);
+    }
+
+    // Rays are stored in packets, only active ones are counted
+    static force_inline int CountActiveRays(Span<const RayDataType> rays) {
+        int count = 0;
+        for (const RayDataType &r : rays) {
+            count += popcount(unsigned(r.mask.movemask()));
+        }
+        return count;
+    }
+    static force_inline int CountActiveRays(Span<const ShadowRayType> rays) {
+        int count = 0;
+        for (const ShadowRayType &r : rays) {
+            count += popcount(unsigned(r.mask.movemask()));
+        }
+        return count;
+    }
+
     static force_inline void ShadePrimary(const pass_settings_t &ps, Span<const HitDataType> inters,
                                           Span<const RayDataType> rays, const uint32_t rand_seq[],
                                           const uint32_t rand_seed, const int iteration,
@@ -630,10 +685,10 @@ class SIMDPolicyBase {
 
     template <int InChannels1, int InChannels2, int InChannels3, int PxPitch, int OutChannels,
               ePreOp PreOp1 = ePreOp::None, ePreOp PreOp2 = ePreOp::None, ePreOp PreOp3 = ePreOp::None,
-              ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU>
+              ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU, typename TOut, typename TW>
     static force_inline void Convolution3x3_GEMM(const float data1[], const float data2[], const float data3[],
                                                  const rect_t &rect, int in_w, int in_h, int w, int h, int stride,
-                                                 const float weights[], const float biases[], float output[],
+                                                 const TW weights[], const float biases[], TOut output[],
                                                  int output_stride) {
         NS::Convolution3x3_GEMM<RPSize, InChannels1, InChannels2, InChannels3, PxPitch, OutChannels, PreOp1, PreOp2,
                                 PreOp3, PostOp, Activation>(data1, data2, data3, rect, in_w, in_h, w, h, stride,
@@ -641,40 +696,63 @@ class SIMDPolicyBase {
     }
 
     template <int InChannels, int OutChannels, int OutPxPitch = OutChannels, ePostOp PostOp = ePostOp::None,
-              eActivation Activation = eActivation::ReLU>
-    static force_inline void Convolution3x3_Direct(const float data[], const rect_t &rect, int w, int h, int stride,
-                                                   const float weights[], const float biases[], float output[],
+              eActivation Activation = eActivation::ReLU, typename TIn, typename TOut, typename TW>
+    static force_inline void Convolution3x3_Direct(const TIn data[], const rect_t &rect, int w, int h, int stride,
+                                                   const TW weights[], const float biases[], TOut output[],
                                                    int output_stride) {
         NS::Convolution3x3_Direct<RPSize, InChannels, OutChannels, OutPxPitch, PostOp, Activation>(
             data, rect, w, h, stride, weights, biases, output, output_stride);
     }
 
     template <int InChannels1, int InChannels2, int OutChannels, ePreOp PreOp1 = ePreOp::None,
-              ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU>
-    static force_inline void ConvolutionConcat3x3_Direct(const float data1[], const float data2[], const rect_t &rect,
-                                                         int w, int h, int stride1, int stride2, const float weights[],
-                                                         const float biases[], float output[], int output_stride) {
+              ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU, typename T, typename TW>
+    static force_inline void ConvolutionConcat3x3_Direct(const T data1[], const T data2[], const rect_t &rect, int w,
+                                                         int h, int stride1, int stride2, const TW weights[],
+                                                         const float biases[], T output[], int output_stride) {
         NS::ConvolutionConcat3x3_Direct<RPSize, InChannels1, InChannels2, OutChannels, PreOp1, PostOp, Activation>(
             data1, data2, rect, w, h, stride1, stride2, weights, biases, output, output_stride);
     }
 
     template <int InChannels1, int InChannels2, int InChannels3, int InChannels4, int PxPitch2, int OutChannels,
               ePreOp PreOp1 = ePreOp::None, ePreOp PreOp2 = ePreOp::None, ePreOp PreOp3 = ePreOp::None,
-              ePreOp PreOp4 = ePreOp::None, ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU>
+              ePreOp PreOp4 = ePreOp::None, ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU,
+              typename T, typename TW>
     static force_inline void
-    ConvolutionConcat3x3_1Direct_2GEMM(const float data1[], const float data2[], const float data3[],
-                                       const float data4[], const rect_t &rect, int w, int h, int w2, int h2,
-                                       int stride1, int stride2, const float weights[], const float biases[],
-                                       float output[], int output_stride) {
+    ConvolutionConcat3x3_1Direct_2GEMM(const T data1[], const float data2[], const float data3[], const float data4[],
+                                       const rect_t &rect, int w, int h, int w2, int h2, int stride1, int stride2,
+                                       const TW weights[], const float biases[], T output[], int output_stride) {
         NS::ConvolutionConcat3x3_1Direct_2GEMM<RPSize, InChannels1, InChannels2, InChannels3, InChannels4, PxPitch2,
                                                OutChannels, PreOp1, PreOp2, PreOp3, PreOp4, PostOp, Activation>(
             data1, data2, data3, data4, rect, w, h, w2, h2, stride1, stride2, weights, biases, output, output_stride);
     }
 
+    template <typename T>
     static force_inline void ClearBorders(const rect_t &rect, int w, int h, bool downscaled, int out_channels,
-                                          float output[]) {
+                                          T output[]) {
         NS::ClearBorders(rect, w, h, downscaled, out_channels, output);
     }
+
+    static force_inline void ResolveRegion(const rect_t &rect, int w, int iteration, float exposure, float mix_factor,
+                                           float half_mix_factor, bool accumulate_half, eViewTransform view_transform,
+                                           float inv_gamma, float variance_threshold, const color_rgba_t new_color[],
+                                           color_rgba_t full_buf[], color_rgba_t half_buf[],
+                                           color_rgba_t raw_filtered_buf[], color_rgba_t variance_buf[],
+                                           color_rgba_t final_buf[], uint16_t required_samples[]) {
+        NS::ResolveRegion<RPSize>(rect, w, iteration, exposure, mix_factor, half_mix_factor, accumulate_half,
+                                  view_transform, inv_gamma, variance_threshold, new_color, full_buf, half_buf,
+                                  raw_filtered_buf, variance_buf, final_buf, required_samples);
+    }
+
+    template <int WINDOW_SIZE, int NEIGHBORHOOD_SIZE>
+    static force_inline void JointNLMFilter(const color_rgba_t input[], const rect_t &rect, int input_stride,
+                                            float alpha, float damping, const color_rgba_t variance[],
+                                            const color_rgba_t feature0[], float feature0_weight,
+                                            const color_rgba_t feature1[], float feature1_weight,
+                                            const rect_t &output_rect, int output_stride, color_rgba_t output[]) {
+        NS::JointNLMFilter<RPSize, WINDOW_SIZE, NEIGHBORHOOD_SIZE>(input, rect, input_stride, alpha, damping, variance,
+                                                                   feature0, feature0_weight, feature1,
+                                                                   feature1_weight, output_rect, output_stride, output);
+    }
 };
 } // namespace NS
 } // namespace Ray
@@ -1044,6 +1122,59 @@ bool IntersectTri<16>(const float ro[3], const float rd[3], const mtri_accel_t &
     return true;
 }
 
+// Intersects whole ray packet with triangles of one block, one triangle at a time
+template <int S>
+bool IntersectTri(const fvec<S> ro[3], const fvec<S> rd[3], const ivec<S> &ray_mask, const mtri_accel_t &tri,
+                  const uint32_t prim_index, const int tri_count, const int obj_index, hit_data_t<S> &inter) {
+    ivec<S> res = 0;
+
+    for (int i = 0; i < tri_count; ++i) {
+        const fvec<S> det = rd[0] * tri.n_plane[0][i] + rd[1] * tri.n_plane[1][i] + rd[2] * tri.n_plane[2][i];
+        const fvec<S> dett = tri.n_plane[3][i] - ro[0] * tri.n_plane[0][i] - ro[1] * tri.n_plane[1][i] -
+                             ro[2] * tri.n_plane[2][i];
+
+        // compare sign bits
+        ivec<S> is_active_lane = ray_mask & ~srai(simd_cast(dett ^ (det * inter.t - dett)), 31);
+        if (is_active_lane.all_zeros()) {
+            continue;
+        }
+
+        const fvec<S> p[3] = {det * ro[0] + dett * rd[0], det * ro[1] + dett * rd[1], det * ro[2] + dett * rd[2]};
+
+        const fvec<S> detu =
+            p[0] * tri.u_plane[0][i] + p[1] * tri.u_plane[1][i] + p[2] * tri.u_plane[2][i] + det * tri.u_plane[3][i];
+
+        // compare sign bits
+        is_active_lane &= ~srai(simd_cast(detu ^ (det - detu)), 31);
+        if (is_active_lane.all_zeros()) {
+            continue;
+        }
+
+        const fvec<S> detv =
+            p[0] * tri.v_plane[0][i] + p[1] * tri.v_plane[1][i] + p[2] * tri.v_plane[2][i] + det * tri.v_plane[3][i];
+
+        // compare sign bits
+        is_active_lane &= ~srai(simd_cast(detv ^ (det - detu - detv)), 31);
+        if (is_active_lane.all_zeros()) {
+            continue;
+        }
+
+        const fvec<S> rdet = safe_inv(det);
+
+        ivec<S> prim = -int(prim_index + i) - 1;
+        where(det < 0.0f, prim) = int(prim_index + i);
+
+        res |= is_active_lane;
+        where(is_active_lane, inter.prim_index) = prim;
+        where(is_active_lane, inter.obj_index) = obj_index;
+        where(is_active_lane, inter.t) = dett * rdet;
+        where(is_active_lane, inter.u) = detu * rdet;
+        where(is_active_lane, inter.v) = detv * rdet;
+    }
+
+    return res.not_all_zeros();
+}
+
 template <int S>
 force_inline ivec<S> bbox_test(const fvec<S> o[3], const fvec<S> inv_d[3], const fvec<S> &t, const float _bbox_min[3],
                                const float _bbox_max[3]) {
@@ -1182,6 +1313,145 @@ force_inline long bbox_test_oct<16>(const float inv_d[3], const float inv_d_o[3]
     return res;
 }
 
+template <int S>
+force_inline long bbox_test_oct(const float inv_d[3], const float inv_d_o[3], const float t, const wbvh_node_t &node,
+                                float out_dist[8]) {
+    return bbox_test_oct<S>(inv_d, inv_d_o, t, node.bbox_min, node.bbox_max, out_dist);
+}
+
+force_inline float qwbvh_step(const int8_t exp) {
+    const uint32_t bits = uint32_t(exp + 127) << 23;
+    float ret;
+    memcpy(&ret, &bits, sizeof(float));
+    return ret;
+}
+
+// Child bounds are decoded straight into slab distances:
+// (origin + q * step) * inv_d - inv_d_o = q * (step * inv_d) + (origin * inv_d - inv_d_o)
+template <int S>
+force_inline long bbox_test_oct(const float inv_d[3], const float inv_d_o[3], const float t, const qwbvh_node_t &node,
+                                float out_dist[8]) {
+    static const int LanesCount = (8 / S);
+
+    float scale[3];
+    fvec<S> offset[3];
+    UNROLLED_FOR(j, 3, {
+        scale[j] = qwbvh_step(node.bbox_exp[j]) * inv_d[j];
+        offset[j] = node.bbox_origin[j] * inv_d[j] - inv_d_o[j];
+    })
+
+    fvec<S> low, high, tmin, tmax;
+    long res = 0;
+
+    UNROLLED_FOR_R(i, LanesCount, {
+        const uvec<S> bbox0 = uvec<S>{&node.ch_bbox0[S * i]};
+        const uvec<S> bbox1 = uvec<S>{&node.ch_bbox1[S * i]};
+
+        low = fmadd(fvec<S>(bbox0 & 0xff), scale[0], offset[0]);
+        high = fmadd(fvec<S>(bbox0 >> 24), scale[0], offset[0]);
+        tmin = min(low, high);
+        tmax = max(low, high);
+
+        low = fmadd(fvec<S>((bbox0 >> 8) & 0xff), scale[1], offset[1]);
+        high = fmadd(fvec<S>(bbox1 & 0xff), scale[1], offset[1]);
+        tmin = max(tmin, min(low, high));
+        tmax = min(tmax, max(low, high));
+
+        low = fmadd(fvec<S>((bbox0 >> 16) & 0xff), scale[2], offset[2]);
+        high = fmadd(fvec<S>((bbox1 >> 8) & 0xff), scale[2], offset[2]);
+        tmin = max(tmin, min(low, high));
+        tmax = min(tmax, max(low, high));
+        tmax *= 1.00000024f;
+
+        const fvec<S> fmask = (tmin <= tmax) & (tmin <= t) & (tmax > 0.0f);
+        res <<= S;
+        res |= simd_cast(fmask).movemask();
+        tmin.store_to(&out_dist[S * i], vector_aligned);
+    })
+
+    // empty children are skipped explicitly as their boxes are not degenerate after decoding
+    return res & node.child_mask;
+}
+
+template <>
+force_inline long bbox_test_oct<16>(const float inv_d[3], const float inv_d_o[3], const float t,
+                                    const qwbvh_node_t &node, float out_dist[8]) {
+    return bbox_test_oct<8>(inv_d, inv_d_o, t, node, out_dist);
+}
+
+// Whole packet is tested against each child box, returns mask of boxes hit by at least one ray
+template <int S>
+force_inline long bbox_test_oct(const fvec<S> inv_d[3], const fvec<S> inv_d_o[3], const fvec<S> &t,
+                                const ivec<S> &ray_mask, const float bbox_min[3][8], const float bbox_max[3][8],
+                                long children, ivec<S> out_mask[8], float out_dist[8]) {
+    long res = 0;
+
+    while (children) {
+        const long i = GetFirstBit(children);
+        children = ClearBit(children, i);
+
+        fvec<S> low, high, tmin, tmax;
+
+        low = fmsub(inv_d[0], bbox_min[0][i], inv_d_o[0]);
+        high = fmsub(inv_d[0], bbox_max[0][i], inv_d_o[0]);
+        tmin = min(low, high);
+        tmax = max(low, high);
+
+        low = fmsub(inv_d[1], bbox_min[1][i], inv_d_o[1]);
+        high = fmsub(inv_d[1], bbox_max[1][i], inv_d_o[1]);
+        tmin = max(tmin, min(low, high));
+        tmax = min(tmax, max(low, high));
+
+        low = fmsub(inv_d[2], bbox_min[2][i], inv_d_o[2]);
+        high = fmsub(inv_d[2], bbox_max[2][i], inv_d_o[2]);
+        tmin = max(tmin, min(low, high));
+        tmax = min(tmax, max(low, high));
+        tmax *= 1.00000024f;
+
+        const ivec<S> mask = simd_cast((tmin <= tmax) & (tmin <= t) & (tmax > 0.0f)) & ray_mask;
+        if (mask.all_zeros()) {
+            continue;
+        }
+
+        // closest entry point is used to order children
+        float dist = FLT_MAX;
+        for (int j = 0; j < S; ++j) {
+            if (mask[j]) {
+                dist = fminf(dist, tmin[j]);
+            }
+        }
+
+        res |= (1l << i);
+        out_mask[i] = mask;
+        out_dist[i] = dist;
+    }
+
+    return res;
+}
+
+template <int S>
+force_inline long bbox_test_oct(const fvec<S> inv_d[3], const fvec<S> inv_d_o[3], const fvec<S> &t,
+                                const ivec<S> &ray_mask, const wbvh_node_t &node, ivec<S> out_mask[8],
+                                float out_dist[8]) {
+    long children = 0;
+    for (int i = 0; i < 8; ++i) {
+        if (node.child[i] != 0x7fffffff) {
+            children |= (1l << i);
+        }
+    }
+    return bbox_test_oct(inv_d, inv_d_o, t, ray_mask, node.bbox_min, node.bbox_max, children, out_mask, out_dist);
+}
+
+template <int S>
+force_inline long bbox_test_oct(const fvec<S> inv_d[3], const fvec<S> inv_d_o[3], const fvec<S> &t,
+                                const ivec<S> &ray_mask, const qwbvh_node_t &node, ivec<S> out_mask[8],
+                                float out_dist[8]) {
+    // decoding cost is shared by all rays of a packet
+    alignas(32) float bbox_min[3][8], bbox_max[3][8];
+    DequantizeBVHNode(node, bbox_min, bbox_max);
+    return bbox_test_oct(inv_d, inv_d_o, t, ray_mask, bbox_min, bbox_max, long(node.child_mask), out_mask, out_dist);
+}
+
 template <int S>
 force_inline void bbox_test_oct(const float p[3], const fvec<S> bbox_min[3], const fvec<S> bbox_max[3],
                                 ivec<S> &out_mask) {
@@ -1299,6 +1569,7 @@ force_inline uint32_t other_child(const bvh_node_t &node, uint32_t cur_child) {
 
 force_inline bool is_leaf_node(const bvh_node_t &node) { return (node.prim_index & LEAF_NODE_BIT) != 0; }
 force_inline bool is_leaf_node(const wbvh_node_t &node) { return (node.child[0] & LEAF_NODE_BIT) != 0; }
+force_inline bool is_leaf_node(const qwbvh_node_t &node) { return (node.child[0] & LEAF_NODE_BIT) != 0; }
 
 template <int S, int StackSize> struct TraversalStateStack_Multi {
     struct {
@@ -1346,6 +1617,12 @@ struct stack_entry_t {
     float dist;
 };
 
+template <int S> struct packet_stack_entry_t {
+    uint32_t index;
+    float dist; // closest entry distance among packet rays
+    ivec<S> mask;
+};
+
 struct light_stack_entry_t {
     uint32_t index;
     float dist;
@@ -2868,117 +3145,140 @@ void Ray::NS::GeneratePrimaryRays(const camera_t &cam, const rect_t &r, int w, i
     const float fov_k = temp * cam.focus_distance;
     const float spread_angle = atanf(2.0f * temp / float(h));
 
-    const auto off_x = ivec<S>{rays_layout_x, vector_aligned}, off_y = ivec<S>{rays_layout_y, vector_aligned};
-
     const int x_res = (r.w + DimX - 1) / DimX, y_res = (r.h + DimY - 1) / DimY;
 
     size_t i = 0;
     out_rays.resize(x_res * y_res);
     out_inters.resize(x_res * y_res);
 
-    for (int y = r.y; y < r.y + r.h; y += DimY) {
-        for (int x = r.x; x < r.x + r.w; x += DimX) {
-            ray_data_t<S> &out_r = out_rays[i];
-
-            const ivec<S> ixx = x + off_x, iyy = y + off_y;
-            const ivec<S> ixx_clamped = min(ixx, w - 1), iyy_clamped = min(iyy, h - 1);
-
-            ivec<S> req_samples = INT_MAX;
-            if (required_samples) {
-                UNROLLED_FOR_S(i, S, {
-                    req_samples.template set<i>(
-                        required_samples[iyy_clamped.template get<i>() * w + ixx_clamped.template get<i>()]);
-                })
-            }
-
-            out_r.mask = (ixx < w) & (iyy < h) & (req_samples >= iteration);
+    auto generate_packet = [&](const ivec<S> &ixx, const ivec<S> &iyy, const ivec<S> &mask) {
+        ray_data_t<S> &out_r = out_rays[i];
+        out_r.mask = mask;
 
-            auto fxx = fvec<S>(ixx), fyy = fvec<S>(iyy);
+        auto fxx = fvec<S>(ixx), fyy = fvec<S>(iyy);
 
-            const uvec<S> px_hash = hash(uvec<S>((ixx << 16) | iyy));
-            const uvec<S> rand_hash = hash_combine(px_hash, rand_seed);
-
-            std::array<fvec<S>, 2> filter_rand =
-                get_scrambled_2d_rand(uvec<S>(uint32_t(RAND_DIM_FILTER)), rand_hash, iteration - 1, rand_seq);
-            if (cam.filter != ePixelFilter::Box) {
-                filter_rand[0] *= float(FILTER_TABLE_SIZE - 1);
-                filter_rand[1] *= float(FILTER_TABLE_SIZE - 1);
-
-                const ivec<S> index_x = min(ivec<S>(filter_rand[0]), FILTER_TABLE_SIZE - 1),
-                              index_y = min(ivec<S>(filter_rand[1]), FILTER_TABLE_SIZE - 1);
-
-                const ivec<S> nindex_x = min(index_x + 1, FILTER_TABLE_SIZE - 1),
-                              nindex_y = min(index_y + 1, FILTER_TABLE_SIZE - 1);
+        const uvec<S> px_hash = hash(uvec<S>((ixx << 16) | iyy));
+        const uvec<S> rand_hash = hash_combine(px_hash, rand_seed);
 
-                const fvec<S> tx = filter_rand[0] - fvec<S>(index_x), ty = filter_rand[1] - fvec<S>(index_y);
+        std::array<fvec<S>, 2> filter_rand =
+            get_scrambled_2d_rand(uvec<S>(uint32_t(RAND_DIM_FILTER)), rand_hash, iteration - 1, rand_seq);
+        if (cam.filter != ePixelFilter::Box) {
+            filter_rand[0] *= float(FILTER_TABLE_SIZE - 1);
+            filter_rand[1] *= float(FILTER_TABLE_SIZE - 1);
 
-                const fvec<S> data0_x = gather(filter_table, index_x), data1_x = gather(filter_table, nindex_x);
-                const fvec<S> data0_y = gather(filter_table, index_y), data1_y = gather(filter_table, nindex_y);
+            const ivec<S> index_x = min(ivec<S>(filter_rand[0]), FILTER_TABLE_SIZE - 1),
+                          index_y = min(ivec<S>(filter_rand[1]), FILTER_TABLE_SIZE - 1);
 
-                filter_rand[0] = (1.0f - tx) * data0_x + tx * data1_x;
-                filter_rand[1] = (1.0f - ty) * data0_y + ty * data1_y;
-            }
+            const ivec<S> nindex_x = min(index_x + 1, FILTER_TABLE_SIZE - 1),
+                          nindex_y = min(index_y + 1, FILTER_TABLE_SIZE - 1);
 
-            fxx += filter_rand[0];
-            fyy += filter_rand[1];
+            const fvec<S> tx = filter_rand[0] - fvec<S>(index_x), ty = filter_rand[1] - fvec<S>(index_y);
 
-            fvec<S> offset[2] = {0.0f, 0.0f};
-            if (cam.fstop > 0.0f) {
-                const std::array<fvec<S>, 2> lens_rand =
-                    get_scrambled_2d_rand(uvec<S>(uint32_t(RAND_DIM_LENS)), rand_hash, iteration - 1, rand_seq);
+            const fvec<S> data0_x = gather(filter_table, index_x), data1_x = gather(filter_table, nindex_x);
+            const fvec<S> data0_y = gather(filter_table, index_y), data1_y = gather(filter_table, nindex_y);
 
-                offset[0] = 2.0f * lens_rand[0] - 1.0f;
-                offset[1] = 2.0f * lens_rand[1] - 1.0f;
+            filter_rand[0] = (1.0f - tx) * data0_x + tx * data1_x;
+            filter_rand[1] = (1.0f - ty) * data0_y + ty * data1_y;
+        }
 
-                fvec<S> r = offset[1], theta = 0.5f * PI - 0.25f * PI * safe_div(offset[0], offset[1]);
-                where(abs(offset[0]) > abs(offset[1]), r) = offset[0];
-                where(abs(offset[0]) > abs(offset[1]), theta) = 0.25f * PI * safe_div(offset[1], offset[0]);
+        fxx += filter_rand[0];
+        fyy += filter_rand[1];
 
-                if (cam.lens_blades) {
-                    r *= ngon_rad(theta, float(cam.lens_blades));
-                }
+        fvec<S> offset[2] = {0.0f, 0.0f};
+        if (cam.fstop > 0.0f) {
+            const std::array<fvec<S>, 2> lens_rand =
+                get_scrambled_2d_rand(uvec<S>(uint32_t(RAND_DIM_LENS)), rand_hash, iteration - 1, rand_seq);
 
-                theta += cam.lens_rotation;
+            offset[0] = 2.0f * lens_rand[0] - 1.0f;
+            offset[1] = 2.0f * lens_rand[1] - 1.0f;
 
-                where(offset[0] != 0.0f & offset[1] != 0.0f, offset[0]) = 0.5f * r * cos(theta) / cam.lens_ratio;
-                where(offset[0] != 0.0f & offset[1] != 0.0f, offset[1]) = 0.5f * r * sin(theta);
+            fvec<S> r = offset[1], theta = 0.5f * PI - 0.25f * PI * safe_div(offset[0], offset[1]);
+            where(abs(offset[0]) > abs(offset[1]), r) = offset[0];
+            where(abs(offset[0]) > abs(offset[1]), theta) = 0.25f * PI * safe_div(offset[1], offset[0]);
 
-                const float coc = 0.5f * (cam.focal_length / cam.fstop);
-                offset[0] *= coc * cam.sensor_height;
-                offset[1] *= coc * cam.sensor_height;
+            if (cam.lens_blades) {
+                r *= ngon_rad(theta, float(cam.lens_blades));
             }
 
-            const fvec<S> _origin[3] = {{cam.origin[0] + cam.side[0] * offset[0] + cam.up[0] * offset[1]},
-                                        {cam.origin[1] + cam.side[1] * offset[0] + cam.up[1] * offset[1]},
-                                        {cam.origin[2] + cam.side[2] * offset[0] + cam.up[2] * offset[1]}};
+            theta += cam.lens_rotation;
 
-            fvec<S> _d[3], _dx[3], _dy[3];
-            get_pix_dirs(float(w), float(h), cam, k, fov_k, fxx, fyy, _origin, _d);
-            get_pix_dirs(float(w), float(h), cam, k, fov_k, fxx + 1.0f, fyy, _origin, _dx);
-            get_pix_dirs(float(w), float(h), cam, k, fov_k, fxx, fyy + 1.0f, _origin, _dy);
+            where(offset[0] != 0.0f & offset[1] != 0.0f, offset[0]) = 0.5f * r * cos(theta) / cam.lens_ratio;
+            where(offset[0] != 0.0f & offset[1] != 0.0f, offset[1]) = 0.5f * r * sin(theta);
 
-            const fvec<S> clip_start = cam.clip_start / dot3(_d, cam.fwd);
+            const float coc = 0.5f * (cam.focal_length / cam.fstop);
+            offset[0] *= coc * cam.sensor_height;
+            offset[1] *= coc * cam.sensor_height;
+        }
 
-            for (int j = 0; j < 3; j++) {
-                out_r.d[j] = _d[j];
-                out_r.o[j] = _origin[j] + _d[j] * clip_start;
-                out_r.c[j] = {1.0f};
-            }
+        const fvec<S> _origin[3] = {{cam.origin[0] + cam.side[0] * offset[0] + cam.up[0] * offset[1]},
+                                    {cam.origin[1] + cam.side[1] * offset[0] + cam.up[1] * offset[1]},
+                                    {cam.origin[2] + cam.side[2] * offset[0] + cam.up[2] * offset[1]}};
 
-            // air ior is implicit
-            out_r.ior[0] = out_r.ior[1] = out_r.ior[2] = out_r.ior[3] = -1.0f;
+        fvec<S> _d[3], _dx[3], _dy[3];
+        get_pix_dirs(float(w), float(h), cam, k, fov_k, fxx, fyy, _origin, _d);
+        get_pix_dirs(float(w), float(h), cam, k, fov_k, fxx + 1.0f, fyy, _origin, _dx);
+        get_pix_dirs(float(w), float(h), cam, k, fov_k, fxx, fyy + 1.0f, _origin, _dy);
 
-            out_r.cone_width = 0.0f;
-            out_r.cone_spread = spread_angle;
+        const fvec<S> clip_start = cam.clip_start / dot3(_d, cam.fwd);
 
-            out_r.pdf = {1e6f};
-            out_r.xy = uvec<S>((ixx << 16) | iyy);
-            out_r.depth = pack_ray_type(RAY_TYPE_CAMERA);
-            out_r.depth |= pack_depth(ivec<S>{0}, ivec<S>{0}, ivec<S>{0}, ivec<S>{0});
+        for (int j = 0; j < 3; j++) {
+            out_r.d[j] = _d[j];
+            out_r.o[j] = _origin[j] + _d[j] * clip_start;
+            out_r.c[j] = {1.0f};
+        }
 
-            hit_data_t<S> &out_i = out_inters[i++];
-            out_i = {};
-            out_i.t = (cam.clip_end / dot3(_d, cam.fwd)) - clip_start;
+        // air ior is implicit
+        out_r.ior[0] = out_r.ior[1] = out_r.ior[2] = out_r.ior[3] = -1.0f;
+
+        out_r.cone_width = 0.0f;
+        out_r.cone_spread = spread_angle;
+
+        out_r.pdf = {1e6f};
+        out_r.xy = uvec<S>((ixx << 16) | iyy);
+        out_r.depth = pack_ray_type(RAY_TYPE_CAMERA);
+        out_r.depth |= pack_depth(ivec<S>{0}, ivec<S>{0}, ivec<S>{0}, ivec<S>{0});
+
+        hit_data_t<S> &out_i = out_inters[i++];
+        out_i = {};
+        out_i.t = (cam.clip_end / dot3(_d, cam.fwd)) - clip_start;
+    };
+
+    // Active pixels are compacted within tiles of 2x2 blocks, so converged pixels do not occupy lanes while
+    // packets still cover a small screen area (when all pixels are active the layout is one packet per block)
+    const int TileW = 2 * DimX, TileH = 2 * DimY;
+    alignas(64) int active_x[4 * S], active_y[4 * S];
+
+    for (int ty = r.y; ty < r.y + r.h; ty += TileH) {
+        for (int tx = r.x; tx < r.x + r.w; tx += TileW) {
+            int active_count = 0;
+            for (int y = ty; y < std::min(ty + TileH, r.y + r.h); y += DimY) {
+                for (int x = tx; x < std::min(tx + TileW, r.x + r.w); x += DimX) {
+                    for (int j = 0; j < S; ++j) {
+                        const int xx = x + rays_layout_x[j], yy = y + rays_layout_y[j];
+                        if (xx >= w || yy >= h) {
+                            continue;
+                        }
+                        if (required_samples && required_samples[yy * w + xx] < iteration) {
+                            // pixel is converged
+                            continue;
+                        }
+                        active_x[active_count] = xx;
+                        active_y[active_count++] = yy;
+                    }
+                }
+            }
+            if (!active_count) {
+                continue;
+            }
+            // inactive lanes of the last packet repeat the last active pixel
+            for (int j = active_count; j < S * ((active_count + S - 1) / S); ++j) {
+                active_x[j] = active_x[active_count - 1];
+                active_y[j] = active_y[active_count - 1];
+            }
+            for (int j = 0; j < active_count; j += S) {
+                const ivec<S> lane = ivec<S>{ascending_counter, vector_aligned} + j;
+                generate_packet(ivec<S>{&active_x[j]}, ivec<S>{&active_y[j]}, lane < active_count);
+            }
         }
     }
 
@@ -3208,6 +3508,46 @@ int Ray::NS::SortRays_CPU(Span<ray_data_t<S>> rays, const float root_min[3], con
     return rays_count;
 }
 
+template <int S>
+int Ray::NS::PartitionCoherentRays(Span<ray_data_t<S>> rays, Span<hit_data_t<S>> inters, const float cell_size[3],
+                                   const bool allow_packets, int out_rays_count[2]) {
+    // Thresholds are picked empirically, packet traversal loses quickly as rays start to diverge
+    const float MinDirCos = 0.998f;
+    const float MaxOriginDist = 0.25f; // fraction of ray sorting cell
+
+    int coherent_count = 0;
+    out_rays_count[0] = out_rays_count[1] = 0;
+
+    for (int i = 0; i < int(rays.size()); ++i) {
+        const ray_data_t<S> &r = rays[i];
+
+        const long mask = r.mask.movemask();
+        const int active_count = popcount(unsigned(mask));
+
+        bool is_coherent = allow_packets && active_count >= S / 2;
+        if (is_coherent) {
+            // all rays are compared against the first active one
+            const long first = GetFirstBit(mask);
+
+            const fvec<S> cos_angle = r.d[0] * r.d[0][first] + r.d[1] * r.d[1][first] + r.d[2] * r.d[2][first];
+            ivec<S> diverged = simd_cast(cos_angle < MinDirCos);
+            UNROLLED_FOR(j, 3, {
+                diverged |= simd_cast(abs(r.o[j] - r.o[j][first]) > MaxOriginDist * cell_size[j]);
+            })
+            is_coherent = (diverged & r.mask).all_zeros();
+        }
+
+        out_rays_count[is_coherent] += active_count;
+        if (is_coherent) {
+            std::swap(rays[coherent_count], rays[i]);
+            std::swap(inters[coherent_count], inters[i]);
+            ++coherent_count;
+        }
+    }
+
+    return coherent_count;
+}
+
 template <int S>
 int Ray::NS::SortRays_GPU(Span<ray_data_t<S>> rays, const float root_min[3], const float cell_size[3],
                           ivec<S> *hash_values, int *head_flags, uint32_t *scan_values, ray_chunk_t *chunks,
@@ -3570,9 +3910,9 @@ bool Ray::NS::Traverse_TLAS_WithStack_ClosestHit(const fvec<S> ro[3], const fvec
     return res;
 }
 
-template <int S>
+template <int S, typename Node>
 bool Ray::NS::Traverse_TLAS_WithStack_ClosestHit(const fvec<S> ro[3], const fvec<S> rd[3], const uvec<S> &ray_flags,
-                                                 const ivec<S> &ray_mask, const wbvh_node_t *nodes, uint32_t node_index,
+                                                 const ivec<S> &ray_mask, const Node *nodes, uint32_t node_index,
                                                  const mesh_instance_t *mesh_instances, const mesh_t *meshes,
                                                  const mtri_accel_t *mtris, const uint32_t *tri_indices,
                                                  hit_data_t<S> &inter) {
@@ -3624,8 +3964,7 @@ bool Ray::NS::Traverse_TLAS_WithStack_ClosestHit(const fvec<S> ro[3], const fvec
         TRAVERSE:
             if (!is_leaf_node(nodes[cur.index])) {
                 alignas(32) float res_dist[8];
-                long mask = bbox_test_oct<S>(_inv_d, _inv_d_o, inter_t[ri], nodes[cur.index].bbox_min,
-                                             nodes[cur.index].bbox_max, res_dist);
+                long mask = bbox_test_oct<S>(_inv_d, _inv_d_o, inter_t[ri], nodes[cur.index], res_dist);
                 if (mask) {
                     long i = GetFirstBit(mask);
                     mask = ClearBit(mask, i);
@@ -3798,9 +4137,9 @@ Ray::NS::ivec<S> Ray::NS::Traverse_TLAS_WithStack_AnyHit(const fvec<S> ro[3], co
     return solid_hit_mask;
 }
 
-template <int S>
+template <int S, typename Node>
 Ray::NS::ivec<S> Ray::NS::Traverse_TLAS_WithStack_AnyHit(const fvec<S> ro[3], const fvec<S> rd[3], int ray_type,
-                                                         const ivec<S> &ray_mask, const wbvh_node_t *nodes,
+                                                         const ivec<S> &ray_mask, const Node *nodes,
                                                          uint32_t node_index, const mesh_instance_t *mesh_instances,
                                                          const mesh_t *meshes, const mtri_accel_t *mtris,
                                                          const tri_mat_data_t *materials, const uint32_t *tri_indices,
@@ -3843,8 +4182,7 @@ Ray::NS::ivec<S> Ray::NS::Traverse_TLAS_WithStack_AnyHit(const fvec<S> ro[3], co
         TRAVERSE:
             if (!is_leaf_node(nodes[cur.index])) {
                 alignas(32) float res_dist[8];
-                long mask = bbox_test_oct<S>(_inv_d, _inv_d_o, inter_t[ri], nodes[cur.index].bbox_min,
-                                             nodes[cur.index].bbox_max, res_dist);
+                long mask = bbox_test_oct<S>(_inv_d, _inv_d_o, inter_t[ri], nodes[cur.index], res_dist);
                 if (mask) {
                     long i = GetFirstBit(mask);
                     mask = ClearBit(mask, i);
@@ -3996,8 +4334,8 @@ bool Ray::NS::Traverse_BLAS_WithStack_ClosestHit(const fvec<S> ro[3], const fvec
     return res;
 }
 
-template <int S>
-bool Ray::NS::Traverse_BLAS_WithStack_ClosestHit(const float ro[3], const float rd[3], const wbvh_node_t *nodes,
+template <int S, typename Node>
+bool Ray::NS::Traverse_BLAS_WithStack_ClosestHit(const float ro[3], const float rd[3], const Node *nodes,
                                                  uint32_t node_index, const mtri_accel_t *mtris,
                                                  const uint32_t *tri_indices, int &inter_prim_index, float &inter_t,
                                                  float &inter_u, float &inter_v) {
@@ -4019,8 +4357,7 @@ bool Ray::NS::Traverse_BLAS_WithStack_ClosestHit(const float ro[3], const float
     TRAVERSE:
         if (!is_leaf_node(nodes[cur.index])) {
             alignas(32) float res_dist[8];
-            long mask = bbox_test_oct<S>(_inv_d, _inv_d_o, inter_t, nodes[cur.index].bbox_min,
-                                         nodes[cur.index].bbox_max, res_dist);
+            long mask = bbox_test_oct<S>(_inv_d, _inv_d_o, inter_t, nodes[cur.index], res_dist);
             if (mask) {
                 long i = GetFirstBit(mask);
                 mask = ClearBit(mask, i);
@@ -4091,6 +4428,124 @@ bool Ray::NS::Traverse_BLAS_WithStack_ClosestHit(const float ro[3], const float
     return res;
 }
 
+template <int S, typename Node>
+bool Ray::NS::Traverse_TLAS_WithStack_ClosestHit_Packet(const fvec<S> ro[3], const fvec<S> rd[3],
+                                                        const uvec<S> &ray_flags, const ivec<S> &ray_mask,
+                                                        const Node *nodes, uint32_t node_index,
+                                                        const mesh_instance_t *mesh_instances,
+                                                        const mtri_accel_t *mtris, const uint32_t *tri_indices,
+                                                        hit_data_t<S> &inter) {
+    bool res = false;
+
+    fvec<S> inv_d[3], inv_d_o[3];
+    comp_aux_inv_values(ro, rd, inv_d, inv_d_o);
+
+    TraversalStateStack_Single<MAX_STACK_SIZE, packet_stack_entry_t<S>> st;
+    st.push(node_index, 0.0f, ray_mask);
+
+    while (!st.empty()) {
+        const packet_stack_entry_t<S> cur = st.pop();
+
+        // skip rays that already found closer intersection
+        const ivec<S> mask = cur.mask & simd_cast(fvec<S>{cur.dist} <= inter.t);
+        if (mask.all_zeros()) {
+            continue;
+        }
+
+        if (!is_leaf_node(nodes[cur.index])) {
+            ivec<S> ch_mask[8];
+            alignas(32) float ch_dist[8];
+            long ch_hit = bbox_test_oct(inv_d, inv_d_o, inter.t, mask, nodes[cur.index], ch_mask, ch_dist);
+            if (!ch_hit) {
+                continue;
+            }
+
+            const uint32_t size_before = st.stack_size;
+            do {
+                const long i = GetFirstBit(ch_hit);
+                ch_hit = ClearBit(ch_hit, i);
+                st.push(nodes[cur.index].child[i], ch_dist[i], ch_mask[i]);
+            } while (ch_hit != 0);
+            st.sort_topN(int(st.stack_size - size_before));
+        } else {
+            assert(nodes[cur.index].child[1] == 1);
+            const uint32_t prim_index = (nodes[cur.index].child[0] & PRIM_INDEX_BITS);
+
+            const mesh_instance_t &mi = mesh_instances[prim_index];
+
+            const ivec<S> inst_mask = ivec<S>((mi.ray_visibility & ray_flags) != 0u) & mask;
+            if (inst_mask.all_zeros()) {
+                continue;
+            }
+
+            fvec<S> tr_ro[3], tr_rd[3];
+            TransformRay(ro, rd, mi.inv_xform, tr_ro, tr_rd);
+
+            res |= Traverse_BLAS_WithStack_ClosestHit_Packet(tr_ro, tr_rd, inst_mask, nodes, mi.node_index, mtris,
+                                                             int(prim_index), inter);
+        }
+    }
+
+    // resolve primitive index indirection
+    ivec<S> prim_index = (ray_mask & inter.prim_index);
+
+    const ivec<S> is_backfacing = (prim_index < 0);
+    where(is_backfacing, prim_index) = -prim_index - 1;
+
+    where(ray_mask, inter.prim_index) = gather(reinterpret_cast<const int *>(tri_indices), prim_index);
+    where(ray_mask & is_backfacing, inter.prim_index) = -inter.prim_index - 1;
+
+    return res;
+}
+
+template <int S, typename Node>
+bool Ray::NS::Traverse_BLAS_WithStack_ClosestHit_Packet(const fvec<S> ro[3], const fvec<S> rd[3],
+                                                        const ivec<S> &ray_mask, const Node *nodes,
+                                                        uint32_t node_index, const mtri_accel_t *mtris,
+                                                        const int obj_index, hit_data_t<S> &inter) {
+    bool res = false;
+
+    fvec<S> inv_d[3], inv_d_o[3];
+    comp_aux_inv_values(ro, rd, inv_d, inv_d_o);
+
+    TraversalStateStack_Single<MAX_STACK_SIZE, packet_stack_entry_t<S>> st;
+    st.push(node_index, 0.0f, ray_mask);
+
+    while (!st.empty()) {
+        const packet_stack_entry_t<S> cur = st.pop();
+
+        const ivec<S> mask = cur.mask & simd_cast(fvec<S>{cur.dist} <= inter.t);
+        if (mask.all_zeros()) {
+            continue;
+        }
+
+        if (!is_leaf_node(nodes[cur.index])) {
+            ivec<S> ch_mask[8];
+            alignas(32) float ch_dist[8];
+            long ch_hit = bbox_test_oct(inv_d, inv_d_o, inter.t, mask, nodes[cur.index], ch_mask, ch_dist);
+            if (!ch_hit) {
+                continue;
+            }
+
+            const uint32_t size_before = st.stack_size;
+            do {
+                const long i = GetFirstBit(ch_hit);
+                ch_hit = ClearBit(ch_hit, i);
+                st.push(nodes[cur.index].child[i], ch_dist[i], ch_mask[i]);
+            } while (ch_hit != 0);
+            st.sort_topN(int(st.stack_size - size_before));
+        } else {
+            const int tri_start = int(nodes[cur.index].child[0] & PRIM_INDEX_BITS),
+                      tri_end = int(tri_start + nodes[cur.index].child[1]);
+            assert((tri_start % 8) == 0);
+            assert((tri_end - tri_start) <= 8);
+            res |= IntersectTri(ro, rd, mask, mtris[tri_start / 8], tri_start, tri_end - tri_start, obj_index, inter);
+        }
+    }
+
+    return res;
+}
+
 template <int S>
 Ray::NS::ivec<S> Ray::NS::Traverse_BLAS_WithStack_AnyHit(const fvec<S> ro[3], const fvec<S> rd[3],
                                                          const ivec<S> &ray_mask, const bvh_node_t *nodes,
@@ -4154,8 +4609,8 @@ Ray::NS::ivec<S> Ray::NS::Traverse_BLAS_WithStack_AnyHit(const fvec<S> ro[3], co
     return solid_hit_mask;
 }
 
-template <int S>
-int Ray::NS::Traverse_BLAS_WithStack_AnyHit(const float ro[3], const float rd[3], const wbvh_node_t *nodes,
+template <int S, typename Node>
+int Ray::NS::Traverse_BLAS_WithStack_AnyHit(const float ro[3], const float rd[3], const Node *nodes,
                                             uint32_t node_index, const mtri_accel_t *mtris,
                                             const tri_mat_data_t *materials, const uint32_t *tri_indices,
                                             int &inter_prim_index, float &inter_t, float &inter_u, float &inter_v) {
@@ -4177,8 +4632,7 @@ int Ray::NS::Traverse_BLAS_WithStack_AnyHit(const float ro[3], const float rd[3]
     TRAVERSE:
         if (!is_leaf_node(nodes[cur.index])) {
             alignas(32) float res_dist[8];
-            long mask = bbox_test_oct<S>(_inv_d, _inv_d_o, inter_t, nodes[cur.index].bbox_min,
-                                         nodes[cur.index].bbox_max, res_dist);
+            long mask = bbox_test_oct<S>(_inv_d, _inv_d_o, inter_t, nodes[cur.index], res_dist);
             if (mask) {
                 long i = GetFirstBit(mask);
                 mask = ClearBit(mask, i);
@@ -5036,7 +5490,7 @@ void Ray::NS::SampleLatlong_RGBE(const Cpu::TexStorageRGBA &storage, const uint3
 template <int S>
 void Ray::NS::IntersectScene(ray_data_t<S> &r, const int min_transp_depth, const int max_transp_depth,
                              const uint32_t rand_seq[], const uint32_t rand_seed, const int iteration,
-                             const scene_data_t &sc, const uint32_t root_index,
+                             const scene_data_t &sc, const uint32_t root_index, const bool packet_traversal,
                              const Cpu::TexStorageBase *const textures[], hit_data_t<S> &inter) {
     fvec<S> ro[3] = {r.o[0], r.o[1], r.o[2]};
 
@@ -5051,7 +5505,16 @@ void Ray::NS::IntersectScene(ray_data_t<S> &r, const int min_transp_depth, const
     while (keep_going.not_all_zeros()) {
         const fvec<S> t_val = inter.t;
 
-        if (sc.wnodes) {
+        if (packet_traversal && sc.qwnodes) {
+            NS::Traverse_TLAS_WithStack_ClosestHit_Packet(ro, r.d, ray_flags, keep_going, sc.qwnodes, root_index,
+                                                          sc.mesh_instances, sc.mtris, sc.tri_indices, inter);
+        } else if (packet_traversal && sc.wnodes) {
+            NS::Traverse_TLAS_WithStack_ClosestHit_Packet(ro, r.d, ray_flags, keep_going, sc.wnodes, root_index,
+                                                          sc.mesh_instances, sc.mtris, sc.tri_indices, inter);
+        } else if (sc.qwnodes) {
+            NS::Traverse_TLAS_WithStack_ClosestHit(ro, r.d, ray_flags, keep_going, sc.qwnodes, root_index,
+                                                   sc.mesh_instances, sc.meshes, sc.mtris, sc.tri_indices, inter);
+        } else if (sc.wnodes) {
             NS::Traverse_TLAS_WithStack_ClosestHit(ro, r.d, ray_flags, keep_going, sc.wnodes, root_index,
                                                    sc.mesh_instances, sc.meshes, sc.mtris, sc.tri_indices, inter);
         } else {
@@ -5232,15 +5695,15 @@ void Ray::NS::IntersectScene(ray_data_t<S> &r, const int min_transp_depth, const
 
 template <int S>
 void Ray::NS::TraceRays(Span<ray_data_t<S>> rays, int min_transp_depth, int max_transp_depth, const scene_data_t &sc,
-                        uint32_t root_index, bool trace_lights, const Cpu::TexStorageBase *const textures[],
-                        const uint32_t rand_seq[], const uint32_t rand_seed, const int iteration,
-                        Span<hit_data_t<S>> out_inter) {
+                        uint32_t root_index, bool trace_lights, const bool packet_traversal,
+                        const Cpu::TexStorageBase *const textures[], const uint32_t rand_seq[],
+                        const uint32_t rand_seed, const int iteration, Span<hit_data_t<S>> out_inter) {
     for (int i = 0; i < rays.size(); ++i) {
         ray_data_t<S> &r = rays[i];
         hit_data_t<S> &inter = out_inter[i];
 
-        IntersectScene(r, min_transp_depth, max_transp_depth, rand_seq, rand_seed, iteration, sc, root_index, textures,
-                       inter);
+        IntersectScene(r, min_transp_depth, max_transp_depth, rand_seq, rand_seed, iteration, sc, root_index,
+                       packet_traversal, textures, inter);
         if (trace_lights && sc.visible_lights_count) {
             IntersectAreaLights(r, sc.lights, sc.light_cwnodes, inter);
         }
@@ -5298,7 +5761,11 @@ void Ray::NS::IntersectScene(const shadow_ray_t<S> &r, const int max_transp_dept
         inter.t = dist;
 
         ivec<S> solid_hit;
-        if (sc.wnodes) {
+        if (sc.qwnodes) {
+            solid_hit = Traverse_TLAS_WithStack_AnyHit(ro, r.d, RAY_TYPE_SHADOW, keep_going, sc.qwnodes, node_index,
+                                                       sc.mesh_instances, sc.meshes, sc.mtris, sc.tri_materials,
+                                                       sc.tri_indices, inter);
+        } else if (sc.wnodes) {
             solid_hit = Traverse_TLAS_WithStack_AnyHit(ro, r.d, RAY_TYPE_SHADOW, keep_going, sc.wnodes, node_index,
                                                        sc.mesh_instances, sc.meshes, sc.mtris, sc.tri_materials,
                                                        sc.tri_indices, inter);
@@ -8212,21 +8679,11 @@ force_inline uint32_t hash64(const uint64_t hash_key) {
            hash_jenkins32(uint32_t((hash_key >> 32) & 0xffffffff));
 }
 
-void accumulate_cache_voxel(packed_cache_voxel_t &voxel, const fvec4 &r, const uint32_t sample_data) {
+void accumulate_cache_voxel(cache_voxel_accum_t &accum, Span<packed_cache_voxel_t> voxels,
+                            const uint32_t cache_entry, const fvec4 &r, const uint32_t sample_data) {
     const uvec4 data = uvec4(r * RAD_CACHE_RADIANCE_SCALE);
-
-    if (data.get<0>()) {
-        Ray_InterlockedExchangeAdd(&voxel.v[0], data.get<0>());
-    }
-    if (data.get<1>()) {
-        Ray_InterlockedExchangeAdd(&voxel.v[1], data.get<1>());
-    }
-    if (data.get<2>()) {
-        Ray_InterlockedExchangeAdd(&voxel.v[2], data.get<2>());
-    }
-    if (sample_data) {
-        Ray_InterlockedExchangeAdd(&voxel.v[3], sample_data);
-    }
+    Ray::accumulate_cache_voxel(accum, voxels, cache_entry,
+                                packed_cache_voxel_t{data.get<0>(), data.get<1>(), data.get<2>(), sample_data});
 }
 
 uint32_t calc_grid_level(const fvec4 &p, const cache_grid_params_t &params) {
@@ -8275,14 +8732,18 @@ bool hash_map_insert(Span<uint64_t> entries, const uint64_t hash_key, uint32_t &
     const uint32_t base_slot = hash_map_base_slot(slot);
     for (uint32_t bucket_offset = 0; bucket_offset < HASH_GRID_HASH_MAP_BUCKET_SIZE && base_slot < entries.size();
          ++bucket_offset) {
-        const uint64_t prev_hash_key =
-            Ray_InterlockedCompareExchange64(&entries[base_slot + bucket_offset], hash_key, HASH_GRID_INVALID_HASH_KEY);
+        // check without locking first, occupied slots never change until resolve
+        uint64_t prev_hash_key = uint64_t(Ray_AtomicLoad64(&entries[base_slot + bucket_offset]));
+        if (prev_hash_key == HASH_GRID_INVALID_HASH_KEY) {
+            prev_hash_key = Ray_InterlockedCompareExchange64(&entries[base_slot + bucket_offset], hash_key,
+                                                             HASH_GRID_INVALID_HASH_KEY);
+        }
         if (prev_hash_key == HASH_GRID_INVALID_HASH_KEY || prev_hash_key == hash_key) {
             cache_entry = base_slot + bucket_offset;
             return true;
         }
     }
-    cache_entry = 0;
+    cache_entry = HASH_GRID_INVALID_CACHE_ENTRY;
     return false;
 }
 
@@ -8324,6 +8785,7 @@ void Ray::NS::SpatialCacheUpdate(const cache_grid_params_t &params, Span<const h
                                  Span<const ray_data_t<S>> rays, Span<cache_data_t> cache_data,
                                  const color_rgba_t radiance[], const color_rgba_t depth_normals[], int img_w,
                                  Span<uint64_t> entries, Span<packed_cache_voxel_t> voxels_curr) {
+    cache_voxel_accum_t accum;
     for (int i = 0; i < int(inters.size()); ++i) {
         const ray_data_t<S> &r = rays[i];
         const hit_data_t<S> &inter = inters[i];
@@ -8358,7 +8820,7 @@ void Ray::NS::SpatialCacheUpdate(const cache_grid_params_t &params, Span<const h
                 for (int k = 0; k < cache.path_len; ++k) {
                     rad *= make_fvec3(cache.sample_weight[k]);
                     if (cache.cache_entries[k] != HASH_GRID_INVALID_CACHE_ENTRY) {
-                        accumulate_cache_voxel(voxels_curr[cache.cache_entries[k]], rad, 0);
+                        accumulate_cache_voxel(accum, voxels_curr, cache.cache_entries[k], rad, 0);
                     }
                 }
             } else {
@@ -8370,24 +8832,27 @@ void Ray::NS::SpatialCacheUpdate(const cache_grid_params_t &params, Span<const h
                 cache.sample_weight[0][0] = cache.sample_weight[0][1] = cache.sample_weight[0][2] = 1.0f;
                 cache.cache_entries[0] = insert_entry(entries, P, N, params);
                 if (cache.cache_entries[0] != HASH_GRID_INVALID_CACHE_ENTRY) {
-                    accumulate_cache_voxel(voxels_curr[cache.cache_entries[0]], rad, 1);
+                    accumulate_cache_voxel(accum, voxels_curr, cache.cache_entries[0], rad, 1);
                 }
                 ++cache.path_len;
 
                 for (int k = 1; k < cache.path_len; ++k) {
                     rad *= make_fvec3(cache.sample_weight[k]);
                     if (cache.cache_entries[k] != HASH_GRID_INVALID_CACHE_ENTRY) {
-                        accumulate_cache_voxel(voxels_curr[cache.cache_entries[k]], rad, 0);
+                        accumulate_cache_voxel(accum, voxels_curr, cache.cache_entries[k], rad, 0);
                     }
                 }
             }
         }
     }
+
+    flush_cache_voxels(accum, voxels_curr);
 }
 
-template <int S, int InChannels, int OutChannels, int OutPxPitch, Ray::ePostOp PostOp, Ray::eActivation Activation>
-void Ray::NS::Convolution3x3_Direct(const float data[], const rect_t &rect, int w, int h, int stride,
-                                    const float weights[], const float biases[], float output[], int output_stride) {
+template <int S, int InChannels, int OutChannels, int OutPxPitch, Ray::ePostOp PostOp, Ray::eActivation Activation,
+          typename TIn, typename TOut, typename TW>
+void Ray::NS::Convolution3x3_Direct(const TIn data[], const rect_t &rect, int w, int h, int stride,
+                                    const TW weights[], const float biases[], TOut output[], int output_stride) {
     static_assert((InChannels % S) == 0, "!");
 
     if (!output_stride) {
@@ -8401,14 +8866,14 @@ void Ray::NS::Convolution3x3_Direct(const float data[], const rect_t &rect, int
     if (PostOp == ePostOp::Downscale) {
         if (OutChannels == OutPxPitch) {
             for (int y = (rect.y / 2); y < (rect.y + rect.h + 1) / 2; ++y) {
-                float *ptr = &output[OutChannels * (y * output_stride + (rect.x / 2))];
-                std::fill(ptr, ptr + ((rect.w + 1) / 2) * OutChannels, 0.0f);
+                TOut *ptr = &output[OutChannels * (y * output_stride + (rect.x / 2))];
+                std::fill(ptr, ptr + ((rect.w + 1) / 2) * OutChannels, TOut{});
             }
         } else {
             for (int y = (rect.y / 2); y < (rect.y + rect.h + 1) / 2; ++y) {
                 for (int x = (rect.x / 2); x < (rect.x + rect.w + 1) / 2; ++x) {
                     for (int c = 0; c < OutChannels; ++c) {
-                        output[OutPxPitch * (y * output_stride + (x / 2)) + c] = 0.0f;
+                        output[OutPxPitch * (y * output_stride + (x / 2)) + c] = TOut{};
                     }
                 }
             }
@@ -8435,10 +8900,10 @@ void Ray::NS::Convolution3x3_Direct(const float data[], const rect_t &rect, int
 }
 
 template <int S, int InChannels1, int InChannels2, int OutChannels, Ray::ePreOp PreOp1, Ray::ePostOp PostOp,
-          Ray::eActivation Activation>
-void Ray::NS::ConvolutionConcat3x3_Direct(const float data1[], const float data2[], const rect_t &rect, int w, int h,
-                                          int stride1, int stride2, const float weights[], const float biases[],
-                                          float output[], int output_stride) {
+          Ray::eActivation Activation, typename T, typename TW>
+void Ray::NS::ConvolutionConcat3x3_Direct(const T data1[], const T data2[], const rect_t &rect, int w, int h,
+                                          int stride1, int stride2, const TW weights[], const float biases[],
+                                          T output[], int output_stride) {
     static_assert((InChannels1 % S) == 0 && (InChannels2 % S) == 0, "!");
 
     if (!output_stride) {
@@ -8471,11 +8936,11 @@ void Ray::NS::ConvolutionConcat3x3_Direct(const float data1[], const float data2
 
 template <int S, int InChannels1, int InChannels2, int InChannels3, int InChannels4, int PxPitch2, int OutChannels,
           Ray::ePreOp PreOp1, Ray::ePreOp PreOp2, Ray::ePreOp PreOp3, Ray::ePreOp PreOp4, Ray::ePostOp PostOp,
-          Ray::eActivation Activation>
-void Ray::NS::ConvolutionConcat3x3_1Direct_2GEMM(const float data1[], const float data2[], const float data3[],
+          Ray::eActivation Activation, typename T, typename TW>
+void Ray::NS::ConvolutionConcat3x3_1Direct_2GEMM(const T data1[], const float data2[], const float data3[],
                                                  const float data4[], const rect_t &rect, int w, int h, int w2, int h2,
-                                                 int stride1, int stride2, const float weights[], const float biases[],
-                                                 float output[], int output_stride) {
+                                                 int stride1, int stride2, const TW weights[], const float biases[],
+                                                 T output[], int output_stride) {
     static_assert((InChannels1 % S) == 0, "!");
 
     int y = rect.y;
@@ -8504,6 +8969,342 @@ void Ray::NS::ConvolutionConcat3x3_1Direct_2GEMM(const float data1[], const floa
     }
 }
 
+namespace Ray {
+namespace NS {
+// Loads (or stores) 'count' adjacent pixels as separate channel vectors
+template <int S> force_inline void LoadChannels(const color_rgba_t px[], const int count, fvec<S> out_channels[4]) {
+    alignas(64) float temp[4][S] = {};
+    for (int i = 0; i < count; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            temp[c][i] = px[i].v[c];
+        }
+    }
+    for (int c = 0; c < 4; ++c) {
+        out_channels[c] = fvec<S>{temp[c], vector_aligned};
+    }
+}
+
+template <int S> force_inline void StoreChannels(const fvec<S> channels[4], const int count, color_rgba_t out_px[]) {
+    alignas(64) float temp[4][S];
+    for (int c = 0; c < 4; ++c) {
+        channels[c].store_to(temp[c], vector_aligned);
+    }
+    for (int i = 0; i < count; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            out_px[i].v[c] = temp[c][i];
+        }
+    }
+}
+
+// https://gpuopen.com/learn/optimized-reversible-tonemapper-for-resolve/
+template <int S> force_inline void reversible_tonemap(fvec<S> c[4]) {
+    const fvec<S> norm = max(c[0], max(c[1], c[2])) + 1.0f;
+    UNROLLED_FOR(i, 4, { c[i] /= norm; })
+}
+
+template <int S> force_inline void FetchLUT(const int *lut, const ivec<S> &index, fvec<S> out_col[3]) {
+    const ivec<S> packed_val = gather(lut, index);
+    UNROLLED_FOR(i, 3, { out_col[i] = fvec<S>((packed_val >> (10 * i)) & 0x3ff) * (1.0f / 1023.0f); })
+}
+
+template <int S> void TonemapFilmic(const eViewTransform view_transform, fvec<S> col[3]) {
+    const int *lut = reinterpret_cast<const int *>(transform_luts[int(view_transform)]);
+
+    ivec<S> xyz[3], xyz_next[3];
+    fvec<S> f[3];
+    UNROLLED_FOR(i, 3, {
+        const fvec<S> encoded = col[i] / (col[i] + 1.0f);
+        const fvec<S> uv = encoded * float(LUT_DIMS - 1);
+        xyz[i] = ivec<S>(uv);
+        f[i] = fract(uv);
+        xyz_next[i] = min(xyz[i] + 1, ivec<S>{LUT_DIMS - 1});
+    })
+
+    const ivec<S> iy = xyz[1] * LUT_DIMS, jy = xyz_next[1] * LUT_DIMS;
+    const ivec<S> iz = xyz[2] * LUT_DIMS * LUT_DIMS, jz = xyz_next[2] * LUT_DIMS * LUT_DIMS;
+
+    fvec<S> c000[3], c001[3], c010[3], c011[3], c100[3], c101[3], c110[3], c111[3];
+    FetchLUT(lut, iz + iy + xyz[0], c000);
+    FetchLUT(lut, iz + iy + xyz_next[0], c001);
+    FetchLUT(lut, iz + jy + xyz[0], c010);
+    FetchLUT(lut, iz + jy + xyz_next[0], c011);
+    FetchLUT(lut, jz + iy + xyz[0], c100);
+    FetchLUT(lut, jz + iy + xyz_next[0], c101);
+    FetchLUT(lut, jz + jy + xyz[0], c110);
+    FetchLUT(lut, jz + jy + xyz_next[0], c111);
+
+    for (int i = 0; i < 3; ++i) {
+        const fvec<S> c00x = (1.0f - f[0]) * c000[i] + f[0] * c001[i], c01x = (1.0f - f[0]) * c010[i] + f[0] * c011[i],
+                      c10x = (1.0f - f[0]) * c100[i] + f[0] * c101[i], c11x = (1.0f - f[0]) * c110[i] + f[0] * c111[i];
+
+        const fvec<S> c0xx = (1.0f - f[1]) * c00x + f[1] * c01x, c1xx = (1.0f - f[1]) * c10x + f[1] * c11x;
+
+        col[i] = (1.0f - f[2]) * c0xx + f[2] * c1xx;
+    }
+}
+
+template <int S>
+force_inline void Tonemap(const eViewTransform view_transform, const float inv_gamma, fvec<S> col[4]) {
+    if (view_transform == eViewTransform::Standard) {
+        UNROLLED_FOR(i, 3, {
+            // pow argument is clamped to avoid NaNs in lanes which are not selected
+            col[i] = select(col[i] < 0.0031308f, 12.92f * col[i],
+                            1.055f * pow(max(col[i], 0.0031308f), fvec<S>{1.0f / 2.4f}) - 0.055f);
+        })
+    } else {
+        TonemapFilmic(view_transform, col);
+    }
+
+    if (inv_gamma != 1.0f) {
+        UNROLLED_FOR(i, 3, { col[i] = pow(col[i], fvec<S>{inv_gamma}); })
+    }
+
+    UNROLLED_FOR(i, 4, { col[i] = saturate(col[i]); })
+}
+
+template <int S, int WINDOW_SIZE, int NEIGHBORHOOD_SIZE, bool FEATURE0, bool FEATURE1>
+void JointNLMFilter(const color_rgba_t input[], const rect_t &rect, const int input_stride, const float alpha,
+                    const float damping, const color_rgba_t variance[], const color_rgba_t feature0[],
+                    const float feature0_weight, const color_rgba_t feature1[], const float feature1_weight,
+                    const rect_t &output_rect, const int output_stride, color_rgba_t output[]) {
+    const int WindowRadius = (WINDOW_SIZE - 1) / 2;
+    const float PatchDistanceNormFactor = NEIGHBORHOOD_SIZE * NEIGHBORHOOD_SIZE;
+    const int NeighborRadius = (NEIGHBORHOOD_SIZE - 1) / 2;
+    const int Margin = WindowRadius + NeighborRadius;
+
+    assert(rect.w == output_rect.w);
+    assert(rect.h == output_rect.h);
+
+    // Inputs are converted to planar layout (one plane per channel) with rows padded to multiple of S, this allows
+    // to process S horizontally adjacent pixels at once without any bounds checks in inner loops. Instead of
+    // comparing whole neighborhoods for each pixel pair, per-pixel distances are calculated once for each window
+    // offset and then summed up over neighborhood.
+    const int padded_w = S * ((rect.w + S - 1) / S);
+    const int dist_w = S * ((padded_w + 2 * NeighborRadius + S - 1) / S), dist_h = rect.h + 2 * NeighborRadius;
+    const int plane_w = dist_w + 2 * WindowRadius, plane_h = rect.h + 2 * Margin;
+    const int plane_size = plane_w * plane_h, accum_size = padded_w * rect.h;
+
+    const int PlanesCount = 4 * (2 + int(FEATURE0) + int(FEATURE1));
+
+    static thread_local std::vector<float> temp_data;
+    temp_data.resize(PlanesCount * plane_size + dist_w * dist_h + 5 * accum_size);
+
+    float *planes = &temp_data[0];
+    float *distance = &temp_data[PlanesCount * plane_size];
+    float *accum = &temp_data[PlanesCount * plane_size + dist_w * dist_h];
+
+    const color_rgba_t *sources[] = {input, variance, FEATURE0 ? feature0 : nullptr, FEATURE1 ? feature1 : nullptr};
+    for (int i = 0, plane = 0; i < 4; ++i) {
+        if (!sources[i]) {
+            continue;
+        }
+        float *dst = &planes[4 * plane++ * plane_size];
+        for (int y = 0; y < plane_h; ++y) {
+            const color_rgba_t *src = &sources[i][(rect.y - Margin + y) * input_stride + (rect.x - Margin)];
+            for (int c = 0; c < 4; ++c) {
+                float *dst_row = &dst[c * plane_size + y * plane_w];
+                for (int x = 0; x < rect.w + 2 * Margin; ++x) {
+                    dst_row[x] = src[x].v[c];
+                }
+                // padding affects only discarded pixels
+                for (int x = rect.w + 2 * Margin; x < plane_w; ++x) {
+                    dst_row[x] = 0.0f;
+                }
+            }
+        }
+    }
+    memset(accum, 0, 5 * accum_size * sizeof(float));
+
+    const float *color = &planes[0];
+    const float *var = &planes[4 * plane_size];
+    const float *feat0 = &planes[8 * plane_size];
+    const float *feat1 = &planes[(FEATURE0 ? 12 : 8) * plane_size];
+
+    for (int k = -WindowRadius; k <= WindowRadius; ++k) {
+        for (int l = -WindowRadius; l <= WindowRadius; ++l) {
+            const int offset = k * plane_w + l;
+
+            for (int y = 0; y < dist_h; ++y) {
+                for (int x = 0; x < dist_w; x += S) {
+                    const int i = (y + WindowRadius) * plane_w + (x + WindowRadius);
+
+                    fvec<S> color_distance = 0.0f;
+                    for (int c = 0; c < 4; ++c) {
+                        const fvec<S> ipx{&color[c * plane_size + i]}, jpx{&color[c * plane_size + i + offset]};
+                        const fvec<S> ivar{&var[c * plane_size + i]}, jvar{&var[c * plane_size + i + offset]};
+                        const fvec<S> min_var = min(ivar, jvar);
+
+                        color_distance += ((ipx - jpx) * (ipx - jpx) - alpha * (ivar + min_var)) /
+                                          (0.0001f + damping * damping * (ivar + jvar));
+                    }
+                    color_distance.store_to(&distance[y * dist_w + x]);
+                }
+            }
+
+            for (int y = 0; y < rect.h; ++y) {
+                for (int x = 0; x < padded_w; x += S) {
+                    fvec<S> patch_distance = 0.0f;
+                    for (int q = 0; q < NEIGHBORHOOD_SIZE; ++q) {
+                        for (int p = 0; p < NEIGHBORHOOD_SIZE; ++p) {
+                            patch_distance += fvec<S>{&distance[(y + q) * dist_w + (x + p)]};
+                        }
+                    }
+                    patch_distance = max(0.25f * PatchDistanceNormFactor * patch_distance, 0.0f);
+
+                    const int i = (y + Margin) * plane_w + (x + Margin), j = i + offset;
+
+                    if (FEATURE0 || FEATURE1) {
+                        fvec<S> feature_patch_distance = 0.0f;
+                        for (int c = 0; c < 4; ++c) {
+                            fvec<S> feature_distance = 0.0f;
+                            if (FEATURE0) {
+                                const fvec<S> ipx{&feat0[c * plane_size + i]}, jpx{&feat0[c * plane_size + j]};
+                                feature_distance = feature0_weight * (ipx - jpx) * (ipx - jpx);
+                            }
+                            if (FEATURE1) {
+                                const fvec<S> ipx{&feat1[c * plane_size + i]}, jpx{&feat1[c * plane_size + j]};
+                                feature_distance = max(feature_distance, feature1_weight * (ipx - jpx) * (ipx - jpx));
+                            }
+                            feature_patch_distance += feature_distance;
+                        }
+                        feature_patch_distance = max(min(0.25f * feature_patch_distance, 10000.0f), 0.0f);
+
+                        // min(exp(-a), exp(-b)) is the same as exp(-max(a, b))
+                        patch_distance = max(patch_distance, feature_patch_distance);
+                    }
+                    const fvec<S> weight = exp(-patch_distance);
+
+                    float *acc = &accum[y * padded_w + x];
+                    for (int c = 0; c < 4; ++c) {
+                        const fvec<S> jpx{&color[c * plane_size + j]};
+                        (fvec<S>{&acc[c * accum_size]} + jpx * weight).store_to(&acc[c * accum_size]);
+                    }
+                    (fvec<S>{&acc[4 * accum_size]} + weight).store_to(&acc[4 * accum_size]);
+                }
+            }
+        }
+    }
+
+    for (int y = 0; y < rect.h; ++y) {
+        for (int x = 0; x < padded_w; x += S) {
+            const float *acc = &accum[y * padded_w + x];
+            const fvec<S> sum_weight{&acc[4 * accum_size]};
+
+            alignas(64) float result[4][S];
+            for (int c = 0; c < 4; ++c) {
+                fvec<S> sum_output{&acc[c * accum_size]};
+                where(sum_weight != 0.0f, sum_output) = safe_div_pos(sum_output, sum_weight);
+                sum_output.store_to(result[c], vector_aligned);
+            }
+
+            color_rgba_t *out = &output[(output_rect.y + y) * output_stride + (output_rect.x + x)];
+            for (int lane = 0; lane < S && x + lane < rect.w; ++lane) {
+                for (int c = 0; c < 4; ++c) {
+                    out[lane].v[c] = result[c][lane];
+                }
+            }
+        }
+    }
+}
+} // namespace NS
+} // namespace Ray
+
+template <int S>
+void Ray::NS::ResolveRegion(const rect_t &rect, const int w, const int iteration, const float exposure,
+                            const float mix_factor, const float half_mix_factor, const bool accumulate_half,
+                            const eViewTransform view_transform, const float inv_gamma, const float variance_threshold,
+                            const color_rgba_t new_color[], color_rgba_t full_buf[], color_rgba_t half_buf[],
+                            color_rgba_t raw_filtered_buf[], color_rgba_t variance_buf[], color_rgba_t final_buf[],
+                            uint16_t required_samples[]) {
+    // Every input pixel is read once (new_color may alias variance_buf)
+    for (int y = rect.y; y < rect.y + rect.h; ++y) {
+        for (int x = rect.x; x < rect.x + rect.w; x += S) {
+            const int i = y * w + x, count = std::min(S, rect.x + rect.w - x);
+
+            alignas(64) int samples[S] = {};
+            for (int j = 0; j < count; ++j) {
+                samples[j] = required_samples[i + j];
+            }
+            ivec<S> req_samples = {samples, vector_aligned};
+            const ivec<S> active = (req_samples >= iteration);
+
+            fvec<S> new_val[4], full_val[4], half_val[4];
+            LoadChannels(&new_color[i], count, new_val);
+            LoadChannels(&full_buf[i], count, full_val);
+            LoadChannels(&half_buf[i], count, half_val);
+
+            UNROLLED_FOR(c, 4, {
+                if (c < 3) {
+                    new_val[c] *= exposure;
+                }
+                // accumulate full buffer
+                where(active, full_val[c]) = full_val[c] + (new_val[c] - full_val[c]) * mix_factor;
+                if (accumulate_half) {
+                    // accumulate half buffer
+                    where(active, half_val[c]) = half_val[c] + (new_val[c] - half_val[c]) * half_mix_factor;
+                }
+            })
+
+            StoreChannels(full_val, count, &full_buf[i]);
+            if (accumulate_half) {
+                StoreChannels(half_val, count, &half_buf[i]);
+            }
+            // Store as denosed result until DenoiseImage method will be called
+            StoreChannels(full_val, count, &raw_filtered_buf[i]);
+
+            fvec<S> p1[4], p2[4];
+            UNROLLED_FOR(c, 4, {
+                p1[c] = max(2.0f * full_val[c] - half_val[c], 0.0f);
+                p2[c] = half_val[c];
+            })
+            reversible_tonemap(p1);
+            reversible_tonemap(p2);
+
+            fvec<S> variance[4];
+            fvec<S> variance_mask = 0.0f;
+            UNROLLED_FOR(c, 4, {
+                variance[c] = 0.5f * (p1[c] - p2[c]) * (p1[c] - p2[c]);
+                variance_mask |= (variance[c] >= variance_threshold);
+            })
+            StoreChannels(variance, count, &variance_buf[i]);
+
+            Tonemap(view_transform, inv_gamma, full_val);
+            StoreChannels(full_val, count, &final_buf[i]);
+
+            where(simd_cast(variance_mask), req_samples) = iteration + 1;
+            req_samples.store_to(samples, vector_aligned);
+            for (int j = 0; j < count; ++j) {
+                required_samples[i + j] = uint16_t(samples[j]);
+            }
+        }
+    }
+}
+
+template <int S, int WINDOW_SIZE, int NEIGHBORHOOD_SIZE>
+void Ray::NS::JointNLMFilter(const color_rgba_t input[], const rect_t &rect, const int input_stride, const float alpha,
+                             const float damping, const color_rgba_t variance[], const color_rgba_t feature0[],
+                             const float feature0_weight, const color_rgba_t feature1[], const float feature1_weight,
+                             const rect_t &output_rect, const int output_stride, color_rgba_t output[]) {
+    if (feature0 && feature1) {
+        JointNLMFilter<S, WINDOW_SIZE, NEIGHBORHOOD_SIZE, true, true>(input, rect, input_stride, alpha, damping,
+                                                                      variance, feature0, feature0_weight, feature1,
+                                                                      feature1_weight, output_rect, output_stride,
+                                                                      output);
+    } else if (feature0) {
+        JointNLMFilter<S, WINDOW_SIZE, NEIGHBORHOOD_SIZE, true, false>(input, rect, input_stride, alpha, damping,
+                                                                       variance, feature0, feature0_weight, nullptr,
+                                                                       0.0f, output_rect, output_stride, output);
+    } else if (feature1) {
+        JointNLMFilter<S, WINDOW_SIZE, NEIGHBORHOOD_SIZE, true, false>(input, rect, input_stride, alpha, damping,
+                                                                       variance, feature1, feature1_weight, nullptr,
+                                                                       0.0f, output_rect, output_stride, output);
+    } else {
+        JointNLMFilter<S, WINDOW_SIZE, NEIGHBORHOOD_SIZE, false, false>(input, rect, input_stride, alpha, damping,
+                                                                        variance, nullptr, 0.0f, nullptr, 0.0f,
+                                                                        output_rect, output_stride, output);
+    }
+}
+
 #undef sqr
 
 #undef USE_NEE
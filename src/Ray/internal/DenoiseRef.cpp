@@ -131,9 +131,10 @@ template void Ray::Ref::JointNLMFilter<3 /* WINDOW_SIZE */, 1 /* NEIGHBORHOOD_SI
     const color_rgba_t variance[], const color_rgba_t feature0[], float feature0_weight, const color_rgba_t feature1[],
     float feature1_weight, const rect_t &output_rect, int output_stride, color_rgba_t output[]);
 
-template <int InChannels, int OutChannels, int OutPxPitch, Ray::ePostOp PostOp, Ray::eActivation Activation>
-void Ray::Ref::Convolution3x3_Direct(const float data[], const rect_t &rect, int w, int h, int stride,
-                                     const float weights[], const float biases[], float output[], int output_stride) {
+template <int InChannels, int OutChannels, int OutPxPitch, Ray::ePostOp PostOp, Ray::eActivation Activation,
+          typename TIn, typename TOut, typename TW>
+void Ray::Ref::Convolution3x3_Direct(const TIn data[], const rect_t &rect, int w, int h, int stride,
+                                     const TW weights[], const float biases[], TOut output[], int output_stride) {
     static_assert((InChannels % 4) == 0, "!");
 
     if (!output_stride) {
@@ -147,14 +148,14 @@ void Ray::Ref::Convolution3x3_Direct(const float data[], const rect_t &rect, int
     if (PostOp == ePostOp::Downscale) {
         if (OutChannels == OutPxPitch) {
             for (int y = (rect.y / 2); y < (rect.y + rect.h + 1) / 2; ++y) {
-                float *ptr = &output[OutChannels * (y * output_stride + (rect.x / 2))];
-                std::fill(ptr, ptr + ((rect.w + 1) / 2) * OutChannels, 0.0f);
+                TOut *ptr = &output[OutChannels * (y * output_stride + (rect.x / 2))];
+                std::fill(ptr, ptr + ((rect.w + 1) / 2) * OutChannels, TOut{});
             }
         } else {
             for (int y = (rect.y / 2); y < (rect.y + rect.h + 1) / 2; ++y) {
                 for (int x = (rect.x / 2); x < (rect.x + rect.w + 1) / 2; ++x) {
                     for (int c = 0; c < OutChannels; ++c) {
-                        output[OutPxPitch * (y * output_stride + (rect.x / 2)) + c] = 0.0f;
+                        output[OutPxPitch * (y * output_stride + (rect.x / 2)) + c] = TOut{};
                     }
                 }
             }
@@ -179,10 +180,11 @@ void Ray::Ref::Convolution3x3_Direct(const float data[], const rect_t &rect, int
 }
 
 template <int InChannels1, int InChannels2, int InChannels3, int PxPitch, int OutChannels, Ray::ePreOp PreOp1,
-          Ray::ePreOp PreOp2, Ray::ePreOp PreOp3, Ray::ePostOp PostOp, Ray::eActivation Activation>
+          Ray::ePreOp PreOp2, Ray::ePreOp PreOp3, Ray::ePostOp PostOp, Ray::eActivation Activation, typename TOut,
+          typename TW>
 void Ray::Ref::Convolution3x3_GEMM(const float data1[], const float data2[], const float data3[], const rect_t &rect,
-                                   int in_w, int in_h, int w, int h, int stride, const float weights[],
-                                   const float biases[], float output[], int output_stride) {
+                                   int in_w, int in_h, int w, int h, int stride, const TW weights[],
+                                   const float biases[], TOut output[], int output_stride) {
     Convolution3x3_GEMM<4, InChannels1, InChannels2, InChannels3, PxPitch, OutChannels, PreOp1, PreOp2, PreOp3, PostOp,
                         Activation>(data1, data2, data3, rect, in_w, in_h, w, h, stride, weights, biases, output,
                                     output_stride);
@@ -218,6 +220,96 @@ template void Ray::Ref::Convolution3x3_Direct<96, 96, 96, Ray::ePostOp::None, Ra
 template void Ray::Ref::Convolution3x3_Direct<112, 112, 112, Ray::ePostOp::None, Ray::eActivation::ReLU>(
     const float data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
     float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<32, 3, 4, Ray::ePostOp::HDRTransfer, Ray::eActivation::ReLU>(
+    const bf16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<32, 32, 32, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const bf16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    bf16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<32, 48, 48, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const bf16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    bf16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<48, 64, 64, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const bf16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    bf16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<64, 32, 32, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const bf16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    bf16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<64, 64, 64, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const bf16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    bf16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<64, 80, 80, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const bf16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    bf16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<80, 96, 96, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const bf16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    bf16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<96, 96, 96, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const bf16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    bf16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<112, 112, 112, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const bf16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    bf16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<32, 3, 4, Ray::ePostOp::HDRTransfer, Ray::eActivation::ReLU>(
+    const f16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<32, 32, 32, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const f16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    f16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<32, 48, 48, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const f16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    f16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<48, 64, 64, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const f16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    f16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<64, 32, 32, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const f16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    f16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<64, 64, 64, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const f16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    f16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<64, 80, 80, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const f16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    f16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<80, 96, 96, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const f16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    f16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<96, 96, 96, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const f16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    f16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<112, 112, 112, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const f16_t data[], const rect_t &rect, int w, int h, int stride, const float weights[], const float biases[],
+    f16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<32, 3, 4, Ray::ePostOp::HDRTransfer, Ray::eActivation::ReLU>(
+    const float data[], const rect_t &rect, int w, int h, int stride, const int8_t weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<32, 32, 32, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const float data[], const rect_t &rect, int w, int h, int stride, const int8_t weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<32, 48, 48, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const float data[], const rect_t &rect, int w, int h, int stride, const int8_t weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<48, 64, 64, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const float data[], const rect_t &rect, int w, int h, int stride, const int8_t weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<64, 32, 32, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data[], const rect_t &rect, int w, int h, int stride, const int8_t weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<64, 64, 64, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data[], const rect_t &rect, int w, int h, int stride, const int8_t weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<64, 80, 80, Ray::ePostOp::Downscale, Ray::eActivation::ReLU>(
+    const float data[], const rect_t &rect, int w, int h, int stride, const int8_t weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<80, 96, 96, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data[], const rect_t &rect, int w, int h, int stride, const int8_t weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<96, 96, 96, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data[], const rect_t &rect, int w, int h, int stride, const int8_t weights[], const float biases[],
+    float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_Direct<112, 112, 112, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data[], const rect_t &rect, int w, int h, int stride, const int8_t weights[], const float biases[],
+    float output[], int output_stride);
 
 template void Ray::Ref::Convolution3x3_GEMM<3, 0, 0, 4, 32, Ray::ePreOp::HDRTransfer, Ray::ePreOp::None,
                                             Ray::ePreOp::None, Ray::ePostOp::None, Ray::eActivation::ReLU>(
@@ -231,12 +323,32 @@ template void Ray::Ref::Convolution3x3_GEMM<3, 3, 3, 4, 32, Ray::ePreOp::HDRTran
                                             Ray::ePreOp::PositiveNormalize, Ray::ePostOp::None, Ray::eActivation::ReLU>(
     const float data1[], const float data2[], const float data3[], const rect_t &rect, int in_w, int in_h, int w, int h,
     int stride, const float weights[], const float biases[], float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_GEMM<3, 3, 3, 4, 32, Ray::ePreOp::HDRTransfer, Ray::ePreOp::None,
+                                            Ray::ePreOp::PositiveNormalize, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data1[], const float data2[], const float data3[], const rect_t &rect, int in_w, int in_h, int w, int h,
+    int stride, const float weights[], const float biases[], bf16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_GEMM<3, 3, 3, 4, 32, Ray::ePreOp::HDRTransfer, Ray::ePreOp::None,
+                                            Ray::ePreOp::PositiveNormalize, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data1[], const float data2[], const float data3[], const rect_t &rect, int in_w, int in_h, int w, int h,
+    int stride, const float weights[], const float biases[], f16_t output[], int output_stride);
+template void Ray::Ref::Convolution3x3_GEMM<3, 0, 0, 4, 32, Ray::ePreOp::HDRTransfer, Ray::ePreOp::None,
+                                            Ray::ePreOp::None, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data1[], const float data2[], const float data3[], const rect_t &rect, int in_w, int in_h, int w, int h,
+    int stride, const int8_t weights[], const float biases[], float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_GEMM<3, 3, 0, 4, 32, Ray::ePreOp::HDRTransfer, Ray::ePreOp::None,
+                                            Ray::ePreOp::None, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data1[], const float data2[], const float data3[], const rect_t &rect, int in_w, int in_h, int w, int h,
+    int stride, const int8_t weights[], const float biases[], float output[], int output_stride);
+template void Ray::Ref::Convolution3x3_GEMM<3, 3, 3, 4, 32, Ray::ePreOp::HDRTransfer, Ray::ePreOp::None,
+                                            Ray::ePreOp::PositiveNormalize, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data1[], const float data2[], const float data3[], const rect_t &rect, int in_w, int in_h, int w, int h,
+    int stride, const int8_t weights[], const float biases[], float output[], int output_stride);
 
 template <int InChannels1, int InChannels2, int OutChannels, Ray::ePreOp PreOp1, Ray::ePostOp PostOp,
-          Ray::eActivation Activation>
-void Ray::Ref::ConvolutionConcat3x3_Direct(const float data1[], const float data2[], const rect_t &rect, int w, int h,
-                                           int stride1, int stride2, const float weights[], const float biases[],
-                                           float output[], int output_stride) {
+          Ray::eActivation Activation, typename T, typename TW>
+void Ray::Ref::ConvolutionConcat3x3_Direct(const T data1[], const T data2[], const rect_t &rect, int w, int h,
+                                           int stride1, int stride2, const TW weights[], const float biases[],
+                                           T output[], int output_stride) {
     static_assert((InChannels1 % 4) == 0 && (InChannels2 % 4) == 0, "!");
 
     int y = rect.y;
@@ -268,11 +380,11 @@ void Ray::Ref::ConvolutionConcat3x3_GEMM(const float data1[], const float data2[
 
 template <int InChannels1, int InChannels2, int InChannels3, int InChannels4, int PxPitch2, int OutChannels,
           Ray::ePreOp PreOp1, Ray::ePreOp PreOp2, Ray::ePreOp PreOp3, Ray::ePreOp PreOp4, Ray::ePostOp PostOp,
-          Ray::eActivation Activation>
-void Ray::Ref::ConvolutionConcat3x3_1Direct_2GEMM(const float data1[], const float data2[], const float data3[],
+          Ray::eActivation Activation, typename T, typename TW>
+void Ray::Ref::ConvolutionConcat3x3_1Direct_2GEMM(const T data1[], const float data2[], const float data3[],
                                                   const float data4[], const rect_t &rect, int w, int h, int w2, int h2,
-                                                  int stride1, int stride2, const float weights[], const float biases[],
-                                                  float output[], int output_stride) {
+                                                  int stride1, int stride2, const TW weights[], const float biases[],
+                                                  T output[], int output_stride) {
     static_assert((InChannels1 % 4) == 0, "!");
 
     int y = rect.y;
@@ -313,6 +425,42 @@ template void
 Ray::Ref::ConvolutionConcat3x3_Direct<96, 32, 64, Ray::ePreOp::Upscale, Ray::ePostOp::None, Ray::eActivation::ReLU>(
     const float data1[], const float data2[], const rect_t &rect, int w, int h, int stride1, int stride2,
     const float weights[], const float biases[], float output[], int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_Direct<96, 64, 112, Ray::ePreOp::Upscale, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const bf16_t data1[], const bf16_t data2[], const rect_t &rect, int w, int h, int stride1, int stride2,
+    const float weights[], const float biases[], bf16_t output[], int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_Direct<112, 48, 96, Ray::ePreOp::Upscale, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const bf16_t data1[], const bf16_t data2[], const rect_t &rect, int w, int h, int stride1, int stride2,
+    const float weights[], const float biases[], bf16_t output[], int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_Direct<96, 32, 64, Ray::ePreOp::Upscale, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const bf16_t data1[], const bf16_t data2[], const rect_t &rect, int w, int h, int stride1, int stride2,
+    const float weights[], const float biases[], bf16_t output[], int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_Direct<96, 64, 112, Ray::ePreOp::Upscale, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const f16_t data1[], const f16_t data2[], const rect_t &rect, int w, int h, int stride1, int stride2,
+    const float weights[], const float biases[], f16_t output[], int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_Direct<112, 48, 96, Ray::ePreOp::Upscale, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const f16_t data1[], const f16_t data2[], const rect_t &rect, int w, int h, int stride1, int stride2,
+    const float weights[], const float biases[], f16_t output[], int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_Direct<96, 32, 64, Ray::ePreOp::Upscale, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const f16_t data1[], const f16_t data2[], const rect_t &rect, int w, int h, int stride1, int stride2,
+    const float weights[], const float biases[], f16_t output[], int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_Direct<96, 64, 112, Ray::ePreOp::Upscale, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data1[], const float data2[], const rect_t &rect, int w, int h, int stride1, int stride2,
+    const int8_t weights[], const float biases[], float output[], int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_Direct<112, 48, 96, Ray::ePreOp::Upscale, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data1[], const float data2[], const rect_t &rect, int w, int h, int stride1, int stride2,
+    const int8_t weights[], const float biases[], float output[], int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_Direct<96, 32, 64, Ray::ePreOp::Upscale, Ray::ePostOp::None, Ray::eActivation::ReLU>(
+    const float data1[], const float data2[], const rect_t &rect, int w, int h, int stride1, int stride2,
+    const int8_t weights[], const float biases[], float output[], int output_stride);
 
 template void Ray::Ref::ConvolutionConcat3x3_1Direct_2GEMM<
     64, 3, 0, 0, 4, 64, Ray::ePreOp::Upscale, Ray::ePreOp::HDRTransfer, Ray::ePreOp::None, Ray::ePreOp::None,
@@ -334,4 +482,50 @@ Ray::Ref::ConvolutionConcat3x3_1Direct_2GEMM<64, 3, 3, 3, 4, 64, Ray::ePreOp::Up
                                                                      const rect_t &rect, int w, int h, int w2, int h2,
                                                                      int stride1, int stride2, const float weights[],
                                                                      const float biases[], float output[],
-                                                                     int output_stride);
\ No newline at end of file
+                                                                     int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_1Direct_2GEMM<64, 3, 3, 3, 4, 64, Ray::ePreOp::Upscale, Ray::ePreOp::HDRTransfer,
+                                             Ray::ePreOp::None, Ray::ePreOp::PositiveNormalize, Ray::ePostOp::None,
+                                             Ray::eActivation::ReLU>(const bf16_t data1[], const float data2[],
+                                                                     const float data3[], const float data4[],
+                                                                     const rect_t &rect, int w, int h, int w2, int h2,
+                                                                     int stride1, int stride2, const float weights[],
+                                                                     const float biases[], bf16_t output[],
+                                                                     int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_1Direct_2GEMM<64, 3, 3, 3, 4, 64, Ray::ePreOp::Upscale, Ray::ePreOp::HDRTransfer,
+                                             Ray::ePreOp::None, Ray::ePreOp::PositiveNormalize, Ray::ePostOp::None,
+                                             Ray::eActivation::ReLU>(const f16_t data1[], const float data2[],
+                                                                     const float data3[], const float data4[],
+                                                                     const rect_t &rect, int w, int h, int w2, int h2,
+                                                                     int stride1, int stride2, const float weights[],
+                                                                     const float biases[], f16_t output[],
+                                                                     int output_stride);
+template void Ray::Ref::ConvolutionConcat3x3_1Direct_2GEMM<
+    64, 3, 0, 0, 4, 64, Ray::ePreOp::Upscale, Ray::ePreOp::HDRTransfer, Ray::ePreOp::None, Ray::ePreOp::None,
+    Ray::ePostOp::None, Ray::eActivation::ReLU>(const float data1[], const float data2[], const float data3[],
+                                                const float data4[], const rect_t &rect, int w, int h, int w2, int h2,
+                                                int stride1, int stride2, const int8_t weights[], const float biases[],
+                                                float output[], int output_stride);
+template void Ray::Ref::ConvolutionConcat3x3_1Direct_2GEMM<
+    64, 3, 3, 0, 4, 64, Ray::ePreOp::Upscale, Ray::ePreOp::HDRTransfer, Ray::ePreOp::None, Ray::ePreOp::None,
+    Ray::ePostOp::None, Ray::eActivation::ReLU>(const float data1[], const float data2[], const float data3[],
+                                                const float data4[], const rect_t &rect, int w, int h, int w2, int h2,
+                                                int stride1, int stride2, const int8_t weights[], const float biases[],
+                                                float output[], int output_stride);
+template void
+Ray::Ref::ConvolutionConcat3x3_1Direct_2GEMM<64, 3, 3, 3, 4, 64, Ray::ePreOp::Upscale, Ray::ePreOp::HDRTransfer,
+                                             Ray::ePreOp::None, Ray::ePreOp::PositiveNormalize, Ray::ePostOp::None,
+                                             Ray::eActivation::ReLU>(const float data1[], const float data2[],
+                                                                     const float data3[], const float data4[],
+                                                                     const rect_t &rect, int w, int h, int w2, int h2,
+                                                                     int stride1, int stride2, const int8_t weights[],
+                                                                     const float biases[], float output[],
+                                                                     int output_stride);
+
+template void Ray::Ref::ClearBorders<float>(const rect_t &rect, int w, int h, bool downscaled, int out_channels,
+                                            float output[]);
+template void Ray::Ref::ClearBorders<Ray::bf16_t>(const rect_t &rect, int w, int h, bool downscaled, int out_channels,
+                                                  bf16_t output[]);
+template void Ray::Ref::ClearBorders<Ray::f16_t>(const rect_t &rect, int w, int h, bool downscaled, int out_channels,
+                                                 f16_t output[]);
\ No newline at end of file
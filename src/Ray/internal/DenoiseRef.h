@@ -11,20 +11,20 @@ void JointNLMFilter(const color_rgba_t input[], const rect_t &rect, int input_st
                     color_rgba_t output[]);
 
 template <int InChannels, int OutChannels, int OutPxPitch, ePostOp PostOp = ePostOp::None,
-          eActivation Activation = eActivation::ReLU>
-void Convolution3x3_Direct(const float data[], const rect_t &rect, int w, int h, int stride, const float weights[],
-                           const float biases[], float output[], int output_stride);
+          eActivation Activation = eActivation::ReLU, typename TIn, typename TOut, typename TW>
+void Convolution3x3_Direct(const TIn data[], const rect_t &rect, int w, int h, int stride, const TW weights[],
+                           const float biases[], TOut output[], int output_stride);
 template <int InChannels1, int InChannels2, int InChannels3, int PxPitch, int OutChannels, ePreOp PreOp1 = ePreOp::None,
           ePreOp PreOp2 = ePreOp::None, ePreOp PreOp3 = ePreOp::None, ePostOp PostOp = ePostOp::None,
-          eActivation Activation = eActivation::ReLU>
+          eActivation Activation = eActivation::ReLU, typename TOut, typename TW>
 void Convolution3x3_GEMM(const float data1[], const float data2[], const float data3[], const rect_t &rect, int in_w,
-                         int in_h, int w, int h, int stride, const float weights[], const float biases[],
-                         float output[], int output_stride);
+                         int in_h, int w, int h, int stride, const TW weights[], const float biases[],
+                         TOut output[], int output_stride);
 
 template <int InChannels1, int InChannels2, int OutChannels, ePreOp PreOp1 = ePreOp::None,
-          ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU>
-void ConvolutionConcat3x3_Direct(const float data1[], const float data2[], const rect_t &rect, int w, int h,
-                                 int stride1, int stride2, const float weights[], const float biases[], float output[],
+          ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU, typename T, typename TW>
+void ConvolutionConcat3x3_Direct(const T data1[], const T data2[], const rect_t &rect, int w, int h, int stride1,
+                                 int stride2, const TW weights[], const float biases[], T output[],
                                  int output_stride);
 template <int InChannels1, int InChannels2, int OutChannels, ePreOp PreOp1 = ePreOp::None,
           eActivation Activation = eActivation::ReLU>
@@ -32,11 +32,12 @@ void ConvolutionConcat3x3_GEMM(const float data1[], const float data2[], const r
                                const float weights[], const float biases[], float output[]);
 template <int InChannels1, int InChannels2, int InChannels3, int InChannels4, int PxPitch2, int OutChannels,
           ePreOp PreOp1 = ePreOp::None, ePreOp PreOp2 = ePreOp::None, ePreOp PreOp3 = ePreOp::None,
-          ePreOp PreOp4 = ePreOp::None, ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU>
-void ConvolutionConcat3x3_1Direct_2GEMM(const float data1[], const float data2[], const float data3[],
-                                        const float data4[], const rect_t &rect, int w, int h, int w2, int h2,
-                                        int stride1, int stride2, const float weights[], const float biases[],
-                                        float output[], int output_stride);
-void ClearBorders(const rect_t &rect, int w, int h, bool downscaled, int out_channels, float output[]);
+          ePreOp PreOp4 = ePreOp::None, ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU,
+          typename T, typename TW>
+void ConvolutionConcat3x3_1Direct_2GEMM(const T data1[], const float data2[], const float data3[], const float data4[],
+                                        const rect_t &rect, int w, int h, int w2, int h2, int stride1, int stride2,
+                                        const TW weights[], const float biases[], T output[], int output_stride);
+template <typename T>
+void ClearBorders(const rect_t &rect, int w, int h, bool downscaled, int out_channels, T output[]);
 }
 } // namespace Ray
\ No newline at end of file
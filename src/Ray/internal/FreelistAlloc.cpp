@@ -1,6 +1,7 @@
 #include "FreelistAlloc.h"
 
 #include <cassert>
+#include <cstring>
 
 #include "Core.h"
 
@@ -444,3 +445,61 @@ void Ray::FreelistAlloc::block_merge_next(uint32_t block_index) {
         block_absorb(block_index, next);
     }
 }
+
+namespace Ray {
+template <typename T> void WriteState(const std::vector<T> &v, std::vector<uint8_t> &out_state) {
+    const uint32_t count = uint32_t(v.size());
+    out_state.insert(out_state.end(), (const uint8_t *)&count, (const uint8_t *)&count + sizeof(uint32_t));
+    out_state.insert(out_state.end(), (const uint8_t *)v.data(), (const uint8_t *)(v.data() + count));
+}
+
+template <typename T> bool ReadState(const uint8_t *&data, const uint8_t *end, std::vector<T> &v) {
+    uint32_t count;
+    if (size_t(end - data) < sizeof(uint32_t)) {
+        return false;
+    }
+    memcpy(&count, data, sizeof(uint32_t));
+    data += sizeof(uint32_t);
+    if (size_t(end - data) / sizeof(T) < count) {
+        return false;
+    }
+    v.resize(count);
+    memcpy(v.data(), data, count * sizeof(T));
+    data += count * sizeof(T);
+    return true;
+}
+} // namespace Ray
+
+void Ray::FreelistAlloc::GetState(std::vector<uint8_t> &out_state) const {
+    out_state.insert(out_state.end(), (const uint8_t *)&index_, (const uint8_t *)&index_ + sizeof(index_));
+    WriteState(all_blocks_, out_state);
+    WriteState(unused_blocks_, out_state);
+    WriteState(pools_, out_state);
+    WriteState(unused_pools_, out_state);
+}
+
+bool Ray::FreelistAlloc::SetState(const uint8_t *data, const size_t size) {
+    const uint8_t *end = data + size;
+    if (size < sizeof(index_)) {
+        return false;
+    }
+    memcpy(&index_, data, sizeof(index_));
+    data += sizeof(index_);
+    if (!ReadState(data, end, all_blocks_) || !ReadState(data, end, unused_blocks_) || !ReadState(data, end, pools_) ||
+        !ReadState(data, end, unused_pools_) || data != end || all_blocks_.empty()) {
+        return false;
+    }
+    for (const block_t &b : all_blocks_) {
+        if ((b.prev_phys != 0xffffffff && b.prev_phys >= all_blocks_.size()) ||
+            (b.next_phys != 0xffffffff && b.next_phys >= all_blocks_.size())) {
+            return false;
+        }
+    }
+    for (const pool_t &p : pools_) {
+        if ((p.head != 0xffffffff && p.head >= all_blocks_.size()) ||
+            (p.tail != 0xffffffff && p.tail >= all_blocks_.size())) {
+            return false;
+        }
+    }
+    return true;
+}
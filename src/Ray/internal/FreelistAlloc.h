@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include <utility>
@@ -154,6 +155,10 @@ class FreelistAlloc {
 
     bool IntegrityCheck() const;
 
+    // Serialization of allocator state (block indices are preserved)
+    void GetState(std::vector<uint8_t> &out_state) const;
+    bool SetState(const uint8_t *data, size_t size);
+
     static uint32_t rounded_size(const uint32_t size) { return tlsf_index_t<uint32_t, false>::rounded_size(size); }
 };
 } // namespace Ray
@@ -0,0 +1,78 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+Ray::MappedFile::MappedFile(const char *file_path) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(file_path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    file_ = file;
+
+    LARGE_INTEGER file_size = {};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        return;
+    }
+
+    mapping_ = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (!mapping_) {
+        return;
+    }
+
+    data_ = (uint8_t *)MapViewOfFile(mapping_, FILE_MAP_COPY, 0, 0, 0);
+    if (data_) {
+        size_ = size_t(file_size.QuadPart);
+    }
+#else
+    const int fd = open(file_path, O_RDONLY);
+    if (fd == -1) {
+        return;
+    }
+
+    struct stat st = {};
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        // private mapping allows in-place modification of loaded data without touching the file
+        void *data = mmap(nullptr, size_t(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            data_ = (uint8_t *)data;
+            size_ = size_t(st.st_size);
+        }
+    }
+
+    // mapping stays valid after descriptor is closed
+    close(fd);
+#endif
+}
+
+Ray::MappedFile::~MappedFile() {
+#ifdef _WIN32
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_) {
+        CloseHandle(mapping_);
+    }
+    if (file_) {
+        CloseHandle(file_);
+    }
+#else
+    if (data_) {
+        munmap(data_, size_);
+    }
+#endif
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Ray {
+// Read-only file mapped into memory with copy-on-write semantics (modified pages are never written back)
+class MappedFile {
+    uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    void *file_ = nullptr, *mapping_ = nullptr;
+#endif
+
+  public:
+    explicit MappedFile(const char *file_path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &rhs) = delete;
+    MappedFile &operator=(const MappedFile &rhs) = delete;
+
+    bool ready() const { return data_ != nullptr; }
+
+    uint8_t *data() { return data_; }
+    const uint8_t *data() const { return data_; }
+    size_t size() const { return size_; }
+};
+} // namespace Ray
@@ -93,14 +93,18 @@ bool hash_map_insert(Span<uint64_t> entries, const uint64_t hash_key, uint32_t &
     const uint32_t base_slot = hash_map_base_slot(slot);
     for (uint32_t bucket_offset = 0; bucket_offset < HASH_GRID_HASH_MAP_BUCKET_SIZE && base_slot < entries.size();
          ++bucket_offset) {
-        const uint64_t prev_hash_key =
-            Ray_InterlockedCompareExchange64(&entries[base_slot + bucket_offset], hash_key, HASH_GRID_INVALID_HASH_KEY);
+        // check without locking first, occupied slots never change until resolve
+        uint64_t prev_hash_key = uint64_t(Ray_AtomicLoad64(&entries[base_slot + bucket_offset]));
+        if (prev_hash_key == HASH_GRID_INVALID_HASH_KEY) {
+            prev_hash_key = Ray_InterlockedCompareExchange64(&entries[base_slot + bucket_offset], hash_key,
+                                                             HASH_GRID_INVALID_HASH_KEY);
+        }
         if (prev_hash_key == HASH_GRID_INVALID_HASH_KEY || prev_hash_key == hash_key) {
             cache_entry = base_slot + bucket_offset;
             return true;
         }
     }
-    cache_entry = 0;
+    cache_entry = HASH_GRID_INVALID_CACHE_ENTRY;
     return false;
 }
 
@@ -134,21 +138,11 @@ fvec4 hash_grid_debug(const fvec4 &p, const fvec4 &n, const cache_grid_params_t
     return GetColorFromHash32(hash64(hash_key));
 }
 
-void accumulate_cache_voxel(packed_cache_voxel_t &voxel, const fvec4 &r, const uint32_t sample_data) {
+void accumulate_cache_voxel(cache_voxel_accum_t &accum, Span<packed_cache_voxel_t> voxels,
+                            const uint32_t cache_entry, const fvec4 &r, const uint32_t sample_data) {
     const uvec4 data = uvec4(r * RAD_CACHE_RADIANCE_SCALE);
-
-    if (data.get<0>()) {
-        Ray_InterlockedExchangeAdd(&voxel.v[0], data.get<0>());
-    }
-    if (data.get<1>()) {
-        Ray_InterlockedExchangeAdd(&voxel.v[1], data.get<1>());
-    }
-    if (data.get<2>()) {
-        Ray_InterlockedExchangeAdd(&voxel.v[2], data.get<2>());
-    }
-    if (sample_data) {
-        Ray_InterlockedExchangeAdd(&voxel.v[3], sample_data);
-    }
+    Ray::accumulate_cache_voxel(accum, voxels, cache_entry,
+                                packed_cache_voxel_t{data.get<0>(), data.get<1>(), data.get<2>(), sample_data});
 }
 } // namespace Ref
 } // namespace Ray
@@ -180,6 +174,7 @@ void Ray::Ref::SpatialCacheUpdate(const cache_grid_params_t &params, Span<const
                                   Span<const ray_data_t> rays, Span<cache_data_t> cache_data,
                                   const color_rgba_t radiance[], const color_rgba_t depth_normals[], const int img_w,
                                   Span<uint64_t> entries, Span<packed_cache_voxel_t> voxels_curr) {
+    cache_voxel_accum_t accum;
     for (int i = 0; i < int(inters.size()); ++i) {
         const ray_data_t &r = rays[i];
         const hit_data_t &inter = inters[i];
@@ -202,7 +197,7 @@ void Ray::Ref::SpatialCacheUpdate(const cache_grid_params_t &params, Span<const
             for (int j = 0; j < cache.path_len; ++j) {
                 rad *= make_fvec3(cache.sample_weight[j]);
                 if (cache.cache_entries[j] != HASH_GRID_INVALID_CACHE_ENTRY) {
-                    accumulate_cache_voxel(voxels_curr[cache.cache_entries[j]], rad, 0);
+                    accumulate_cache_voxel(accum, voxels_curr, cache.cache_entries[j], rad, 0);
                 }
             }
         } else {
@@ -214,98 +209,114 @@ void Ray::Ref::SpatialCacheUpdate(const cache_grid_params_t &params, Span<const
             cache.sample_weight[0][0] = cache.sample_weight[0][1] = cache.sample_weight[0][2] = 1.0f;
             cache.cache_entries[0] = insert_entry(entries, P, N, params);
             if (cache.cache_entries[0] != HASH_GRID_INVALID_CACHE_ENTRY) {
-                accumulate_cache_voxel(voxels_curr[cache.cache_entries[0]], rad, 1);
+                accumulate_cache_voxel(accum, voxels_curr, cache.cache_entries[0], rad, 1);
             }
             ++cache.path_len;
 
             for (int j = 1; j < cache.path_len; ++j) {
                 rad *= make_fvec3(cache.sample_weight[j]);
                 if (cache.cache_entries[j] != HASH_GRID_INVALID_CACHE_ENTRY) {
-                    accumulate_cache_voxel(voxels_curr[cache.cache_entries[j]], rad, 0);
+                    accumulate_cache_voxel(accum, voxels_curr, cache.cache_entries[j], rad, 0);
                 }
             }
         }
     }
+
+    flush_cache_voxels(accum, voxels_curr);
 }
 
-void Ray::Ref::SpatialCacheResolve(const cache_grid_params_t &params, Span<uint64_t> entries,
+void Ray::Ref::SpatialCacheResolve(const cache_grid_params_t &params, Span<const uint64_t> entries,
                                    Span<packed_cache_voxel_t> voxels_curr, Span<const packed_cache_voxel_t> voxels_prev,
                                    const uint32_t start, const uint32_t count) {
     assert((start % HASH_GRID_HASH_MAP_BUCKET_SIZE) == 0);
     assert((count % HASH_GRID_HASH_MAP_BUCKET_SIZE) == 0);
     const bool cam_moved = length2(make_fvec3(params.cam_pos_curr) - make_fvec3(params.cam_pos_prev)) > FLT_EPS;
-    for (uint32_t i = start; i < start + count; i += HASH_GRID_HASH_MAP_BUCKET_SIZE) {
-        uint32_t ndx = i; // compact index
-        for (uint32_t j = 0; j < HASH_GRID_HASH_MAP_BUCKET_SIZE; ++j) {
-            const uint64_t hash_key = entries[i + j];
-            if (hash_key == HASH_GRID_INVALID_HASH_KEY) {
-                continue;
-            }
+    for (uint32_t i = start; i < start + count; ++i) {
+        const uint64_t hash_key = entries[i];
+        if (hash_key == HASH_GRID_INVALID_HASH_KEY) {
+            continue;
+        }
 
-            const packed_cache_voxel_t voxel_prev = voxels_prev[i + j];
-            const packed_cache_voxel_t voxel_curr = voxels_curr[i + j];
-            packed_cache_voxel_t packed_data{voxel_prev.v[0] + voxel_curr.v[0], voxel_prev.v[1] + voxel_curr.v[1],
-                                             voxel_prev.v[2] + voxel_curr.v[2], voxel_prev.v[3] + voxel_curr.v[3]};
-            uint32_t sample_count = packed_data.v[3] & RAD_CACHE_SAMPLE_COUNTER_BIT_MASK;
-
-            if (RAD_CACHE_FILTER_ADJACENT_LEVELS && cam_moved && sample_count < RAD_CACHE_SAMPLE_COUNT_MIN &&
-                voxel_curr.v[3]) {
-                const uint64_t adjacent_level_hash = get_adjacent_level_hash(hash_key, params);
-
-                uint32_t cache_entry = HASH_GRID_INVALID_CACHE_ENTRY;
-                if (hash_map_find(entries, adjacent_level_hash, cache_entry)) {
-                    const packed_cache_voxel_t adjacent_voxel_prev = voxels_prev[cache_entry];
-                    const uint32_t adjacent_sample_count = adjacent_voxel_prev.v[3] & RAD_CACHE_SAMPLE_COUNTER_BIT_MASK;
-                    if (adjacent_sample_count > RAD_CACHE_SAMPLE_COUNT_MIN) {
-                        /*packed_data.v[0] += adjacent_voxel_prev.v[0];
-                        packed_data.v[1] += adjacent_voxel_prev.v[1];
-                        packed_data.v[2] += adjacent_voxel_prev.v[2];
-                        sample_count += adjacent_sample_count;*/
-
-                        // less 'sticky' version
-                        const float k = float(RAD_CACHE_SAMPLE_COUNT_MIN) / float(adjacent_sample_count);
-                        packed_data.v[0] += uint32_t(float(adjacent_voxel_prev.v[0]) * k);
-                        packed_data.v[1] += uint32_t(float(adjacent_voxel_prev.v[1]) * k);
-                        packed_data.v[2] += uint32_t(float(adjacent_voxel_prev.v[2]) * k);
-                        sample_count += RAD_CACHE_SAMPLE_COUNT_MIN;
-                    }
+        const packed_cache_voxel_t voxel_prev = voxels_prev[i];
+        const packed_cache_voxel_t voxel_curr = voxels_curr[i];
+        packed_cache_voxel_t packed_data{voxel_prev.v[0] + voxel_curr.v[0], voxel_prev.v[1] + voxel_curr.v[1],
+                                         voxel_prev.v[2] + voxel_curr.v[2], voxel_prev.v[3] + voxel_curr.v[3]};
+        uint32_t sample_count = packed_data.v[3] & RAD_CACHE_SAMPLE_COUNTER_BIT_MASK;
+
+        if (RAD_CACHE_FILTER_ADJACENT_LEVELS && cam_moved && sample_count < RAD_CACHE_SAMPLE_COUNT_MIN &&
+            voxel_curr.v[3]) {
+            const uint64_t adjacent_level_hash = get_adjacent_level_hash(hash_key, params);
+
+            uint32_t cache_entry = HASH_GRID_INVALID_CACHE_ENTRY;
+            if (hash_map_find(entries, adjacent_level_hash, cache_entry)) {
+                const packed_cache_voxel_t adjacent_voxel_prev = voxels_prev[cache_entry];
+                const uint32_t adjacent_sample_count = adjacent_voxel_prev.v[3] & RAD_CACHE_SAMPLE_COUNTER_BIT_MASK;
+                if (adjacent_sample_count > RAD_CACHE_SAMPLE_COUNT_MIN) {
+                    /*packed_data.v[0] += adjacent_voxel_prev.v[0];
+                    packed_data.v[1] += adjacent_voxel_prev.v[1];
+                    packed_data.v[2] += adjacent_voxel_prev.v[2];
+                    sample_count += adjacent_sample_count;*/
+
+                    // less 'sticky' version
+                    const float k = float(RAD_CACHE_SAMPLE_COUNT_MIN) / float(adjacent_sample_count);
+                    packed_data.v[0] += uint32_t(float(adjacent_voxel_prev.v[0]) * k);
+                    packed_data.v[1] += uint32_t(float(adjacent_voxel_prev.v[1]) * k);
+                    packed_data.v[2] += uint32_t(float(adjacent_voxel_prev.v[2]) * k);
+                    sample_count += RAD_CACHE_SAMPLE_COUNT_MIN;
                 }
             }
+        }
 
-            if (sample_count > RAD_CACHE_SAMPLE_COUNT_MAX) {
-                const float k = float(RAD_CACHE_SAMPLE_COUNT_MAX) / float(sample_count);
-                packed_data.v[0] = uint32_t(float(packed_data.v[0]) * k);
-                packed_data.v[1] = uint32_t(float(packed_data.v[1]) * k);
-                packed_data.v[2] = uint32_t(float(packed_data.v[2]) * k);
-                sample_count = RAD_CACHE_SAMPLE_COUNT_MAX;
-            }
+        if (sample_count > RAD_CACHE_SAMPLE_COUNT_MAX) {
+            const float k = float(RAD_CACHE_SAMPLE_COUNT_MAX) / float(sample_count);
+            packed_data.v[0] = uint32_t(float(packed_data.v[0]) * k);
+            packed_data.v[1] = uint32_t(float(packed_data.v[1]) * k);
+            packed_data.v[2] = uint32_t(float(packed_data.v[2]) * k);
+            sample_count = RAD_CACHE_SAMPLE_COUNT_MAX;
+        }
 
-            uint32_t frame_count =
-                (voxel_prev.v[3] >> RAD_CACHE_SAMPLE_COUNTER_BIT_NUM) & RAD_CACHE_FRAME_COUNTER_BIT_MASK;
-            packed_data.v[3] = sample_count;
+        uint32_t frame_count = (voxel_prev.v[3] >> RAD_CACHE_SAMPLE_COUNTER_BIT_NUM) & RAD_CACHE_FRAME_COUNTER_BIT_MASK;
+        packed_data.v[3] = sample_count;
 
-            if ((voxel_curr.v[3] & RAD_CACHE_FRAME_COUNTER_BIT_MASK) == 0) {
-                ++frame_count;
-                packed_data.v[3] |= (frame_count & RAD_CACHE_FRAME_COUNTER_BIT_MASK)
-                                    << RAD_CACHE_SAMPLE_COUNTER_BIT_NUM;
-            }
+        if ((voxel_curr.v[3] & RAD_CACHE_FRAME_COUNTER_BIT_MASK) == 0) {
+            ++frame_count;
+            packed_data.v[3] |= (frame_count & RAD_CACHE_FRAME_COUNTER_BIT_MASK) << RAD_CACHE_SAMPLE_COUNTER_BIT_NUM;
+        }
 
-            if (frame_count > RAD_CACHE_STALE_FRAME_NUM_MAX) {
-                packed_data = {};
-                if (!RAD_CACHE_ENABLE_COMPACTION) {
-                    entries[i + j] = HASH_GRID_INVALID_HASH_KEY;
-                }
+        if (frame_count > RAD_CACHE_STALE_FRAME_NUM_MAX) {
+            packed_data = {};
+        }
+
+        // Only own slot is written, stale entry is released during compaction
+        voxels_curr[i] = packed_data;
+    }
+}
+
+void Ray::Ref::SpatialCacheCompact(Span<uint64_t> entries, Span<packed_cache_voxel_t> voxels_curr,
+                                   Span<packed_cache_voxel_t> voxels_prev, const uint32_t start,
+                                   const uint32_t count) {
+    assert((start % HASH_GRID_HASH_MAP_BUCKET_SIZE) == 0);
+    assert((count % HASH_GRID_HASH_MAP_BUCKET_SIZE) == 0);
+    for (uint32_t i = start; i < start + count; i += HASH_GRID_HASH_MAP_BUCKET_SIZE) {
+        uint32_t ndx = i; // compact index
+        for (uint32_t j = 0; j < HASH_GRID_HASH_MAP_BUCKET_SIZE; ++j) {
+            const uint64_t hash_key = entries[i + j];
+            const packed_cache_voxel_t packed_data = voxels_curr[i + j];
+
+            voxels_curr[i + j] = {};
+            voxels_prev[i + j] = {};
+            if (hash_key == HASH_GRID_INVALID_HASH_KEY) {
+                continue;
             }
 
-            if (RAD_CACHE_ENABLE_COMPACTION) {
+            if (!packed_data.v[3]) {
                 entries[i + j] = HASH_GRID_INVALID_HASH_KEY;
-                voxels_curr[i + j] = {};
-                if (packed_data.v[3]) {
-                    entries[ndx] = hash_key;
-                    voxels_curr[ndx++] = packed_data;
-                }
+            } else if (RAD_CACHE_ENABLE_COMPACTION) {
+                entries[i + j] = HASH_GRID_INVALID_HASH_KEY;
+                entries[ndx] = hash_key;
+                voxels_prev[ndx++] = packed_data;
             } else {
-                voxels_curr[i + j] = packed_data;
+                voxels_prev[i + j] = packed_data;
             }
         }
     }
@@ -33,8 +33,16 @@ void SpatialCacheUpdate(const cache_grid_params_t &params, Span<const hit_data_t
                         Span<cache_data_t> cache_data, const color_rgba_t radiance[],
                         const color_rgba_t depth_normals[], int img_w, Span<uint64_t> entries,
                         Span<packed_cache_voxel_t> voxels_curr);
-void SpatialCacheResolve(const cache_grid_params_t &params, Span<uint64_t> entries,
+// Resolve is split into two passes, each of them processes blocks independently, but all blocks of the first pass
+// must be finished before the second one starts.
+// First pass: accumulated voxels_curr are merged with voxels_prev, result is written back to voxels_curr (entries and
+// voxels_prev are only read, adjacent level lookups may access any block)
+void SpatialCacheResolve(const cache_grid_params_t &params, Span<const uint64_t> entries,
                          Span<packed_cache_voxel_t> voxels_curr, Span<const packed_cache_voxel_t> voxels_prev,
                          uint32_t start, uint32_t count);
+// Second pass: resolved voxels are moved to voxels_prev (empty entries are released, buckets are compacted if
+// enabled), voxels_curr is cleared
+void SpatialCacheCompact(Span<uint64_t> entries, Span<packed_cache_voxel_t> voxels_curr,
+                         Span<packed_cache_voxel_t> voxels_prev, uint32_t start, uint32_t count);
 } // namespace Ref
 } // namespace Ray
\ No newline at end of file
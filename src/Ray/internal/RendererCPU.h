@@ -5,11 +5,13 @@
 #include <functional>
 #include <mutex>
 #include <random>
+#include <string>
 
 #include "../Log.h"
 #include "../RendererBase.h"
 #include "AtmosphereRef.h"
 #include "CDFUtils.h"
+#include "CompressedStream.h"
 #include "CoreRef.h"
 #include "DenoiseRef.h"
 #include "RadCacheRef.h"
@@ -65,8 +67,9 @@ class SIMDPolicy {
 
     static force_inline void TraceRays(Span<ray_data_t> rays, int min_transp_depth, int max_transp_depth,
                                        const scene_data_t &sc, uint32_t node_index, bool trace_lights,
-                                       const Cpu::TexStorageBase *const textures[], const uint32_t rand_seq[],
-                                       const uint32_t random_seed, const int iteration, Span<hit_data_t> out_inter) {
+                                       bool packet_traversal, const Cpu::TexStorageBase *const textures[],
+                                       const uint32_t rand_seq[], const uint32_t random_seed, const int iteration,
+                                       Span<hit_data_t> out_inter) {
         Ref::TraceRays(rays, min_transp_depth, max_transp_depth, sc, node_index, trace_lights, textures, rand_seq,
                        random_seed, iteration, out_inter);
     }
@@ -86,6 +89,18 @@ class SIMDPolicy {
         return Ref::SortRays_CPU(rays, root_min, cell_size, hash_values, scan_values, chunks, chunks_temp);
     }
 
+    static force_inline int PartitionCoherentRays(Span<ray_data_t> rays, Span<hit_data_t> inters,
+                                                  const float cell_size[3], const bool allow_packets,
+                                                  int out_rays_count[2]) {
+        // rays are always traced one by one
+        out_rays_count[0] = int(rays.size());
+        out_rays_count[1] = 0;
+        return 0;
+    }
+
+    static force_inline int CountActiveRays(Span<const ray_data_t> rays) { return int(rays.size()); }
+    static force_inline int CountActiveRays(Span<const shadow_ray_t> rays) { return int(rays.size()); }
+
     static force_inline void ShadePrimary(const pass_settings_t &ps, Span<const hit_data_t> inters,
                                           Span<const ray_data_t> rays, const uint32_t rand_seq[],
                                           const uint32_t rand_seed, const int iteration,
@@ -139,10 +154,10 @@ class SIMDPolicy {
 
     template <int InChannels1, int InChannels2, int InChannels3, int PxPitch, int OutChannels,
               ePreOp PreOp1 = ePreOp::None, ePreOp PreOp2 = ePreOp::None, ePreOp PreOp3 = ePreOp::None,
-              ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU>
+              ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU, typename TOut, typename TW>
     static force_inline void Convolution3x3_GEMM(const float data1[], const float data2[], const float data3[],
                                                  const rect_t &rect, int in_w, int in_h, int w, int h, int stride,
-                                                 const float weights[], const float biases[], float output[],
+                                                 const TW weights[], const float biases[], TOut output[],
                                                  int output_stride) {
         Ref::Convolution3x3_GEMM<InChannels1, InChannels2, InChannels3, PxPitch, OutChannels, PreOp1, PreOp2, PreOp3,
                                  PostOp, Activation>(data1, data2, data3, rect, in_w, in_h, w, h, stride, weights,
@@ -150,49 +165,83 @@ class SIMDPolicy {
     }
 
     template <int InChannels, int OutChannels, int OutPxPitch = OutChannels, ePostOp PostOp = ePostOp::None,
-              eActivation Activation = eActivation::ReLU>
-    static force_inline void Convolution3x3_Direct(const float data[], const rect_t &rect, int w, int h, int stride,
-                                                   const float weights[], const float biases[], float output[],
+              eActivation Activation = eActivation::ReLU, typename TIn, typename TOut, typename TW>
+    static force_inline void Convolution3x3_Direct(const TIn data[], const rect_t &rect, int w, int h, int stride,
+                                                   const TW weights[], const float biases[], TOut output[],
                                                    int output_stride) {
         Ref::Convolution3x3_Direct<InChannels, OutChannels, OutPxPitch, PostOp, Activation>(
             data, rect, w, h, stride, weights, biases, output, output_stride);
     }
 
     template <int InChannels1, int InChannels2, int OutChannels, ePreOp PreOp1 = ePreOp::None,
-              ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU>
-    static force_inline void ConvolutionConcat3x3_Direct(const float data1[], const float data2[], const rect_t &rect,
-                                                         int w, int h, int stride1, int stride2, const float weights[],
-                                                         const float biases[], float output[], int output_stride) {
+              ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU, typename T, typename TW>
+    static force_inline void ConvolutionConcat3x3_Direct(const T data1[], const T data2[], const rect_t &rect, int w,
+                                                         int h, int stride1, int stride2, const TW weights[],
+                                                         const float biases[], T output[], int output_stride) {
         Ref::ConvolutionConcat3x3_Direct<InChannels1, InChannels2, OutChannels, PreOp1, PostOp, Activation>(
             data1, data2, rect, w, h, stride1, stride2, weights, biases, output, output_stride);
     }
 
     template <int InChannels1, int InChannels2, int InChannels3, int InChannels4, int PxPitch2, int OutChannels,
               ePreOp PreOp1 = ePreOp::None, ePreOp PreOp2 = ePreOp::None, ePreOp PreOp3 = ePreOp::None,
-              ePreOp PreOp4 = ePreOp::None, ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU>
+              ePreOp PreOp4 = ePreOp::None, ePostOp PostOp = ePostOp::None, eActivation Activation = eActivation::ReLU,
+              typename T, typename TW>
     static force_inline void
-    ConvolutionConcat3x3_1Direct_2GEMM(const float data1[], const float data2[], const float data3[],
-                                       const float data4[], const rect_t &rect, int w, int h, int w2, int h2,
-                                       int stride1, int stride2, const float weights[], const float biases[],
-                                       float output[], int output_stride) {
+    ConvolutionConcat3x3_1Direct_2GEMM(const T data1[], const float data2[], const float data3[], const float data4[],
+                                       const rect_t &rect, int w, int h, int w2, int h2, int stride1, int stride2,
+                                       const TW weights[], const float biases[], T output[], int output_stride) {
         Ref::ConvolutionConcat3x3_1Direct_2GEMM<InChannels1, InChannels2, InChannels3, InChannels4, PxPitch2,
                                                 OutChannels, PreOp1, PreOp2, PreOp3, PreOp4, PostOp, Activation>(
             data1, data2, data3, data4, rect, w, h, w2, h2, stride1, stride2, weights, biases, output, output_stride);
     }
 
+    template <typename T>
     static force_inline void ClearBorders(const rect_t &rect, int w, int h, bool downscaled, int out_channels,
-                                          float output[]) {
+                                          T output[]) {
         Ref::ClearBorders(rect, w, h, downscaled, out_channels, output);
     }
+
+    static force_inline void ResolveRegion(const rect_t &rect, int w, int iteration, float exposure, float mix_factor,
+                                           float half_mix_factor, bool accumulate_half, eViewTransform view_transform,
+                                           float inv_gamma, float variance_threshold, const color_rgba_t new_color[],
+                                           color_rgba_t full_buf[], color_rgba_t half_buf[],
+                                           color_rgba_t raw_filtered_buf[], color_rgba_t variance_buf[],
+                                           color_rgba_t final_buf[], uint16_t required_samples[]) {
+        Ref::ResolveRegion(rect, w, iteration, exposure, mix_factor, half_mix_factor, accumulate_half, view_transform,
+                           inv_gamma, variance_threshold, new_color, full_buf, half_buf, raw_filtered_buf,
+                           variance_buf, final_buf, required_samples);
+    }
+
+    template <int WINDOW_SIZE, int NEIGHBORHOOD_SIZE>
+    static force_inline void JointNLMFilter(const color_rgba_t input[], const rect_t &rect, int input_stride,
+                                            float alpha, float damping, const color_rgba_t variance[],
+                                            const color_rgba_t feature0[], float feature0_weight,
+                                            const color_rgba_t feature1[], float feature1_weight,
+                                            const rect_t &output_rect, int output_stride, color_rgba_t output[]) {
+        Ref::JointNLMFilter<WINDOW_SIZE, NEIGHBORHOOD_SIZE>(input, rect, input_stride, alpha, damping, variance,
+                                                            feature0, feature0_weight, feature1, feature1_weight,
+                                                            output_rect, output_stride, output);
+    }
 };
 } // namespace Ref
 namespace Cpu {
 template <typename SIMDPolicy> class Renderer : public RendererBase, private SIMDPolicy {
+    // number of cache entries resolved as a single block
+    static const int SpatialCacheBlockSize = 32768;
+
     ILog *log_;
 
-    bool use_tex_compression_, use_spatial_cache_;
-    aligned_vector<color_rgba_t, 16> full_buf_, half_buf_, base_color_buf_, depth_normals_buf_, temp_buf_, final_buf_,
-        raw_filtered_buf_;
+    bool use_tex_compression_, use_spatial_cache_, use_compressed_bvh_, use_packet_traversal_, use_compact_buffers_;
+    eUNetPrecision unet_precision_;
+    size_t tex_page_budget_;
+    std::string tex_page_file_;
+    aligned_vector<color_rgba_t, 16> full_buf_, half_buf_, temp_buf_;
+    // not allocated with compact buffers
+    aligned_vector<color_rgba_t, 16> raw_filtered_buf_, final_buf_, base_color_buf_, depth_normals_buf_;
+    // compact buffers (fp16 difference between half and full values, fp16 raw image, RGB9E5 base color, fp16
+    // depth-normals), tonemapped image is not stored and produced on request
+    std::vector<color_t<uint16_t, 4>> half_delta_buf_, raw_filtered_packed_buf_, depth_normals_packed_buf_;
+    std::vector<rgb9e5_t> base_color_packed_buf_;
     std::vector<uint16_t> required_samples_;
 
     std::mutex mtx_;
@@ -212,27 +261,90 @@ template <typename SIMDPolicy> class Renderer : public RendererBase, private SIM
 
     aligned_vector<float, 64> unet_weights_;
     unet_weight_offsets_t unet_offsets_;
+    // quantized weights (biases are followed by per output channel scales), used with eUNetPrecision::Int8 only
+    aligned_vector<int8_t, 64> unet_weights_i8_;
+    aligned_vector<float, 64> unet_biases_i8_;
+    unet_weight_offsets_t unet_offsets_i8_;
     bool unet_alias_memory_ = true;
+    // only one of heaps is used depending on tensors precision
     aligned_vector<float, 64> unet_tensors_heap_;
-    struct {
-        float *encConv0 = nullptr;
-        float *pool1 = nullptr;
-        float *pool2 = nullptr;
-        float *pool3 = nullptr;
-        float *pool4 = nullptr;
-        float *enc_conv5a = nullptr;
-        float *upsample4 = nullptr;
-        float *dec_conv4a = nullptr;
-        float *upsample3 = nullptr;
-        float *dec_conv3a = nullptr;
-        float *upsample2 = nullptr;
-        float *dec_conv2a = nullptr;
-        float *upsample1 = nullptr;
-        float *dec_conv1a = nullptr;
-        float *dec_conv1b = nullptr;
-    } unet_tensors_;
+    aligned_vector<bf16_t, 64> unet_tensors_heap_bf16_;
+    aligned_vector<f16_t, 64> unet_tensors_heap_f16_;
+    template <typename T> struct unet_tensors_t {
+        T *encConv0 = nullptr;
+        T *pool1 = nullptr;
+        T *pool2 = nullptr;
+        T *pool3 = nullptr;
+        T *pool4 = nullptr;
+        T *enc_conv5a = nullptr;
+        T *upsample4 = nullptr;
+        T *dec_conv4a = nullptr;
+        T *upsample3 = nullptr;
+        T *dec_conv3a = nullptr;
+        T *upsample2 = nullptr;
+        T *dec_conv2a = nullptr;
+        T *upsample1 = nullptr;
+        T *dec_conv1a = nullptr;
+        T *dec_conv1b = nullptr;
+    };
+    unet_tensors_t<float> unet_tensors_;
+    unet_tensors_t<bf16_t> unet_tensors_bf16_;
+    unet_tensors_t<f16_t> unet_tensors_f16_;
     SmallVector<int, 2> unet_alias_dependencies_[UNetFilterPasses];
     void UpdateUNetFilterMemory();
+    template <typename T>
+    static void SetupUNetTensors(const unet_filter_tensors_t &tensors, T *heap, unet_tensors_t<T> &out_tensors);
+    template <typename T, typename TW>
+    void RunUNetFilterPass(int pass, rect_t r, const unet_tensors_t<T> &tensors, const TW weights[],
+                           const float biases[], const unet_weight_offsets_t *offsets);
+
+    static force_inline Ref::fvec4 unpack_half4(const color_t<uint16_t, 4> &v) {
+        return Ref::fvec4{f16_to_f32(v.v[0]), f16_to_f32(v.v[1]), f16_to_f32(v.v[2]), f16_to_f32(v.v[3])};
+    }
+    static force_inline color_t<uint16_t, 4> pack_half4(Ref::fvec4 v) {
+        // out of range values are clamped (instead of turning into infinity)
+        const float HalfMax = 65504.0f;
+        v = min(max(v, -HalfMax), HalfMax);
+        return color_t<uint16_t, 4>{
+            {f32_to_f16(v.get<0>()), f32_to_f16(v.get<1>()), f32_to_f16(v.get<2>()), f32_to_f16(v.get<3>())}};
+    }
+
+    Ref::fvec4 fetch_half_buf(const int i) const {
+        if (use_compact_buffers_) {
+            return Ref::fvec4{full_buf_[i].v, Ref::vector_aligned} + unpack_half4(half_delta_buf_[i]);
+        }
+        return Ref::fvec4{half_buf_[i].v, Ref::vector_aligned};
+    }
+    color_rgba_t fetch_base_color(const int i) const {
+        if (use_compact_buffers_) {
+            color_rgba_t ret = {};
+            rgb9e5_to_rgb(base_color_packed_buf_[i], ret.v);
+            return ret;
+        }
+        return base_color_buf_[i];
+    }
+    color_rgba_t fetch_depth_normals(const int i) const {
+        if (use_compact_buffers_) {
+            color_rgba_t ret;
+            unpack_half4(depth_normals_packed_buf_[i]).store_to(ret.v);
+            return ret;
+        }
+        return depth_normals_buf_[i];
+    }
+    // Estimates variance of accumulated value from the difference between full and half buffers
+    Ref::fvec4 EstimateVariance(int i) const;
+
+    // Copies auxiliary buffers of image rectangle from/to compact storage (rectangle-local arrays are tightly packed)
+    void UnpackAUXBuffers(const rect_t &r, color_rgba_t out_base_color[], color_rgba_t out_depth_normals[]) const;
+    void PackAUXBuffers(const rect_t &r, const color_rgba_t base_color[], const color_rgba_t depth_normals[]);
+
+    struct checkpoint_region_t {
+        int iteration, cache_iteration, base_iteration;
+    };
+    bool ReadCheckpointHeader(CompressedReader &reader, Span<const RegionContext> regions,
+                              std::vector<checkpoint_region_t> &out_regions) const;
+    // Recalculates images that are derived from accumulated ones (after checkpoint loading)
+    void UpdateDerivedImages();
 
   public:
     Renderer(const settings_t &s, ILog *log);
@@ -247,16 +359,12 @@ template <typename SIMDPolicy> class Renderer : public RendererBase, private SIM
 
     std::pair<int, int> size() const override { return std::make_pair(w_, h_); }
 
-    color_data_rgba_t get_pixels_ref() const override { return {final_buf_.data(), w_}; }
-    color_data_rgba_t get_raw_pixels_ref() const override { return {raw_filtered_buf_.data(), w_}; }
-    color_data_rgba_t get_aux_pixels_ref(const eAUXBuffer buf) const override {
-        if (buf == eAUXBuffer::BaseColor) {
-            return {base_color_buf_.data(), w_};
-        } else if (buf == eAUXBuffer::DepthNormals) {
-            return color_data_rgba_t{depth_normals_buf_.data(), w_};
-        }
-        return {};
-    }
+    color_data_rgba_t get_pixels_ref() const override;
+    color_data_rgba_t get_raw_pixels_ref() const override;
+    color_data_rgba_t get_aux_pixels_ref(eAUXBuffer buf) const override;
+    void GetPixels(color_rgba_t out_pixels[], int out_pitch) const override;
+    void GetRawPixels(color_rgba_t out_pixels[], int out_pitch) const override;
+    void GetAUXPixels(eAUXBuffer buf, color_rgba_t out_pixels[], int out_pitch) const override;
 
     const shl1_data_t *get_sh_data_ref() const override { return nullptr; }
 
@@ -264,20 +372,35 @@ template <typename SIMDPolicy> class Renderer : public RendererBase, private SIM
         if (w_ != w || h_ != h) {
             full_buf_.assign(w * h, {});
             full_buf_.shrink_to_fit();
-            half_buf_.assign(w * h, {});
-            half_buf_.shrink_to_fit();
-            base_color_buf_.assign(w * h, {});
-            base_color_buf_.shrink_to_fit();
-            depth_normals_buf_.assign(w * h, {});
-            depth_normals_buf_.shrink_to_fit();
             required_samples_.assign(w * h, 0xffff);
             required_samples_.shrink_to_fit();
-            temp_buf_.assign(w * h, {});
-            temp_buf_.shrink_to_fit();
-            final_buf_.assign(w * h, {});
-            final_buf_.shrink_to_fit();
-            raw_filtered_buf_.assign(w * h, {});
-            raw_filtered_buf_.shrink_to_fit();
+            if (use_compact_buffers_) {
+                half_delta_buf_.assign(w * h, {});
+                half_delta_buf_.shrink_to_fit();
+                raw_filtered_packed_buf_.assign(w * h, {});
+                raw_filtered_packed_buf_.shrink_to_fit();
+                base_color_packed_buf_.assign(w * h, {});
+                base_color_packed_buf_.shrink_to_fit();
+                depth_normals_packed_buf_.assign(w * h, {});
+                depth_normals_packed_buf_.shrink_to_fit();
+                raw_filtered_buf_ = {};
+                final_buf_ = {};
+                base_color_buf_ = {};
+                depth_normals_buf_ = {};
+            } else {
+                half_buf_.assign(w * h, {});
+                half_buf_.shrink_to_fit();
+                raw_filtered_buf_.assign(w * h, {});
+                raw_filtered_buf_.shrink_to_fit();
+                final_buf_.assign(w * h, {});
+                final_buf_.shrink_to_fit();
+                base_color_buf_.assign(w * h, {});
+                base_color_buf_.shrink_to_fit();
+                depth_normals_buf_.assign(w * h, {});
+                depth_normals_buf_.shrink_to_fit();
+                temp_buf_.assign(w * h, {});
+                temp_buf_.shrink_to_fit();
+            }
 
             if (use_spatial_cache_) {
                 temp_cache_data_.assign((w / RAD_CACHE_DOWNSAMPLING_FACTOR) * (h / RAD_CACHE_DOWNSAMPLING_FACTOR), {});
@@ -293,7 +416,11 @@ template <typename SIMDPolicy> class Renderer : public RendererBase, private SIM
 
     void Clear(const color_rgba_t &c) override {
         full_buf_.assign(w_ * h_, c);
-        half_buf_.assign(w_ * h_, c);
+        if (use_compact_buffers_) {
+            half_delta_buf_.assign(w_ * h_, {});
+        } else {
+            half_buf_.assign(w_ * h_, c);
+        }
         required_samples_.assign(w_ * h_, 0xffff);
     }
 
@@ -305,12 +432,21 @@ template <typename SIMDPolicy> class Renderer : public RendererBase, private SIM
     void UpdateSpatialCache(const SceneBase &scene, RegionContext &region) override;
     void ResolveSpatialCache(const SceneBase &scene,
                              const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) override;
+    int spatial_cache_resolve_passes() const override { return 2; }
+    int spatial_cache_blocks_count() const override {
+        return use_spatial_cache_ ? int(HASH_GRID_CACHE_ENTRIES_COUNT / SpatialCacheBlockSize) : 0;
+    }
+    void ResolveSpatialCacheBlock(const SceneBase &scene, int pass, int block) override;
     void ResetSpatialCache(const SceneBase &scene,
                            const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) override;
 
     void GetStats(stats_t &st) override { st = stats_; }
     void ResetStats() override { stats_ = {0}; }
 
+    bool SaveCheckpoint(const SceneBase &scene, Span<const RegionContext> regions, std::ostream &out) const override;
+    bool LoadCheckpoint(const SceneBase &scene, Span<RegionContext> regions, std::istream &in) override;
+    bool MergeCheckpoint(const SceneBase &scene, Span<RegionContext> regions, std::istream &in) override;
+
     unet_filter_properties_t
     InitUNetFilter(bool alias_memory,
                    const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) override;
@@ -333,6 +469,10 @@ template <typename SIMDPolicy> struct PassData {
     aligned_vector<color_rgba_t, 16> variance_buf;
     aligned_vector<color_rgba_t, 16> filtered_variance_buf;
     aligned_vector<color_rgba_t, 16> feature_buf1, feature_buf2;
+    aligned_vector<color_rgba_t, 16> variance_row_buf;
+    std::vector<int> denoise_src_columns;
+    // region-local copies of framebuffers (used with compact buffers)
+    aligned_vector<color_rgba_t, 16> region_color_buf, region_base_color_buf, region_depth_normals_buf;
 
     aligned_vector<typename SIMDPolicy::RayHashType> hash_values;
     std::vector<int> head_flags;
@@ -352,18 +492,38 @@ template <typename SIMDPolicy> PassData<SIMDPolicy> &get_per_thread_pass_data()
 
 template <typename SIMDPolicy>
 Ray::Cpu::Renderer<SIMDPolicy>::Renderer(const settings_t &s, ILog *log)
-    : log_(log), use_tex_compression_(s.use_tex_compression), use_spatial_cache_(s.use_spatial_cache) {
+    : log_(log), use_tex_compression_(s.use_tex_compression), use_spatial_cache_(s.use_spatial_cache),
+      use_compressed_bvh_(s.use_compressed_bvh), use_packet_traversal_(s.use_packet_traversal),
+      use_compact_buffers_(s.use_compact_buffers), unet_precision_(s.unet_precision),
+      tex_page_budget_(size_t(std::max(s.tex_page_budget_mb, 0)) * 1024 * 1024),
+      tex_page_file_(s.tex_page_file ? s.tex_page_file : "") {
     log->Info("============================================================================");
     log->Info("Compression  is %s", use_tex_compression_ ? "enabled" : "disabled");
     log->Info("SpatialCache is %s", use_spatial_cache_ ? "enabled" : "disabled");
+    if (tex_page_budget_) {
+        log->Info("TexPaging    is enabled (%i MB)", s.tex_page_budget_mb);
+    }
+    if (use_compressed_bvh_) {
+        log->Info("QuantizedBVH is enabled");
+    }
+    if (use_packet_traversal_) {
+        log->Info("PacketTrace  is enabled");
+    }
+    if (use_compact_buffers_) {
+        const int compact_size = 2 * sizeof(color_rgba_t) + 2 * sizeof(color_t<uint16_t, 4>) + sizeof(rgb9e5_t) +
+                                 sizeof(uint16_t);
+        const int regular_size = 7 * sizeof(color_rgba_t) + sizeof(uint16_t);
+        log->Info("CompactBufs  is enabled (%i instead of %i bytes per pixel)", compact_size, regular_size);
+    }
     log->Info("============================================================================");
 
     Resize(s.w, s.h);
 }
 
 template <typename SIMDPolicy> Ray::SceneBase *Ray::Cpu::Renderer<SIMDPolicy>::CreateScene() {
-    return new Cpu::Scene(log_, type() != eRendererType::Reference /* use_wide_bvh */, use_tex_compression_,
-                          use_spatial_cache_);
+    return new Cpu::Scene(log_, type() != eRendererType::Reference /* use_wide_bvh */, use_compressed_bvh_,
+                          use_tex_compression_, use_spatial_cache_, tex_page_budget_,
+                          tex_page_file_.empty() ? nullptr : tex_page_file_.c_str());
 }
 
 template <typename SIMDPolicy>
@@ -389,6 +549,7 @@ void Ray::Cpu::Renderer<SIMDPolicy>::RenderScene(const SceneBase &scene, RegionC
                                   s.vertices_.empty() ? nullptr : &s.vertices_[0],
                                   s.nodes_.empty() ? nullptr : &s.nodes_[0],
                                   s.wnodes_.empty() ? nullptr : &s.wnodes_[0],
+                                  s.qwnodes_.empty() ? nullptr : &s.qwnodes_[0],
                                   s.tris_.empty() ? nullptr : &s.tris_[0],
                                   s.tri_indices_.empty() ? nullptr : &s.tri_indices_[0],
                                   s.mtris_.data(),
@@ -430,9 +591,7 @@ void Ray::Cpu::Renderer<SIMDPolicy>::RenderScene(const SceneBase &scene, RegionC
     PassData<SIMDPolicy> &p = get_per_thread_pass_data<SIMDPolicy>();
 
     // make sure we will not use stale values
-    get_per_thread_BCCache<1>().Invalidate();
-    get_per_thread_BCCache<2>().Invalidate();
-    get_per_thread_BCCache<4>().Invalidate();
+    InvalidateBCCaches();
 
     const auto time_start = high_resolution_clock::now();
     time_point<high_resolution_clock> time_after_ray_gen;
@@ -446,10 +605,27 @@ void Ray::Cpu::Renderer<SIMDPolicy>::RenderScene(const SceneBase &scene, RegionC
 
         time_after_ray_gen = high_resolution_clock::now();
 
-        if (tlas_root != 0xffffffff) {
+        if (tlas_root != 0xffffffff && use_packet_traversal_) {
+            // camera rays are mostly coherent, such packets are traced together
+            int rays_count[2];
+            const int coherent_count = SIMDPolicy::PartitionCoherentRays(p.primary_rays, p.intersections, cell_size,
+                                                                         true, rays_count);
+            const int total_count = int(p.primary_rays.size());
+            SIMDPolicy::TraceRays(Span<typename SIMDPolicy::RayDataType>{p.primary_rays.data(), coherent_count},
+                                  cam.pass_settings.min_transp_depth, cam.pass_settings.max_transp_depth, sc_data,
+                                  tlas_root, false, true, s.tex_storages_, rand_seq, rand_seed, region.iteration,
+                                  Span<typename SIMDPolicy::HitDataType>{p.intersections.data(), coherent_count});
+            SIMDPolicy::TraceRays(
+                Span<typename SIMDPolicy::RayDataType>{p.primary_rays.data() + coherent_count,
+                                                       total_count - coherent_count},
+                cam.pass_settings.min_transp_depth, cam.pass_settings.max_transp_depth, sc_data, tlas_root, false,
+                false, s.tex_storages_, rand_seq, rand_seed, region.iteration,
+                Span<typename SIMDPolicy::HitDataType>{p.intersections.data() + coherent_count,
+                                                       total_count - coherent_count});
+        } else if (tlas_root != 0xffffffff) {
             SIMDPolicy::TraceRays(p.primary_rays, cam.pass_settings.min_transp_depth,
-                                  cam.pass_settings.max_transp_depth, sc_data, tlas_root, false, s.tex_storages_,
-                                  rand_seq, rand_seed, region.iteration, p.intersections);
+                                  cam.pass_settings.max_transp_depth, sc_data, tlas_root, false, false,
+                                  s.tex_storages_, rand_seq, rand_seed, region.iteration, p.intersections);
         }
     } else {
         const mesh_instance_t &mi = sc_data.mesh_instances[cam.mi_index];
@@ -460,10 +636,12 @@ void Ray::Cpu::Renderer<SIMDPolicy>::RenderScene(const SceneBase &scene, RegionC
         time_after_ray_gen = high_resolution_clock::now();
     }
 
-    // factor used to compute incremental average
-    const float mix_factor = 1.0f / float(region.iteration);
+    // factor used to compute incremental average (of samples rendered by this renderer)
+    const float mix_factor = 1.0f / float(region.iteration - region.base_iteration);
 
     const auto time_after_prim_trace = high_resolution_clock::now();
+    const int primary_rays_count =
+        SIMDPolicy::CountActiveRays(Span<const typename SIMDPolicy::RayDataType>{p.primary_rays});
 
     p.secondary_rays.resize(p.primary_rays.size());
     p.shadow_rays.resize(p.primary_rays.size());
@@ -471,24 +649,52 @@ void Ray::Cpu::Renderer<SIMDPolicy>::RenderScene(const SceneBase &scene, RegionC
 
     int secondary_rays_count = 0, shadow_rays_count = 0, def_sky_count = 0;
 
+    // kernels address output buffers with absolute pixel coordinates
+    int out_w = w_;
+    color_rgba_t *out_color = temp_buf_.data(), *out_base_color = base_color_buf_.data(),
+                 *out_depth_normals = depth_normals_buf_.data();
+    if (use_compact_buffers_) {
+        p.region_color_buf.resize(rect.w * rect.h);
+        p.region_base_color_buf.resize(rect.w * rect.h);
+        p.region_depth_normals_buf.resize(rect.w * rect.h);
+        UnpackAUXBuffers(rect, p.region_base_color_buf.data(), p.region_depth_normals_buf.data());
+
+        // region-local buffers are offset to make absolute coordinates point inside of them
+        const ptrdiff_t offset = ptrdiff_t(rect.y) * rect.w + rect.x;
+        out_w = rect.w;
+        out_color = p.region_color_buf.data() - offset;
+        out_base_color = p.region_base_color_buf.data() - offset;
+        out_depth_normals = p.region_depth_normals_buf.data() - offset;
+    }
+
     const eSpatialCacheMode cache_mode = use_spatial_cache_ ? eSpatialCacheMode::Query : eSpatialCacheMode::None;
     SIMDPolicy::ShadePrimary(cam.pass_settings, p.intersections, p.primary_rays, rand_seq, rand_seed, region.iteration,
-                             cache_mode, sc_data, s.tex_storages_, &p.secondary_rays[0], &secondary_rays_count,
-                             &p.shadow_rays[0], &shadow_rays_count, &p.deferred_sky_indexes[0], &def_sky_count, w_,
-                             mix_factor, temp_buf_.data(), base_color_buf_.data(), depth_normals_buf_.data());
+                             cache_mode, sc_data, s.tex_storages_, p.secondary_rays.data(), &secondary_rays_count,
+                             p.shadow_rays.data(), &shadow_rays_count, p.deferred_sky_indexes.data(), &def_sky_count,
+                             out_w, mix_factor, out_color, out_base_color, out_depth_normals);
     SIMDPolicy::ShadeSkyPrimary(cam.pass_settings, p.intersections, p.primary_rays,
-                                {&p.deferred_sky_indexes[0], def_sky_count}, sc_data, region.iteration, w_,
-                                temp_buf_.data());
+                                {p.deferred_sky_indexes.data(), def_sky_count}, sc_data, region.iteration, out_w,
+                                out_color);
+
+    if (use_compact_buffers_) {
+        PackAUXBuffers(rect, p.region_base_color_buf.data(), p.region_depth_normals_buf.data());
+    }
 
     const auto time_after_prim_shade = high_resolution_clock::now();
+    const int primary_shadow_rays_count = SIMDPolicy::CountActiveRays(
+        Span<const typename SIMDPolicy::ShadowRayType>{p.shadow_rays.data(), shadow_rays_count});
 
     SIMDPolicy::TraceShadowRays(Span<typename SIMDPolicy::ShadowRayType>{p.shadow_rays.data(), shadow_rays_count},
                                 cam.pass_settings.max_transp_depth, cam.pass_settings.clamp_direct, sc_data, tlas_root,
-                                rand_seq, rand_seed, region.iteration, s.tex_storages_, w_, temp_buf_.data());
+                                rand_seq, rand_seed, region.iteration, s.tex_storages_, out_w, out_color);
 
     const auto time_after_prim_shadow = high_resolution_clock::now();
     duration<double, std::micro> secondary_sort_time{}, secondary_trace_time{}, secondary_shade_time{},
         secondary_shadow_time{};
+    // secondary rays traced one by one (0) and in packets (1)
+    duration<double, std::micro> secondary_trace_mode_time[2] = {};
+    unsigned long long secondary_mode_rays[2] = {};
+    unsigned long long secondary_total_rays = 0, secondary_shadow_rays = 0;
 
     p.hash_values.resize(p.primary_rays.size());
     p.scan_values.resize(round_up(rect.w, 4) * round_up(rect.h, 4));
@@ -525,15 +731,41 @@ void Ray::Cpu::Renderer<SIMDPolicy>::RenderScene(const SceneBase &scene, RegionC
 
         const auto time_secondary_trace_start = high_resolution_clock::now();
 
+        // bounced rays rarely stay coherent, but the ones that do are traced in packets
+        int mode_rays_count[2];
+        const int coherent_count = SIMDPolicy::PartitionCoherentRays(
+            Span<typename SIMDPolicy::RayDataType>{p.secondary_rays.data(), secondary_rays_count},
+            Span<typename SIMDPolicy::HitDataType>{p.intersections.data(), secondary_rays_count}, cell_size,
+            use_packet_traversal_, mode_rays_count);
+        secondary_mode_rays[0] += mode_rays_count[0];
+        secondary_mode_rays[1] += mode_rays_count[1];
+
         for (int i = 0; i < secondary_rays_count; i++) {
             p.intersections[i] = {};
         }
 
-        SIMDPolicy::TraceRays(Span<typename SIMDPolicy::RayDataType>{p.secondary_rays.data(), secondary_rays_count},
+        const auto time_secondary_packet_start = high_resolution_clock::now();
+
+        SIMDPolicy::TraceRays(Span<typename SIMDPolicy::RayDataType>{p.secondary_rays.data(), coherent_count},
                               cam.pass_settings.min_transp_depth, cam.pass_settings.max_transp_depth, sc_data,
-                              tlas_root, true, s.tex_storages_, rand_seq, rand_seed, region.iteration, p.intersections);
+                              tlas_root, true, true, s.tex_storages_, rand_seq, rand_seed, region.iteration,
+                              Span<typename SIMDPolicy::HitDataType>{p.intersections.data(), coherent_count});
+
+        const auto time_secondary_single_start = high_resolution_clock::now();
+
+        SIMDPolicy::TraceRays(
+            Span<typename SIMDPolicy::RayDataType>{p.secondary_rays.data() + coherent_count,
+                                                   secondary_rays_count - coherent_count},
+            cam.pass_settings.min_transp_depth, cam.pass_settings.max_transp_depth, sc_data, tlas_root, true, false,
+            s.tex_storages_, rand_seq, rand_seed, region.iteration,
+            Span<typename SIMDPolicy::HitDataType>{p.intersections.data() + coherent_count,
+                                                   secondary_rays_count - coherent_count});
 
         const auto time_secondary_shade_start = high_resolution_clock::now();
+        secondary_trace_mode_time[1] +=
+            duration<double, std::micro>{time_secondary_single_start - time_secondary_packet_start};
+        secondary_trace_mode_time[0] +=
+            duration<double, std::micro>{time_secondary_shade_start - time_secondary_single_start};
 
         int rays_count = secondary_rays_count;
         secondary_rays_count = shadow_rays_count = def_sky_count = 0;
@@ -546,17 +778,21 @@ void Ray::Cpu::Renderer<SIMDPolicy>::RenderScene(const SceneBase &scene, RegionC
                                    Span<typename SIMDPolicy::RayDataType>{p.primary_rays.data(), rays_count}, rand_seq,
                                    rand_seed, region.iteration, cache_mode, sc_data, s.tex_storages_,
                                    &p.secondary_rays[0], &secondary_rays_count, &p.shadow_rays[0], &shadow_rays_count,
-                                   &p.deferred_sky_indexes[0], &def_sky_count, w_, temp_buf_.data(), nullptr, nullptr);
+                                   &p.deferred_sky_indexes[0], &def_sky_count, out_w, out_color, nullptr, nullptr);
         SIMDPolicy::ShadeSkySecondary(cam.pass_settings, clamp_direct, p.intersections, p.primary_rays,
-                                      {&p.deferred_sky_indexes[0], def_sky_count}, sc_data, region.iteration, w_,
-                                      temp_buf_.data());
+                                      {&p.deferred_sky_indexes[0], def_sky_count}, sc_data, region.iteration, out_w,
+                                      out_color);
 
         const auto time_secondary_shadow_start = high_resolution_clock::now();
+        secondary_total_rays += SIMDPolicy::CountActiveRays(
+            Span<const typename SIMDPolicy::RayDataType>{p.primary_rays.data(), rays_count});
+        secondary_shadow_rays += SIMDPolicy::CountActiveRays(
+            Span<const typename SIMDPolicy::ShadowRayType>{p.shadow_rays.data(), shadow_rays_count});
 
         SIMDPolicy::TraceShadowRays(Span<typename SIMDPolicy::ShadowRayType>{p.shadow_rays.data(), shadow_rays_count},
                                     cam.pass_settings.max_transp_depth, cam.pass_settings.clamp_indirect, sc_data,
-                                    tlas_root, rand_seq, rand_seed, region.iteration, s.tex_storages_, w_,
-                                    temp_buf_.data());
+                                    tlas_root, rand_seq, rand_seed, region.iteration, s.tex_storages_, out_w,
+                                    out_color);
 
         const auto time_secondary_shadow_end = high_resolution_clock::now();
         secondary_sort_time += duration<double, std::micro>{time_secondary_trace_start - time_secondary_sort_start};
@@ -575,7 +811,7 @@ void Ray::Cpu::Renderer<SIMDPolicy>::RenderScene(const SceneBase &scene, RegionC
     exposure.set<3>(1.0f);
 
     const float variance_threshold =
-        region.iteration > cam.pass_settings.min_samples
+        (region.iteration - region.base_iteration) > cam.pass_settings.min_samples
             ? 0.5f * cam.pass_settings.variance_threshold * cam.pass_settings.variance_threshold
             : 0.0f;
 
@@ -592,65 +828,86 @@ void Ray::Cpu::Renderer<SIMDPolicy>::RenderScene(const SceneBase &scene, RegionC
             (unsigned long long)duration<double, std::micro>{time_after_prim_shadow - time_after_prim_shade}.count();
         stats_.time_secondary_sort_us += (unsigned long long)secondary_sort_time.count();
         stats_.time_secondary_trace_us += (unsigned long long)secondary_trace_time.count();
+        stats_.time_secondary_trace_single_us += (unsigned long long)secondary_trace_mode_time[0].count();
+        stats_.time_secondary_trace_packet_us += (unsigned long long)secondary_trace_mode_time[1].count();
+        stats_.secondary_rays_single += secondary_mode_rays[0];
+        stats_.secondary_rays_packet += secondary_mode_rays[1];
+        stats_.primary_rays += primary_rays_count;
+        stats_.primary_shadow_rays += primary_shadow_rays_count;
+        stats_.secondary_rays += secondary_total_rays;
+        stats_.secondary_shadow_rays += secondary_shadow_rays;
         stats_.time_secondary_shade_us += (unsigned long long)secondary_shade_time.count();
         stats_.time_secondary_shadow_us += (unsigned long long)secondary_shadow_time.count();
+        if (s.tex_page_cache_) {
+            uint64_t page_hits, page_misses;
+            s.tex_page_cache_->TakeStats(page_hits, page_misses);
+            stats_.tex_page_hits += page_hits;
+            stats_.tex_page_misses += page_misses;
+        }
+        uint64_t block_hits, block_misses;
+        TakeBCCacheStats(block_hits, block_misses);
+        stats_.tex_block_hits += block_hits;
+        stats_.tex_block_misses += block_misses;
 
         tonemap_params_ = tonemap_params;
         variance_threshold_ = variance_threshold;
     }
 
     const bool is_class_a = popcount(uint32_t(region.iteration - 1) & 0xaaaaaaaa) & 1;
-    const float half_mix_factor = 1.0f / float((region.iteration + 1) / 2);
-    for (int y = rect.y; y < rect.y + rect.h; ++y) {
-        for (int x = rect.x; x < rect.x + rect.w; ++x) {
-            if (required_samples_[y * w_ + x] < region.iteration) {
-                continue;
-            }
-
-            const auto new_val = Ref::fvec4{temp_buf_[y * w_ + x].v, Ref::vector_aligned} * exposure;
-            // accumulate full buffer
-            Ref::fvec4 cur_val_full = {full_buf_[y * w_ + x].v, Ref::vector_aligned};
-            cur_val_full += (new_val - cur_val_full) * mix_factor;
-            cur_val_full.store_to(full_buf_[y * w_ + x].v, Ref::vector_aligned);
-            if (is_class_a) {
-                // accumulate half buffer
-                Ref::fvec4 cur_val_half = {half_buf_[y * w_ + x].v, Ref::vector_aligned};
-                cur_val_half += (new_val - cur_val_half) * half_mix_factor;
-                cur_val_half.store_to(half_buf_[y * w_ + x].v, Ref::vector_aligned);
+    const float half_mix_factor =
+        1.0f / float(std::max((region.iteration + 1) / 2 - (region.base_iteration + 1) / 2, 1));
+    if (!use_compact_buffers_) {
+        // new samples are in temp_buf_, it is overwritten with variance
+        SIMDPolicy::ResolveRegion(rect, w_, region.iteration, exposure.get<0>(), mix_factor, half_mix_factor,
+                                  is_class_a, tonemap_params.view_transform, tonemap_params.inv_gamma,
+                                  variance_threshold, out_color, full_buf_.data(), half_buf_.data(),
+                                  raw_filtered_buf_.data(), temp_buf_.data(), final_buf_.data(),
+                                  required_samples_.data());
+    } else {
+        // (compact mode estimates variance on the fly)
+        for (int y = rect.y; y < rect.y + rect.h; ++y) {
+            for (int x = rect.x; x < rect.x + rect.w; ++x) {
+                if (required_samples_[y * w_ + x] >= region.iteration) {
+                    const auto new_val = Ref::fvec4{out_color[y * out_w + x].v, Ref::vector_aligned} * exposure;
+                    // compact half buffer is relative to full one, so it has to be fetched before update
+                    Ref::fvec4 cur_val_half = fetch_half_buf(y * w_ + x);
+                    // accumulate full buffer
+                    Ref::fvec4 cur_val_full = {full_buf_[y * w_ + x].v, Ref::vector_aligned};
+                    cur_val_full += (new_val - cur_val_full) * mix_factor;
+                    cur_val_full.store_to(full_buf_[y * w_ + x].v, Ref::vector_aligned);
+                    if (is_class_a) {
+                        // accumulate half buffer
+                        cur_val_half += (new_val - cur_val_half) * half_mix_factor;
+                    }
+                    // storing the difference keeps fp16 rounding error proportional to noise level
+                    half_delta_buf_[y * w_ + x] = pack_half4(cur_val_half - cur_val_full);
+                }
+
+                // Store as denosed result until DenoiseImage method will be called
+                raw_filtered_packed_buf_[y * w_ + x] = pack_half4({full_buf_[y * w_ + x].v, Ref::vector_aligned});
+
+                const Ref::fvec4 variance = EstimateVariance(y * w_ + x);
+                if (simd_cast(variance >= variance_threshold).not_all_zeros()) {
+                    required_samples_[y * w_ + x] = region.iteration + 1;
+                }
             }
         }
     }
 
-    for (int y = rect.y; y < rect.y + rect.h; ++y) {
-        for (int x = rect.x; x < rect.x + rect.w; ++x) {
-            auto full_val = Ref::fvec4{full_buf_[y * w_ + x].v, Ref::vector_aligned};
-            auto half_val = Ref::fvec4{half_buf_[y * w_ + x].v, Ref::vector_aligned};
-
-            // Store as denosed result until DenoiseImage method will be called
-            full_val.store_to(raw_filtered_buf_[y * w_ + x].v, Ref::vector_aligned);
-
-            const Ref::fvec4 tonemapped_res = Tonemap(tonemap_params, full_val);
-            tonemapped_res.store_to(final_buf_[y * w_ + x].v, Ref::vector_aligned);
-
-            const Ref::fvec4 p1 = reversible_tonemap(max(2.0f * full_val - half_val, 0.0f));
-            const Ref::fvec4 p2 = reversible_tonemap(half_val);
-
-            const Ref::fvec4 variance = 0.5f * (p1 - p2) * (p1 - p2);
-            variance.store_to(temp_buf_[y * w_ + x].v, Ref::vector_aligned);
-
 #if DEBUG_ADAPTIVE_SAMPLING
-            if (cam.pass_settings.variance_threshold != 0.0f && required_samples_[y * w_ + x] >= region.iteration &&
-                (region.iteration % 5) == 0) {
-                final_buf_[y * w_ + x].v[0] = 1.0f;
-                full_buf_[y * w_ + x].v[0] = 1.0f;
-            }
-#endif
-
-            if (simd_cast(variance >= variance_threshold).not_all_zeros()) {
-                required_samples_[y * w_ + x] = region.iteration + 1;
+    if (cam.pass_settings.variance_threshold != 0.0f && (region.iteration % 5) == 0) {
+        for (int y = rect.y; y < rect.y + rect.h; ++y) {
+            for (int x = rect.x; x < rect.x + rect.w; ++x) {
+                if (required_samples_[y * w_ + x] >= region.iteration) {
+                    if (!use_compact_buffers_) {
+                        final_buf_[y * w_ + x].v[0] = 1.0f;
+                    }
+                    full_buf_[y * w_ + x].v[0] = 1.0f;
+                }
             }
         }
     }
+#endif
 }
 
 template <typename SIMDPolicy> void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const RegionContext &region) {
@@ -671,28 +928,49 @@ template <typename SIMDPolicy> void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage
     p.feature_buf1.resize(rect_ext.w * rect_ext.h);
     p.feature_buf2.resize(rect_ext.w * rect_ext.h);
 
-#define FETCH_FINAL_BUF(_x, _y)                                                                                        \
-    Ref::fvec4(full_buf_[std::min(std::max(_y, 0), h_ - 1) * w_ + std::min(std::max(_x, 0), w_ - 1)].v,                \
-               Ref::vector_aligned)
-#define FETCH_VARIANCE(_x, _y)                                                                                         \
-    Ref::fvec4(temp_buf_[std::min(std::max(_y, 0), h_ - 1) * w_ + std::min(std::max(_x, 0), w_ - 1)].v,                \
-               Ref::vector_aligned)
+    auto fetch_variance = [this](const int i) {
+        if (use_compact_buffers_) {
+            return EstimateVariance(i);
+        }
+        return Ref::fvec4(temp_buf_[i].v, Ref::vector_aligned);
+    };
 
+    static const int GaussRadius = 4;
     static const float GaussWeights[] = {0.2270270270f, 0.1945945946f, 0.1216216216f, 0.0540540541f, 0.0162162162f};
 
+    // Image borders are handled once here by clamping source columns, filtering loops below do not need any checks
+    p.denoise_src_columns.resize(rect_ext.w + 2 * GaussRadius);
+    for (int x = 0; x < rect_ext.w + 2 * GaussRadius; ++x) {
+        p.denoise_src_columns[x] = std::min(std::max(rect_ext.x - GaussRadius + x, 0), w_ - 1);
+    }
+    const int *src_columns = &p.denoise_src_columns[GaussRadius];
+
+    p.variance_row_buf.resize(rect_ext.w + 2 * GaussRadius);
+
     for (int y = 0; y < rect_ext.h; ++y) {
-        const int yy = rect_ext.y + y;
+        const int src_row = std::min(std::max(rect_ext.y + y, 0), h_ - 1) * w_;
+
+        for (int x = -GaussRadius; x < rect_ext.w + GaussRadius; ++x) {
+            fetch_variance(src_row + src_columns[x])
+                .store_to(p.variance_row_buf[GaussRadius + x].v, Ref::vector_aligned);
+        }
+
         for (int x = 0; x < rect_ext.w; ++x) {
-            const int xx = rect_ext.x + x;
-            const Ref::fvec4 center_col = reversible_tonemap(FETCH_FINAL_BUF(xx, yy));
+            const int src_index = src_row + src_columns[x];
+
+            const Ref::fvec4 center_col = reversible_tonemap(Ref::fvec4(full_buf_[src_index].v, Ref::vector_aligned));
             center_col.store_to(p.temp_final_buf[y * rect_ext.w + x].v, Ref::vector_aligned);
 
-            const Ref::fvec4 center_val = FETCH_VARIANCE(xx, yy);
+            p.feature_buf1[y * rect_ext.w + x] = fetch_base_color(src_index);
+            p.feature_buf2[y * rect_ext.w + x] = fetch_depth_normals(src_index);
+
+            const color_rgba_t *variance_row = &p.variance_row_buf[GaussRadius + x];
+            const Ref::fvec4 center_val = {variance_row[0].v, Ref::vector_aligned};
 
             Ref::fvec4 res = center_val * GaussWeights[0];
             UNROLLED_FOR(i, 4, {
-                res += FETCH_VARIANCE(xx - i + 1, yy) * GaussWeights[i + 1];
-                res += FETCH_VARIANCE(xx + i + 1, yy) * GaussWeights[i + 1];
+                res += Ref::fvec4(variance_row[1 - i].v, Ref::vector_aligned) * GaussWeights[i + 1];
+                res += Ref::fvec4(variance_row[i + 1].v, Ref::vector_aligned) * GaussWeights[i + 1];
             })
 
             res = max(res, center_val);
@@ -700,16 +978,8 @@ template <typename SIMDPolicy> void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage
         }
     }
 
-#undef FETCH_VARIANCE
-#undef FETCH_FINAL_BUF
-
-#define FETCH_BASE_COLOR(_x, _y)                                                                                       \
-    base_color_buf_[std::min(std::max(_y, 0), h_ - 1) * w_ + std::min(std::max(_x, 0), w_ - 1)]
-#define FETCH_DEPTH_NORMALS(_x, _y)                                                                                    \
-    depth_normals_buf_[std::min(std::max(_y, 0), h_ - 1) * w_ + std::min(std::max(_x, 0), w_ - 1)]
-
-    for (int y = 4; y < rect_ext.h - 4; ++y) {
-        for (int x = 4; x < rect_ext.w - 4; ++x) {
+    for (int y = GaussRadius; y < rect_ext.h - GaussRadius; ++y) {
+        for (int x = GaussRadius; x < rect_ext.w - GaussRadius; ++x) {
             const Ref::fvec4 center_val = {p.variance_buf[(y + 0) * rect_ext.w + x].v, Ref::vector_aligned};
 
             Ref::fvec4 res = center_val * GaussWeights[0];
@@ -722,15 +992,9 @@ template <typename SIMDPolicy> void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage
 
             res = max(res, center_val);
             res.store_to(p.filtered_variance_buf[y * rect_ext.w + x].v, Ref::vector_aligned);
-
-            p.feature_buf1[y * rect_ext.w + x] = FETCH_BASE_COLOR(rect_ext.x + x, rect_ext.y + y);
-            p.feature_buf2[y * rect_ext.w + x] = FETCH_DEPTH_NORMALS(rect_ext.x + x, rect_ext.y + y);
         }
     }
 
-#undef FETCH_BASE_COLOR
-#undef FETCH_DEPTH_NORMALS
-
     Ref::tonemap_params_t tonemap_params;
     float variance_threshold;
 
@@ -758,15 +1022,28 @@ template <typename SIMDPolicy> void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage
 
     static_assert(EXT_RADIUS >= (NLM_WINDOW_SIZE - 1) / 2 + (NLM_NEIGHBORHOOD_SIZE - 1) / 2, "!");
 
-    Ref::JointNLMFilter<NLM_WINDOW_SIZE, NLM_NEIGHBORHOOD_SIZE>(
+    // filtered image is written to region-local buffer with compact buffers (it is packed afterwards)
+    int out_w = w_;
+    color_rgba_t *out_raw = raw_filtered_buf_.data();
+    if (use_compact_buffers_) {
+        p.region_color_buf.resize(rect.w * rect.h);
+        out_w = rect.w;
+        out_raw = p.region_color_buf.data() - (ptrdiff_t(rect.y) * rect.w + rect.x);
+    }
+
+    SIMDPolicy::template JointNLMFilter<NLM_WINDOW_SIZE, NLM_NEIGHBORHOOD_SIZE>(
         p.temp_final_buf.data(), rect_t{EXT_RADIUS, EXT_RADIUS, rect.w, rect.h}, rect_ext.w, 1.0f, 0.45f,
         p.filtered_variance_buf.data(), !p.feature_buf1.empty() ? p.feature_buf1.data() : nullptr, 64.0f,
-        !p.feature_buf2.empty() ? p.feature_buf2.data() : nullptr, 32.0f, rect, w_, raw_filtered_buf_.data());
+        !p.feature_buf2.empty() ? p.feature_buf2.data() : nullptr, 32.0f, rect, out_w, out_raw);
 
     for (int y = rect.y; y < rect.y + rect.h; ++y) {
         for (int x = rect.x; x < rect.x + rect.w; ++x) {
-            auto col = Ref::fvec4(raw_filtered_buf_[y * w_ + x].v, Ref::vector_aligned);
+            auto col = Ref::fvec4(out_raw[y * out_w + x].v, Ref::vector_aligned);
             col = Ref::reversible_tonemap_invert(col);
+            if (use_compact_buffers_) {
+                raw_filtered_packed_buf_[y * w_ + x] = pack_half4(col);
+                continue;
+            }
             col.store_to(raw_filtered_buf_[y * w_ + x].v, Ref::vector_aligned);
             col = Tonemap(tonemap_params, col);
             col.store_to(final_buf_[y * w_ + x].v, Ref::vector_aligned);
@@ -786,34 +1063,88 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
     using namespace std::chrono;
     const auto denoise_start = high_resolution_clock::now();
 
-    const int w_rounded = 16 * ((w_ + 15) / 16);
-    const int h_rounded = 16 * ((h_ + 15) / 16);
-
     rect_t r = region.rect();
     if (pass < 15) {
         r.w = 16 * ((r.w + 15) / 16);
         r.h = 16 * ((r.h + 15) / 16);
     }
 
-    const float *weights = unet_weights_.data();
-    const unet_weight_offsets_t *offsets = &unet_offsets_;
+    if (unet_precision_ == eUNetPrecision::BF16) {
+        RunUNetFilterPass(pass, r, unet_tensors_bf16_, unet_weights_.data(), unet_weights_.data(), &unet_offsets_);
+    } else if (unet_precision_ == eUNetPrecision::FP16) {
+        RunUNetFilterPass(pass, r, unet_tensors_f16_, unet_weights_.data(), unet_weights_.data(), &unet_offsets_);
+    } else if (unet_precision_ == eUNetPrecision::Int8) {
+        RunUNetFilterPass(pass, r, unet_tensors_, unet_weights_i8_.data(), unet_biases_i8_.data(), &unet_offsets_i8_);
+    } else {
+        RunUNetFilterPass(pass, r, unet_tensors_, unet_weights_.data(), unet_weights_.data(), &unet_offsets_);
+    }
+
+    const auto denoise_end = high_resolution_clock::now();
+
+    {
+        std::lock_guard<std::mutex> _(mtx_);
+        stats_.time_denoise_us += (unsigned long long)duration<double, std::micro>{denoise_end - denoise_start}.count();
+    }
+}
+
+template <typename SIMDPolicy>
+template <typename T, typename TW>
+void Ray::Cpu::Renderer<SIMDPolicy>::RunUNetFilterPass(const int pass, rect_t r, const unet_tensors_t<T> &tensors,
+                                                        const TW weights[], const float biases[],
+                                                        const unet_weight_offsets_t *offsets) {
+    const int w_rounded = 16 * ((w_ + 15) / 16);
+    const int h_rounded = 16 * ((h_ + 15) / 16);
+
+    // input image (addressed with absolute pixel coordinates)
+    const float *in_color = nullptr, *in_base_color = nullptr, *in_depth_normals = nullptr;
+    int in_stride = w_;
+    if (pass == 0 || pass == 13) {
+        if (use_compact_buffers_) {
+            // convolution reads one pixel around the region
+            rect_t ext;
+            ext.x = std::max(r.x - 1, 0);
+            ext.y = std::max(r.y - 1, 0);
+            ext.w = std::min(r.x + r.w + 1, w_) - ext.x;
+            ext.h = std::min(r.y + r.h + 1, h_) - ext.y;
+
+            PassData<SIMDPolicy> &p = get_per_thread_pass_data<SIMDPolicy>();
+            p.region_color_buf.resize(ext.w * ext.h);
+            p.region_base_color_buf.resize(ext.w * ext.h);
+            p.region_depth_normals_buf.resize(ext.w * ext.h);
+            for (int y = 0; y < ext.h; ++y) {
+                memcpy(&p.region_color_buf[y * ext.w], &full_buf_[(ext.y + y) * w_ + ext.x],
+                       ext.w * sizeof(color_rgba_t));
+            }
+            UnpackAUXBuffers(ext, p.region_base_color_buf.data(), p.region_depth_normals_buf.data());
+
+            const ptrdiff_t offset = 4 * (ptrdiff_t(ext.y) * ext.w + ext.x);
+            in_color = &p.region_color_buf[0].v[0] - offset;
+            in_base_color = &p.region_base_color_buf[0].v[0] - offset;
+            in_depth_normals = &p.region_depth_normals_buf[0].v[0] - offset;
+            in_stride = ext.w;
+        } else {
+            in_color = &full_buf_[0].v[0];
+            in_base_color = &base_color_buf_[0].v[0];
+            in_depth_normals = &depth_normals_buf_[0].v[0];
+        }
+    }
 
     switch (pass) {
     case 0: {
         SIMDPolicy::template Convolution3x3_GEMM<3, 3, 3, 4, 32, ePreOp::HDRTransfer, ePreOp::None,
                                                  ePreOp::PositiveNormalize>(
-            &full_buf_[0].v[0], &base_color_buf_[0].v[0], &depth_normals_buf_[0].v[0], r, w_, h_, w_rounded, h_rounded,
-            w_, &weights[offsets->enc_conv0_weight], &weights[offsets->enc_conv0_bias],
-            unet_tensors_.encConv0 + (w_rounded + 3) * 32, w_rounded + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded, h_rounded, false, 32, unet_tensors_.encConv0);
+            in_color, in_base_color, in_depth_normals, r, w_, h_, w_rounded, h_rounded, in_stride,
+            &weights[offsets->enc_conv0_weight], &biases[offsets->enc_conv0_bias],
+            tensors.encConv0 + (w_rounded + 3) * 32, w_rounded + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded, h_rounded, false, 32, tensors.encConv0);
         break;
     }
     case 1: {
         SIMDPolicy::template Convolution3x3_Direct<32, 32, 32, Ray::ePostOp::Downscale>(
-            unet_tensors_.encConv0 + (w_rounded + 3) * 32, r, w_rounded, h_rounded, w_rounded + 2,
-            &weights[offsets->enc_conv1_weight], &weights[offsets->enc_conv1_bias],
-            unet_tensors_.pool1 + (w_rounded / 2 + 3) * 32, w_rounded / 2 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded, h_rounded, true, 32, unet_tensors_.pool1);
+            tensors.encConv0 + (w_rounded + 3) * 32, r, w_rounded, h_rounded, w_rounded + 2,
+            &weights[offsets->enc_conv1_weight], &biases[offsets->enc_conv1_bias],
+            tensors.pool1 + (w_rounded / 2 + 3) * 32, w_rounded / 2 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded, h_rounded, true, 32, tensors.pool1);
         break;
     }
     case 2: {
@@ -822,10 +1153,10 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 1) / 2;
         r.h = (r.h + 1) / 2;
         SIMDPolicy::template Convolution3x3_Direct<32, 48, 48, Ray::ePostOp::Downscale>(
-            unet_tensors_.pool1 + (w_rounded / 2 + 3) * 32, r, w_rounded / 2, h_rounded / 2, w_rounded / 2 + 2,
-            &weights[offsets->enc_conv2_weight], &weights[offsets->enc_conv2_bias],
-            unet_tensors_.pool2 + (w_rounded / 4 + 3) * 48, w_rounded / 4 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 2, h_rounded / 2, true, 48, unet_tensors_.pool2);
+            tensors.pool1 + (w_rounded / 2 + 3) * 32, r, w_rounded / 2, h_rounded / 2, w_rounded / 2 + 2,
+            &weights[offsets->enc_conv2_weight], &biases[offsets->enc_conv2_bias],
+            tensors.pool2 + (w_rounded / 4 + 3) * 48, w_rounded / 4 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded / 2, h_rounded / 2, true, 48, tensors.pool2);
         break;
     }
     case 3: {
@@ -834,10 +1165,10 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 3) / 4;
         r.h = (r.h + 3) / 4;
         SIMDPolicy::template Convolution3x3_Direct<48, 64, 64, Ray::ePostOp::Downscale>(
-            unet_tensors_.pool2 + (w_rounded / 4 + 3) * 48, r, w_rounded / 4, h_rounded / 4, w_rounded / 4 + 2,
-            &weights[offsets->enc_conv3_weight], &weights[offsets->enc_conv3_bias],
-            unet_tensors_.pool3 + (w_rounded / 8 + 3) * 64, w_rounded / 8 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 4, h_rounded / 4, true, 64, unet_tensors_.pool3);
+            tensors.pool2 + (w_rounded / 4 + 3) * 48, r, w_rounded / 4, h_rounded / 4, w_rounded / 4 + 2,
+            &weights[offsets->enc_conv3_weight], &biases[offsets->enc_conv3_bias],
+            tensors.pool3 + (w_rounded / 8 + 3) * 64, w_rounded / 8 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded / 4, h_rounded / 4, true, 64, tensors.pool3);
         break;
     }
     case 4: {
@@ -846,10 +1177,10 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 7) / 8;
         r.h = (r.h + 7) / 8;
         SIMDPolicy::template Convolution3x3_Direct<64, 80, 80, Ray::ePostOp::Downscale>(
-            unet_tensors_.pool3 + (w_rounded / 8 + 3) * 64, r, w_rounded / 8, h_rounded / 8, w_rounded / 8 + 2,
-            &weights[offsets->enc_conv4_weight], &weights[offsets->enc_conv4_bias],
-            unet_tensors_.pool4 + (w_rounded / 16 + 3) * 80, w_rounded / 16 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 8, h_rounded / 8, true, 80, unet_tensors_.pool4);
+            tensors.pool3 + (w_rounded / 8 + 3) * 64, r, w_rounded / 8, h_rounded / 8, w_rounded / 8 + 2,
+            &weights[offsets->enc_conv4_weight], &biases[offsets->enc_conv4_bias],
+            tensors.pool4 + (w_rounded / 16 + 3) * 80, w_rounded / 16 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded / 8, h_rounded / 8, true, 80, tensors.pool4);
         break;
     }
     case 5: {
@@ -858,10 +1189,10 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 15) / 16;
         r.h = (r.h + 15) / 16;
         SIMDPolicy::template Convolution3x3_Direct<80, 96>(
-            unet_tensors_.pool4 + (w_rounded / 16 + 3) * 80, r, w_rounded / 16, h_rounded / 16, w_rounded / 16 + 2,
-            &weights[offsets->enc_conv5a_weight], &weights[offsets->enc_conv5a_bias],
-            unet_tensors_.enc_conv5a + (w_rounded / 16 + 3) * 96, w_rounded / 16 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 16, h_rounded / 16, false, 96, unet_tensors_.enc_conv5a);
+            tensors.pool4 + (w_rounded / 16 + 3) * 80, r, w_rounded / 16, h_rounded / 16, w_rounded / 16 + 2,
+            &weights[offsets->enc_conv5a_weight], &biases[offsets->enc_conv5a_bias],
+            tensors.enc_conv5a + (w_rounded / 16 + 3) * 96, w_rounded / 16 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded / 16, h_rounded / 16, false, 96, tensors.enc_conv5a);
         break;
     }
     case 6: {
@@ -870,10 +1201,10 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 15) / 16;
         r.h = (r.h + 15) / 16;
         SIMDPolicy::template Convolution3x3_Direct<96, 96>(
-            unet_tensors_.enc_conv5a + (w_rounded / 16 + 3) * 96, r, w_rounded / 16, h_rounded / 16, w_rounded / 16 + 2,
-            &weights[offsets->enc_conv5b_weight], &weights[offsets->enc_conv5b_bias],
-            unet_tensors_.upsample4 + (w_rounded / 16 + 3) * 96, w_rounded / 16 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 16, h_rounded / 16, false, 96, unet_tensors_.upsample4);
+            tensors.enc_conv5a + (w_rounded / 16 + 3) * 96, r, w_rounded / 16, h_rounded / 16, w_rounded / 16 + 2,
+            &weights[offsets->enc_conv5b_weight], &biases[offsets->enc_conv5b_bias],
+            tensors.upsample4 + (w_rounded / 16 + 3) * 96, w_rounded / 16 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded / 16, h_rounded / 16, false, 96, tensors.upsample4);
         break;
     }
     case 7: {
@@ -882,11 +1213,11 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 7) / 8;
         r.h = (r.h + 7) / 8;
         SIMDPolicy::template ConvolutionConcat3x3_Direct<96, 64, 112, Ray::ePreOp::Upscale>(
-            unet_tensors_.upsample4 + (w_rounded / 16 + 3) * 96, unet_tensors_.pool3 + (w_rounded / 8 + 3) * 64, r,
+            tensors.upsample4 + (w_rounded / 16 + 3) * 96, tensors.pool3 + (w_rounded / 8 + 3) * 64, r,
             w_rounded / 8, h_rounded / 8, w_rounded / 16 + 2, w_rounded / 8 + 2, &weights[offsets->dec_conv4a_weight],
-            &weights[offsets->dec_conv4a_bias], unet_tensors_.dec_conv4a + (w_rounded / 8 + 3) * 112,
+            &biases[offsets->dec_conv4a_bias], tensors.dec_conv4a + (w_rounded / 8 + 3) * 112,
             w_rounded / 8 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 8, h_rounded / 8, false, 112, unet_tensors_.dec_conv4a);
+        SIMDPolicy::ClearBorders(r, w_rounded / 8, h_rounded / 8, false, 112, tensors.dec_conv4a);
         break;
     }
     case 8: {
@@ -895,10 +1226,10 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 7) / 8;
         r.h = (r.h + 7) / 8;
         SIMDPolicy::template Convolution3x3_Direct<112, 112>(
-            unet_tensors_.dec_conv4a + (w_rounded / 8 + 3) * 112, r, w_rounded / 8, h_rounded / 8, w_rounded / 8 + 2,
-            &weights[offsets->dec_conv4b_weight], &weights[offsets->dec_conv4b_bias],
-            unet_tensors_.upsample3 + (w_rounded / 8 + 3) * 112, w_rounded / 8 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 8, h_rounded / 8, false, 112, unet_tensors_.upsample3);
+            tensors.dec_conv4a + (w_rounded / 8 + 3) * 112, r, w_rounded / 8, h_rounded / 8, w_rounded / 8 + 2,
+            &weights[offsets->dec_conv4b_weight], &biases[offsets->dec_conv4b_bias],
+            tensors.upsample3 + (w_rounded / 8 + 3) * 112, w_rounded / 8 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded / 8, h_rounded / 8, false, 112, tensors.upsample3);
         break;
     }
     case 9: {
@@ -907,10 +1238,10 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 3) / 4;
         r.h = (r.h + 3) / 4;
         SIMDPolicy::template ConvolutionConcat3x3_Direct<112, 48, 96, Ray::ePreOp::Upscale>(
-            unet_tensors_.upsample3 + (w_rounded / 8 + 3) * 112, unet_tensors_.pool2 + (w_rounded / 4 + 3) * 48, r,
+            tensors.upsample3 + (w_rounded / 8 + 3) * 112, tensors.pool2 + (w_rounded / 4 + 3) * 48, r,
             w_rounded / 4, h_rounded / 4, w_rounded / 8 + 2, w_rounded / 4 + 2, &weights[offsets->dec_conv3a_weight],
-            &weights[offsets->dec_conv3a_bias], unet_tensors_.dec_conv3a + (w_rounded / 4 + 3) * 96, w_rounded / 4 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 4, h_rounded / 4, false, 96, unet_tensors_.dec_conv3a);
+            &biases[offsets->dec_conv3a_bias], tensors.dec_conv3a + (w_rounded / 4 + 3) * 96, w_rounded / 4 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded / 4, h_rounded / 4, false, 96, tensors.dec_conv3a);
         break;
     }
     case 10: {
@@ -919,10 +1250,10 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 3) / 4;
         r.h = (r.h + 3) / 4;
         SIMDPolicy::template Convolution3x3_Direct<96, 96>(
-            unet_tensors_.dec_conv3a + (w_rounded / 4 + 3) * 96, r, w_rounded / 4, h_rounded / 4, w_rounded / 4 + 2,
-            &weights[offsets->dec_conv3b_weight], &weights[offsets->dec_conv3b_bias],
-            unet_tensors_.upsample2 + (w_rounded / 4 + 3) * 96, w_rounded / 4 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 4, h_rounded / 4, false, 96, unet_tensors_.upsample2);
+            tensors.dec_conv3a + (w_rounded / 4 + 3) * 96, r, w_rounded / 4, h_rounded / 4, w_rounded / 4 + 2,
+            &weights[offsets->dec_conv3b_weight], &biases[offsets->dec_conv3b_bias],
+            tensors.upsample2 + (w_rounded / 4 + 3) * 96, w_rounded / 4 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded / 4, h_rounded / 4, false, 96, tensors.upsample2);
         break;
     }
     case 11: {
@@ -931,10 +1262,10 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 1) / 2;
         r.h = (r.h + 1) / 2;
         SIMDPolicy::template ConvolutionConcat3x3_Direct<96, 32, 64, Ray::ePreOp::Upscale>(
-            unet_tensors_.upsample2 + (w_rounded / 4 + 3) * 96, unet_tensors_.pool1 + (w_rounded / 2 + 3) * 32, r,
+            tensors.upsample2 + (w_rounded / 4 + 3) * 96, tensors.pool1 + (w_rounded / 2 + 3) * 32, r,
             w_rounded / 2, h_rounded / 2, w_rounded / 4 + 2, w_rounded / 2 + 2, &weights[offsets->dec_conv2a_weight],
-            &weights[offsets->dec_conv2a_bias], unet_tensors_.dec_conv2a + (w_rounded / 2 + 3) * 64, w_rounded / 2 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 2, h_rounded / 2, false, 64, unet_tensors_.dec_conv2a);
+            &biases[offsets->dec_conv2a_bias], tensors.dec_conv2a + (w_rounded / 2 + 3) * 64, w_rounded / 2 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded / 2, h_rounded / 2, false, 64, tensors.dec_conv2a);
         break;
     }
     case 12: {
@@ -943,35 +1274,54 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         r.w = (r.w + 1) / 2;
         r.h = (r.h + 1) / 2;
         SIMDPolicy::template Convolution3x3_Direct<64, 64>(
-            unet_tensors_.dec_conv2a + (w_rounded / 2 + 3) * 64, r, w_rounded / 2, h_rounded / 2, w_rounded / 2 + 2,
-            &weights[offsets->dec_conv2b_weight], &weights[offsets->dec_conv2b_bias],
-            unet_tensors_.upsample1 + (w_rounded / 2 + 3) * 64, w_rounded / 2 + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded / 2, h_rounded / 2, false, 64, unet_tensors_.upsample1);
+            tensors.dec_conv2a + (w_rounded / 2 + 3) * 64, r, w_rounded / 2, h_rounded / 2, w_rounded / 2 + 2,
+            &weights[offsets->dec_conv2b_weight], &biases[offsets->dec_conv2b_bias],
+            tensors.upsample1 + (w_rounded / 2 + 3) * 64, w_rounded / 2 + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded / 2, h_rounded / 2, false, 64, tensors.upsample1);
         break;
     }
     case 13: {
         SIMDPolicy::template ConvolutionConcat3x3_1Direct_2GEMM<64, 3, 3, 3, 4, 64, Ray::ePreOp::Upscale,
                                                                 Ray::ePreOp::HDRTransfer, Ray::ePreOp::None,
                                                                 Ray::ePreOp::PositiveNormalize>(
-            unet_tensors_.upsample1 + (w_rounded / 2 + 3) * 64, &full_buf_[0].v[0], &base_color_buf_[0].v[0],
-            &depth_normals_buf_[0].v[0], r, w_rounded, h_rounded, w_, h_, w_rounded / 2 + 2, w_,
-            &weights[offsets->dec_conv1a_weight], &weights[offsets->dec_conv1a_bias],
-            unet_tensors_.dec_conv1a + (w_rounded + 3) * 64, w_rounded + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded, h_rounded, false, 64, unet_tensors_.dec_conv1a);
+            tensors.upsample1 + (w_rounded / 2 + 3) * 64, in_color, in_base_color, in_depth_normals, r, w_rounded,
+            h_rounded, w_, h_, w_rounded / 2 + 2, in_stride,
+            &weights[offsets->dec_conv1a_weight], &biases[offsets->dec_conv1a_bias],
+            tensors.dec_conv1a + (w_rounded + 3) * 64, w_rounded + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded, h_rounded, false, 64, tensors.dec_conv1a);
         break;
     }
     case 14: {
         SIMDPolicy::template Convolution3x3_Direct<64, 32>(
-            unet_tensors_.dec_conv1a + (w_rounded + 3) * 64, r, w_rounded, h_rounded, w_rounded + 2,
-            &weights[offsets->dec_conv1b_weight], &weights[offsets->dec_conv1b_bias],
-            unet_tensors_.dec_conv1b + (w_rounded + 3) * 32, w_rounded + 2);
-        SIMDPolicy::ClearBorders(r, w_rounded, h_rounded, false, 32, unet_tensors_.dec_conv1b);
+            tensors.dec_conv1a + (w_rounded + 3) * 64, r, w_rounded, h_rounded, w_rounded + 2,
+            &weights[offsets->dec_conv1b_weight], &biases[offsets->dec_conv1b_bias],
+            tensors.dec_conv1b + (w_rounded + 3) * 32, w_rounded + 2);
+        SIMDPolicy::ClearBorders(r, w_rounded, h_rounded, false, 32, tensors.dec_conv1b);
         break;
     }
     case 15: {
+        if (use_compact_buffers_) {
+            // output is written to region-local buffer and packed afterwards
+            PassData<SIMDPolicy> &p = get_per_thread_pass_data<SIMDPolicy>();
+            p.region_color_buf.resize(r.w * r.h);
+            float *out_raw = &p.region_color_buf[0].v[0] - 4 * (ptrdiff_t(r.y) * r.w + r.x);
+
+            SIMDPolicy::template Convolution3x3_Direct<32, 3, 4, ePostOp::HDRTransfer>(
+                tensors.dec_conv1b + (w_rounded + 3) * 32, r, w_, h_, w_rounded + 2,
+                &weights[offsets->dec_conv0_weight], &biases[offsets->dec_conv0_bias], out_raw, r.w);
+
+            for (int y = 0; y < r.h; ++y) {
+                for (int x = 0; x < r.w; ++x) {
+                    raw_filtered_packed_buf_[(r.y + y) * w_ + (r.x + x)] =
+                        pack_half4({p.region_color_buf[y * r.w + x].v, Ref::vector_aligned});
+                }
+            }
+            break;
+        }
+
         SIMDPolicy::template Convolution3x3_Direct<32, 3, 4, ePostOp::HDRTransfer>(
-            unet_tensors_.dec_conv1b + (w_rounded + 3) * 32, r, w_, h_, w_rounded + 2,
-            &weights[offsets->dec_conv0_weight], &weights[offsets->dec_conv0_bias], &raw_filtered_buf_[0].v[0], 0);
+            tensors.dec_conv1b + (w_rounded + 3) * 32, r, w_, h_, w_rounded + 2,
+            &weights[offsets->dec_conv0_weight], &biases[offsets->dec_conv0_bias], &raw_filtered_buf_[0].v[0], 0);
 
         Ref::tonemap_params_t tonemap_params;
 
@@ -991,13 +1341,6 @@ void Ray::Cpu::Renderer<SIMDPolicy>::DenoiseImage(const int pass, const RegionCo
         break;
     }
     }
-
-    const auto denoise_end = high_resolution_clock::now();
-
-    {
-        std::lock_guard<std::mutex> _(mtx_);
-        stats_.time_denoise_us += (unsigned long long)duration<double, std::micro>{denoise_end - denoise_start}.count();
-    }
 }
 
 template <typename SIMDPolicy>
@@ -1029,6 +1372,7 @@ void Ray::Cpu::Renderer<SIMDPolicy>::UpdateSpatialCache(const SceneBase &scene,
                                   s.vertices_.empty() ? nullptr : &s.vertices_[0],
                                   s.nodes_.empty() ? nullptr : &s.nodes_[0],
                                   s.wnodes_.empty() ? nullptr : &s.wnodes_[0],
+                                  s.qwnodes_.empty() ? nullptr : &s.qwnodes_[0],
                                   s.tris_.empty() ? nullptr : &s.tris_[0],
                                   s.tri_indices_.empty() ? nullptr : &s.tri_indices_[0],
                                   s.mtris_.data(),
@@ -1061,10 +1405,15 @@ void Ray::Cpu::Renderer<SIMDPolicy>::UpdateSpatialCache(const SceneBase &scene,
 
     PassData<SIMDPolicy> &p = get_per_thread_pass_data<SIMDPolicy>();
 
+    // Radiance and depth-normals are written at downsampled coordinates (with full image pitch), only rows of current
+    // region are kept in region-local buffers
+    p.region_color_buf.resize(rect.h * w_);
+    p.region_depth_normals_buf.resize(rect.h * w_);
+    color_rgba_t *radiance_buf = p.region_color_buf.data() - ptrdiff_t(rect.y) * w_,
+                 *depth_normals_buf = p.region_depth_normals_buf.data() - ptrdiff_t(rect.y) * w_;
+
     // make sure we will not use stale values
-    get_per_thread_BCCache<1>().Invalidate();
-    get_per_thread_BCCache<2>().Invalidate();
-    get_per_thread_BCCache<4>().Invalidate();
+    InvalidateBCCaches();
 
     const auto time_start = high_resolution_clock::now();
 
@@ -1077,8 +1426,8 @@ void Ray::Cpu::Renderer<SIMDPolicy>::UpdateSpatialCache(const SceneBase &scene,
                                         region.cache_iteration, nullptr, p.primary_rays, p.intersections);
         if (tlas_root != 0xffffffff) {
             SIMDPolicy::TraceRays(p.primary_rays, cam.pass_settings.min_transp_depth,
-                                  cam.pass_settings.max_transp_depth, sc_data, tlas_root, false, s.tex_storages_,
-                                  rand_seq, rand_seed, region.cache_iteration, p.intersections);
+                                  cam.pass_settings.max_transp_depth, sc_data, tlas_root, false, false,
+                                  s.tex_storages_, rand_seq, rand_seed, region.cache_iteration, p.intersections);
         }
     } else {
         assert(false && "Unsupported camera type!");
@@ -1092,15 +1441,15 @@ void Ray::Cpu::Renderer<SIMDPolicy>::UpdateSpatialCache(const SceneBase &scene,
     SIMDPolicy::ShadePrimary(cam.pass_settings, p.intersections, p.primary_rays, rand_seq, rand_seed,
                              region.cache_iteration, eSpatialCacheMode::Update, sc_data, s.tex_storages_,
                              &p.secondary_rays[0], &secondary_rays_count, &p.shadow_rays[0], &shadow_rays_count,
-                             nullptr, nullptr, w_, 1.0f, temp_buf_.data(), nullptr, raw_filtered_buf_.data());
+                             nullptr, nullptr, w_, 1.0f, radiance_buf, nullptr, depth_normals_buf);
 
     SIMDPolicy::TraceShadowRays(Span<typename SIMDPolicy::ShadowRayType>{p.shadow_rays.data(), shadow_rays_count},
                                 cam.pass_settings.max_transp_depth, cam.pass_settings.clamp_direct, sc_data, tlas_root,
-                                rand_seq, rand_seed, region.cache_iteration, s.tex_storages_, w_, temp_buf_.data());
+                                rand_seq, rand_seed, region.cache_iteration, s.tex_storages_, w_, radiance_buf);
 
     rect_fill<cache_data_t>(temp_cache_data_, (w_ / RAD_CACHE_DOWNSAMPLING_FACTOR), rect, cache_data_t{});
     SIMDPolicy::SpatialCacheUpdate(cache_grid_params, p.intersections, p.primary_rays, temp_cache_data_,
-                                   temp_buf_.data(), raw_filtered_buf_.data(), w_, s.spatial_cache_entries_,
+                                   radiance_buf, depth_normals_buf, w_, s.spatial_cache_entries_,
                                    s.spatial_cache_voxels_curr_);
 
     p.hash_values.resize(p.primary_rays.size());
@@ -1121,7 +1470,7 @@ void Ray::Cpu::Renderer<SIMDPolicy>::UpdateSpatialCache(const SceneBase &scene,
         auto intersections = Span<typename SIMDPolicy::HitDataType>{p.intersections.data(), secondary_rays_count};
 
         SIMDPolicy::TraceRays(rays, cam.pass_settings.min_transp_depth, cam.pass_settings.max_transp_depth, sc_data,
-                              tlas_root, true, s.tex_storages_, rand_seq, rand_seed, region.cache_iteration,
+                              tlas_root, true, false, s.tex_storages_, rand_seq, rand_seed, region.cache_iteration,
                               p.intersections);
 
         secondary_rays_count = 0;
@@ -1133,15 +1482,15 @@ void Ray::Cpu::Renderer<SIMDPolicy>::UpdateSpatialCache(const SceneBase &scene,
         SIMDPolicy::ShadeSecondary(cam.pass_settings, clamp_direct, intersections, rays, rand_seq, rand_seed,
                                    region.cache_iteration, eSpatialCacheMode::Update, sc_data, s.tex_storages_,
                                    &p.secondary_rays[0], &secondary_rays_count, &p.shadow_rays[0], &shadow_rays_count,
-                                   nullptr, nullptr, w_, temp_buf_.data(), nullptr, raw_filtered_buf_.data());
+                                   nullptr, nullptr, w_, radiance_buf, nullptr, depth_normals_buf);
 
         SIMDPolicy::TraceShadowRays(Span<typename SIMDPolicy::ShadowRayType>{p.shadow_rays.data(), shadow_rays_count},
                                     cam.pass_settings.max_transp_depth, cam.pass_settings.clamp_indirect, sc_data,
                                     tlas_root, rand_seq, rand_seed, region.cache_iteration, s.tex_storages_, w_,
-                                    temp_buf_.data());
+                                    radiance_buf);
 
-        SIMDPolicy::SpatialCacheUpdate(cache_grid_params, intersections, rays, temp_cache_data_, temp_buf_.data(),
-                                       raw_filtered_buf_.data(), w_, s.spatial_cache_entries_,
+        SIMDPolicy::SpatialCacheUpdate(cache_grid_params, intersections, rays, temp_cache_data_, radiance_buf,
+                                       depth_normals_buf, w_, s.spatial_cache_entries_,
                                        s.spatial_cache_voxels_curr_);
     }
 
@@ -1152,12 +1501,29 @@ void Ray::Cpu::Renderer<SIMDPolicy>::UpdateSpatialCache(const SceneBase &scene,
     {
         std::lock_guard<std::mutex> _(mtx_);
         stats_.time_cache_update_us += (unsigned long long)duration<double, std::micro>{time_end - time_start}.count();
+
+        uint64_t block_hits, block_misses;
+        TakeBCCacheStats(block_hits, block_misses);
+        stats_.tex_block_hits += block_hits;
+        stats_.tex_block_misses += block_misses;
     }
 }
 
 template <typename SIMDPolicy>
 void Ray::Cpu::Renderer<SIMDPolicy>::ResolveSpatialCache(
     const SceneBase &scene, const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
+    if (!use_spatial_cache_) {
+        return;
+    }
+
+    for (int pass = 0; pass < spatial_cache_resolve_passes(); ++pass) {
+        parallel_for(0, spatial_cache_blocks_count(), [&](const int i) { ResolveSpatialCacheBlock(scene, pass, i); });
+    }
+}
+
+template <typename SIMDPolicy>
+void Ray::Cpu::Renderer<SIMDPolicy>::ResolveSpatialCacheBlock(const SceneBase &scene, const int pass,
+                                                               const int block) {
     using namespace std::chrono;
 
     if (!use_spatial_cache_) {
@@ -1176,23 +1542,24 @@ void Ray::Cpu::Renderer<SIMDPolicy>::ResolveSpatialCache(
     memcpy(params.cam_pos_curr, cam.origin, 3 * sizeof(float));
     memcpy(params.cam_pos_prev, s.spatial_cache_cam_pos_prev_, 3 * sizeof(float));
 
-    static const int ResolvePortion = 32768;
-    assert((s.spatial_cache_entries_.size() % ResolvePortion) == 0);
-    const int JobsCount = int(s.spatial_cache_entries_.size() / ResolvePortion);
+    const int blocks_count = spatial_cache_blocks_count();
+    assert(s.spatial_cache_entries_.size() == size_t(blocks_count) * SpatialCacheBlockSize);
+    assert(block >= 0 && block < blocks_count);
 
-    parallel_for(0, JobsCount, [&](const int i) {
+    if (pass == 0) {
         Ref::SpatialCacheResolve(params, s.spatial_cache_entries_, s.spatial_cache_voxels_curr_,
-                                 s.spatial_cache_voxels_prev_, i * ResolvePortion, ResolvePortion);
-    });
-
-    std::swap(s.spatial_cache_voxels_prev_, s.spatial_cache_voxels_curr_);
-    parallel_for(0, JobsCount, [&](const int i) {
-        auto it = begin(s.spatial_cache_voxels_curr_) + i * ResolvePortion;
-        std::fill(it, it + ResolvePortion, packed_cache_voxel_t{});
-    });
-
-    // Store previous camera position
-    memcpy(s.spatial_cache_cam_pos_prev_, cam.origin, 3 * sizeof(float));
+                                 s.spatial_cache_voxels_prev_, block * SpatialCacheBlockSize, SpatialCacheBlockSize);
+    } else {
+        assert(pass == 1);
+        Ref::SpatialCacheCompact(s.spatial_cache_entries_, s.spatial_cache_voxels_curr_, s.spatial_cache_voxels_prev_,
+                                 block * SpatialCacheBlockSize, SpatialCacheBlockSize);
+
+        if (++s.spatial_cache_blocks_resolved_ == blocks_count) {
+            // All blocks are resolved, store previous camera position
+            memcpy(s.spatial_cache_cam_pos_prev_, cam.origin, 3 * sizeof(float));
+            s.spatial_cache_blocks_resolved_ = 0;
+        }
+    }
 
     scene_lock.unlock();
 
@@ -1225,6 +1592,516 @@ void Ray::Cpu::Renderer<SIMDPolicy>::ResetSpatialCache(
     });
 }
 
+namespace Ray {
+namespace Cpu {
+const uint32_t CheckpointMagic = 0x43594152; // 'RAYC'
+const uint32_t CheckpointVersion = 2;
+enum eCheckpointFlags : uint32_t { CompactBuffers = (1u << 0), SpatialCache = (1u << 1) };
+
+// Number of samples taken by pixel within [base_iteration, iteration) range (pixels stop with adaptive sampling)
+inline int PixelSampleCount(const uint16_t required_samples, const int base_iteration, const int iteration) {
+    return std::max(std::min(int(required_samples), iteration) - base_iteration, 0);
+}
+
+// Number of class A samples (the ones accumulated into half buffer) within [0, iteration) range
+inline int HalfSampleCount(const int iteration) {
+    // each aligned group of 4 samples contains exactly one pair of class A samples
+    const int group = iteration / 4, rem = iteration % 4;
+    const int first_pair = popcount(uint32_t(group) & 0xaaaaaaaa) & 1;
+    return 2 * group + (rem > 0 ? first_pair : 0) + (rem > 1 ? first_pair : 0) + (rem > 2 ? 1 - first_pair : 0);
+}
+
+// Same as above, but for half buffer of a pixel
+inline int PixelHalfSampleCount(const uint16_t required_samples, const int base_iteration, const int iteration) {
+    const int last_iteration = std::max(std::min(int(required_samples), iteration), base_iteration);
+    return HalfSampleCount(last_iteration) - HalfSampleCount(base_iteration);
+}
+} // namespace Cpu
+} // namespace Ray
+
+template <typename SIMDPolicy>
+bool Ray::Cpu::Renderer<SIMDPolicy>::SaveCheckpoint(const SceneBase &scene, Span<const RegionContext> regions,
+                                                    std::ostream &out) const {
+    const auto &s = dynamic_cast<const Cpu::Scene &>(scene);
+
+    CompressedWriter writer(out);
+
+    const uint32_t flags = (use_compact_buffers_ ? CompactBuffers : 0u) | (use_spatial_cache_ ? SpatialCache : 0u);
+    const uint32_t header[] = {CheckpointMagic, CheckpointVersion, uint32_t(w_), uint32_t(h_), flags,
+                               uint32_t(regions.size())};
+    writer.Write(header, sizeof(header));
+
+    for (const RegionContext &region : regions) {
+        const rect_t &r = region.rect();
+        const int32_t data[] = {r.x, r.y, r.w, r.h, region.iteration, region.cache_iteration, region.base_iteration};
+        writer.Write(data, sizeof(data));
+    }
+
+    const uint32_t view_transform = uint32_t(tonemap_params_.view_transform);
+    writer.Write(&view_transform, sizeof(uint32_t));
+    writer.Write(&tonemap_params_.inv_gamma, sizeof(float));
+    writer.Write(&variance_threshold_, sizeof(float));
+
+    // bytes of values are regrouped by significance, this makes channel-interleaved data compressible
+    writer.Write(full_buf_.data(), full_buf_.size() * sizeof(color_rgba_t), sizeof(float));
+    if (use_compact_buffers_) {
+        writer.Write(half_delta_buf_.data(), half_delta_buf_.size() * sizeof(color_t<uint16_t, 4>), sizeof(uint16_t));
+        writer.Write(base_color_packed_buf_.data(), base_color_packed_buf_.size() * sizeof(rgb9e5_t),
+                     sizeof(rgb9e5_t));
+        writer.Write(depth_normals_packed_buf_.data(),
+                     depth_normals_packed_buf_.size() * sizeof(color_t<uint16_t, 4>), sizeof(uint16_t));
+    } else {
+        writer.Write(half_buf_.data(), half_buf_.size() * sizeof(color_rgba_t), sizeof(float));
+        writer.Write(base_color_buf_.data(), base_color_buf_.size() * sizeof(color_rgba_t), sizeof(float));
+        writer.Write(depth_normals_buf_.data(), depth_normals_buf_.size() * sizeof(color_rgba_t), sizeof(float));
+    }
+    writer.Write(required_samples_.data(), required_samples_.size() * sizeof(uint16_t), sizeof(uint16_t));
+
+    if (use_spatial_cache_) {
+        std::shared_lock<std::shared_timed_mutex> scene_lock(s.mtx_);
+
+        const uint32_t entries_count = uint32_t(s.spatial_cache_entries_.size());
+        writer.Write(&entries_count, sizeof(uint32_t));
+        writer.Write(s.spatial_cache_cam_pos_prev_, 3 * sizeof(float));
+        writer.Write(s.spatial_cache_entries_.data(), entries_count * sizeof(uint64_t), sizeof(uint64_t));
+        writer.Write(s.spatial_cache_voxels_curr_.data(), entries_count * sizeof(packed_cache_voxel_t),
+                     sizeof(uint32_t));
+        writer.Write(s.spatial_cache_voxels_prev_.data(), entries_count * sizeof(packed_cache_voxel_t),
+                     sizeof(uint32_t));
+    }
+
+    if (!writer.Finish()) {
+        log_->Error("Failed to write checkpoint!");
+        return false;
+    }
+    return true;
+}
+
+template <typename SIMDPolicy>
+bool Ray::Cpu::Renderer<SIMDPolicy>::ReadCheckpointHeader(CompressedReader &reader, Span<const RegionContext> regions,
+                                                          std::vector<checkpoint_region_t> &out_regions) const {
+    const uint32_t flags = (use_compact_buffers_ ? CompactBuffers : 0u) | (use_spatial_cache_ ? SpatialCache : 0u);
+
+    uint32_t header[6];
+    if (!reader.Read(header, sizeof(header)) || header[0] != CheckpointMagic) {
+        log_->Warning("Invalid checkpoint!");
+        return false;
+    }
+    if (header[1] != CheckpointVersion) {
+        log_->Warning("Unsupported checkpoint version (%u)!", header[1]);
+        return false;
+    }
+    if (header[2] != uint32_t(w_) || header[3] != uint32_t(h_) || header[4] != flags ||
+        header[5] != uint32_t(regions.size())) {
+        log_->Warning("Checkpoint does not match renderer settings!");
+        return false;
+    }
+
+    out_regions.resize(regions.size());
+    for (ptrdiff_t i = 0; i < regions.size(); ++i) {
+        const rect_t &r = regions[i].rect();
+
+        int32_t data[7];
+        if (!reader.Read(data, sizeof(data))) {
+            log_->Warning("Invalid checkpoint!");
+            return false;
+        }
+        if (data[0] != r.x || data[1] != r.y || data[2] != r.w || data[3] != r.h || data[6] < 0 ||
+            data[4] < data[6]) {
+            log_->Warning("Checkpoint regions do not match!");
+            return false;
+        }
+        out_regions[i].iteration = data[4];
+        out_regions[i].cache_iteration = data[5];
+        out_regions[i].base_iteration = data[6];
+    }
+
+    return true;
+}
+
+template <typename SIMDPolicy>
+bool Ray::Cpu::Renderer<SIMDPolicy>::LoadCheckpoint(const SceneBase &scene, Span<RegionContext> regions,
+                                                    std::istream &in) {
+    const auto &s = dynamic_cast<const Cpu::Scene &>(scene);
+
+    CompressedReader reader(in);
+
+    std::vector<checkpoint_region_t> checkpoint_regions;
+    if (!ReadCheckpointHeader(reader, regions, checkpoint_regions)) {
+        return false;
+    }
+
+    // everything is read into temporaries first, current state is replaced only if the whole checkpoint is valid
+    uint32_t view_transform = 0;
+    Ref::tonemap_params_t tonemap_params = {};
+    float variance_threshold = 0.0f;
+    bool res = reader.Read(&view_transform, sizeof(uint32_t));
+    res &= reader.Read(&tonemap_params.inv_gamma, sizeof(float));
+    res &= reader.Read(&variance_threshold, sizeof(float));
+    tonemap_params.view_transform = eViewTransform(view_transform);
+
+    aligned_vector<color_rgba_t, 16> full_buf(full_buf_.size()), half_buf(half_buf_.size()),
+        base_color_buf(base_color_buf_.size()), depth_normals_buf(depth_normals_buf_.size());
+    std::vector<color_t<uint16_t, 4>> half_delta_buf(half_delta_buf_.size()),
+        depth_normals_packed_buf(depth_normals_packed_buf_.size());
+    std::vector<rgb9e5_t> base_color_packed_buf(base_color_packed_buf_.size());
+    std::vector<uint16_t> required_samples(required_samples_.size());
+
+    res &= reader.Read(full_buf.data(), full_buf.size() * sizeof(color_rgba_t), sizeof(float));
+    if (use_compact_buffers_) {
+        res &= reader.Read(half_delta_buf.data(), half_delta_buf.size() * sizeof(color_t<uint16_t, 4>),
+                           sizeof(uint16_t));
+        res &= reader.Read(base_color_packed_buf.data(), base_color_packed_buf.size() * sizeof(rgb9e5_t),
+                           sizeof(rgb9e5_t));
+        res &= reader.Read(depth_normals_packed_buf.data(),
+                           depth_normals_packed_buf.size() * sizeof(color_t<uint16_t, 4>), sizeof(uint16_t));
+    } else {
+        res &= reader.Read(half_buf.data(), half_buf.size() * sizeof(color_rgba_t), sizeof(float));
+        res &= reader.Read(base_color_buf.data(), base_color_buf.size() * sizeof(color_rgba_t), sizeof(float));
+        res &= reader.Read(depth_normals_buf.data(), depth_normals_buf.size() * sizeof(color_rgba_t), sizeof(float));
+    }
+    res &= reader.Read(required_samples.data(), required_samples.size() * sizeof(uint16_t), sizeof(uint16_t));
+
+    uint32_t cache_entries_count = 0;
+    float cache_cam_pos_prev[3] = {};
+    std::vector<uint64_t> cache_entries;
+    aligned_vector<packed_cache_voxel_t, 16> cache_voxels_curr, cache_voxels_prev;
+    if (res && use_spatial_cache_) {
+        res &= reader.Read(&cache_entries_count, sizeof(uint32_t));
+        res &= reader.Read(cache_cam_pos_prev, 3 * sizeof(float));
+        if (res) {
+            // do not trust the stored count before allocating
+            std::shared_lock<std::shared_timed_mutex> scene_lock(s.mtx_);
+            res &= (cache_entries_count == s.spatial_cache_entries_.size());
+        }
+        if (res) {
+            cache_entries.resize(cache_entries_count);
+            cache_voxels_curr.resize(cache_entries_count);
+            cache_voxels_prev.resize(cache_entries_count);
+
+            res &= reader.Read(cache_entries.data(), cache_entries_count * sizeof(uint64_t), sizeof(uint64_t));
+            res &= reader.Read(cache_voxels_curr.data(), cache_entries_count * sizeof(packed_cache_voxel_t),
+                               sizeof(uint32_t));
+            res &= reader.Read(cache_voxels_prev.data(), cache_entries_count * sizeof(packed_cache_voxel_t),
+                               sizeof(uint32_t));
+        }
+    }
+
+    std::unique_lock<std::shared_timed_mutex> scene_lock(s.mtx_, std::defer_lock);
+    if (res && use_spatial_cache_) {
+        scene_lock.lock();
+        res &= (cache_entries_count == s.spatial_cache_entries_.size());
+    }
+
+    if (!res) {
+        log_->Warning("Failed to read checkpoint!");
+        return false;
+    }
+
+    tonemap_params_ = tonemap_params;
+    variance_threshold_ = variance_threshold;
+
+    // copied in place, so previously returned image pointers stay valid
+    std::copy(begin(full_buf), end(full_buf), begin(full_buf_));
+    std::copy(begin(half_buf), end(half_buf), begin(half_buf_));
+    std::copy(begin(base_color_buf), end(base_color_buf), begin(base_color_buf_));
+    std::copy(begin(depth_normals_buf), end(depth_normals_buf), begin(depth_normals_buf_));
+    std::copy(begin(half_delta_buf), end(half_delta_buf), begin(half_delta_buf_));
+    std::copy(begin(depth_normals_packed_buf), end(depth_normals_packed_buf), begin(depth_normals_packed_buf_));
+    std::copy(begin(base_color_packed_buf), end(base_color_packed_buf), begin(base_color_packed_buf_));
+    std::copy(begin(required_samples), end(required_samples), begin(required_samples_));
+
+    if (use_spatial_cache_) {
+        memcpy(s.spatial_cache_cam_pos_prev_, cache_cam_pos_prev, 3 * sizeof(float));
+        std::copy(begin(cache_entries), end(cache_entries), begin(s.spatial_cache_entries_));
+        std::copy(begin(cache_voxels_curr), end(cache_voxels_curr), begin(s.spatial_cache_voxels_curr_));
+        std::copy(begin(cache_voxels_prev), end(cache_voxels_prev), begin(s.spatial_cache_voxels_prev_));
+        s.spatial_cache_blocks_resolved_ = 0;
+        scene_lock.unlock();
+    }
+
+    for (ptrdiff_t i = 0; i < regions.size(); ++i) {
+        regions[i].iteration = checkpoint_regions[i].iteration;
+        regions[i].cache_iteration = checkpoint_regions[i].cache_iteration;
+        regions[i].base_iteration = checkpoint_regions[i].base_iteration;
+    }
+
+    UpdateDerivedImages();
+
+    return true;
+}
+
+template <typename SIMDPolicy>
+bool Ray::Cpu::Renderer<SIMDPolicy>::MergeCheckpoint(const SceneBase & /*scene*/, Span<RegionContext> regions,
+                                                     std::istream &in) {
+    CompressedReader reader(in);
+
+    std::vector<checkpoint_region_t> other_regions;
+    if (!ReadCheckpointHeader(reader, regions, other_regions)) {
+        return false;
+    }
+
+    for (ptrdiff_t i = 0; i < regions.size(); ++i) {
+        const RegionContext &cur = regions[i];
+        const checkpoint_region_t &other = other_regions[i];
+        if (cur.iteration != cur.base_iteration && other.iteration != other.base_iteration &&
+            cur.iteration != other.base_iteration && other.iteration != cur.base_iteration) {
+            // gaps or overlapping samples would make the result biased
+            log_->Warning("Merged sample ranges are not adjacent!");
+            return false;
+        }
+    }
+
+    uint32_t view_transform = 0;
+    Ref::tonemap_params_t tonemap_params = {};
+    float variance_threshold = 0.0f;
+    bool res = reader.Read(&view_transform, sizeof(uint32_t));
+    res &= reader.Read(&tonemap_params.inv_gamma, sizeof(float));
+    res &= reader.Read(&variance_threshold, sizeof(float));
+    tonemap_params.view_transform = eViewTransform(view_transform);
+
+    // data of other renderer is decoded into full precision
+    aligned_vector<color_rgba_t, 16> other_full(w_ * h_), other_half(w_ * h_), other_base_color(w_ * h_),
+        other_depth_normals(w_ * h_);
+    std::vector<uint16_t> other_required_samples(w_ * h_);
+
+    res &= reader.Read(other_full.data(), other_full.size() * sizeof(color_rgba_t), sizeof(float));
+    if (use_compact_buffers_) {
+        std::vector<color_t<uint16_t, 4>> half_delta(w_ * h_), depth_normals(w_ * h_);
+        std::vector<rgb9e5_t> base_color(w_ * h_);
+        res &= reader.Read(half_delta.data(), half_delta.size() * sizeof(color_t<uint16_t, 4>), sizeof(uint16_t));
+        res &= reader.Read(base_color.data(), base_color.size() * sizeof(rgb9e5_t), sizeof(rgb9e5_t));
+        res &= reader.Read(depth_normals.data(), depth_normals.size() * sizeof(color_t<uint16_t, 4>),
+                           sizeof(uint16_t));
+        for (int i = 0; i < w_ * h_ && res; ++i) {
+            const Ref::fvec4 half_val =
+                Ref::fvec4{other_full[i].v, Ref::vector_aligned} + unpack_half4(half_delta[i]);
+            half_val.store_to(other_half[i].v, Ref::vector_aligned);
+            rgb9e5_to_rgb(base_color[i], other_base_color[i].v);
+            unpack_half4(depth_normals[i]).store_to(other_depth_normals[i].v, Ref::vector_aligned);
+        }
+    } else {
+        res &= reader.Read(other_half.data(), other_half.size() * sizeof(color_rgba_t), sizeof(float));
+        res &= reader.Read(other_base_color.data(), other_base_color.size() * sizeof(color_rgba_t), sizeof(float));
+        res &= reader.Read(other_depth_normals.data(), other_depth_normals.size() * sizeof(color_rgba_t),
+                           sizeof(float));
+    }
+    res &= reader.Read(other_required_samples.data(), other_required_samples.size() * sizeof(uint16_t),
+                       sizeof(uint16_t));
+    // spatial cache state is local to each renderer and is not merged
+
+    if (!res) {
+        log_->Warning("Failed to read checkpoint!");
+        return false;
+    }
+
+    for (ptrdiff_t j = 0; j < regions.size(); ++j) {
+        RegionContext &cur = regions[j];
+        const checkpoint_region_t &other = other_regions[j];
+        if (other.iteration == other.base_iteration) {
+            // nothing to merge
+            continue;
+        }
+
+        const bool cur_is_empty = (cur.iteration == cur.base_iteration);
+        const int base_iteration =
+            cur_is_empty ? other.base_iteration : std::min(cur.base_iteration, other.base_iteration);
+        const int iteration = cur_is_empty ? other.iteration : std::max(cur.iteration, other.iteration);
+
+        const rect_t &rect = cur.rect();
+        for (int y = rect.y; y < rect.y + rect.h; ++y) {
+            for (int x = rect.x; x < rect.x + rect.w; ++x) {
+                const int i = y * w_ + x;
+
+                const int cur_count = PixelSampleCount(required_samples_[i], cur.base_iteration, cur.iteration),
+                          other_count = PixelSampleCount(other_required_samples[i], other.base_iteration,
+                                                         other.iteration);
+                if (other_count == 0) {
+                    continue;
+                }
+                // values are weighted by per-pixel sample counts
+                const float other_weight = float(other_count) / float(cur_count + other_count);
+                // (half buffer receives class A samples only, so it is weighted separately)
+                const int cur_half_count =
+                    PixelHalfSampleCount(required_samples_[i], cur.base_iteration, cur.iteration);
+                const int other_half_count =
+                    PixelHalfSampleCount(other_required_samples[i], other.base_iteration, other.iteration);
+                const float other_half_weight =
+                    other_half_count ? float(other_half_count) / float(cur_half_count + other_half_count) : 0.0f;
+
+                // compact half buffer is relative to full one, so it has to be fetched before update
+                Ref::fvec4 half_val = fetch_half_buf(i);
+                half_val += (Ref::fvec4{other_half[i].v, Ref::vector_aligned} - half_val) * other_half_weight;
+
+                Ref::fvec4 full_val = {full_buf_[i].v, Ref::vector_aligned};
+                full_val += (Ref::fvec4{other_full[i].v, Ref::vector_aligned} - full_val) * other_weight;
+                full_val.store_to(full_buf_[i].v, Ref::vector_aligned);
+
+                Ref::fvec4 base_color{fetch_base_color(i).v};
+                base_color += (Ref::fvec4{other_base_color[i].v, Ref::vector_aligned} - base_color) * other_weight;
+
+                Ref::fvec4 depth_normals{fetch_depth_normals(i).v};
+                depth_normals +=
+                    (Ref::fvec4{other_depth_normals[i].v, Ref::vector_aligned} - depth_normals) * other_weight;
+
+                if (use_compact_buffers_) {
+                    half_delta_buf_[i] = pack_half4(half_val - full_val);
+                    color_rgba_t temp;
+                    base_color.store_to(temp.v);
+                    base_color_packed_buf_[i] = rgb_to_rgb9e5(temp.v);
+                    depth_normals_packed_buf_[i] = pack_half4(depth_normals);
+                } else {
+                    half_val.store_to(half_buf_[i].v, Ref::vector_aligned);
+                    base_color.store_to(base_color_buf_[i].v, Ref::vector_aligned);
+                    depth_normals.store_to(depth_normals_buf_[i].v, Ref::vector_aligned);
+                }
+
+                // pixel stays active only if it was not stopped by any of renderers
+                const bool cur_is_active = cur_is_empty || required_samples_[i] > cur.iteration,
+                           other_is_active = other_required_samples[i] > other.iteration;
+                required_samples_[i] = uint16_t(std::min(
+                    (cur_is_active && other_is_active) ? iteration + 1 : base_iteration + cur_count + other_count,
+                    0xffff));
+            }
+        }
+
+        cur.base_iteration = base_iteration;
+        cur.iteration = iteration;
+        cur.cache_iteration = std::max(cur.cache_iteration, other.cache_iteration);
+    }
+
+    tonemap_params_ = tonemap_params;
+    variance_threshold_ = variance_threshold;
+
+    UpdateDerivedImages();
+
+    return true;
+}
+
+template <typename SIMDPolicy> void Ray::Cpu::Renderer<SIMDPolicy>::UpdateDerivedImages() {
+    // the same way RenderScene does it
+    for (int i = 0; i < w_ * h_; ++i) {
+        const Ref::fvec4 full_val = {full_buf_[i].v, Ref::vector_aligned};
+        if (use_compact_buffers_) {
+            raw_filtered_packed_buf_[i] = pack_half4(full_val);
+            continue;
+        }
+        full_val.store_to(raw_filtered_buf_[i].v, Ref::vector_aligned);
+        Tonemap(tonemap_params_, full_val).store_to(final_buf_[i].v, Ref::vector_aligned);
+        EstimateVariance(i).store_to(temp_buf_[i].v, Ref::vector_aligned);
+    }
+}
+
+template <typename SIMDPolicy> Ray::color_data_rgba_t Ray::Cpu::Renderer<SIMDPolicy>::get_pixels_ref() const {
+    if (use_compact_buffers_) {
+        // produced on request, GetPixels has to be used
+        return {};
+    }
+    return {final_buf_.data(), w_};
+}
+
+template <typename SIMDPolicy> Ray::color_data_rgba_t Ray::Cpu::Renderer<SIMDPolicy>::get_raw_pixels_ref() const {
+    if (use_compact_buffers_) {
+        // stored packed, GetRawPixels has to be used
+        return {};
+    }
+    return {raw_filtered_buf_.data(), w_};
+}
+
+template <typename SIMDPolicy>
+void Ray::Cpu::Renderer<SIMDPolicy>::GetPixels(color_rgba_t out_pixels[], const int out_pitch) const {
+    if (!use_compact_buffers_) {
+        RendererBase::GetPixels(out_pixels, out_pitch);
+        return;
+    }
+    for (int y = 0; y < h_; ++y) {
+        for (int x = 0; x < w_; ++x) {
+            Tonemap(tonemap_params_, unpack_half4(raw_filtered_packed_buf_[y * w_ + x]))
+                .store_to(out_pixels[y * out_pitch + x].v);
+        }
+    }
+}
+
+template <typename SIMDPolicy>
+void Ray::Cpu::Renderer<SIMDPolicy>::GetRawPixels(color_rgba_t out_pixels[], const int out_pitch) const {
+    if (!use_compact_buffers_) {
+        RendererBase::GetRawPixels(out_pixels, out_pitch);
+        return;
+    }
+    for (int y = 0; y < h_; ++y) {
+        for (int x = 0; x < w_; ++x) {
+            unpack_half4(raw_filtered_packed_buf_[y * w_ + x]).store_to(out_pixels[y * out_pitch + x].v);
+        }
+    }
+}
+
+template <typename SIMDPolicy>
+Ray::color_data_rgba_t Ray::Cpu::Renderer<SIMDPolicy>::get_aux_pixels_ref(const eAUXBuffer buf) const {
+    if (use_compact_buffers_) {
+        // stored packed, GetAUXPixels has to be used
+        return {};
+    }
+    if (buf == eAUXBuffer::BaseColor) {
+        return {base_color_buf_.data(), w_};
+    } else if (buf == eAUXBuffer::DepthNormals) {
+        return color_data_rgba_t{depth_normals_buf_.data(), w_};
+    }
+    return {};
+}
+
+template <typename SIMDPolicy>
+void Ray::Cpu::Renderer<SIMDPolicy>::GetAUXPixels(const eAUXBuffer buf, color_rgba_t out_pixels[],
+                                                  const int out_pitch) const {
+    if (!use_compact_buffers_) {
+        RendererBase::GetAUXPixels(buf, out_pixels, out_pitch);
+        return;
+    }
+    if (buf != eAUXBuffer::BaseColor && buf != eAUXBuffer::DepthNormals) {
+        return;
+    }
+    for (int y = 0; y < h_; ++y) {
+        for (int x = 0; x < w_; ++x) {
+            const int i = y * w_ + x;
+            out_pixels[y * out_pitch + x] =
+                (buf == eAUXBuffer::BaseColor) ? fetch_base_color(i) : fetch_depth_normals(i);
+        }
+    }
+}
+
+template <typename SIMDPolicy> Ray::Ref::fvec4 Ray::Cpu::Renderer<SIMDPolicy>::EstimateVariance(const int i) const {
+    const Ref::fvec4 full_val = {full_buf_[i].v, Ref::vector_aligned}, half_val = fetch_half_buf(i);
+
+    const Ref::fvec4 p1 = Ref::reversible_tonemap(max(2.0f * full_val - half_val, 0.0f));
+    const Ref::fvec4 p2 = Ref::reversible_tonemap(half_val);
+
+    return 0.5f * (p1 - p2) * (p1 - p2);
+}
+
+template <typename SIMDPolicy>
+void Ray::Cpu::Renderer<SIMDPolicy>::UnpackAUXBuffers(const rect_t &r, color_rgba_t out_base_color[],
+                                                      color_rgba_t out_depth_normals[]) const {
+    for (int y = 0; y < r.h; ++y) {
+        for (int x = 0; x < r.w; ++x) {
+            const int i = (r.y + y) * w_ + (r.x + x);
+            out_base_color[y * r.w + x] = fetch_base_color(i);
+            out_depth_normals[y * r.w + x] = fetch_depth_normals(i);
+        }
+    }
+}
+
+template <typename SIMDPolicy>
+void Ray::Cpu::Renderer<SIMDPolicy>::PackAUXBuffers(const rect_t &r, const color_rgba_t base_color[],
+                                                    const color_rgba_t depth_normals[]) {
+    for (int y = 0; y < r.h; ++y) {
+        for (int x = 0; x < r.w; ++x) {
+            const int i = (r.y + y) * w_ + (r.x + x);
+            base_color_packed_buf_[i] = rgb_to_rgb9e5(base_color[y * r.w + x].v);
+            depth_normals_packed_buf_[i] =
+                pack_half4(Ref::fvec4{depth_normals[y * r.w + x].v, Ref::vector_aligned});
+        }
+    }
+}
+
 template <typename SIMDPolicy>
 void Ray::Cpu::Renderer<SIMDPolicy>::UpdateFilterTable(ePixelFilter filter, float filter_width) {
     float (*filter_func)(float v, float width);
@@ -1258,6 +2135,14 @@ Ray::unet_filter_properties_t Ray::Cpu::Renderer<SIMDPolicy>::InitUNetFilter(
     unet_weights_.resize(total_count);
     SetupUNetWeights(true, 1, &unet_offsets_, unet_weights_.data());
 
+    if (unet_precision_ == eUNetPrecision::Int8) {
+        const int biases_count = QuantizeUNetWeights(unet_weights_.data(), unet_offsets_, nullptr, nullptr, nullptr);
+        unet_weights_i8_.resize(total_count, 0);
+        unet_biases_i8_.resize(biases_count);
+        QuantizeUNetWeights(unet_weights_.data(), unet_offsets_, unet_weights_i8_.data(), &unet_offsets_i8_,
+                            unet_biases_i8_.data());
+    }
+
     unet_alias_memory_ = alias_memory;
     UpdateUNetFilterMemory();
 
@@ -1274,6 +2159,8 @@ Ray::unet_filter_properties_t Ray::Cpu::Renderer<SIMDPolicy>::InitUNetFilter(
 
 template <typename SIMDPolicy> void Ray::Cpu::Renderer<SIMDPolicy>::UpdateUNetFilterMemory() {
     unet_tensors_heap_ = {};
+    unet_tensors_heap_bf16_ = {};
+    unet_tensors_heap_f16_ = {};
     if (unet_weights_.empty()) {
         return;
     }
@@ -1281,25 +2168,47 @@ template <typename SIMDPolicy> void Ray::Cpu::Renderer<SIMDPolicy>::UpdateUNetFi
     unet_filter_tensors_t tensors;
     const int required_memory = SetupUNetFilter(w_, h_, unet_alias_memory_, false, tensors, unet_alias_dependencies_);
 
+    if (unet_precision_ == eUNetPrecision::BF16) {
 #ifndef NDEBUG
-    unet_tensors_heap_.resize(required_memory, NAN);
+        unet_tensors_heap_bf16_.resize(required_memory, bf16_t{0x7fc0}); // NAN
 #else
-    unet_tensors_heap_.resize(required_memory, 0.0f);
+        unet_tensors_heap_bf16_.resize(required_memory, bf16_t{});
 #endif
+        SetupUNetTensors(tensors, unet_tensors_heap_bf16_.data(), unet_tensors_bf16_);
+    } else if (unet_precision_ == eUNetPrecision::FP16) {
+#ifndef NDEBUG
+        unet_tensors_heap_f16_.resize(required_memory, f16_t{0x7e00}); // NAN
+#else
+        unet_tensors_heap_f16_.resize(required_memory, f16_t{});
+#endif
+        SetupUNetTensors(tensors, unet_tensors_heap_f16_.data(), unet_tensors_f16_);
+    } else {
+#ifndef NDEBUG
+        unet_tensors_heap_.resize(required_memory, NAN);
+#else
+        unet_tensors_heap_.resize(required_memory, 0.0f);
+#endif
+        SetupUNetTensors(tensors, unet_tensors_heap_.data(), unet_tensors_);
+    }
+}
 
-    unet_tensors_.encConv0 = unet_tensors_heap_.data() + tensors.enc_conv0_offset;
-    unet_tensors_.pool1 = unet_tensors_heap_.data() + tensors.pool1_offset;
-    unet_tensors_.pool2 = unet_tensors_heap_.data() + tensors.pool2_offset;
-    unet_tensors_.pool3 = unet_tensors_heap_.data() + tensors.pool3_offset;
-    unet_tensors_.pool4 = unet_tensors_heap_.data() + tensors.pool4_offset;
-    unet_tensors_.enc_conv5a = unet_tensors_heap_.data() + tensors.enc_conv5a_offset;
-    unet_tensors_.upsample4 = unet_tensors_heap_.data() + tensors.upsample4_offset;
-    unet_tensors_.dec_conv4a = unet_tensors_heap_.data() + tensors.dec_conv4a_offset;
-    unet_tensors_.upsample3 = unet_tensors_heap_.data() + tensors.upsample3_offset;
-    unet_tensors_.dec_conv3a = unet_tensors_heap_.data() + tensors.dec_conv3a_offset;
-    unet_tensors_.upsample2 = unet_tensors_heap_.data() + tensors.upsample2_offset;
-    unet_tensors_.dec_conv2a = unet_tensors_heap_.data() + tensors.dec_conv2a_offset;
-    unet_tensors_.upsample1 = unet_tensors_heap_.data() + tensors.upsample1_offset;
-    unet_tensors_.dec_conv1a = unet_tensors_heap_.data() + tensors.dec_conv1a_offset;
-    unet_tensors_.dec_conv1b = unet_tensors_heap_.data() + tensors.dec_conv1b_offset;
+template <typename SIMDPolicy>
+template <typename T>
+void Ray::Cpu::Renderer<SIMDPolicy>::SetupUNetTensors(const unet_filter_tensors_t &tensors, T *heap,
+                                                       unet_tensors_t<T> &out_tensors) {
+    out_tensors.encConv0 = heap + tensors.enc_conv0_offset;
+    out_tensors.pool1 = heap + tensors.pool1_offset;
+    out_tensors.pool2 = heap + tensors.pool2_offset;
+    out_tensors.pool3 = heap + tensors.pool3_offset;
+    out_tensors.pool4 = heap + tensors.pool4_offset;
+    out_tensors.enc_conv5a = heap + tensors.enc_conv5a_offset;
+    out_tensors.upsample4 = heap + tensors.upsample4_offset;
+    out_tensors.dec_conv4a = heap + tensors.dec_conv4a_offset;
+    out_tensors.upsample3 = heap + tensors.upsample3_offset;
+    out_tensors.dec_conv3a = heap + tensors.dec_conv3a_offset;
+    out_tensors.upsample2 = heap + tensors.upsample2_offset;
+    out_tensors.dec_conv2a = heap + tensors.dec_conv2a_offset;
+    out_tensors.upsample1 = heap + tensors.upsample1_offset;
+    out_tensors.dec_conv1a = heap + tensors.dec_conv1a_offset;
+    out_tensors.dec_conv1b = heap + tensors.dec_conv1b_offset;
 }
@@ -17,6 +17,8 @@ template int SortRays_CPU<RPSize>(Span<ray_data_t<RPSize>> rays, const float roo
 template int SortRays_GPU<RPSize>(Span<ray_data_t<RPSize>> rays, const float root_min[3], const float cell_size[3],
                                   ivec<RPSize> *hash_values, int *head_flags, uint32_t *scan_values,
                                   ray_chunk_t *chunks, ray_chunk_t *chunks_temp, uint32_t *skeleton);
+template int PartitionCoherentRays<RPSize>(Span<ray_data_t<RPSize>> rays, Span<hit_data_t<RPSize>> inters,
+                                           const float cell_size[3], bool allow_packets, int out_rays_count[2]);
 
 template bool Traverse_TLAS_WithStack_ClosestHit<RPSize>(const fvec<RPSize> ro[3], const fvec<RPSize> rd[3],
                                                          const uvec<RPSize> &ray_flags, const ivec<RPSize> &ray_mask,
@@ -30,6 +32,12 @@ template bool Traverse_TLAS_WithStack_ClosestHit<RPSize>(const fvec<RPSize> ro[3
                                                          const mesh_instance_t *mesh_instances, const mesh_t *meshes,
                                                          const mtri_accel_t *mtris, const uint32_t *tri_indices,
                                                          hit_data_t<RPSize> &inter);
+template bool Traverse_TLAS_WithStack_ClosestHit<RPSize>(const fvec<RPSize> ro[3], const fvec<RPSize> rd[3],
+                                                         const uvec<RPSize> &ray_flags, const ivec<RPSize> &ray_mask,
+                                                         const qwbvh_node_t *nodes, uint32_t node_index,
+                                                         const mesh_instance_t *mesh_instances, const mesh_t *meshes,
+                                                         const mtri_accel_t *mtris, const uint32_t *tri_indices,
+                                                         hit_data_t<RPSize> &inter);
 template ivec<RPSize> Traverse_TLAS_WithStack_AnyHit<RPSize>(
     const fvec<RPSize> ro[3], const fvec<RPSize> rd[3], int ray_type, const ivec<RPSize> &ray_mask,
     const bvh_node_t *nodes, uint32_t node_index, const mesh_instance_t *mesh_instances, const mesh_t *meshes,
@@ -38,6 +46,10 @@ template ivec<RPSize> Traverse_TLAS_WithStack_AnyHit<RPSize>(
     const fvec<RPSize> ro[3], const fvec<RPSize> rd[3], int ray_type, const ivec<RPSize> &ray_mask,
     const wbvh_node_t *oct_nodes, uint32_t node_index, const mesh_instance_t *mesh_instances, const mesh_t *meshes,
     const mtri_accel_t *mtris, const tri_mat_data_t *materials, const uint32_t *tri_indices, hit_data_t<RPSize> &inter);
+template ivec<RPSize> Traverse_TLAS_WithStack_AnyHit<RPSize>(
+    const fvec<RPSize> ro[3], const fvec<RPSize> rd[3], int ray_type, const ivec<RPSize> &ray_mask,
+    const qwbvh_node_t *oct_nodes, uint32_t node_index, const mesh_instance_t *mesh_instances, const mesh_t *meshes,
+    const mtri_accel_t *mtris, const tri_mat_data_t *materials, const uint32_t *tri_indices, hit_data_t<RPSize> &inter);
 template bool Traverse_BLAS_WithStack_ClosestHit<RPSize>(const fvec<RPSize> ro[3], const fvec<RPSize> rd[3],
                                                          const ivec<RPSize> &ray_mask, const bvh_node_t *nodes,
                                                          uint32_t node_index, const tri_accel_t *tris,
@@ -47,6 +59,28 @@ template bool Traverse_BLAS_WithStack_ClosestHit<RPSize>(const float ro[3], cons
                                                          uint32_t node_index, const mtri_accel_t *mtris,
                                                          const uint32_t *tri_indices, int &inter_prim_index,
                                                          float &inter_t, float &inter_u, float &inter_v);
+template bool Traverse_BLAS_WithStack_ClosestHit<RPSize>(const float ro[3], const float rd[3],
+                                                         const qwbvh_node_t *nodes, uint32_t node_index,
+                                                         const mtri_accel_t *mtris, const uint32_t *tri_indices,
+                                                         int &inter_prim_index, float &inter_t, float &inter_u,
+                                                         float &inter_v);
+template bool Traverse_TLAS_WithStack_ClosestHit_Packet<RPSize>(
+    const fvec<RPSize> ro[3], const fvec<RPSize> rd[3], const uvec<RPSize> &ray_flags, const ivec<RPSize> &ray_mask,
+    const wbvh_node_t *nodes, uint32_t node_index, const mesh_instance_t *mesh_instances, const mtri_accel_t *mtris,
+    const uint32_t *tri_indices, hit_data_t<RPSize> &inter);
+template bool Traverse_TLAS_WithStack_ClosestHit_Packet<RPSize>(
+    const fvec<RPSize> ro[3], const fvec<RPSize> rd[3], const uvec<RPSize> &ray_flags, const ivec<RPSize> &ray_mask,
+    const qwbvh_node_t *nodes, uint32_t node_index, const mesh_instance_t *mesh_instances, const mtri_accel_t *mtris,
+    const uint32_t *tri_indices, hit_data_t<RPSize> &inter);
+template bool Traverse_BLAS_WithStack_ClosestHit_Packet<RPSize>(const fvec<RPSize> ro[3], const fvec<RPSize> rd[3],
+                                                                const ivec<RPSize> &ray_mask, const wbvh_node_t *nodes,
+                                                                uint32_t node_index, const mtri_accel_t *mtris,
+                                                                int obj_index, hit_data_t<RPSize> &inter);
+template bool Traverse_BLAS_WithStack_ClosestHit_Packet<RPSize>(const fvec<RPSize> ro[3], const fvec<RPSize> rd[3],
+                                                                const ivec<RPSize> &ray_mask,
+                                                                const qwbvh_node_t *nodes, uint32_t node_index,
+                                                                const mtri_accel_t *mtris, int obj_index,
+                                                                hit_data_t<RPSize> &inter);
 template ivec<RPSize> Traverse_BLAS_WithStack_AnyHit<RPSize>(const fvec<RPSize> ro[3], const fvec<RPSize> rd[3],
                                                              const ivec<RPSize> &ray_mask, const bvh_node_t *nodes,
                                                              uint32_t node_index, const tri_accel_t *tris,
@@ -58,6 +92,11 @@ template int Traverse_BLAS_WithStack_AnyHit<RPSize>(const float ro[3], const flo
                                                     const tri_mat_data_t *materials, const uint32_t *tri_indices,
                                                     int &inter_prim_index, float &inter_t, float &inter_u,
                                                     float &inter_v);
+template int Traverse_BLAS_WithStack_AnyHit<RPSize>(const float ro[3], const float rd[3], const qwbvh_node_t *nodes,
+                                                    uint32_t node_index, const mtri_accel_t *mtris,
+                                                    const tri_mat_data_t *materials, const uint32_t *tri_indices,
+                                                    int &inter_prim_index, float &inter_t, float &inter_u,
+                                                    float &inter_v);
 
 template void SampleNearest<RPSize>(const Cpu::TexStorageBase *const textures[], uint32_t index,
                                     const fvec<RPSize> uvs[2], const fvec<RPSize> &lod, const ivec<RPSize> &mask,
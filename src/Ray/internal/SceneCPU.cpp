@@ -20,12 +20,177 @@ Ref::fvec4 cross(const Ref::fvec4 &v1, const Ref::fvec4 &v2) {
                       v1.get<2>() * v2.get<0>() - v1.get<0>() * v2.get<2>(),
                       v1.get<0>() * v2.get<1>() - v1.get<1>() * v2.get<0>(), 0.0f};
 }
+
+const char SceneCacheMagic[4] = {'R', 'S', 'C', 'C'};
+const uint32_t SceneCacheVersion = 1;
+// storage data is placed at this alignment in file to be used in place after mapping
+const uint32_t SceneCacheDataAlignment = 64;
+
+const uint32_t SceneCacheWideBVHBit = (1u << 0);
+const uint32_t SceneCacheCompressedBVHBit = (1u << 1);
+
+struct scene_cache_header_t {
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t _unused;
+    uint64_t inputs_hash;
+    uint64_t layout_hash; // guards against reading data written with different struct layout
+    uint64_t file_size;
+};
+static_assert(sizeof(scene_cache_header_t) == 40, "!");
+
+uint64_t CalcSceneCacheLayoutHash() {
+    const size_t sizes[] = {sizeof(bvh2_node_t), sizeof(wbvh_node_t), sizeof(qwbvh_node_t), sizeof(tri_accel_t),
+                            sizeof(mtri_accel_t), sizeof(tri_mat_data_t), sizeof(mesh_t), sizeof(mesh_instance_t),
+                            sizeof(vertex_t), sizeof(material_t), sizeof(light_t), sizeof(light_bvh_node_t),
+                            sizeof(light_wbvh_node_t), sizeof(light_cwbvh_node_t), sizeof(bvh_node_t),
+                            sizeof(environment_t)};
+    return HashInputs(Span<const uint8_t>((const uint8_t *)sizes, sizeof(sizes)));
+}
+
+class SceneCacheWriter {
+    FILE *f_;
+    uint64_t pos_ = 0;
+    bool ok_ = true;
+
+  public:
+    explicit SceneCacheWriter(FILE *f) : f_(f) {}
+
+    bool ok() const { return ok_; }
+    uint64_t pos() const { return pos_; }
+
+    void Write(const void *data, const size_t size) {
+        if (ok_ && size) {
+            ok_ = (fwrite(data, 1, size, f_) == size);
+            pos_ += size;
+        }
+    }
+    void WriteZeros(size_t size) {
+        static const uint8_t Zeros[256] = {};
+        while (size) {
+            const size_t portion = std::min(size, sizeof(Zeros));
+            Write(Zeros, portion);
+            size -= portion;
+        }
+    }
+    void Align() {
+        WriteZeros(size_t((SceneCacheDataAlignment - pos_ % SceneCacheDataAlignment) % SceneCacheDataAlignment));
+    }
+
+    template <typename T> void Write(const T &val) { Write(&val, sizeof(T)); }
+    template <typename T, typename Alloc> void Write(const std::vector<T, Alloc> &v) {
+        Write(uint32_t(v.size()));
+        Write(v.data(), v.size() * sizeof(T));
+    }
+    template <typename T> void Write(const SparseStorage<T> &storage) {
+        std::vector<uint8_t> alloc_state;
+        if (storage.allocator()) {
+            storage.allocator()->GetState(alloc_state);
+        }
+        Write(storage.capacity());
+        Write(storage.size());
+        Write(alloc_state);
+        Align();
+        if (!storage.allocator()) {
+            return;
+        }
+        // unoccupied elements are written as zeros (memory there is uninitialized)
+        uint32_t written = 0;
+        FreelistAlloc::Range r = storage.allocator()->GetFirstOccupiedBlock(0);
+        while (r.size) {
+            WriteZeros((r.offset - written) * sizeof(T));
+            Write(&storage[r.offset], r.size * sizeof(T));
+            written = r.offset + r.size;
+            r = storage.allocator()->GetNextOccupiedBlock(r.block);
+        }
+        WriteZeros((storage.capacity() - written) * sizeof(T));
+    }
+};
+
+class SceneCacheReader {
+    uint8_t *data_;
+    size_t size_, pos_ = 0;
+    bool ok_ = true;
+
+  public:
+    SceneCacheReader(uint8_t *data, const size_t size) : data_(data), size_(size) {}
+
+    bool ok() const { return ok_; }
+    void Fail() { ok_ = false; }
+
+    uint8_t *Read(const size_t size) {
+        if (!ok_ || size > size_ - pos_) {
+            ok_ = false;
+            return nullptr;
+        }
+        uint8_t *ret = &data_[pos_];
+        pos_ += size;
+        return ret;
+    }
+    void Align() { Read(size_t((SceneCacheDataAlignment - pos_ % SceneCacheDataAlignment) % SceneCacheDataAlignment)); }
+
+    template <typename T> void Read(T &val) {
+        const uint8_t *data = Read(sizeof(T));
+        if (data) {
+            memcpy(&val, data, sizeof(T));
+        }
+    }
+    template <typename T, typename Alloc> void Read(std::vector<T, Alloc> &v) {
+        uint32_t count = 0;
+        Read(count);
+        if (!ok_ || count > (size_ - pos_) / sizeof(T)) {
+            ok_ = false;
+            return;
+        }
+        v.resize(count);
+        if (count) {
+            memcpy(v.data(), Read(count * sizeof(T)), count * sizeof(T));
+        }
+    }
+    template <typename T> void Read(SparseStorage<T> &storage) {
+        uint32_t capacity = 0, size = 0;
+        std::vector<uint8_t> alloc_state;
+        Read(capacity);
+        Read(size);
+        Read(alloc_state);
+        Align();
+        if (!ok_ || !capacity) {
+            return;
+        }
+        if (capacity > (size_ - pos_) / sizeof(T)) {
+            ok_ = false;
+            return;
+        }
+        auto alloc = std::make_unique<FreelistAlloc>();
+        if (!alloc->SetState(alloc_state.data(), alloc_state.size())) {
+            ok_ = false;
+            return;
+        }
+        // used in place, without copying
+        storage.Adopt((T *)Read(capacity * sizeof(T)), capacity, size, std::move(alloc));
+    }
+};
 } // namespace Cpu
 } // namespace Ray
 
-Ray::Cpu::Scene::Scene(ILog *log, const bool use_wide_bvh, const bool use_tex_compression, const bool use_spatial_cache)
-    : use_wide_bvh_(use_wide_bvh), use_tex_compression_(use_tex_compression) {
+Ray::Cpu::Scene::Scene(ILog *log, const bool use_wide_bvh, const bool use_compressed_bvh,
+                       const bool use_tex_compression, const bool use_spatial_cache, const size_t tex_page_budget,
+                       const char *tex_page_file)
+    : use_wide_bvh_(use_wide_bvh), use_compressed_bvh_(use_wide_bvh && use_compressed_bvh),
+      use_tex_compression_(use_tex_compression) {
     SceneBase::log_ = log;
+    if (tex_page_budget) {
+        tex_page_cache_ = std::make_unique<TexPageCache>(tex_page_budget, tex_page_file);
+        if (tex_page_cache_->ready()) {
+            for (TexStorageBase *storage : tex_storages_) {
+                storage->SetPageCache(tex_page_cache_.get());
+            }
+        } else {
+            log->Error("Failed to create texture paging file, textures will be kept in memory");
+            tex_page_cache_ = {};
+        }
+    }
     SetEnvironment({});
     if (use_spatial_cache) {
         spatial_cache_entries_.resize(HASH_GRID_CACHE_ENTRIES_COUNT, 0);
@@ -49,7 +214,9 @@ Ray::Cpu::Scene::~Scene() {
     }
 
     if (tlas_root_ != 0xffffffff) {
-        if (use_wide_bvh_) {
+        if (use_compressed_bvh_) {
+            qwnodes_.Erase(tlas_block_);
+        } else if (use_wide_bvh_) {
             wnodes_.Erase(tlas_block_);
         } else {
             nodes_.Erase(tlas_block_);
@@ -338,7 +505,8 @@ Ray::MaterialHandle Ray::Cpu::Scene::AddMaterial(const principled_mat_desc_t &m)
     return MaterialHandle{root_node};
 }
 
-Ray::MeshHandle Ray::Cpu::Scene::AddMesh(const mesh_desc_t &_m) {
+Ray::MeshHandle Ray::Cpu::Scene::AddMesh(const mesh_desc_t &_m,
+                                         const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
     bvh_settings_t s;
     s.oversplit_threshold = -1.0f;
     s.allow_spatial_splits = _m.allow_spatial_splits;
@@ -354,7 +522,7 @@ Ray::MeshHandle Ray::Cpu::Scene::AddMesh(const mesh_desc_t &_m) {
     std::vector<uint32_t> temp_tri_indices;
 
     PreprocessMesh(_m.vtx_positions, _m.vtx_indices, _m.base_vertex, s, temp_nodes, temp_tris, temp_tri_indices,
-                   temp_mtris);
+                   temp_mtris, parallel_for);
 
     log_->Info("Ray: Mesh \'%s\' preprocessed in %lldms", _m.name ? _m.name : "(unknown)",
                (long long)(Ray::GetTimeMs() - t1));
@@ -386,22 +554,28 @@ Ray::MeshHandle Ray::Cpu::Scene::AddMesh(const mesh_desc_t &_m) {
         temp_wnodes.reserve(temp_nodes.size() / 8);
 
         FlattenBVH_r(temp_nodes, 0, temp_wnodes);
-        const std::pair<uint32_t, uint32_t> wnodes_index = wnodes_.Allocate(uint32_t(temp_wnodes.size()));
+        const std::pair<uint32_t, uint32_t> wnodes_index = use_compressed_bvh_
+                                                               ? qwnodes_.Allocate(uint32_t(temp_wnodes.size()))
+                                                               : wnodes_.Allocate(uint32_t(temp_wnodes.size()));
 
         for (uint32_t i = 0; i < uint32_t(temp_wnodes.size()); ++i) {
-            const wbvh_node_t &in_n = temp_wnodes[i];
-            wbvh_node_t &out_n = wnodes_[wnodes_index.first + i];
+            wbvh_node_t &n = temp_wnodes[i];
 
-            out_n = in_n;
-            if (out_n.child[0] & LEAF_NODE_BIT) {
-                out_n.child[0] += tri_indices_index.first;
+            if (n.child[0] & LEAF_NODE_BIT) {
+                n.child[0] += tri_indices_index.first;
             } else {
                 for (int j = 0; j < 8; ++j) {
-                    if (out_n.child[j] != 0x7fffffff) {
-                        out_n.child[j] += wnodes_index.first;
+                    if (n.child[j] != 0x7fffffff) {
+                        n.child[j] += wnodes_index.first;
                     }
                 }
             }
+
+            if (use_compressed_bvh_) {
+                QuantizeBVHNode(n, qwnodes_[wnodes_index.first + i]);
+            } else {
+                wnodes_[wnodes_index.first + i] = n;
+            }
         }
 
         m.node_index = wnodes_index.first;
@@ -576,7 +750,9 @@ void Ray::Cpu::Scene::RemoveMesh_nolock(const MeshHandle i) {
     tri_materials_.Erase(tris_block);
     vertices_.Erase(vert_data_block);
     vtx_indices_.Erase(vert_block);
-    if (use_wide_bvh_) {
+    if (use_compressed_bvh_) {
+        qwnodes_.Erase(node_block);
+    } else if (use_wide_bvh_) {
         wnodes_.Erase(node_block);
     } else {
         nodes_.Erase(node_block);
@@ -856,6 +1032,7 @@ Ray::MeshInstanceHandle Ray::Cpu::Scene::AddMeshInstance(const mesh_instance_des
 
     const MeshInstanceHandle ret = {mi_index.first, mi_index.second};
     SetMeshInstanceTransform_nolock(ret, mi_desc.xform);
+    tlas_nodes_.clear();
 
     return ret;
 }
@@ -875,6 +1052,28 @@ void Ray::Cpu::Scene::RemoveMeshInstance_nolock(const MeshInstanceHandle i) {
         lights_.Erase(light_block);
     }
     mesh_instances_.Erase(i._block);
+    tlas_nodes_.clear();
+}
+
+void Ray::Cpu::Scene::SetMeshInstanceTransforms(
+    Span<const MeshInstanceHandle> mi, Span<const float> xforms,
+    const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
+    assert(xforms.size() == 16 * mi.size());
+    std::unique_lock<std::shared_timed_mutex> lock(mtx_);
+
+    bool update_light_tree = false;
+    for (ptrdiff_t i = 0; i < mi.size(); ++i) {
+        SetMeshInstanceTransform_nolock(mi[i], &xforms[16 * i]);
+        update_light_tree |= (mesh_instances_[mi[i]._index].lights_index != 0xffffffff);
+    }
+
+    if (!RefitTLAS_nolock()) {
+        RebuildTLAS_nolock(parallel_for);
+    }
+    if (update_light_tree) {
+        // emissive triangles are stored in world space
+        RebuildLightTree_nolock(parallel_for);
+    }
 }
 
 void Ray::Cpu::Scene::Finalize(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
@@ -915,65 +1114,116 @@ void Ray::Cpu::Scene::Finalize(const std::function<void(int, int, ParallelForFun
         }
     }
 
-    RebuildTLAS_nolock();
-    RebuildLightTree_nolock();
+    RebuildTLAS_nolock(parallel_for);
+    RebuildLightTree_nolock(parallel_for);
 }
 
-void Ray::Cpu::Scene::RebuildTLAS_nolock() {
-    if (tlas_root_ != 0xffffffff) {
-        if (use_wide_bvh_) {
-            wnodes_.Erase(tlas_block_);
-        } else {
-            nodes_.Erase(tlas_block_);
-        }
-        tlas_root_ = tlas_block_ = 0xffffffff;
-    }
+void Ray::Cpu::Scene::RebuildTLAS_nolock(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
+    tlas_nodes_.clear();
+    tlas_prim_indices_.clear();
+    tlas_instances_.clear();
 
     if (mesh_instances_.empty()) {
+        UploadTLAS_nolock();
         return;
     }
 
     aligned_vector<prim_t> primitives;
     primitives.reserve(mesh_instances_.size());
+    tlas_instances_.reserve(mesh_instances_.size());
 
-    for (const mesh_instance_t &mi : mesh_instances_) {
-        const mesh_t &m = meshes_[mi.mesh_index];
+    for (auto it = mesh_instances_.cbegin(); it != mesh_instances_.cend(); ++it) {
+        const mesh_t &m = meshes_[it->mesh_index];
 
         Ref::fvec4 mi_bbox_min = 0.0f, mi_bbox_max = 0.0f;
-        TransformBoundingBox(m.bbox_min, m.bbox_max, mi.xform, value_ptr(mi_bbox_min), value_ptr(mi_bbox_max));
+        TransformBoundingBox(m.bbox_min, m.bbox_max, it->xform, value_ptr(mi_bbox_min), value_ptr(mi_bbox_max));
 
         primitives.push_back({0, 0, 0, mi_bbox_min, mi_bbox_max});
+        tlas_instances_.push_back(it.index());
     }
 
     bvh_settings_t s = {};
     s.oversplit_threshold = -1.0f;
     s.min_primitives_in_leaf = 1;
 
-    std::vector<bvh_node_t> temp_nodes;
-    std::vector<uint32_t> mi_indices;
-    PreprocessPrims_SAH(primitives, {}, s, temp_nodes, mi_indices);
+    PreprocessPrims_SAH(primitives, {}, s, tlas_nodes_, tlas_prim_indices_, parallel_for);
+    tlas_built_cost_ = CalcBVHCost(tlas_nodes_);
+
+    UploadTLAS_nolock();
+}
+
+bool Ray::Cpu::Scene::RefitTLAS_nolock() {
+    if (tlas_nodes_.empty()) {
+        return false;
+    }
+
+    aligned_vector<prim_t> primitives;
+    primitives.reserve(tlas_instances_.size());
+
+    for (const uint32_t mi_index : tlas_instances_) {
+        const mesh_instance_t &mi = mesh_instances_[mi_index];
+        const mesh_t &m = meshes_[mi.mesh_index];
+
+        Ref::fvec4 mi_bbox_min = 0.0f, mi_bbox_max = 0.0f;
+        TransformBoundingBox(m.bbox_min, m.bbox_max, mi.xform, value_ptr(mi_bbox_min), value_ptr(mi_bbox_max));
+
+        primitives.push_back({0, 0, 0, mi_bbox_min, mi_bbox_max});
+    }
+
+    RefitBVH(primitives, tlas_prim_indices_, tlas_nodes_);
+
+    if (CalcBVHCost(tlas_nodes_) > TLASRebuildThreshold * tlas_built_cost_) {
+        // quality dropped too much
+        return false;
+    }
+
+    UploadTLAS_nolock();
+    return true;
+}
+
+void Ray::Cpu::Scene::UploadTLAS_nolock() {
+    if (tlas_root_ != 0xffffffff) {
+        if (use_compressed_bvh_) {
+            qwnodes_.Erase(tlas_block_);
+        } else if (use_wide_bvh_) {
+            wnodes_.Erase(tlas_block_);
+        } else {
+            nodes_.Erase(tlas_block_);
+        }
+        tlas_root_ = tlas_block_ = 0xffffffff;
+    }
+
+    if (tlas_nodes_.empty()) {
+        return;
+    }
 
     if (use_wide_bvh_) {
         aligned_vector<wbvh_node_t> temp_wnodes;
-        temp_wnodes.reserve(temp_nodes.size() / 8);
+        temp_wnodes.reserve(tlas_nodes_.size() / 8);
 
-        FlattenBVH_r(temp_nodes, 0, temp_wnodes);
-        const std::pair<uint32_t, uint32_t> wnodes_index = wnodes_.Allocate(uint32_t(temp_wnodes.size()));
+        FlattenBVH_r(tlas_nodes_, 0, temp_wnodes);
+        const std::pair<uint32_t, uint32_t> wnodes_index = use_compressed_bvh_
+                                                               ? qwnodes_.Allocate(uint32_t(temp_wnodes.size()))
+                                                               : wnodes_.Allocate(uint32_t(temp_wnodes.size()));
 
         for (uint32_t i = 0; i < uint32_t(temp_wnodes.size()); ++i) {
-            const wbvh_node_t &in_n = temp_wnodes[i];
-            wbvh_node_t &out_n = wnodes_[wnodes_index.first + i];
+            wbvh_node_t &n = temp_wnodes[i];
 
-            out_n = in_n;
-            if ((out_n.child[0] & LEAF_NODE_BIT) == 0) {
+            if ((n.child[0] & LEAF_NODE_BIT) == 0) {
                 for (int j = 0; j < 8; ++j) {
-                    if (out_n.child[j] != 0x7fffffff) {
-                        out_n.child[j] += wnodes_index.first;
+                    if (n.child[j] != 0x7fffffff) {
+                        n.child[j] += wnodes_index.first;
                     }
                 }
             } else {
-                out_n.child[0] = mi_indices[out_n.child[0] & PRIM_INDEX_BITS];
-                out_n.child[0] |= LEAF_NODE_BIT;
+                n.child[0] = tlas_instances_[tlas_prim_indices_[n.child[0] & PRIM_INDEX_BITS]];
+                n.child[0] |= LEAF_NODE_BIT;
+            }
+
+            if (use_compressed_bvh_) {
+                QuantizeBVHNode(n, qwnodes_[wnodes_index.first + i]);
+            } else {
+                wnodes_[wnodes_index.first + i] = n;
             }
         }
 
@@ -981,7 +1231,7 @@ void Ray::Cpu::Scene::RebuildTLAS_nolock() {
         tlas_block_ = wnodes_index.second;
     } else {
         std::vector<bvh2_node_t> temp_bvh2_nodes;
-        ConvertToBVH2(temp_nodes, temp_bvh2_nodes);
+        ConvertToBVH2(tlas_nodes_, temp_bvh2_nodes);
 
         const std::pair<uint32_t, uint32_t> nodes_index = nodes_.Allocate(uint32_t(temp_bvh2_nodes.size()));
 
@@ -992,14 +1242,14 @@ void Ray::Cpu::Scene::RebuildTLAS_nolock() {
             if ((out_n.left_child & BVH2_PRIM_COUNT_BITS) == 0) {
                 out_n.left_child += nodes_index.first;
             } else {
-                out_n.left_child =
-                    (out_n.left_child & BVH2_PRIM_COUNT_BITS) | mi_indices[out_n.left_child & BVH2_PRIM_INDEX_BITS];
+                out_n.left_child = (out_n.left_child & BVH2_PRIM_COUNT_BITS) |
+                                   tlas_instances_[tlas_prim_indices_[out_n.left_child & BVH2_PRIM_INDEX_BITS]];
             }
             if ((out_n.right_child & BVH2_PRIM_COUNT_BITS) == 0) {
                 out_n.right_child += nodes_index.first;
             } else {
-                out_n.right_child =
-                    (out_n.right_child & BVH2_PRIM_COUNT_BITS) | mi_indices[out_n.right_child & BVH2_PRIM_INDEX_BITS];
+                out_n.right_child = (out_n.right_child & BVH2_PRIM_COUNT_BITS) |
+                                    tlas_instances_[tlas_prim_indices_[out_n.right_child & BVH2_PRIM_INDEX_BITS]];
             }
         }
 
@@ -1200,7 +1450,8 @@ void Ray::Cpu::Scene::PrepareEnvMapQTree_nolock() {
     log_->Info("Env map qtree res is %i", env_map_qtree_.res);
 }
 
-void Ray::Cpu::Scene::RebuildLightTree_nolock() {
+void Ray::Cpu::Scene::RebuildLightTree_nolock(
+    const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
     aligned_vector<prim_t> primitives;
     primitives.reserve(lights_.size());
 
@@ -1364,7 +1615,7 @@ void Ray::Cpu::Scene::RebuildLightTree_nolock() {
     s.oversplit_threshold = -1.0f;
     s.allow_spatial_splits = false;
     s.min_primitives_in_leaf = 1;
-    PreprocessPrims_SAH(primitives, {}, s, temp_nodes, prim_indices);
+    PreprocessPrims_SAH(primitives, {}, s, temp_nodes, prim_indices, parallel_for);
 
     light_nodes_.resize(temp_nodes.size(), light_bvh_node_t{});
     for (uint32_t i = 0; i < temp_nodes.size(); ++i) {
@@ -1514,7 +1765,22 @@ void Ray::Cpu::Scene::GetBounds(float bbox_min[3], float bbox_max[3]) const {
     bbox_min[0] = bbox_min[1] = bbox_min[2] = MAX_DIST;
     bbox_max[0] = bbox_max[1] = bbox_max[2] = -MAX_DIST;
     if (tlas_root_ != 0xffffffff) {
-        if (use_wide_bvh_) {
+        if (use_compressed_bvh_) {
+            const qwbvh_node_t &root_node = qwnodes_[tlas_root_];
+
+            float ch_bbox_min[3][8], ch_bbox_max[3][8];
+            DequantizeBVHNode(root_node, ch_bbox_min, ch_bbox_max);
+
+            for (int j = 0; j < 8; j++) {
+                if ((root_node.child_mask & (1u << j)) == 0) {
+                    continue;
+                }
+                for (int i = 0; i < 3; ++i) {
+                    bbox_min[i] = fminf(bbox_min[i], ch_bbox_min[i][j]);
+                    bbox_max[i] = fmaxf(bbox_max[i], ch_bbox_max[i][j]);
+                }
+            }
+        } else if (use_wide_bvh_) {
             const wbvh_node_t &root_node = wnodes_[tlas_root_];
             if (root_node.child[0] & LEAF_NODE_BIT) {
                 for (int i = 0; i < 3; ++i) {
@@ -1561,3 +1827,229 @@ void Ray::Cpu::Scene::GetBounds(float bbox_min[3], float bbox_max[3]) const {
         }
     }
 }
+
+bool Ray::Cpu::Scene::SaveCache(const char *file_name, const uint64_t inputs_hash) const {
+    std::shared_lock<std::shared_timed_mutex> lock(mtx_);
+
+    if (physical_sky_texture_ != InvalidTextureHandle || env_.env_map == PhysicalSkyTexture._index) {
+        // generated sky texture is not a part of the cache
+        log_->Error("Scene cache does not support physical sky");
+        return false;
+    }
+
+    FILE *f = fopen(file_name, "wb");
+    if (!f) {
+        log_->Error("Failed to open %s for writing", file_name);
+        return false;
+    }
+
+    scene_cache_header_t header = {};
+    header.version = SceneCacheVersion;
+    header.flags = (use_wide_bvh_ ? SceneCacheWideBVHBit : 0) | (use_compressed_bvh_ ? SceneCacheCompressedBVHBit : 0);
+    header.inputs_hash = inputs_hash;
+    header.layout_hash = CalcSceneCacheLayoutHash();
+
+    SceneCacheWriter writer(f);
+    // magic is written last, incomplete file will be rejected on load
+    writer.Write(header);
+
+    writer.Write(nodes_);
+    writer.Write(wnodes_);
+    writer.Write(qwnodes_);
+    writer.Write(tris_);
+    writer.Write(tri_indices_);
+    writer.Write(mtris_);
+    writer.Write(tri_materials_);
+    writer.Write(meshes_);
+    writer.Write(mesh_instances_);
+    writer.Write(vertices_);
+    writer.Write(vtx_indices_);
+    writer.Write(materials_);
+    writer.Write(lights_);
+
+    writer.Write(li_indices_);
+    writer.Write(dir_lights_);
+    writer.Write(visible_lights_count_);
+    writer.Write(blocker_lights_count_);
+    writer.Write(light_nodes_);
+    writer.Write(light_wnodes_);
+    writer.Write(light_cwnodes_);
+
+    writer.Write(env_);
+    writer.Write(env_map_light_);
+    writer.Write(sky_transmittance_lut_);
+    writer.Write(sky_multiscatter_lut_);
+    writer.Write(env_map_qtree_.res);
+    writer.Write(env_map_qtree_.medium_lum);
+    writer.Write(env_map_qtree_.mips.size());
+    for (const aligned_vector<Ref::fvec4> &mip : env_map_qtree_.mips) {
+        writer.Write(mip);
+    }
+
+    writer.Write(tlas_root_);
+    writer.Write(tlas_block_);
+    writer.Write(tlas_nodes_);
+    writer.Write(tlas_prim_indices_);
+    writer.Write(tlas_instances_);
+    writer.Write(tlas_built_cost_);
+
+    bool result = writer.ok();
+    if (result) {
+        memcpy(header.magic, SceneCacheMagic, sizeof(SceneCacheMagic));
+        header.file_size = writer.pos();
+        result = (fseek(f, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, f) == 1);
+    }
+    result &= (fclose(f) == 0);
+    if (!result) {
+        log_->Error("Failed to write scene cache %s", file_name);
+        remove(file_name);
+    }
+    return result;
+}
+
+bool Ray::Cpu::Scene::LoadCache(const char *file_name, const uint64_t inputs_hash) {
+    std::unique_lock<std::shared_timed_mutex> lock(mtx_);
+
+    if (!meshes_.empty() || !mesh_instances_.empty() || !materials_.empty() || !lights_.empty() ||
+        tlas_root_ != 0xffffffff || cache_file_) {
+        log_->Warning("Scene cache can only be loaded into empty scene");
+        return false;
+    }
+
+    auto file = std::make_unique<MappedFile>(file_name);
+    if (!file->ready()) {
+        return false;
+    }
+
+    SceneCacheReader reader(file->data(), file->size());
+
+    scene_cache_header_t header = {};
+    reader.Read(header);
+    const uint32_t expected_flags =
+        (use_wide_bvh_ ? SceneCacheWideBVHBit : 0) | (use_compressed_bvh_ ? SceneCacheCompressedBVHBit : 0);
+    if (!reader.ok() || memcmp(header.magic, SceneCacheMagic, sizeof(SceneCacheMagic)) != 0 ||
+        header.version != SceneCacheVersion || header.layout_hash != CalcSceneCacheLayoutHash() ||
+        header.file_size != file->size()) {
+        log_->Warning("Scene cache %s is invalid or outdated", file_name);
+        return false;
+    }
+    if (header.inputs_hash != inputs_hash || header.flags != expected_flags) {
+        log_->Warning("Scene cache %s does not match scene inputs", file_name);
+        return false;
+    }
+
+    // storages are read into temporaries to keep scene intact in case of failure
+    SparseStorage<bvh2_node_t> nodes;
+    SparseStorage<wbvh_node_t> wnodes;
+    SparseStorage<qwbvh_node_t> qwnodes;
+    SparseStorage<tri_accel_t> tris;
+    SparseStorage<uint32_t> tri_indices;
+    SparseStorage<mtri_accel_t> mtris;
+    SparseStorage<tri_mat_data_t> tri_materials;
+    SparseStorage<mesh_t> meshes;
+    SparseStorage<mesh_instance_t> mesh_instances;
+    SparseStorage<vertex_t> vertices;
+    SparseStorage<uint32_t> vtx_indices;
+    SparseStorage<material_t> materials;
+    SparseStorage<light_t> lights;
+
+    reader.Read(nodes);
+    reader.Read(wnodes);
+    reader.Read(qwnodes);
+    reader.Read(tris);
+    reader.Read(tri_indices);
+    reader.Read(mtris);
+    reader.Read(tri_materials);
+    reader.Read(meshes);
+    reader.Read(mesh_instances);
+    reader.Read(vertices);
+    reader.Read(vtx_indices);
+    reader.Read(materials);
+    reader.Read(lights);
+
+    const environment_t prev_env = env_;
+    aligned_vector<float, 16> prev_transmittance_lut = sky_transmittance_lut_,
+                              prev_multiscatter_lut = sky_multiscatter_lut_;
+
+    reader.Read(li_indices_);
+    reader.Read(dir_lights_);
+    reader.Read(visible_lights_count_);
+    reader.Read(blocker_lights_count_);
+    reader.Read(light_nodes_);
+    reader.Read(light_wnodes_);
+    reader.Read(light_cwnodes_);
+
+    reader.Read(env_);
+    reader.Read(env_map_light_);
+    reader.Read(sky_transmittance_lut_);
+    reader.Read(sky_multiscatter_lut_);
+    reader.Read(env_map_qtree_.res);
+    reader.Read(env_map_qtree_.medium_lum);
+    uint32_t qtree_levels = 0;
+    reader.Read(qtree_levels);
+    if (qtree_levels > uint32_t(countof(env_.qtree_mips))) {
+        qtree_levels = 0;
+        reader.Fail();
+    }
+    env_map_qtree_.mips.resize(qtree_levels);
+    for (aligned_vector<Ref::fvec4> &mip : env_map_qtree_.mips) {
+        reader.Read(mip);
+    }
+
+    reader.Read(tlas_root_);
+    reader.Read(tlas_block_);
+    reader.Read(tlas_nodes_);
+    reader.Read(tlas_prim_indices_);
+    reader.Read(tlas_instances_);
+    reader.Read(tlas_built_cost_);
+
+    if (!reader.ok() || env_.qtree_levels != int(qtree_levels)) {
+        log_->Error("Failed to read scene cache %s", file_name);
+
+        li_indices_.clear();
+        dir_lights_.clear();
+        visible_lights_count_ = blocker_lights_count_ = 0;
+        light_nodes_.clear();
+        light_wnodes_.clear();
+        light_cwnodes_.clear();
+
+        env_ = prev_env;
+        env_map_light_ = InvalidLightHandle;
+        sky_transmittance_lut_ = std::move(prev_transmittance_lut);
+        sky_multiscatter_lut_ = std::move(prev_multiscatter_lut);
+        env_map_qtree_ = {};
+
+        tlas_root_ = tlas_block_ = 0xffffffff;
+        tlas_nodes_.clear();
+        tlas_prim_indices_.clear();
+        tlas_instances_.clear();
+        tlas_built_cost_ = 0.0f;
+
+        return false;
+    }
+
+    nodes_.swap(nodes);
+    wnodes_.swap(wnodes);
+    qwnodes_.swap(qwnodes);
+    tris_.swap(tris);
+    tri_indices_.swap(tri_indices);
+    mtris_.swap(mtris);
+    tri_materials_.swap(tri_materials);
+    meshes_.swap(meshes);
+    mesh_instances_.swap(mesh_instances);
+    vertices_.swap(vertices);
+    vtx_indices_.swap(vtx_indices);
+    materials_.swap(materials);
+    lights_.swap(lights);
+
+    // pointers are not valid after reloading
+    for (int i = 0; i < env_.qtree_levels; ++i) {
+        env_.qtree_mips[i] = value_ptr(env_map_qtree_.mips[i][0]);
+    }
+    for (int i = env_.qtree_levels; i < countof(env_.qtree_mips); ++i) {
+        env_.qtree_mips[i] = nullptr;
+    }
+
+    cache_file_ = std::move(file);
+    return true;
+}
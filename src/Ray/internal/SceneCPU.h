@@ -1,8 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 
 #include "CoreRef.h"
+#include "MappedFile.h"
 #include "SceneCommon.h"
 #include "SmallVector.h"
 #include "SparseStorageCPU.h"
@@ -47,10 +49,14 @@ class Scene : public SceneCommon {
     friend class Cpu::Renderer<Avx512::SIMDPolicy>;
     friend class Cpu::Renderer<Neon::SIMDPolicy>;
 
-    bool use_wide_bvh_, use_tex_compression_;
+    bool use_wide_bvh_, use_compressed_bvh_, use_tex_compression_;
+
+    // memory of loaded scene cache (referenced by storages below, so must outlive them)
+    std::unique_ptr<MappedFile> cache_file_;
 
     SparseStorage<bvh2_node_t> nodes_;
     SparseStorage<wbvh_node_t> wnodes_;
+    SparseStorage<qwbvh_node_t> qwnodes_;
     SparseStorage<tri_accel_t> tris_;
     SparseStorage<uint32_t> tri_indices_;
     SparseStorage<mtri_accel_t> mtris_;
@@ -62,6 +68,7 @@ class Scene : public SceneCommon {
 
     SparseStorage<material_t> materials_;
 
+    std::unique_ptr<TexPageCache> tex_page_cache_;
     TexStorageRGBA tex_storage_rgba_;
     TexStorageRGB tex_storage_rgb_;
     TexStorageRG tex_storage_rg_;
@@ -94,13 +101,20 @@ class Scene : public SceneCommon {
     mutable std::vector<uint64_t> spatial_cache_entries_;
     mutable aligned_vector<packed_cache_voxel_t, 16> spatial_cache_voxels_curr_, spatial_cache_voxels_prev_;
     mutable float spatial_cache_cam_pos_prev_[3] = {};
+    mutable std::atomic_int spatial_cache_blocks_resolved_{0};
 
     uint32_t tlas_root_ = 0xffffffff, tlas_block_ = 0xffffffff;
+    // binary top-level tree is kept for refitting (cleared when set of instances changes)
+    std::vector<bvh_node_t> tlas_nodes_;
+    std::vector<uint32_t> tlas_prim_indices_, tlas_instances_;
+    float tlas_built_cost_ = 0.0f;
 
     void RemoveMesh_nolock(MeshHandle m);
     void RemoveMeshInstance_nolock(MeshInstanceHandle i);
-    void RebuildTLAS_nolock();
-    void RebuildLightTree_nolock();
+    void RebuildTLAS_nolock(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for);
+    bool RefitTLAS_nolock();
+    void UploadTLAS_nolock();
+    void RebuildLightTree_nolock(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for);
 
     void PrepareSkyEnvMap_nolock(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for);
     void PrepareEnvMapQTree_nolock();
@@ -109,7 +123,8 @@ class Scene : public SceneCommon {
     void SetMeshInstanceTransform_nolock(MeshInstanceHandle mi, const float *xform);
 
   public:
-    Scene(ILog *log, bool use_wide_bvh, bool use_tex_compression, bool use_spatial_cache);
+    Scene(ILog *log, bool use_wide_bvh, bool use_compressed_bvh, bool use_tex_compression, bool use_spatial_cache,
+          size_t tex_page_budget = 0, const char *tex_page_file = nullptr);
     ~Scene() override;
 
     TextureHandle AddTexture(const tex_desc_t &t) override;
@@ -128,7 +143,8 @@ class Scene : public SceneCommon {
         materials_.Erase(m._block);
     }
 
-    MeshHandle AddMesh(const mesh_desc_t &m) override;
+    MeshHandle AddMesh(const mesh_desc_t &m,
+                       const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) override;
     void RemoveMesh(MeshHandle m) override {
         std::unique_lock<std::shared_timed_mutex> lock(mtx_);
         RemoveMesh_nolock(m);
@@ -150,6 +166,8 @@ class Scene : public SceneCommon {
         std::unique_lock<std::shared_timed_mutex> lock(mtx_);
         SetMeshInstanceTransform_nolock(mi, xform);
     }
+    void SetMeshInstanceTransforms(Span<const MeshInstanceHandle> mi, Span<const float> xforms,
+                                   const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) override;
     void RemoveMeshInstance(MeshInstanceHandle mi) override {
         std::unique_lock<std::shared_timed_mutex> lock(mtx_);
         RemoveMeshInstance_nolock(mi);
@@ -157,6 +175,9 @@ class Scene : public SceneCommon {
 
     void Finalize(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) override;
 
+    bool SaveCache(const char *file_name, uint64_t inputs_hash) const override;
+    bool LoadCache(const char *file_name, uint64_t inputs_hash) override;
+
     void GetBounds(float bbox_min[3], float bbox_max[3]) const;
 
     uint32_t triangle_count() const override {
@@ -165,6 +186,9 @@ class Scene : public SceneCommon {
     }
     uint32_t node_count() const override {
         std::shared_lock<std::shared_timed_mutex> lock(mtx_);
+        if (use_compressed_bvh_) {
+            return uint32_t(qwnodes_.size());
+        }
         return use_wide_bvh_ ? uint32_t(wnodes_.size()) : uint32_t(nodes_.size());
     }
 };
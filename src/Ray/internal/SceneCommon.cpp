@@ -1,5 +1,7 @@
 #include "SceneCommon.h"
 
+#include <cstring>
+
 #include "AtmosphereRef.h"
 #include "Core.h"
 
@@ -15,8 +17,124 @@ Ref::fvec4 rgb_to_rgbe(const Ref::fvec4 &rgb) {
 
     return Ref::fvec4{rgb.get<0>() * factor, rgb.get<1>() * factor, rgb.get<2>() * factor, float(exponent + 128)};
 }
+
+// FNV-1a variant which consumes 8-byte words (much faster for large vertex arrays)
+uint64_t hash_data(const void *data, const size_t size, uint64_t h) {
+    const uint64_t Prime = 0x100000001b3ull;
+
+    h = (h ^ uint64_t(size)) * Prime;
+
+    const uint8_t *bytes = (const uint8_t *)data;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, &bytes[i], sizeof(uint64_t));
+        h = (h ^ word) * Prime;
+    }
+    for (; i < size; ++i) {
+        h = (h ^ bytes[i]) * Prime;
+    }
+    return h;
+}
+
+template <typename T> uint64_t hash_value(const T &val, const uint64_t h) { return hash_data(&val, sizeof(T), h); }
+
+uint64_t hash_attribute(const vtx_attribute_t &attr, Span<const vtx_attribute_t *const> prev_attrs, uint64_t h) {
+    h = hash_value(attr.offset, h);
+    h = hash_value(attr.stride, h);
+    // attributes are usually interleaved in a single array, avoid hashing it multiple times
+    for (int i = 0; i < int(prev_attrs.size()); ++i) {
+        if (prev_attrs[i]->data.data() == attr.data.data() && prev_attrs[i]->data.size() == attr.data.size()) {
+            return hash_value(i, h);
+        }
+    }
+    return hash_data(attr.data.data(), attr.data.size() * sizeof(float), h);
+}
 } // namespace Ray
 
+uint64_t Ray::HashInputs(Span<const uint8_t> data, const uint64_t seed) {
+    return hash_data(data.data(), data.size(), seed ^ 0xcbf29ce484222325ull);
+}
+
+uint64_t Ray::HashInputs(const mesh_desc_t &m, const uint64_t seed) {
+    uint64_t h = seed ^ 0xcbf29ce484222325ull;
+    h = hash_value(m.prim_type, h);
+
+    const vtx_attribute_t *attrs[] = {&m.vtx_positions, &m.vtx_normals, &m.vtx_binormals, &m.vtx_uvs};
+    for (int i = 0; i < 4; ++i) {
+        h = hash_attribute(*attrs[i], Span<const vtx_attribute_t *const>(attrs, i), h);
+    }
+
+    h = hash_data(m.vtx_indices.data(), m.vtx_indices.size() * sizeof(uint32_t), h);
+    h = hash_value(m.base_vertex, h);
+    for (const mat_group_desc_t &grp : m.groups) {
+        h = hash_value(grp.front_mat._index, h);
+        h = hash_value(grp.back_mat._index, h);
+        h = hash_value(uint64_t(grp.vtx_start), h);
+        h = hash_value(uint64_t(grp.vtx_count), h);
+    }
+    h = hash_value(m.allow_spatial_splits, h);
+    h = hash_value(m.use_fast_bvh_build, h);
+    return h;
+}
+
+uint64_t Ray::HashInputs(const shading_node_desc_t &m, const uint64_t seed) {
+    // hashed field by field to skip padding bytes
+    uint64_t h = seed ^ 0xcbf29ce484222325ull;
+    h = hash_value(m.type, h);
+    h = hash_value(m.base_color, h);
+    h = hash_value(m.base_texture._index, h);
+    h = hash_value(m.normal_map._index, h);
+    h = hash_value(m.normal_map_intensity, h);
+    h = hash_value(m.mix_materials[0]._index, h);
+    h = hash_value(m.mix_materials[1]._index, h);
+    h = hash_value(m.roughness, h);
+    h = hash_value(m.roughness_texture._index, h);
+    h = hash_value(m.anisotropic, h);
+    h = hash_value(m.anisotropic_rotation, h);
+    h = hash_value(m.sheen, h);
+    h = hash_value(m.specular, h);
+    h = hash_value(m.strength, h);
+    h = hash_value(m.fresnel, h);
+    h = hash_value(m.ior, h);
+    h = hash_value(m.tint, h);
+    h = hash_value(m.metallic_texture._index, h);
+    h = hash_value(m.importance_sample, h);
+    h = hash_value(m.mix_add, h);
+    return h;
+}
+
+uint64_t Ray::HashInputs(const principled_mat_desc_t &m, const uint64_t seed) {
+    uint64_t h = seed ^ 0xcbf29ce484222325ull;
+    h = hash_value(m.base_color, h);
+    h = hash_value(m.base_texture._index, h);
+    h = hash_value(m.metallic, h);
+    h = hash_value(m.metallic_texture._index, h);
+    h = hash_value(m.specular, h);
+    h = hash_value(m.specular_texture._index, h);
+    h = hash_value(m.specular_tint, h);
+    h = hash_value(m.roughness, h);
+    h = hash_value(m.roughness_texture._index, h);
+    h = hash_value(m.anisotropic, h);
+    h = hash_value(m.anisotropic_rotation, h);
+    h = hash_value(m.sheen, h);
+    h = hash_value(m.sheen_tint, h);
+    h = hash_value(m.clearcoat, h);
+    h = hash_value(m.clearcoat_roughness, h);
+    h = hash_value(m.ior, h);
+    h = hash_value(m.transmission, h);
+    h = hash_value(m.transmission_roughness, h);
+    h = hash_value(m.emission_color, h);
+    h = hash_value(m.emission_texture._index, h);
+    h = hash_value(m.emission_strength, h);
+    h = hash_value(m.alpha, h);
+    h = hash_value(m.alpha_texture._index, h);
+    h = hash_value(m.normal_map._index, h);
+    h = hash_value(m.normal_map_intensity, h);
+    h = hash_value(m.importance_sample, h);
+    return h;
+}
+
 void Ray::SceneCommon::GetEnvironment(environment_desc_t &env) {
     std::shared_lock<std::shared_timed_mutex> lock(mtx_);
 
@@ -103,6 +103,11 @@ class Scene : public SceneCommon {
 
     bvh_node_t tlas_root_node_ = {};
 
+    // binary tree is kept on CPU side to allow refitting it on instance movement
+    std::vector<bvh_node_t> tlas_nodes_;
+    std::vector<uint32_t> tlas_prim_indices_, tlas_instances_;
+    float tlas_built_cost_ = 0.0f;
+
     Buffer rt_geo_data_buf_, rt_instance_buf_, rt_tlas_buf_;
 
     struct MeshBlas {
@@ -132,8 +137,10 @@ class Scene : public SceneCommon {
 
     void RemoveMesh_nolock(MeshHandle m);
     void RemoveMeshInstance_nolock(MeshInstanceHandle i);
-    void Rebuild_SWRT_TLAS_nolock();
-    void RebuildLightTree_nolock();
+    void Rebuild_SWRT_TLAS_nolock(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for);
+    bool Refit_SWRT_TLAS_nolock();
+    void Upload_SWRT_TLAS_nolock();
+    void RebuildLightTree_nolock(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for);
 
     std::vector<Ray::color_rgba8_t> CalcSkyEnvTexture(const atmosphere_params_t &params, const int res[2],
                                                       const light_t lights[], Span<const uint32_t> dir_lights);
@@ -187,7 +194,8 @@ class Scene : public SceneCommon {
         materials_.Erase(m._block);
     }
 
-    MeshHandle AddMesh(const mesh_desc_t &m) override;
+    MeshHandle AddMesh(const mesh_desc_t &m,
+                       const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) override;
     void RemoveMesh(MeshHandle m) override {
         std::unique_lock<std::shared_timed_mutex> lock(mtx_);
         RemoveMesh_nolock(m);
@@ -209,6 +217,8 @@ class Scene : public SceneCommon {
         std::unique_lock<std::shared_timed_mutex> lock(mtx_);
         SetMeshInstanceTransform_nolock(mi_handle, xform);
     }
+    void SetMeshInstanceTransforms(Span<const MeshInstanceHandle> mi, Span<const float> xforms,
+                                   const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) override;
     void RemoveMeshInstance(MeshInstanceHandle mi) override {
         std::unique_lock<std::shared_timed_mutex> lock(mtx_);
         RemoveMeshInstance_nolock(mi);
@@ -944,7 +954,9 @@ inline Ray::MaterialHandle Ray::NS::Scene::AddMaterial(const principled_mat_desc
     return root_node;
 }
 
-inline Ray::MeshHandle Ray::NS::Scene::AddMesh(const mesh_desc_t &_m) {
+inline Ray::MeshHandle
+Ray::NS::Scene::AddMesh(const mesh_desc_t &_m,
+                        const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
     std::vector<bvh_node_t> new_nodes;
     aligned_vector<tri_accel_t> new_tris;
     std::vector<uint32_t> new_tri_indices;
@@ -978,7 +990,7 @@ inline Ray::MeshHandle Ray::NS::Scene::AddMesh(const mesh_desc_t &_m) {
     } else {
         aligned_vector<mtri_accel_t> _unused;
         PreprocessMesh(_m.vtx_positions, _m.vtx_indices, _m.base_vertex, s, new_nodes, new_tris, new_tri_indices,
-                       _unused);
+                       _unused, parallel_for);
 
         memcpy(value_ptr(bbox_min), new_nodes[0].bbox_min, 3 * sizeof(float));
         memcpy(value_ptr(bbox_max), new_nodes[0].bbox_max, 3 * sizeof(float));
@@ -1451,6 +1463,7 @@ inline Ray::MeshInstanceHandle Ray::NS::Scene::AddMeshInstance(const mesh_instan
     auto ret = MeshInstanceHandle{mi_index.first, mi_index.second};
 
     SetMeshInstanceTransform_nolock(ret, mi_desc.xform);
+    tlas_nodes_.clear();
 
     return ret;
 }
@@ -1464,6 +1477,29 @@ inline void Ray::NS::Scene::SetMeshInstanceTransform_nolock(const MeshInstanceHa
     mesh_instances_.Set(mi_handle._index, mi);
 }
 
+inline void Ray::NS::Scene::SetMeshInstanceTransforms(
+    Span<const MeshInstanceHandle> mi, Span<const float> xforms,
+    const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
+    assert(xforms.size() == 16 * mi.size());
+    std::unique_lock<std::shared_timed_mutex> lock(mtx_);
+
+    bool update_light_tree = false;
+    for (ptrdiff_t i = 0; i < mi.size(); ++i) {
+        SetMeshInstanceTransform_nolock(mi[i], &xforms[16 * i]);
+        update_light_tree |= (mesh_instances_[mi[i]._index].lights_index != 0xffffffff);
+    }
+
+    if (use_hwrt_) {
+        // driver-side build is fast enough, instance buffer has to be reuploaded anyway
+        Rebuild_HWRT_TLAS_nolock();
+    } else if (!Refit_SWRT_TLAS_nolock()) {
+        Rebuild_SWRT_TLAS_nolock(parallel_for);
+    }
+    if (update_light_tree) {
+        RebuildLightTree_nolock(parallel_for);
+    }
+}
+
 inline void Ray::NS::Scene::RemoveMeshInstance_nolock(const MeshInstanceHandle i) {
     const mesh_instance_t &mi = mesh_instances_[i._index];
 
@@ -1472,6 +1508,7 @@ inline void Ray::NS::Scene::RemoveMeshInstance_nolock(const MeshInstanceHandle i
         lights_.Erase(light_block);
     }
     mesh_instances_.Erase(i._block);
+    tlas_nodes_.clear();
 }
 
 inline void Ray::NS::Scene::Finalize(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
@@ -1567,24 +1604,25 @@ inline void Ray::NS::Scene::Finalize(const std::function<void(int, int, Parallel
     if (use_hwrt_) {
         Rebuild_HWRT_TLAS_nolock();
     } else {
-        Rebuild_SWRT_TLAS_nolock();
+        Rebuild_SWRT_TLAS_nolock(parallel_for);
     }
-    RebuildLightTree_nolock();
+    RebuildLightTree_nolock(parallel_for);
 }
 
-inline void Ray::NS::Scene::Rebuild_SWRT_TLAS_nolock() {
-    if (tlas_root_ != 0xffffffff) {
-        nodes_.Erase(tlas_block_);
-        tlas_root_ = tlas_block_ = 0xffffffff;
-    }
+inline void
+Ray::NS::Scene::Rebuild_SWRT_TLAS_nolock(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
+    tlas_nodes_.clear();
+    tlas_prim_indices_.clear();
+    tlas_instances_.clear();
 
-    const size_t mi_count = mesh_instances_.size();
-    if (!mi_count) {
+    if (mesh_instances_.empty()) {
+        Upload_SWRT_TLAS_nolock();
         return;
     }
 
     aligned_vector<prim_t> primitives;
-    primitives.reserve(mi_count);
+    primitives.reserve(mesh_instances_.size());
+    tlas_instances_.reserve(mesh_instances_.size());
 
     for (auto it = mesh_instances_.cbegin(); it != mesh_instances_.cend(); ++it) {
         const mesh_t &m = meshes_[it->mesh_index];
@@ -1593,31 +1631,75 @@ inline void Ray::NS::Scene::Rebuild_SWRT_TLAS_nolock() {
         TransformBoundingBox(m.bbox_min, m.bbox_max, it->xform, value_ptr(mi_bbox_min), value_ptr(mi_bbox_max));
 
         primitives.push_back({0, 0, 0, mi_bbox_min, mi_bbox_max});
+        tlas_instances_.push_back(it.index());
     }
 
     bvh_settings_t s = {};
     s.oversplit_threshold = -1.0f;
     s.min_primitives_in_leaf = 1;
 
-    std::vector<bvh_node_t> bvh_nodes;
-    std::vector<uint32_t> mi_indices;
-    PreprocessPrims_SAH(primitives, {}, s, bvh_nodes, mi_indices);
+    PreprocessPrims_SAH(primitives, {}, s, tlas_nodes_, tlas_prim_indices_, parallel_for);
+    tlas_built_cost_ = CalcBVHCost(tlas_nodes_);
+
+    Upload_SWRT_TLAS_nolock();
+}
+
+inline bool Ray::NS::Scene::Refit_SWRT_TLAS_nolock() {
+    if (tlas_nodes_.empty()) {
+        return false;
+    }
+
+    aligned_vector<prim_t> primitives;
+    primitives.reserve(tlas_instances_.size());
+
+    for (const uint32_t mi_index : tlas_instances_) {
+        const mesh_instance_t &mi = mesh_instances_[mi_index];
+        const mesh_t &m = meshes_[mi.mesh_index];
+
+        Ref::fvec4 mi_bbox_min = 0.0f, mi_bbox_max = 0.0f;
+        TransformBoundingBox(m.bbox_min, m.bbox_max, mi.xform, value_ptr(mi_bbox_min), value_ptr(mi_bbox_max));
+
+        primitives.push_back({0, 0, 0, mi_bbox_min, mi_bbox_max});
+    }
+
+    RefitBVH(primitives, tlas_prim_indices_, tlas_nodes_);
+
+    if (CalcBVHCost(tlas_nodes_) > TLASRebuildThreshold * tlas_built_cost_) {
+        // quality dropped too much
+        return false;
+    }
+
+    Upload_SWRT_TLAS_nolock();
+    return true;
+}
+
+inline void Ray::NS::Scene::Upload_SWRT_TLAS_nolock() {
+    if (tlas_root_ != 0xffffffff) {
+        nodes_.Erase(tlas_block_);
+        tlas_root_ = tlas_block_ = 0xffffffff;
+    }
+
+    if (tlas_nodes_.empty()) {
+        return;
+    }
 
     std::vector<bvh2_node_t> bvh2_nodes;
-    ConvertToBVH2(bvh_nodes, bvh2_nodes);
+    ConvertToBVH2(tlas_nodes_, bvh2_nodes);
 
     const std::pair<uint32_t, uint32_t> nodes_index = nodes_.Allocate(nullptr, uint32_t(bvh2_nodes.size()));
-    // offset nodes
+    // offset nodes, leaves refer to mesh instances directly
     for (bvh2_node_t &n : bvh2_nodes) {
         if ((n.left_child & BVH2_PRIM_COUNT_BITS) == 0) {
             n.left_child += nodes_index.first;
         } else {
-            n.left_child = (n.left_child & BVH2_PRIM_COUNT_BITS) | mi_indices[n.left_child & BVH2_PRIM_INDEX_BITS];
+            n.left_child = (n.left_child & BVH2_PRIM_COUNT_BITS) |
+                           tlas_instances_[tlas_prim_indices_[n.left_child & BVH2_PRIM_INDEX_BITS]];
         }
         if ((n.right_child & BVH2_PRIM_COUNT_BITS) == 0) {
             n.right_child += nodes_index.first;
         } else {
-            n.right_child = (n.right_child & BVH2_PRIM_COUNT_BITS) | mi_indices[n.right_child & BVH2_PRIM_INDEX_BITS];
+            n.right_child = (n.right_child & BVH2_PRIM_COUNT_BITS) |
+                            tlas_instances_[tlas_prim_indices_[n.right_child & BVH2_PRIM_INDEX_BITS]];
         }
     }
     nodes_.Set(nodes_index.first, uint32_t(bvh2_nodes.size()), bvh2_nodes.data());
@@ -1626,7 +1708,7 @@ inline void Ray::NS::Scene::Rebuild_SWRT_TLAS_nolock() {
     tlas_block_ = nodes_index.second;
 
     // store root node
-    tlas_root_node_ = bvh_nodes[0];
+    tlas_root_node_ = tlas_nodes_[0];
 }
 
 // #define DUMP_SKY_ENV
@@ -2200,7 +2282,8 @@ inline void Ray::NS::Scene::PrepareEnvMapQTree_nolock() {
     log_->Info("Env map qtree res is %i", env_map_qtree_.res);
 }
 
-inline void Ray::NS::Scene::RebuildLightTree_nolock() {
+inline void
+Ray::NS::Scene::RebuildLightTree_nolock(const std::function<void(int, int, ParallelForFunction &&)> &parallel_for) {
     aligned_vector<prim_t> primitives;
     primitives.reserve(lights_.size());
 
@@ -2366,7 +2449,7 @@ inline void Ray::NS::Scene::RebuildLightTree_nolock() {
     s.oversplit_threshold = -1.0f;
     s.allow_spatial_splits = false;
     s.min_primitives_in_leaf = 1;
-    PreprocessPrims_SAH(primitives, {}, s, temp_nodes, prim_indices);
+    PreprocessPrims_SAH(primitives, {}, s, temp_nodes, prim_indices, parallel_for);
 
     std::vector<light_bvh_node_t> temp_lnodes(temp_nodes.size(), light_bvh_node_t{});
     for (uint32_t i = 0; i < temp_nodes.size(); ++i) {
@@ -16,6 +16,7 @@ template <typename T> class SparseStorage {
     std::unique_ptr<FreelistAlloc> alloc_; // TODO: merge with data allocation
     T *data_ = nullptr;
     uint32_t capacity_ = 0, size_ = 0;
+    bool owns_data_ = true; // false when data points into externally owned memory (e.g. mapped file)
 
     static const uint32_t InitialNonZeroCapacity = 8;
 
@@ -26,7 +27,11 @@ template <typename T> class SparseStorage {
         }
     }
 
-    ~SparseStorage() { aligned_free(data_); }
+    ~SparseStorage() {
+        if (owns_data_) {
+            aligned_free(data_);
+        }
+    }
 
     force_inline uint32_t size() const { return size_; }
     force_inline uint32_t capacity() const { return capacity_; }
@@ -59,9 +64,33 @@ template <typename T> class SparseStorage {
             r = alloc_->GetNextOccupiedBlock(r.block);
         }
 
-        aligned_free(data_);
+        if (owns_data_) {
+            aligned_free(data_);
+        }
         data_ = new_data;
         capacity_ = new_capacity;
+        owns_data_ = true;
+    }
+
+    // Makes empty storage reference already initialized external memory, it is copied on the first reallocation
+    void Adopt(T *data, const uint32_t capacity, const uint32_t size, std::unique_ptr<FreelistAlloc> &&alloc) {
+        assert(size_ == 0);
+        if (owns_data_) {
+            aligned_free(data_);
+        }
+        alloc_ = std::move(alloc);
+        data_ = data;
+        capacity_ = capacity;
+        size_ = size;
+        owns_data_ = false;
+    }
+
+    void swap(SparseStorage &rhs) {
+        std::swap(alloc_, rhs.alloc_);
+        std::swap(data_, rhs.data_);
+        std::swap(capacity_, rhs.capacity_);
+        std::swap(size_, rhs.size_);
+        std::swap(owns_data_, rhs.owns_data_);
     }
 
     template <class... Args> std::pair<uint32_t, uint32_t> emplace(Args &&...args) {
@@ -250,6 +279,8 @@ template <typename T> class SparseStorage {
     }
 
     bool IntegrityCheck() const { return alloc_->IntegrityCheck(); }
+
+    const FreelistAlloc *allocator() const { return alloc_.get(); }
 };
 
 template <typename T> const uint32_t SparseStorage<T>::InitialNonZeroCapacity;
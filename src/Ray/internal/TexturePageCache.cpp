@@ -0,0 +1,367 @@
+#include "TexturePageCache.h"
+
+#include <cstring>
+
+#include <algorithm>
+#include <iterator>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Ray {
+namespace Cpu {
+// zero is reserved for unused entries of thread-local footprint lookup
+std::atomic<uint64_t> g_tex_page_cache_next_id{1};
+} // namespace Cpu
+} // namespace Ray
+
+void Ray::Cpu::TexPageCache::shard_t::Unlink(const uint32_t slot) {
+    page_t &page = pages[slot];
+    if (page.prev != InvalidIndex) {
+        pages[page.prev].next = page.next;
+    } else {
+        head = page.next;
+    }
+    if (page.next != InvalidIndex) {
+        pages[page.next].prev = page.prev;
+    } else {
+        tail = page.prev;
+    }
+    page.prev = page.next = InvalidIndex;
+}
+
+void Ray::Cpu::TexPageCache::shard_t::PushFront(const uint32_t slot) {
+    page_t &page = pages[slot];
+    page.prev = InvalidIndex;
+    page.next = head;
+    if (head != InvalidIndex) {
+        pages[head].prev = slot;
+    }
+    head = slot;
+    if (tail == InvalidIndex) {
+        tail = slot;
+    }
+}
+
+void Ray::Cpu::TexPageCache::shard_t::PushBack(const uint32_t slot) {
+    page_t &page = pages[slot];
+    page.prev = tail;
+    page.next = InvalidIndex;
+    if (tail != InvalidIndex) {
+        pages[tail].next = slot;
+    }
+    tail = slot;
+    if (head == InvalidIndex) {
+        head = slot;
+    }
+}
+
+void Ray::Cpu::TexPageCache::shard_t::Invalidate(const uint32_t index) {
+    const uint32_t *p_slot = slots.Find(index);
+    if (!p_slot) {
+        return;
+    }
+    const uint32_t slot = *p_slot;
+    slots.Erase(index);
+    pages[slot].index = InvalidIndex;
+    // will be reused first
+    Unlink(slot);
+    PushBack(slot);
+}
+
+uint32_t Ray::Cpu::TexPageCache::shard_t::AllocSlot() {
+    if (pages.size() < max_pages) {
+        pages.emplace_back();
+        return uint32_t(pages.size() - 1);
+    }
+
+    // evict least recently used page, pages that are still being loaded are skipped
+    uint32_t slot = tail;
+    while (slot != InvalidIndex && pages[slot].state == ePageState::Loading) {
+        slot = pages[slot].prev;
+    }
+    if (slot == InvalidIndex) {
+        // every page is in flight, budget has to be exceeded
+        pages.emplace_back();
+        return uint32_t(pages.size() - 1);
+    }
+
+    Unlink(slot);
+    page_t &page = pages[slot];
+    if (page.index != InvalidIndex) {
+        slots.Erase(page.index);
+        page.index = InvalidIndex;
+    }
+    if (page.data) {
+        spare_data.push_back(std::move(page.data));
+    }
+    return slot;
+}
+
+std::shared_ptr<uint8_t> Ray::Cpu::TexPageCache::shard_t::AllocData() {
+    for (auto it = begin(spare_data); it != end(spare_data); ++it) {
+        // references are only dropped by other threads at this point, so the page can not become pinned again
+        if (it->use_count() == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            std::shared_ptr<uint8_t> ret = std::move(*it);
+            *it = std::move(spare_data.back());
+            spare_data.pop_back();
+            return ret;
+        }
+    }
+    return std::shared_ptr<uint8_t>(new uint8_t[PageSize], std::default_delete<uint8_t[]>());
+}
+
+Ray::Cpu::TexPageCache::TexPageCache(const size_t budget, const char *file_path) : id_(g_tex_page_cache_next_id++) {
+    const size_t max_pages = std::max(budget / PageSize, size_t(ShardsCount));
+    for (shard_t &shard : shards_) {
+        shard.max_pages = uint32_t(max_pages / ShardsCount);
+    }
+
+    if (file_path) {
+        file_ = fopen(file_path, "w+b");
+        if (file_) {
+            file_path_.assign(file_path, file_path + strlen(file_path) + 1);
+            remove_file_ = true;
+        }
+    } else {
+        // removed automatically when closed
+        file_ = tmpfile();
+    }
+}
+
+Ray::Cpu::TexPageCache::~TexPageCache() {
+    // release pages pinned by threads (footprints are not reachable through thread-local lookup anymore)
+    footprints_.clear();
+
+    if (file_) {
+        fclose(file_);
+        if (remove_file_) {
+            remove(file_path_.data());
+        }
+    }
+}
+
+size_t Ray::Cpu::TexPageCache::ReadAt(const uint64_t offset, void *out_data, const size_t size) {
+    // positional reads do not share file position, so threads can read concurrently
+#ifdef _WIN32
+    const auto file = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file_)));
+    OVERLAPPED ov = {};
+    ov.Offset = DWORD(offset & 0xffffffff);
+    ov.OffsetHigh = DWORD(offset >> 32u);
+    DWORD read_size = 0;
+    if (!ReadFile(file, out_data, DWORD(size), &read_size, &ov)) {
+        return 0;
+    }
+    return size_t(read_size);
+#else
+    const int fd = fileno(file_);
+    size_t read_size = 0;
+    while (read_size < size) {
+        const ssize_t ret =
+            pread(fd, reinterpret_cast<uint8_t *>(out_data) + read_size, size - read_size, off_t(offset + read_size));
+        if (ret <= 0) {
+            break;
+        }
+        read_size += size_t(ret);
+    }
+    return read_size;
+#endif
+}
+
+bool Ray::Cpu::TexPageCache::WriteAt(const uint64_t offset, const void *data, const size_t size) {
+#ifdef _WIN32
+    const auto file = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file_)));
+    OVERLAPPED ov = {};
+    ov.Offset = DWORD(offset & 0xffffffff);
+    ov.OffsetHigh = DWORD(offset >> 32u);
+    DWORD written_size = 0;
+    return WriteFile(file, data, DWORD(size), &written_size, &ov) && written_size == DWORD(size);
+#else
+    const int fd = fileno(file_);
+    size_t written_size = 0;
+    while (written_size < size) {
+        const ssize_t ret = pwrite(fd, reinterpret_cast<const uint8_t *>(data) + written_size, size - written_size,
+                                   off_t(offset + written_size));
+        if (ret <= 0) {
+            return false;
+        }
+        written_size += size_t(ret);
+    }
+    return true;
+#endif
+}
+
+uint64_t Ray::Cpu::TexPageCache::Write(const void *data, const size_t size) {
+    // start of every allocation is page-aligned to not share pages between textures
+    const uint64_t alloc_size = PageSize * ((size + PageSize - 1) / PageSize);
+
+    uint64_t offset;
+    bool reused = false;
+    {
+        std::lock_guard<std::mutex> _(extents_mtx_);
+
+        auto it = std::find_if(begin(free_extents_), end(free_extents_),
+                               [alloc_size](const extent_t &e) { return e.size >= alloc_size; });
+        if (it != end(free_extents_)) {
+            offset = it->offset;
+            it->offset += alloc_size;
+            it->size -= alloc_size;
+            if (!it->size) {
+                free_extents_.erase(it);
+            }
+            reused = true;
+        } else {
+            offset = file_size_;
+            file_size_ = offset + alloc_size;
+        }
+    }
+
+    if (!WriteAt(offset, data, size)) {
+        Free(offset, size);
+        return 0xffffffffffffffff;
+    }
+
+    if (reused) {
+        // cached copies of overwritten pages must not be used anymore
+        for (uint64_t i = offset / PageSize; i < (offset + alloc_size) / PageSize; ++i) {
+            shard_t &shard = shards_[i % ShardsCount];
+            std::lock_guard<std::mutex> _(shard.mtx);
+            shard.Invalidate(uint32_t(i));
+        }
+        ++epoch_;
+    }
+
+    return offset;
+}
+
+void Ray::Cpu::TexPageCache::Free(const uint64_t offset, const size_t size) {
+    std::lock_guard<std::mutex> _(extents_mtx_);
+
+    extent_t ext = {offset, PageSize * ((size + PageSize - 1) / PageSize)};
+
+    auto it = std::lower_bound(begin(free_extents_), end(free_extents_), ext,
+                               [](const extent_t &lhs, const extent_t &rhs) { return lhs.offset < rhs.offset; });
+    // merge with adjacent extents
+    if (it != end(free_extents_) && ext.offset + ext.size == it->offset) {
+        ext.size += it->size;
+        it = free_extents_.erase(it);
+    }
+    if (it != begin(free_extents_) && std::prev(it)->offset + std::prev(it)->size == ext.offset) {
+        --it;
+        ext.offset = it->offset;
+        ext.size += it->size;
+        it = free_extents_.erase(it);
+    }
+
+    free_extents_.insert(it, ext);
+}
+
+void Ray::Cpu::TexPageCache::LoadPage(const uint32_t index, uint8_t *out_data) {
+    const size_t read_size = ReadAt(uint64_t(index) * PageSize, out_data, PageSize);
+    // last page of allocation may be only partially stored in file
+    memset(out_data + read_size, 0, PageSize - read_size);
+}
+
+const uint8_t *Ray::Cpu::TexPageCache::PinPage(const uint32_t index) {
+    shard_t &shard = shards_[index % ShardsCount];
+
+    std::shared_ptr<uint8_t> data;
+    {
+        std::unique_lock<std::mutex> lock(shard.mtx);
+
+        const uint32_t *p_slot;
+        while ((p_slot = shard.slots.Find(index)) && shard.pages[*p_slot].state == ePageState::Loading) {
+            // page is being loaded by other thread
+            shard.loaded.wait(lock);
+        }
+
+        if (p_slot) {
+            const uint32_t slot = *p_slot;
+            if (slot != shard.head) {
+                shard.Unlink(slot);
+                shard.PushFront(slot);
+            }
+            data = shard.pages[slot].data;
+            ++hits_;
+        } else {
+            const uint32_t slot = shard.AllocSlot();
+            page_t &page = shard.pages[slot];
+            // evicted data stays alive while other threads keep it pinned
+            page.data = shard.AllocData();
+            page.index = index;
+            page.state = ePageState::Loading;
+            shard.slots.Insert(index, slot);
+            shard.PushFront(slot);
+            data = page.data;
+            ++misses_;
+
+            // file is read without holding the lock, slot can not be evicted until loading is finished
+            lock.unlock();
+            LoadPage(index, data.get());
+            lock.lock();
+
+            shard.pages[slot].state = ePageState::Ready;
+            lock.unlock();
+            shard.loaded.notify_all();
+        }
+    }
+
+    footprint_t &footprint = GetFootprint();
+    footprint_t::entry_t &entry = footprint.entries[footprint.next];
+    footprint.next = (footprint.next + 1) % footprint_t::PagesCount;
+
+    entry.epoch = epoch_.load(std::memory_order_relaxed);
+    entry.index = index;
+    entry.data = std::move(data);
+    return entry.data.get();
+}
+
+Ray::Cpu::TexPageCache::footprint_t *Ray::Cpu::TexPageCache::RegisterThread() {
+    std::lock_guard<std::mutex> _(footprints_mtx_);
+
+    const std::thread::id thread_id = std::this_thread::get_id();
+    for (const auto &f : footprints_) {
+        if (f.first == thread_id) {
+            return f.second.get();
+        }
+    }
+    footprints_.emplace_back(thread_id, std::make_unique<footprint_t>());
+    return footprints_.back().second.get();
+}
+
+void Ray::Cpu::TexPageCache::Read(uint64_t offset, void *out_data, size_t size) {
+    auto *out = reinterpret_cast<uint8_t *>(out_data);
+    while (size) {
+        const size_t chunk_size = std::min(size, size_t(PageSize - offset % PageSize));
+        memcpy(out, Get(offset), chunk_size);
+
+        out += chunk_size;
+        offset += chunk_size;
+        size -= chunk_size;
+    }
+}
+
+void Ray::Cpu::TexPageCache::TakeStats(uint64_t &out_hits, uint64_t &out_misses) {
+    std::lock_guard<std::mutex> _(footprints_mtx_);
+
+    // hits of pinned pages are counted by each thread separately
+    uint64_t pinned_hits = 0;
+    for (const auto &f : footprints_) {
+        pinned_hits += f.second->hits.load(std::memory_order_relaxed);
+    }
+
+    out_hits = hits_.exchange(0) + (pinned_hits - taken_hits_);
+    out_misses = misses_.exchange(0);
+    taken_hits_ = pinned_hits;
+}
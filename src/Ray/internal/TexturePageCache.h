@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "HashMap32.h"
+
+#ifdef __GNUC__
+#define force_inline __attribute__((always_inline)) inline
+#endif
+#ifdef _MSC_VER
+#define force_inline __forceinline
+#endif
+
+namespace Ray {
+namespace Cpu {
+// Keeps texture data in a backing file and only a limited set of recently used pages in memory
+class TexPageCache {
+  public:
+    static const uint32_t PageSize = 64 * 1024;
+
+  private:
+    static const uint32_t ShardsCount = 16;
+    static const uint32_t InvalidIndex = 0xffffffff;
+
+    enum class ePageState { Ready, Loading };
+
+    struct page_t {
+        uint32_t index = InvalidIndex; // page index in backing file
+        uint32_t prev = InvalidIndex, next = InvalidIndex;
+        ePageState state = ePageState::Ready;
+        std::shared_ptr<uint8_t> data; // also referenced by threads that pinned the page
+    };
+
+    // pages are spread across independently locked shards to reduce contention between threads
+    struct shard_t {
+        std::mutex mtx;
+        std::condition_variable loaded; // signaled when page finishes loading
+        HashMap32<uint32_t, uint32_t> slots; // page index -> slot index
+        std::vector<page_t> pages;
+        uint32_t head = InvalidIndex, tail = InvalidIndex; // most and least recently used pages
+        uint32_t max_pages = 0;
+        // memory of evicted pages (can still be pinned by other threads)
+        std::vector<std::shared_ptr<uint8_t>> spare_data;
+
+        void Unlink(uint32_t slot);
+        void PushFront(uint32_t slot);
+        void PushBack(uint32_t slot);
+        void Invalidate(uint32_t index);
+        uint32_t AllocSlot();
+        std::shared_ptr<uint8_t> AllocData();
+    };
+
+    // Pages recently used by a thread, they are accessed without locking
+    struct footprint_t {
+        static const int PagesCount = 4;
+
+        struct entry_t {
+            uint64_t epoch = 0;
+            uint32_t index = InvalidIndex;
+            std::shared_ptr<uint8_t> data;
+        };
+
+        entry_t entries[PagesCount];
+        uint32_t next = 0;
+        std::atomic<uint64_t> hits{0};
+    };
+
+    footprint_t &GetFootprint() {
+        // footprint is owned by the cache, thread only remembers where it is
+        struct local_t {
+            uint64_t cache_id = 0;
+            footprint_t *footprint = nullptr;
+        };
+        static thread_local local_t g_local[4];
+        static thread_local uint32_t g_local_next = 0;
+
+        for (const local_t &l : g_local) {
+            if (l.cache_id == id_) {
+                return *l.footprint;
+            }
+        }
+        local_t &l = g_local[g_local_next];
+        g_local_next = (g_local_next + 1) % 4;
+        l.cache_id = id_;
+        l.footprint = RegisterThread();
+        return *l.footprint;
+    }
+
+    // file space of freed data (sorted by offset)
+    struct extent_t {
+        uint64_t offset, size;
+    };
+
+    // unique among all caches, identifies thread footprints
+    const uint64_t id_;
+    shard_t shards_[ShardsCount];
+    // changes when file pages are reused, makes pages pinned by threads stale
+    std::atomic<uint64_t> epoch_{1};
+
+    std::mutex footprints_mtx_;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<footprint_t>>> footprints_;
+    uint64_t taken_hits_ = 0;
+
+    FILE *file_ = nullptr;
+    bool remove_file_ = false;
+    std::vector<char> file_path_;
+
+    std::mutex extents_mtx_;
+    uint64_t file_size_ = 0;
+    std::vector<extent_t> free_extents_;
+
+    std::atomic<uint64_t> hits_{0}, misses_{0};
+
+    size_t ReadAt(uint64_t offset, void *out_data, size_t size);
+    bool WriteAt(uint64_t offset, const void *data, size_t size);
+    void LoadPage(uint32_t index, uint8_t *out_data);
+    const uint8_t *PinPage(uint32_t index);
+    footprint_t *RegisterThread();
+
+  public:
+    // Backing file is created at given path (temporary file is used when path is not specified)
+    TexPageCache(size_t budget, const char *file_path);
+    ~TexPageCache();
+
+    TexPageCache(const TexPageCache &rhs) = delete;
+    TexPageCache &operator=(const TexPageCache &rhs) = delete;
+
+    bool ready() const { return file_ != nullptr; }
+    uint64_t file_size() const { return file_size_; }
+
+    // Stores data in backing file, returns its offset (always page-aligned)
+    uint64_t Write(const void *data, size_t size);
+    // Makes file space of previously written data available for reuse
+    void Free(uint64_t offset, size_t size);
+
+    // Returns pointer to data at given offset (valid until current thread pins PagesCount other pages), locking
+    // happens only if page is not pinned by current thread yet
+    force_inline const uint8_t *Get(const uint64_t offset) {
+        const auto index = uint32_t(offset / PageSize);
+        footprint_t &footprint = GetFootprint();
+        const uint64_t epoch = epoch_.load(std::memory_order_relaxed);
+        for (const footprint_t::entry_t &e : footprint.entries) {
+            if (e.index == index && e.epoch == epoch) {
+                // only owning thread writes the counter
+                footprint.hits.store(footprint.hits.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return e.data.get() + offset % PageSize;
+            }
+        }
+        return PinPage(index) + offset % PageSize;
+    }
+
+    // Copies data starting at given offset, missing pages are loaded from backing file
+    void Read(uint64_t offset, void *out_data, size_t size);
+
+    template <typename T> force_inline T Read(const uint64_t offset) {
+        T ret;
+        if (offset % PageSize + sizeof(T) <= PageSize) {
+            memcpy(&ret, Get(offset), sizeof(T));
+        } else {
+            Read(offset, &ret, sizeof(T));
+        }
+        return ret;
+    }
+
+    // Returns hit/miss counters accumulated since the last call
+    void TakeStats(uint64_t &out_hits, uint64_t &out_misses);
+};
+} // namespace Cpu
+} // namespace Ray
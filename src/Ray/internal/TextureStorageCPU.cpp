@@ -182,6 +182,8 @@ int Ray::Cpu::TexStorageTiled<T, N>::Allocate(Span<const ColorType> data, const
         }
     }
 
+    PageOut(p.pixels, total_size, p.paged_offset, p.paged_size);
+
     return index;
 }
 
@@ -196,6 +198,7 @@ template <typename T, int N> bool Ray::Cpu::TexStorageTiled<T, N>::Free(const in
     memset(images_[index].lod_offsets, 0, sizeof(images_[index].lod_offsets));
 #endif
 
+    PageFree(images_[index].paged_offset, images_[index].paged_size);
     images_[index].pixels = {};
     free_slots_.push_back(index);
 
@@ -283,6 +286,8 @@ int Ray::Cpu::TexStorageSwizzled<T, N>::Allocate(Span<const ColorType> data, con
         }
     }
 
+    PageOut(p.pixels, total_size, p.paged_offset, p.paged_size);
+
     return index;
 }
 
@@ -297,6 +302,7 @@ template <typename T, int N> bool Ray::Cpu::TexStorageSwizzled<T, N>::Free(const
     memset(images_[index].lod_offsets, 0, sizeof(images_[index].lod_offsets));
 #endif
 
+    PageFree(images_[index].paged_offset, images_[index].paged_size);
     images_[index].pixels = {};
     free_slots_.push_back(index);
 
@@ -413,6 +419,8 @@ int Ray::Cpu::TexStorageBCn<N>::Allocate(Span<const InColorType> data, const int
         std::swap(_src_data, dst_data);
     }
 
+    PageOut(p.pixels, total_size, p.paged_offset, p.paged_size);
+
     return index;
 }
 
@@ -473,9 +481,29 @@ int Ray::Cpu::TexStorageBCn<N>::AllocateRaw(Span<const uint8_t> data, const int
     }
     assert(offset == total_size);
 
+    PageOut(p.pixels, total_size, p.paged_offset, p.paged_size);
+
     return index;
 }
 
+template <int N> bool Ray::Cpu::TexStorageBCn<N>::Free(const int index) {
+    if (index < 0 || index > int(images_.size())) {
+        return false;
+    }
+
+#ifndef NDEBUG
+    memset(images_[index].res, 0, sizeof(images_[index].res));
+    memset(images_[index].res_in_tiles, 0, sizeof(images_[index].res_in_tiles));
+    memset(images_[index].lod_offsets, 0, sizeof(images_[index].lod_offsets));
+#endif
+
+    PageFree(images_[index].paged_offset, images_[index].paged_size);
+    images_[index].pixels = {};
+    free_slots_.push_back(index);
+
+    return true;
+}
+
 template class Ray::Cpu::TexStorageBCn<1>;
 template class Ray::Cpu::TexStorageBCn<2>;
 template class Ray::Cpu::TexStorageBCn<3>;
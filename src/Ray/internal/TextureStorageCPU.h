@@ -4,15 +4,44 @@
 #include <memory>
 
 #include "Core.h"
+#include "TexturePageCache.h"
 #include "TextureSplitter.h"
 #include "TextureUtils.h"
 
 namespace Ray {
 namespace Cpu {
 class TexStorageBase {
+  protected:
+    TexPageCache *page_cache_ = nullptr;
+
+    // Moves image data to page cache (data is left in memory if cache is not set or write fails)
+    template <typename T>
+    void PageOut(std::unique_ptr<T[]> &data, const size_t count, uint64_t &out_offset, size_t &out_size) {
+        if (!page_cache_) {
+            return;
+        }
+        const uint64_t offset = page_cache_->Write(data.get(), count * sizeof(T));
+        if (offset != 0xffffffffffffffff) {
+            out_offset = offset;
+            out_size = count * sizeof(T);
+            data = {};
+        }
+    }
+
+    // Returns file space of paged out image data
+    void PageFree(uint64_t offset, size_t &size) {
+        if (page_cache_ && size) {
+            page_cache_->Free(offset, size);
+            size = 0;
+        }
+    }
+
   public:
     virtual ~TexStorageBase() = default;
 
+    // Images allocated after this call will be paged from disk
+    void SetPageCache(TexPageCache *cache) { page_cache_ = cache; }
+
     virtual void GetIRes(int index, int lod, int res[2]) const = 0;
     virtual void GetFRes(int index, int lod, float res[2]) const = 0;
 
@@ -128,6 +157,8 @@ template <typename T, int N> class TexStorageTiled : public TexStorageBase {
         int res[NUM_MIP_LEVELS][2], res_in_tiles[NUM_MIP_LEVELS][2];
         int lod_offsets[NUM_MIP_LEVELS];
         std::unique_ptr<ColorType[]> pixels;
+        uint64_t paged_offset = 0; // used when pixels are not resident
+        size_t paged_size = 0;
     };
 
     std::vector<ImgData> images_;
@@ -146,8 +177,13 @@ template <typename T, int N> class TexStorageTiled : public TexStorageBase {
         const int in_tilex = x % TileSize, in_tiley = y % TileSize;
 
         const int w_in_tiles = p.res_in_tiles[lod][0];
-        return p.pixels[p.lod_offsets[lod] + (tiley * w_in_tiles + tilex) * TileSize * TileSize + in_tiley * TileSize +
-                        in_tilex];
+        const int offset =
+            p.lod_offsets[lod] + (tiley * w_in_tiles + tilex) * TileSize * TileSize + in_tiley * TileSize + in_tilex;
+        if (p.pixels) {
+            return p.pixels[offset];
+        }
+
+        return page_cache_->Read<ColorType>(p.paged_offset + uint64_t(offset) * sizeof(ColorType));
     }
 
     force_inline ColorType Get(const int index, float x, float y, const int lod) const {
@@ -228,6 +264,8 @@ template <typename T, int N> class TexStorageSwizzled : public TexStorageBase {
         int res[NUM_MIP_LEVELS][2], tile_y_stride[NUM_MIP_LEVELS];
         int lod_offsets[NUM_MIP_LEVELS];
         std::unique_ptr<ColorType[]> pixels;
+        uint64_t paged_offset = 0; // used when pixels are not resident
+        size_t paged_size = 0;
     };
 
     std::vector<ImgData> images_;
@@ -258,7 +296,12 @@ template <typename T, int N> class TexStorageSwizzled : public TexStorageBase {
         x %= p.res[lod][0];
         y %= p.res[lod][1];
 
-        return p.pixels[p.lod_offsets[lod] + EncodeSwizzle(x, y, p.tile_y_stride[lod])];
+        const uint32_t offset = p.lod_offsets[lod] + EncodeSwizzle(x, y, p.tile_y_stride[lod]);
+        if (p.pixels) {
+            return p.pixels[offset];
+        }
+
+        return page_cache_->Read<ColorType>(p.paged_offset + uint64_t(offset) * sizeof(ColorType));
     }
 
     force_inline ColorType Get(const int index, float x, float y, const int lod) const {
@@ -333,13 +376,65 @@ extern template class TexStorageSwizzled<uint8_t, 3>;
 extern template class TexStorageSwizzled<uint8_t, 2>;
 extern template class TexStorageSwizzled<uint8_t, 1>;
 
+// Per-thread set-associative cache of decoded 4x4 blocks (keyed by texture index and block offset)
 template <int N> struct BCCache {
-    int decoded_index = -1, decoded_block_offset = -1;
-    color_t<uint8_t, N> decoded_block[16];
+    static const int SetsCount = 16, WaysCount = 4;
+    static const int BlockSize = (N == 4)   ? BlockSize_BC3
+                                 : (N == 3) ? BlockSize_BC1
+                                 : (N == 2) ? BlockSize_BC5
+                                            : BlockSize_BC4;
+    // BC1 blocks are decoded with (unused) alpha channel
+    static const int DecodedChannels = (N == 3) ? 4 : N;
+
+    struct entry_t {
+        int index = -1, block_offset = -1;
+        uint32_t last_used = 0;
+        color_t<uint8_t, DecodedChannels> texels[16];
+    };
+
+    entry_t entries[SetsCount][WaysCount];
+    uint32_t use_counter = 0;
+    uint64_t hits = 0, misses = 0;
 
     void Invalidate() {
-        decoded_index = -1;
-        decoded_block_offset = -1;
+        for (entry_t(&set)[WaysCount] : entries) {
+            for (entry_t &e : set) {
+                e.index = e.block_offset = -1;
+                e.last_used = 0;
+            }
+        }
+        use_counter = 0;
+    }
+
+    // Returns true if block is already decoded, otherwise least recently used entry is reassigned and must be filled
+    force_inline bool Find(const int index, const int block_offset, entry_t *&out_entry) {
+        entry_t *set = entries[(uint32_t(block_offset / BlockSize) + uint32_t(index)) % SetsCount];
+
+        out_entry = &set[0];
+        for (int i = 0; i < WaysCount; ++i) {
+            if (set[i].index == index && set[i].block_offset == block_offset) {
+                set[i].last_used = ++use_counter;
+                out_entry = &set[i];
+                ++hits;
+                return true;
+            }
+            if (set[i].last_used < out_entry->last_used) {
+                out_entry = &set[i];
+            }
+        }
+
+        out_entry->index = index;
+        out_entry->block_offset = block_offset;
+        out_entry->last_used = ++use_counter;
+        ++misses;
+        return false;
+    }
+
+    // Returns hit/miss counters accumulated since the last call
+    void TakeStats(uint64_t &out_hits, uint64_t &out_misses) {
+        out_hits = hits;
+        out_misses = misses;
+        hits = misses = 0;
     }
 };
 
@@ -348,14 +443,23 @@ template <int N> BCCache<N> &get_per_thread_BCCache() {
     return g_block_cache;
 }
 
-force_inline int convert_bit_range(int c, int from_bits, int to_bits) {
-    int b = (1 << (from_bits - 1)) + c * ((1 << to_bits) - 1);
-    return (b + (b >> from_bits)) >> from_bits;
+inline void InvalidateBCCaches() {
+    get_per_thread_BCCache<1>().Invalidate();
+    get_per_thread_BCCache<2>().Invalidate();
+    get_per_thread_BCCache<3>().Invalidate();
+    get_per_thread_BCCache<4>().Invalidate();
 }
-force_inline void rgb_888_from_565(unsigned int c, int *r, int *g, int *b) {
-    *r = convert_bit_range((c >> 11) & 31, 5, 8);
-    *g = convert_bit_range((c >> 05) & 63, 6, 8);
-    *b = convert_bit_range((c >> 00) & 31, 5, 8);
+
+// Returns hit/miss counters of current thread caches accumulated since the last call
+inline void TakeBCCacheStats(uint64_t &out_hits, uint64_t &out_misses) {
+    uint64_t hits[4], misses[4];
+    get_per_thread_BCCache<1>().TakeStats(hits[0], misses[0]);
+    get_per_thread_BCCache<2>().TakeStats(hits[1], misses[1]);
+    get_per_thread_BCCache<3>().TakeStats(hits[2], misses[2]);
+    get_per_thread_BCCache<4>().TakeStats(hits[3], misses[3]);
+
+    out_hits = hits[0] + hits[1] + hits[2] + hits[3];
+    out_misses = misses[0] + misses[1] + misses[2] + misses[3];
 }
 
 template <int N> class TexStorageBCn : public TexStorageBase {
@@ -370,6 +474,8 @@ template <int N> class TexStorageBCn : public TexStorageBase {
         int res[NUM_MIP_LEVELS][2], res_in_tiles[NUM_MIP_LEVELS][2];
         int lod_offsets[NUM_MIP_LEVELS];
         std::unique_ptr<uint8_t[]> pixels;
+        uint64_t paged_offset = 0; // used when pixels are not resident
+        size_t paged_size = 0;
     };
 
     std::vector<ImgData> images_;
@@ -390,153 +496,31 @@ template <int N> class TexStorageBCn : public TexStorageBase {
         const int w_in_tiles = p.res_in_tiles[lod][0];
         const int block_offset = p.lod_offsets[lod] + (tiley * w_in_tiles + tilex) * BlockSizes[N - 1];
 
-        BCCache<N> &cache = get_per_thread_BCCache<N>();
-
-        if (index != cache.decoded_index || block_offset != cache.decoded_block_offset) {
-            const uint8_t *compressed_block = &p.pixels[block_offset];
+        typename BCCache<N>::entry_t *block;
+        if (!get_per_thread_BCCache<N>().Find(index, block_offset, block)) {
+            // blocks never cross page boundary
+            const uint8_t *compressed_block =
+                p.pixels ? &p.pixels[block_offset] : page_cache_->Get(p.paged_offset + block_offset);
 
+            uint8_t *decoded_block = &block->texels[0].v[0];
             if (N == 4) {
-                { // decode alpha
-                    uint8_t decode_data[8];
-                    decode_data[0] = compressed_block[0];
-                    decode_data[1] = compressed_block[1];
-
-                    // 6-step intermediate values
-                    decode_data[2] = (6 * decode_data[0] + 1 * decode_data[1]) / 7;
-                    decode_data[3] = (5 * decode_data[0] + 2 * decode_data[1]) / 7;
-                    decode_data[4] = (4 * decode_data[0] + 3 * decode_data[1]) / 7;
-                    decode_data[5] = (3 * decode_data[0] + 4 * decode_data[1]) / 7;
-                    decode_data[6] = (2 * decode_data[0] + 5 * decode_data[1]) / 7;
-                    decode_data[7] = (1 * decode_data[0] + 6 * decode_data[1]) / 7;
-
-                    int next_bit = 8 * 2;
-                    for (OutColorType &c : cache.decoded_block) {
-                        int idx = 0, bit;
-                        bit = (compressed_block[next_bit >> 3] >> (next_bit & 7)) & 1;
-                        idx += bit << 0;
-                        ++next_bit;
-                        bit = (compressed_block[next_bit >> 3] >> (next_bit & 7)) & 1;
-                        idx += bit << 1;
-                        ++next_bit;
-                        bit = (compressed_block[next_bit >> 3] >> (next_bit & 7)) & 1;
-                        idx += bit << 2;
-                        ++next_bit;
-
-                        c.v[3 % N] = decode_data[idx & 7];
-                    }
-                    compressed_block += BlockSize_BC4;
-                }
-                { // decode color
-                    // find the 2 primary colors
-                    const int c0 = compressed_block[0] + (compressed_block[1] << 8);
-                    const int c1 = compressed_block[2] + (compressed_block[3] << 8);
-                    int r, g, b;
-                    rgb_888_from_565(c0, &r, &g, &b);
-                    uint8_t decode_colors[4 * 3];
-                    decode_colors[0] = r;
-                    decode_colors[1] = g;
-                    decode_colors[2] = b;
-                    rgb_888_from_565(c1, &r, &g, &b);
-                    decode_colors[3] = r;
-                    decode_colors[4] = g;
-                    decode_colors[5] = b;
-                    //	Like DXT1, but no choicees:
-                    //	no alpha, 2 interpolated colors
-                    decode_colors[6] = (2 * decode_colors[0] + decode_colors[3]) / 3;
-                    decode_colors[7] = (2 * decode_colors[1] + decode_colors[4]) / 3;
-                    decode_colors[8] = (2 * decode_colors[2] + decode_colors[5]) / 3;
-                    decode_colors[9] = (decode_colors[0] + 2 * decode_colors[3]) / 3;
-                    decode_colors[10] = (decode_colors[1] + 2 * decode_colors[4]) / 3;
-                    decode_colors[11] = (decode_colors[2] + 2 * decode_colors[5]) / 3;
-                    //	decode the block
-                    int next_bit = 4 * 8;
-                    for (OutColorType &c : cache.decoded_block) {
-                        const int idx = ((compressed_block[next_bit >> 3] >> (next_bit & 7)) & 3) * 3;
-                        next_bit += 2;
-                        c.v[0 % N] = decode_colors[idx + 0];
-                        c.v[1 % N] = decode_colors[idx + 1];
-                        c.v[2 % N] = decode_colors[idx + 2];
-                    }
-                }
+                DecodeBlock_BC3(compressed_block, decoded_block);
             } else if (N == 3) {
-                // find the 2 primary colors
-                const int c0 = compressed_block[0] + (compressed_block[1] << 8);
-                const int c1 = compressed_block[2] + (compressed_block[3] << 8);
-                int r, g, b;
-                rgb_888_from_565(c0, &r, &g, &b);
-                uint8_t decode_colors[4 * 3];
-                decode_colors[0] = r;
-                decode_colors[1] = g;
-                decode_colors[2] = b;
-                rgb_888_from_565(c1, &r, &g, &b);
-                decode_colors[3] = r;
-                decode_colors[4] = g;
-                decode_colors[5] = b;
-                //	Like DXT1, but no choicees:
-                //	no alpha, 2 interpolated colors
-                decode_colors[6] = (2 * decode_colors[0] + decode_colors[3]) / 3;
-                decode_colors[7] = (2 * decode_colors[1] + decode_colors[4]) / 3;
-                decode_colors[8] = (2 * decode_colors[2] + decode_colors[5]) / 3;
-                decode_colors[9] = (decode_colors[0] + 2 * decode_colors[3]) / 3;
-                decode_colors[10] = (decode_colors[1] + 2 * decode_colors[4]) / 3;
-                decode_colors[11] = (decode_colors[2] + 2 * decode_colors[5]) / 3;
-                //	decode the block
-                int next_bit = 4 * 8;
-                for (OutColorType &c : cache.decoded_block) {
-                    const int idx = ((compressed_block[next_bit >> 3] >> (next_bit & 7)) & 3) * 3;
-                    next_bit += 2;
-                    c.v[0] = decode_colors[idx + 0];
-                    c.v[1] = decode_colors[idx + 1];
-                    c.v[2] = decode_colors[idx + 2];
-                }
+                DecodeBlock_BC1(compressed_block, decoded_block);
+            } else if (N == 2) {
+                DecodeBlock_BC5(compressed_block, decoded_block);
             } else {
-                for (int ch = 0; ch < N; ++ch) {
-                    uint8_t decode_data[8];
-                    decode_data[0] = compressed_block[0];
-                    decode_data[1] = compressed_block[1];
-
-                    if (decode_data[0] > decode_data[1]) {
-                        // 6-step intermediate values
-                        decode_data[2] = (6 * decode_data[0] + 1 * decode_data[1]) / 7;
-                        decode_data[3] = (5 * decode_data[0] + 2 * decode_data[1]) / 7;
-                        decode_data[4] = (4 * decode_data[0] + 3 * decode_data[1]) / 7;
-                        decode_data[5] = (3 * decode_data[0] + 4 * decode_data[1]) / 7;
-                        decode_data[6] = (2 * decode_data[0] + 5 * decode_data[1]) / 7;
-                        decode_data[7] = (1 * decode_data[0] + 6 * decode_data[1]) / 7;
-                    } else {
-                        // 4-step intermediate values + full and none
-                        decode_data[2] = (4 * decode_data[0] + 1 * decode_data[1]) / 5;
-                        decode_data[3] = (3 * decode_data[0] + 2 * decode_data[1]) / 5;
-                        decode_data[4] = (2 * decode_data[0] + 3 * decode_data[1]) / 5;
-                        decode_data[5] = (1 * decode_data[0] + 4 * decode_data[1]) / 5;
-                        decode_data[6] = 0;
-                        decode_data[7] = 255;
-                    }
-
-                    int next_bit = 8 * 2;
-                    for (OutColorType &c : cache.decoded_block) {
-                        int idx = 0, bit;
-                        bit = (compressed_block[next_bit >> 3] >> (next_bit & 7)) & 1;
-                        idx += bit << 0;
-                        ++next_bit;
-                        bit = (compressed_block[next_bit >> 3] >> (next_bit & 7)) & 1;
-                        idx += bit << 1;
-                        ++next_bit;
-                        bit = (compressed_block[next_bit >> 3] >> (next_bit & 7)) & 1;
-                        idx += bit << 2;
-                        ++next_bit;
-
-                        c.v[ch] = decode_data[idx & 7];
-                    }
-                    compressed_block += BlockSize_BC4;
-                }
+                DecodeBlock_BC4(compressed_block, decoded_block);
             }
-
-            cache.decoded_index = index;
-            cache.decoded_block_offset = block_offset;
         }
 
-        return cache.decoded_block[in_tiley * TileSize + in_tilex];
+        const auto &texel = block->texels[in_tiley * TileSize + in_tilex];
+
+        OutColorType ret;
+        for (int i = 0; i < N; ++i) {
+            ret.v[i] = texel.v[i];
+        }
+        return ret;
     }
 
     force_inline OutColorType Get(const int index, float x, float y, const int lod) const {
@@ -604,7 +588,7 @@ template <int N> class TexStorageBCn : public TexStorageBase {
 
     int Allocate(Span<const InColorType> data, const int res[2], bool mips);
     int AllocateRaw(Span<const uint8_t> data, const int res[2], int mips_count, bool flip_vertical, bool invert_green);
-    bool Free(int index) override { return true; }
+    bool Free(int index) override;
 };
 
 extern template class TexStorageBCn<1>;
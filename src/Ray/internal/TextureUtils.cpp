@@ -1019,8 +1019,171 @@ void Emit_BC4_Block_SSE2(uint8_t block[16], uint8_t *&out_data) {
     EmitAlphaOnlyIndices_SSE2(block, min_alpha, max_alpha, out_data);
 }
 #endif
+
+//
+// BCn decompression
+//
+
+force_inline int convert_bit_range(const int c, const int from_bits, const int to_bits) {
+    const int b = (1 << (from_bits - 1)) + c * ((1 << to_bits) - 1);
+    return (b + (b >> from_bits)) >> from_bits;
+}
+
+// Palette of 4 RGBA colors (alpha is set to 255)
+void DecodeColorPalette_BC1(const uint8_t block[BlockSize_BC1], uint8_t out_palette[16]) {
+    const int c0 = block[0] | (block[1] << 8), c1 = block[2] | (block[3] << 8);
+
+    out_palette[0] = uint8_t(convert_bit_range((c0 >> 11) & 31, 5, 8));
+    out_palette[1] = uint8_t(convert_bit_range((c0 >> 5) & 63, 6, 8));
+    out_palette[2] = uint8_t(convert_bit_range((c0 >> 0) & 31, 5, 8));
+    out_palette[4] = uint8_t(convert_bit_range((c1 >> 11) & 31, 5, 8));
+    out_palette[5] = uint8_t(convert_bit_range((c1 >> 5) & 63, 6, 8));
+    out_palette[6] = uint8_t(convert_bit_range((c1 >> 0) & 31, 5, 8));
+
+    // Like DXT1, but no choices: no alpha, 2 interpolated colors
+    for (int i = 0; i < 3; ++i) {
+        out_palette[8 + i] = uint8_t((2 * out_palette[i] + out_palette[4 + i]) / 3);
+        out_palette[12 + i] = uint8_t((out_palette[i] + 2 * out_palette[4 + i]) / 3);
+    }
+    out_palette[3] = out_palette[7] = out_palette[11] = out_palette[15] = 255;
+}
+
+// Palette of 8 single-channel values
+void DecodeAlphaPalette_BC4(const uint8_t block[BlockSize_BC4], uint8_t out_palette[8]) {
+    const int a0 = out_palette[0] = block[0];
+    const int a1 = out_palette[1] = block[1];
+
+    if (a0 > a1) {
+        // 6-step intermediate values
+        out_palette[2] = uint8_t((6 * a0 + 1 * a1) / 7);
+        out_palette[3] = uint8_t((5 * a0 + 2 * a1) / 7);
+        out_palette[4] = uint8_t((4 * a0 + 3 * a1) / 7);
+        out_palette[5] = uint8_t((3 * a0 + 4 * a1) / 7);
+        out_palette[6] = uint8_t((2 * a0 + 5 * a1) / 7);
+        out_palette[7] = uint8_t((1 * a0 + 6 * a1) / 7);
+    } else {
+        // 4-step intermediate values + full and none
+        out_palette[2] = uint8_t((4 * a0 + 1 * a1) / 5);
+        out_palette[3] = uint8_t((3 * a0 + 2 * a1) / 5);
+        out_palette[4] = uint8_t((2 * a0 + 3 * a1) / 5);
+        out_palette[5] = uint8_t((1 * a0 + 4 * a1) / 5);
+        out_palette[6] = 0;
+        out_palette[7] = 255;
+    }
+}
+
+void DecodeColorIndices_Ref(const uint8_t palette[16], const uint8_t indices[4], uint8_t out_rgba[64]) {
+    const uint32_t bits = uint32_t(indices[0]) | (uint32_t(indices[1]) << 8) | (uint32_t(indices[2]) << 16) |
+                          (uint32_t(indices[3]) << 24);
+    for (int i = 0; i < 16; ++i) {
+        memcpy(&out_rgba[4 * i], &palette[4 * ((bits >> (2 * i)) & 3)], 4);
+    }
+}
+
+void DecodeAlphaIndices_Ref(const uint8_t palette[8], const uint8_t indices[6], uint8_t out_alpha[],
+                            const int stride) {
+    uint64_t bits = 0;
+    for (int i = 0; i < 6; ++i) {
+        bits |= uint64_t(indices[i]) << (8 * i);
+    }
+    for (int i = 0; i < 16; ++i) {
+        out_alpha[i * stride] = palette[(bits >> (3 * i)) & 7];
+    }
+}
+
+void DecodeBlock_BC1_Ref(const uint8_t block[BlockSize_BC1], uint8_t out_rgba[64]) {
+    uint8_t palette[16];
+    DecodeColorPalette_BC1(block, palette);
+    DecodeColorIndices_Ref(palette, &block[4], out_rgba);
+}
+
+void DecodeBlock_BC3_Ref(const uint8_t block[BlockSize_BC3], uint8_t out_rgba[64]) {
+    DecodeBlock_BC1_Ref(&block[BlockSize_BC4], out_rgba);
+
+    uint8_t palette[8];
+    DecodeAlphaPalette_BC4(block, palette);
+    DecodeAlphaIndices_Ref(palette, &block[2], &out_rgba[3], 4);
+}
+
+void DecodeBlock_BC4_Ref(const uint8_t block[BlockSize_BC4], uint8_t out_r[16]) {
+    uint8_t palette[8];
+    DecodeAlphaPalette_BC4(block, palette);
+    DecodeAlphaIndices_Ref(palette, &block[2], out_r, 1);
+}
+
+void DecodeBlock_BC5_Ref(const uint8_t block[BlockSize_BC5], uint8_t out_rg[32]) {
+    for (int ch = 0; ch < 2; ++ch) {
+        uint8_t palette[8];
+        DecodeAlphaPalette_BC4(&block[ch * BlockSize_BC4], palette);
+        DecodeAlphaIndices_Ref(palette, &block[ch * BlockSize_BC4 + 2], &out_rg[ch], 2);
+    }
+}
+
+#if !defined(__ARM_NEON__) && !defined(__arm__) && !defined(__aarch64__) && !defined(_M_ARM) && !defined(_M_ARM64)
+void DecodeBlock_BC1_SSSE3(const uint8_t block[BlockSize_BC1], uint8_t out_rgba[64]);
+void DecodeBlock_BC3_SSSE3(const uint8_t block[BlockSize_BC3], uint8_t out_rgba[64]);
+void DecodeBlock_BC4_SSSE3(const uint8_t block[BlockSize_BC4], uint8_t out_r[16]);
+void DecodeBlock_BC5_SSSE3(const uint8_t block[BlockSize_BC5], uint8_t out_rg[32]);
+
+// Blocks are decoded on the fly during rendering, so features are queried only once
+bool IsSSSE3DecodeSupported() {
+    static const bool supported = []() {
+        const CpuFeatures cpu = GetCpuFeatures();
+        return cpu.sse2_supported && cpu.ssse3_supported;
+    }();
+    return supported;
+}
+#endif
 } // namespace Ray
 
+void Ray::DecodeBlock_BC1(const uint8_t block[BlockSize_BC1], uint8_t out_rgba[64]) {
+#if defined(__ARM_NEON__) || defined(__arm__) || defined(__aarch64__) || defined(_M_ARM) || defined(_M_ARM64)
+    DecodeBlock_BC1_Ref(block, out_rgba);
+#else
+    if (IsSSSE3DecodeSupported()) {
+        DecodeBlock_BC1_SSSE3(block, out_rgba);
+    } else {
+        DecodeBlock_BC1_Ref(block, out_rgba);
+    }
+#endif
+}
+
+void Ray::DecodeBlock_BC3(const uint8_t block[BlockSize_BC3], uint8_t out_rgba[64]) {
+#if defined(__ARM_NEON__) || defined(__arm__) || defined(__aarch64__) || defined(_M_ARM) || defined(_M_ARM64)
+    DecodeBlock_BC3_Ref(block, out_rgba);
+#else
+    if (IsSSSE3DecodeSupported()) {
+        DecodeBlock_BC3_SSSE3(block, out_rgba);
+    } else {
+        DecodeBlock_BC3_Ref(block, out_rgba);
+    }
+#endif
+}
+
+void Ray::DecodeBlock_BC4(const uint8_t block[BlockSize_BC4], uint8_t out_r[16]) {
+#if defined(__ARM_NEON__) || defined(__arm__) || defined(__aarch64__) || defined(_M_ARM) || defined(_M_ARM64)
+    DecodeBlock_BC4_Ref(block, out_r);
+#else
+    if (IsSSSE3DecodeSupported()) {
+        DecodeBlock_BC4_SSSE3(block, out_r);
+    } else {
+        DecodeBlock_BC4_Ref(block, out_r);
+    }
+#endif
+}
+
+void Ray::DecodeBlock_BC5(const uint8_t block[BlockSize_BC5], uint8_t out_rg[32]) {
+#if defined(__ARM_NEON__) || defined(__arm__) || defined(__aarch64__) || defined(_M_ARM) || defined(_M_ARM64)
+    DecodeBlock_BC5_Ref(block, out_rg);
+#else
+    if (IsSSSE3DecodeSupported()) {
+        DecodeBlock_BC5_SSSE3(block, out_rg);
+    } else {
+        DecodeBlock_BC5_Ref(block, out_rg);
+    }
+#endif
+}
+
 int Ray::GetRequiredMemory_BC1(const int w, const int h, const int pitch_align) {
     return round_up(BlockSize_BC1 * ((w + 3) / 4), pitch_align) * ((h + 3) / 4);
 }
@@ -91,6 +91,16 @@ void CompressImage_BC4(const uint8_t img_src[], int w, int h, uint8_t img_dst[],
 template <int SrcChannels = 2>
 void CompressImage_BC5(const uint8_t img_src[], int w, int h, uint8_t img_dst[], int dst_pitch = 0);
 
+//
+// BCn decompression (single 4x4 block)
+//
+
+// BC1 and BC3 blocks are decoded to RGBA (BC1 alpha is always 255), BC5 is decoded to interleaved RG
+void DecodeBlock_BC1(const uint8_t block[BlockSize_BC1], uint8_t out_rgba[64]);
+void DecodeBlock_BC3(const uint8_t block[BlockSize_BC3], uint8_t out_rgba[64]);
+void DecodeBlock_BC4(const uint8_t block[BlockSize_BC4], uint8_t out_r[16]);
+void DecodeBlock_BC5(const uint8_t block[BlockSize_BC5], uint8_t out_rg[32]);
+
 template <int N>
 int Preprocess_BCn(const uint8_t in_data[], int tiles_w, int tiles_h, bool flip_vertical, bool invert_green,
                    uint8_t out_data[], int out_pitch = 0);
@@ -608,6 +608,154 @@ void EmitAlphaOnlyIndices_SSE2(const uint8_t block[16], const uint8_t min_alpha,
     EmitAlphaIndicesInternal_SSE2(alpha, min_alpha, max_alpha, out_data);
 }
 
+//
+// BCn decompression
+//
+
+#ifdef __GNUC__
+#pragma GCC push_options
+#pragma GCC target("ssse3")
+#endif
+#ifdef __clang__
+#pragma clang attribute push(__attribute__((target("ssse3"))), apply_to = function)
+#endif
+
+// Expands 16 2-bit indices to bytes
+force_inline __m128i Unpack2BitIndices_SSE2(const uint8_t indices[4]) {
+    // multiplication moves index of each lane to the top bits
+    const __m128i mul = _mm_set_epi16(1 << 0, 1 << 2, 1 << 4, 1 << 6, 1 << 8, 1 << 10, 1 << 12, 1 << 14);
+
+    const __m128i lo = _mm_set1_epi16(short(indices[0] | (indices[1] << 8)));
+    const __m128i hi = _mm_set1_epi16(short(indices[2] | (indices[3] << 8)));
+
+    return _mm_packus_epi16(_mm_srli_epi16(_mm_mullo_epi16(lo, mul), 14),
+                            _mm_srli_epi16(_mm_mullo_epi16(hi, mul), 14));
+}
+
+// Expands 16 3-bit indices to bytes
+force_inline __m128i Unpack3BitIndices_SSE2(const uint8_t indices[6]) {
+    // lanes 0-4 take index from bits 0-15, lanes 5-7 take it from bits 8-23 (of 8 indices group),
+    // multiplication moves it to the top bits
+    const __m128i mul = _mm_set_epi16(1 << 0, 1 << 3, 1 << 6, 1 << 1, 1 << 4, 1 << 7, 1 << 10, 1 << 13);
+
+    const short lo0 = short(indices[0] | (indices[1] << 8)), hi0 = short(indices[1] | (indices[2] << 8));
+    const short lo1 = short(indices[3] | (indices[4] << 8)), hi1 = short(indices[4] | (indices[5] << 8));
+
+    const __m128i first = _mm_set_epi16(hi0, hi0, hi0, lo0, lo0, lo0, lo0, lo0);
+    const __m128i second = _mm_set_epi16(hi1, hi1, hi1, lo1, lo1, lo1, lo1, lo1);
+
+    return _mm_packus_epi16(_mm_srli_epi16(_mm_mullo_epi16(first, mul), 13),
+                            _mm_srli_epi16(_mm_mullo_epi16(second, mul), 13));
+}
+
+// Palette of 4 RGBA colors (alpha is set to 255)
+force_inline __m128i DecodeColorPalette_SSE2(const uint8_t block[BlockSize_BC1]) {
+    const int c0 = block[0] | (block[1] << 8), c1 = block[2] | (block[3] << 8);
+
+    // expand 565 endpoints to 888 (shifts by 5 and 6 are done with multiplication)
+    const __m128i bits = _mm_set_epi16(0, short(c1 & 31), short((c1 >> 5) & 63), short(c1 >> 11), //
+                                       0, short(c0 & 31), short((c0 >> 5) & 63), short(c0 >> 11));
+    const __m128i half = _mm_set_epi16(0, 1 << 4, 1 << 5, 1 << 4, 0, 1 << 4, 1 << 5, 1 << 4);
+    const __m128i shift = _mm_set_epi16(0, 1 << 11, 1 << 10, 1 << 11, 0, 1 << 11, 1 << 10, 1 << 11);
+
+    const __m128i b = _mm_add_epi16(half, _mm_mullo_epi16(bits, _mm_set1_epi16(255)));
+    __m128i endpoints = _mm_mulhi_epu16(_mm_add_epi16(b, _mm_mulhi_epu16(b, shift)), shift);
+    endpoints = _mm_or_si128(endpoints, _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0));
+
+    // Like DXT1, but no choices: no alpha, 2 interpolated colors (division by 3 is done with multiplication)
+    const __m128i swapped = _mm_shuffle_epi32(endpoints, _MM_SHUFFLE(1, 0, 3, 2));
+    const __m128i intermediate = _mm_mulhi_epu16(_mm_add_epi16(_mm_add_epi16(endpoints, endpoints), swapped),
+                                                 _mm_set1_epi16(21846));
+
+    return _mm_packus_epi16(endpoints, intermediate);
+}
+
+// Palette of 8 single-channel values (in lower half)
+force_inline __m128i DecodeAlphaPalette_SSE2(const uint8_t block[BlockSize_BC4]) {
+    const __m128i a0 = _mm_set1_epi16(block[0]), a1 = _mm_set1_epi16(block[1]);
+
+    // 6-step intermediate values (division by 7 is done with multiplication)
+    const __m128i w0_6 = _mm_set_epi16(1, 2, 3, 4, 5, 6, 0, 7), w1_6 = _mm_set_epi16(6, 5, 4, 3, 2, 1, 7, 0);
+    const __m128i palette6 = _mm_mulhi_epu16(
+        _mm_add_epi16(_mm_mullo_epi16(a0, w0_6), _mm_mullo_epi16(a1, w1_6)), _mm_set1_epi16(9363));
+
+    // 4-step intermediate values + full and none (division by 5 is done with multiplication)
+    const __m128i w0_4 = _mm_set_epi16(0, 0, 1, 2, 3, 4, 0, 5), w1_4 = _mm_set_epi16(0, 0, 4, 3, 2, 1, 5, 0);
+    __m128i palette4 = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(a0, w0_4), _mm_mullo_epi16(a1, w1_4)),
+                                       _mm_set1_epi16(13108));
+    palette4 = _mm_or_si128(palette4, _mm_set_epi16(255, 0, 0, 0, 0, 0, 0, 0));
+
+    const __m128i mode6 = _mm_cmpgt_epi16(a0, a1);
+    const __m128i palette = _mm_or_si128(_mm_and_si128(mode6, palette6), _mm_andnot_si128(mode6, palette4));
+
+    return _mm_packus_epi16(palette, palette);
+}
+
+force_inline __m128i DecodeAlphaBlock_SSSE3(const uint8_t block[BlockSize_BC4]) {
+    return _mm_shuffle_epi8(DecodeAlphaPalette_SSE2(block), Unpack3BitIndices_SSE2(&block[2]));
+}
+
+// 'channels' holds byte offsets of channels within palette entry (values with high bit set produce zero)
+force_inline void DecodeColorBlock_SSSE3(const uint8_t block[BlockSize_BC1], const __m128i channels,
+                                         __m128i out_rgba[4]) {
+    const __m128i colors = DecodeColorPalette_SSE2(block);
+
+    // byte offset of palette entry for each texel
+    const __m128i offsets = _mm_slli_epi16(Unpack2BitIndices_SSE2(&block[4]), 2);
+    const __m128i offsets_lo = _mm_unpacklo_epi8(offsets, offsets), offsets_hi = _mm_unpackhi_epi8(offsets, offsets);
+
+    out_rgba[0] = _mm_shuffle_epi8(colors, _mm_add_epi8(_mm_unpacklo_epi16(offsets_lo, offsets_lo), channels));
+    out_rgba[1] = _mm_shuffle_epi8(colors, _mm_add_epi8(_mm_unpackhi_epi16(offsets_lo, offsets_lo), channels));
+    out_rgba[2] = _mm_shuffle_epi8(colors, _mm_add_epi8(_mm_unpacklo_epi16(offsets_hi, offsets_hi), channels));
+    out_rgba[3] = _mm_shuffle_epi8(colors, _mm_add_epi8(_mm_unpackhi_epi16(offsets_hi, offsets_hi), channels));
+}
+
+void DecodeBlock_BC1_SSSE3(const uint8_t block[BlockSize_BC1], uint8_t out_rgba[64]) {
+    __m128i rgba[4];
+    DecodeColorBlock_SSSE3(block, _mm_set1_epi32(0x03020100), rgba);
+
+    for (int i = 0; i < 4; ++i) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&out_rgba[16 * i]), rgba[i]);
+    }
+}
+
+void DecodeBlock_BC3_SSSE3(const uint8_t block[BlockSize_BC3], uint8_t out_rgba[64]) {
+    // alpha channel is zeroed (and filled later)
+    __m128i rgba[4];
+    DecodeColorBlock_SSSE3(&block[BlockSize_BC4], _mm_set1_epi32(int(0x80020100)), rgba);
+
+    const __m128i alpha = DecodeAlphaBlock_SSSE3(block), zero = _mm_setzero_si128();
+    // move alpha to the highest byte of each texel
+    const __m128i alpha_lo = _mm_unpacklo_epi8(zero, alpha), alpha_hi = _mm_unpackhi_epi8(zero, alpha);
+
+    rgba[0] = _mm_or_si128(rgba[0], _mm_unpacklo_epi16(zero, alpha_lo));
+    rgba[1] = _mm_or_si128(rgba[1], _mm_unpackhi_epi16(zero, alpha_lo));
+    rgba[2] = _mm_or_si128(rgba[2], _mm_unpacklo_epi16(zero, alpha_hi));
+    rgba[3] = _mm_or_si128(rgba[3], _mm_unpackhi_epi16(zero, alpha_hi));
+
+    for (int i = 0; i < 4; ++i) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&out_rgba[16 * i]), rgba[i]);
+    }
+}
+
+void DecodeBlock_BC4_SSSE3(const uint8_t block[BlockSize_BC4], uint8_t out_r[16]) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out_r), DecodeAlphaBlock_SSSE3(block));
+}
+
+void DecodeBlock_BC5_SSSE3(const uint8_t block[BlockSize_BC5], uint8_t out_rg[32]) {
+    const __m128i r = DecodeAlphaBlock_SSSE3(block), g = DecodeAlphaBlock_SSSE3(&block[BlockSize_BC4]);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&out_rg[0]), _mm_unpacklo_epi8(r, g));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&out_rg[16]), _mm_unpackhi_epi8(r, g));
+}
+
+#ifdef __GNUC__
+#pragma GCC pop_options
+#endif
+#ifdef __clang__
+#pragma clang attribute pop
+#endif
+
 } // namespace Ray
 
 #undef _ABS
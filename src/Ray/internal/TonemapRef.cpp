@@ -61,4 +61,46 @@ Ray::Ref::fvec4 vectorcall Ray::Ref::TonemapFilmic(const eViewTransform view_tra
     cxxx.set<3>(color.get<3>());
 
     return cxxx;
-}
\ No newline at end of file
+}
+void Ray::Ref::ResolveRegion(const rect_t &rect, const int w, const int iteration, const float exposure,
+                             const float mix_factor, const float half_mix_factor, const bool accumulate_half,
+                             const eViewTransform view_transform, const float inv_gamma,
+                             const float variance_threshold, const color_rgba_t new_color[], color_rgba_t full_buf[],
+                             color_rgba_t half_buf[], color_rgba_t raw_filtered_buf[], color_rgba_t variance_buf[],
+                             color_rgba_t final_buf[], uint16_t required_samples[]) {
+    const tonemap_params_t tonemap_params = {view_transform, inv_gamma};
+    const fvec4 exposure4 = {exposure, exposure, exposure, 1.0f};
+
+    for (int y = rect.y; y < rect.y + rect.h; ++y) {
+        for (int x = rect.x; x < rect.x + rect.w; ++x) {
+            const int i = y * w + x;
+
+            fvec4 full_val = {full_buf[i].v, vector_aligned}, half_val = {half_buf[i].v, vector_aligned};
+            if (required_samples[i] >= iteration) {
+                const fvec4 new_val = fvec4{new_color[i].v, vector_aligned} * exposure4;
+                // accumulate full buffer
+                full_val += (new_val - full_val) * mix_factor;
+                full_val.store_to(full_buf[i].v, vector_aligned);
+                if (accumulate_half) {
+                    // accumulate half buffer
+                    half_val += (new_val - half_val) * half_mix_factor;
+                    half_val.store_to(half_buf[i].v, vector_aligned);
+                }
+            }
+
+            // Store as denosed result until DenoiseImage method will be called
+            full_val.store_to(raw_filtered_buf[i].v, vector_aligned);
+
+            const fvec4 p1 = reversible_tonemap(max(2.0f * full_val - half_val, 0.0f));
+            const fvec4 p2 = reversible_tonemap(half_val);
+            const fvec4 variance = 0.5f * (p1 - p2) * (p1 - p2);
+            variance.store_to(variance_buf[i].v, vector_aligned);
+
+            Tonemap(tonemap_params, full_val).store_to(final_buf[i].v, vector_aligned);
+
+            if (simd_cast(variance >= variance_threshold).not_all_zeros()) {
+                required_samples[i] = uint16_t(iteration + 1);
+            }
+        }
+    }
+}
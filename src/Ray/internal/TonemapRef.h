@@ -44,5 +44,12 @@ force_inline fvec4 vectorcall Tonemap(const tonemap_params_t &params, fvec4 c) {
 
     return saturate(c);
 }
+
+// Accumulation of new samples, variance estimation and tonemapping (fused into a single pass over region)
+void ResolveRegion(const rect_t &rect, int w, int iteration, float exposure, float mix_factor, float half_mix_factor,
+                   bool accumulate_half, eViewTransform view_transform, float inv_gamma, float variance_threshold,
+                   const color_rgba_t new_color[], color_rgba_t full_buf[], color_rgba_t half_buf[],
+                   color_rgba_t raw_filtered_buf[], color_rgba_t variance_buf[], color_rgba_t final_buf[],
+                   uint16_t required_samples[]);
 }
 }
\ No newline at end of file
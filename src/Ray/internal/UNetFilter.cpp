@@ -1,5 +1,6 @@
 #include "UNetFilter.h"
 
+#include <cmath>
 #include <cstring>
 
 #include <algorithm>
@@ -624,3 +625,60 @@ template int Ray::SetupUNetWeights<float>(bool gemm, int alignment, unet_weight_
                                           float out_weights[]);
 template int Ray::SetupUNetWeights<uint16_t>(bool gemm, int alignment, unet_weight_offsets_t *out_offsets,
                                              uint16_t out_weights[]);
+
+int Ray::QuantizeUNetWeights(const float weights[], const unet_weight_offsets_t &offsets, int8_t out_weights[],
+                             unet_weight_offsets_t *out_offsets, float out_biases[]) {
+    struct layer_t {
+        int unet_weight_offsets_t::*weight;
+        int unet_weight_offsets_t::*bias;
+        int in_channels, out_channels;
+    };
+    static const layer_t layers[] = {
+        {&unet_weight_offsets_t::enc_conv0_weight, &unet_weight_offsets_t::enc_conv0_bias, 9, 32},
+        {&unet_weight_offsets_t::enc_conv1_weight, &unet_weight_offsets_t::enc_conv1_bias, 32, 32},
+        {&unet_weight_offsets_t::enc_conv2_weight, &unet_weight_offsets_t::enc_conv2_bias, 32, 48},
+        {&unet_weight_offsets_t::enc_conv3_weight, &unet_weight_offsets_t::enc_conv3_bias, 48, 64},
+        {&unet_weight_offsets_t::enc_conv4_weight, &unet_weight_offsets_t::enc_conv4_bias, 64, 80},
+        {&unet_weight_offsets_t::enc_conv5a_weight, &unet_weight_offsets_t::enc_conv5a_bias, 80, 96},
+        {&unet_weight_offsets_t::enc_conv5b_weight, &unet_weight_offsets_t::enc_conv5b_bias, 96, 96},
+        {&unet_weight_offsets_t::dec_conv4a_weight, &unet_weight_offsets_t::dec_conv4a_bias, 96 + 64, 112},
+        {&unet_weight_offsets_t::dec_conv4b_weight, &unet_weight_offsets_t::dec_conv4b_bias, 112, 112},
+        {&unet_weight_offsets_t::dec_conv3a_weight, &unet_weight_offsets_t::dec_conv3a_bias, 112 + 48, 96},
+        {&unet_weight_offsets_t::dec_conv3b_weight, &unet_weight_offsets_t::dec_conv3b_bias, 96, 96},
+        {&unet_weight_offsets_t::dec_conv2a_weight, &unet_weight_offsets_t::dec_conv2a_bias, 96 + 32, 64},
+        {&unet_weight_offsets_t::dec_conv2b_weight, &unet_weight_offsets_t::dec_conv2b_bias, 64, 64},
+        {&unet_weight_offsets_t::dec_conv1a_weight, &unet_weight_offsets_t::dec_conv1a_bias, 64 + 9, 64},
+        {&unet_weight_offsets_t::dec_conv1b_weight, &unet_weight_offsets_t::dec_conv1b_bias, 64, 32},
+        {&unet_weight_offsets_t::dec_conv0_weight, &unet_weight_offsets_t::dec_conv0_bias, 32, 3}};
+
+    int biases_count = 0;
+    for (const layer_t &l : layers) {
+        if (out_offsets) {
+            out_offsets->*l.weight = offsets.*l.weight;
+            out_offsets->*l.bias = biases_count;
+        }
+        if (out_weights && out_biases) {
+            // weights of each output channel are stored contiguously
+            const int per_output = 9 * l.in_channels;
+            for (int i = 0; i < l.out_channels; ++i) {
+                const float *src = &weights[offsets.*l.weight + i * per_output];
+                int8_t *dst = &out_weights[offsets.*l.weight + i * per_output];
+
+                float max_abs = 0.0f;
+                for (int j = 0; j < per_output; ++j) {
+                    max_abs = std::max(max_abs, std::abs(src[j]));
+                }
+                const float scale = (max_abs > 0.0f) ? (max_abs / 127.0f) : 1.0f;
+                for (int j = 0; j < per_output; ++j) {
+                    dst[j] = int8_t(std::lround(src[j] / scale));
+                }
+
+                out_biases[biases_count + i] = weights[offsets.*l.bias + i];
+                out_biases[biases_count + l.out_channels + i] = scale;
+            }
+        }
+        biases_count += 2 * l.out_channels;
+    }
+
+    return biases_count;
+}
@@ -47,4 +47,10 @@ int SetupUNetFilter(int w, int h, bool alias_memory, bool round_w, unet_filter_t
 
 template <typename T>
 int SetupUNetWeights(bool gemm, int alignment, unet_weight_offsets_t *out_offsets, T out_weights[]);
+
+// Quantizes weights prepared by SetupUNetWeights (gemm layout, alignment 1) to int8 with symmetric per output channel
+// scales. Weights keep their offsets, biases of each layer are written to out_biases followed by its scales.
+// Returns number of elements written to out_biases.
+int QuantizeUNetWeights(const float weights[], const unet_weight_offsets_t &offsets, int8_t out_weights[],
+                        unet_weight_offsets_t *out_offsets, float out_biases[]);
 } // namespace Ray
\ No newline at end of file
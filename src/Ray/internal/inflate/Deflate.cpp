@@ -0,0 +1,185 @@
+#include "Deflate.h"
+
+#include <algorithm>
+
+// https://www.rfc-editor.org/rfc/rfc1951.html
+
+namespace Ray {
+namespace {
+const int MinMatchLen = 3;
+const int MaxMatchLen = 258;
+const int WindowSize = 32768;
+const int HashBits = 15;
+const int MaxChainLength = 32;
+
+const uint16_t MatchLenBase[29] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                   31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const uint8_t MatchLenExtraBits[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                       2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const uint16_t OffsetBase[30] = {1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+                                 33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+                                 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+const uint8_t OffsetExtraBits[30] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                     6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+class BitWriter {
+    std::vector<uint8_t> &out_;
+    uint64_t bits_ = 0;
+    int bits_count_ = 0;
+
+  public:
+    explicit BitWriter(std::vector<uint8_t> &out) : out_(out) {}
+
+    // Values are packed starting from the least significant bit
+    void PutBits(const uint32_t value, const int n) {
+        bits_ |= uint64_t(value) << bits_count_;
+        bits_count_ += n;
+        while (bits_count_ >= 8) {
+            out_.push_back(uint8_t(bits_ & 0xff));
+            bits_ >>= 8;
+            bits_count_ -= 8;
+        }
+    }
+
+    // Huffman codes are packed starting from the most significant bit
+    void PutCode(const uint32_t code, const int n) {
+        uint32_t reversed = 0;
+        for (int i = 0; i < n; ++i) {
+            reversed |= ((code >> i) & 1u) << (n - 1 - i);
+        }
+        PutBits(reversed, n);
+    }
+
+    void Flush() {
+        if (bits_count_) {
+            PutBits(0, 8 - bits_count_);
+        }
+    }
+};
+
+void PutLiteral(BitWriter &writer, const uint32_t sym) {
+    // fixed Huffman code lengths
+    if (sym < 144) {
+        writer.PutCode(0x30 + sym, 8);
+    } else if (sym < 256) {
+        writer.PutCode(0x190 + (sym - 144), 9);
+    } else if (sym < 280) {
+        writer.PutCode(sym - 256, 7);
+    } else {
+        writer.PutCode(0xc0 + (sym - 280), 8);
+    }
+}
+
+void PutMatch(BitWriter &writer, const int len, const int offset) {
+    int len_sym = 28;
+    while (MatchLenBase[len_sym] > len) {
+        --len_sym;
+    }
+    PutLiteral(writer, 257 + len_sym);
+    writer.PutBits(len - MatchLenBase[len_sym], MatchLenExtraBits[len_sym]);
+
+    int offset_sym = 29;
+    while (OffsetBase[offset_sym] > offset) {
+        --offset_sym;
+    }
+    writer.PutCode(offset_sym, 5);
+    writer.PutBits(offset - OffsetBase[offset_sym], OffsetExtraBits[offset_sym]);
+}
+
+uint32_t Hash3(const uint8_t *p) {
+    const uint32_t v = uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16);
+    return (v * 2654435761u) >> (32 - HashBits);
+}
+
+uint32_t Adler32(Span<const uint8_t> data) {
+    uint32_t a = 1, b = 0;
+    for (ptrdiff_t i = 0; i < data.size();) {
+        // largest block that can not overflow
+        const ptrdiff_t end = std::min(i + 5552, data.size());
+        for (; i < end; ++i) {
+            a += data[i];
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+} // namespace
+} // namespace Ray
+
+void Ray::Deflate(Span<const uint8_t> data, std::vector<uint8_t> &out_data) {
+    out_data.clear();
+    out_data.reserve(data.size() / 2 + 16);
+
+    // zlib header (deflate, 32K window, default compression)
+    out_data.push_back(0x78);
+    out_data.push_back(0x9c);
+
+    BitWriter writer(out_data);
+    // single final block with fixed Huffman codes
+    writer.PutBits(1, 1);
+    writer.PutBits(0b01, 2);
+
+    std::vector<int> head(1 << HashBits, -1), prev(WindowSize, -1);
+    auto insert_hash = [&](const int pos) {
+        const uint32_t h = Hash3(&data[pos]);
+        prev[pos % WindowSize] = head[h];
+        head[h] = pos;
+    };
+
+    const int size = int(data.size());
+    int pos = 0;
+    while (pos < size) {
+        int best_len = 0, best_offset = 0;
+        if (pos + MinMatchLen <= size) {
+            const int max_len = std::min(MaxMatchLen, size - pos);
+
+            int candidate = head[Hash3(&data[pos])];
+            for (int i = 0; i < MaxChainLength && candidate >= 0 && pos - candidate <= WindowSize; ++i) {
+                int len = 0;
+                while (len < max_len && data[candidate + len] == data[pos + len]) {
+                    ++len;
+                }
+                if (len > best_len) {
+                    best_len = len;
+                    best_offset = pos - candidate;
+                    if (len == max_len) {
+                        break;
+                    }
+                }
+                const int next = prev[candidate % WindowSize];
+                if (next >= candidate) {
+                    // slot was reused by newer position
+                    break;
+                }
+                candidate = next;
+            }
+        }
+
+        if (best_len >= MinMatchLen) {
+            PutMatch(writer, best_len, best_offset);
+            for (int i = 0; i < best_len; ++i, ++pos) {
+                if (pos + MinMatchLen <= size) {
+                    insert_hash(pos);
+                }
+            }
+        } else {
+            PutLiteral(writer, data[pos]);
+            if (pos + MinMatchLen <= size) {
+                insert_hash(pos);
+            }
+            ++pos;
+        }
+    }
+
+    // end of block
+    PutLiteral(writer, 256);
+    writer.Flush();
+
+    const uint32_t checksum = Adler32(data);
+    out_data.push_back(uint8_t(checksum >> 24));
+    out_data.push_back(uint8_t(checksum >> 16));
+    out_data.push_back(uint8_t(checksum >> 8));
+    out_data.push_back(uint8_t(checksum));
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+#include <vector>
+
+#include "../../Span.h"
+
+namespace Ray {
+// Compresses data into zlib stream (LZ77 with fixed Huffman codes only), output can be decoded with Inflater
+void Deflate(Span<const uint8_t> data, std::vector<uint8_t> &out_data);
+
+inline std::vector<uint8_t> Deflate(Span<const uint8_t> data) {
+    std::vector<uint8_t> ret;
+    Deflate(data, ret);
+    return ret;
+}
+} // namespace Ray
@@ -0,0 +1,4 @@
+extern const int NOISE_3D_RES = 32;
+extern const uint8_t __3d_noise_tex[32768] = {
+68, 32, 130, 60, 253, 230, 241, 194, 107, 48, 249, 14, 199, 221, 1, 228, 136, 117, 52, 162, 15, 11, 13, 4, 195, 110, 216, 14, 113, 224, 253, 119, 176, 118, 112, 235, 148, 11, 213, 51, 95, 151, 61, 170, 216, 97, 155, 145, 255, 201, 17, 245, 124, 206, 212, 88, 187, 191, 44, 224, 55, 83, 201, 189, 250, 15, 240, 22, 157, 201, 87, 86, 116, 6, 102, 118, 207, 176, 180, 235, 137, 2, 196, 66, 105, 218, 28, 246, 186, 102, 211, 248, 182, 212, 177, 0, 169, 234, 14, 117, 90, 92, 46, 130, 16, 36, 42, 8, 231, 7, 143, 127, 137, 56, 94, 176, 148, 35, 85, 81, 130, 86, 139, 150, 232, 164, 254, 242, 58, 12, 159, 197, 175, 215, 96, 132, 55, 129, 107, 221, 10, 115, 9, 203, 74, 18, 82, 228, 218, 112, 230, 114, 15, 202, 164, 218, 30, 152, 64, 108, 24, 156, 36, 39, 158, 152, 81, 213, 129, 66, 4, 19, 111, 235, 87, 19, 193, 102, 177, 50, 105, 221, 99, 252, 53, 199, 151, 255, 8, 166, 205, 144, 9, 80, 102, 167, 69, 173, 219, 109, 136, 49, 194, 176, 248, 120, 33, 20, 43, 68, 86, 85, 109, 137, 170, 130, 188, 173, 174, 58, 149, 120, 250, 69, 53, 164, 20, 208, 37, 194, 75, 64, 174, 58, 193, 39, 114, 41, 136, 186, 151, 58, 234, 141, 55, 23, 151, 6, 7, 46, 211, 58, 20, 96, 122, 215, 82, 59, 230, 85, 123, 81, 52, 222, 193, 150, 129, 244, 161, 51, 106, 162, 20, 13, 5, 151, 163, 230, 200, 160, 204, 32, 32, 162, 233, 57, 128, 110, 240, 182, 132, 93, 106, 157, 101, 126, 184, 41, 143, 45, 229, 46, 173, 116, 199, 157, 21, 167, 95, 162, 155, 125, 171, 51, 47, 125, 112, 10, 124, 205, 37, 137, 36, 38, 11, 5, 148, 183, 252, 240, 78, 51, 167, 39, 88, 91, 76, 72, 163, 156, 54, 150, 64, 105, 72, 16, 161, 105, 91, 153, 221, 80, 24, 126, 129, 32, 228, 220, 128, 224, 232, 5, 202, 173, 87, 132, 248, 12, 213, 9, 31, 181, 70, 64, 70, 132, 141, 203, 205, 88, 45, 119, 248, 3, 90, 162, 224, 115, 122, 160, 253, 245, 115, 211, 172, 140, 112, 24, 36, 188, 81, 104, 159, 152, 153, 190, 84, 237, 43, 63, 193, 90, 79, 128, 218, 111, 26, 253, 201, 178, 196, 84, 20, 46, 130, 51, 136, 42, 71, 41, 227, 123, 195, 221, 203, 84, 166, 224, 64, 249, 108, 61, 220, 209, 60, 151, 142, 127, 193, 2, 97, 224, 10, 15, 124, 133, 105, 88, 145, 75, 102, 139, 159, 128, 228, 86, 182, 251, 215, 62, 106, 196, 104, 145, 55, 12, 60, 6, 151, 69, 38, 191, 159, 223, 182, 165, 0, 63, 226, 230, 179, 156, 204, 173, 252, 57, 193, 195, 104, 1, 142, 101, 236, 209, 156, 87, 230, 101, 184, 1, 199, 218, 207, 172, 34, 252, 126, 148, 10, 208, 79, 203, 138, 91, 37, 5, 178, 135, 210, 155, 77, 236, 132, 248, 86, 239, 23, 138, 50, 216, 35, 181, 34, 226, 10, 84, 82, 47, 205, 141, 155, 106, 106, 121, 170, 137, 35, 38, 188, 239, 25, 86, 152, 138, 182, 118, 200, 204, 88, 247, 132, 168, 113, 132, 125, 15, 206, 162, 221, 127, 137, 97, 37, 84, 227, 75, 134, 235, 83, 70, 70, 225, 184, 158, 205, 123, 59, 105, 156, 34, 54, 116, 203, 164, 252, 51, 95, 23, 28, 11, 110, 17, 253, 226, 175, 140, 60, 88, 48, 113, 204, 119, 253, 230, 193, 86, 118, 120, 145, 236, 199, 108, 231, 132, 169, 254, 56, 109, 40, 23, 7, 2, 245, 163, 196, 147, 100, 204, 81, 77, 15, 7, 198, 74, 29, 194, 130, 66, 40, 236, 155, 7, 18, 31, 66, 21, 140, 60, 221, 46, 97, 14, 255, 66, 142, 98, 229, 199, 168, 137, 133, 124, 125, 30, 89, 179, 219, 31, 180, 211, 102, 217, 35, 136, 37, 128, 90, 49, 77, 30, 104, 219, 22, 27, 46, 240, 189, 50, 160, 20, 64, 16, 226, 65, 202, 228, 12, 138, 46, 128, 166, 43, 154, 17, 196, 29, 133, 160, 66, 133, 194, 59, 155, 48, 217, 125, 105, 169, 173, 200, 246, 53, 66, 229, 15, 149, 80, 102, 189, 199, 166, 49, 209, 176, 64, 33, 22, 153, 160, 213, 152, 163, 180, 139, 166, 4, 62, 76, 162, 166, 167, 35, 231, 143, 245, 232, 186, 194, 40, 28, 68, 24, 251, 128, 125, 173, 185, 189, 206, 157, 237, 174, 85, 14, 75, 128, 113, 68, 57, 94, 210, 25, 50, 136, 54, 104, 133, 34, 40, 37, 111, 88, 221, 11, 188, 249, 145, 112, 102, 252, 120, 217, 231, 187, 96, 246, 37, 131, 208, 103, 4, 194, 249, 39, 206, 217, 20, 180, 234, 3, 97, 153, 2, 61, 154, 161, 144, 210, 209, 157, 231, 154, 67, 227, 71, 83, 129, 4, 217, 18, 188, 215, 205, 144, 9, 46, 46, 2, 196, 137, 237, 139, 190, 246, 172, 198, 233, 59, 247, 181, 74, 212, 75, 9, 88, 133, 188, 65, 147, 211, 132, 147, 215, 140, 221, 171, 248, 110, 251, 205, 217, 46, 32, 66, 105, 76, 117, 13, 52, 129, 79, 245, 50, 204, 95, 1, 45, 218, 26, 111, 216, 177, 24, 52, 214, 60, 135, 142, 91, 245, 24, 109, 44, 199, 63, 229, 150, 254, 201, 59, 245, 54, 76, 197, 103, 85, 131, 213, 147, 252, 109, 172, 248, 52, 4, 177, 136, 28, 225, 153, 51, 117, 140, 138, 126, 210, 75, 66, 131, 99, 208, 29, 76, 211, 138, 143, 245, 156, 136, 251, 109, 255, 188, 240, 123, 173, 90, 92, 230, 76, 29, 166, 69, 109, 161, 252, 245, 168, 60, 65, 71, 131, 115, 45, 25, 88, 59, 115, 102, 157, 216, 167, 2, 10, 156, 112, 43, 114, 143, 174, 137, 194, 11, 62, 168, 177, 71, 58, 128, 73, 21, 177, 39, 47, 52, 153, 162, 127, 137, 25, 185, 15, 40, 71, 204, 190, 123, 48, 168, 140, 4, 164, 57, 180, 64, 138, 207, 46, 243, 214, 201, 154, 112, 154, 68, 27, 56, 89, 123, 110, 222, 140, 10, 128, 138, 134, 242, 64, 206, 53, 191, 35, 185, 15, 157, 228, 67, 79, 38, 72, 110, 247, 171, 186, 149, 81, 79, 195, 225, 207, 60, 74, 138, 151, 4, 4, 67, 194, 51, 235, 15, 221, 216, 141, 189, 209, 207, 236, 27, 50, 241, 19, 0, 21, 56, 71, 182, 138, 182, 242, 125, 122, 54, 183, 81, 59, 20, 160, 216, 177, 129, 28, 222, 212, 192, 183, 150, 174, 225, 121, 73, 28, 174, 58, 88, 249, 174, 62, 11, 245, 107, 196, 89, 203, 116, 51, 127, 171, 168, 125, 236, 241, 189, 252, 99, 221, 225, 204, 61, 249, 136, 64, 76, 6, 192, 212, 55, 13, 38, 93, 234, 193, 147, 79, 78, 54, 130, 9, 237, 203, 116, 200, 2, 127, 216, 81, 91, 175, 122, 38, 82, 89, 192, 11, 111, 218, 120, 20, 97, 39, 126, 203, 238, 60, 24, 198, 45, 48, 245, 23, 122, 6, 10, 159, 238, 142, 212, 85, 68, 162, 229, 213, 85, 202, 199, 102, 253, 142, 184, 77, 132, 143, 89, 42, 184, 172, 73, 132, 130, 129, 178, 196, 142, 239, 6, 76, 66, 129, 115, 100, 36, 101, 219, 122, 71, 235, 200, 100, 42, 39, 78, 29, 15, 207, 195, 213, 70, 66, 37, 123, 195, 71, 146, 103, 203, 182, 91, 115, 152, 73, 178, 251, 149, 45, 153, 106, 237, 11, 148, 52, 190, 227, 130, 29, 26, 161, 81, 67, 52, 57, 222, 125, 106, 203, 62, 108, 196, 68, 130, 1, 61, 103, 193, 246, 118, 137, 19, 85, 119, 210, 140, 215, 204, 139, 252, 50, 66, 95, 8, 232, 22, 250, 109, 201, 172, 124, 48, 39, 21, 216, 226, 96, 88, 97, 197, 184, 100, 119, 184, 33, 174, 26, 234, 22, 90, 75, 146, 240, 22, 33, 202, 47, 204, 154, 201, 137, 180, 240, 25, 244, 8, 218, 155, 162, 76, 142, 33, 184, 212, 200, 12, 58, 18, 7, 51, 170, 172, 188, 17, 189, 37, 248, 42, 228, 171, 1, 82, 166, 184, 109, 74, 75, 55, 206, 162, 215, 184, 174, 133, 188, 19, 32, 126, 135, 203, 145, 42, 38, 87, 136, 211, 42, 64, 144, 134, 120, 107, 50, 141, 245, 24, 154, 104, 38, 161, 173, 151, 68, 18, 226, 186, 19, 14, 161, 213, 83, 20, 217, 94, 101, 119, 58, 66, 62, 136, 234, 100, 28, 184, 233, 171, 181, 112, 4, 7, 250, 16, 84, 129, 20, 4, 117, 43, 88, 17, 102, 107, 226, 147, 124, 251, 190, 166, 200, 37, 99, 92, 96, 152, 218, 242, 186, 11, 249, 10, 53, 221, 175, 173, 37, 215, 99, 253, 244, 230, 241, 84, 137, 154, 202, 132, 130, 158, 7, 23, 234, 234, 182, 118, 227, 107, 243, 171, 74, 196, 223, 27, 56, 182, 4, 130, 27, 156, 193, 7, 166, 173, 158, 25, 106, 41, 168, 61, 33, 65, 150, 209, 174, 119, 13, 93, 187, 154, 150, 193, 215, 236, 37, 101, 208, 118, 21, 123, 114, 124, 202, 194, 107, 77, 153, 184, 0, 157, 227, 254, 87, 74, 15, 189, 223, 175, 250, 162, 57, 149, 141, 219, 5, 159, 44, 251, 58, 112, 135, 223, 190, 118, 27, 52, 83, 66, 149, 24, 34, 111, 1, 31, 216, 10, 33, 28, 4, 17, 173, 170, 9, 4, 108, 240, 102, 136, 151, 128, 119, 93, 107, 200, 30, 122, 231, 18, 169, 167, 208, 61, 8, 94, 47, 94, 111, 115, 90, 155, 50, 30, 160, 74, 32, 226, 76, 118, 22, 146, 176, 29, 45, 226, 102, 116, 94, 61, 29, 103, 27, 59, 44, 112, 146, 129, 216, 127, 16, 128, 99, 166, 179, 182, 232, 195, 197, 45, 218, 125, 250, 175, 91, 58, 122, 37, 223, 141, 155, 171, 189, 209, 233, 186, 180, 161, 202, 241, 8, 189, 65, 154, 86, 154, 64, 76, 85, 234, 77, 69, 82, 40, 129, 120, 182, 161, 87, 141, 242, 158, 39, 219, 78, 180, 230, 55, 79, 161, 35, 95, 245, 17, 23, 98, 182, 187, 181, 191, 175, 61, 94, 192, 16, 138, 107, 31, 126, 155, 167, 206, 125, 184, 25, 118, 148, 3, 100, 49, 69, 114, 188, 136, 72, 83, 116, 38, 159, 221, 224, 243, 93, 182, 100, 221, 37, 141, 105, 117, 72, 68, 106, 10, 83, 248, 185, 94, 25, 184, 42, 121, 108, 44, 225, 100, 175, 84, 9, 111, 161, 245, 18, 26, 187, 255, 178, 69, 249, 34, 163, 159, 162, 45, 246, 173, 212, 36, 134, 32, 165, 9, 92, 167, 115, 160, 134, 129, 156, 249, 212, 6, 150, 83, 148, 24, 59, 220, 220, 111, 142, 182, 253, 144, 131, 88, 165, 73, 180, 48, 203, 182, 98, 202, 230, 76, 246, 124, 19, 126, 40, 36, 19, 241, 247, 167, 87, 254, 203, 6, 197, 230, 84, 191, 26, 188, 180, 224, 121, 155, 45, 226, 182, 99, 82, 68, 226, 23, 186, 172, 88, 251, 244, 4, 119, 30, 227, 83, 106, 204, 238, 63, 161, 134, 70, 86, 168, 67, 92, 157, 119, 218, 239, 234, 159, 86, 158, 105, 144, 79, 3, 174, 60, 217, 194, 91, 225, 230, 226, 186, 105, 27, 43, 54, 49, 198, 70, 227, 203, 93, 243, 229, 18, 99, 230, 250, 199, 148, 178, 88, 139, 92, 14, 31, 33, 117, 228, 163, 226, 171, 52, 198, 27, 239, 142, 209, 238, 169, 49, 84, 205, 218, 244, 76, 163, 74, 179, 70, 99, 115, 110, 232, 79, 52, 52, 217, 26, 232, 77, 191, 164, 143, 203, 7, 198, 249, 228, 154, 155, 198, 160, 148, 89, 51, 250, 92, 228, 78, 234, 54, 63, 163, 161, 253, 174, 163, 236, 165, 248, 201, 111, 85, 123, 102, 125, 26, 164, 31, 168, 214, 15, 176, 184, 185, 209, 107, 147, 114, 160, 203, 196, 89, 4, 199, 179, 113, 119, 33, 163, 196, 104, 150, 49, 222, 2, 179, 47, 208, 78, 57, 91, 174, 73, 192, 223, 166, 141, 106, 99, 81, 84, 82, 75, 61, 226, 66, 220, 68, 170, 162, 70, 10, 183, 89, 115, 120, 254, 250, 17, 45, 68, 240, 73, 107, 184, 70, 143, 178, 33, 196, 243, 15, 236, 100, 123, 105, 2, 155, 21, 136, 96, 36, 54, 56, 204, 169, 53, 228, 247, 143, 73, 220, 190, 178, 196, 210, 223, 188, 105, 100, 33, 74, 121, 122, 10, 123, 201, 233, 225, 48, 27, 88, 3, 22, 220, 142, 212, 67, 120, 191, 212, 175, 24, 232, 66, 186, 30, 178, 60, 125, 63, 223, 76, 9, 187, 66, 77, 147, 12, 241, 13, 247, 34, 220, 47, 240, 49, 65, 201, 209, 123, 194, 244, 162, 224, 59, 34, 107, 189, 53, 49, 181, 54, 100, 56, 44, 1, 221, 120, 46, 157, 249, 31, 219, 152, 200, 20, 14, 141, 244, 224, 112, 137, 164, 244, 226, 28, 137, 88, 224, 233, 151, 93, 164, 203, 211, 203, 244, 112, 156, 8, 32, 75, 252, 59, 184, 132, 158, 155, 70, 54, 70, 233, 19, 228, 240, 166, 190, 64, 7, 103, 137, 33, 236, 145, 6, 136, 11, 205, 57, 50, 164, 229, 46, 255, 175, 22, 96, 86, 28, 59, 21, 60, 156, 102, 82, 76, 116, 111, 45, 180, 222, 136, 68, 146, 127, 35, 135, 29, 11, 221, 144, 243, 216, 223, 34, 94, 109, 17, 219, 212, 181, 181, 75, 91, 115, 117, 30, 187, 34, 228, 164, 111, 112, 131, 79, 195, 54, 244, 0, 241, 159, 134, 149, 106, 67, 194, 17, 195, 234, 12, 67, 118, 252, 50, 151, 223, 102, 170, 50, 127, 124, 251, 59, 91, 254, 183, 221, 204, 215, 12, 204, 72, 217, 65, 31, 149, 198, 220, 48, 103, 138, 245, 216, 135, 54, 166, 78, 132, 12, 49, 189, 232, 135, 48, 145, 71, 43, 208, 194, 14, 245, 66, 200, 251, 119, 14, 192, 31, 210, 43, 127, 20, 232, 42, 150, 20, 177, 21, 34, 37, 23, 157, 181, 157, 46, 240, 183, 167, 87, 181, 127, 167, 119, 127, 111, 159, 156, 165, 154, 2, 246, 129, 117, 75, 123, 82, 43, 132, 204, 103, 70, 84, 37, 161, 197, 108, 81, 19, 228, 110, 205, 57, 159, 112, 148, 228, 172, 42, 35, 36, 118, 61, 237, 234, 5, 85, 234, 221, 56, 98, 7, 124, 157, 109, 150, 157, 135, 178, 136, 147, 24, 14, 5, 225, 21, 105, 39, 161, 231, 155, 58, 126, 56, 98, 15, 99, 69, 13, 225, 14, 116, 243, 88, 4, 114, 70, 32, 8, 70, 164, 43, 133, 99, 203, 4, 143, 180, 132, 197, 206, 238, 142, 45, 92, 245, 201, 68, 106, 13, 26, 162, 74, 112, 163, 203, 20, 209, 243, 33, 17, 67, 210, 199, 139, 22, 111, 99, 155, 194, 153, 11, 136, 97, 83, 117, 45, 107, 245, 84, 26, 206, 144, 7, 77, 50, 20, 220, 243, 89, 111, 239, 55, 207, 114, 32, 65, 173, 243, 252, 188, 221, 127, 226, 133, 206, 182, 197, 117, 193, 54, 92, 176, 38, 13, 214, 252, 31, 235, 56, 119, 232, 179, 46, 171, 18, 141, 171, 66, 85, 220, 159, 226, 124, 250, 196, 14, 130, 61, 146, 132, 12, 43, 166, 92, 112, 150, 41, 87, 233, 190, 204, 231, 241, 52, 250, 42, 17, 30, 9, 142, 18, 137, 159, 90, 244, 172, 8, 232, 175, 121, 115, 177, 29, 11, 225, 101, 201, 78, 91, 118, 41, 202, 20, 89, 163, 2, 232, 83, 19, 216, 113, 131, 224, 96, 20, 193, 210, 204, 218, 139, 226, 172, 12, 40, 241, 214, 82, 220, 82, 88, 136, 211, 246, 146, 177, 233, 203, 192, 146, 122, 183, 115, 135, 10, 37, 134, 199, 82, 135, 129, 251, 8, 81, 247, 56, 112, 77, 57, 196, 29, 88, 34, 48, 239, 239, 12, 29, 138, 26, 241, 106, 182, 224, 56, 173, 163, 195, 199, 148, 42, 117, 225, 178, 218, 220, 223, 136, 95, 77, 27, 169, 180, 192, 34, 162, 90, 74, 58, 104, 244, 119, 183, 82, 104, 153, 87, 70, 204, 217, 250, 179, 17, 38, 12, 188, 127, 79, 109, 202, 227, 139, 218, 173, 246, 174, 41, 28, 71, 240, 90, 46, 4, 33, 12, 93, 142, 99, 235, 205, 138, 135, 196, 53, 202, 237, 123, 36, 160, 68, 13, 193, 28, 148, 176, 8, 224, 162, 5, 161, 200, 26, 228, 49, 216, 207, 63, 8, 5, 209, 178, 89, 207, 20, 73, 146, 210, 85, 240, 150, 131, 17, 200, 210, 74, 165, 87, 232, 201, 64, 40, 201, 133, 200, 250, 17, 148, 81, 137, 198, 140, 63, 130, 4, 61, 54, 239, 77, 238, 123, 121, 21, 115, 40, 55, 49, 19, 58, 22, 129, 212, 75, 177, 58, 25, 199, 114, 81, 250, 87, 180, 203, 87, 166, 36, 25, 7, 152, 50, 230, 44, 0, 24, 143, 156, 130, 234, 196, 60, 114, 156, 64, 12, 187, 228, 48, 220, 79, 140, 58, 191, 129, 108, 168, 72, 114, 3, 117, 247, 183, 65, 209, 175, 218, 225, 57, 128, 27, 151, 163, 101, 106, 117, 123, 192, 177, 131, 0, 251, 71, 218, 247, 46, 141, 51, 112, 55, 218, 207, 72, 58, 225, 110, 82, 110, 139, 187, 167, 177, 128, 76, 15, 113, 131, 246, 8, 175, 8, 89, 102, 132, 117, 37, 218, 188, 189, 97, 54, 2, 200, 173, 168, 210, 175, 131, 206, 141, 180, 38, 223, 114, 241, 177, 144, 14, 54, 27, 87, 115, 224, 150, 216, 204, 2, 34, 203, 78, 106, 242, 201, 252, 50, 209, 84, 252, 110, 158, 18, 152, 150, 71, 128, 155, 243, 68, 223, 170, 164, 107, 142, 20, 159, 150, 254, 153, 135, 81, 148, 134, 171, 76, 132, 198, 226, 253, 86, 196, 20, 47, 105, 162, 26, 156, 20, 212, 55, 165, 66, 5, 176, 123, 181, 222, 123, 42, 16, 171, 9, 227, 13, 86, 143, 107, 219, 148, 84, 22, 19, 254, 199, 57, 194, 147, 223, 25, 117, 170, 214, 249, 104, 45, 172, 207, 91, 120, 248, 36, 214, 202, 111, 130, 0, 144, 16, 133, 43, 92, 129, 229, 222, 156, 51, 152, 27, 244, 89, 130, 106, 64, 21, 204, 5, 152, 1, 195, 174, 49, 131, 82, 102, 37, 89, 193, 11, 112, 207, 9, 2, 212, 89, 27, 202, 212, 97, 81, 113, 46, 231, 171, 128, 98, 130, 198, 126, 149, 131, 75, 136, 185, 141, 112, 96, 11, 53, 111, 141, 86, 164, 112, 83, 16, 112, 198, 134, 131, 108, 133, 192, 21, 16, 78, 254, 223, 154, 187, 207, 182, 101, 146, 143, 135, 247, 78, 182, 72, 199, 31, 36, 133, 38, 252, 106, 232, 157, 20, 137, 172, 2, 253, 220, 220, 216, 187, 248, 99, 221, 200, 148, 49, 41, 82, 172, 187, 219, 195, 63, 192, 26, 222, 102, 57, 117, 244, 196, 88, 68, 112, 49, 177, 165, 225, 85, 193, 247, 94, 19, 101, 127, 67, 61, 140, 6, 2, 190, 146, 109, 27, 159, 75, 65, 34, 80, 214, 137, 66, 37, 98, 82, 213, 110, 201, 250, 88, 32, 255, 124, 104, 37, 77, 125, 96, 75, 132, 33, 190, 40, 182, 142, 91, 240, 221, 113, 64, 60, 222, 219, 188, 114, 227, 200, 170, 93, 26, 24, 188, 237, 82, 238, 191, 180, 79, 234, 102, 244, 144, 106, 65, 112, 144, 54, 45, 116, 217, 109, 153, 252, 31, 192, 104, 27, 158, 153, 107, 219, 6, 233, 166, 214, 124, 53, 86, 26, 195, 83, 8, 253, 248, 188, 218, 14, 223, 199, 121, 4, 22, 102, 161, 18, 69, 224, 91, 231, 74, 73, 128, 195, 47, 63, 36, 196, 247, 187, 107, 19, 209, 112, 246, 101, 86, 121, 100, 173, 152, 244, 120, 109, 144, 63, 5, 18, 161, 45, 91, 233, 41, 209, 71, 22, 71, 163, 183, 231, 97, 204, 237, 43, 201, 187, 5, 145, 108, 182, 191, 3, 48, 228, 207, 157, 88, 153, 112, 168, 170, 108, 20, 26, 9, 93, 236, 166, 18, 136, 139, 33, 127, 6, 66, 211, 177, 138, 255, 19, 197, 56, 156, 214, 127, 117, 223, 135, 5, 2, 77, 243, 76, 179, 39, 126, 79, 67, 205, 71, 169, 99, 66, 70, 59, 65, 17, 142, 139, 180, 3, 74, 4, 32, 233, 221, 203, 158, 68, 200, 218, 184, 229, 179, 149, 243, 95, 137, 4, 159, 117, 27, 255, 30, 3, 40, 237, 1, 125, 67, 200, 198, 113, 141, 93, 111, 82, 46, 169, 177, 44, 62, 118, 104, 168, 229, 42, 220, 182, 84, 92, 52, 181, 94, 252, 40, 233, 220, 111, 32, 34, 128, 168, 200, 188, 167, 220, 36, 97, 210, 177, 254, 177, 61, 229, 168, 4, 115, 155, 210, 71, 98, 142, 23, 83, 158, 29, 56, 136, 57, 92, 231, 126, 239, 220, 27, 72, 252, 184, 149, 192, 45, 223, 66, 119, 219, 249, 32, 185, 94, 31, 104, 97, 9, 177, 121, 122, 210, 212, 84, 120, 0, 112, 29, 79, 46, 12, 72, 136, 117, 184, 170, 70, 48, 130, 211, 182, 21, 31, 234, 19, 161, 159, 153, 199, 157, 197, 247, 150, 61, 5, 54, 217, 37, 106, 63, 4, 125, 240, 36, 108, 174, 109, 151, 146, 238, 238, 107, 236, 192, 42, 15, 37, 154, 230, 104, 151, 212, 94, 202, 192, 237, 113, 126, 252, 7, 149, 137, 242, 252, 180, 56, 61, 109, 228, 198, 110, 215, 31, 90, 197, 217, 191, 72, 34, 81, 23, 108, 238, 158, 154, 243, 68, 10, 231, 222, 176, 223, 186, 111, 138, 104, 236, 242, 138, 212, 145, 141, 227, 33, 56, 166, 229, 147, 116, 163, 127, 79, 80, 130, 127, 210, 15, 219, 203, 115, 69, 36, 43, 84, 239, 194, 112, 149, 200, 137, 4, 145, 76, 61, 220, 144, 154, 214, 31, 76, 49, 84, 249, 221, 56, 29, 183, 162, 157, 18, 156, 231, 16, 176, 145, 108, 134, 140, 86, 146, 173, 45, 18, 65, 67, 196, 165, 173, 241, 85, 149, 13, 135, 9, 11, 215, 237, 12, 199, 54, 63, 8, 196, 45, 255, 109, 181, 16, 209, 241, 163, 96, 4, 65, 241, 241, 128, 221, 51, 213, 231, 151, 47, 26, 216, 78, 179, 101, 42, 233, 185, 56, 169, 51, 104, 162, 81, 82, 169, 41, 106, 150, 33, 251, 236, 227, 197, 186, 243, 89, 72, 0, 89, 157, 90, 76, 106, 68, 124, 234, 70, 43, 248, 199, 201, 217, 223, 240, 143, 244, 64, 101, 193, 18, 140, 71, 225, 111, 79, 199, 226, 31, 177, 115, 79, 146, 250, 169, 78, 33, 201, 37, 37, 0, 15, 38, 44, 67, 128, 31, 106, 220, 172, 142, 181, 102, 81, 209, 41, 181, 59, 216, 230, 170, 52, 5, 28, 75, 208, 108, 103, 34, 82, 233, 12, 167, 150, 158, 78, 231, 26, 22, 147, 81, 12, 161, 12, 75, 129, 54, 119, 131, 253, 255, 98, 39, 67, 146, 15, 120, 80, 89, 124, 235, 55, 1, 100, 187, 87, 138, 48, 41, 153, 118, 192, 152, 69, 154, 71, 152, 61, 153, 51, 106, 225, 204, 50, 15, 202, 244, 3, 150, 240, 240, 188, 92, 107, 244, 102, 115, 70, 221, 101, 186, 251, 116, 24, 125, 58, 185, 34, 21, 108, 221, 169, 208, 230, 226, 235, 229, 190, 20, 104, 132, 66, 55, 212, 102, 167, 52, 2, 114, 101, 196, 99, 155, 158, 191, 119, 14, 127, 142, 156, 92, 58, 7, 178, 79, 199, 251, 233, 57, 115, 179, 31, 42, 123, 87, 101, 218, 71, 193, 205, 180, 42, 19, 233, 181, 147, 190, 168, 191, 5, 58, 198, 154, 139, 29, 245, 141, 26, 251, 162, 219, 233, 112, 87, 21, 205, 131, 98, 161, 103, 57, 85, 215, 215, 129, 66, 47, 132, 122, 143, 94, 232, 217, 8, 74, 156, 70, 72, 210, 18, 239, 253, 22, 198, 54, 150, 211, 237, 55, 218, 210, 13, 134, 31, 149, 132, 166, 14, 71, 28, 111, 161, 49, 83, 154, 211, 73, 40, 253, 32, 218, 187, 76, 235, 207, 167, 144, 255, 39, 69, 9, 45, 105, 186, 245, 75, 89, 67, 217, 23, 38, 182, 159, 128, 184, 189, 158, 208, 204, 243, 224, 188, 166, 211, 77, 67, 244, 128, 129, 218, 241, 24, 150, 252, 176, 253, 67, 228, 74, 242, 77, 119, 170, 35, 186, 87, 215, 209, 155, 138, 113, 5, 245, 183, 41, 134, 248, 201, 235, 23, 218, 129, 249, 76, 164, 75, 105, 195, 62, 56, 164, 73, 240, 229, 79, 252, 79, 31, 96, 204, 171, 132, 249, 148, 18, 223, 41, 109, 13, 163, 207, 149, 126, 153, 221, 179, 226, 166, 142, 61, 190, 17, 147, 104, 55, 132, 8, 132, 171, 56, 204, 235, 150, 143, 190, 73, 252, 29, 53, 193, 227, 160, 3, 238, 120, 69, 160, 76, 104, 248, 87, 144, 176, 112, 106, 31, 232, 141, 237, 236, 240, 186, 218, 216, 34, 115, 176, 28, 166, 53, 196, 255, 169, 72, 103, 35, 137, 254, 249, 239, 163, 238, 41, 252, 143, 58, 67, 213, 47, 74, 195, 49, 216, 111, 75, 1, 57, 51, 41, 169, 63, 191, 213, 202, 38, 211, 230, 153, 223, 225, 203, 68, 234, 244, 198, 54, 170, 142, 72, 135, 22, 48, 85, 18, 2, 167, 173, 21, 82, 215, 224, 8, 220, 205, 62, 202, 29, 14, 69, 122, 248, 199, 160, 65, 147, 71, 71, 72, 74, 121, 101, 15, 108, 250, 234, 186, 240, 219, 0, 215, 122, 194, 136, 13, 165, 55, 125, 219, 131, 66, 239, 188, 128, 62, 46, 179, 207, 226, 186, 215, 224, 255, 192, 14, 24, 249, 165, 118, 52, 10, 179, 39, 91, 243, 62, 118, 74, 235, 38, 85, 142, 242, 186, 95, 119, 22, 149, 227, 232, 144, 125, 5, 155, 240, 76, 101, 100, 92, 156, 36, 131, 86, 200, 154, 92, 232, 203, 47, 182, 182, 118, 1, 84, 232, 64, 144, 197, 76, 172, 175, 128, 1, 73, 96, 131, 109, 3, 29, 18, 235, 145, 113, 56, 39, 76, 103, 91, 15, 223, 80, 87, 225, 164, 26, 228, 183, 146, 65, 26, 124, 58, 231, 251, 117, 162, 57, 156, 77, 136, 214, 135, 58, 9, 2, 189, 94, 29, 167, 81, 21, 17, 15, 133, 126, 15, 149, 246, 255, 172, 45, 102, 89, 179, 45, 189, 73, 184, 99, 236, 193, 229, 177, 40, 126, 119, 48, 120, 45, 159, 189, 41, 62, 184, 127, 145, 158, 63, 85, 208, 108, 237, 69, 100, 40, 222, 37, 195, 78, 124, 154, 131, 245, 197, 60, 55, 184, 232, 246, 202, 108, 170, 76, 137, 166, 100, 23, 206, 136, 164, 55, 67, 104, 191, 240, 166, 22, 28, 234, 68, 232, 255, 109, 142, 131, 79, 145, 60, 162, 114, 174, 160, 100, 62, 212, 108, 215, 68, 45, 198, 14, 197, 71, 201, 177, 203, 74, 47, 118, 102, 249, 242, 193, 162, 129, 4, 133, 12, 195, 201, 74, 87, 132, 50, 208, 58, 244, 206, 27, 249, 41, 40, 113, 172, 197, 175, 182, 128, 123, 209, 70, 113, 205, 23, 126, 96, 75, 173, 95, 55, 106, 215, 26, 170, 185, 178, 223, 116, 179, 194, 36, 115, 239, 65, 182, 188, 47, 237, 214, 193, 134, 37, 234, 239, 76, 134, 7, 185, 216, 121, 179, 238, 169, 225, 5, 74, 123, 50, 115, 139, 186, 114, 94, 227, 183, 188, 19, 93, 199, 180, 177, 209, 154, 133, 234, 42, 27, 53, 137, 158, 108, 218, 102, 125, 142, 47, 213, 200, 147, 149, 248, 47, 211, 114, 102, 246, 62, 183, 42, 16, 41, 165, 125, 226, 46, 98, 16, 225, 67, 43, 241, 33, 25, 73, 253, 64, 253, 223, 245, 150, 5, 128, 60, 46, 187, 17, 119, 77, 11, 195, 21, 67, 170, 196, 37, 230, 157, 167, 105, 218, 247, 32, 194, 129, 2, 53, 154, 112, 193, 6, 200, 38, 46, 124, 32, 214, 228, 159, 16, 73, 252, 248, 188, 76, 59, 105, 137, 7, 254, 231, 73, 75, 161, 204, 226, 139, 234, 189, 203, 42, 11, 110, 114, 126, 177, 221, 49, 42, 14, 119, 169, 122, 102, 83, 43, 82, 31, 153, 128, 170, 178, 216, 190, 105, 0, 255, 67, 91, 195, 1, 93, 8, 135, 187, 111, 208, 96, 124, 214, 103, 212, 194, 22, 87, 0, 106, 51, 29, 149, 75, 201, 184, 94, 86, 83, 75, 255, 45, 229, 93, 147, 136, 179, 226, 124, 22, 117, 111, 137, 122, 220, 143, 120, 184, 250, 210, 103, 234, 161, 23, 119, 113, 79, 216, 63, 37, 213, 218, 195, 234, 48, 103, 30, 200, 106, 108, 221, 241, 191, 53, 192, 150, 188, 160, 90, 215, 126, 97, 38, 116, 43, 130, 215, 114, 252, 131, 17, 201, 176, 205, 237, 213, 104, 27, 146, 118, 77, 73, 172, 151, 231, 217, 154, 191, 160, 132, 116, 232, 201, 168, 19, 107, 48, 69, 126, 180, 73, 228, 204, 128, 6, 213, 161, 73, 163, 35, 105, 197, 107, 204, 46, 239, 108, 57, 70, 194, 57, 197, 125, 239, 247, 41, 82, 2, 180, 28, 235, 69, 255, 196, 103, 96, 31, 174, 100, 245, 143, 91, 254, 213, 24, 79, 98, 5, 157, 214, 36, 94, 12, 192, 148, 75, 146, 70, 87, 152, 119, 157, 229, 108, 99, 26, 105, 192, 167, 182, 196, 22, 202, 45, 80, 252, 78, 180, 158, 92, 20, 246, 236, 182, 176, 177, 111, 68, 123, 212, 32, 122, 131, 153, 237, 171, 226, 8, 251, 249, 67, 13, 217, 198, 95, 146, 193, 97, 204, 13, 124, 247, 174, 185, 227, 158, 40, 29, 161, 80, 69, 27, 185, 241, 123, 21, 17, 7, 244, 234, 239, 219, 124, 207, 90, 53, 124, 145, 155, 117, 12, 54, 105, 219, 146, 253, 143, 156, 56, 238, 71, 143, 160, 159, 173, 18, 152, 100, 130, 237, 114, 1, 160, 233, 56, 33, 218, 180, 129, 21, 71, 156, 191, 175, 204, 91, 26, 239, 167, 83, 117, 245, 83, 218, 203, 56, 159, 46, 235, 83, 222, 251, 71, 32, 15, 245, 67, 122, 22, 154, 211, 237, 131, 178, 170, 187, 17, 92, 218, 113, 254, 190, 129, 124, 33, 132, 149, 17, 150, 244, 246, 83, 47, 101, 25, 173, 146, 33, 115, 86, 74, 221, 160, 102, 238, 94, 0, 103, 25, 8, 39, 198, 185, 223, 96, 82, 2, 218, 16, 125, 31, 201, 57, 189, 191, 68, 194, 48, 162, 250, 1, 239, 120, 206, 40, 221, 192, 9, 176, 150, 118, 203, 254, 206, 189, 25, 31, 208, 219, 80, 74, 169, 97, 72, 251, 211, 160, 3, 187, 190, 185, 41, 196, 67, 18, 72, 25, 158, 135, 170, 20, 40, 65, 70, 122, 162, 107, 80, 227, 101, 209, 190, 67, 159, 93, 235, 12, 91, 62, 16, 72, 212, 149, 108, 29, 36, 217, 137, 240, 225, 238, 41, 175, 54, 153, 117, 22, 121, 59, 105, 91, 201, 207, 65, 118, 105, 249, 78, 59, 196, 227, 183, 10, 246, 249, 30, 127, 145, 88, 240, 34, 162, 44, 133, 154, 66, 30, 161, 40, 75, 66, 88, 12, 0, 31, 35, 184, 244, 24, 39, 235, 232, 9, 141, 182, 229, 41, 177, 32, 89, 90, 2, 202, 99, 114, 79, 249, 62, 178, 251, 52, 90, 158, 49, 153, 45, 59, 164, 225, 147, 225, 147, 224, 236, 76, 155, 138, 39, 146, 17, 202, 66, 250, 165, 134, 62, 148, 223, 113, 124, 199, 37, 205, 64, 129, 21, 129, 120, 173, 41, 132, 195, 53, 67, 123, 248, 165, 236, 208, 41, 239, 18, 222, 101, 201, 133, 65, 68, 193, 28, 9, 27, 225, 1, 177, 228, 167, 95, 107, 225, 109, 102, 199, 169, 226, 142, 140, 82, 153, 44, 36, 245, 124, 48, 255, 61, 230, 85, 57, 166, 193, 114, 49, 230, 117, 57, 44, 243, 128, 154, 10, 170, 196, 124, 220, 78, 229, 34, 243, 131, 209, 34, 62, 196, 60, 136, 193, 16, 47, 176, 38, 200, 240, 245, 80, 204, 21, 133, 203, 200, 197, 231, 7, 124, 66, 37, 255, 206, 107, 54, 236, 100, 206, 207, 222, 13, 143, 11, 22, 249, 214, 66, 90, 96, 192, 145, 40, 21, 211, 74, 239, 81, 152, 20, 153, 149, 16, 167, 150, 16, 249, 44, 83, 196, 252, 135, 229, 11, 215, 17, 151, 25, 177, 102, 175, 92, 125, 70, 46, 20, 48, 79, 157, 161, 252, 242, 10, 197, 194, 120, 72, 53, 213, 197, 114, 4, 161, 209, 198, 111, 67, 223, 90, 56, 57, 152, 89, 180, 241, 254, 82, 136, 122, 135, 36, 166, 125, 112, 134, 82, 67, 29, 236, 182, 66, 127, 155, 21, 217, 228, 252, 27, 88, 193, 255, 160, 157, 142, 81, 183, 188, 47, 219, 124, 186, 48, 180, 124, 33, 187, 159, 22, 181, 6, 197, 49, 1, 1, 91, 236, 55, 110, 191, 34, 70, 205, 94, 224, 48, 139, 245, 93, 191, 77, 61, 68, 39, 202, 82, 93, 114, 147, 54, 25, 111, 3, 110, 6, 226, 98, 192, 152, 76, 173, 190, 193, 55, 99, 173, 4, 216, 228, 98, 84, 11, 134, 239, 119, 42, 33, 110, 71, 127, 122, 184, 9, 101, 230, 16, 50, 89, 210, 65, 248, 117, 122, 28, 190, 86, 83, 220, 125, 137, 177, 103, 151, 121, 52, 21, 168, 156, 91, 64, 211, 162, 145, 11, 126, 14, 162, 244, 25, 104, 204, 50, 225, 207, 252, 103, 229, 54, 98, 89, 131, 134, 3, 34, 197, 9, 97, 170, 140, 105, 244, 75, 231, 21, 194, 202, 205, 28, 30, 148, 181, 119, 100, 235, 240, 240, 19, 97, 60, 164, 153, 219, 127, 80, 141, 136, 191, 54, 184, 217, 217, 231, 245, 114, 50, 90, 231, 239, 29, 52, 43, 205, 204, 136, 97, 251, 183, 192, 57, 6, 121, 250, 197, 134, 136, 43, 83, 201, 50, 26, 108, 176, 92, 89, 148, 59, 119, 7, 214, 147, 80, 74, 68, 167, 97, 62, 171, 252, 103, 159, 20, 97, 90, 169, 97, 98, 216, 56, 167, 137, 91, 1, 155, 195, 197, 206, 32, 162, 172, 69, 132, 137, 225, 81, 236, 98, 196, 240, 47, 226, 62, 95, 131, 158, 210, 150, 152, 102, 182, 66, 110, 53, 220, 110, 134, 121, 67, 34, 172, 26, 228, 128, 29, 29, 125, 18, 181, 47, 86, 92, 98, 96, 22, 5, 209, 252, 30, 122, 123, 55, 166, 218, 90, 16, 197, 156, 181, 15, 235, 174, 197, 224, 255, 242, 181, 83, 223, 31, 168, 132, 24, 15, 196, 78, 243, 100, 199, 239, 91, 115, 30, 84, 210, 232, 0, 101, 23, 203, 37, 205, 2, 72, 115, 204, 173, 106, 52, 199, 162, 16, 39, 103, 179, 180, 21, 218, 156, 222, 150, 82, 86, 68, 6, 0, 223, 110, 113, 224, 49, 3, 223, 81, 147, 236, 95, 200, 98, 148, 162, 58, 60, 60, 247, 26, 196, 182, 28, 54, 237, 136, 29, 167, 224, 64, 159, 234, 24, 64, 147, 58, 62, 41, 219, 220, 43, 216, 182, 86, 252, 255, 212, 150, 236, 239, 123, 106, 98, 67, 31, 141, 7, 226, 229, 89, 106, 148, 154, 74, 43, 94, 46, 85, 87, 208, 86, 109, 215, 129, 173, 78, 118, 212, 168, 5, 118, 87, 149, 29, 57, 115, 15, 218, 2, 17, 89, 9, 225, 216, 75, 186, 205, 115, 253, 143, 62, 147, 12, 150, 31, 146, 28, 47, 189, 182, 58, 230, 140, 17, 28, 139, 173, 178, 125, 143, 250, 135, 34, 117, 209, 194, 240, 83, 211, 234, 222, 113, 233, 41, 202, 194, 96, 102, 68, 19, 73, 233, 179, 180, 48, 129, 123, 163, 158, 9, 130, 222, 232, 135, 174, 42, 6, 137, 217, 79, 118, 190, 197, 2, 120, 89, 113, 61, 98, 48, 98, 118, 21, 211, 175, 73, 6, 238, 110, 31, 17, 51, 18, 96, 180, 32, 192, 111, 163, 200, 149, 87, 149, 158, 142, 185, 116, 112, 61, 193, 72, 184, 145, 180, 182, 26, 29, 46, 222, 173, 182, 123, 156, 146, 197, 165, 85, 76, 51, 77, 113, 154, 222, 216, 134, 187, 158, 226, 229, 28, 232, 210, 0, 63, 152, 92, 37, 57, 122, 185, 229, 187, 148, 76, 142, 52, 66, 250, 169, 118, 180, 19, 28, 60, 94, 254, 232, 47, 207, 31, 76, 37, 155, 5, 234, 124, 118, 110, 66, 207, 67, 76, 80, 181, 28, 190, 15, 254, 231, 47, 17, 229, 70, 195, 136, 30, 19, 19, 94, 113, 144, 60, 156, 94, 18, 54, 244, 76, 130, 59, 43, 168, 67, 118, 116, 172, 225, 178, 5, 33, 139, 94, 7, 189, 150, 87, 5, 251, 85, 185, 187, 219, 255, 241, 176, 209, 50, 38, 50, 117, 166, 105, 19, 30, 180, 113, 213, 192, 26, 26, 221, 142, 191, 37, 52, 168, 91, 178, 198, 239, 81, 89, 214, 241, 96, 13, 81, 101, 93, 41, 13, 45, 97, 231, 131, 31, 204, 138, 215, 121, 231, 63, 35, 108, 106, 111, 15, 89, 210, 250, 225, 169, 91, 98, 215, 47, 195, 186, 185, 44, 235, 3, 100, 142, 182, 183, 14, 96, 125, 217, 166, 188, 225, 236, 56, 18, 107, 175, 39, 220, 129, 124, 29, 159, 48, 159, 75, 220, 184, 42, 156, 36, 226, 244, 83, 122, 0, 15, 101, 107, 167, 46, 199, 210, 193, 175, 193, 224, 144, 182, 97, 71, 152, 48, 249, 179, 203, 94, 16, 43, 252, 30, 201, 79, 70, 93, 35, 201, 98, 200, 181, 212, 89, 208, 140, 119, 191, 4, 149, 147, 137, 74, 105, 238, 19, 138, 58, 44, 26, 34, 254, 69, 249, 236, 199, 115, 27, 212, 86, 26, 148, 232, 22, 79, 97, 106, 82, 109, 64, 9, 192, 8, 207, 188, 184, 170, 77, 164, 165, 173, 30, 165, 232, 83, 47, 7, 13, 249, 53, 96, 199, 210, 56, 134, 223, 22, 235, 110, 22, 1, 150, 215, 32, 171, 176, 205, 31, 137, 67, 104, 6, 82, 228, 27, 210, 55, 16, 86, 235, 33, 5, 4, 72, 115, 1, 16, 120, 222, 55, 249, 190, 170, 83, 108, 125, 42, 111, 84, 154, 47, 40, 106, 66, 38, 230, 132, 184, 126, 72, 88, 122, 217, 38, 190, 88, 30, 22, 142, 3, 244, 213, 98, 57, 180, 171, 132, 84, 145, 151, 249, 165, 219, 56, 24, 33, 32, 159, 215, 197, 190, 168, 45, 75, 225, 213, 115, 129, 212, 172, 159, 88, 21, 57, 51, 224, 62, 243, 178, 141, 61, 160, 195, 62, 84, 229, 45, 255, 175, 63, 164, 50, 50, 124, 253, 124, 248, 172, 22, 85, 31, 7, 219, 169, 156, 125, 181, 74, 36, 96, 17, 90, 183, 223, 134, 107, 82, 107, 207, 94, 89, 122, 237, 73, 144, 165, 82, 163, 144, 123, 99, 85, 144, 16, 72, 66, 13, 223, 26, 179, 229, 74, 219, 110, 80, 183, 89, 35, 134, 190, 171, 24, 156, 79, 246, 26, 238, 213, 44, 9, 4, 22, 8, 14, 110, 189, 104, 230, 22, 25, 113, 152, 102, 91, 98, 101, 190, 110, 69, 51, 160, 82, 237, 255, 11, 244, 34, 6, 232, 163, 183, 177, 210, 73, 63, 55, 236, 166, 85, 35, 197, 10, 227, 0, 69, 151, 143, 155, 30, 243, 243, 31, 76, 0, 254, 210, 18, 124, 59, 198, 14, 157, 3, 11, 123, 197, 142, 186, 2, 109, 219, 109, 231, 25, 66, 138, 17, 49, 202, 48, 24, 253, 250, 76, 57, 250, 128, 93, 30, 55, 237, 36, 93, 172, 238, 80, 249, 191, 131, 152, 247, 88, 154, 14, 90, 124, 53, 199, 39, 62, 151, 50, 129, 113, 88, 185, 54, 230, 50, 165, 33, 228, 222, 44, 57, 239, 241, 131, 195, 238, 242, 194, 196, 49, 192, 170, 5, 35, 88, 252, 220, 15, 43, 198, 169, 20, 13, 0, 230, 89, 231, 154, 208, 39, 104, 218, 162, 251, 219, 200, 15, 52, 87, 207, 79, 130, 110, 253, 70, 175, 52, 80, 252, 9, 159, 19, 49, 137, 252, 80, 210, 128, 180, 150, 165, 129, 95, 109, 55, 80, 129, 61, 103, 22, 70, 232, 58, 126, 90, 213, 215, 84, 20, 168, 6, 164, 87, 75, 188, 126, 21, 214, 80, 167, 109, 124, 246, 144, 138, 246, 114, 82, 33, 127, 232, 71, 192, 86, 10, 48, 29, 17, 28, 255, 237, 12, 252, 134, 145, 141, 195, 245, 60, 44, 159, 193, 222, 100, 120, 78, 35, 148, 105, 51, 179, 137, 70, 113, 183, 179, 81, 53, 53, 100, 155, 120, 33, 21, 170, 193, 109, 186, 39, 235, 239, 169, 149, 170, 9, 44, 65, 84, 10, 13, 126, 104, 221, 158, 94, 54, 192, 4, 100, 34, 111, 81, 160, 104, 162, 117, 134, 177, 200, 162, 25, 233, 102, 56, 236, 79, 199, 193, 106, 160, 173, 121, 253, 239, 204, 2, 238, 180, 246, 172, 28, 226, 200, 243, 249, 147, 30, 236, 118, 47, 154, 83, 230, 108, 136, 83, 154, 200, 3, 96, 245, 7, 149, 135, 132, 39, 199, 23, 19, 100, 242, 110, 202, 165, 153, 249, 131, 134, 82, 202, 206, 255, 115, 120, 208, 228, 38, 198, 28, 0, 97, 180, 100, 54, 19, 241, 97, 27, 91, 161, 21, 130, 105, 97, 208, 33, 91, 130, 23, 74, 7, 30, 110, 89, 167, 71, 88, 206, 0, 1, 170, 13, 110, 40, 246, 237, 37, 87, 138, 9, 211, 149, 102, 92, 163, 50, 149, 155, 102, 57, 6, 143, 106, 110, 120, 101, 255, 162, 204, 246, 53, 190, 38, 238, 129, 243, 30, 10, 170, 244, 5, 126, 64, 25, 202, 49, 118, 27, 153, 189, 52, 49, 141, 143, 78, 120, 79, 244, 28, 210, 225, 15, 6, 169, 222, 152, 249, 26, 225, 162, 217, 13, 86, 143, 185, 123, 34, 74, 163, 202, 158, 165, 187, 249, 72, 107, 213, 110, 53, 41, 87, 7, 10, 42, 232, 37, 95, 183, 88, 93, 213, 38, 236, 55, 1, 246, 186, 206, 73, 186, 71, 121, 199, 167, 96, 51, 158, 225, 105, 232, 77, 131, 27, 83, 100, 251, 100, 21, 204, 176, 244, 212, 113, 99, 41, 7, 79, 253, 110, 254, 137, 201, 63, 35, 50, 177, 86, 101, 218, 158, 209, 131, 125, 193, 208, 17, 20, 98, 190, 207, 164, 209, 141, 231, 200, 89, 65, 220, 178, 187, 191, 222, 17, 188, 63, 171, 27, 108, 183, 91, 146, 255, 89, 216, 188, 190, 15, 85, 93, 183, 240, 228, 98, 62, 164, 8, 219, 113, 224, 158, 215, 141, 40, 101, 231, 57, 19, 2, 114, 122, 16, 255, 169, 104, 97, 56, 14, 153, 143, 48, 68, 189, 230, 216, 168, 31, 155, 42, 237, 113, 81, 107, 149, 240, 146, 143, 50, 129, 82, 90, 85, 219, 154, 203, 203, 118, 85, 210, 87, 169, 124, 111, 76, 147, 38, 38, 122, 59, 156, 5, 67, 207, 202, 28, 63, 26, 67, 238, 202, 149, 122, 81, 240, 119, 115, 128, 213, 235, 144, 67, 66, 16, 66, 78, 4, 129, 89, 17, 177, 246, 95, 118, 166, 94, 108, 88, 252, 126, 64, 106, 23, 171, 126, 207, 234, 135, 93, 59, 22, 44, 18, 146, 255, 25, 61, 159, 189, 177, 122, 108, 131, 97, 83, 173, 142, 165, 185, 18, 39, 109, 88, 201, 234, 107, 6, 237, 203, 193, 178, 189, 252, 4, 129, 39, 29, 207, 208, 191, 205, 94, 155, 100, 45, 155, 15, 217, 19, 234, 2, 206, 103, 243, 131, 12, 107, 114, 71, 169, 122, 134, 169, 18, 197, 148, 8, 239, 13, 217, 8, 55, 88, 127, 9, 207, 227, 78, 39, 109, 97, 213, 183, 188, 32, 112, 100, 48, 65, 141, 177, 167, 217, 135, 211, 181, 116, 38, 232, 112, 141, 5, 163, 96, 183, 155, 191, 100, 179, 165, 137, 208, 45, 193, 97, 229, 100, 110, 166, 245, 224, 2, 24, 153, 64, 199, 36, 150, 65, 165, 164, 197, 243, 74, 131, 112, 126, 193, 188, 25, 154, 237, 176, 2, 76, 243, 255, 9, 16, 200, 223, 55, 104, 217, 190, 220, 230, 196, 217, 32, 255, 93, 109, 95, 51, 217, 184, 112, 92, 197, 181, 189, 72, 81, 119, 131, 126, 36, 40, 103, 223, 251, 19, 164, 112, 38, 219, 43, 163, 93, 244, 120, 181, 101, 145, 85, 231, 57, 14, 52, 129, 156, 52, 145, 103, 236, 115, 14, 212, 37, 174, 238, 231, 231, 114, 221, 141, 194, 44, 204, 203, 51, 53, 186, 180, 179, 202, 244, 249, 105, 110, 72, 105, 59, 7, 94, 249, 175, 128, 159, 45, 107, 72, 129, 122, 49, 153, 213, 164, 182, 79, 235, 116, 160, 106, 168, 65, 70, 202, 144, 18, 15, 17, 208, 187, 21, 236, 233, 151, 204, 206, 169, 129, 249, 40, 10, 76, 161, 33, 184, 27, 31, 196, 164, 110, 71, 219, 119, 145, 174, 2, 115, 108, 135, 207, 153, 240, 207, 249, 238, 135, 8, 238, 229, 232, 218, 111, 187, 223, 87, 89, 234, 181, 11, 110, 56, 191, 20, 229, 33, 166, 49, 46, 187, 117, 46, 170, 66, 124, 179, 120, 136, 125, 200, 18, 7, 133, 143, 255, 59, 249, 210, 143, 49, 31, 176, 249, 188, 135, 102, 219, 195, 86, 188, 35, 227, 144, 240, 188, 103, 168, 196, 188, 87, 227, 185, 128, 65, 113, 81, 170, 1, 63, 71, 102, 67, 25, 195, 71, 66, 173, 241, 237, 49, 8, 199, 74, 194, 44, 68, 43, 133, 151, 77, 170, 51, 226, 43, 6, 98, 184, 224, 58, 96, 8, 12, 53, 156, 10, 213, 88, 133, 90, 23, 11, 96, 96, 88, 61, 184, 24, 158, 56, 85, 110, 0, 25, 119, 87, 215, 119, 72, 2, 239, 251, 16, 75, 255, 130, 237, 182, 173, 237, 213, 120, 191, 238, 245, 253, 3, 96, 170, 98, 51, 171, 238, 23, 95, 133, 124, 229, 221, 65, 88, 20, 160, 247, 152, 130, 142, 192, 125, 114, 175, 157, 141, 163, 194, 133, 124, 42, 253, 84, 190, 81, 41, 226, 244, 186, 162, 38, 110, 113, 74, 181, 175, 87, 84, 98, 104, 105, 16, 212, 96, 235, 210, 169, 14, 161, 91, 64, 118, 214, 249, 88, 60, 63, 50, 8, 238, 91, 42, 45, 71, 6, 208, 142, 97, 176, 224, 250, 237, 252, 239, 133, 52, 172, 174, 32, 233, 198, 143, 201, 169, 34, 154, 70, 132, 10, 75, 92, 95, 195, 63, 126, 206, 87, 149, 177, 65, 203, 58, 194, 185, 116, 6, 52, 108, 195, 40, 14, 187, 181, 197, 59, 70, 84, 111, 107, 238, 112, 92, 236, 131, 247, 115, 200, 9, 6, 63, 88, 25, 119, 163, 161, 54, 213, 241, 71, 20, 139, 182, 107, 175, 253, 70, 144, 148, 11, 186, 253, 14, 118, 118, 25, 150, 92, 248, 150, 35, 98, 63, 94, 2, 164, 67, 75, 26, 100, 86, 114, 77, 114, 124, 127, 146, 216, 119, 76, 193, 64, 89, 197, 196, 79, 59, 65, 98, 85, 247, 118, 240, 33, 165, 30, 254, 64, 228, 73, 203, 200, 57, 15, 84, 99, 127, 136, 194, 142, 21, 18, 246, 228, 41, 221, 67, 222, 108, 9, 0, 137, 11, 121, 77, 104, 241, 136, 81, 98, 141, 190, 199, 8, 192, 36, 222, 151, 0, 153, 60, 100, 242, 63, 183, 113, 84, 4, 197, 192, 23, 81, 78, 129, 245, 201, 69, 50, 184, 228, 125, 143, 95, 85, 229, 227, 99, 202, 35, 98, 219, 95, 224, 26, 38, 24, 78, 73, 221, 97, 200, 50, 164, 223, 196, 145, 97, 215, 22, 16, 167, 128, 193, 254, 150, 44, 166, 72, 27, 42, 29, 93, 251, 173, 216, 21, 227, 62, 249, 130, 103, 193, 85, 220, 114, 187, 198, 50, 240, 205, 167, 117, 28, 39, 135, 29, 109, 221, 109, 100, 18, 33, 157, 34, 1, 13, 74, 230, 80, 25, 23, 122, 114, 100, 15, 231, 124, 217, 117, 74, 187, 29, 182, 222, 17, 183, 4, 112, 245, 206, 110, 240, 143, 86, 188, 149, 54, 3, 205, 201, 56, 66, 83, 142, 184, 23, 145, 99, 196, 38, 235, 24, 78, 25, 79, 71, 232, 88, 76, 88, 71, 160, 120, 63, 185, 129, 56, 24, 90, 61, 27, 122, 24, 153, 72, 3, 89, 234, 16, 220, 6, 62, 92, 40, 20, 23, 172, 244, 230, 138, 246, 51, 127, 114, 159, 211, 245, 11, 151, 246, 224, 103, 201, 75, 90, 89, 33, 162, 111, 255, 2, 50, 175, 15, 162, 127, 66, 102, 178, 107, 171, 81, 212, 226, 86, 201, 185, 191, 155, 135, 99, 181, 59, 181, 84, 75, 141, 89, 134, 125, 114, 238, 105, 128, 138, 251, 161, 87, 188, 158, 2, 6, 195, 209, 145, 181, 74, 65, 59, 43, 45, 53, 92, 114, 184, 28, 112, 189, 210, 212, 129, 224, 199, 6, 176, 235, 197, 36, 183, 54, 179, 228, 144, 59, 216, 147, 246, 221, 235, 73, 96, 191, 96, 204, 71, 163, 16, 86, 54, 39, 107, 7, 248, 160, 240, 215, 88, 169, 124, 16, 150, 43, 12, 17, 2, 228, 112, 163, 161, 164, 49, 67, 147, 135, 39, 205, 162, 240, 164, 89, 159, 21, 144, 216, 8, 108, 70, 49, 232, 134, 171, 50, 53, 182, 215, 227, 221, 197, 18, 173, 3, 58, 97, 198, 120, 150, 244, 222, 184, 202, 225, 233, 223, 43, 151, 246, 149, 248, 33, 79, 47, 52, 203, 91, 190, 93, 35, 219, 8, 116, 222, 93, 46, 234, 25, 110, 188, 168, 56, 72, 119, 5, 247, 84, 251, 144, 103, 133, 132, 232, 23, 153, 167, 38, 246, 227, 247, 24, 186, 238, 249, 185, 9, 176, 100, 78, 36, 39, 159, 208, 210, 160, 135, 138, 63, 197, 115, 42, 242, 70, 91, 180, 122, 144, 47, 82, 225, 188, 226, 110, 202, 24, 148, 132, 1, 170, 94, 145, 194, 148, 104, 152, 182, 251, 145, 131, 227, 110, 108, 104, 153, 195, 19, 1, 57, 191, 198, 177, 115, 34, 17, 117, 191, 211, 163, 169, 152, 29, 142, 131, 232, 192, 199, 17, 142, 19, 120, 130, 30, 194, 111, 173, 232, 142, 195, 152, 49, 96, 84, 227, 133, 8, 217, 16, 171, 83, 163, 27, 96, 213, 242, 117, 244, 42, 178, 221, 86, 179, 55, 169, 35, 108, 25, 62, 68, 60, 104, 168, 71, 238, 193, 159, 5, 233, 74, 190, 243, 239, 244, 227, 206, 41, 19, 181, 66, 167, 249, 211, 1, 178, 62, 31, 179, 127, 104, 26, 195, 149, 206, 21, 69, 23, 107, 115, 197, 164, 177, 230, 188, 19, 20, 62, 42, 35, 77, 27, 13, 50, 5, 209, 162, 124, 120, 101, 237, 231, 224, 204, 6, 27, 153, 104, 147, 125, 139, 163, 129, 177, 37, 134, 102, 212, 81, 220, 74, 113, 199, 5, 166, 194, 34, 222, 60, 254, 121, 245, 33, 89, 159, 134, 160, 176, 116, 196, 57, 144, 116, 131, 205, 238, 142, 98, 105, 90, 99, 120, 158, 38, 33, 134, 118, 107, 187, 101, 77, 78, 199, 233, 32, 78, 107, 99, 243, 235, 72, 174, 28, 20, 106, 76, 106, 67, 234, 22, 161, 233, 118, 102, 44, 199, 140, 46, 11, 181, 82, 167, 157, 242, 240, 132, 53, 236, 152, 184, 110, 212, 47, 148, 116, 209, 143, 56, 110, 105, 141, 219, 179, 4, 1, 244, 163, 62, 190, 120, 38, 49, 55, 17, 211, 157, 26, 26, 181, 93, 170, 228, 166, 4, 233, 18, 28, 206, 55, 216, 50, 178, 196, 220, 52, 74, 153, 196, 114, 194, 231, 194, 243, 211, 84, 63, 26, 112, 62, 31, 244, 188, 86, 116, 248, 28, 213, 239, 190, 142, 89, 107, 254, 113, 237, 175, 108, 63, 91, 89, 27, 48, 223, 54, 97, 206, 113, 207, 39, 223, 190, 224, 228, 215, 53, 226, 5, 221, 18, 30, 206, 28, 231, 216, 174, 29, 227, 255, 134, 219, 249, 86, 46, 65, 164, 41, 203, 122, 25, 127, 174, 154, 108, 189, 226, 97, 106, 63, 56, 139, 216, 214, 155, 127, 64, 143, 137, 120, 7, 60, 23, 171, 69, 48, 233, 164, 132, 32, 115, 152, 209, 154, 85, 95, 148, 127, 88, 72, 114, 239, 244, 189, 5, 174, 202, 24, 189, 122, 160, 243, 12, 253, 185, 39, 33, 73, 27, 225, 46, 190, 134, 123, 79, 130, 185, 203, 251, 91, 255, 169, 212, 101, 141, 204, 225, 44, 3, 109, 184, 42, 16, 93, 250, 253, 199, 117, 216, 253, 185, 226, 121, 11, 89, 88, 238, 95, 117, 63, 24, 206, 20, 108, 163, 67, 102, 72, 199, 38, 75, 226, 133, 247, 191, 127, 20, 92, 180, 134, 64, 164, 35, 253, 74, 124, 120, 110, 180, 117, 168, 63, 165, 68, 138, 73, 224, 178, 138, 205, 22, 235, 134, 222, 164, 17, 184, 153, 115, 24, 24, 100, 135, 106, 53, 184, 249, 49, 8, 103, 97, 179, 207, 63, 108, 121, 93, 48, 235, 127, 119, 1, 177, 14, 191, 20, 88, 43, 241, 97, 149, 18, 129, 238, 10, 116, 85, 71, 211, 176, 95, 249, 229, 169, 43, 55, 196, 26, 179, 48, 110, 230, 215, 221, 96, 30, 202, 73, 118, 182, 29, 186, 168, 156, 109, 16, 172, 224, 98, 152, 3, 247, 27, 219, 28, 189, 144, 216, 144, 222, 141, 23, 199, 107, 18, 106, 54, 50, 18, 160, 111, 159, 208, 242, 31, 173, 58, 35, 3, 188, 180, 19, 64, 221, 90, 57, 140, 210, 78, 0, 100, 214, 218, 156, 168, 223, 80, 134, 63, 72, 24, 22, 228, 32, 133, 148, 91, 244, 123, 87, 0, 157, 131, 56, 30, 92, 10, 182, 32, 3, 183, 75, 13, 80, 218, 194, 239, 4, 210, 40, 46, 5, 94, 167, 197, 150, 84, 126, 0, 231, 7, 98, 115, 78, 19, 43, 146, 106, 32, 156, 51, 162, 250, 32, 17, 7, 221, 5, 90, 78, 62, 145, 193, 73, 86, 156, 204, 80, 67, 146, 165, 201, 247, 140, 145, 237, 158, 10, 2, 180, 139, 80, 204, 208, 208, 243, 248, 25, 126, 122, 224, 121, 30, 62, 239, 213, 222, 183, 137, 28, 180, 219, 170, 194, 203, 6, 254, 24, 70, 174, 159, 14, 200, 40, 211, 196, 35, 98, 170, 38, 41, 25, 23, 150, 164, 33, 135, 40, 61, 4, 95, 136, 21, 30, 170, 83, 104, 11, 128, 208, 212, 207, 213, 106, 84, 254, 91, 44, 100, 115, 9, 107, 116, 225, 80, 243, 119, 234, 41, 89, 184, 171, 236, 96, 37, 237, 52, 20, 23, 188, 59, 151, 68, 169, 190, 126, 84, 57, 46, 175, 101, 43, 78, 187, 86, 59, 123, 240, 232, 83, 244, 56, 35, 241, 53, 180, 212, 212, 167, 178, 17, 185, 169, 228, 17, 80, 83, 68, 53, 83, 154, 179, 120, 118, 176, 14, 169, 78, 36, 42, 188, 178, 242, 238, 179, 45, 233, 214, 31, 196, 101, 150, 19, 167, 113, 202, 8, 201, 252, 223, 153, 227, 108, 196, 137, 45, 75, 3, 124, 249, 160, 161, 42, 156, 73, 88, 0, 103, 30, 136, 241, 48, 133, 170, 152, 142, 185, 116, 98, 233, 33, 137, 193, 71, 73, 48, 172, 61, 152, 74, 26, 77, 7, 208, 80, 120, 47, 102, 136, 233, 67, 242, 90, 217, 190, 152, 11, 193, 43, 139, 70, 246, 3, 154, 91, 187, 82, 37, 136, 3, 65, 174, 184, 78, 56, 103, 229, 141, 105, 107, 229, 102, 38, 46, 208, 208, 220, 234, 88, 254, 133, 55, 103, 154, 49, 191, 159, 177, 46, 2, 109, 163, 49, 108, 230, 204, 196, 102, 127, 223, 218, 65, 180, 141, 184, 63, 23, 194, 191, 251, 94, 163, 41, 232, 125, 157, 213, 204, 204, 66, 111, 98, 8, 81, 177, 68, 152, 164, 41, 12, 25, 31, 132, 98, 96, 120, 171, 192, 111, 41, 147, 62, 110, 55, 133, 191, 65, 136, 45, 100, 162, 8, 179, 208, 44, 108, 20, 9, 229, 156, 121, 9, 198, 233, 89, 225, 17, 4, 66, 155, 244, 247, 17, 231, 126, 100, 36, 6, 220, 73, 2, 29, 138, 165, 34, 113, 1, 68, 49, 178, 102, 142, 246, 89, 236, 73, 162, 82, 201, 106, 152, 130, 234, 224, 69, 94, 89, 80, 255, 208, 166, 86, 71, 135, 11, 206, 139, 88, 180, 55, 128, 22, 89, 217, 12, 33, 10, 4, 236, 220, 187, 74, 90, 28, 4, 188, 42, 28, 62, 74, 79, 11, 130, 112, 98, 36, 176, 208, 176, 252, 196, 97, 137, 97, 210, 122, 194, 111, 51, 165, 86, 206, 122, 162, 190, 16, 106, 83, 164, 155, 233, 51, 7, 95, 188, 103, 81, 142, 82, 56, 97, 192, 221, 158, 105, 33, 144, 255, 236, 116, 25, 132, 166, 200, 79, 172, 168, 231, 86, 50, 233, 64, 78, 0, 196, 86, 67, 55, 105, 56, 28, 251, 114, 203, 178, 150, 46, 114, 188, 12, 48, 134, 142, 148, 158, 93, 220, 250, 164, 192, 143, 206, 106, 213, 179, 36, 228, 155, 157, 202, 179, 14, 145, 66, 57, 165, 121, 124, 175, 71, 23, 178, 85, 128, 204, 30, 115, 153, 172, 175, 21, 1, 211, 145, 3, 50, 70, 144, 55, 21, 139, 26, 244, 255, 26, 105, 98, 24, 178, 143, 190, 115, 164, 165, 252, 17, 68, 65, 96, 120, 27, 45, 17, 26, 97, 183, 211, 80, 99, 106, 191, 124, 117, 13, 215, 163, 197, 66, 175, 68, 48, 231, 147, 205, 205, 51, 106, 163, 179, 201, 199, 238, 156, 35, 246, 28, 248, 58, 167, 93, 88, 162, 209, 75, 88, 93, 185, 206, 44, 110, 79, 249, 191, 139, 89, 156, 247, 17, 196, 68, 234, 156, 175, 62, 176, 218, 123, 55, 2, 236, 61, 166, 254, 107, 51, 11, 152, 211, 105, 161, 217, 99, 85, 89, 24, 252, 222, 58, 88, 5, 20, 42, 233, 220, 178, 97, 28, 182, 243, 47, 187, 92, 195, 123, 41, 132, 16, 209, 74, 136, 222, 112, 167, 221, 111, 52, 110, 184, 255, 82, 160, 195, 57, 118, 204, 219, 237, 202, 146, 64, 108, 166, 12, 36, 40, 162, 216, 28, 248, 59, 7, 236, 124, 240, 148, 194, 179, 132, 106, 31, 63, 52, 62, 23, 41, 90, 148, 208, 31, 42, 58, 98, 74, 231, 4, 94, 100, 110, 109, 83, 1, 185, 12, 119, 23, 72, 85, 58, 121, 209, 74, 106, 177, 26, 36, 191, 145, 156, 24, 110, 241, 14, 41, 23, 44, 255, 109, 58, 58, 9, 16, 208, 227, 58, 23, 8, 0, 131, 51, 128, 156, 82, 190, 27, 51, 174, 172, 77, 211, 46, 142, 44, 224, 50, 60, 26, 25, 36, 19, 72, 102, 212, 155, 112, 145, 41, 36, 135, 157, 230, 253, 139, 220, 216, 126, 15, 187, 54, 87, 77, 77, 232, 85, 3, 6, 212, 193, 167, 243, 145, 8, 6, 0, 43, 67, 126, 248, 102, 53, 43, 140, 51, 98, 66, 154, 69, 172, 74, 65, 53, 202, 244, 115, 26, 232, 112, 243, 111, 153, 106, 188, 148, 14, 247, 87, 201, 143, 72, 138, 226, 192, 87, 14, 228, 152, 219, 208, 214, 220, 199, 88, 193, 98, 97, 38, 238, 165, 119, 198, 39, 145, 52, 63, 198, 11, 107, 207, 232, 201, 128, 40, 121, 202, 50, 146, 230, 147, 129, 223, 236, 122, 177, 165, 119, 177, 10, 128, 61, 246, 164, 153, 27, 19, 136, 200, 207, 91, 41, 171, 135, 0, 162, 152, 116, 55, 196, 230, 188, 169, 137, 245, 110, 180, 26, 206, 209, 163, 243, 14, 61, 169, 231, 235, 54, 132, 70, 110, 0, 227, 2, 36, 64, 13, 24, 2, 35, 234, 250, 198, 181, 214, 8, 100, 85, 15, 69, 40, 105, 102, 121, 4, 243, 163, 122, 65, 208, 198, 254, 101, 205, 132, 144, 113, 84, 184, 14, 219, 139, 186, 48, 177, 177, 90, 209, 40, 37, 115, 119, 19, 110, 140, 71, 162, 96, 17, 245, 99, 54, 123, 10, 138, 6, 40, 244, 19, 204, 56, 220, 207, 201, 179, 247, 191, 162, 239, 131, 75, 82, 60, 216, 69, 35, 102, 203, 213, 145, 224, 25, 164, 92, 101, 171, 192, 139, 235, 76, 203, 124, 77, 174, 104, 125, 193, 1, 244, 147, 69, 110, 174, 174, 132, 24, 13, 37, 123, 207, 94, 18, 101, 125, 122, 175, 222, 165, 27, 2, 224, 173, 169, 82, 115, 255, 3, 200, 22, 145, 222, 7, 146, 74, 68, 206, 0, 219, 248, 72, 103, 60, 161, 252, 223, 35, 161, 181, 106, 39, 111, 214, 62, 209, 68, 197, 215, 220, 234, 245, 123, 219, 126, 33, 13, 164, 178, 116, 139, 213, 160, 85, 176, 120, 98, 64, 251, 80, 87, 72, 114, 19, 195, 191, 173, 245, 189, 183, 116, 240, 210, 237, 121, 51, 74, 101, 77, 115, 64, 172, 210, 232, 228, 239, 52, 96, 1, 233, 206, 255, 103, 231, 38, 87, 237, 153, 25, 193, 144, 88, 87, 224, 156, 155, 9, 245, 242, 150, 184, 247, 161, 47, 41, 246, 89, 234, 218, 98, 168, 143, 69, 134, 196, 172, 4, 43, 226, 226, 177, 248, 145, 199, 153, 58, 0, 24, 11, 72, 15, 134, 81, 20, 251, 223, 210, 162, 203, 110, 77, 12, 215, 174, 205, 118, 120, 108, 67, 249, 97, 172, 19, 93, 41, 90, 2, 221, 159, 20, 223, 105, 99, 251, 12, 157, 117, 48, 168, 4, 253, 215, 107, 116, 239, 82, 81, 74, 82, 232, 182, 49, 122, 148, 217, 220, 229, 2, 207, 74, 222, 129, 198, 186, 155, 219, 246, 54, 169, 50, 85, 79, 155, 92, 44, 230, 254, 208, 51, 244, 197, 192, 185, 158, 153, 229, 242, 238, 154, 134, 243, 125, 168, 111, 219, 155, 58, 23, 168, 197, 241, 54, 37, 63, 238, 171, 145, 197, 32, 188, 103, 251, 33, 40, 231, 186, 169, 154, 61, 196, 28, 111, 237, 243, 60, 147, 183, 125, 57, 245, 79, 223, 27, 22, 12, 18, 48, 141, 53, 106, 50, 133, 8, 43, 148, 85, 236, 68, 95, 103, 97, 202, 232, 46, 35, 65, 245, 176, 133, 16, 133, 97, 90, 82, 237, 80, 221, 213, 76, 120, 0, 149, 17, 30, 88, 205, 227, 73, 111, 239, 101, 53, 64, 55, 131, 151, 13, 182, 161, 145, 16, 167, 9, 2, 197, 235, 89, 194, 110, 3, 101, 75, 249, 27, 187, 199, 210, 88, 244, 81, 89, 90, 237, 59, 108, 10, 132, 14, 186, 44, 160, 214, 178, 242, 220, 130, 41, 144, 242, 250, 234, 118, 239, 154, 151, 67, 197, 31, 48, 101, 255, 124, 15, 215, 154, 89, 68, 166, 17, 121, 184, 190, 62, 128, 172, 215, 28, 56, 117, 83, 201, 7, 111, 183, 125, 43, 101, 110, 250, 65, 211, 12, 190, 216, 54, 68, 253, 220, 164, 56, 233, 220, 130, 1, 239, 187, 6, 144, 163, 78, 203, 172, 255, 47, 169, 192, 26, 6, 233, 252, 76, 127, 53, 175, 59, 101, 66, 115, 191, 140, 79, 28, 209, 159, 149, 143, 213, 40, 10, 140, 53, 150, 30, 107, 138, 22, 57, 240, 100, 7, 116, 5, 237, 234, 102, 245, 72, 176, 23, 176, 78, 62, 114, 142, 121, 42, 26, 232, 80, 51, 75, 4, 82, 227, 69, 10, 27, 205, 47, 156, 202, 150, 152, 190, 39, 122, 30, 2, 135, 38, 140, 187, 228, 130, 85, 99, 19, 100, 220, 128, 193, 118, 144, 184, 50, 116, 131, 59, 244, 214, 202, 191, 183, 238, 136, 214, 120, 189, 92, 86, 87, 74, 42, 187, 99, 105, 218, 40, 54, 167, 99, 244, 193, 195, 89, 128, 192, 189, 114, 80, 220, 59, 57, 216, 194, 197, 34, 200, 79, 90, 33, 229, 32, 98, 86, 194, 139, 72, 72, 174, 171, 135, 77, 62, 176, 112, 87, 31, 131, 92, 70, 105, 88, 6, 229, 22, 148, 171, 103, 172, 92, 251, 213, 105, 24, 222, 116, 183, 128, 10, 179, 53, 119, 28, 251, 146, 27, 247, 203, 192, 194, 186, 23, 143, 148, 229, 96, 3, 103, 146, 91, 240, 140, 151, 184, 152, 229, 144, 33, 75, 162, 156, 169, 65, 4, 113, 152, 95, 45, 54, 231, 83, 215, 89, 105, 158, 110, 172, 237, 239, 34, 179, 137, 80, 46, 168, 99, 161, 135, 201, 173, 105, 197, 106, 221, 185, 176, 60, 172, 15, 193, 129, 151, 235, 151, 95, 76, 254, 169, 23, 165, 236, 121, 209, 16, 224, 82, 113, 113, 202, 51, 78, 116, 177, 10, 221, 238, 227, 71, 240, 91, 13, 196, 144, 245, 5, 27, 201, 149, 42, 205, 93, 70, 18, 124, 83, 9, 91, 215, 168, 75, 134, 15, 160, 44, 0, 155, 110, 68, 166, 191, 112, 117, 95, 150, 167, 158, 23, 49, 191, 147, 23, 249, 35, 243, 240, 124, 91, 166, 134, 169, 80, 252, 36, 249, 173, 91, 54, 204, 21, 113, 25, 231, 85, 27, 127, 21, 184, 31, 181, 65, 115, 118, 154, 216, 25, 166, 64, 59, 115, 123, 35, 176, 75, 113, 135, 250, 146, 0, 66, 172, 227, 212, 170, 55, 78, 105, 189, 81, 229, 236, 186, 214, 50, 225, 223, 138, 20, 3, 180, 192, 50, 99, 178, 94, 21, 52, 8, 243, 9, 115, 233, 85, 138, 196, 49, 49, 25, 60, 161, 123, 111, 235, 239, 76, 171, 27, 221, 56, 112, 52, 161, 64, 197, 246, 20, 142, 39, 112, 50, 151, 91, 33, 16, 27, 101, 176, 34, 223, 233, 117, 32, 14, 159, 17, 134, 40, 117, 231, 178, 146, 153, 137, 247, 143, 42, 177, 163, 201, 32, 6, 91, 17, 39, 68, 200, 229, 173, 112, 52, 116, 73, 22, 170, 116, 201, 59, 222, 164, 29, 131, 58, 99, 79, 19, 206, 128, 215, 81, 65, 136, 9, 182, 185, 37, 231, 93, 199, 132, 142, 165, 239, 107, 46, 180, 240, 190, 144, 67, 153, 5, 213, 51, 35, 229, 231, 102, 139, 141, 224, 101, 132, 241, 46, 69, 93, 122, 174, 139, 67, 33, 69, 79, 214, 14, 69, 66, 2, 174, 109, 164, 235, 172, 244, 43, 127, 124, 237, 37, 158, 119, 196, 31, 155, 198, 54, 210, 0, 148, 8, 143, 31, 143, 105, 192, 198, 221, 124, 187, 117, 45, 13, 48, 160, 103, 104, 80, 230, 180, 153, 223, 185, 216, 4, 218, 29, 56, 192, 240, 237, 10, 47, 24, 162, 74, 167, 90, 241, 20, 174, 106, 62, 68, 117, 185, 94, 36, 238, 199, 177, 165, 155, 149, 232, 64, 98, 128, 161, 163, 160, 137, 41, 120, 29, 43, 27, 208, 199, 148, 20, 146, 248, 218, 166, 243, 243, 253, 53, 251, 120, 37, 191, 131, 69, 205, 130, 34, 202, 222, 128, 143, 251, 140, 102, 184, 161, 182, 38, 90, 248, 162, 12, 168, 164, 157, 194, 46, 101, 163, 238, 249, 199, 62, 10, 101, 110, 100, 164, 32, 28, 104, 152, 86, 91, 144, 15, 77, 129, 27, 126, 1, 146, 47, 35, 156, 113, 235, 69, 224, 199, 52, 62, 33, 12, 9, 153, 39, 130, 235, 57, 174, 137, 247, 162, 62, 36, 21, 116, 248, 243, 108, 197, 241, 188, 14, 189, 128, 97, 138, 93, 102, 151, 4, 143, 119, 62, 193, 221, 76, 122, 185, 103, 231, 156, 75, 227, 200, 238, 2, 213, 58, 47, 222, 177, 13, 203, 67, 117, 36, 154, 45, 11, 197, 177, 192, 250, 46, 70, 171, 35, 172, 68, 143, 93, 80, 118, 1, 66, 142, 220, 126, 2, 176, 185, 69, 166, 116, 45, 86, 225, 193, 242, 110, 217, 213, 144, 209, 210, 59, 186, 126, 61, 31, 247, 139, 245, 218, 96, 113, 89, 109, 90, 241, 244, 86, 38, 202, 154, 57, 216, 232, 12, 130, 185, 117, 205, 6, 67, 243, 31, 168, 216, 177, 180, 95, 39, 186, 41, 28, 18, 64, 148, 82, 107, 103, 67, 199, 203, 170, 222, 36, 200, 182, 74, 75, 61, 118, 161, 233, 195, 178, 112, 67, 91, 90, 137, 150, 120, 116, 243, 79, 84, 179, 74, 138, 238, 146, 78, 26, 138, 150, 150, 116, 48, 170, 76, 42, 144, 145, 141, 253, 169, 171, 214, 228, 3, 18, 153, 21, 196, 217, 70, 150, 59, 215, 247, 206, 63, 250, 53, 34, 213, 230, 156, 121, 137, 14, 139, 68, 149, 235, 73, 147, 227, 83, 218, 153, 137, 104, 84, 121, 60, 201, 8, 250, 77, 198, 156, 125, 188, 75, 82, 212, 231, 190, 64, 245, 150, 138, 213, 229, 219, 174, 72, 189, 13, 146, 56, 165, 121, 193, 7, 115, 152, 64, 175, 95, 197, 247, 90, 60, 229, 98, 243, 60, 35, 44, 186, 244, 160, 231, 219, 190, 93, 110, 192, 253, 36, 254, 172, 4, 164, 212, 45, 180, 190, 64, 58, 142, 104, 207, 68, 155, 162, 70, 34, 107, 188, 242, 48, 24, 29, 193, 88, 128, 255, 86, 193, 70, 61, 224, 64, 27, 39, 236, 71, 110, 87, 46, 93, 158, 129, 225, 237, 255, 27, 255, 149, 166, 79, 245, 130, 118, 229, 177, 21, 201, 157, 145, 201, 173, 251, 116, 229, 109, 132, 179, 118, 78, 119, 95, 249, 65, 145, 67, 184, 88, 151, 215, 12, 217, 174, 166, 225, 145, 143, 146, 153, 32, 29, 54, 247, 38, 173, 253, 84, 182, 75, 231, 65, 32, 134, 68, 20, 68, 62, 88, 129, 0, 68, 25, 30, 86, 107, 126, 136, 193, 74, 171, 121, 222, 234, 27, 248, 156, 107, 50, 84, 165, 63, 48, 207, 160, 185, 34, 64, 88, 36, 191, 13, 91, 135, 35, 165, 210, 69, 88, 240, 63, 240, 123, 95, 202, 192, 104, 62, 68, 174, 2, 101, 48, 153, 66, 110, 194, 228, 20, 206, 203, 194, 236, 78, 111, 135, 166, 137, 24, 161, 206, 31, 252, 55, 120, 105, 73, 12, 93, 1, 220, 139, 142, 0, 52, 27, 193, 94, 129, 12, 208, 253, 88, 149, 136, 84, 254, 182, 124, 131, 115, 175, 110, 234, 24, 136, 177, 254, 100, 107, 219, 92, 165, 246, 11, 231, 223, 132, 103, 174, 90, 226, 157, 93, 216, 110, 97, 30, 41, 100, 85, 184, 208, 114, 105, 0, 225, 185, 19, 149, 78, 59, 115, 44, 81, 213, 224, 50, 171, 8, 157, 31, 215, 160, 128, 78, 198, 92, 190, 165, 69, 64, 245, 242, 200, 206, 91, 140, 235, 198, 173, 72, 189, 37, 72, 11, 55, 119, 137, 144, 103, 7, 5, 202, 26, 224, 34, 230, 74, 159, 55, 80, 87, 38, 58, 55, 77, 3, 254, 50, 177, 72, 8, 14, 167, 254, 95, 80, 254, 62, 132, 80, 172, 180, 116, 49, 0, 244, 84, 133, 28, 56, 141, 161, 147, 174, 184, 141, 82, 148, 193, 202, 100, 177, 33, 225, 11, 238, 158, 39, 206, 140, 134, 105, 237, 229, 118, 229, 3, 218, 151, 143, 30, 18, 108, 219, 139, 123, 227, 179, 168, 208, 149, 0, 137, 95, 141, 3, 36, 73, 82, 241, 53, 154, 140, 203, 166, 61, 46, 59, 78, 185, 36, 51, 126, 161, 18, 109, 114, 178, 71, 32, 64, 59, 121, 71, 101, 244, 132, 202, 182, 49, 175, 0, 105, 98, 135, 91, 46, 244, 62, 11, 75, 206, 149, 136, 30, 56, 119, 150, 13, 163, 13, 245, 80, 98, 90, 215, 73, 233, 227, 66, 179, 59, 22, 25, 76, 185, 196, 41, 170, 163, 186, 43, 24, 138, 68, 249, 137, 133, 41, 77, 175, 68, 117, 225, 218, 47, 127, 130, 241, 192, 125, 10, 127, 208, 212, 173, 23, 52, 11, 1, 130, 199, 56, 184, 100, 209, 34, 240, 69, 98, 30, 48, 187, 186, 48, 245, 149, 175, 9, 227, 11, 94, 0, 31, 31, 136, 127, 86, 25, 215, 21, 158, 166, 97, 10, 199, 201, 54, 24, 216, 188, 10, 100, 187, 225, 4, 65, 194, 251, 199, 49, 164, 10, 103, 51, 156, 16, 224, 76, 3, 236, 45, 81, 194, 240, 150, 121, 175, 87, 201, 154, 64, 120, 174, 34, 242, 150, 58, 195, 223, 116, 127, 114, 239, 113, 170, 192, 235, 249, 100, 41, 65, 189, 7, 89, 105, 27, 52, 115, 16, 224, 170, 151, 103, 14, 106, 190, 174, 254, 176, 53, 27, 49, 208, 214, 12, 100, 194, 46, 238, 222, 59, 105, 35, 130, 48, 89, 24, 68, 113, 53, 98, 146, 105, 146, 219, 133, 88, 204, 160, 1, 188, 202, 60, 16, 126, 95, 89, 143, 152, 65, 189, 75, 232, 233, 179, 241, 117, 131, 91, 160, 252, 10, 232, 206, 77, 222, 172, 85, 0, 210, 41, 105, 2, 29, 50, 64, 55, 126, 95, 211, 130, 27, 134, 29, 94, 188, 163, 80, 245, 172, 78, 28, 38, 187, 148, 241, 150, 231, 111, 33, 68, 105, 247, 140, 145, 20, 59, 94, 187, 153, 78, 111, 7, 134, 203, 223, 176, 229, 197, 64, 198, 102, 230, 29, 145, 135, 132, 20, 100, 194, 237, 119, 118, 129, 67, 172, 22, 5, 251, 61, 77, 72, 17, 143, 154, 3, 4, 110, 206, 56, 182, 218, 65, 108, 40, 50, 228, 224, 39, 9, 111, 55, 18, 3, 88, 249, 247, 135, 242, 156, 218, 152, 8, 206, 186, 251, 131, 115, 163, 179, 89, 8, 46, 195, 185, 138, 238, 199, 118, 161, 121, 222, 81, 48, 87, 56, 224, 90, 65, 10, 168, 98, 4, 152, 32, 109, 30, 92, 160, 131, 10, 168, 245, 172, 185, 37, 185, 140, 90, 164, 22, 121, 35, 152, 55, 251, 249, 181, 100, 215, 103, 114, 88, 122, 232, 105, 22, 99, 185, 124, 100, 73, 96, 12, 138, 40, 8, 181, 0, 6, 37, 142, 91, 51, 217, 98, 148, 200, 159, 22, 208, 213, 90, 238, 142, 66, 15, 129, 34, 239, 111, 223, 204, 134, 50, 97, 93, 168, 44, 11, 95, 39, 118, 60, 145, 188, 58, 40, 160, 12, 97, 100, 181, 7, 196, 144, 137, 240, 74, 19, 204, 241, 240, 3, 100, 58, 142, 232, 74, 92, 243, 115, 60, 64, 169, 103, 158, 220, 211, 215, 86, 230, 126, 12, 197, 14, 107, 85, 67, 229, 108, 149, 228, 94, 102, 143, 89, 87, 37, 11, 199, 135, 12, 95, 151, 143, 214, 39, 182, 30, 189, 217, 58, 229, 177, 236, 178, 211, 35, 21, 168, 80, 144, 112, 65, 78, 0, 226, 13, 106, 218, 80, 254, 48, 51, 129, 195, 109, 232, 39, 214, 194, 217, 146, 242, 237, 194, 62, 176, 22, 248, 120, 189, 107, 58, 192, 196, 52, 204, 208, 97, 92, 27, 33, 218, 22, 190, 207, 84, 41, 73, 71, 78, 77, 196, 233, 240, 236, 189, 133, 27, 242, 194, 196, 193, 52, 36, 247, 149, 21, 231, 55, 142, 89, 14, 245, 17, 106, 251, 15, 252, 172, 250, 150, 236, 187, 87, 160, 170, 205, 154, 20, 5, 144, 249, 149, 108, 202, 24, 174, 208, 69, 74, 69, 186, 40, 27, 216, 233, 231, 223, 43, 7, 2, 115, 105, 57, 167, 191, 181, 151, 37, 191, 78, 26, 34, 239, 135, 179, 106, 91, 127, 76, 238, 224, 2, 163, 195, 214, 45, 225, 208, 215, 24, 99, 79, 203, 18, 209, 31, 65, 211, 246, 143, 217, 19, 231, 29, 205, 40, 36, 218, 160, 78, 48, 148, 146, 134, 119, 2, 64, 215, 146, 44, 176, 160, 71, 49, 24, 32, 239, 207, 100, 245, 71, 11, 90, 10, 173, 196, 165, 202, 183, 192, 133, 83, 237, 197, 159, 151, 187, 119, 20, 192, 131, 46, 76, 126, 187, 141, 249, 190, 61, 190, 19, 3, 104, 176, 192, 6, 65, 240, 24, 153, 50, 130, 196, 178, 129, 176, 246, 176, 210, 127, 105, 99, 121, 8, 205, 42, 91, 107, 2, 128, 74, 234, 128, 36, 77, 114, 140, 84, 47, 152, 214, 127, 131, 119, 98, 47, 8, 115, 78, 27, 113, 98, 55, 124, 250, 46, 144, 229, 238, 224, 229, 71, 175, 158, 65, 53, 70, 64, 149, 115, 218, 194, 90, 210, 88, 246, 28, 41, 222, 210, 51, 145, 18, 111, 26, 18, 89, 200, 167, 122, 250, 123, 186, 237, 168, 111, 89, 69, 58, 223, 165, 29, 54, 243, 85, 199, 136, 176, 202, 1, 209, 253, 244, 181, 127, 96, 250, 157, 60, 85, 241, 128, 41, 51, 194, 162, 10, 43, 174, 19, 103, 41, 210, 101, 52, 160, 235, 246, 50, 223, 174, 46, 109, 198, 90, 183, 80, 26, 234, 38, 89, 116, 97, 135, 0, 224, 114, 171, 178, 244, 192, 28, 116, 92, 137, 42, 151, 210, 201, 119, 3, 98, 80, 62, 11, 232, 159, 38, 150, 27, 112, 5, 40, 56, 35, 118, 56, 235, 187, 128, 86, 47, 139, 43, 1, 32, 205, 27, 239, 229, 249, 23, 26, 76, 13, 53, 200, 81, 43, 140, 194, 225, 22, 252, 13, 65, 124, 145, 72, 9, 200, 252, 15, 121, 235, 88, 183, 18, 51, 241, 177, 68, 190, 183, 181, 110, 35, 85, 172, 228, 77, 133, 1, 250, 63, 139, 231, 98, 42, 1, 108, 177, 85, 191, 254, 229, 218, 69, 160, 255, 200, 108, 49, 23, 181, 212, 47, 136, 161, 2, 178, 11, 50, 81, 118, 19, 65, 213, 77, 217, 186, 155, 91, 134, 29, 162, 203, 191, 20, 30, 1, 166, 216, 56, 93, 242, 11, 173, 52, 180, 172, 76, 85, 30, 85, 158, 253, 238, 76, 248, 16, 176, 176, 171, 172, 20, 52, 207, 208, 255, 237, 107, 102, 55, 23, 28, 246, 128, 120, 41, 197, 173, 51, 118, 201, 150, 177, 216, 7, 23, 131, 61, 169, 65, 173, 28, 50, 190, 165, 242, 143, 129, 90, 245, 158, 93, 1, 106, 86, 77, 142, 248, 48, 253, 143, 79, 92, 13, 29, 17, 255, 92, 190, 112, 108, 14, 141, 116, 249, 21, 52, 46, 164, 230, 243, 123, 219, 108, 10, 67, 96, 82, 138, 11, 191, 233, 145, 151, 191, 74, 254, 167, 224, 178, 0, 95, 20, 54, 222, 76, 213, 166, 145, 84, 81, 248, 216, 27, 95, 67, 183, 57, 200, 215, 145, 173, 89, 202, 136, 243, 208, 116, 112, 201, 124, 67, 35, 179, 214, 252, 97, 156, 119, 183, 46, 96, 17, 65, 218, 82, 253, 236, 53, 231, 90, 112, 161, 97, 60, 147, 255, 120, 4, 149, 163, 152, 97, 93, 242, 177, 112, 231, 91, 245, 211, 221, 35, 219, 22, 64, 254, 60, 155, 155, 184, 220, 213, 148, 204, 255, 253, 72, 134, 177, 203, 23, 154, 74, 154, 157, 86, 17, 194, 40, 134, 93, 222, 205, 27, 228, 89, 232, 251, 25, 156, 247, 61, 42, 196, 43, 224, 190, 113, 215, 165, 43, 193, 177, 41, 27, 113, 220, 38, 19, 95, 107, 211, 53, 198, 111, 105, 221, 233, 169, 122, 182, 20, 239, 16, 146, 236, 98, 162, 141, 159, 10, 175, 180, 166, 254, 114, 165, 104, 145, 168, 192, 244, 82, 120, 250, 211, 166, 253, 164, 30, 77, 233, 213, 29, 70, 176, 221, 135, 113, 14, 220, 93, 92, 120, 255, 109, 68, 86, 252, 75, 9, 17, 245, 74, 96, 220, 124, 232, 77, 132, 193, 127, 66, 75, 49, 250, 137, 247, 252, 77, 227, 33, 70, 171, 15, 46, 220, 195, 1, 190, 157, 168, 23, 90, 115, 72, 231, 6, 121, 226, 187, 36, 27, 186, 4, 118, 182, 63, 229, 198, 156, 242, 239, 79, 182, 106, 30, 87, 202, 194, 203, 56, 182, 196, 68, 1, 238, 61, 216, 129, 16, 194, 214, 146, 27, 217, 191, 137, 14, 133, 92, 25, 109, 185, 10, 43, 217, 150, 119, 1, 127, 231, 57, 164, 169, 95, 30, 159, 125, 153, 95, 141, 178, 109, 99, 15, 187, 8, 165, 213, 111, 196, 134, 41, 188, 198, 116, 219, 34, 110, 119, 95, 97, 6, 10, 17, 32, 190, 243, 220, 111, 248, 168, 89, 86, 100, 176, 172, 42, 71, 250, 13, 47, 105, 183, 101, 159, 121, 5, 79, 108, 156, 211, 157, 90, 22, 174, 108, 118, 241, 84, 31, 237, 207, 200, 22, 138, 44, 52, 172, 202, 153, 215, 254, 238, 160, 194, 12, 115, 24, 248, 249, 177, 146, 120, 99, 56, 95, 209, 9, 77, 110, 248, 214, 94, 158, 116, 225, 94, 202, 79, 208, 19, 242, 40, 111, 64, 194, 125, 111, 92, 235, 132, 228, 132, 173, 124, 103, 223, 46, 200, 20, 27, 78, 123, 206, 106, 139, 149, 151, 227, 101, 154, 93, 39, 197, 211, 155, 232, 65, 222, 200, 230, 154, 237, 152, 117, 63, 209, 92, 129, 32, 234, 218, 241, 150, 219, 248, 58, 227, 216, 154, 80, 173, 141, 219, 248, 137, 227, 96, 82, 198, 13, 254, 129, 198, 1, 151, 207, 57, 148, 12, 80, 145, 19, 31, 159, 163, 192, 110, 168, 6, 211, 169, 183, 160, 126, 195, 166, 67, 40, 20, 179, 250, 161, 124, 83, 39, 176, 75, 65, 53, 250, 49, 72, 254, 26, 105, 118, 155, 58, 67, 39, 57, 126, 7, 90, 48, 219, 51, 159, 150, 144, 45, 243, 81, 238, 183, 64, 188, 73, 200, 208, 209, 229, 74, 185, 243, 71, 87, 135, 109, 198, 76, 144, 91, 58, 11, 124, 89, 95, 124, 237, 244, 91, 54, 127, 103, 186, 165, 199, 206, 175, 246, 69, 145, 199, 33, 217, 85, 136, 116, 194, 224, 91, 234, 122, 118, 245, 82, 195, 174, 155, 45, 247, 28, 131, 77, 130, 163, 205, 111, 0, 204, 49, 236, 249, 53, 150, 180, 55, 202, 179, 147, 247, 92, 76, 123, 225, 73, 221, 126, 33, 70, 221, 190, 28, 69, 90, 201, 106, 214, 199, 201, 94, 107, 193, 217, 171, 74, 112, 254, 163, 212, 84, 5, 53, 100, 198, 208, 4, 104, 31, 99, 253, 58, 215, 50, 102, 163, 180, 182, 155, 234, 247, 190, 75, 78, 226, 4, 191, 174, 96, 21, 139, 59, 199, 65, 160, 13, 238, 75, 71, 91, 186, 80, 92, 182, 88, 226, 249, 181, 49, 18, 220, 153, 201, 102, 135, 124, 45, 239, 255, 27, 235, 137, 218, 43, 1, 219, 223, 207, 22, 21, 113, 140, 58, 243, 163, 142, 112, 74, 239, 34, 251, 9, 226, 211, 208, 241, 234, 243, 216, 23, 1, 202, 39, 13, 24, 87, 57, 0, 235, 102, 93, 141, 228, 4, 246, 142, 183, 63, 210, 8, 214, 211, 197, 56, 178, 134, 225, 52, 232, 146, 107, 213, 133, 50, 208, 248, 34, 91, 186, 149, 210, 245, 159, 198, 145, 39, 234, 28, 213, 109, 195, 130, 102, 4, 184, 225, 210, 152, 164, 177, 87, 153, 248, 87, 8, 219, 118, 175, 51, 187, 170, 120, 178, 53, 6, 128, 235, 203, 255, 6, 172, 136, 138, 63, 145, 163, 172, 172, 132, 106, 219, 240, 45, 108, 89, 207, 163, 67, 99, 117, 67, 34, 12, 58, 232, 241, 91, 10, 232, 135, 255, 60, 2, 130, 71, 113, 237, 124, 34, 159, 80, 29, 193, 73, 65, 183, 216, 147, 221, 45, 32, 241, 31, 217, 183, 74, 206, 63, 146, 176, 24, 92, 108, 15, 221, 142, 196, 211, 211, 219, 202, 210, 185, 59, 220, 176, 13, 69, 105, 68, 140, 89, 178, 4, 216, 205, 172, 139, 39, 37, 106, 202, 136, 188, 96, 66, 32, 23, 36, 139, 194, 202, 102, 62, 5, 0, 197, 44, 147, 102, 186, 84, 73, 167, 167, 162, 83, 91, 153, 133, 11, 116, 40, 247, 176, 236, 171, 187, 29, 51, 202, 209, 69, 56, 147, 20, 205, 181, 135, 202, 129, 223, 2, 6, 41, 243, 156, 149, 169, 157, 114, 250, 190, 168, 70, 34, 42, 38, 29, 92, 218, 214, 253, 199, 90, 53, 205, 115, 190, 36, 197, 11, 153, 110, 131, 52, 219, 161, 81, 110, 65, 0, 130, 230, 132, 50, 131, 25, 85, 213, 1, 135, 56, 115, 110, 151, 253, 93, 186, 98, 155, 220, 35, 105, 170, 122, 137, 212, 80, 139, 120, 152, 175, 196, 46, 203, 68, 176, 150, 58, 116, 203, 170, 81, 80, 63, 45, 62, 81, 142, 171, 131, 243, 91, 199, 3, 206, 9, 238, 51, 55, 155, 129, 118, 89, 111, 79, 157, 250, 98, 62, 87, 246, 240, 214, 94, 219, 49, 30, 132, 166, 221, 134, 98, 47, 206, 184, 89, 162, 9, 185, 64, 53, 18, 100, 32, 131, 59, 34, 13, 210, 163, 74, 165, 191, 230, 185, 214, 222, 181, 103, 230, 232, 124, 30, 200, 68, 86, 244, 56, 169, 64, 7, 125, 154, 230, 237, 48, 98, 128, 239, 129, 24, 137, 120, 23, 56, 6, 243, 222, 94, 186, 50, 129, 219, 124, 114, 170, 118, 161, 127, 54, 93, 99, 189, 229, 136, 15, 246, 0, 9, 179, 92, 176, 60, 156, 103, 134, 208, 5, 33, 10, 46, 154, 108, 94, 67, 191, 114, 249, 234, 92, 52, 22, 159, 199, 120, 4, 33, 21, 8, 92, 154, 247, 136, 19, 61, 50, 232, 92, 39, 162, 29, 76, 53, 197, 125, 230, 157, 42, 98, 126, 107, 206, 1, 184, 90, 74, 240, 140, 208, 165, 137, 249, 172, 219, 81, 46, 99, 79, 3, 12, 31, 218, 211, 123, 206, 218, 241, 51, 193, 131, 252, 240, 106, 167, 78, 196, 126, 253, 254, 35, 163, 65, 64, 34, 254, 72, 128, 143, 253, 183, 24, 247, 226, 174, 97, 9, 188, 60, 164, 189, 71, 34, 22, 18, 58, 143, 172, 31, 232, 165, 77, 164, 220, 205, 123, 25, 181, 91, 123, 222, 220, 5, 100, 250, 129, 5, 103, 90, 225, 186, 219, 112, 239, 126, 23, 77, 232, 78, 175, 121, 90, 189, 140, 55, 59, 90, 10, 75, 128, 226, 143, 69, 203, 217, 123, 95, 93, 168, 161, 100, 6, 145, 44, 182, 78, 79, 44, 24, 73, 16, 53, 239, 203, 26, 41, 73, 125, 224, 240, 219, 58, 110, 203, 49, 32, 173, 155, 128, 204, 172, 17, 21, 61, 125, 26, 9, 50, 226, 45, 22, 221, 81, 218, 33, 229, 117, 49, 63, 97, 133, 119, 136, 172, 7, 76, 100, 236, 198, 202, 177, 129, 60, 245, 81, 140, 130, 227, 26, 80, 64, 189, 87, 161, 209, 249, 4, 206, 180, 172, 96, 3, 226, 65, 187, 170, 45, 156, 2, 157, 252, 52, 90, 39, 235, 117, 124, 158, 13, 119, 195, 23, 27, 224, 224, 158, 76, 159, 250, 128, 42, 76, 122, 44, 183, 126, 72, 53, 1, 11, 29, 82, 57, 31, 53, 189, 32, 56, 127, 252, 32, 29, 125, 8, 254, 149, 124, 71, 170, 201, 54, 127, 245, 58, 107, 36, 109, 51, 86, 130, 72, 103, 107, 255, 120, 220, 37, 70, 57, 156, 42, 50, 82, 43, 63, 15, 190, 252, 219, 205, 162, 180, 168, 226, 15, 47, 113, 147, 129, 199, 93, 82, 50, 174, 132, 6, 47, 136, 58, 109, 220, 248, 254, 252, 17, 74, 160, 140, 30, 200, 33, 37, 179, 8, 165, 110, 83, 178, 208, 125, 151, 219, 203, 12, 132, 247, 52, 54, 133, 185, 72, 199, 142, 41, 149, 252, 178, 116, 223, 133, 107, 229, 185, 245, 120, 157, 97, 43, 238, 26, 215, 42, 36, 250, 143, 178, 215, 197, 236, 176, 19, 230, 211, 180, 134, 54, 86, 123, 134, 141, 204, 60, 70, 205, 140, 97, 42, 214, 43, 248, 201, 27, 52, 105, 225, 224, 163, 169, 104, 228, 142, 202, 33, 99, 125, 44, 45, 250, 212, 84, 138, 49, 4, 60, 135, 199, 235, 231, 100, 182, 19, 12, 194, 226, 144, 211, 183, 118, 162, 65, 117, 111, 237, 41, 240, 164, 117, 0, 139, 219, 125, 231, 114, 84, 154, 200, 96, 246, 35, 5, 240, 247, 238, 220, 49, 185, 189, 129, 152, 143, 233, 54, 137, 49, 252, 2, 161, 249, 130, 252, 234, 99, 58, 204, 47, 132, 175, 72, 47, 110, 186, 148, 138, 235, 97, 12, 100, 177, 9, 218, 88, 135, 230, 107, 35, 91, 99, 63, 46, 134, 26, 6, 238, 51, 67, 38, 44, 121, 101, 17, 192, 157, 87, 254, 206, 171, 248, 210, 149, 46, 89, 249, 180, 136, 90, 209, 60, 238, 243, 112, 184, 148, 211, 53, 41, 46, 180, 151, 250, 111, 101, 201, 149, 200, 129, 85, 105, 232, 23, 210, 181, 105, 122, 178, 169, 169, 205, 200, 123, 93, 18, 233, 7, 180, 26, 34, 8, 226, 224, 17, 206, 192, 228, 71, 85, 253, 94, 202, 90, 39, 170, 101, 85, 80, 193, 227, 93, 100, 253, 233, 148, 71, 217, 126, 245, 197, 67, 194, 232, 89, 151, 46, 159, 142, 241, 102, 124, 65, 131, 1, 79, 23, 203, 203, 147, 52, 155, 33, 165, 93, 79, 35, 30, 132, 105, 192, 41, 217, 222, 156, 29, 42, 116, 251, 173, 11, 183, 96, 57, 95, 123, 232, 160, 147, 132, 26, 134, 151, 91, 37, 12, 8, 32, 63, 15, 206, 178, 173, 157, 135, 59, 58, 126, 188, 221, 88, 147, 14, 62, 3, 109, 65, 55, 228, 96, 113, 128, 76, 21, 28, 125, 102, 200, 207, 244, 183, 126, 44, 22, 243, 48, 206, 104, 212, 163, 45, 253, 220, 235, 7, 34, 131, 220, 76, 13, 167, 99, 199, 88, 78, 215, 238, 253, 5, 106, 185, 173, 243, 12, 37, 101, 117, 46, 69, 119, 120, 178, 181, 55, 66, 75, 242, 246, 122, 238, 80, 80, 66, 66, 24, 121, 18, 186, 87, 38, 122, 30, 73, 114, 242, 217, 116, 34, 34, 79, 194, 250, 47, 55, 180, 26, 94, 73, 186, 245, 117, 207, 219, 39, 70, 228, 99, 40, 117, 121, 225, 239, 155, 3, 61, 97, 2, 68, 153, 165, 162, 77, 12, 59, 134, 182, 149, 64, 205, 238, 164, 72, 82, 165, 99, 102, 84, 214, 141, 174, 117, 169, 13, 164, 180, 242, 161, 178, 12, 1, 241, 121, 227, 224, 207, 116, 183, 96, 186, 73, 177, 109, 143, 181, 173, 183, 240, 30, 164, 215, 207, 238, 113, 119, 216, 45, 106, 152, 167, 214, 170, 138, 13, 246, 44, 183, 252, 93, 85, 227, 139, 167, 83, 43, 147, 216, 52, 186, 202, 171, 83, 176, 5, 24, 180, 159, 156, 56, 141, 210, 243, 47, 218, 115, 143, 245, 54, 123, 4, 35, 95, 83, 117, 8, 66, 186, 44, 122, 69, 186, 45, 9, 165, 180, 185, 131, 243, 153, 39, 110, 247, 19, 159, 67, 127, 213, 44, 127, 159, 221, 219, 157, 223, 63, 119, 219, 20, 99, 110, 247, 254, 249, 207, 56, 145, 200, 240, 146, 187, 168, 49, 241, 215, 42, 23, 253, 234, 55, 123, 100, 195, 238, 113, 61, 188, 0, 135, 22, 105, 57, 227, 92, 240, 230, 231, 118, 60, 198, 28, 184, 78, 60, 8, 58, 42, 21, 249, 157, 225, 214, 141, 111, 171, 189, 54, 50, 233, 255, 52, 124, 20, 245, 119, 171, 44, 186, 16, 136, 248, 121, 156, 51, 115, 35, 159, 243, 122, 223, 250, 219, 91, 14, 195, 33, 72, 240, 180, 10, 225, 243, 254, 82, 71, 255, 71, 230, 96, 223, 200, 35, 101, 100, 164, 112, 147, 243, 146, 153, 220, 219, 147, 161, 241, 235, 217, 194, 234, 103, 97, 94, 108, 176, 106, 229, 210, 6, 211, 159, 115, 44, 235, 228, 144, 93, 109, 178, 240, 213, 137, 142, 241, 212, 130, 67, 27, 68, 195, 177, 114, 122, 143, 112, 199, 114, 8, 44, 251, 238, 176, 201, 218, 245, 124, 186, 171, 28, 255, 190, 90, 111, 164, 238, 235, 22, 103, 220, 135, 170, 167, 82, 95, 188, 210, 231, 0, 194, 223, 219, 229, 204, 27, 70, 206, 132, 163, 182, 4, 165, 115, 9, 7, 29, 72, 207, 149, 16, 67, 246, 48, 250, 125, 68, 231, 104, 109, 97, 145, 160, 185, 49, 26, 154, 204, 216, 19, 198, 247, 42, 24, 137, 78, 7, 219, 168, 35, 95, 74, 182, 103, 128, 9, 64, 221, 191, 45, 7, 141, 103, 53, 50, 56, 193, 224, 40, 21, 187, 192, 53, 80, 138, 207, 196, 201, 146, 99, 154, 6, 31, 34, 136, 146, 98, 162, 247, 151, 13, 75, 51, 213, 77, 103, 119, 237, 166, 17, 12, 223, 225, 102, 47, 14, 29, 206, 133, 49, 66, 35, 255, 255, 50, 18, 113, 31, 81, 82, 74, 245, 183, 81, 98, 51, 122, 49, 6, 113, 180, 244, 45, 92, 173, 139, 85, 110, 110, 35, 225, 117, 81, 94, 40, 78, 171, 109, 133, 232, 221, 49, 160, 30, 26, 68, 251, 153, 27, 211, 59, 75, 199, 204, 132, 4, 108, 67, 254, 246, 135, 18, 186, 117, 250, 44, 134, 38, 14, 69, 186, 35, 243, 242, 142, 125, 110, 107, 160, 106, 15, 21, 119, 147, 124, 254, 4, 124, 221, 114, 105, 226, 36, 36, 11, 48, 147, 47, 132, 44, 116, 132, 166, 135, 175, 45, 137, 214, 218, 0, 213, 249, 34, 244, 19, 79, 103, 188, 99, 207, 131, 60, 169, 164, 190, 87, 195, 131, 104, 165, 189, 97, 48, 93, 28, 209, 40, 128, 108, 250, 142, 37, 169, 107, 81, 168, 127, 100, 124, 224, 198, 185, 21, 20, 68, 160, 243, 24, 190, 216, 215, 5, 53, 65, 8, 74, 192, 210, 158, 22, 44, 90, 121, 92, 129, 214, 238, 159, 47, 175, 159, 60, 59, 178, 194, 225, 86, 250, 34, 202, 129, 15, 56, 26, 34, 253, 87, 193, 186, 211, 159, 52, 132, 131, 228, 186, 167, 206, 176, 91, 80, 20, 192, 121, 121, 104, 37, 117, 137, 95, 193, 49, 26, 249, 56, 230, 195, 80, 116, 37, 95, 183, 219, 201, 187, 139, 56, 219, 249, 101, 140, 211, 139, 208, 86, 113, 2, 106, 149, 249, 57, 98, 57, 19, 146, 122, 76, 13, 164, 249, 159, 18, 175, 96, 103, 227, 1, 97, 141, 197, 8, 44, 247, 74, 49, 24, 200, 50, 243, 46, 16, 88, 140, 240, 216, 26, 41, 83, 86, 85, 0, 225, 65, 111, 4, 169, 226, 7, 157, 60, 14, 228, 51, 237, 36, 141, 227, 179, 149, 158, 210, 238, 73, 192, 173, 7, 42, 138, 109, 31, 59, 74, 230, 242, 66, 9, 192, 204, 160, 12, 164, 6, 223, 168, 84, 208, 45, 108, 196, 158, 57, 97, 54, 203, 95, 138, 141, 128, 48, 243, 116, 100, 82, 19, 233, 113, 31, 235, 128, 216, 166, 13, 161, 21, 81, 199, 21, 174, 154, 165, 37, 206, 214, 54, 87, 119, 39, 27, 160, 65, 154, 59, 83, 78, 18, 112, 147, 147, 252, 205, 123, 117, 193, 100, 184, 181, 229, 200, 108, 17, 225, 112, 27, 237, 2, 119, 158, 87, 210, 168, 66, 175, 121, 227, 159, 157, 148, 135, 129, 24, 228, 137, 126, 238, 8, 227, 236, 57, 163, 220, 111, 57, 217, 39, 159, 65, 131, 240, 123, 30, 21, 169, 31, 160, 30, 230, 36, 223, 70, 4, 182, 167, 53, 250, 156, 112, 49, 185, 201, 123, 72, 210, 130, 78, 82, 35, 215, 150, 41, 32, 31, 71, 49, 75, 82, 131, 129, 202, 177, 20, 109, 98, 142, 252, 86, 70, 220, 43, 242, 142, 20, 179, 184, 169, 128, 27, 214, 201, 65, 205, 4, 75, 144, 145, 36, 216, 255, 159, 124, 89, 226, 135, 119, 95, 81, 92, 153, 94, 147, 214, 211, 136, 129, 86, 187, 214, 186, 96, 131, 23, 74, 113, 38, 210, 111, 35, 255, 115, 201, 168, 145, 180, 9, 92, 111, 51, 3, 137, 245, 208, 251, 158, 254, 197, 93, 179, 53, 130, 17, 115, 113, 239, 211, 215, 192, 133, 248, 157, 139, 41, 3, 115, 73, 119, 129, 119, 180, 6, 46, 28, 23, 108, 113, 45, 153, 241, 133, 212, 11, 244, 111, 213, 196, 6, 224, 143, 160, 63, 49, 77, 7, 139, 139, 37, 46, 47, 81, 27, 186, 109, 11, 195, 55, 128, 163, 178, 200, 85, 241, 3, 100, 177, 77, 158, 241, 194, 208, 233, 47, 193, 162, 150, 203, 51, 211, 61, 50, 154, 79, 252, 240, 130, 22, 229, 159, 54, 181, 39, 21, 235, 126, 232, 137, 107, 212, 53, 233, 132, 235, 101, 128, 154, 93, 197, 68, 255, 107, 46, 17, 229, 208, 13, 227, 96, 144, 88, 189, 192, 234, 249, 184, 28, 135, 122, 23, 163, 99, 225, 114, 212, 58, 220, 212, 32, 37, 40, 28, 249, 188, 84, 189, 159, 121, 142, 112, 62, 94, 205, 146, 51, 228, 146, 47, 209, 71, 154, 88, 115, 196, 56, 37, 66, 212, 162, 255, 213, 11, 1, 127, 101, 161, 34, 161, 177, 56, 226, 132, 99, 250, 217, 123, 243, 12, 0, 73, 189, 5, 52, 49, 84, 10, 149, 105, 251, 120, 132, 62, 161, 26, 211, 55, 241, 117, 125, 124, 128, 62, 181, 180, 233, 58, 182, 168, 178, 138, 213, 181, 104, 199, 218, 35, 35, 244, 210, 95, 18, 161, 155, 60, 125, 15, 164, 84, 213, 124, 169, 152, 79, 43, 70, 212, 236, 62, 224, 108, 84, 30, 53, 21, 26, 246, 93, 66, 62, 207, 196, 28, 203, 17, 155, 45, 193, 2, 165, 25, 67, 39, 237, 124, 161, 176, 66, 0, 29, 82, 160, 144, 23, 91, 12, 245, 253, 218, 15, 212, 48, 102, 103, 167, 218, 102, 80, 42, 77, 65, 24, 206, 44, 242, 98, 13, 233, 8, 142, 163, 169, 11, 113, 232, 112, 229, 37, 109, 74, 159, 27, 188, 101, 212, 92, 51, 174, 17, 41, 178, 154, 23, 70, 130, 225, 134, 30, 136, 206, 215, 163, 2, 119, 250, 89, 17, 151, 130, 123, 99, 55, 21, 214, 225, 83, 185, 253, 180, 169, 43, 91, 90, 210, 136, 253, 90, 221, 147, 121, 195, 130, 101, 195, 187, 90, 151, 40, 240, 207, 173, 98, 110, 13, 45, 70, 141, 146, 85, 58, 129, 103, 5, 194, 255, 1, 19, 177, 31, 73, 210, 241, 107, 248, 117, 137, 156, 83, 12, 34, 205, 99, 87, 33, 248, 198, 135, 223, 187, 79, 61, 137, 122, 87, 186, 255, 53, 119, 254, 128, 75, 250, 211, 92, 245, 36, 124, 189, 23, 188, 94, 96, 34, 43, 120, 194, 20, 253, 15, 80, 104, 42, 67, 11, 237, 9, 62, 35, 47, 138, 66, 239, 74, 246, 139, 166, 178, 63, 79, 24, 225, 163, 41, 21, 219, 231, 206, 169, 218, 1, 137, 55, 117, 23, 154, 230, 34, 228, 233, 102, 147, 163, 245, 30, 172, 225, 218, 29, 104, 243, 249, 64, 2, 48, 14, 135, 83, 169, 57, 41, 40, 54, 9, 26, 21, 144, 81, 221, 120, 60, 93, 223, 3, 223, 194, 128, 46, 1, 75, 190, 239, 248, 151, 118, 206, 41, 193, 13, 58, 210, 187, 48, 25, 62, 73, 19, 151, 155, 51, 2, 48, 201, 153, 216, 187, 140, 138, 7, 23, 41, 231, 247, 68, 223, 200, 149, 255, 64, 62, 188, 57, 86, 138, 75, 88, 137, 36, 219, 33, 12, 131, 84, 110, 31, 191, 36, 110, 113, 137, 166, 11, 101, 20, 32, 31, 146, 110, 88, 190, 124, 202, 101, 226, 7, 25, 25, 209, 63, 250, 87, 235, 252, 169, 236, 114, 61, 223, 46, 112, 168, 204, 202, 100, 38, 61, 158, 224, 130, 193, 40, 97, 36, 181, 16, 192, 182, 15, 176, 250, 33, 214, 123, 6, 211, 134, 124, 186, 118, 225, 35, 13, 164, 199, 247, 247, 124, 214, 102, 108, 177, 229, 85, 160, 88, 162, 195, 149, 176, 68, 56, 42, 21, 36, 56, 232, 200, 178, 199, 97, 39, 55, 226, 237, 13, 47, 18, 153, 108, 200, 186, 248, 174, 216, 192, 22, 174, 136, 65, 148, 247, 148, 26, 44, 48, 197, 178, 162, 102, 102, 91, 22, 87, 35, 61, 2, 152, 117, 211, 71, 221, 243, 58, 184, 174, 232, 153, 100, 196, 81, 34, 77, 137, 1, 171, 193, 176, 226, 160, 129, 200, 113, 166, 47, 228, 235, 113, 124, 150, 37, 187, 244, 90, 170, 98, 218, 218, 9, 204, 104, 231, 192, 81, 21, 28, 5, 165, 47, 181, 192, 100, 188, 239, 154, 43, 139, 40, 233, 90, 218, 39, 14, 230, 49, 189, 253, 240, 16, 98, 37, 107, 113, 134, 46, 84, 166, 81, 19, 11, 194, 49, 181, 218, 50, 105, 226, 105, 244, 156, 175, 185, 177, 131, 2, 161, 143, 79, 250, 151, 114, 43, 159, 189, 175, 102, 204, 197, 125, 91, 31, 200, 129, 231, 20, 204, 199, 13, 98, 252, 189, 255, 125, 41, 245, 75, 205, 136, 87, 3, 15, 18, 146, 203, 145, 67, 217, 141, 196, 217, 185, 156, 249, 158, 118, 215, 154, 149, 205, 1, 188, 109, 161, 165, 217, 193, 27, 145, 89, 202, 25, 10, 211, 20, 158, 154, 209, 227, 22, 178, 70, 115, 12, 16, 9, 100, 12, 138, 59, 154, 250, 1, 107, 223, 237, 110, 54, 217, 226, 122, 239, 132, 149, 138, 149, 12, 93, 132, 24, 161, 147, 87, 97, 60, 73, 237, 230, 246, 167, 130, 45, 211, 159, 154, 34, 203, 117, 242, 127, 169, 105, 232, 146, 97, 47, 239, 168, 180, 136, 234, 83, 10, 66, 217, 212, 208, 39, 203, 80, 71, 175, 101, 247, 46, 159, 148, 122, 190, 114, 71, 83, 174, 247, 32, 165, 150, 175, 165, 101, 27, 199, 55, 56, 180, 99, 169, 43, 140, 53, 136, 111, 204, 229, 237, 200, 83, 140, 218, 245, 200, 160, 50, 242, 232, 76, 26, 134, 93, 156, 27, 195, 151, 48, 108, 12, 91, 45, 220, 121, 98, 118, 109, 192, 80, 86, 150, 153, 202, 7, 67, 65, 154, 208, 63, 212, 232, 56, 66, 50, 236, 115, 233, 153, 242, 39, 84, 187, 129, 48, 197, 77, 211, 4, 143, 113, 206, 68, 223, 42, 222, 83, 150, 213, 194, 18, 56, 177, 159, 165, 42, 118, 19, 81, 245, 99, 129, 192, 234, 147, 47, 233, 182, 132, 140, 123, 55, 56, 124, 138, 94, 254, 25, 45, 31, 27, 131, 69, 198, 64, 158, 161, 173, 75, 47, 245, 170, 213, 133, 241, 165, 237, 177, 187, 84, 104, 146, 71, 186, 34, 28, 208, 199, 217, 254, 189, 149, 123, 33, 59, 82, 21, 40, 152, 52, 230, 227, 191, 208, 179, 217, 86, 166, 209, 89, 6, 119, 43, 147, 6, 188, 79, 124, 220, 226, 220, 78, 215, 214, 204, 245, 147, 50, 180, 112, 43, 122, 120, 126, 117, 244, 4, 42, 208, 207, 55, 35, 198, 151, 19, 175, 148, 59, 103, 219, 210, 171, 54, 117, 17, 198, 32, 118, 205, 141, 131, 8, 223, 195, 149, 82, 185, 252, 193, 97, 7, 93, 215, 71, 166, 143, 221, 161, 124, 115, 174, 232, 234, 116, 230, 216, 115, 225, 91, 47, 11, 156, 140, 229, 143, 135, 243, 74, 194, 0, 171, 217, 117, 35, 79, 131, 149, 38, 118, 86, 215, 78, 241, 129, 206, 85, 200, 45, 21, 171, 78, 126, 17, 80, 17, 33, 169, 120, 33, 241, 203, 65, 17, 249, 116, 30, 205, 252, 142, 56, 128, 176, 196, 174, 26, 49, 79, 84, 143, 238, 39, 45, 23, 235, 100, 39, 250, 135, 158, 207, 81, 135, 91, 70, 132, 17, 133, 214, 64, 176, 135, 25, 158, 7, 234, 230, 136, 167, 47, 216, 40, 209, 85, 107, 161, 68, 106, 224, 250, 35, 237, 10, 119, 75, 166, 64, 159, 188, 97, 196, 185, 148, 136, 228, 84, 6, 255, 208, 95, 213, 165, 233, 40, 174, 167, 241, 216, 236, 102, 139, 191, 138, 137, 73, 125, 144, 152, 43, 26, 137, 45, 131, 146, 246, 180, 143, 254, 168, 35, 67, 129, 48, 191, 127, 174, 201, 53, 49, 251, 238, 251, 129, 46, 75, 214, 101, 213, 65, 232, 217, 113, 54, 148, 222, 222, 27, 27, 232, 24, 189, 255, 242, 206, 150, 49, 129, 166, 162, 175, 5, 242, 230, 68, 186, 82, 21, 68, 81, 231, 203, 167, 94, 138, 6, 148, 183, 99, 165, 180, 111, 118, 155, 48, 88, 135, 219, 88, 184, 165, 102, 109, 50, 255, 113, 157, 143, 98, 8, 210, 135, 216, 155, 116, 107, 36, 234, 176, 161, 187, 78, 153, 4, 184, 87, 70, 113, 28, 100, 60, 190, 47, 71, 0, 59, 11, 214, 11, 171, 73, 235, 127, 149, 10, 138, 182, 89, 102, 184, 190, 210, 152, 46, 214, 118, 216, 34, 173, 119, 25, 74, 125, 37, 238, 246, 221, 115, 144, 85, 127, 200, 33, 46, 109, 202, 131, 53, 169, 229, 54, 90, 14, 33, 111, 139, 166, 189, 201, 25, 12, 167, 62, 24, 80, 191, 130, 135, 249, 152, 95, 26, 232, 51, 243, 147, 109, 65, 48, 164, 172, 68, 240, 165, 124, 112, 203, 86, 242, 128, 206, 90, 101, 195, 15, 101, 162, 170, 40, 171, 201, 39, 108, 170, 130, 109, 153, 96, 5, 255, 153, 218, 81, 113, 17, 51, 243, 116, 156, 75, 72, 36, 244, 61, 164, 22, 207, 91, 164, 146, 47, 99, 104, 105, 242, 102, 30, 94, 231, 62, 56, 174, 168, 139, 102, 206, 30, 50, 19, 12, 108, 32, 58, 27, 187, 38, 101, 5, 235, 6, 113, 34, 107, 50, 183, 62, 30, 68, 149, 18, 218, 103, 83, 81, 38, 57, 161, 119, 216, 121, 236, 12, 101, 2, 159, 93, 219, 121, 137, 81, 228, 6, 98, 198, 154, 101, 33, 144, 16, 116, 170, 62, 247, 165, 35, 243, 180, 168, 18, 1, 193, 135, 235, 128, 50, 121, 139, 202, 199, 94, 217, 77, 75, 14, 122, 16, 139, 106, 251, 53, 255, 254, 217, 103, 54, 82, 134, 14, 22, 70, 32, 7, 208, 171, 110, 25, 131, 27, 26, 125, 104, 185, 170, 61, 25, 74, 156, 83, 228, 3, 45, 80, 4, 0, 25, 219, 236, 174, 156, 247, 168, 0, 170, 160, 182, 137, 146, 202, 124, 172, 56, 177, 154, 250, 251, 177, 86, 182, 170, 222, 129, 196, 50, 165, 2, 107, 154, 34, 221, 76, 47, 115, 61, 254, 125, 29, 136, 243, 17, 23, 219, 224, 204, 247, 207, 54, 219, 248, 146, 112, 197, 97, 133, 242, 172, 19, 61, 60, 123, 108, 139, 136, 244, 167, 177, 47, 226, 192, 130, 170, 249, 156, 244, 146, 232, 121, 169, 167, 110, 179, 244, 96, 81, 27, 179, 157, 119, 137, 103, 150, 230, 134, 28, 66, 220, 48, 143, 252, 120, 157, 106, 181, 140, 131, 33, 25, 60, 213, 166, 70, 14, 49, 32, 171, 245, 119, 155, 233, 99, 251, 2, 65, 23, 182, 97, 35, 114, 121, 236, 37, 34, 9, 23, 248, 64, 43, 152, 229, 13, 126, 158, 2, 234, 239, 243, 0, 4, 106, 108, 155, 214, 31, 169, 172, 96, 171, 2, 1, 57, 11, 88, 242, 62, 133, 230, 149, 90, 247, 171, 180, 204, 138, 73, 145, 155, 80, 243, 186, 159, 213, 49, 106, 38, 62, 142, 159, 186, 226, 105, 18, 168, 168, 45, 46, 189, 59, 59, 199, 29, 236, 51, 27, 42, 117, 43, 151, 25, 225, 50, 246, 51, 29, 96, 137, 115, 247, 30, 178, 221, 183, 161, 116, 131, 41, 235, 39, 154, 14, 48, 162, 97, 115, 136, 67, 217, 87, 238, 24, 184, 171, 93, 233, 85, 132, 235, 248, 117, 126, 128, 95, 161, 239, 30, 3, 92, 178, 139, 34, 150, 16, 124, 48, 182, 129, 175, 225, 158, 149, 185, 249, 36, 68, 191, 176, 89, 46, 94, 183, 96, 94, 7, 223, 165, 244, 194, 121, 174, 233, 254, 1, 102, 250, 60, 91, 162, 229, 74, 51, 197, 216, 84, 129, 10, 40, 57, 12, 124, 10, 118, 202, 173, 159, 154, 54, 4, 84, 66, 84, 155, 234, 249, 113, 28, 215, 149, 158, 99, 7, 133, 65, 253, 147, 171, 51, 178, 102, 172, 246, 85, 248, 179, 176, 43, 119, 162, 128, 151, 173, 216, 36, 83, 95, 46, 117, 210, 145, 169, 236, 115, 24, 103, 166, 147, 183, 161, 62, 6, 226, 250, 238, 183, 205, 79, 163, 213, 127, 18, 185, 48, 82, 110, 200, 169, 92, 73, 88, 137, 74, 32, 119, 202, 25, 207, 139, 52, 225, 159, 250, 157, 121, 114, 24, 16, 62, 250, 109, 228, 3, 177, 171, 5, 32, 7, 255, 230, 172, 222, 234, 103, 151, 102, 220, 81, 207, 165, 66, 79, 238, 41, 74, 14, 55, 7, 240, 154, 122, 162, 128, 46, 2, 122, 253, 171, 108, 10, 115, 80, 78, 195, 217, 212, 190, 140, 54, 107, 58, 5, 198, 216, 135, 145, 17, 63, 165, 64, 123, 144, 141, 20, 169, 19, 168, 3, 93, 58, 84, 86, 191, 0, 158, 232, 215, 132, 238, 180, 4, 94, 163, 100, 199, 229, 230, 161, 139, 185, 101, 106, 252, 159, 95, 213, 115, 206, 50, 12, 53, 125, 126, 77, 221, 163, 255, 187, 77, 44, 7, 39, 98, 4, 116, 73, 123, 141, 60, 62, 58, 128, 173, 188, 108, 103, 164, 106, 158, 245, 109, 130, 189, 91, 163, 60, 104, 35, 247, 160, 30, 177, 235, 94, 136, 171, 139, 66, 24, 38, 112, 190, 141, 194, 198, 231, 231, 67, 108, 46, 59, 228, 255, 203, 77, 101, 20, 54, 133, 179, 63, 157, 40, 42, 69, 248, 254, 220, 89, 25, 98, 120, 174, 252, 119, 8, 177, 14, 89, 152, 78, 128, 141, 232, 190, 202, 209, 35, 80, 235, 104, 144, 13, 119, 67, 189, 206, 220, 71, 171, 213, 137, 204, 115, 168, 96, 245, 219, 185, 24, 113, 114, 107, 215, 196, 77, 198, 34, 142, 202, 33, 168, 13, 175, 196, 151, 28, 124, 12, 148, 183, 212, 216, 175, 80, 233, 124, 128, 227, 7, 251, 243, 50, 205, 235, 200, 37, 31, 91, 196, 29, 56, 214, 169, 83, 171, 112, 71, 239, 188, 238, 0, 139, 114, 59, 185, 41, 149, 115, 17, 178, 92, 208, 216, 127, 255, 235, 172, 74, 229, 22, 176, 125, 8, 67, 2, 65, 52, 171, 177, 151, 202, 80, 149, 108, 138, 57, 130, 250, 243, 71, 170, 170, 159, 44, 100, 235, 33, 206, 48, 242, 34, 227, 76, 48, 21, 214, 118, 92, 240, 83, 235, 55, 135, 199, 60, 52, 208, 35, 178, 100, 222, 225, 128, 227, 26, 239, 169, 22, 209, 99, 176, 163, 119, 152, 200, 215, 91, 0, 81, 18, 29, 96, 75, 159, 137, 19, 26, 142, 43, 29, 174, 102, 37, 251, 26, 169, 137, 59, 225, 162, 94, 113, 105, 39, 114, 103, 53, 77, 252, 109, 125, 191, 40, 249, 52, 75, 72, 168, 223, 50, 47, 245, 237, 199, 49, 221, 255, 42, 125, 183, 60, 218, 238, 68, 86, 64, 127, 204, 245, 206, 200, 200, 183, 91, 231, 15, 66, 1, 230, 110, 190, 222, 241, 96, 24, 69, 83, 16, 18, 220, 80, 34, 120, 54, 126, 123, 155, 122, 38, 183, 230, 148, 81, 22, 191, 163, 195, 184, 96, 1, 41, 216, 239, 97, 174, 226, 22, 73, 123, 1, 66, 21, 68, 103, 236, 10, 78, 197, 4, 131, 37, 55, 140, 38, 169, 214, 32, 202, 235, 85, 2, 180, 213, 174, 50, 100, 219, 131, 16, 106, 74, 2, 208, 215, 177, 118, 225, 130, 108, 37, 214, 167, 89, 69, 74, 207, 201, 21, 12, 187, 255, 214, 80, 142, 210, 159, 68, 79, 67, 30, 178, 175, 41, 33, 246, 5, 77, 143, 177, 182, 13, 54, 207, 4, 51, 152, 155, 147, 89, 47, 6, 121, 62, 17, 66, 252, 107, 252, 197, 46, 4, 113, 62, 45, 9, 178, 158, 53, 170, 169, 82, 192, 34, 191, 254, 212, 162, 226, 86, 224, 104, 74, 61, 173, 220, 32, 208, 100, 199, 145, 48, 95, 232, 126, 68, 71, 159, 79, 194, 41, 38, 119, 128, 117, 60, 116, 212, 2, 248, 130, 191, 7, 75, 21, 234, 31, 196, 148, 74, 189, 221, 55, 75, 227, 209, 53, 34, 182, 48, 155, 73, 29, 70, 65, 232, 26, 94, 24, 144, 219, 157, 222, 42, 12, 240, 145, 208, 132, 117, 5, 71, 11, 66, 211, 137, 58, 246, 182, 132, 66, 25, 130, 205, 31, 187, 115, 201, 233, 10, 247, 75, 104, 137, 15, 66, 17, 98, 154, 226, 129, 137, 27, 215, 192, 226, 152, 167, 214, 71, 112, 30, 255, 203, 125, 42, 225, 147, 139, 198, 12, 75, 235, 113, 234, 229, 175, 100, 112, 202, 73, 53, 244, 136, 127, 104, 149, 203, 149, 230, 227, 218, 218, 109, 75, 198, 205, 233, 40, 167, 36, 167, 223, 182, 73, 206, 161, 86, 82, 104, 184, 151, 112, 176, 109, 119, 214, 52, 141, 36, 65, 239, 87, 178, 44, 54, 232, 74, 196, 126, 20, 85, 6, 255, 71, 3, 69, 3, 50, 162, 97, 145, 146, 7, 40, 139, 111, 59, 40, 246, 18, 186, 158, 113, 251, 76, 229, 30, 131, 26, 45, 156, 237, 82, 192, 194, 4, 70, 175, 63, 129, 90, 80, 88, 32, 221, 38, 242, 160, 66, 169, 19, 152, 105, 79, 91, 190, 212, 94, 98, 0, 231, 196, 192, 134, 225, 69, 249, 62, 36, 223, 147, 37, 221, 144, 3, 179, 131, 111, 95, 69, 144, 125, 223, 75, 63, 91, 199, 104, 187, 13, 35, 223, 99, 255, 14, 22, 176, 27, 107, 73, 33, 123, 57, 162, 92, 196, 79, 174, 219, 230, 154, 79, 134, 67, 212, 178, 126, 221, 189, 25, 88, 161, 171, 173, 34, 191, 40, 82, 106, 37, 143, 228, 16, 15, 203, 93, 18, 251, 156, 184, 216, 192, 6, 89, 144, 92, 248, 210, 239, 248, 49, 101, 59, 159, 85, 195, 204, 219, 124, 163, 109, 33, 87, 103, 185, 49, 109, 81, 66, 194, 130, 109, 221, 205, 219, 217, 114, 189, 224, 55, 217, 255, 91, 21, 50, 45, 3, 254, 180, 38, 52, 223, 118, 45, 28, 20, 53, 19, 72, 187, 219, 26, 105, 28, 128, 233, 190, 207, 201, 123, 60, 19, 165, 89, 2, 239, 87, 35, 63, 214, 197, 182, 224, 79, 168, 112, 149, 225, 211, 210, 190, 94, 143, 71, 171, 124, 45, 58, 55, 118, 90, 169, 217, 228, 51, 240, 64, 136, 239, 199, 140, 222, 219, 57, 254, 20, 220, 119, 187, 101, 217, 77, 224, 117, 208, 188, 234, 232, 128, 32, 87, 84, 108, 246, 252, 241, 106, 204, 95, 68, 128, 15, 228, 221, 72, 167, 3, 89, 204, 202, 253, 133, 61, 105, 4, 35, 199, 63, 128, 202, 207, 109, 157, 88, 137, 96, 65, 247, 31, 148, 87, 58, 135, 27, 227, 240, 29, 59, 184, 78, 235, 37, 130, 201, 146, 0, 189, 72, 223, 22, 166, 63, 248, 94, 146, 202, 237, 54, 160, 26, 188, 51, 34, 130, 20, 226, 159, 75, 11, 14, 177, 44, 77, 99, 115, 35, 80, 143, 161, 163, 185, 138, 138, 122, 37, 112, 157, 10, 95, 62, 48, 183, 67, 210, 248, 43, 246, 2, 138, 40, 45, 214, 236, 69, 178, 153, 169, 129, 122, 51, 114, 231, 50, 92, 3, 248, 16, 139, 80, 187, 23, 207, 221, 99, 154, 96, 206, 126, 230, 25, 150, 110, 248, 221, 93, 223, 238, 163, 57, 42, 173, 163, 83, 177, 137, 58, 24, 146, 85, 198, 46, 180, 169, 220, 85, 146, 204, 22, 236, 152, 87, 66, 73, 204, 174, 48, 215, 89, 11, 119, 72, 142, 165, 246, 156, 71, 121, 36, 88, 50, 197, 35, 39, 246, 109, 253, 254, 6, 133, 56, 25, 97, 167, 183, 31, 244, 178, 65, 134, 154, 178, 1, 20, 88, 196, 4, 234, 169, 153, 99, 177, 28, 112, 152, 45, 66, 103, 18, 43, 66, 107, 78, 210, 111, 199, 16, 232, 109, 252, 92, 153, 189, 156, 169, 71, 171, 108, 234, 33, 220, 228, 21, 44, 175, 84, 64, 57, 121, 151, 163, 101, 183, 18, 233, 215, 40, 247, 199, 19, 81, 252, 92, 166, 33, 93, 81, 126, 238, 248, 85, 249, 34, 191, 139, 23, 141, 172, 132, 138, 130, 188, 33, 223, 58, 104, 57, 101, 10, 49, 119, 127, 136, 243, 135, 160, 65, 55, 117, 135, 149, 75, 38, 129, 117, 77, 5, 0, 201, 148, 120, 66, 238, 127, 55, 23, 75, 166, 211, 202, 55, 213, 38, 4, 110, 220, 120, 149, 120, 139, 37, 228, 39, 73, 92, 240, 179, 223, 155, 60, 162, 19, 164, 73, 131, 110, 238, 222, 70, 173, 35, 0, 158, 61, 121, 241, 219, 48, 163, 118, 4, 243, 140, 130, 93, 121, 62, 253, 11, 46, 55, 245, 76, 100, 223, 54, 210, 164, 21, 187, 175, 61, 8, 122, 86, 19, 129, 173, 191, 201, 209, 151, 1, 78, 210, 16, 207, 80, 26, 58, 47, 78, 60, 171, 127, 120, 75, 93, 81, 243, 87, 126, 142, 156, 246, 175, 85, 230, 136, 4, 178, 60, 25, 167, 69, 226, 86, 162, 116, 161, 96, 214, 187, 163, 62, 58, 38, 98, 220, 21, 218, 44, 76, 121, 217, 66, 75, 234, 75, 78, 114, 64, 201, 123, 97, 17, 224, 166, 7, 16, 44, 26, 239, 111, 159, 18, 4, 69, 186, 68, 249, 79, 54, 7, 70, 196, 166, 115, 29, 1, 20, 193, 230, 148, 48, 122, 241, 158, 238, 243, 12, 208, 149, 122, 236, 54, 98, 102, 95, 95, 18, 17, 208, 225, 149, 207, 148, 163, 67, 10, 117, 246, 101, 66, 170, 84, 138, 197, 207, 163, 36, 254, 109, 233, 178, 253, 199, 95, 76, 161, 42, 14, 226, 192, 28, 149, 194, 76, 188, 71, 106, 153, 225, 228, 68, 204, 168, 14, 175, 165, 117, 177, 143, 175, 150, 79, 83, 33, 239, 95, 126, 204, 80, 11, 116, 228, 47, 120, 41, 228, 24, 59, 53, 254, 235, 164, 153, 31, 3, 31, 105, 237, 16, 106, 181, 149, 72, 247, 192, 92, 50, 252, 192, 175, 91, 61, 135, 57, 128, 57, 130, 245, 35, 96, 199, 27, 27, 224, 183, 143, 39, 154, 156, 105, 166, 186, 139, 199, 173, 169, 243, 179, 236, 192, 94, 97, 120, 142, 148, 237, 74, 128, 169, 47, 74, 74, 101, 138, 204, 246, 98, 224, 127, 238, 137, 244, 162, 133, 51, 231, 161, 161, 185, 13, 33, 169, 224, 161, 242, 1, 167, 217, 102, 199, 104, 187, 30, 177, 136, 174, 81, 5, 131, 203, 162, 6, 64, 200, 20, 155, 69, 199, 199, 226, 77, 166, 217, 128, 207, 32, 137, 214, 154, 0, 38, 229, 90, 49, 91, 161, 92, 80, 128, 27, 191, 156, 143, 45, 220, 136, 46, 67, 163, 228, 68, 113, 55, 216, 218, 27, 145, 242, 69, 20, 154, 197, 13, 255, 233, 27, 195, 164, 80, 229, 164, 216, 234, 150, 64, 1, 92, 253, 153, 86, 31, 34, 23, 199, 113, 232, 201, 149, 40, 54, 167, 190, 198, 17, 16, 106, 89, 77, 78, 25, 14, 144, 109, 87, 61, 30, 111, 95, 164, 180, 224, 69, 28, 9, 118, 62, 145, 245, 11, 125, 67, 180, 243, 29, 72, 59, 9, 175, 18, 178, 79, 14, 17, 77, 76, 50, 46, 66, 81, 192, 181, 170, 75, 15, 214, 244, 205, 61, 92, 88, 47, 34, 105, 148, 52, 227, 49, 242, 243, 38, 95, 65, 135, 224, 121, 207, 116, 252, 15, 12, 163, 125, 134, 36, 198, 50, 165, 107, 50, 47, 41, 123, 60, 236, 94, 197, 67, 50, 126, 254, 191, 248, 231, 173, 188, 159, 61, 175, 203, 80, 80, 195, 189, 199, 146, 217, 102, 154, 3, 134, 109, 151, 200, 1, 211, 62, 195, 142, 69, 147, 200, 11, 81, 157, 27, 165, 149, 184, 108, 38, 226, 39, 4, 42, 95, 153, 131, 193, 205, 76, 34, 52, 221, 27, 162, 127, 32, 35, 149, 175, 92, 176, 131, 65, 214, 110, 68, 121, 142, 55, 252, 92, 98, 76, 216, 112, 60, 101, 70, 107, 177, 119, 44, 159, 115, 66, 121, 121, 139, 45, 134, 83, 148, 18, 116, 119, 134, 56, 144, 45, 77, 199, 81, 40, 238, 143, 87, 39, 23, 95, 130, 71, 108, 177, 36, 223, 243, 152, 216, 128, 210, 242, 159, 149, 79, 96, 189, 140, 254, 206, 200, 5, 196, 254, 103, 227, 162, 8, 238, 0, 214, 7, 189, 214, 158, 174, 195, 201, 243, 103, 74, 149, 196, 212, 19, 95, 30, 6, 60, 122, 205, 192, 248, 140, 88, 71, 139, 213, 169, 139, 157, 166, 146, 127, 36, 53, 166, 222, 194, 2, 146, 66, 146, 34, 129, 44, 188, 73, 220, 44, 203, 79, 208, 65, 255, 127, 210, 14, 33, 85, 253, 98, 15, 212, 116, 215, 109, 234, 145, 58, 8, 198, 186, 11, 81, 46, 251, 81, 64, 248, 35, 198, 248, 28, 22, 174, 232, 228, 161, 79, 137, 16, 114, 177, 72, 89, 180, 1, 215, 117, 30, 55, 168, 219, 27, 161, 83, 124, 25, 137, 93, 51, 105, 59, 73, 239, 162, 62, 113, 230, 242, 209, 33, 5, 175, 90, 71, 119, 193, 72, 92, 62, 134, 167, 101, 17, 204, 130, 77, 20, 49, 219, 90, 163, 46, 2, 37, 39, 130, 18, 196, 89, 35, 193, 163, 23, 190, 82, 25, 3, 27, 69, 98, 176, 137, 2, 60, 222, 150, 64, 55, 162, 104, 0, 49, 147, 253, 115, 222, 92, 249, 170, 159, 215, 48, 112, 0, 111, 188, 137, 113, 98, 58, 195, 98, 159, 97, 173, 155, 64, 195, 210, 59, 97, 91, 3, 159, 72, 92, 151, 227, 35, 12, 128, 94, 126, 36, 252, 167, 59, 25, 171, 100, 205, 8, 98, 232, 66, 10, 127, 250, 188, 163, 220, 199, 178, 211, 89, 254, 73, 30, 123, 76, 165, 106, 2, 216, 206, 174, 176, 12, 56, 30, 99, 112, 191, 113, 30, 151, 80, 146, 23, 188, 130, 196, 186, 29, 104, 119, 130, 149, 133, 108, 78, 132, 101, 30, 7, 140, 252, 121, 92, 166, 190, 150, 84, 215, 145, 240, 145, 211, 186, 94, 145, 237, 188, 226, 3, 158, 205, 150, 33, 186, 229, 126, 249, 156, 175, 202, 75, 195, 8, 225, 72, 46, 173, 183, 173, 183, 137, 129, 143, 139, 245, 203, 199, 180, 92, 20, 95, 66, 183, 39, 23, 246, 137, 134, 69, 64, 184, 104, 54, 244, 45, 122, 65, 178, 140, 129, 21, 209, 183, 5, 166, 95, 127, 91, 238, 44, 10, 174, 1, 26, 205, 136, 151, 202, 234, 146, 186, 250, 214, 137, 136, 87, 234, 200, 184, 138, 5, 165, 127, 96, 175, 240, 176, 127, 75, 93, 181, 141, 19, 146, 241, 126, 242, 92, 204, 66, 229, 165, 62, 56, 94, 9, 234, 111, 188, 21, 253, 144, 205, 143, 74, 194, 126, 10, 85, 135, 139, 233, 158, 221, 75, 0, 109, 133, 99, 0, 82, 30, 12, 152, 253, 94, 106, 86, 32, 150, 78, 95, 145, 181, 214, 172, 176, 103, 30, 143, 214, 119, 65, 224, 199, 91, 7, 77, 45, 111, 243, 13, 13, 246, 188, 209, 182, 219, 25, 154, 51, 204, 171, 85, 38, 57, 137, 69, 120, 55, 41, 34, 228, 7, 102, 0, 166, 147, 215, 62, 187, 69, 187, 106, 139, 26, 13, 51, 93, 179, 51, 6, 65, 159, 47, 220, 11, 35, 129, 250, 117, 173, 177, 122, 24, 132, 141, 46, 209, 189, 114, 60, 194, 206, 142, 130, 190, 16, 1, 40, 163, 99, 102, 83, 158, 103, 161, 207, 153, 207, 118, 158, 85, 213, 253, 83, 255, 213, 208, 169, 184, 39, 150, 134, 37, 127, 68, 227, 75, 211, 172, 212, 169, 90, 113, 99, 146, 216, 60, 191, 173, 247, 212, 160, 11, 160, 52, 183, 5, 236, 144, 134, 183, 180, 16, 46, 4, 167, 184, 192, 239, 105, 109, 174, 20, 108, 86, 233, 202, 99, 142, 188, 189, 163, 211, 108, 0, 7, 72, 198, 30, 51, 192, 158, 25, 0, 221, 253, 31, 205, 147, 49, 208, 40, 46, 42, 111, 156, 60, 32, 20, 141, 145, 140, 145, 202, 97, 156, 34, 91, 175, 12, 192, 95, 245, 130, 50, 85, 56, 167, 72, 203, 82, 52, 53, 80, 177, 54, 74, 161, 199, 146, 79, 240, 182, 42, 157, 160, 133, 60, 110, 159, 164, 197, 9, 203, 92, 77, 112, 68, 99, 236, 111, 77, 170, 1, 199, 49, 209, 102, 151, 144, 218, 106, 139, 149, 142, 182, 78, 141, 17, 155, 158, 215, 141, 166, 103, 81, 41, 19, 40, 254, 194, 28, 104, 76, 53, 87, 100, 149, 190, 133, 73, 118, 252, 39, 155, 210, 76, 246, 155, 243, 87, 85, 227, 175, 215, 193, 152, 178, 178, 227, 97, 191, 227, 38, 227, 123, 51, 204, 148, 132, 83, 140, 129, 66, 180, 80, 120, 4, 231, 154, 31, 187, 102, 190, 31, 79, 123, 30, 117, 123, 233, 235, 38, 187, 155, 95, 92, 234, 130, 188, 244, 126, 245, 43, 116, 50, 104, 40, 219, 225, 94, 35, 22, 66, 136, 90, 170, 145, 83, 129, 254, 193, 127, 241, 173, 58, 115, 39, 121, 176, 156, 28, 110, 236, 0, 35, 248, 54, 196, 7, 103, 207, 170, 181, 236, 124, 148, 165, 205, 90, 120, 255, 92, 116, 211, 95, 86, 95, 215, 206, 135, 208, 164, 211, 112, 142, 68, 209, 90, 25, 43, 82, 217, 72, 50, 90, 26, 226, 242, 76, 101, 22, 2, 55, 64, 113, 130, 19, 240, 65, 67, 49, 41, 24, 179, 53, 84, 17, 36, 237, 217, 17, 208, 99, 109, 156, 28, 140, 52, 37, 254, 68, 71, 242, 160, 68, 205, 92, 69, 56, 225, 94, 27, 106, 107, 17, 74, 12, 116, 55, 88, 85, 122, 0, 239, 13, 17, 239, 27, 195, 151, 83, 72, 153, 188, 239, 58, 18, 84, 170, 212, 185, 212, 0, 192, 186, 230, 59, 90, 142, 184, 218, 42, 52, 83, 52, 170, 30, 1, 106, 236, 25, 57, 228, 226, 139, 188, 54, 241, 9, 199, 22, 40, 243, 178, 108, 164, 56, 193, 13, 186, 142, 133, 209, 94, 132, 240, 18, 243, 185, 254, 62, 85, 171, 109, 91, 147, 108, 45, 23, 12, 190, 213, 4, 160, 199, 188, 121, 233, 125, 35, 207, 181, 16, 95, 84, 231, 183, 235, 232, 169, 211, 47, 61, 206, 10, 149, 246, 58, 137, 36, 20, 101, 83, 211, 114, 88, 239, 133, 72, 11, 192, 41, 210, 252, 167, 103, 249, 183, 18, 232, 125, 58, 219, 169, 65, 240, 205, 115, 88, 191, 11, 93, 54, 68, 86, 155, 103, 93, 239, 44, 181, 173, 86, 215, 114, 245, 126, 181, 120, 211, 164, 21, 156, 236, 58, 63, 201, 68, 198, 152, 240, 46, 130, 62, 227, 51, 251, 84, 14, 126, 62, 248, 13, 23, 134, 215, 43, 63, 135, 194, 82, 88, 216, 225, 39, 192, 1, 136, 45, 235, 114, 168, 133, 42, 250, 16, 189, 118, 5, 91, 13, 25, 28, 129, 22, 130, 198, 185, 168, 251, 42, 208, 159, 249, 183, 121, 213, 119, 171, 208, 46, 137, 51, 84, 16, 228, 50, 136, 218, 127, 216, 166, 8, 195, 133, 134, 153, 189, 54, 253, 132, 254, 73, 60, 211, 242, 159, 6, 58, 216, 128, 161, 232, 81, 13, 157, 180, 236, 33, 133, 75, 193, 77, 0, 146, 51, 13, 160, 55, 190, 173, 5, 188, 32, 72, 3, 247, 203, 112, 90, 163, 4, 9, 130, 247, 196, 117, 12, 202, 37, 65, 74, 219, 19, 5, 182, 86, 172, 140, 84, 205, 195, 174, 16, 18, 151, 253, 200, 177, 37, 185, 165, 204, 109, 105, 168, 104, 100, 240, 156, 252, 243, 185, 177, 252, 74, 124, 103, 235, 169, 16, 210, 188, 4, 117, 165, 52, 211, 199, 58, 102, 30, 169, 46, 87, 121, 190, 188, 36, 48, 29, 3, 144, 198, 192, 136, 93, 48, 222, 166, 132, 118, 160, 168, 164, 135, 196, 3, 175, 17, 212, 224, 46, 96, 182, 155, 87, 120, 170, 134, 62, 207, 255, 201, 231, 184, 135, 237, 131, 57, 199, 121, 226, 157, 249, 243, 81, 215, 248, 69, 192, 12, 126, 151, 7, 41, 181, 201, 86, 234, 79, 167, 107, 69, 155, 208, 247, 168, 102, 73, 43, 4, 47, 209, 148, 219, 70, 126, 169, 202, 248, 63, 228, 98, 210, 47, 228, 74, 235, 221, 220, 59, 51, 162, 166, 17, 21, 193, 64, 16, 5, 177, 25, 166, 102, 20, 83, 71, 217, 197, 255, 248, 152, 147, 157, 91, 228, 20, 145, 182, 244, 20, 251, 215, 160, 111, 62, 104, 253, 233, 82, 210, 54, 56, 41, 34, 119, 248, 182, 104, 90, 81, 41, 124, 33, 141, 18, 223, 132, 197, 243, 198, 32, 250, 223, 191, 152, 155, 254, 213, 248, 19, 176, 14, 162, 234, 241, 213, 153, 186, 245, 46, 86, 150, 218, 123, 91, 229, 58, 187, 184, 231, 189, 233, 18, 130, 225, 79, 141, 32, 122, 16, 109, 65, 212, 53, 214, 85, 45, 200, 210, 6, 71, 94, 228, 39, 89, 192, 11, 240, 19, 135, 147, 3, 7, 42, 132, 44, 230, 12, 178, 43, 188, 205, 248, 22, 145, 242, 90, 169, 46, 161, 0, 149, 70, 83, 147, 150, 244, 7, 8, 44, 29, 46, 168, 239, 69, 118, 81, 44, 73, 77, 129, 47, 177, 120, 43, 49, 124, 191, 146, 108, 170, 148, 50, 129, 17, 111, 192, 52, 21, 234, 112, 136, 216, 95, 4, 161, 93, 13, 203, 37, 168, 60, 18, 145, 187, 48, 50, 59, 111, 125, 17, 12, 37, 2, 67, 118, 38, 137, 65, 140, 55, 189, 155, 4, 170, 222, 164, 250, 183, 105, 129, 66, 255, 228, 157, 4, 134, 158, 208, 215, 199, 79, 118, 149, 117, 70, 28, 157, 98, 203, 179, 227, 70, 38, 144, 253, 218, 138, 119, 49, 255, 99, 35, 239, 104, 0, 110, 197, 120, 71, 17, 150, 97, 146, 175, 76, 179, 23, 177, 69, 233, 227, 59, 35, 218, 91, 162, 191, 224, 57, 126, 79, 112, 98, 42, 47, 254, 160, 116, 197, 199, 190, 205, 14, 123, 197, 28, 87, 199, 110, 48, 187, 6, 183, 29, 78, 243, 34, 11, 56, 204, 7, 165, 144, 31, 96, 23, 20, 157, 221, 68, 137, 0, 75, 132, 95, 164, 232, 165, 183, 11, 219, 118, 241, 7, 248, 152, 150, 153, 31, 166, 79, 171, 161, 146, 191, 7, 85, 228, 183, 144, 110, 212, 238, 4, 137, 65, 171, 244, 25, 77, 205, 187, 201, 246, 114, 126, 2, 253, 149, 247, 54, 81, 98, 234, 23, 167, 29, 200, 94, 48, 112, 238, 248, 117, 11, 189, 159, 102, 28, 8, 210, 9, 242, 88, 197, 115, 188, 190, 192, 124, 226, 75, 80, 189, 64, 175, 105, 200, 188, 121, 227, 37, 210, 189, 255, 87, 189, 62, 130, 98, 146, 188, 37, 64, 47, 146, 136, 178, 148, 242, 161, 66, 239, 218, 220, 3, 231, 216, 4, 140, 134, 46, 207, 142, 84, 146, 227, 143, 45, 0, 8, 50, 137, 246, 201, 85, 243, 97, 159, 168, 208, 73, 36, 172, 176, 83, 190, 178, 17, 240, 8, 225, 162, 161, 125, 199, 62, 135, 226, 107, 55, 118, 25, 8, 186, 5, 179, 22, 151, 122, 17, 191, 234, 127, 36, 56, 39, 229, 72, 38, 148, 75, 102, 106, 110, 225, 163, 251, 188, 37, 164, 238, 52, 103, 31, 40, 227, 33, 44, 216, 216, 171, 215, 31, 46, 100, 155, 96, 148, 121, 44, 28, 132, 245, 168, 62, 26, 7, 7, 10, 6, 176, 251, 191, 120, 207, 219, 230, 78, 181, 224, 201, 103, 9, 220, 46, 208, 157, 91, 183, 32, 39, 8, 3, 124, 39, 150, 177, 86, 170, 27, 72, 112, 169, 173, 2, 23, 168, 223, 167, 171, 47, 65, 247, 39, 234, 85, 20, 45, 43, 103, 76, 116, 127, 151, 151, 173, 79, 77, 128, 161, 10, 28, 227, 75, 25, 204, 15, 140, 245, 60, 48, 79, 175, 141, 132, 51, 24, 175, 47, 59, 177, 216, 69, 188, 0, 232, 221, 73, 135, 31, 241, 86, 32, 143, 74, 108, 76, 0, 74, 232, 195, 93, 204, 186, 86, 48, 252, 19, 10, 205, 150, 60, 92, 138, 45, 3, 37, 164, 205, 27, 143, 130, 78, 192, 45, 242, 153, 255, 73, 109, 100, 165, 105, 179, 214, 59, 235, 242, 106, 116, 70, 188, 230, 116, 255, 23, 181, 28, 143, 174, 156, 252, 185, 78, 78, 144, 242, 171, 91, 189, 99, 16, 182, 71, 57, 240, 106, 2, 58, 155, 175, 70, 134, 16, 233, 163, 59, 98, 31, 111, 130, 133, 134, 98, 46, 171, 245, 200, 46, 199, 81, 172, 110, 187, 45, 172, 92, 203, 232, 1, 169, 125, 134, 205, 38, 84, 198, 180, 46, 11, 254, 116, 33, 12, 215, 1, 43, 218, 219, 253, 194, 173, 192, 207, 126, 137, 11, 159, 43, 163, 167, 142, 94, 26, 54, 11, 140, 189, 116, 160, 56, 240, 113, 190, 64, 253, 174, 64, 252, 158, 220, 241, 195, 21, 239, 205, 245, 57, 248, 220, 22, 138, 235, 232, 1, 241, 212, 201, 220, 20, 90, 153, 79, 56, 3, 71, 149, 159, 223, 247, 17, 25, 84, 74, 46, 239, 117, 89, 88, 61, 126, 179, 245, 188, 168, 200, 175, 14, 199, 223, 222, 222, 119, 219, 121, 95, 55, 170, 5, 202, 9, 164, 207, 128, 219, 7, 176, 0, 8, 232, 151, 193, 91, 110, 22, 149, 41, 95, 77, 88, 172, 168, 164, 200, 94, 6, 83, 26, 172, 196, 56, 113, 85, 134, 18, 236, 59, 125, 126, 92, 14, 12, 154, 189, 151, 20, 122, 33, 16, 133, 155, 222, 219, 22, 108, 117, 210, 110, 153, 67, 95, 76, 40, 11, 77, 222, 249, 232, 72, 49, 164, 5, 202, 55, 67, 112, 104, 201, 129, 29, 193, 191, 117, 254, 204, 214, 221, 169, 108, 230, 194, 128, 64, 22, 250, 0, 200, 183, 39, 81, 110, 1, 1, 194, 232, 87, 34, 78, 169, 206, 21, 232, 40, 99, 63, 224, 186, 142, 36, 47, 104, 28, 238, 121, 55, 68, 145, 153, 87, 10, 69, 229, 219, 194, 49, 31, 195, 222, 46, 42, 24, 223, 126, 147, 13, 127, 182, 242, 125, 200, 148, 21, 94, 33, 63, 223, 37, 173, 35, 99, 128, 97, 183, 159, 222, 158, 98, 206, 69, 247, 191, 241, 245, 232, 210, 169, 166, 151, 54, 62, 149, 93, 8, 173, 152, 147, 236, 6, 137, 13, 181, 159, 47, 60, 60, 11, 147, 72, 76, 21, 9, 135, 34, 114, 198, 43, 236, 161, 131, 25, 20, 50, 97, 89, 222, 60, 57, 247, 39, 251, 93, 48, 13, 217, 160, 90, 81, 90, 128, 150, 32, 27, 65, 77, 192, 181, 51, 234, 51, 99, 178, 245, 236, 29, 195, 241, 223, 191, 150, 91, 234, 77, 215, 248, 171, 132, 45, 149, 38, 246, 40, 91, 205, 37, 252, 167, 182, 25, 218, 237, 197, 180, 202, 199, 94, 181, 158, 197, 242, 92, 250, 232, 97, 159, 151, 235, 247, 65, 224, 111, 205, 168, 154, 88, 16, 232, 164, 156, 178, 111, 237, 143, 11, 179, 109, 245, 227, 79, 73, 50, 167, 53, 178, 174, 56, 128, 165, 69, 185, 82, 181, 77, 110, 172, 31, 152, 184, 14, 182, 179, 186, 125, 98, 243, 142, 65, 3, 121, 102, 101, 100, 200, 35, 3, 113, 42, 218, 28, 247, 109, 34, 200, 158, 177, 37, 110, 17, 76, 185, 216, 52, 232, 60, 71, 82, 7, 214, 195, 244, 77, 233, 51, 175, 117, 56, 17, 134, 48, 217, 248, 76, 25, 146, 243, 109, 224, 13, 128, 27, 64, 4, 147, 210, 86, 71, 28, 100, 44, 86, 92, 78, 168, 249, 181, 236, 236, 114, 160, 254, 198, 133, 74, 227, 140, 190, 128, 179, 221, 73, 22, 154, 229, 21, 229, 38, 67, 92, 65, 202, 127, 198, 120, 150, 118, 90, 77, 208, 17, 207, 2, 98, 247, 138, 58, 183, 80, 142, 83, 84, 146, 251, 151, 155, 106, 189, 251, 135, 128, 82, 95, 238, 92, 100, 83, 72, 106, 16, 70, 248, 228, 41, 207, 21, 3, 232, 236, 54, 233, 217, 228, 164, 161, 16, 48, 43, 133, 191, 17, 151, 135, 126, 187, 118, 204, 108, 84, 50, 24, 226, 91, 8, 70, 13, 240, 5, 23, 224, 127, 123, 132, 161, 214, 118, 11, 164, 235, 150, 223, 125, 150, 99, 197, 81, 96, 5, 57, 32, 154, 219, 92, 218, 223, 111, 87, 219, 217, 155, 183, 37, 104, 198, 229, 107, 33, 169, 110, 180, 16, 237, 175, 43, 25, 241, 153, 167, 23, 56, 179, 218, 185, 122, 153, 208, 106, 118, 147, 205, 68, 164, 150, 174, 83, 141, 148, 220, 94, 35, 47, 54, 13, 26, 238, 169, 142, 68, 127, 41, 248, 66, 129, 19, 63, 46, 171, 128, 242, 220, 53, 21, 169, 64, 233, 161, 191, 237, 0, 167, 191, 134, 253, 97, 135, 82, 152, 241, 17, 152, 58, 107, 232, 245, 21, 35, 96, 142, 211, 137, 113, 30, 250, 102, 60, 37, 229, 208, 159, 45, 47, 228, 181, 6, 180, 118, 162, 175, 206, 53, 114, 145, 177, 60, 11, 83, 246, 70, 177, 232, 82, 171, 245, 240, 239, 213, 224, 155, 90, 213, 94, 222, 160, 178, 73, 173, 70, 8, 48, 216, 165, 9, 249, 239, 139, 96, 104, 15, 96, 166, 241, 121, 29, 137, 135, 192, 11, 66, 182, 250, 211, 67, 211, 2, 106, 146, 179, 230, 140, 15, 91, 173, 77, 85, 173, 126, 136, 162, 144, 195, 155, 131, 13, 234, 180, 118, 142, 86, 222, 164, 174, 203, 92, 193, 140, 143, 129, 177, 146, 69, 247, 172, 188, 62, 37, 128, 108, 232, 96, 199, 229, 195, 234, 201, 5, 127, 0, 221, 245, 216, 237, 147, 241, 162, 174, 236, 96, 237, 16, 0, 13, 126, 16, 84, 113, 61, 101, 72, 149, 180, 190, 181, 121, 245, 183, 110, 90, 109, 148, 122, 69, 19, 188, 154, 62, 66, 41, 208, 115, 129, 43, 8, 6, 107, 33, 227, 33, 157, 220, 101, 117, 144, 81, 35, 189, 39, 49, 231, 147, 252, 176, 186, 239, 72, 149, 244, 214, 95, 54, 245, 221, 61, 136, 105, 183, 158, 143, 246, 91, 156, 0, 225, 143, 199, 93, 239, 252, 74, 137, 78, 44, 222, 247, 67, 155, 151, 187, 198, 38, 14, 131, 175, 22, 204, 140, 220, 81, 201, 4, 160, 216, 43, 170, 238, 170, 251, 122, 230, 103, 93, 210, 62, 63, 130, 241, 34, 106, 250, 206, 245, 65, 134, 176, 206, 211, 2, 134, 217, 130, 95, 116, 192, 93, 141, 36, 197, 183, 149, 89, 102, 205, 25, 221, 210, 42, 158, 82, 219, 56, 7, 191, 36, 30, 108, 15, 129, 35, 172, 11, 64, 97, 14, 100, 120, 208, 234, 230, 169, 201, 59, 159, 244, 11, 55, 191, 128, 218, 216, 163, 223, 250, 56, 253, 198, 229, 197, 255, 57, 104, 167, 211, 229, 114, 238, 148, 220, 89, 51, 47, 10, 30, 130, 231, 64, 225, 200, 160, 124, 41, 47, 160, 27, 238, 158, 16, 49, 52, 108, 208, 222, 97, 208, 162, 39, 20, 25, 238, 225, 54, 130, 25, 167, 55, 2, 145, 106, 112, 77, 100, 195, 76, 107, 222, 159, 147, 186, 232, 6, 67, 38, 195, 195, 117, 193, 151, 65, 5, 30, 220, 41, 160, 172, 208, 186, 200, 107, 111, 213, 81, 35, 83, 185, 9, 29, 15, 7, 176, 19, 195, 208, 207, 208, 233, 82, 26, 65, 15, 175, 216, 98, 71, 245, 101, 218, 120, 103, 84, 197, 11, 24, 71, 73, 237, 26, 164, 87, 83, 215, 239, 247, 11, 133, 105, 244, 220, 122, 163, 112, 156, 49, 139, 94, 12, 213, 8, 74, 214, 67, 202, 87, 228, 128, 169, 39, 216, 187, 98, 116, 224, 15, 225, 179, 205, 162, 105, 82, 71, 62, 7, 27, 44, 182, 202, 126, 221, 139, 153, 70, 143, 60, 151, 157, 107, 121, 151, 137, 129, 195, 45, 88, 134, 147, 165, 132, 194, 120, 83, 28, 175, 236, 233, 69, 227, 94, 54, 174, 26, 98, 20, 43, 68, 107, 50, 26, 58, 158, 134, 187, 234, 254, 174, 131, 187, 61, 32, 164, 247, 3, 3, 99, 42, 95, 157, 191, 93, 246, 183, 117, 123, 137, 66, 47, 230, 14, 176, 106, 255, 117, 17, 33, 43, 146, 157, 91, 146, 25, 203, 134, 220, 136, 111, 197, 77, 50, 32, 103, 139, 108, 4, 137, 132, 197, 231, 32, 135, 5, 88, 62, 11, 71, 40, 141, 101, 8, 158, 176, 191, 14, 157, 180, 122, 206, 130, 13, 168, 47, 1, 255, 214, 72, 223, 184, 132, 41, 128, 171, 208, 164, 227, 36, 135, 31, 67, 124, 9, 119, 24, 2, 230, 96, 135, 216, 29, 137, 55, 115, 100, 45, 118, 111, 236, 195, 86, 106, 249, 136, 87, 249, 54, 181, 1, 196, 180, 110, 69, 117, 129, 30, 154, 175, 222, 43, 140, 252, 89, 69, 11, 140, 237, 24, 196, 239, 109, 215, 139, 72, 16, 30, 122, 58, 249, 91, 220, 209, 9, 0, 22, 159, 9, 237, 121, 1, 255, 8, 8, 29, 73, 216, 24, 205, 110, 81, 158, 92, 174, 73, 253, 96, 120, 82, 235, 179, 234, 0, 137, 121, 7, 133, 163, 82, 188, 237, 117, 117, 122, 102, 186, 98, 150, 119, 215, 5, 32, 62, 39, 109, 34, 221, 238, 111, 170, 127, 164, 186, 199, 255, 28, 37, 83, 208, 68, 216, 40, 60, 1, 86, 80, 138, 77, 246, 37, 10, 25, 65, 217, 0, 51, 155, 124, 191, 237, 52, 120, 236, 181, 174, 238, 248, 33, 134, 168, 82, 1, 248, 197, 15, 23, 54, 49, 205, 124, 192, 222, 111, 240, 146, 71, 126, 186, 222, 196, 119, 64, 216, 20, 97, 128, 15, 199, 95, 168, 238, 243, 6, 57, 149, 111, 210, 38, 104, 66, 144, 54, 211, 224, 41, 39, 49, 112, 133, 15, 139, 67, 246, 137, 33, 245, 175, 126, 238, 0, 143, 22, 26, 1, 40, 123, 67, 224, 101, 119, 107, 55, 241, 93, 115, 197, 146, 169, 100, 45, 169, 141, 216, 14, 136, 55, 133, 210, 222, 206, 139, 106, 188, 249, 160, 159, 104, 167, 28, 15, 217, 73, 105, 201, 250, 179, 202, 15, 34, 160, 174, 191, 202, 9, 81, 250, 104, 188, 84, 108, 224, 218, 12, 205, 12, 73, 189, 96, 59, 140, 213, 126, 132, 18, 54, 9, 170, 215, 85, 42, 192, 68, 85, 36, 81, 227, 121, 170, 179, 162, 195, 108, 87, 29, 169, 244, 208, 115, 113, 144, 31, 50, 215, 55, 37, 238, 117, 162, 20, 239, 244, 44, 51, 147, 253, 26, 220, 63, 82, 198, 178, 3, 253, 138, 155, 159, 199, 60, 123, 52, 236, 107, 129, 0, 114, 181, 48, 118, 241, 107, 189, 1, 96, 137, 84, 37, 48, 111, 120, 201, 238, 248, 84, 170, 208, 148, 88, 142, 139, 128, 84, 72, 95, 241, 85, 37, 51, 3, 132, 182, 86, 10, 51, 78, 104, 167, 235, 177, 212, 32, 76, 129, 39, 188, 146, 45, 125, 6, 56, 162, 5, 211, 96, 23, 76, 212, 194, 110, 207, 64, 61, 68, 6, 26, 48, 56, 12, 180, 112, 34, 1, 254, 53, 136, 100, 171, 24, 41, 86, 165, 48, 114, 132, 187, 178, 214, 94, 23, 9, 137, 128, 76, 191, 42, 211, 107, 162, 254, 158, 219, 146, 128, 37, 216, 100, 23, 113, 125, 10, 252, 8, 101, 198, 73, 238, 40, 155, 1, 185, 12, 222, 179, 225, 133, 8, 207, 181, 199, 137, 114, 137, 200, 78, 79, 32, 217, 228, 127, 75, 13, 0, 155, 94, 20, 15, 114, 135, 59, 190, 187, 86, 8, 221, 12, 73, 1, 82, 128, 166, 212, 156, 93, 164, 101, 249, 107, 222, 159, 153, 118, 179, 30, 27, 187, 137, 83, 23, 113, 125, 12, 122, 214, 6, 51, 196, 54, 164, 125, 19, 78, 111, 239, 124, 76, 146, 249, 75, 28, 133, 225, 147, 20, 218, 139, 96, 159, 174, 178, 125, 155, 69, 66, 111, 20, 35, 151, 36, 191, 51, 38, 125, 79, 68, 98, 43, 135, 182, 211, 212, 170, 100, 30, 9, 230, 11, 12, 179, 23, 232, 243, 83, 171, 194, 179, 114, 83, 199, 163, 147, 217, 24, 55, 140, 58, 246, 26, 60, 156, 126, 90, 112, 211, 49, 137, 22, 83, 57, 163, 78, 7, 192, 100, 210, 112, 29, 44, 57, 28, 31, 4, 232, 53, 189, 107, 172, 83, 38, 149, 24, 74, 42, 211, 89, 136, 209, 9, 127, 131, 78, 218, 250, 250, 19, 234, 86, 209, 135, 176, 126, 67, 61, 155, 7, 132, 223, 108, 44, 21, 227, 213, 41, 197, 133, 22, 168, 249, 118, 205, 43, 97, 104, 209, 17, 122, 200, 246, 80, 128, 41, 159, 109, 43, 95, 151, 175, 241, 212, 34, 164, 70, 0, 236, 144, 153, 178, 188, 30, 62, 7, 191, 154, 184, 172, 86, 146, 58, 67, 164, 70, 80, 2, 232, 29, 199, 12, 189, 57, 228, 76, 239, 154, 219, 2, 62, 73, 166, 247, 145, 160, 201, 241, 103, 115, 101, 77, 82, 238, 10, 215, 156, 143, 112, 166, 237, 221, 134, 124, 253, 114, 214, 196, 130, 167, 198, 47, 9, 144, 43, 169, 104, 34, 248, 53, 223, 88, 169, 211, 253, 183, 172, 185, 199, 95, 176, 94, 92, 29, 13, 4, 100, 173, 123, 131, 137, 218, 182, 217, 239, 62, 72, 118, 157, 89, 23, 116, 61, 88, 178, 119, 99, 63, 198, 168, 236, 137, 233, 62, 140, 75, 175, 46, 24, 182, 229, 20, 3, 237, 213, 160, 199, 181, 99, 207, 24, 153, 168, 238, 25, 158, 161, 137, 105, 189, 152, 50, 151, 252, 99, 45, 70, 147, 236, 228, 185, 89, 85, 190, 75, 25, 37, 152, 140, 138, 243, 163, 154, 224, 220, 37, 241, 171, 134, 246, 143, 36, 164, 228, 172, 89, 127, 224, 189, 46, 230, 251, 13, 41, 198, 74, 205, 206, 219, 203, 184, 9, 86, 229, 79, 177, 75, 217, 67, 15, 27, 195, 100, 234, 216, 195, 148, 28, 97, 146, 138, 215, 108, 93, 1, 244, 23, 76, 204, 183, 20, 99, 221, 152, 118, 90, 3, 119, 60, 8, 8, 98, 178, 145, 144, 202, 98, 18, 44, 125, 13, 4, 57, 173, 141, 162, 18, 96, 123, 15, 100, 243, 7, 163, 103, 2, 27, 123, 143, 209, 60, 185, 68, 76, 190, 247, 39, 189, 2, 235, 152, 250, 59, 56, 152, 11, 94, 180, 12, 144, 94, 57, 105, 226, 142, 109, 148, 203, 201, 232, 12, 133, 199, 170, 146, 190, 54, 206, 240, 184, 8, 33, 77, 201, 163, 116, 73, 193, 3, 96, 4, 175, 3, 199, 110, 98, 41, 18, 158, 192, 80, 234, 187, 206, 91, 217, 127, 233, 214, 38, 36, 80, 67, 192, 201, 37, 77, 116, 72, 13, 44, 250, 177, 172, 31, 159, 38, 41, 106, 106, 89, 247, 239, 238, 11, 92, 125, 132, 29, 64, 16, 88, 128, 255, 122, 77, 0, 182, 249, 173, 136, 33, 88, 12, 230, 202, 220, 143, 59, 68, 97, 138, 11, 219, 145, 88, 48, 20, 118, 77, 226, 140, 193, 95, 35, 184, 78, 186, 184, 238, 35, 227, 74, 57, 182, 43, 39, 55, 19, 50, 207, 127, 235, 50, 18, 215, 107, 17, 59, 175, 141, 79, 127, 234, 214, 152, 3, 182, 167, 121, 169, 247, 36, 36, 218, 200, 3, 5, 171, 195, 18, 42, 80, 113, 29, 200, 112, 229, 229, 233, 37, 161, 63, 116, 2, 40, 163, 78, 25, 59, 141, 99, 234, 113, 174, 165, 136, 137, 64, 203, 134, 172, 125, 138, 244, 74, 240, 85, 204, 33, 108, 4, 184, 179, 176, 114, 21, 162, 134, 103, 67, 246, 33, 161, 173, 243, 45, 143, 117, 229, 22, 145, 135, 150, 218, 161, 179, 127, 112, 182, 68, 76, 192, 57, 82, 102, 154, 51, 10, 240, 244, 131, 84, 242, 213, 151, 238, 58, 141, 146, 182, 97, 142, 88, 183, 81, 38, 44, 97, 78, 133, 67, 35, 113, 88, 41, 129, 188, 66, 226, 73, 65, 196, 59, 34, 59, 121, 98, 130, 161, 28, 124, 32, 234, 203, 93, 160, 25, 198, 75, 205, 154, 211, 22, 67, 143, 31, 117, 99, 60, 116, 99, 162, 41, 209, 179, 128, 7, 188, 64, 158, 114, 32, 187, 223, 124, 65, 123, 76, 72, 42, 141, 160, 111, 138, 162, 204, 104, 107, 66, 27, 83, 248, 30, 219, 191, 66, 85, 203, 58, 75, 237, 153, 15, 18, 154, 179, 129, 86, 191, 252, 29, 52, 113, 254, 185, 119, 162, 220, 54, 158, 145, 246, 84, 71, 120, 21, 24, 141, 235, 79, 154, 188, 164, 143, 40, 56, 196, 255, 132, 236, 112, 94, 96, 141, 255, 215, 154, 102, 221, 222, 178, 127, 29, 194, 171, 242, 158, 115, 139, 20, 27, 192, 147, 44, 89, 39, 169, 166, 45, 181, 76, 136, 165, 135, 76, 0, 17, 221, 15, 79, 136, 143, 44, 168, 76, 180, 177, 206, 131, 54, 135, 48, 251, 39, 240, 198, 171, 169, 184, 235, 151, 23, 231, 16, 94, 91, 72, 40, 55, 227, 62, 164, 164, 117, 178, 178, 121, 209, 193, 180, 248, 52, 202, 77, 136, 37, 212, 17, 254, 44, 239, 15, 64, 55, 67, 7, 145, 27, 180, 19, 101, 37, 26, 8, 7, 5, 98, 30, 193, 95, 83, 70, 40, 17, 130, 116, 157, 11, 232, 37, 112, 53, 87, 251, 12, 58, 245, 175, 153, 134, 223, 200, 173, 49, 69, 177, 239, 221, 51, 22, 249, 145, 62, 77, 211, 46, 230, 26, 57, 178, 24, 88, 110, 249, 240, 137, 90, 184, 44, 209, 122, 77, 89, 132, 59, 98, 102, 214, 31, 1, 48, 249, 194, 235, 68, 198, 252, 21, 70, 203, 163, 157, 181, 98, 135, 202, 221, 32, 188, 98, 80, 26, 13, 126, 246, 59, 143, 100, 163, 109, 241, 17, 214, 96, 95, 149, 103, 57, 50, 132, 224, 210, 78, 218, 45, 73, 2, 27, 89, 138, 201, 163, 209, 220, 84, 141, 224, 104, 64, 118, 136, 92, 35, 137, 6, 41, 224, 138, 138, 221, 11, 232, 113, 167, 242, 37, 210, 139, 232, 215, 44, 193, 240, 237, 193, 3, 12, 230, 1, 129, 85, 76, 8, 191, 195, 16, 49, 47, 79, 247, 9, 113, 179, 51, 78, 14, 169, 85, 219, 193, 255, 10, 245, 111, 181, 148, 33, 173, 191, 194, 2, 138, 48, 110, 9, 199, 194, 81, 41, 7, 81, 121, 136, 180, 113, 82, 247, 241, 168, 10, 160, 55, 32, 235, 92, 55, 145, 213, 179, 179, 79, 153, 63, 43, 202, 152, 47, 251, 223, 153, 101, 14, 92, 15, 147, 223, 230, 219, 125, 174, 147, 69, 120, 129, 34, 44, 53, 7, 173, 24, 43, 19, 190, 73, 234, 37, 191, 159, 49, 201, 250, 129, 112, 109, 185, 31, 24, 231, 105, 14, 207, 233, 120, 231, 159, 163, 41, 80, 28, 73, 201, 251, 11, 202, 215, 248, 131, 233, 14, 209, 161, 62, 198, 167, 240, 184, 33, 153, 33, 155, 235, 140, 213, 107, 165, 153, 174, 99, 201, 131, 227, 4, 34, 34, 138, 147, 51, 115, 77, 62, 167, 170, 235, 234, 221, 171, 5, 191, 18, 250, 178, 31, 163, 141, 147, 72, 211, 139, 194, 155, 190, 145, 129, 83, 207, 104, 254, 22, 249, 88, 243, 203, 98, 175, 117, 93, 134, 13, 30, 65, 70, 192, 63, 76, 17, 196, 77, 177, 13, 237, 30, 220, 138, 152, 16, 7, 59, 140, 52, 112, 76, 192, 154, 99, 51, 67, 6, 111, 126, 207, 103, 79, 25, 198, 175, 201, 144, 211, 24, 112, 142, 17, 46, 253, 157, 66, 229, 14, 201, 251, 97, 151, 96, 225, 21, 151, 82, 4, 8, 227, 38, 92, 68, 173, 54, 227, 95, 244, 209, 137, 63, 129, 95, 170, 234, 13, 94, 51, 83, 243, 151, 123, 172, 252, 45, 114, 24, 231, 56, 134, 138, 194, 130, 194, 62, 116, 25, 80, 122, 137, 58, 251, 105, 169, 119, 10, 174, 162, 11, 202, 31, 27, 51, 120, 203, 67, 70, 172, 230, 42, 18, 242, 58, 203, 214, 218, 138, 187, 60, 204, 160, 65, 191, 138, 103, 57, 110, 63, 45, 15, 107, 169, 198, 199, 70, 119, 231, 106, 35, 204, 15, 109, 173, 124, 203, 61, 235, 247, 5, 2, 119, 243, 108, 194, 75, 229, 185, 187, 139, 226, 93, 239, 38, 62, 50, 110, 188, 91, 209, 227, 151, 126, 147, 1, 98, 2, 109, 218, 123, 165, 140, 159, 43, 185, 240, 94, 88, 213, 189, 45, 156, 11, 80, 132, 37, 246, 171, 92, 82, 60, 252, 244, 217, 45, 212, 109, 158, 182, 150, 224, 138, 140, 205, 225, 108, 67, 161, 70, 201, 28, 7, 105, 119, 186, 80, 125, 212, 226, 50, 129, 249, 195, 158, 63, 105, 229, 96, 15, 118, 0, 140, 218, 188, 157, 62, 205, 3, 155, 139, 236, 5, 36, 54, 69, 43, 138, 146, 222, 145, 40, 104, 139, 90, 113, 241, 106, 79, 170, 53, 180, 50, 185, 65, 252, 144, 104, 121, 205, 1, 205, 183, 65, 102, 33, 242, 158, 42, 132, 75, 206, 120, 26, 121, 73, 153, 89, 38, 95, 83, 95, 96, 82, 217, 18, 235, 136, 11, 130, 129, 213, 224, 68, 140, 29, 25, 5, 201, 254, 199, 215, 173, 134, 165, 98, 237, 87, 105, 10, 192, 225, 1, 250, 243, 160, 222, 62, 71, 225, 65, 0, 131, 170, 157, 54, 225, 121, 54, 165, 248, 254, 236, 218, 183, 153, 140, 147, 47, 147, 19, 245, 12, 32, 120, 9, 70, 108, 58, 191, 213, 144, 26, 124, 167, 187, 2, 88, 46, 142, 5, 219, 237, 198, 120, 115, 209, 210, 174, 11, 84, 34, 244, 244, 78, 159, 188, 18, 204, 124, 199, 211, 245, 138, 17, 118, 215, 162, 139, 156, 74, 74, 3, 48, 97, 122, 116, 14, 247, 87, 26, 25, 164, 43, 18, 151, 61, 159, 184, 6, 13, 98, 15, 147, 162, 15, 203, 48, 176, 37, 109, 52, 85, 220, 129, 244, 214, 90, 127, 210, 151, 119, 123, 101, 206, 111, 165, 238, 243, 203, 199, 168, 123, 75, 52, 100, 158, 4, 243, 142, 65, 247, 158, 126, 61, 19, 105, 161, 70, 10, 239, 115, 73, 131, 243, 18, 171, 152, 59, 192, 135, 255, 245, 154, 221, 138, 187, 1, 123, 203, 78, 73, 232, 113, 127, 138, 32, 159, 56, 239, 238, 201, 142, 142, 24, 39, 153, 237, 73, 251, 134, 170, 6, 0, 159, 229, 81, 120, 78, 247, 217, 23, 243, 83, 88, 151, 46, 223, 9, 69, 187, 245, 105, 161, 3, 120, 105, 142, 117, 47, 82, 80, 109, 140, 226, 112, 160, 147, 196, 26, 174, 193, 141, 225, 131, 133, 40, 49, 22, 138, 226, 218, 95, 0, 39, 76, 52, 90, 60, 133, 175, 255, 183, 227, 224, 149, 70, 198, 25, 67, 139, 78, 28, 78, 231, 68, 188, 114, 211, 134, 128, 190, 121, 101, 136, 202, 165, 189, 177, 9, 23, 8, 5, 47, 121, 169, 103, 237, 181, 54, 44, 5, 167, 148, 79, 53, 84, 97, 133, 252, 119, 124, 231, 85, 6, 111, 120, 121, 116, 238, 218, 149, 186, 146, 67, 214, 201, 254, 89, 29, 76, 81, 19, 249, 83, 65, 15, 162, 208, 190, 251, 113, 46, 96, 216, 202, 65, 204, 30, 67, 247, 166, 114, 128, 89, 168, 101, 244, 55, 77, 186, 106, 120, 106, 242, 123, 204, 207, 75, 43, 235, 80, 221, 243, 105, 171, 123, 90, 145, 88, 230, 162, 159, 85, 84, 192, 203, 111, 2, 39, 251, 69, 145, 142, 133, 189, 187, 70, 145, 179, 13, 90, 38, 142, 134, 50, 56, 197, 221, 62, 198, 249, 177, 221, 48, 76, 126, 203, 166, 41, 170, 193, 78, 34, 249, 240, 249, 52, 167, 166, 168, 98, 70, 150, 82, 235, 38, 237, 218, 184, 161, 243, 147, 189, 57, 47, 217, 172, 174, 15, 226, 144, 89, 63, 112, 213, 207, 214, 35, 83, 113, 80, 39, 134, 238, 44, 50, 50, 163, 26, 222, 181, 234, 80, 11, 106, 213, 188, 207, 157, 114, 102, 243, 42, 233, 250, 43, 156, 230, 185, 233, 32, 253, 233, 197, 226, 190, 3, 135, 157, 55, 62, 60, 255, 65, 143, 82, 236, 82, 9, 251, 99, 115, 151, 156, 246, 200, 186, 223, 236, 208, 57, 50, 216, 63, 75, 245, 16, 206, 88, 46, 84, 252, 167, 71, 235, 108, 154, 90, 204, 128, 166, 160, 153, 61, 63, 18, 245, 188, 49, 13, 232, 17, 243, 60, 152, 151, 225, 133, 144, 3, 159, 4, 123, 209, 188, 208, 175, 195, 214, 99, 244, 46, 88, 60, 222, 164, 108, 192, 187, 82, 48, 180, 248, 140, 13, 114, 137, 216, 166, 39, 194, 83, 228, 188, 25, 182, 166, 72, 193, 114, 39, 107, 254, 223, 78, 6, 208, 172, 37, 196, 248, 18, 208, 157, 252, 11, 221, 59, 189, 98, 230, 182, 247, 48, 98, 99, 170, 63, 105, 250, 4, 216, 188, 201, 226, 138, 42, 214, 31, 35, 196, 218, 22, 61, 203, 99, 138, 204, 194, 0, 141, 0, 141, 151, 66, 30, 144, 42, 122, 118, 50, 49, 135, 100, 41, 215, 239, 90, 134, 196, 119, 248, 112, 219, 167, 251, 165, 193, 21, 105, 111, 127, 22, 130, 53, 249, 214, 216, 38, 80, 40, 113, 67, 121, 217, 63, 39, 210, 112, 124, 23, 223, 194, 37, 100, 233, 186, 54, 137, 224, 201, 169, 151, 68, 252, 251, 197, 250, 127, 147, 239, 145, 174, 182, 0, 135, 168, 68, 72, 173, 32, 254, 41, 223, 178, 142, 102, 70, 85, 55, 163, 135, 205, 34, 44, 121, 172, 78, 64, 150, 92, 145, 86, 45, 15, 244, 220, 17, 122, 39, 168, 79, 162, 217, 98, 84, 156, 75, 175, 8, 230, 235, 82, 157, 11, 226, 137, 194, 216, 177, 40, 197, 88, 15, 135, 68, 209, 249, 227, 164, 27, 108, 221, 164, 170, 111, 34, 154, 109, 151, 227, 137, 58, 65, 115, 179, 18, 223, 251, 163, 151, 82, 108, 252, 183, 97, 125, 39, 193, 245, 208, 94, 74, 145, 111, 140, 122, 179, 141, 185, 92, 201, 183, 88, 193, 250, 255, 136, 212, 11, 152, 140, 43, 214, 27, 139, 254, 65, 67, 189, 252, 143, 171, 146, 27, 48, 210, 14, 122, 65, 15, 14, 207, 197, 71, 49, 159, 24, 101, 10, 227, 232, 68, 141, 24, 196, 5, 98, 211, 227, 80, 143, 246, 84, 130, 128, 13, 68, 15, 243, 47, 70, 15, 249, 243, 36, 98, 120, 56, 142, 116, 241, 176, 245, 225, 35, 205, 64, 211, 206, 248, 48, 77, 149, 216, 89, 86, 161, 83, 37, 115, 163, 151, 197, 208, 118, 118, 69, 167, 196, 50, 37, 194, 213, 48, 119, 84, 238, 230, 57, 238, 224, 236, 109, 15, 24, 191, 34, 236, 189, 200, 17, 13, 215, 92, 110, 26, 229, 140, 183, 97, 41, 149, 153, 65, 81, 42, 72, 43, 90, 158, 105, 83, 106, 175, 94, 2, 18, 12, 143, 78, 205, 214, 141, 55, 186, 106, 225, 36, 151, 73, 125, 104, 158, 184, 167, 213, 212, 75, 22, 17, 3, 38, 227, 235, 48, 6, 144, 92, 117, 89, 89, 109, 198, 165, 67, 56, 248, 125, 243, 44, 89, 240, 116, 83, 109, 127, 172, 95, 136, 109, 182, 143, 153, 87, 12, 11, 128, 13, 48, 223, 141, 170, 232, 125, 249, 225, 39, 203, 221, 1, 6, 190, 180, 16, 146, 115, 49, 220, 140, 72, 43, 41, 183, 52, 252, 191, 252, 201, 147, 68, 77, 201, 106, 73, 218, 72, 131, 22, 133, 150, 137, 129, 133, 185, 118, 42, 30, 131, 209, 222, 147, 88, 137, 104, 169, 199, 220, 138, 88, 96, 205, 94, 16, 61, 210, 71, 34, 78, 24, 71, 186, 33, 109, 252, 22, 37, 121, 174, 185, 116, 61, 251, 247, 138, 249, 79, 141, 243, 244, 136, 39, 45, 212, 26, 102, 189, 86, 103, 224, 114, 84, 226, 105, 210, 143, 123, 209, 129, 73, 94, 9, 219, 214, 71, 169, 98, 125, 234, 210, 18, 119, 82, 213, 34, 21, 216, 140, 180, 21, 57, 6, 216, 213, 53, 55, 42, 161, 82, 178, 143, 197, 245, 54, 86, 101, 184, 14, 198, 123, 120, 214, 106, 44, 27, 107, 145, 72, 168, 35, 13, 2, 127, 182, 34, 96, 164, 47, 169, 30, 251, 242, 158, 8, 184, 67, 186, 50, 90, 214, 232, 240, 209, 82, 108, 244, 45, 186, 82, 2, 231, 217, 209, 69, 99, 7, 179, 76, 193, 211, 84, 86, 54, 101, 170, 129, 9, 104, 128, 169, 147, 244, 148, 70, 205, 128, 159, 94, 71, 112, 142, 213, 8, 51, 161, 17, 102, 147, 176, 142, 99, 13, 231, 77, 4, 6, 207, 204, 200, 180, 143, 176, 54, 154, 231, 29, 167, 114, 72, 173, 133, 226, 187, 93, 197, 168, 152, 145, 203, 79, 162, 161, 212, 102, 166, 219, 155, 86, 148, 83, 242, 56, 123, 80, 91, 140, 183, 81, 144, 254, 30, 106, 195, 61, 155, 55, 181, 140, 14, 223, 251, 14, 248, 125, 75, 183, 119, 140, 151, 176, 233, 194, 239, 225, 237, 15, 186, 26, 166, 19, 129, 248, 108, 50, 77, 73, 103, 15, 88, 64, 225, 178, 168, 127, 21, 233, 214, 216, 238, 183, 177, 58, 43, 72, 25, 233, 0, 217, 198, 237, 74, 247, 163, 157, 131, 113, 6, 69, 98, 98, 133, 143, 240, 170, 120, 189, 222, 179, 23, 152, 240, 70, 157, 103, 64, 19, 120, 16, 23, 200, 230, 214, 124, 147, 195, 53, 59, 3, 137, 101, 6, 104, 44, 60, 63, 63, 29, 237, 55, 202, 13, 20, 41, 158, 94, 56, 253, 90, 159, 142, 128, 239, 198, 194, 254, 247, 127, 12, 83, 211, 173, 139, 146, 211, 54, 153, 121, 22, 96, 231, 211, 174, 203, 111, 65, 45, 110, 162, 195, 232, 42, 75, 10, 165, 71, 22, 210, 73, 129, 234, 93, 102, 228, 116, 9, 175, 255, 244, 228, 2, 71, 136, 212, 127, 31, 217, 154, 53, 126, 190, 198, 80, 36, 113, 139, 108, 24, 239, 17, 154, 62, 40, 42, 61, 26, 24, 166, 218, 22, 101, 62, 218, 190, 239, 77, 29, 163, 239, 154, 249, 224, 69, 208, 230, 11, 193, 16, 71, 86, 252, 177, 231, 88, 174, 155, 120, 219, 189, 157, 250, 106, 58, 121, 7, 112, 66, 84, 168, 137, 76, 69, 113, 25, 19, 121, 80, 137, 10, 241, 235, 31, 246, 175, 197, 195, 106, 156, 191, 78, 248, 207, 66, 223, 251, 71, 89, 150, 116, 145, 226, 108, 56, 102, 2, 180, 111, 92, 223, 254, 26, 243, 125, 250, 208, 168, 4, 139, 172, 10, 211, 132, 228, 235, 238, 81, 93, 31, 214, 127, 45, 76, 98, 232, 151, 187, 87, 232, 233, 216, 86, 132, 80, 78, 108, 115, 11, 197, 47, 238, 145, 201, 194, 216, 97, 166, 231, 94, 101, 7, 202, 167, 127, 84, 30, 236, 36, 85, 43, 147, 86, 161, 245, 165, 82, 165, 252, 160, 26, 107, 70, 255, 88, 103, 183, 153, 11, 62, 199, 216, 183, 105, 142, 2, 180, 29, 138, 94, 108, 141, 178, 15, 164, 182, 69, 12, 65, 59, 243, 124, 209, 36, 6, 81, 120, 152, 212, 113, 227, 186, 115, 171, 254, 6, 237, 226, 108, 75, 228, 66, 199, 171, 129, 115, 139, 224, 199, 31, 134, 24, 184, 193, 195, 174, 62, 148, 136, 253, 115, 232, 242, 180, 200, 127, 40, 14, 8, 108, 91, 237, 74, 253, 216, 147, 80, 193, 131, 4, 49, 221, 223, 243, 204, 203, 63, 133, 231, 3, 169, 129, 197, 108, 135, 203, 204, 225, 7, 134, 16, 155, 50, 23, 243, 40, 95, 102, 164, 184, 151, 121, 134, 84, 202, 145, 61, 255, 80, 155, 41, 106, 136, 136, 168, 76, 217, 212, 26, 239, 60, 18, 228, 16, 127, 143, 67, 48, 18, 58, 246, 90, 125, 157, 117, 181, 170, 172, 65, 4, 202, 240, 73, 196, 98, 61, 254, 226, 120, 0, 215, 178, 75, 120, 16, 136, 84, 1, 67, 201, 28, 56, 153, 199, 234, 116, 156, 171, 190, 219, 252, 112, 116, 215, 116, 36, 221, 18, 63, 98, 112, 28, 217, 145, 168, 118, 102, 106, 114, 213, 69, 127, 108, 20, 219, 19, 81, 57, 172, 9, 20, 127, 246, 52, 11, 206, 163, 107, 170, 137, 228, 236, 128, 99, 219, 79, 222, 253, 90, 68, 240, 20, 189, 151, 236, 204, 106, 234, 107, 17, 226, 144, 28, 64, 177, 98, 84, 81, 83, 100, 251, 252, 248, 223, 157, 47, 177, 249, 77, 138, 195, 103, 245, 92, 34, 226, 91, 165, 5, 124, 131, 7, 54, 130, 131, 182, 18, 165, 190, 220, 210, 84, 209, 83, 206, 99, 217, 194, 89, 133, 90, 191, 167, 219, 151, 203, 167, 126, 141, 237, 41, 255, 12, 124, 82, 24, 135, 200, 192, 64, 55, 58, 99, 132, 54, 199, 25, 240, 137, 234, 89, 49, 135, 194, 251, 96, 143, 6, 187, 133, 200, 177, 242, 4, 178, 55, 95, 161, 55, 160, 42, 192, 64, 206, 183, 39, 85, 75, 33, 81, 164, 239, 252, 49, 47, 237, 246, 217, 249, 160, 210, 208, 101, 136, 64, 213, 222, 15, 24, 93, 91, 207, 120, 0, 44, 55, 75, 55, 218, 130, 102, 208, 83, 229, 69, 66, 211, 57, 145, 165, 176, 134, 17, 49, 247, 202, 146, 11, 75, 80, 104, 38, 224, 98, 34, 187, 220, 146, 167, 72, 186, 8, 65, 68, 252, 71, 236, 146, 235, 126, 201, 163, 161, 23, 33, 69, 135, 86, 82, 162, 143, 54, 69, 84, 175, 206, 44, 181, 194, 132, 238, 7, 226, 80, 244, 128, 121, 105, 163, 66, 226, 200, 109, 232, 165, 62, 232, 157, 81, 192, 140, 200, 229, 232, 53, 146, 6, 91, 250, 205, 66, 3, 113, 31, 221, 144, 50, 215, 242, 170, 179, 24, 206, 70, 11, 161, 75, 208, 1, 54, 76, 172, 189, 68, 135, 145, 53, 191, 188, 125, 251, 150, 102, 196, 54, 20, 181, 84, 130, 237, 77, 28, 237, 208, 23, 89, 7, 138, 26, 141, 78, 25, 251, 249, 166, 74, 174, 236, 228, 243, 114, 243, 80, 59, 78, 217, 151, 238, 82, 195, 148, 136, 117, 10, 54, 83, 137, 224, 1, 120, 63, 240, 105, 191, 173, 3, 181, 0, 57, 252, 120, 37, 86, 143, 8, 59, 21, 98, 226, 58, 60, 111, 236, 12, 131, 132, 220, 186, 96, 78, 53, 142, 83, 255, 28, 138, 20, 76, 232, 39, 114, 185, 119, 25, 165, 166, 126, 91, 228, 132, 32, 87, 59, 188, 45, 119, 203, 221, 2, 28, 205, 216, 1, 165, 204, 54, 229, 108, 184, 168, 29, 180, 60, 158, 19, 120, 235, 227, 75, 246, 110, 35, 50, 53, 28, 249, 236, 7, 12, 84, 32, 136, 2, 80, 23, 200, 18, 64, 85, 18, 229, 19, 106, 76, 229, 24, 70, 26, 194, 223, 59, 19, 24, 116, 245, 255, 124, 1, 51, 54, 99, 110, 43, 140, 178, 210, 227, 87, 247, 91, 172, 12, 235, 72, 46, 123, 128, 122, 220, 14, 15, 234, 145, 185, 171, 242, 158, 136, 150, 156, 197, 188, 178, 243, 64, 211, 92, 71, 28, 112, 214, 36, 15, 172, 26, 54, 246, 154, 88, 6, 2, 123, 142, 144, 220, 24, 55, 1, 192, 89, 238, 130, 202, 38, 206, 64, 90, 139, 186, 246, 153, 105, 121, 48, 218, 87, 54, 111, 233, 255, 215, 47, 5, 38, 158, 49, 235, 206, 45, 178, 142, 6, 42, 155, 127, 160, 127, 244, 197, 250, 70, 124, 245, 226, 52, 217, 125, 35, 179, 21, 133, 236, 90, 150, 168, 104, 254, 67, 205, 156, 242, 151, 75, 191, 179, 243, 76, 226, 117, 62, 14, 95, 238, 195, 61, 33, 10, 25, 40, 152, 241, 107, 17, 3, 50, 182, 56, 178, 63, 53, 226, 255, 77, 103, 158, 173, 223, 215, 80, 233, 136, 220, 32, 156, 46, 31, 110, 41, 170, 133, 17, 61, 104, 108, 215, 117, 203, 117, 227, 164, 226, 7, 144, 137, 250, 10, 204, 85, 98, 120, 23, 217, 56, 222, 112, 37, 159, 79, 234, 1, 66, 131, 149, 182, 198, 7, 243, 40, 35, 42, 64, 176, 25, 126, 35, 11, 208, 152, 195, 24, 177, 241, 102, 218, 235, 43, 217, 82, 109, 39, 60, 236, 121, 66, 144, 106, 193, 69, 180, 178, 181, 117, 55, 198, 89, 9, 121, 194, 141, 120, 211, 110, 22, 183, 73, 250, 182, 199, 181, 46, 227, 14, 127, 99, 56, 101, 193, 170, 25, 45, 28, 242, 74, 124, 165, 190, 146, 235, 254, 110, 224, 20, 126, 7, 230, 156, 214, 95, 154, 93, 89, 144, 121, 254, 68, 181, 135, 18, 249, 226, 220, 182, 33, 196, 237, 200, 96, 29, 158, 117, 6, 106, 83, 112, 232, 83, 104, 46, 57, 9, 38, 68, 140, 195, 2, 149, 112, 144, 241, 44, 37, 200, 102, 13, 180, 110, 52, 95, 67, 149, 124, 73, 205, 20, 90, 248, 26, 153, 238, 205, 227, 37, 106, 87, 163, 146, 6, 238, 83, 179, 67, 204, 228, 14, 41, 217, 194, 208, 110, 128, 58, 88, 35, 146, 106, 137, 98, 44, 250, 24, 188, 69, 80, 59, 66, 232, 14, 80, 8, 196, 44, 168, 225, 190, 41, 217, 200, 251, 45, 32, 25, 103, 35, 205, 250, 50, 1, 168, 250, 174, 15, 185, 215, 50, 64, 37, 252, 24, 187, 145, 142, 63, 6, 32, 235, 216, 63, 61, 190, 178, 166, 243, 141, 124, 113, 137, 232, 198, 137, 97, 182, 222, 173, 128, 178, 183, 148, 84, 238, 27, 155, 152, 68, 105, 198, 172, 24, 144, 92, 78, 96, 216, 134, 191, 42, 185, 73, 57, 53, 118, 2, 33, 243, 30, 36, 168, 191, 50, 154, 26, 254, 110, 248, 14, 199, 0, 238, 161, 189, 53, 209, 214, 21, 228, 13, 208, 135, 216, 178, 144, 83, 183, 105, 5, 42, 169, 208, 250, 173, 12, 207, 221, 165, 239, 156, 172, 39, 72, 49, 62, 123, 209, 124, 69, 145, 125, 194, 31, 126, 25, 145, 184, 88, 58, 46, 44, 250, 95, 96, 47, 172, 226, 253, 228, 136, 198, 152, 104, 117, 41, 250, 5, 201, 49, 125, 221, 135, 219, 161, 183, 255, 188, 3, 15, 73, 111, 30, 109, 22, 245, 92, 200, 44, 115, 148, 19, 27, 244, 188, 209, 31, 117, 144, 192, 32, 206, 13, 61, 101, 99, 73, 37, 120, 108, 223, 39, 136, 122, 244, 199, 250, 4, 32, 164, 190, 176, 28, 220, 87, 187, 98, 172, 0, 21, 82, 66, 253, 21, 92, 106, 150, 1, 80, 234, 222, 61, 66, 196, 227, 78, 253, 41, 157, 113, 131, 196, 33, 10, 127, 174, 21, 12, 82, 221, 79, 80, 122, 249, 99, 83, 6, 75, 5, 254, 45, 237, 26, 232, 249, 100, 101, 69, 137, 46, 224, 212, 13, 246, 219, 47, 86, 218, 0, 244, 162, 66, 84, 171, 12, 229, 184, 225, 122, 227, 10, 237, 117, 125, 132, 64, 78, 152, 151, 15, 118, 221, 69, 9, 144, 237, 36, 124, 33, 54, 200, 47, 38, 182, 24, 84, 45, 157, 172, 197, 255, 1, 151, 131, 243, 62, 53, 4, 40, 6, 113, 136, 137, 252, 243, 57, 136, 252, 110, 95, 73, 173, 18, 107, 243, 45, 76, 210, 206, 13, 57, 243, 23, 125, 54, 38, 227, 63, 31, 108, 62, 80, 120, 86, 220, 30, 113, 250, 217, 87, 251, 234, 111, 30, 209, 206, 134, 25, 208, 238, 107, 200, 62, 221, 241, 211, 29, 80, 179, 233, 137, 240, 17, 138, 93, 80, 73, 137, 172, 140, 146, 161, 95, 84, 23, 200, 212, 163, 154, 156, 61, 210, 34, 74, 18, 123, 126, 17, 214, 50, 141, 61, 9, 113, 45, 56, 80, 224, 58, 163, 173, 37, 163, 143, 71, 131, 119, 179, 31, 244, 117, 70, 154, 9, 11, 74, 246, 125, 254, 211, 38, 108, 223, 126, 23, 120, 136, 252, 164, 235, 255, 60, 251, 104, 178, 212, 215, 219, 34, 235, 135, 9, 118, 79, 248, 123, 204, 229, 214, 223, 59, 189, 154, 250, 34, 87, 14, 56, 4, 91, 68, 24, 47, 84, 148, 165, 75, 106, 143, 31, 27, 27, 101, 125, 188, 182, 149, 248, 125, 121, 136, 132, 155, 132, 99, 74, 69, 14, 81, 157, 252, 240, 8, 195, 74, 202, 75, 105, 2, 48, 199, 225, 29, 14, 196, 255, 178, 235, 239, 171, 244, 133, 167, 135, 246, 28, 74, 47, 155, 3, 8, 167, 66, 232, 113, 21, 156, 248, 6, 21, 92, 38, 55, 167, 207, 59, 110, 78, 66, 153, 136, 102, 60, 106, 227, 4, 68, 28, 62, 122, 99, 147, 49, 140, 203, 107, 199, 219, 54, 136, 174, 207, 92, 127, 253, 206, 43, 105, 236, 87, 205, 213, 199, 126, 153, 104, 223, 16, 190, 170, 134, 201, 225, 5, 235, 94, 10, 55, 218, 119, 232, 142, 54, 71, 233, 248, 95, 161, 250, 162, 68, 68, 36, 146, 8, 187, 179, 73, 50, 94, 254, 59, 140, 155, 110, 196, 67, 23, 144, 141, 175, 165, 109, 139, 153, 138, 252, 71, 82, 92, 41, 100, 115, 76, 232, 86, 129, 3, 209, 96, 49, 255, 48, 200, 89, 37, 41, 209, 116, 13, 229, 186, 252, 227, 188, 34, 195, 19, 211, 21, 224, 154, 182, 251, 145, 7, 49, 97, 183, 213, 140, 203, 104, 97, 139, 24, 135, 220, 232, 113, 15, 50, 82, 11, 62, 15, 222, 254, 93, 84, 62, 178, 90, 244, 50, 100, 190, 173, 38, 215, 6, 214, 12, 100, 188, 245, 122, 67, 130, 231, 229, 217, 34, 197, 172, 1, 82, 204, 28, 205, 10, 121, 154, 254, 128, 18, 127, 62, 206, 129, 56, 109, 12, 100, 112, 186, 26, 114, 8, 130, 84, 119, 51, 84, 157, 254, 90, 147, 32, 231, 74, 184, 43, 212, 46, 57, 164, 219, 173, 171, 114, 44, 188, 120, 181, 222, 54, 104, 72, 123, 211, 103, 133, 70, 226, 146, 90, 100, 69, 134, 126, 49, 43, 47, 54, 176, 236, 15, 185, 183, 7, 90, 192, 0, 49, 89, 97, 73, 164, 178, 46, 168, 41, 234, 112, 194, 23, 132, 161, 35, 112, 121, 198, 13, 182, 208, 62, 96, 221, 208, 92, 112, 233, 199, 107, 165, 184, 220, 109, 145, 79, 91, 201, 232, 146, 145, 122, 118, 51, 133, 35, 139, 202, 217, 172, 88, 249, 217, 5, 114, 219, 163, 35, 208, 156, 217, 221, 13, 25, 190, 23, 164, 43, 101, 65, 229, 173, 38, 19, 145, 103, 170, 23, 66, 82, 107, 185, 189, 250, 253, 85, 80, 226, 138, 85, 57, 52, 46, 60, 239, 141, 41, 152, 52, 46, 128, 34, 159, 234, 77, 137, 32, 230, 246, 132, 227, 52, 138, 179, 157, 132, 210, 0, 45, 47, 17, 97, 24, 18, 165, 69, 65, 62, 107, 83, 238, 46, 195, 253, 147, 68, 123, 97, 169, 111, 209, 100, 97, 83, 174, 210, 122, 98, 233, 231, 6, 3, 178, 118, 218, 33, 253, 11, 253, 6, 141, 255, 56, 66, 50, 202, 218, 173, 205, 77, 79, 178, 72, 58, 231, 47, 14, 183, 255, 107, 242, 207, 14, 56, 239, 210, 175, 170, 226, 35, 80, 8, 155, 62, 90, 220, 186, 237, 25, 181, 157, 193, 79, 68, 20, 252, 114, 193, 186, 232, 247, 66, 14, 165, 213, 243, 13, 185, 38, 2, 87, 147, 111, 197, 137, 119, 109, 130, 224, 81, 71, 176, 11, 48, 249, 78, 51, 150, 192, 200, 131, 209, 166, 2, 213, 226, 127, 1, 162, 123, 164, 122, 241, 73, 247, 20, 113, 113, 95, 231, 114, 15, 127, 23, 204, 75, 182, 140, 141, 88, 196, 237, 142, 180, 246, 109, 237, 6, 60, 206, 232, 105, 235, 52, 25, 99, 250, 172, 101, 105, 7, 229, 185, 156, 24, 230, 27, 220, 39, 114, 224, 165, 87, 167, 53, 212, 55, 76, 36, 190, 155, 137, 249, 162, 105, 160, 216, 115, 68, 80, 229, 26, 20, 39, 245, 156, 128, 163, 38, 41, 220, 22, 141, 39, 246, 22, 171, 248, 239, 189, 170, 21, 200, 234, 61, 105, 137, 197, 91, 244, 178, 154, 108, 165, 130, 70, 226, 209, 53, 51, 25, 13, 70, 170, 21, 132, 233, 14, 228, 185, 29, 95, 8, 74, 240, 251, 194, 234, 233, 189, 18, 55, 178, 69, 3, 142, 160, 194, 55, 226, 234, 107, 32, 38, 23, 132, 156, 194, 184, 2, 152, 72, 154, 142, 61, 50, 149, 100, 119, 181, 174, 0, 150, 20, 66, 24, 197, 33, 135, 174, 19, 173, 206, 89, 203, 46, 199, 199, 25, 96, 213, 175, 65, 11, 87, 110, 64, 136, 51, 68, 63, 174, 34, 41, 115, 4, 28, 215, 75, 105, 46, 42, 170, 219, 239, 205, 232, 34, 31, 18, 226, 165, 10, 28, 58, 45, 88, 133, 171, 249, 124, 207, 3, 219, 201, 197, 140, 204, 130, 238, 193, 209, 231, 165, 188, 215, 12, 208, 184, 183, 177, 231, 10, 176, 96, 157, 248, 39, 183, 193, 182, 189, 149, 108, 71, 55, 223, 96, 83, 227, 74, 197, 86, 209, 239, 175, 73, 196, 38, 147, 218, 3, 220, 27, 220, 52, 89, 138, 100, 177, 182, 104, 252, 102, 5, 37, 85, 239, 79, 11, 111, 64, 168, 31, 25, 250, 44, 107, 90, 202, 9, 36, 107, 58, 38, 209, 146, 69, 9, 50, 30, 160, 176, 182, 103, 73, 16, 158, 5, 43, 186, 16, 70, 29, 250, 134, 86, 192, 87, 60, 116, 45, 247, 91, 229, 106, 179, 31, 67, 146, 34, 35, 50, 29, 193, 35, 236, 64, 136, 138, 31, 1, 1, 240, 111, 16, 38, 74, 64, 92, 20, 136, 159, 22, 246, 238, 218, 91, 87, 36, 207, 66, 198, 1, 251, 22, 48, 159, 170, 43, 161, 5, 44, 129, 174, 5, 115, 58, 59, 219, 77, 246, 148, 164, 31, 231, 224, 17, 206, 27, 160, 121, 178, 183, 189, 158, 187, 186, 166, 235, 30, 37, 68, 130, 203, 161, 25, 199, 173, 104, 20, 165, 7, 139, 90, 27, 28, 251, 197, 32, 104, 96, 3, 161, 240, 47, 10, 186, 243, 221, 243, 175, 78, 17, 135, 54, 231, 31, 61, 9, 214, 49, 15, 96, 119, 63, 239, 170, 65, 116, 84, 240, 55, 122, 21, 184, 122, 23, 223, 125, 65, 220, 82, 187, 87, 115, 177, 97, 202, 242, 231, 247, 94, 117, 243, 93, 163, 209, 120, 151, 164, 165, 217, 236, 40, 83, 57, 82, 196, 101, 54, 119, 246, 28, 58, 164, 94, 14, 7, 76, 50, 96, 46, 185, 249, 183, 98, 255, 105, 245, 172, 111, 47, 156, 201, 165, 112, 100, 147, 79, 237, 57, 51, 96, 104, 132, 140, 118, 66, 116, 183, 157, 178, 96, 105, 210, 17, 52, 109, 232, 89, 216, 211, 178, 251, 242, 116, 148, 108, 28, 164, 131, 238, 179, 5, 79, 222, 56, 203, 170, 180, 106, 174, 7, 87, 211, 214, 231, 149, 193, 221, 142, 80, 99, 31, 253, 187, 181, 154, 160, 82, 126, 88, 209, 207, 158, 114, 240, 142, 0, 88, 16, 147, 160, 20, 7, 231, 35, 156, 4, 203, 83, 21, 79, 136, 42, 246, 94, 32, 127, 202, 115, 55, 88, 106, 65, 191, 32, 89, 154, 4, 221, 39, 142, 255, 17, 87, 96, 255, 131, 206, 127, 81, 73, 224, 200, 123, 19, 86, 230, 99, 245, 235, 165, 98, 245, 40, 132, 146, 189, 173, 21, 201, 172, 216, 19, 69, 207, 145, 228, 66, 199, 206, 42, 12, 158, 0, 4, 167, 158, 175, 126, 211, 167, 37, 115, 30, 158, 170, 196, 39, 183, 49, 206, 23, 42, 247, 159, 25, 20, 231, 250, 132, 45, 21, 252, 194, 246, 195, 187, 254, 194, 48, 20, 123, 158, 23, 68, 181, 154, 139, 176, 78, 179, 243, 241, 187, 26, 249, 53, 163, 190, 96, 51, 155, 133, 5, 132, 37, 25, 40, 77, 218, 93, 153, 52, 204, 137, 145, 48, 148, 104, 180, 67, 32, 132, 179, 119, 191, 136, 49, 77, 132, 38, 65, 67, 3, 232, 220, 200, 14, 15, 73, 178, 251, 34, 204, 154, 86, 102, 112, 255, 71, 50, 119, 236, 145, 125, 233, 130, 84, 13, 196, 234, 112, 255, 25, 38, 128, 45, 132, 26, 201, 176, 216, 88, 147, 99, 34, 31, 130, 131, 139, 32, 102, 40, 113, 24, 214, 222, 79, 120, 200, 242, 84, 16, 134, 66, 217, 17, 9, 52, 77, 231, 216, 18, 41, 26, 43, 226, 200, 220, 185, 134, 67, 188, 162, 189, 254, 78, 20, 78, 124, 5, 121, 198, 217, 204, 182, 99, 33, 39, 130, 204, 164, 97, 150, 199, 211, 143, 196, 107, 163, 102, 147, 197, 114, 51, 0, 59, 239, 155, 220, 221, 174, 176, 79, 5, 224, 227, 143, 63, 178, 233, 31, 99, 208, 117, 69, 29, 142, 36, 32, 130, 233, 20, 183, 234, 132, 41, 216, 0, 136, 78, 160, 116, 69, 234, 5, 153, 199, 127, 194, 115, 219, 39, 44, 98, 184, 241, 50, 87, 113, 113, 208, 125, 225, 118, 35, 232, 140, 250, 182, 168, 180, 236, 3, 7, 199, 87, 55, 250, 106, 5, 173, 197, 240, 115, 64, 46, 198, 84, 237, 250, 108, 91, 172, 176, 152, 244, 47, 113, 11, 186, 136, 19, 57, 106, 197, 171, 92, 153, 29, 126, 105, 145, 79, 210, 162, 162, 39, 108, 31, 230, 222, 53, 184, 56, 227, 68, 166, 215, 81, 1, 101, 72, 105, 238, 182, 204, 151, 133, 14, 110, 200, 179, 254, 184, 213, 83, 216, 143, 182, 117, 128, 0, 18, 249, 33, 107, 142, 131, 164, 66, 158, 76, 25, 2, 134, 119, 84, 123, 125, 222, 117, 151, 220, 107, 192, 97, 93, 69, 192, 50, 191, 238, 89, 58, 133, 70, 224, 8, 237, 243, 241, 229, 114, 175, 222, 194, 196, 194, 167, 229, 198, 179, 163, 192, 89, 170, 87, 64, 208, 197, 195, 68, 220, 176, 49, 129, 222, 77, 20, 12, 63, 150, 232, 180, 219, 98, 123, 211, 144, 74, 205, 119, 169, 135, 140, 51, 92, 108, 152, 78, 99, 41, 212, 142, 151, 26, 91, 135, 95, 59, 110, 19, 254, 190, 62, 227, 96, 182, 105, 0, 15, 186, 207, 246, 204, 191, 106, 49, 174, 64, 106, 63, 84, 235, 60, 238, 31, 87, 168, 210, 174, 68, 79, 118, 234, 172, 250, 130, 132, 159, 174, 225, 63, 176, 181, 80, 242, 80, 91, 134, 39, 87, 149, 142, 119, 201, 140, 89, 213, 11, 58, 128, 43, 142, 189, 158, 51, 2, 123, 130, 43, 96, 205, 150, 187, 46, 136, 190, 76, 184, 161, 211, 229, 160, 123, 210, 212, 155, 110, 190, 178, 53, 192, 133, 147, 1, 122, 190, 99, 214, 204, 238, 199, 199, 217, 174, 220, 10, 253, 127, 229, 69, 49, 128, 232, 11, 13, 115, 92, 146, 5, 211, 88, 1, 3, 69, 44, 20, 184, 250, 119, 232, 145, 74, 19, 232, 128, 41, 210, 87, 56, 178, 254, 93, 24, 140, 6, 224, 65, 231, 183, 66, 60, 230, 146, 4, 235, 36, 158, 148, 110, 31, 103, 141, 60, 41, 189, 184, 110, 177, 202, 221, 118, 4, 109, 99, 129, 137, 64, 179, 54, 34, 117, 166, 237, 139, 247, 30, 186, 91, 204, 43, 249, 188, 77, 92, 217, 25, 194, 79, 168, 96, 23, 208, 207, 165, 24, 168, 81, 173, 48, 247, 52, 123, 106, 85, 114, 44, 14, 59, 55, 42, 200, 235, 16, 20, 231, 233, 155, 31, 114, 29, 188, 53, 108, 36, 31, 34, 155, 220, 164, 96, 104, 60, 213, 101, 130, 204, 21, 33, 128, 67, 239, 104, 92, 27, 107, 246, 216, 140, 127, 167, 202, 176, 195, 189, 75, 96, 102, 162, 126, 74, 153, 154, 48, 200, 255, 234, 181, 98, 165, 54, 17, 223, 240, 0, 26, 242, 113, 23, 235, 135, 250, 53, 186, 37, 61, 76, 223, 68, 28, 193, 101, 28, 236, 168, 75, 82, 23, 184, 111, 61, 1, 92, 57, 16, 6, 95, 221, 66, 78, 221, 130, 154, 221, 124, 15, 35, 134, 242, 10, 123, 116, 179, 130, 73, 221, 178, 219, 169, 113, 129, 48, 164, 188, 122, 165, 173, 59, 29, 241, 215, 72, 156, 189, 183, 12, 182, 35, 50, 248, 227, 56, 27, 93, 165, 170, 219, 13, 94, 196, 1, 129, 22, 153, 134, 62, 73, 39, 219, 202, 154, 125, 132, 70, 164, 246, 205, 207, 50, 239, 102, 187, 46, 206, 206, 14, 8, 76, 184, 35, 86, 23, 176, 22, 34, 72, 250, 92, 145, 30, 127, 200, 8, 253, 135, 84, 189, 137, 21, 232, 67, 244, 168, 137, 243, 26, 104, 85, 142, 16, 152, 228, 246, 68, 3, 124, 87, 232, 244, 9, 32, 174, 206, 7, 250, 77, 35, 219, 175, 239, 245, 134, 73, 136, 122, 152, 248, 212, 248, 68, 172, 29, 224, 87, 160, 226, 132, 180, 239, 122, 182, 232, 205, 88, 201, 158, 240, 180, 98, 49, 88, 13, 172, 60, 234, 232, 137, 190, 174, 20, 249, 15, 76, 181, 208, 247, 36, 59, 122, 41, 18, 242, 27, 129, 159, 174, 230, 216, 220, 64, 230, 25, 98, 187, 202, 93, 196, 67, 89, 162, 242, 6, 7, 211, 227, 95, 25, 12, 232, 59, 253, 242, 117, 185, 121, 127, 213, 92, 134, 207, 72, 109, 130, 26, 231, 112, 132, 96, 113, 33, 160, 48, 219, 192, 127, 105, 70, 166, 76, 153, 220, 108, 186, 76, 112, 116, 139, 34, 191, 248, 170, 132, 21, 116, 192, 33, 72, 24, 171, 124, 232, 78, 98, 174, 59, 183, 200, 160, 160, 249, 238, 125, 218, 227, 189, 14, 205, 179, 251, 44, 111, 97, 110, 102, 149, 0, 56, 244, 213, 186, 178, 175, 236, 156, 9, 61, 239, 211, 64, 27, 18, 243, 98, 98, 14, 34, 169, 69, 160, 54, 188, 126, 188, 229, 253, 126, 185, 16, 181, 57, 86, 4, 7, 208, 170, 10, 235, 13, 235, 42, 227, 218, 169, 16, 31, 110, 90, 254, 139, 122, 83, 34, 229, 168, 128, 86, 239, 186, 100, 6, 65, 219, 72, 209, 142, 127, 141, 200, 200, 195, 169, 184, 108, 81, 227, 167, 57, 196, 111, 53, 134, 161, 177, 221, 146, 86, 66, 200, 81, 102, 149, 39, 127, 42, 54, 133, 113, 112, 105, 54, 188, 152, 242, 47, 156, 95, 227, 143, 43, 142, 224, 189, 72, 131, 137, 45, 118, 52, 246, 64, 112, 235, 164, 166, 70, 9, 63, 216, 84, 3, 222, 237, 82, 175, 241, 5, 44, 1, 148, 245, 171, 144, 217, 93, 157, 128, 176, 204, 206, 48, 155, 210, 31, 109, 38, 54, 90, 105, 226, 129, 123, 51, 143, 136, 163, 251, 237, 138, 16, 233, 214, 100, 167, 148, 147, 221, 48, 127, 182, 130, 8, 59, 3, 204, 13, 243, 145, 131, 200, 110, 77, 33, 31, 229, 97, 217, 177, 160, 190, 144, 229, 14, 164, 80, 254, 100, 19, 138, 218, 113, 40, 178, 37, 0, 8, 240, 205, 96, 51, 202, 125, 249, 179, 100, 94, 223, 216, 134, 243, 133, 240, 190, 9, 95, 212, 76, 124, 144, 118, 127, 154, 41, 22, 49, 73, 238, 123, 89, 146, 183, 174, 28, 80, 212, 60, 8, 88, 246, 109, 159, 179, 251, 186, 228, 157, 134, 232, 17, 205, 104, 16, 71, 190, 254, 190, 78, 197, 228, 241, 23, 61, 223, 221, 71, 104, 254, 80, 155, 184, 249, 95, 149, 173, 152, 143, 32, 3, 22, 179, 170, 33, 8, 173, 180, 115, 117, 232, 46, 142, 126, 252, 218, 43, 162, 70, 6, 185, 12, 130, 72, 96, 210, 247, 209, 174, 202, 9, 217, 33, 204, 106, 89, 37, 48, 149, 100, 141, 71, 151, 255, 137, 177, 76, 112, 122, 249, 137, 170, 27, 143, 234, 205, 167, 13, 255, 124, 50, 222, 8, 233, 56, 248, 46, 151, 82, 159, 42, 240, 76, 135, 232, 214, 154, 156, 234, 247, 245, 232, 61, 30, 62, 120, 178, 91, 222, 238, 57, 125, 184, 95, 111, 67, 29, 68, 132, 197, 158, 242, 76, 74, 178, 111, 82, 32, 116, 48, 184, 206, 107, 86, 172, 126, 241, 252, 141, 199, 228, 94, 171, 90, 162, 214, 104, 108, 85, 91, 7, 254, 16, 233, 83, 63, 16, 85, 118, 2, 245, 224, 18, 46, 112, 128, 178, 134, 14, 56, 84, 19, 120, 254, 17, 145, 41, 252, 192, 108, 228, 189, 127, 138, 129, 25, 32, 209, 121, 50, 126, 252, 59, 80, 154, 120, 177, 28, 226, 162, 133, 76, 55, 109, 177, 29, 67, 205, 218, 64, 158, 217, 121, 66, 204, 150, 25, 193, 85, 109, 195, 175, 213, 177, 171, 189, 255, 247, 110, 51, 49, 32, 10, 7, 49, 96, 52, 112, 70, 89, 211, 232, 55, 205, 90, 139, 34, 138, 159, 60, 67, 57, 62, 72, 53, 46, 140, 39, 127, 117, 61, 8, 56, 42, 127, 27, 195, 34, 48, 212, 200, 186, 230, 71, 250, 142, 242, 235, 251, 141, 184, 81, 223, 139, 64, 40, 78, 51, 190, 145, 51, 143, 128, 226, 95, 43, 86, 196, 113, 118, 78, 73, 45, 120, 72, 179, 195, 59, 70, 62, 109, 78, 201, 141, 115, 222, 224, 102, 75, 161, 189, 193, 43, 87, 79, 246, 120, 76, 8, 223, 19, 212, 4, 18, 172, 209, 10, 227, 72, 255, 33, 122, 216, 157, 220, 46, 235, 135, 237, 104, 83, 205, 240, 89, 14, 39, 65, 253, 2, 28, 182, 228, 235, 91, 95, 239, 106, 60, 46, 6, 221, 144, 194, 18, 225, 69, 225, 123, 130, 58, 8, 106, 84, 19, 219, 100, 153, 73, 242, 14, 61, 46, 216, 16, 69, 123, 234, 170, 163, 93, 70, 155, 16, 181, 235, 160, 172, 14, 214, 24, 115, 123, 254, 126, 18, 54, 201, 27, 159, 51, 32, 54, 245, 5, 119, 195, 156, 92, 52, 2, 114, 133, 11, 148, 251, 181, 117, 112, 231, 234, 143, 120, 34, 156, 31, 201, 36, 194, 18, 42, 92, 153, 234, 13, 40, 39, 128, 183, 202, 94, 122, 154, 102, 56, 140, 41, 98, 241, 59, 147, 251, 52, 241, 251, 107, 122, 24, 52, 31, 19, 160, 43, 226, 217, 114, 91, 57, 222, 5, 200, 112, 194, 61, 162, 173, 199, 52, 11, 155, 75, 157, 110, 118, 117, 39, 208, 186, 3, 205, 18, 179, 193, 189, 101, 148, 6, 194, 142, 22, 108, 115, 91, 4, 12, 189, 83, 15, 235, 106, 245, 240, 49, 237, 232, 237, 210, 66, 81, 55, 146, 225, 187, 166, 43, 117, 27, 85, 33, 106, 23, 167, 114, 39, 66, 56, 46, 90, 91, 2, 99, 15, 254, 61, 98, 254, 38, 91, 32, 192, 57, 25, 216, 73, 139, 20, 214, 9, 183, 235, 146, 131, 26, 188, 179, 141, 50, 231, 150, 153, 3, 9, 21, 207, 138, 113, 234, 203, 181, 178, 136, 173, 104, 9, 106, 41, 192, 118, 202, 38, 57, 175, 170, 74, 158, 10, 171, 136, 18, 184, 214, 187, 255, 7, 254, 132, 18, 185, 146, 201, 72, 178, 236, 234, 147, 34, 249, 177, 239, 238, 41, 96, 78, 3, 161, 161, 89, 19, 218, 244, 15, 150, 28, 166, 201, 145, 6, 117, 18, 172, 41, 152, 16, 138, 152, 52, 173, 3, 198, 37, 20, 150, 57, 3, 3, 216, 77, 97, 26, 60, 176, 218, 32, 135, 143, 146, 55, 50, 224, 124, 52, 243, 179, 225, 237, 5, 233, 214, 61, 150, 80, 180, 21, 12, 179, 7, 38, 39, 62, 225, 118, 194, 240, 225, 212, 253, 139, 10, 47, 62, 139, 145, 102, 127, 127, 228, 247, 154, 72, 191, 33, 223, 201, 153, 11, 201, 212, 126, 14, 203, 9, 40, 194, 86, 83, 174, 140, 123, 255, 27, 168, 251, 23, 6, 113, 143, 16, 47, 154, 22, 49, 215, 203, 136, 94, 35, 113, 80, 21, 248, 95, 88, 99, 254, 234, 22, 248, 55, 188, 131, 96, 35, 60, 84, 63, 224, 35, 181, 227, 125, 56, 102, 92, 119, 59, 64, 141, 31, 15, 74, 197, 232, 4, 106, 176, 215, 86, 154, 3, 91, 159, 236, 99, 73, 207, 234, 45, 134, 125, 244, 152, 7, 64, 238, 232, 75, 226, 254, 172, 219, 88, 145, 53, 186, 244, 121, 71, 21, 43, 86, 2, 209, 85, 22, 171, 32, 218, 136, 72, 14, 25, 178, 212, 222, 121, 224, 92, 35, 232, 208, 138, 182, 185, 129, 159, 7, 177, 78, 188, 12, 97, 208, 241, 153, 188, 125, 208
+};
@@ -0,0 +1,3 @@
+extern const int CIRRUS_TEX_RES = 64;
+extern const uint8_t __cirrus_tex[8192] = {
+28, 46, 43, 184, 86, 157, 128, 108, 18, 81, 220, 201, 190, 227, 137, 18, 14, 186, 238, 163, 194, 216, 84, 90, 120, 118, 12, 90, 166, 88, 69, 184, 93, 228, 212, 186, 181, 185, 228, 82, 204, 236, 127, 250, 142, 255, 181, 232, 236, 179, 233, 249, 113, 166, 85, 137, 245, 158, 155, 208, 159, 106, 250, 187, 38, 174, 4, 97, 54, 30, 25, 139, 116, 54, 69, 136, 125, 107, 30, 216, 16, 29, 185, 184, 88, 127, 12, 42, 58, 34, 12, 20, 10, 191, 130, 65, 80, 94, 0, 197, 22, 126, 77, 18, 2, 176, 57, 146, 172, 250, 15, 157, 229, 23, 135, 205, 78, 242, 115, 47, 161, 52, 12, 229, 65, 201, 249, 167, 73, 174, 132, 134, 214, 9, 71, 29, 129, 17, 67, 82, 87, 49, 232, 118, 16, 126, 119, 227, 37, 128, 41, 116, 184, 131, 216, 142, 2, 77, 18, 196, 209, 82, 56, 44, 123, 52, 51, 10, 93, 118, 53, 111, 12, 237, 232, 158, 194, 108, 107, 222, 217, 10, 26, 214, 92, 48, 245, 187, 9, 60, 187, 148, 190, 157, 9, 211, 51, 53, 156, 101, 8, 231, 30, 210, 248, 237, 106, 37, 2, 145, 12, 190, 156, 39, 112, 251, 98, 59, 191, 200, 237, 71, 176, 202, 62, 130, 62, 62, 41, 171, 200, 108, 53, 12, 240, 22, 254, 148, 183, 234, 72, 191, 137, 247, 244, 214, 251, 151, 202, 118, 80, 250, 132, 218, 43, 49, 36, 182, 90, 75, 213, 34, 44, 19, 65, 151, 199, 118, 168, 224, 88, 146, 57, 79, 216, 49, 168, 127, 131, 86, 80, 236, 120, 206, 183, 74, 238, 225, 15, 196, 92, 201, 27, 247, 140, 207, 129, 211, 241, 184, 169, 41, 115, 96, 206, 195, 5, 160, 237, 238, 90, 48, 8, 206, 110, 197, 110, 51, 199, 102, 140, 98, 250, 70, 4, 222, 246, 129, 88, 239, 104, 37, 179, 1, 248, 33, 248, 171, 235, 136, 235, 14, 40, 177, 88, 207, 130, 69, 27, 83, 255, 195, 237, 150, 79, 5, 144, 239, 0, 187, 17, 195, 226, 104, 157, 255, 68, 247, 154, 39, 132, 160, 155, 170, 159, 201, 47, 107, 200, 76, 45, 157, 20, 119, 234, 118, 142, 31, 57, 57, 194, 186, 109, 163, 182, 39, 171, 234, 185, 85, 254, 226, 149, 236, 68, 226, 110, 139, 167, 81, 50, 121, 240, 97, 191, 94, 182, 71, 69, 119, 137, 193, 204, 175, 143, 164, 204, 149, 37, 188, 157, 202, 247, 89, 132, 181, 225, 244, 44, 95, 161, 194, 65, 14, 53, 179, 85, 183, 39, 223, 4, 164, 121, 199, 145, 240, 77, 184, 161, 103, 255, 48, 72, 104, 169, 128, 72, 215, 184, 128, 45, 175, 96, 126, 122, 23, 172, 190, 31, 73, 90, 32, 220, 227, 139, 67, 164, 59, 173, 202, 116, 27, 200, 242, 250, 162, 46, 253, 205, 232, 86, 210, 197, 231, 23, 55, 231, 65, 60, 89, 39, 201, 156, 234, 4, 129, 54, 179, 112, 88, 12, 75, 218, 47, 172, 238, 25, 243, 123, 33, 246, 71, 15, 70, 30, 24, 102, 3, 172, 122, 71, 190, 251, 0, 67, 59, 126, 55, 238, 108, 27, 110, 194, 172, 201, 83, 53, 77, 107, 88, 193, 103, 152, 174, 220, 73, 218, 66, 203, 160, 153, 50, 51, 242, 139, 145, 250, 143, 117, 215, 70, 53, 15, 103, 108, 99, 200, 20, 70, 12, 134, 243, 24, 114, 73, 160, 19, 100, 55, 71, 95, 47, 237, 149, 106, 80, 166, 141, 34, 211, 212, 17, 233, 152, 62, 139, 8, 109, 214, 170, 133, 200, 102, 220, 65, 87, 229, 232, 177, 196, 242, 130, 97, 243, 227, 98, 240, 172, 158, 36, 87, 189, 241, 113, 65, 157, 106, 153, 50, 6, 14, 101, 160, 29, 163, 131, 175, 225, 36, 214, 240, 9, 144, 67, 108, 77, 83, 192, 33, 228, 142, 42, 253, 245, 121, 77, 153, 116, 103, 171, 200, 208, 120, 109, 31, 133, 127, 70, 200, 223, 61, 233, 200, 202, 243, 194, 145, 110, 123, 114, 28, 46, 1, 27, 198, 220, 205, 118, 139, 51, 186, 184, 252, 35, 235, 113, 143, 12, 15, 245, 21, 66, 72, 105, 164, 123, 24, 74, 151, 52, 44, 69, 223, 71, 17, 158, 137, 242, 24, 181, 174, 49, 184, 54, 178, 186, 141, 244, 144, 76, 13, 22, 174, 222, 4, 178, 25, 39, 222, 219, 214, 122, 93, 83, 23, 8, 180, 92, 150, 10, 20, 126, 112, 206, 32, 184, 56, 34, 124, 119, 97, 52, 3, 207, 40, 143, 113, 26, 206, 218, 64, 79, 218, 66, 235, 190, 27, 93, 225, 223, 228, 83, 253, 65, 179, 74, 11, 128, 95, 77, 211, 128, 226, 240, 237, 96, 216, 222, 137, 112, 180, 16, 202, 14, 218, 154, 12, 244, 133, 138, 126, 238, 233, 186, 236, 126, 81, 235, 147, 185, 214, 56, 125, 198, 59, 221, 236, 232, 46, 199, 231, 185, 178, 84, 75, 119, 89, 209, 230, 255, 88, 208, 135, 160, 207, 153, 135, 160, 5, 205, 20, 105, 232, 51, 58, 5, 185, 165, 162, 207, 91, 166, 41, 245, 205, 120, 227, 48, 9, 176, 15, 155, 252, 71, 26, 4, 168, 207, 244, 2, 246, 104, 114, 167, 84, 170, 155, 200, 248, 238, 143, 43, 109, 187, 123, 185, 190, 92, 123, 115, 107, 239, 121, 203, 136, 104, 82, 0, 207, 242, 185, 92, 101, 93, 248, 3, 68, 107, 111, 0, 42, 233, 100, 94, 139, 202, 11, 5, 184, 59, 156, 18, 186, 241, 194, 62, 38, 236, 90, 73, 232, 32, 136, 75, 247, 38, 149, 146, 13, 106, 39, 213, 64, 95, 157, 237, 101, 20, 172, 235, 31, 78, 116, 179, 157, 55, 97, 79, 113, 14, 165, 60, 139, 53, 190, 36, 69, 179, 67, 216, 100, 158, 10, 8, 174, 76, 37, 24, 70, 252, 213, 183, 246, 151, 152, 32, 77, 58, 3, 46, 73, 180, 79, 153, 66, 45, 117, 117, 171, 46, 95, 223, 107, 210, 19, 171, 219, 254, 176, 94, 60, 21, 64, 193, 74, 215, 114, 137, 63, 44, 90, 101, 37, 160, 66, 121, 121, 233, 207, 233, 54, 160, 118, 24, 176, 54, 201, 9, 59, 132, 180, 123, 172, 216, 116, 22, 71, 85, 66, 87, 200, 77, 53, 153, 218, 237, 3, 56, 216, 0, 49, 16, 97, 222, 0, 98, 194, 160, 79, 89, 137, 136, 131, 119, 158, 158, 213, 255, 247, 197, 150, 201, 88, 215, 150, 235, 217, 164, 36, 4, 130, 211, 235, 45, 240, 142, 80, 111, 189, 54, 113, 108, 221, 64, 97, 199, 83, 36, 157, 233, 72, 47, 191, 95, 112, 21, 223, 16, 200, 154, 119, 82, 204, 113, 102, 117, 130, 142, 134, 81, 13, 204, 26, 28, 251, 99, 165, 149, 23, 239, 171, 94, 228, 24, 106, 188, 131, 227, 135, 128, 24, 164, 5, 213, 115, 93, 196, 246, 68, 216, 151, 37, 88, 27, 214, 33, 78, 10, 15, 187, 109, 243, 220, 168, 52, 3, 39, 105, 11, 15, 79, 14, 151, 130, 61, 9, 10, 179, 140, 54, 198, 95, 210, 4, 121, 111, 83, 223, 16, 141, 52, 122, 124, 24, 110, 121, 90, 0, 87, 63, 102, 123, 144, 169, 42, 105, 67, 127, 54, 184, 251, 95, 107, 109, 198, 145, 1, 43, 117, 156, 190, 149, 159, 21, 158, 45, 243, 71, 181, 146, 216, 217, 50, 95, 119, 67, 33, 236, 41, 73, 245, 15, 77, 192, 97, 245, 191, 69, 221, 102, 53, 173, 174, 157, 223, 70, 126, 132, 241, 166, 0, 23, 3, 58, 106, 150, 28, 226, 114, 105, 124, 39, 16, 13, 57, 198, 57, 212, 217, 12, 13, 88, 63, 102, 115, 41, 142, 137, 58, 93, 154, 100, 44, 90, 15, 3, 53, 235, 239, 9, 1, 116, 169, 36, 123, 142, 59, 86, 99, 43, 216, 141, 253, 59, 139, 74, 165, 192, 112, 114, 101, 251, 226, 57, 248, 201, 163, 30, 235, 21, 219, 235, 122, 208, 28, 206, 137, 60, 230, 147, 155, 215, 122, 84, 124, 60, 14, 141, 65, 199, 221, 16, 69, 22, 30, 105, 19, 130, 93, 80, 254, 178, 43, 221, 83, 52, 213, 147, 125, 2, 106, 136, 29, 115, 110, 246, 251, 231, 8, 19, 158, 208, 110, 217, 50, 232, 236, 87, 88, 153, 74, 63, 95, 14, 171, 27, 139, 203, 165, 66, 34, 127, 72, 174, 164, 27, 108, 25, 97, 185, 31, 6, 248, 203, 76, 24, 213, 34, 164, 83, 125, 53, 134, 129, 175, 254, 141, 238, 108, 169, 1, 0, 51, 208, 218, 215, 234, 143, 213, 2, 130, 14, 8, 83, 178, 110, 110, 47, 181, 150, 173, 25, 56, 175, 153, 92, 74, 131, 134, 250, 135, 150, 166, 238, 221, 198, 42, 202, 40, 76, 54, 164, 201, 247, 41, 211, 205, 231, 136, 247, 10, 254, 184, 215, 103, 42, 4, 88, 134, 13, 149, 17, 217, 159, 203, 126, 220, 137, 192, 200, 138, 0, 135, 93, 147, 3, 101, 11, 101, 94, 166, 142, 97, 172, 199, 64, 11, 25, 52, 127, 210, 60, 194, 158, 70, 140, 102, 207, 16, 215, 211, 174, 36, 107, 231, 73, 236, 205, 245, 138, 115, 218, 235, 121, 255, 139, 106, 242, 192, 14, 135, 128, 152, 161, 111, 213, 25, 42, 48, 94, 87, 175, 146, 115, 100, 38, 52, 130, 231, 172, 74, 96, 117, 60, 154, 248, 245, 232, 173, 144, 76, 233, 227, 14, 216, 204, 93, 118, 164, 212, 145, 227, 68, 141, 187, 214, 16, 81, 189, 111, 221, 173, 111, 138, 71, 158, 120, 38, 7, 248, 3, 102, 5, 34, 175, 86, 202, 92, 153, 212, 165, 79, 4, 238, 10, 194, 85, 93, 126, 60, 232, 108, 175, 114, 40, 156, 26, 49, 137, 222, 49, 48, 102, 194, 99, 215, 125, 246, 111, 37, 70, 41, 187, 99, 110, 182, 243, 183, 143, 92, 228, 141, 45, 13, 75, 168, 124, 120, 113, 124, 209, 222, 147, 70, 158, 1, 223, 235, 71, 158, 169, 53, 76, 207, 190, 18, 208, 252, 197, 46, 44, 255, 238, 242, 23, 88, 127, 179, 201, 165, 164, 128, 234, 212, 215, 67, 75, 97, 108, 108, 53, 23, 24, 214, 38, 205, 236, 88, 160, 193, 66, 2, 12, 206, 211, 76, 95, 153, 72, 52, 57, 95, 107, 109, 100, 59, 175, 20, 122, 172, 21, 76, 170, 19, 145, 124, 67, 121, 122, 224, 25, 207, 155, 249, 16, 93, 122, 41, 179, 15, 245, 9, 221, 60, 116, 196, 170, 240, 52, 124, 237, 36, 115, 79, 13, 245, 224, 161, 224, 244, 229, 158, 67, 151, 251, 157, 34, 48, 11, 216, 61, 163, 24, 156, 11, 105, 77, 182, 177, 72, 47, 136, 62, 32, 76, 124, 3, 147, 81, 16, 196, 179, 44, 158, 253, 234, 85, 30, 123, 205, 129, 173, 95, 233, 175, 41, 146, 156, 106, 37, 37, 175, 244, 6, 66, 185, 185, 148, 243, 4, 74, 180, 81, 138, 129, 135, 75, 12, 213, 64, 205, 197, 62, 179, 208, 162, 130, 162, 253, 18, 156, 202, 144, 35, 36, 244, 71, 93, 61, 209, 134, 193, 11, 225, 16, 70, 102, 5, 65, 230, 250, 8, 125, 124, 32, 152, 76, 105, 238, 111, 147, 247, 39, 77, 250, 26, 127, 128, 139, 8, 25, 175, 133, 194, 225, 7, 177, 177, 112, 129, 7, 28, 176, 207, 8, 122, 229, 61, 232, 8, 231, 170, 80, 226, 162, 151, 166, 138, 78, 206, 156, 26, 139, 162, 214, 146, 86, 40, 70, 155, 207, 187, 253, 33, 134, 238, 147, 61, 137, 153, 53, 53, 210, 23, 13, 213, 105, 164, 103, 233, 146, 238, 168, 190, 207, 170, 4, 242, 123, 245, 100, 228, 105, 56, 200, 76, 203, 192, 82, 201, 165, 6, 198, 212, 157, 30, 154, 54, 124, 135, 150, 6, 23, 168, 13, 190, 150, 199, 218, 113, 76, 18, 253, 229, 91, 98, 221, 240, 31, 48, 36, 222, 154, 219, 165, 138, 99, 223, 43, 63, 99, 7, 230, 44, 208, 94, 37, 178, 212, 244, 199, 141, 5, 103, 7, 242, 26, 69, 203, 242, 216, 184, 87, 103, 146, 200, 210, 31, 213, 213, 100, 201, 184, 65, 249, 98, 175, 42, 190, 23, 58, 65, 81, 237, 136, 224, 48, 58, 163, 0, 248, 157, 135, 104, 99, 151, 229, 94, 96, 199, 130, 28, 169, 13, 189, 156, 212, 159, 236, 179, 138, 109, 195, 85, 150, 227, 188, 60, 237, 207, 70, 191, 253, 14, 102, 145, 18, 0, 35, 65, 47, 1, 10, 103, 95, 5, 180, 182, 42, 42, 242, 115, 208, 141, 120, 211, 28, 82, 177, 120, 155, 221, 206, 222, 97, 94, 203, 253, 143, 88, 203, 199, 113, 105, 53, 211, 248, 58, 17, 48, 126, 250, 94, 127, 75, 186, 30, 177, 3, 149, 126, 101, 147, 91, 13, 129, 243, 247, 89, 219, 81, 46, 17, 111, 198, 225, 41, 172, 71, 34, 157, 206, 139, 76, 56, 198, 91, 180, 77, 170, 200, 40, 81, 61, 143, 224, 126, 120, 201, 140, 92, 104, 194, 164, 38, 153, 250, 135, 4, 219, 146, 144, 139, 14, 131, 138, 241, 25, 203, 96, 46, 211, 161, 63, 133, 189, 62, 167, 150, 125, 70, 46, 46, 216, 78, 80, 77, 208, 242, 191, 37, 220, 170, 34, 36, 234, 83, 211, 122, 172, 218, 254, 125, 177, 249, 6, 140, 107, 24, 163, 152, 125, 185, 25, 224, 145, 41, 187, 216, 91, 78, 52, 109, 120, 112, 227, 154, 176, 98, 26, 89, 167, 189, 170, 209, 182, 251, 94, 98, 155, 219, 176, 96, 137, 109, 231, 238, 112, 249, 171, 147, 172, 185, 1, 229, 218, 162, 12, 135, 105, 205, 4, 111, 18, 252, 93, 188, 239, 196, 245, 8, 108, 127, 171, 58, 109, 82, 116, 127, 158, 50, 67, 19, 79, 3, 234, 26, 121, 180, 185, 30, 130, 103, 246, 120, 94, 172, 200, 114, 72, 83, 156, 115, 236, 135, 137, 118, 208, 191, 110, 221, 39, 38, 63, 82, 181, 200, 209, 225, 85, 2, 233, 78, 253, 218, 43, 213, 91, 151, 116, 55, 45, 123, 253, 139, 125, 235, 188, 164, 211, 222, 111, 95, 54, 233, 7, 174, 148, 206, 46, 253, 233, 74, 76, 157, 98, 229, 102, 208, 166, 98, 127, 97, 132, 221, 244, 253, 116, 66, 25, 115, 129, 21, 197, 243, 185, 165, 116, 175, 233, 161, 174, 89, 231, 202, 111, 45, 231, 155, 167, 95, 241, 51, 3, 60, 188, 165, 209, 170, 128, 86, 49, 91, 170, 126, 153, 144, 194, 167, 236, 115, 53, 176, 162, 58, 44, 110, 171, 142, 41, 234, 131, 150, 40, 59, 94, 10, 60, 224, 126, 235, 54, 180, 241, 139, 35, 143, 76, 166, 209, 196, 98, 240, 146, 215, 49, 210, 206, 35, 13, 249, 144, 104, 17, 10, 153, 87, 171, 67, 246, 181, 110, 128, 4, 179, 169, 217, 201, 217, 156, 222, 9, 125, 37, 145, 0, 149, 242, 194, 253, 240, 59, 176, 177, 114, 182, 59, 70, 206, 181, 240, 22, 147, 42, 81, 147, 94, 64, 25, 86, 47, 106, 3, 129, 179, 22, 159, 37, 50, 132, 214, 175, 109, 216, 58, 81, 56, 21, 249, 75, 240, 148, 200, 249, 53, 115, 192, 178, 20, 176, 146, 238, 0, 15, 248, 50, 91, 251, 226, 222, 7, 127, 29, 41, 252, 11, 141, 241, 139, 124, 221, 48, 126, 124, 57, 99, 32, 19, 144, 62, 139, 8, 7, 128, 37, 116, 198, 130, 111, 71, 251, 218, 20, 211, 45, 123, 136, 63, 146, 151, 75, 91, 82, 16, 62, 79, 234, 255, 66, 4, 98, 107, 212, 111, 78, 115, 160, 166, 187, 152, 43, 195, 48, 67, 129, 50, 166, 202, 255, 230, 155, 37, 183, 182, 45, 248, 58, 184, 252, 200, 203, 47, 197, 107, 38, 131, 6, 98, 249, 119, 65, 163, 186, 184, 3, 174, 82, 67, 46, 175, 102, 5, 212, 34, 140, 211, 209, 149, 180, 174, 159, 242, 213, 213, 233, 38, 62, 173, 37, 31, 16, 228, 87, 66, 184, 98, 43, 40, 9, 51, 106, 75, 249, 18, 64, 210, 224, 63, 199, 109, 230, 253, 35, 186, 30, 121, 224, 214, 40, 9, 117, 227, 36, 184, 227, 139, 158, 152, 38, 70, 18, 90, 32, 221, 98, 14, 131, 230, 132, 14, 85, 89, 60, 223, 60, 9, 7, 224, 146, 52, 171, 59, 138, 234, 190, 95, 134, 79, 144, 7, 112, 158, 220, 13, 247, 52, 39, 123, 28, 223, 215, 228, 138, 126, 39, 58, 145, 242, 148, 196, 224, 254, 101, 41, 45, 88, 201, 187, 3, 109, 214, 226, 242, 8, 111, 40, 78, 162, 182, 234, 95, 194, 249, 240, 187, 186, 164, 86, 242, 2, 149, 7, 130, 105, 26, 11, 153, 205, 50, 113, 119, 144, 25, 44, 193, 67, 77, 53, 159, 136, 21, 118, 236, 12, 255, 239, 81, 64, 13, 195, 90, 157, 171, 70, 246, 189, 132, 130, 51, 82, 163, 177, 194, 46, 188, 140, 2, 121, 45, 116, 5, 96, 55, 140, 202, 136, 44, 96, 48, 79, 79, 124, 114, 159, 0, 208, 173, 67, 158, 133, 252, 194, 211, 232, 204, 60, 238, 180, 216, 35, 245, 30, 94, 116, 132, 31, 76, 129, 27, 33, 231, 154, 219, 234, 134, 47, 159, 66, 221, 196, 242, 123, 81, 8, 121, 210, 216, 136, 153, 0, 147, 250, 122, 74, 70, 99, 155, 131, 169, 183, 175, 34, 236, 172, 200, 141, 238, 36, 43, 78, 125, 38, 243, 70, 90, 178, 110, 169, 25, 172, 58, 111, 71, 243, 205, 24, 195, 236, 152, 183, 118, 157, 220, 0, 16, 202, 59, 26, 62, 13, 80, 179, 211, 69, 92, 103, 87, 6, 79, 189, 226, 189, 67, 181, 146, 68, 185, 9, 48, 69, 36, 122, 134, 166, 201, 230, 29, 47, 234, 183, 243, 39, 244, 252, 143, 222, 91, 81, 64, 88, 131, 47, 137, 165, 171, 108, 226, 133, 134, 239, 109, 201, 138, 18, 83, 49, 243, 40, 202, 162, 248, 47, 108, 157, 252, 41, 23, 130, 99, 61, 22, 14, 18, 240, 196, 239, 42, 157, 208, 172, 22, 197, 133, 227, 113, 57, 50, 25, 247, 112, 130, 204, 184, 239, 144, 130, 195, 37, 239, 197, 99, 228, 189, 6, 222, 114, 39, 35, 224, 187, 23, 59, 105, 56, 15, 251, 10, 240, 89, 214, 56, 141, 141, 100, 232, 129, 189, 115, 220, 167, 186, 48, 97, 9, 249, 112, 119, 138, 206, 3, 215, 225, 25, 211, 123, 243, 168, 31, 98, 60, 16, 25, 245, 104, 52, 161, 180, 83, 222, 154, 117, 31, 100, 237, 6, 237, 23, 231, 211, 185, 230, 135, 47, 146, 33, 109, 180, 120, 166, 58, 10, 99, 208, 115, 51, 251, 150, 8, 183, 168, 93, 19, 81, 178, 82, 45, 8, 92, 240, 169, 146, 38, 147, 58, 153, 38, 12, 201, 108, 235, 90, 72, 124, 226, 58, 190, 42, 55, 100, 144, 235, 159, 40, 255, 244, 219, 78, 145, 25, 12, 86, 15, 97, 202, 239, 182, 66, 193, 144, 63, 71, 160, 171, 19, 23, 81, 154, 159, 127, 106, 218, 30, 156, 193, 37, 71, 125, 140, 143, 216, 74, 11, 187, 57, 8, 129, 103, 206, 253, 106, 141, 121, 207, 162, 31, 227, 250, 224, 162, 240, 206, 151, 60, 196, 8, 44, 18, 20, 43, 186, 187, 5, 241, 13, 37, 154, 255, 51, 201, 248, 10, 21, 34, 189, 15, 124, 87, 184, 40, 86, 59, 165, 175, 35, 199, 76, 158, 70, 184, 31, 188, 225, 30, 22, 75, 165, 71, 75, 30, 171, 208, 135, 99, 244, 125, 146, 32, 241, 228, 133, 204, 70, 230, 92, 249, 141, 186, 111, 173, 178, 255, 218, 89, 113, 24, 150, 106, 56, 210, 234, 228, 13, 87, 44, 47, 5, 245, 157, 89, 183, 106, 154, 149, 136, 145, 164, 56, 0, 229, 160, 250, 197, 60, 148, 252, 98, 61, 1, 222, 118, 146, 244, 32, 209, 21, 57, 45, 172, 187, 82, 176, 130, 178, 155, 96, 66, 0, 112, 21, 56, 212, 252, 187, 138, 114, 229, 56, 40, 21, 149, 95, 232, 29, 205, 249, 62, 189, 164, 1, 214, 227, 216, 109, 194, 34, 206, 64, 164, 120, 217, 93, 253, 75, 244, 221, 245, 205, 225, 225, 153, 255, 7, 148, 64, 77, 80, 77, 174, 156, 242, 119, 7, 58, 157, 142, 246, 7, 204, 17, 146, 205, 125, 140, 70, 207, 149, 210, 48, 205, 53, 181, 63, 58, 212, 130, 46, 35, 219, 61, 171, 202, 164, 253, 251, 7, 3, 40, 255, 123, 247, 220, 102, 214, 60, 193, 171, 179, 172, 254, 127, 140, 31, 75, 252, 246, 185, 124, 35, 131, 1, 51, 229, 101, 238, 88, 121, 208, 14, 30, 132, 173, 150, 13, 180, 221, 52, 196, 96, 143, 4, 178, 109, 55, 76, 44, 66, 119, 166, 205, 104, 79, 1, 133, 128, 179, 204, 206, 244, 83, 66, 58, 144, 183, 99, 116, 141, 117, 255, 188, 62, 57, 182, 108, 149, 139, 63, 108, 76, 130, 48, 97, 234, 11, 73, 34, 170, 44, 245, 191, 38, 70, 190, 67, 106, 249, 97, 229, 222, 144, 160, 72, 221, 30, 121, 42, 30, 140, 159, 26, 150, 24, 240, 253, 250, 138, 148, 143, 132, 223, 197, 232, 102, 177, 23, 70, 25, 246, 220, 64, 135, 90, 113, 203, 171, 73, 40, 49, 116, 252, 82, 164, 112, 59, 133, 117, 100, 30, 242, 216, 209, 205, 253, 64, 32, 50, 136, 53, 56, 212, 195, 75, 202, 21, 181, 239, 131, 160, 41, 101, 123, 47, 16, 126, 69, 199, 176, 95, 33, 124, 214, 65, 116, 15, 21, 86, 157, 206, 245, 4, 89, 144, 204, 156, 152, 141, 67, 209, 146, 69, 80, 189, 103, 182, 204, 212, 8, 250, 125, 30, 119, 168, 16, 121, 201, 213, 245, 106, 152, 10, 224, 220, 41, 133, 59, 213, 112, 169, 26, 83, 149, 196, 75, 204, 196, 27, 207, 39, 53, 94, 171, 210, 202, 0, 135, 148, 188, 88, 141, 189, 145, 77, 132, 0, 168, 188, 204, 90, 136, 199, 178, 51, 145, 151, 222, 131, 103, 61, 132, 170, 110, 7, 142, 28, 22, 9, 86, 253, 177, 93, 64, 79, 102, 40, 207, 198, 1, 251, 16, 82, 224, 98, 207, 2, 124, 18, 193, 15, 137, 174, 177, 195, 215, 71, 237, 66, 31, 96, 203, 65, 99, 0, 62, 134, 219, 9, 228, 74, 88, 37, 173, 130, 24, 179, 125, 53, 144, 20, 101, 62, 28, 154, 163, 222, 43, 74, 110, 234, 2, 216, 132, 129, 165, 117, 216, 90, 237, 116, 118, 37, 112, 252, 186, 155, 227, 212, 121, 16, 13, 99, 69, 117, 159, 51, 253, 214, 145, 175, 165, 67, 82, 242, 173, 185, 93, 33, 214, 147, 131, 213, 247, 113, 148, 206, 12, 55, 254, 33, 129, 16, 85, 153, 58, 96, 106, 96, 253, 253, 150, 183, 120, 99, 40, 113, 155, 45, 120, 47, 139, 142, 69, 210, 252, 35, 48, 247, 189, 254, 109, 94, 231, 180, 238, 203, 154, 227, 230, 93, 234, 238, 131, 241, 238, 219, 254, 4, 230, 30, 10, 151, 31, 170, 241, 64, 103, 126, 164, 65, 138, 68, 233, 28, 190, 45, 127, 50, 243, 210, 224, 176, 176, 33, 103, 151, 72, 59, 180, 239, 153, 223, 100, 189, 238, 113, 250, 48, 247, 39, 178, 178, 103, 129, 191, 28, 38, 131, 66, 145, 130, 125, 124, 201, 55, 229, 93, 253, 244, 23, 25, 6, 129, 99, 102, 15, 156, 123, 181, 10, 119, 246, 103, 24, 149, 16, 23, 166, 223, 180, 74, 168, 200, 177, 34, 58, 164, 132, 153, 86, 90, 218, 195, 161, 37, 151, 69, 197, 57, 205, 11, 253, 86, 210, 254, 19, 250, 150, 138, 241, 255, 15, 10, 14, 213, 76, 201, 50, 105, 13, 50, 19, 217, 9, 155, 141, 165, 78, 221, 38, 74, 180, 31, 168, 111, 61, 105, 58, 52, 236, 157, 153, 143, 122, 40, 160, 87, 121, 249, 198, 131, 229, 67, 91, 131, 146, 163, 182, 134, 156, 219, 185, 191, 167, 158, 85, 36, 105, 179, 34, 48, 232, 34, 20, 205, 188, 229, 240, 125, 239, 18, 166, 58, 87, 149, 155, 128, 15, 135, 99, 73, 40, 228, 148, 138, 204, 179, 129, 32, 174, 52, 216, 75, 139, 170, 134, 34, 72, 246, 177, 1, 202, 22, 255, 252, 219, 217, 47, 209, 156, 192, 85, 176, 148, 127, 69, 223, 242, 130, 141, 56, 120, 141, 5, 133, 223, 249, 115, 248, 72, 160, 224, 48, 200, 4, 139, 29, 60, 138, 17, 249, 62, 205, 211, 27, 43, 239, 255, 231, 28, 204, 147, 252, 111, 191, 246, 228, 118, 159, 33, 187, 19, 32, 68, 150, 104, 26, 215, 36, 32, 147, 80, 169, 37, 240, 243, 11, 53, 56, 99, 124, 165, 22, 81, 118, 20, 145, 2, 62, 186, 213, 71, 1, 201, 82, 141, 30, 100, 203, 224, 80, 87, 156, 197, 128, 215, 186, 14, 16, 79, 21, 142, 189, 71, 66, 79, 24, 173, 64, 70, 242, 246, 247, 110, 196, 68, 100, 15, 182, 90, 145, 55, 104, 159, 242, 233, 193, 101, 147, 152, 15, 72, 150, 163, 60, 27, 10, 0, 150, 9, 200, 167, 29, 39, 102, 119, 11, 220, 60, 183, 64, 9, 224, 125, 148, 196, 249, 19, 70, 213, 240, 158, 195, 192, 190, 45, 252, 25, 168, 23, 106, 82, 170, 52, 183, 244, 148, 79, 24, 37, 32, 131, 108, 143, 1, 236, 116, 54, 98, 177, 12, 135, 55, 16, 90, 205, 67, 71, 48, 120, 191, 57, 111, 237, 121, 232, 158, 193, 195, 153, 204, 218, 187, 121, 59, 216, 113, 125, 194, 160, 73, 51, 199, 162, 0, 75, 188, 248, 74, 21, 42, 165, 98, 140, 242, 115, 171, 7, 184, 177, 234, 151, 205, 120, 12, 37, 78, 123, 119, 35, 102, 191, 233, 181, 18, 68, 42, 54, 203, 111, 200, 17, 12, 209, 198, 56, 110, 243, 173, 49, 1, 50, 224, 4, 137, 244, 108, 175, 87, 193, 94, 47, 52, 36, 11, 61, 215, 200, 233, 183, 35, 90, 247, 25, 141, 218, 77, 153, 223, 157, 17, 25, 27, 160, 22, 160, 220, 199, 184, 155, 100, 49, 50, 90, 34, 63, 136, 119, 214, 156, 1, 84, 194, 67, 4, 187, 55, 3, 66, 79, 159, 180, 97, 192, 49, 7, 26, 225, 182, 75, 155, 173, 145, 102, 145, 84, 156, 38, 109, 160, 219, 69, 106, 165, 22, 43, 1, 125, 204, 150, 85, 138, 103, 136, 26, 31, 202, 40, 46, 121, 176, 194, 28, 179, 191, 164, 169, 18, 145, 91, 27, 132, 181, 28, 174, 27, 253, 76, 111, 203, 143, 123, 73, 151, 38, 102, 158, 236, 115, 185, 171, 84, 47, 11, 70, 16, 227, 215, 31, 10, 176, 176, 36, 42, 2, 216, 23, 252, 6, 225, 112, 159, 16, 54, 143, 74, 139, 95, 86, 250, 66, 105, 118, 88, 197, 97, 221, 33, 99, 194, 244, 155, 74, 30, 21, 17, 22, 110, 12, 219, 203, 220, 242, 40, 50, 169, 16, 224, 128, 251, 99, 156, 170, 200, 235, 102, 95, 166, 160, 252, 51, 48, 24, 160, 49, 208, 31, 21, 85, 199, 250, 31, 90, 14, 117, 148, 96, 93, 230, 210, 197, 249, 236, 147, 16, 238, 22, 90, 144, 229, 77, 27, 94, 254, 138, 183, 45, 251, 221, 234, 229, 209, 135, 63, 232, 44, 230, 199, 160, 200, 167, 155, 72, 190, 126, 187, 131, 239, 212, 141, 126, 35, 110, 131, 215, 186, 159, 8, 249, 53, 152, 68, 12, 172, 100, 64, 193, 61, 92, 214, 0, 159, 165, 87, 176, 238, 215, 35, 189, 151, 133, 173, 233, 89, 130, 86, 234, 82, 221, 122, 53, 54, 225, 255, 93, 107, 130, 155, 67, 80, 102, 132, 135, 95, 106, 209, 121, 221, 70, 184, 166, 178, 26, 221, 5, 113, 104, 207, 155, 1, 157, 226, 96, 9, 170, 190, 150, 93, 163, 80, 231, 24, 107, 183, 251, 80, 135, 110, 52, 146, 106, 197, 33, 199, 59, 87, 197, 233, 201, 155, 107, 202, 32, 101, 95, 217, 146, 141, 24, 234, 166, 172, 62, 111, 110, 111, 223, 23, 41, 51, 158, 231, 148, 38, 56, 169, 232, 42, 110, 1, 57, 155, 215, 255, 206, 145, 239, 254, 101, 197, 4, 93, 230, 118, 16, 57, 221, 172, 68, 40, 201, 246, 209, 219, 172, 12, 0, 195, 105, 203, 82, 118, 235, 23, 30, 228, 92, 187, 6, 245, 215, 239, 84, 255, 73, 192, 120, 66, 114, 101, 152, 199, 216, 236, 62, 239, 88, 213, 8, 214, 43, 37, 148, 222, 81, 134, 28, 161, 103, 249, 134, 148, 43, 6, 92, 112, 70, 117, 131, 49, 191, 116, 59, 149, 6, 149, 249, 252, 39, 156, 122, 247, 45, 145, 230, 3, 93, 4, 190, 141, 213, 199, 154, 11, 202, 133, 239, 199, 36, 92, 146, 13, 81, 187, 213, 244, 2, 30, 156, 154, 24, 75, 237, 236, 53, 148, 40, 183, 76, 18, 78, 9, 136, 102, 255, 52, 22, 181, 26, 160, 52, 108, 191, 158, 67, 36, 13, 220, 84, 6, 191, 170, 16, 204, 100, 102, 252, 185, 30, 34, 243, 26, 237, 99, 37, 100, 63, 6, 45, 155, 90, 222, 212, 118, 124, 250, 167, 106, 240, 48, 159, 158, 131, 80, 104, 149, 99, 22, 190, 218, 130, 98, 3, 44, 166, 126, 58, 222, 230, 8, 103, 199, 181, 255, 80, 128, 141, 158, 229, 33, 134, 202, 121, 218, 143, 108, 68, 237, 98, 201, 60, 20, 141, 183, 236, 12, 96, 105, 210, 59, 189, 207, 164, 26, 94, 212, 110, 135, 233, 157, 63, 119, 3, 11, 48, 173, 118, 49, 201, 19, 122, 137, 252, 178, 24, 122, 118, 231, 86, 230, 190, 15, 47, 49, 23, 201, 102, 178, 46, 253, 134, 61, 25, 116, 130, 230, 239, 210, 218, 92, 169, 229, 10, 45, 169, 225, 252, 176, 1, 217, 64, 28, 79, 146, 13, 0, 67, 35, 91, 116, 36, 234, 27, 153, 153, 149, 27, 62, 45, 86, 38, 0, 166, 64, 239, 129, 96, 242, 143, 234, 37, 107, 142, 4, 97, 56, 96, 163, 141, 25, 176, 6, 67, 253, 235, 154, 218, 98, 50, 205, 183, 247, 152, 64, 35, 134, 243, 239, 11, 149, 250, 16, 244, 177, 110, 243, 141, 248, 247, 45, 37, 254, 14, 101, 60, 39, 217, 135, 172, 151, 183, 14, 178, 60, 182, 121, 218, 26, 32, 174, 6, 122, 7, 211, 130, 102, 52, 90, 83, 109, 145, 64, 41, 188, 157, 38, 130, 185, 159, 49, 23, 128, 70, 45, 201, 90, 46, 205, 225, 232, 55, 4, 62, 156, 85, 105, 173, 231, 240, 198, 73, 150, 68, 84, 96, 127, 92, 134, 205, 14, 22, 55, 48, 44, 123, 230, 217, 40, 160, 166, 210, 104, 105, 22, 161, 120, 143, 236, 24, 1, 49, 223, 102, 106, 71, 232, 170, 195, 221, 46, 201, 224, 152, 158, 122, 35, 195, 0, 98, 182, 205, 179, 228, 92, 71, 29, 194, 237, 84, 20, 139, 227, 95, 47, 129, 91, 206, 144, 240, 213, 255, 171, 199, 194, 126, 147, 27, 52, 128, 243, 128, 78, 74, 232, 32, 140, 41, 194, 158, 195, 192, 205, 77, 36, 217, 35, 23, 218, 213, 179, 252, 237, 19, 23, 236, 129, 133, 113, 139, 227, 137, 145, 252, 235, 61, 136, 87, 177, 133, 159, 78, 45, 119, 81, 5, 79, 231, 180, 202, 84, 164, 115, 230, 252, 216, 227, 27, 92, 197, 209, 87, 207, 248, 188, 103, 147, 19, 110, 83, 45, 114, 82, 252, 174, 255, 205, 205, 31, 11, 168, 18, 79, 176, 247, 160, 205, 23, 246, 177, 188, 54, 47, 214, 216, 175, 165, 47, 51, 71, 187, 146, 126, 61, 191, 144, 106, 225, 119, 117, 120, 243, 182, 255, 255, 18, 100, 49, 196, 101, 123, 248, 36, 81, 0, 77, 236, 80, 76, 8, 93, 107, 159, 246, 129, 242, 250, 226, 3, 38, 121, 218, 217, 102, 180, 220, 248, 124, 131, 15, 112, 57, 170, 228, 80, 120, 124, 145, 203, 248, 175, 195, 227, 222, 11, 135, 155, 227, 7, 43, 119, 165, 252, 169, 50, 172, 110, 14, 147, 99, 168, 22, 254, 115, 114, 111, 65, 209, 80, 127, 193, 208, 73, 71, 152, 161, 12, 224, 212, 254, 26, 134, 215, 43, 50, 127, 156, 186, 9, 22, 167, 122, 98, 35, 217, 153, 7, 139, 124, 185, 99, 127, 219, 195, 54, 137, 194, 106, 195, 51, 238, 232, 77, 82, 169, 51, 0, 171, 43, 153, 178, 3, 130, 247, 154, 248, 59, 167, 9, 239, 192, 185, 58, 24, 193, 143, 194, 82, 158, 71, 248, 65, 110, 5, 93, 69, 70, 37, 40, 84, 117, 71, 105, 197, 90, 93, 180, 3, 156, 84, 148, 239, 22, 197, 80, 172, 126, 5, 73, 4, 65, 149, 28, 102, 234, 60, 187, 138, 42, 86, 33, 155, 46, 178, 136, 192, 24, 226, 65, 94, 13, 19, 6, 109, 188, 24, 43, 164, 113, 136, 32, 166, 188, 55, 188, 71, 37, 102, 95, 245, 81, 70, 189, 199, 7, 75, 165, 9, 78, 182, 222, 196, 7, 164, 169, 79, 240, 128, 58, 13, 129, 151, 70, 212, 100, 37, 165, 237, 150, 70, 103, 143, 177, 73, 143, 214, 44, 103, 198, 255, 200, 71, 3, 153, 216, 20, 220, 123, 164, 211, 30, 46, 163, 235, 11, 191, 202, 18, 73, 65, 59, 67, 63, 35, 24, 188, 72, 243, 0, 77, 238, 166, 57, 221, 97, 35, 129, 131, 178, 238, 10, 253, 27, 234, 15, 191, 105, 173, 31, 244, 68, 44, 218, 85, 187, 26, 15, 164, 76, 137, 198, 227, 184, 179, 130, 33, 248, 237, 141, 247, 119, 253, 105, 104, 63, 123, 49, 220, 86, 172, 124, 117, 71, 240, 78, 163, 239, 136, 235, 189, 25, 1, 175, 211, 201, 142, 111, 221, 245, 45, 77, 232, 164, 12, 228, 226, 89, 220, 189, 151, 98, 159, 38, 85, 102, 217, 23, 149, 240, 244, 141, 19, 241, 39, 183, 205, 50, 8, 208, 29, 15, 190, 24, 8, 81, 33, 207, 64, 187, 231, 181, 136, 139, 54, 59, 10, 148, 65, 38, 219, 125, 186, 39, 198, 197, 149, 47, 111, 186, 214, 189, 204, 39, 61, 252, 2, 76, 88, 31, 32, 55, 107, 110, 49, 252, 179, 112, 81, 109, 181, 220, 22, 59, 139, 87, 209, 112, 131, 22, 12, 242, 53, 20, 16, 139, 232, 178, 143, 59, 243, 56, 99, 163, 221, 47, 53, 40, 20, 255, 51, 52, 180, 82, 119, 243, 33, 163, 224, 193, 123, 17, 122, 227, 235, 95, 216, 102, 22, 252, 234, 53, 198, 60, 124, 141, 113, 234, 141, 159, 139, 252, 124, 152, 217, 233, 123, 145, 221, 197, 225, 209, 130, 23, 129, 213, 104, 129, 116, 217, 251, 9, 134, 211, 17, 202, 36, 233, 189, 87, 236, 147, 199, 57, 26, 193, 27, 43, 78, 127, 130, 126, 82, 245, 226, 77, 195, 36, 105, 122, 1, 142, 221, 152, 94, 190, 192, 241, 27, 148, 103, 97, 63, 152, 148, 148, 145, 58, 67, 194, 122, 93, 24, 130, 248, 111, 49, 159, 52, 139, 25, 72, 251, 123, 11, 186, 183, 168, 237, 221, 137, 221, 1, 58, 32, 104, 51, 221, 142, 249, 243, 101, 239, 17, 166, 183, 142, 106, 1, 142, 221, 154, 251, 89, 141, 41, 108, 24, 69, 188, 243, 84, 251, 67, 103, 133, 96, 236, 66, 189, 37, 192, 19, 162, 247, 225, 26, 198, 135, 31, 185, 127, 237, 251, 96, 81, 220, 105, 154, 5, 138, 155, 74, 151, 233, 15, 55, 127, 11, 111, 95, 29, 219, 114, 175, 239, 113, 141, 20, 13, 255, 187, 4, 218, 156, 4, 172, 240, 15, 1, 62, 189, 51, 70, 252, 227, 187, 226, 178, 30, 204, 2, 16, 222, 231, 66, 42, 11, 192, 103, 69, 71, 106, 64, 151, 29, 52, 238, 115, 195, 131, 67, 108, 241, 175, 216, 110, 88, 12, 216, 173, 205, 224, 200, 223, 251, 169, 212, 115, 79, 231, 200, 253, 207, 68, 227, 9, 215, 218, 163, 76, 200, 248, 49, 169, 118, 67, 130, 15, 200, 100, 50, 164, 75, 22, 109, 115, 228, 116, 103, 141, 152, 17, 3, 125, 104, 254, 194, 214, 238, 121, 18, 79, 29, 172, 86, 136, 64, 186, 238, 161, 172, 227, 180, 91, 182, 156, 187, 206, 60, 6, 106, 26, 17, 83, 204, 108, 217, 141, 183, 249, 207, 96, 194, 195, 152, 15, 179, 77, 122, 221, 73, 90, 79, 249, 151, 5, 179, 101, 246, 27, 198, 231, 70, 156, 113, 157, 157, 21, 103, 31, 102, 57, 23, 42, 2, 183, 125, 129, 209, 156, 33, 230, 104, 65, 33, 111, 59, 80, 137, 79, 193, 237, 169, 204, 170, 224, 77, 22, 165, 100, 14, 64, 179, 26, 24, 159, 30, 21, 250, 222, 85, 58, 20, 250, 152, 21, 188, 7, 82, 69, 5, 235, 147, 178, 93, 39, 4, 17, 112, 55, 180, 192, 187, 194, 189, 35, 43, 205, 81, 65, 76, 149, 78, 28, 68, 129, 188, 213, 165, 177, 217, 199, 214, 193, 176, 61, 112, 42, 6, 114, 65, 33, 88, 10, 31, 169, 129, 105, 45, 52, 224, 50, 97, 179, 186, 110, 18, 167, 125, 170, 178, 3, 174, 4, 63, 15, 98, 23, 119, 208, 61, 104, 89, 22, 188, 52, 254, 79, 149, 18, 117, 6, 145, 104, 94, 169, 217, 142, 197, 90, 77, 62, 31, 12, 36, 139, 178, 154, 73, 214, 104, 195, 112, 118, 128, 155, 215, 188, 123, 161, 135, 60, 138, 162, 157, 253, 82, 136, 137, 231, 183, 164, 77, 181, 216, 90, 34, 85, 33, 124, 164, 46, 80, 145, 61, 208, 70, 140, 151, 21, 38, 129, 148, 202, 207, 55, 55, 234, 87, 0, 25, 68, 164, 124, 31, 249, 35, 36, 43, 245, 197, 107, 4, 175, 174, 196, 117, 172, 112, 31, 33, 31, 60, 159, 61, 108, 167, 106, 26, 197, 169, 34, 222, 143, 59, 54, 173, 68, 152, 173, 137, 77, 228, 251, 172, 199, 245, 186, 231, 166, 218, 236, 172, 190, 151, 250, 190, 82, 166, 171, 208, 71, 5, 132, 166, 51, 144, 200, 146, 51, 48, 49, 112, 210, 112, 25, 14, 226, 120, 31, 72, 242, 252, 67, 164, 143, 208, 244, 187, 126, 212, 172, 19, 38, 248, 55, 155, 65, 76, 159, 172, 223, 137, 64, 231, 134, 205, 53, 26, 107, 119, 106, 30, 180, 42, 162, 186, 197, 214, 40, 21, 131, 144, 7, 106, 207, 155, 109, 182, 59, 217, 157, 39, 127, 225, 178, 234, 91, 11, 177, 247, 170, 238, 245, 210, 227, 61, 23, 199, 222, 103, 219, 63, 247, 218, 189, 119, 94, 184, 81, 90, 65, 232, 93, 171, 70, 205, 114, 103, 173, 237, 132, 131, 6, 222, 253, 103, 170, 233, 220, 7, 40, 157, 138, 50, 150, 182, 240, 184, 54, 227, 17, 167, 210, 168, 185, 251, 238, 3, 224, 7, 172, 198, 59, 15, 208, 225, 12, 189, 206, 170, 108, 92, 59, 136, 245, 22, 203, 28, 250, 95, 35, 166, 27, 52, 133, 31, 170, 61, 79, 111, 219, 37, 171, 47, 249, 144, 73, 202, 18, 50, 168, 165, 237, 87, 29, 125, 54, 72, 207, 126, 21, 15, 187, 147, 175, 174, 195, 119, 42, 204, 139, 133, 255, 222, 61, 174, 159, 82, 231, 147, 105, 168, 61, 106, 236, 120, 135, 71, 31, 172, 28, 128, 67, 102, 218, 191, 64, 12, 243, 156, 89, 177, 54, 161, 120, 168, 206, 126, 203, 28, 30, 149, 138, 97, 249, 229, 217, 5, 4, 221, 78, 138, 89, 183, 218, 192, 12, 239, 89, 151, 10, 126, 184, 198, 178, 136, 144, 172, 37, 213, 227, 218, 242, 52, 140, 168, 55, 234, 174, 222, 37, 95, 184, 106, 72, 207, 201, 241, 45, 124, 162, 45, 1, 27, 233, 56, 110, 32, 241, 246, 191, 221, 176, 63, 32, 234, 136, 186, 237, 128, 121, 225, 178, 213, 125, 150, 49, 2, 92, 71, 235, 128, 38, 95, 134, 241, 53, 239, 81, 244, 72, 200, 46, 216, 124, 240, 223, 74, 93, 219, 6, 255, 18, 162, 8, 3, 238, 101, 255, 219, 133, 122, 16, 115, 208, 247, 107, 68, 60, 149, 161, 73, 21, 130, 89, 36, 232, 152, 240, 222, 66, 169, 95, 83, 204, 131, 50, 93, 176, 179, 50, 146, 242, 174, 173, 39, 159, 8, 74, 56, 123, 139, 54, 130, 50, 73, 254, 101, 59, 45, 61, 103, 58, 171, 203, 174, 40, 201, 134, 96, 57, 56, 126, 30, 14, 105, 62, 183, 234, 250, 20, 25, 147, 152, 27, 218, 42, 94, 107, 187, 15, 70, 77, 99, 87, 69, 50, 81, 113, 153, 74, 172, 152, 90, 95, 189, 189, 6, 175, 180, 136, 128, 116, 190, 82, 70, 33, 158, 222, 4, 192, 1, 184, 32, 26, 209, 250, 105, 9, 208, 51, 237, 224, 178, 158, 66, 240, 234, 117, 214, 90, 125, 246, 172, 47, 161, 71, 227, 195, 183, 224, 31, 3, 117, 190, 47, 240, 242, 122, 44, 77, 66, 231, 100, 222, 88, 139, 84, 110, 196, 8, 171, 192, 16, 61, 144, 147, 145, 217, 148, 24, 1, 0, 45, 208, 68, 39, 109, 239, 24, 196, 9, 15, 195, 62, 89, 221, 186, 194, 154, 96, 65, 255, 119, 20, 240, 68, 121, 93, 105, 242, 255, 244, 66, 32, 46, 204, 133, 192, 118, 3, 209, 109, 219, 227, 157, 94, 151, 202, 33, 221, 40, 196, 93, 184, 186, 202, 142, 191, 238, 56, 80, 209, 128, 168, 11, 98, 35, 153, 235, 179, 59, 228, 191, 213, 213, 96, 86, 135, 179, 88, 138, 70, 31, 39, 104, 53, 21, 254, 221, 118, 160, 61, 207, 133, 85, 114, 1, 91, 207, 254, 54, 47, 26, 113, 182, 63, 63, 172, 210, 23, 159, 207, 232, 88, 202, 157, 99, 131, 31, 55, 1, 124, 142, 45, 223, 228, 61, 186, 124, 178, 135, 34, 192, 8, 84, 61, 129, 210, 100, 239, 10, 194, 65, 62, 34, 11, 154, 18, 41, 159, 47, 225, 51, 177, 199, 8, 235, 73, 107, 242, 60, 164, 29, 151, 105, 4, 130, 235, 78, 242, 43, 162, 39, 113, 59, 184, 117, 54, 167, 60, 7, 61, 79, 175, 68, 38, 25, 99, 249, 100, 68, 127, 255, 219, 167, 89, 125, 15, 91, 231, 156, 206, 249, 173, 103, 209, 36, 156, 223, 179, 233, 128, 102, 221, 98, 28, 70, 8, 141, 149, 198, 245, 94, 83, 87, 52, 130, 24, 79, 154, 239, 161, 39, 144, 161, 196, 24, 23, 204, 220, 159, 118, 162, 229, 27, 17, 235, 154, 131, 18, 218, 206, 201, 104, 126, 136, 212, 244, 160, 186, 30, 122, 117, 253, 143, 29, 129, 251, 187, 247, 25, 58, 74, 97, 135, 110, 191, 239, 128, 217, 65, 36, 200, 104, 42, 220, 17, 119, 207, 175, 134, 122, 29, 113, 7, 161, 173, 93, 181, 244, 209, 89, 93, 158, 86, 252, 69, 191, 227, 70, 223, 246, 16, 208, 17, 23, 173, 122, 97, 25, 200, 138, 178, 180, 80, 118, 76, 42, 147, 77, 15, 144, 54, 131, 130, 4, 5, 26, 75, 92, 161, 96, 75, 43, 173, 143, 244, 134, 236, 220, 44, 9, 107, 136, 160, 250, 171, 248, 222, 83, 240, 127, 112, 140, 126, 96, 194, 107, 196, 227, 136, 164, 196, 9, 97, 29, 41, 60, 153, 180, 212, 240, 152, 4, 190, 179, 252, 23, 58, 26, 206, 142, 210, 238, 22, 10, 143, 214, 178, 209, 26, 73, 46, 63, 250, 129, 146, 175, 196, 135, 10, 10, 249, 253, 12, 60, 181, 130, 234, 124, 241, 90, 168, 246, 181, 150, 135, 130, 202, 165, 142, 107, 79, 119, 235, 241, 89, 242, 220, 207, 17, 86, 109, 195, 43, 24, 129, 39, 234, 180, 118, 32, 169, 169, 153, 205, 155, 89, 124, 49, 248, 27, 76, 180, 199, 72, 160, 150, 215, 74, 10, 4, 62, 79, 242, 37, 2, 212, 31, 160, 234, 123, 30, 221, 226, 4, 219, 238, 78, 106, 152, 189, 112, 33, 104, 241, 202, 206, 253, 138, 187, 93, 252, 51, 131, 235, 241, 241, 11, 167, 18, 80, 177, 229, 32, 79, 154, 106, 15, 19, 104, 132, 46, 109, 103, 43, 43, 128, 122, 29, 1, 34, 237, 78, 253, 22, 51, 67, 60, 149, 165, 116, 152, 203, 94, 184, 37, 151, 220, 132, 62, 53, 70, 104, 223, 15, 9, 217, 46, 53, 139, 251, 218, 76, 136, 107, 81, 99, 170, 175, 230, 204, 196, 199, 177, 233, 134, 139, 38, 101, 130, 29, 188, 114, 230, 236, 15, 210, 84, 226, 177, 2, 16, 87, 182, 27, 30, 160, 163, 167, 27, 241, 134, 138, 75, 119, 117, 185, 6, 254, 218, 200, 229, 153, 19, 228, 172, 58, 6, 218, 21, 151, 175, 134, 93, 29, 92, 40, 173, 255, 237, 116, 13, 88, 241, 202, 32, 125, 33, 150, 144, 141, 88, 224, 101, 94, 97, 85, 104, 144, 140, 239, 213, 83, 38, 98, 86, 70, 60, 120, 179, 52, 190, 244, 104, 97, 83, 223, 35, 220, 143, 106, 94, 62, 125, 108, 88, 76, 27, 96, 210, 3, 206, 91, 45, 215, 150, 7, 89, 13, 152, 133, 37, 141, 86, 164, 147, 210, 233, 45, 30, 16, 231, 97, 226, 215, 95, 218, 56, 22, 133, 206, 2, 158, 96, 210, 35, 58, 205, 225, 167, 170, 135, 165, 97, 112, 36, 102, 105, 112, 166, 71, 102, 96, 146, 43, 84, 173, 58, 22, 149, 130, 62, 186, 129, 51, 108, 60, 183, 113, 7, 60, 6, 168, 14, 129, 109, 116, 242, 93, 109, 12, 164, 207, 213, 167, 84, 216, 29, 184, 136, 128, 124, 146, 56, 87, 126, 84, 251, 139, 60, 110, 238, 111, 149, 156, 100, 240, 167, 9, 35, 21, 191, 234, 41, 18, 65, 100, 177, 14, 140, 192, 130, 231, 118, 104, 179, 44, 40, 51, 77, 41, 150, 126, 170, 68, 47, 61, 6, 227, 70, 84, 145, 249, 218, 109, 120, 120, 123, 182, 180, 167, 10, 18, 118, 46, 2, 231, 196, 6, 133, 218, 236, 43, 34, 223, 40, 63, 4, 162, 242, 183, 115, 33, 244, 125, 52, 132, 63, 244, 79, 70, 224, 61, 22, 19, 5, 157, 64, 230, 245, 24, 149, 5, 82, 176, 16, 38, 152, 157, 146, 19, 24, 28, 164, 146, 119, 244, 210, 129, 233, 132, 36, 19, 195, 63, 249, 39, 161, 207, 74, 210, 207, 215, 198, 254, 126, 229, 69, 77, 162, 242, 219, 49, 38, 230, 225, 111, 66, 150, 101, 216, 125, 232, 31, 225, 182, 157, 0, 20, 196, 241, 162, 179, 114, 3, 123, 194, 86, 148, 16, 248, 26, 160, 151, 234, 42, 151, 10, 10, 76, 160, 72, 139, 100, 115, 138, 181, 171, 169, 0, 154, 216, 39, 230, 193, 48, 211, 238, 102, 24, 33, 167, 148, 142, 66, 3, 84, 159, 109, 41, 202, 85, 89, 219, 203, 104, 193, 22, 129, 91, 17, 217, 47, 248, 28, 184, 189, 111, 196, 182, 121, 118, 3, 9, 244, 17, 15, 148, 251, 5, 5, 223, 167, 49, 44, 11, 157, 74, 208, 13, 169, 170, 128, 170, 173, 73, 151, 88, 178, 201, 255, 244, 72, 169, 170, 170, 24, 53, 204, 107, 215, 20, 238, 14, 148, 179, 100, 253, 24, 173, 74, 133, 106, 74, 196, 105, 67, 141, 156, 16, 227, 197, 186, 119, 240, 219, 242, 132, 36, 218, 96, 164, 209, 36, 208, 169, 174, 213, 23, 77, 98, 55, 151, 187, 16, 151, 86, 29, 91, 167, 205, 218, 106, 139, 212, 144, 87, 134, 206, 77, 237, 171, 13, 10, 91, 195, 151, 80, 47, 236, 52, 240, 210, 116, 152, 131, 172, 237, 210, 3, 216, 206, 49};
@@ -71,6 +71,7 @@ Ray::CpuFeatures Ray::GetCpuFeatures() {
             }
 
             bool cpu_FMA_support = (info[2] & ((int)1 << 12)) != 0;
+            bool cpu_F16C_support = (info[2] & ((int)1 << 29)) != 0;
 
             bool cpu_AVX_support = (info[2] & (1 << 28)) != 0;
             g_cpu_features.avx_supported = os_saves_YMM && cpu_AVX_support;
@@ -79,8 +80,9 @@ Ray::CpuFeatures Ray::GetCpuFeatures() {
                 cpuid(info, 0x00000007);
 
                 bool cpu_AVX2_support = (info[1] & (1 << 5)) != 0;
-                // use fma in conjunction with avx2 support (like microsoft compiler does)
-                g_cpu_features.avx2_supported = os_saves_YMM && cpu_AVX2_support && cpu_FMA_support;
+                // use fma and f16c in conjunction with avx2 support (like microsoft compiler does)
+                g_cpu_features.avx2_supported =
+                    os_saves_YMM && cpu_AVX2_support && cpu_FMA_support && cpu_F16C_support;
 
                 g_cpu_features.avx512_supported = (info[1] & (1 << 16)) != 0; // HW_AVX512F
                 // g_cpu_features.avx512_supported &= (info[1] & (1 << 28)) != 0;   // HW_AVX512CD
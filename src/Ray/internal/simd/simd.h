@@ -720,6 +720,46 @@ inline fixed_size_simd<T, S> select(const fixed_size_simd<U, S> &mask, const fix
     return ret;
 }
 
+// Loads S bfloat16 values (upper halves of fp32 bit patterns) and widens them to fp32
+template <int S> force_inline fixed_size_simd<float, S> load_bf16(const uint16_t *p) {
+    fixed_size_simd<float, S> ret;
+    UNROLLED_FOR_S(i, S, {
+        const uint32_t bits = uint32_t(p[i]) << 16;
+        float f;
+        memcpy(&f, &bits, sizeof(float));
+        ret.template set<i>(f);
+    });
+    return ret;
+}
+
+// Loads S IEEE half-precision values and widens them to fp32
+template <int S> force_inline fixed_size_simd<float, S> load_f16(const uint16_t *p) {
+    fixed_size_simd<float, S> ret;
+    UNROLLED_FOR_S(i, S, {
+        const uint32_t exp_mant = p[i] & 0x7fff;
+        // shift exponent/mantissa into place and rebias exponent with multiplication (handles denormals)
+        uint32_t bits = exp_mant << 13;
+        float f;
+        memcpy(&f, &bits, sizeof(float));
+        f *= 5.192296858534828e+33f; // 2^112
+        memcpy(&bits, &f, sizeof(float));
+        if (exp_mant > 0x7bff) {
+            bits |= 255 << 23; // Inf/NaN
+        }
+        bits |= uint32_t(p[i] & 0x8000) << 16;
+        memcpy(&f, &bits, sizeof(float));
+        ret.template set<i>(f);
+    });
+    return ret;
+}
+
+// Loads S signed 8-bit integers and converts them to fp32
+template <int S> force_inline fixed_size_simd<float, S> load_i8(const int8_t *p) {
+    fixed_size_simd<float, S> ret;
+    UNROLLED_FOR_S(i, S, { ret.template set<i>(float(p[i])); });
+    return ret;
+}
+
 template <int S> force_inline fixed_size_simd<int, S> simd_cast(const fixed_size_simd<float, S> &vec) {
     fixed_size_simd<int, S> ret;
     memcpy(&ret, &vec, sizeof(fixed_size_simd<int, S>));
@@ -45,6 +45,10 @@ template <> class fixed_size_simd<float, 8> {
     friend class fixed_size_simd<int, 8>;
     friend class fixed_size_simd<unsigned, 8>;
 
+    friend fixed_size_simd<float, 8> load_bf16<8>(const uint16_t *p);
+    friend fixed_size_simd<float, 8> load_f16<8>(const uint16_t *p);
+    friend fixed_size_simd<float, 8> load_i8<8>(const int8_t *p);
+
     force_inline fixed_size_simd(const __m256 vec) : vec_(vec) {}
 
   public:
@@ -1114,6 +1118,48 @@ force_inline fixed_size_simd<float, 8> fixed_size_simd<float, 8>::operator-() co
     return _mm256_xor_ps(vec_, m);
 }
 
+template <> force_inline fixed_size_simd<float, 8> load_bf16<8>(const uint16_t *p) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)p);
+#if defined(USE_AVX2) || defined(USE_AVX512)
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(v), 16));
+#else
+    const __m128i lo = _mm_unpacklo_epi16(_mm_setzero_si128(), v), hi = _mm_unpackhi_epi16(_mm_setzero_si128(), v);
+    return _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+#endif
+}
+
+template <> force_inline fixed_size_simd<float, 8> load_f16<8>(const uint16_t *p) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)p);
+#if defined(USE_AVX2) || defined(USE_AVX512)
+    // F16C is required alongside AVX2 (see cpu detection)
+    return _mm256_cvtph_ps(v);
+#else
+    const __m128i h[2] = {_mm_unpacklo_epi16(v, _mm_setzero_si128()), _mm_unpackhi_epi16(v, _mm_setzero_si128())};
+    __m128 ret[2];
+    for (int i = 0; i < 2; ++i) {
+        const __m128i exp_mant = _mm_and_si128(h[i], _mm_set1_epi32(0x7fff));
+        // rebias exponent with multiplication (handles denormals), then patch Inf/NaN and sign
+        const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exp_mant, 13)),
+                                         _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+        const __m128i inf_nan =
+            _mm_and_si128(_mm_cmpgt_epi32(exp_mant, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(255 << 23));
+        const __m128i sign = _mm_slli_epi32(_mm_xor_si128(h[i], exp_mant), 16);
+        ret[i] = _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(inf_nan, sign)));
+    }
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(ret[0]), ret[1], 1);
+#endif
+}
+
+template <> force_inline fixed_size_simd<float, 8> load_i8<8>(const int8_t *p) {
+    const __m128i v = _mm_loadl_epi64((const __m128i *)p);
+#if defined(USE_AVX2) || defined(USE_AVX512)
+    return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(v));
+#else
+    const __m128i lo = _mm_cvtepi8_epi32(v), hi = _mm_cvtepi8_epi32(_mm_srli_si128(v, 4));
+    return _mm256_cvtepi32_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+#endif
+}
+
 force_inline fixed_size_simd<float, 8>::operator fixed_size_simd<int, 8>() const { return _mm256_cvttps_epi32(vec_); }
 
 force_inline fixed_size_simd<float, 8>::operator fixed_size_simd<unsigned, 8>() const {
@@ -43,6 +43,10 @@ template <> class fixed_size_simd<float, 16> {
     friend class fixed_size_simd<int, 16>;
     friend class fixed_size_simd<unsigned, 16>;
 
+    friend fixed_size_simd<float, 16> load_bf16<16>(const uint16_t *p);
+    friend fixed_size_simd<float, 16> load_f16<16>(const uint16_t *p);
+    friend fixed_size_simd<float, 16> load_i8<16>(const int8_t *p);
+
     force_inline fixed_size_simd(const __m512 vec) : vec_(vec) {}
 
   public:
@@ -807,6 +811,19 @@ force_inline fixed_size_simd<float, 16> fixed_size_simd<float, 16>::operator-()
     return _mm512_xor_ps(vec_, m);
 }
 
+template <> force_inline fixed_size_simd<float, 16> load_bf16<16>(const uint16_t *p) {
+    const __m256i v = _mm256_loadu_si256((const __m256i *)p);
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(v), 16));
+}
+
+template <> force_inline fixed_size_simd<float, 16> load_f16<16>(const uint16_t *p) {
+    return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)p));
+}
+
+template <> force_inline fixed_size_simd<float, 16> load_i8<16>(const int8_t *p) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *)p)));
+}
+
 force_inline fixed_size_simd<float, 16>::operator fixed_size_simd<int, 16>() const { return _mm512_cvttps_epi32(vec_); }
 
 force_inline fixed_size_simd<float, 16>::operator fixed_size_simd<unsigned, 16>() const {
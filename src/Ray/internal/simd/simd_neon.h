@@ -51,6 +51,10 @@ template <> class fixed_size_simd<float, 4> {
     friend class fixed_size_simd<int, 4>;
     friend class fixed_size_simd<unsigned, 4>;
 
+    friend fixed_size_simd<float, 4> load_bf16<4>(const uint16_t *p);
+    friend fixed_size_simd<float, 4> load_f16<4>(const uint16_t *p);
+    friend fixed_size_simd<float, 4> load_i8<4>(const int8_t *p);
+
     force_inline fixed_size_simd(const float32x4_t vec) : vec_(vec) {}
 
   public:
@@ -1049,6 +1053,28 @@ template <> class fixed_size_simd<unsigned, 4> {
     static bool is_native() { return true; }
 };
 
+template <> force_inline fixed_size_simd<float, 4> load_bf16<4>(const uint16_t *p) {
+    return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(p), 16));
+}
+
+template <> force_inline fixed_size_simd<float, 4> load_f16<4>(const uint16_t *p) {
+    const uint32x4_t h = vmovl_u16(vld1_u16(p));
+    const uint32x4_t exp_mant = vandq_u32(h, vdupq_n_u32(0x7fff));
+    // rebias exponent with multiplication (handles denormals), then patch Inf/NaN and sign
+    const float32x4_t scaled = vmulq_f32(vreinterpretq_f32_u32(vshlq_n_u32(exp_mant, 13)),
+                                         vreinterpretq_f32_u32(vdupq_n_u32((254 - 15) << 23)));
+    const uint32x4_t inf_nan = vandq_u32(vcgtq_u32(exp_mant, vdupq_n_u32(0x7bff)), vdupq_n_u32(255 << 23));
+    const uint32x4_t sign = vshlq_n_u32(veorq_u32(h, exp_mant), 16);
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(scaled), vorrq_u32(inf_nan, sign)));
+}
+
+template <> force_inline fixed_size_simd<float, 4> load_i8<4>(const int8_t *p) {
+    int32_t bits;
+    memcpy(&bits, p, sizeof(int32_t));
+    const int16x8_t v16 = vmovl_s8(vreinterpret_s8_s32(vdup_n_s32(bits)));
+    return vcvtq_f32_s32(vmovl_s16(vget_low_s16(v16)));
+}
+
 force_inline fixed_size_simd<float, 4>::operator fixed_size_simd<int, 4>() const { return vcvtq_s32_f32(vec_); }
 
 force_inline fixed_size_simd<float, 4>::operator fixed_size_simd<unsigned, 4>() const { return vcvtq_u32_f32(vec_); }
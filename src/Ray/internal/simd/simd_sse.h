@@ -31,6 +31,10 @@ template <> class fixed_size_simd<float, 4> {
     friend class fixed_size_simd<int, 4>;
     friend class fixed_size_simd<unsigned, 4>;
 
+    friend fixed_size_simd<float, 4> load_bf16<4>(const uint16_t *p);
+    friend fixed_size_simd<float, 4> load_f16<4>(const uint16_t *p);
+    friend fixed_size_simd<float, 4> load_i8<4>(const int8_t *p);
+
     force_inline fixed_size_simd(const __m128 vec) : vec_(vec) {}
 
   public:
@@ -932,6 +936,35 @@ template <> class fixed_size_simd<unsigned, 4> {
     static bool is_native() { return true; }
 };
 
+template <> force_inline fixed_size_simd<float, 4> load_bf16<4>(const uint16_t *p) {
+    // interleaving with zeros puts bf16 bits into upper halves of 32-bit lanes
+    return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64((const __m128i *)p)));
+}
+
+template <> force_inline fixed_size_simd<float, 4> load_f16<4>(const uint16_t *p) {
+    const __m128i h = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)p), _mm_setzero_si128());
+    const __m128i exp_mant = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+    // rebias exponent with multiplication (handles denormals), then patch Inf/NaN and sign
+    const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exp_mant, 13)),
+                                     _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+    const __m128i inf_nan =
+        _mm_and_si128(_mm_cmpgt_epi32(exp_mant, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(255 << 23));
+    const __m128i sign = _mm_slli_epi32(_mm_xor_si128(h, exp_mant), 16);
+    return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(inf_nan, sign)));
+}
+
+template <> force_inline fixed_size_simd<float, 4> load_i8<4>(const int8_t *p) {
+    int32_t bits;
+    memcpy(&bits, p, sizeof(int32_t));
+#if defined(USE_SSE41)
+    return _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(bits)));
+#else
+    // move bytes into upper bits of 32-bit lanes and sign-extend with arithmetic shift
+    const __m128i v = _mm_unpacklo_epi8(_mm_setzero_si128(), _mm_cvtsi32_si128(bits));
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), v), 24));
+#endif
+}
+
 force_inline vectorcall fixed_size_simd<float, 4>::operator fixed_size_simd<int, 4>() const {
     return _mm_cvttps_epi32(vec_);
 }
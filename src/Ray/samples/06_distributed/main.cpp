@@ -0,0 +1,449 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../../Ray.h"
+
+std::vector<uint8_t> GenerateCheckerboard(int res, int square_size);
+void WriteTGA(const Ray::color_rgba_t *data, int pitch, int w, int h, int bpp, const char *name);
+
+const int IMG_W = 256, IMG_H = 256;
+const int SAMPLE_COUNT = 64;
+const int BUCKET_SIZE = 64;
+
+// Minimal stream buffer on top of file descriptor (socket, pipe etc.)
+class FdStreamBuf : public std::streambuf {
+    int fd_;
+    char buf_[64 * 1024];
+
+  protected:
+    int_type overflow(const int_type c) override {
+        if (sync() != 0) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            buf_[0] = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    int sync() override {
+        const char *p = pbase();
+        while (p < pptr()) {
+            const ssize_t written = write(fd_, p, pptr() - p);
+            if (written <= 0) {
+                return -1;
+            }
+            p += written;
+        }
+        setp(buf_, buf_ + sizeof(buf_));
+        return 0;
+    }
+
+    int_type underflow() override {
+        const ssize_t count = read(fd_, buf_, sizeof(buf_));
+        if (count <= 0) {
+            return traits_type::eof();
+        }
+        setg(buf_, buf_, buf_ + count);
+        return traits_type::to_int_type(buf_[0]);
+    }
+
+  public:
+    explicit FdStreamBuf(const int fd) : fd_(fd) { setp(buf_, buf_ + sizeof(buf_)); }
+    ~FdStreamBuf() override { sync(); }
+};
+
+void SetupScene(Ray::SceneBase *scene) {
+    // Setup environment
+    Ray::environment_desc_t env_desc;
+    env_desc.env_col[0] = env_desc.env_col[1] = env_desc.env_col[2] = 0.0f;
+    scene->SetEnvironment(env_desc);
+
+    // Add checker texture
+    const std::vector<uint8_t> tex_data = GenerateCheckerboard(128, 16);
+    Ray::tex_desc_t tex_desc;
+    tex_desc.format = Ray::eTextureFormat::RGBA8888;
+    tex_desc.w = 128;
+    tex_desc.h = 128;
+    tex_desc.generate_mipmaps = false;
+    tex_desc.data = tex_data;
+
+    Ray::TextureHandle checker_tex = scene->AddTexture(tex_desc);
+
+    // Add diffuse materials
+    Ray::shading_node_desc_t mat_desc1;
+    mat_desc1.type = Ray::eShadingNode::Diffuse;
+    mat_desc1.base_texture = checker_tex;
+    const Ray::MaterialHandle mat0 = scene->AddMaterial(mat_desc1);
+
+    Ray::shading_node_desc_t mat_desc2;
+    mat_desc2.type = Ray::eShadingNode::Diffuse;
+    mat_desc2.base_color[0] = 0.5f;
+    mat_desc2.base_color[1] = 0.5f;
+    mat_desc2.base_color[2] = 0.5f;
+    const Ray::MaterialHandle mat1 = scene->AddMaterial(mat_desc2);
+
+    mat_desc2.base_color[0] = 0.5f;
+    mat_desc2.base_color[1] = 0.0f;
+    mat_desc2.base_color[2] = 0.0f;
+    const Ray::MaterialHandle mat2 = scene->AddMaterial(mat_desc2);
+
+    mat_desc2.base_color[0] = 0.0f;
+    mat_desc2.base_color[1] = 0.5f;
+    mat_desc2.base_color[2] = 0.0f;
+    const Ray::MaterialHandle mat3 = scene->AddMaterial(mat_desc2);
+
+    // Add emissive material
+    Ray::shading_node_desc_t mat_desc3;
+    mat_desc3.type = Ray::eShadingNode::Emissive;
+    mat_desc3.strength = 100.0f;
+    mat_desc3.importance_sample = true; // Use NEE for this lightsource
+    const Ray::MaterialHandle mat4 = scene->AddMaterial(mat_desc3);
+
+    // Setup test mesh
+    // position(3 floats), normal(3 floats), tex_coord(2 floats)
+    // clang-format off
+    const float attrs[] = { // floor
+                            0.0f, 0.0f, -0.5592f,           0.0f, 1.0f, 0.0f,                   1.0f, 1.0f,
+                            0.0f, 0.0f, 0.0f,               0.0f, 1.0f, 0.0f,                   1.0f, 0.0f,
+                            -0.5528f, 0.0f, 0.0f,           0.0f, 1.0f, 0.0f,                   0.0f, 0.0f,
+                            -0.5496f, 0.0f, -0.5592f,       0.0f, 1.0f, 0.0f,                   0.0f, 1.0f,
+                            // back wall
+                            0.0f, 0.0f, -0.5592f,           0.0f, 0.0f, 1.0f,                   0.0f, 0.0f,
+                            -0.5496f, 0.0f, -0.5592f,       0.0f, 0.0f, 1.0f,                   0.0f, 0.0f,
+                            -0.556f, 0.5488f, -0.5592f,     0.0f, 0.0f, 1.0f,                   0.0f, 0.0f,
+                            0.0f, 0.5488f, -0.5592f,        0.0f, 0.0f, 1.0f,                   0.0f, 0.0f,
+                            // ceiling
+                            -0.556f, 0.5488f, -0.5592f,     0.0f, -1.0f, 0.0f,                  0.0f, 0.0f,
+                            0.0f, 0.5488f, -0.5592f,        0.0f, -1.0f, 0.0f,                  0.0f, 0.0f,
+                            0.0f, 0.5488f, 0.0f,            0.0f, -1.0f, 0.0f,                  0.0f, 0.0f,
+                            -0.556f, 0.5488f, 0.0f,         0.0f, -1.0f, 0.0f,                  0.0f, 0.0f,
+                            // left wall
+                            -0.5528f, 0.0f, 0.0f,           1.0f, 0.0f, 0.0f,                   0.0f, 0.0f,
+                            -0.5496f, 0.0f, -0.5592f,       1.0f, 0.0f, 0.0f,                   0.0f, 0.0f,
+                            -0.556f, 0.5488f, 0.0f,         1.0f, 0.0f, 0.0f,                   0.0f, 0.0f,
+                            -0.556f, 0.5488f, -0.5592f,     1.0f, 0.0f, 0.0f,                   0.0f, 0.0f,
+                            // right wall
+                            0.0f, 0.0f, -0.5592f,           -1.0f, 0.0f, 0.0f,                  0.0f, 0.0f,
+                            0.0f, 0.0f, 0.0f,               -1.0f, 0.0f, 0.0f,                  0.0f, 0.0f,
+                            0.0f, 0.5488f, -0.5592f,        -1.0f, 0.0f, 0.0f,                  0.0f, 0.0f,
+                            0.0f, 0.5488f, 0.0f,            -1.0f, 0.0f, 0.0f,                  0.0f, 0.0f,
+                            // light
+                            -0.213f, 0.5478f, -0.227f,      0.0f, -1.0f, 0.0f,                  0.0f, 0.0f,
+                            -0.343f, 0.5478f, -0.227f,      0.0f, -1.0f, 0.0f,                  0.0f, 0.0f,
+                            -0.343f, 0.5478f, -0.332f,      0.0f, -1.0f, 0.0f,                  0.0f, 0.0f,
+                            -0.213f, 0.5478f, -0.332f,      0.0f, -1.0f, 0.0f,                  0.0f, 0.0f,
+                            // short block
+                            -0.240464f, 0.0f, -0.271646f,   0.285951942f, 0.0f, -0.958243966f,  0.0f, 0.0f,
+                            -0.240464f, 0.165f, -0.271646f, 0.285951942f, 0.0f, -0.958243966f,  0.0f, 0.0f,
+                            -0.082354f, 0.165f, -0.224464f, 0.285951942f, 0.0f, -0.958243966f,  0.0f, 0.0f,
+                            -0.082354f, 0.0f, -0.224464f,   0.285951942f, 0.0f, -0.958243966f,  0.0f, 0.0f,
+                            -0.240464f, 0.0, -0.271646f,    -0.958243966f, 0.0f, -0.285951942f, 0.0f, 0.0f,
+                            -0.240464f, 0.165f, -0.271646f, -0.958243966f, 0.0f, -0.285951942f, 0.0f, 0.0f,
+                            -0.287646f, 0.165f, -0.113536f, -0.958243966f, 0.0f, -0.285951942f, 0.0f, 0.0f,
+                            -0.287646f, 0.0f, -0.113536f,   -0.958243966f, 0.0f, -0.285951942f, 0.0f, 0.0f,
+                            -0.082354f, 0.0f, -0.224464f,   0.958243966f, 0.0f, 0.285951942f,   0.0f, 0.0f,
+                            -0.082354f, 0.165f, -0.224464f, 0.958243966f, 0.0f, 0.285951942f,   0.0f, 0.0f,
+                            -0.129536f, 0.165f, -0.066354f, 0.958243966f, 0.0f, 0.285951942f,   0.0f, 0.0f,
+                            -0.129536f, 0.0f, -0.066354f,   0.958243966f, 0.0f, 0.285951942f,   0.0f, 0.0f,
+                            -0.287646f, 0.0f, -0.113536f,   -0.285951942f, 0.0f, 0.958243966f,  0.0f, 0.0f,
+                            -0.287646f, 0.165f, -0.113536f, -0.285951942f, 0.0f, 0.958243966f,  0.0f, 0.0f,
+                            -0.129536f, 0.165f, -0.066354f, -0.285951942f, 0.0f, 0.958243966f,  0.0f, 0.0f,
+                            -0.129536f, 0.0f, -0.066354f,   -0.285951942f, 0.0f, 0.958243966f,  0.0f, 0.0f,
+                            -0.240464f, 0.165f, -0.271646f, 0.0f, 1.0f, 0.0f,                   0.0f, 0.0f,
+                            -0.082354f, 0.165f, -0.224464f, 0.0f, 1.0f, 0.0f,                   0.0f, 0.0f,
+                            -0.129536f, 0.165f, -0.066354f, 0.0f, 1.0f, 0.0f,                   0.0f, 0.0f,
+                            -0.287646f, 0.165f, -0.113536f, 0.0f, 1.0f, 0.0f,                   0.0f, 0.0f,
+                            // tall block
+                            -0.471239f, 0.0f, -0.405353f,   -0.296278358f, 0.0f, -0.955101609f, 0.0f, 0.0f,
+                            -0.471239f, 0.33f, -0.405353f,  -0.296278358f, 0.0f, -0.955101609f, 0.0f, 0.0f,
+                            -0.313647f, 0.33f, -0.454239f,  -0.296278358f, 0.0f, -0.955101609f, 0.0f, 0.0f,
+                            -0.313647f, 0.0f, -0.454239f,   -0.296278358f, 0.0f, -0.955101609f, 0.0f, 0.0f,
+                            -0.264761f, 0.0f, -0.296647f,   0.955101609f, 0.0f, -0.296278358f,  0.0f, 0.0f,
+                            -0.264761f, 0.33f, -0.296647f,  0.955101609f, 0.0f, -0.296278358f,  0.0f, 0.0f,
+                            -0.313647f, 0.33f, -0.454239f,  0.955101609f, 0.0f, -0.296278358f,  0.0f, 0.0f,
+                            -0.313647f, 0.0f, -0.454239f,   0.955101609f, 0.0f, -0.296278358f,  0.0f, 0.0f,
+                            -0.471239f, 0.0f, -0.405353f,   -0.955101609f, 0.0f, 0.296278358f,  0.0f, 0.0f,
+                            -0.471239f, 0.33f, -0.405353f,  -0.955101609f, 0.0f, 0.296278358f,  0.0f, 0.0f,
+                            -0.422353f, 0.33f, -0.247761f,  -0.955101609f, 0.0f, 0.296278358f,  0.0f, 0.0f,
+                            -0.422353f, 0.0f, -0.247761f,   -0.955101609f, 0.0f, 0.296278358f,  0.0f, 0.0f,
+                            -0.422353f, 0.0f, -0.247761f,   0.296278358f, 0.0f, 0.955101609f,   0.0f, 0.0f,
+                            -0.422353f, 0.33f, -0.247761f,  0.296278358f, 0.0f, 0.955101609f,   0.0f, 0.0f,
+                            -0.264761f, 0.33f, -0.296647f,  0.296278358f, 0.0f, 0.955101609f,   0.0f, 0.0f,
+                            -0.264761f, 0.0f, -0.296647f,   0.296278358f, 0.0f, 0.955101609f,   0.0f, 0.0f,
+                            -0.471239f, 0.33f, -0.405353f,  0.0f, 1.0f, 0.0f,                   0.0f, 0.0f,
+                            -0.313647f, 0.33f, -0.454239f,  0.0f, 1.0f, 0.0f,                   0.0f, 0.0f,
+                            -0.264761f, 0.33f, -0.296647f,  0.0f, 1.0f, 0.0f,                   0.0f, 0.0f,
+                            -0.422353f, 0.33f, -0.247761f,  0.0f, 1.0f, 0.0f,                   0.0f, 0.0f};
+    const uint32_t indices[] = { 0, 2, 1, 0, 3, 2,
+                                 4, 6, 5, 4, 7, 6,
+                                 8, 9, 10, 8, 10, 11,
+                                 12, 13, 14, 13, 15, 14,
+                                 16, 17, 18, 18, 17, 19,
+                                 20, 21, 22, 20, 22, 23,
+                                 24, 25, 26, 24, 26, 27,
+                                 28, 30, 29, 28, 31, 30,
+                                 32, 33, 34, 32, 34, 35,
+                                 36, 38, 37, 36, 39, 38,
+                                 40, 42, 41, 40, 43, 42,
+                                 44, 45, 46, 44, 46, 47,
+                                 48, 50, 49, 48, 51, 50,
+                                 52, 54, 53, 52, 55, 54,
+                                 56, 58, 57, 56, 59, 58,
+                                 60, 62, 61, 60, 63, 62};
+    // clang-format on
+
+    Ray::mesh_desc_t mesh_desc;
+    mesh_desc.prim_type = Ray::ePrimType::TriangleList;
+    mesh_desc.vtx_positions = {attrs, 0, 8};
+    mesh_desc.vtx_normals = {attrs, 3, 8};
+    mesh_desc.vtx_uvs = {attrs, 6, 8};
+    mesh_desc.vtx_indices = indices;
+
+    // Setup material groups
+    const Ray::mat_group_desc_t groups[] = {
+        {mat0, 0, 6},  {mat1, 6, 12}, {mat2, 19, 6}, {mat3, 25, 6}, {mat4, Ray::InvalidMaterialHandle, 31, 6},
+        {mat1, 37, 60}};
+    mesh_desc.groups = groups;
+
+    Ray::MeshHandle mesh1 = scene->AddMesh(mesh_desc);
+
+    // Instantiate mesh
+    const float xform[] = {1.0f, 0.0f, 0.0f, 0.0f, //
+                           0.0f, 1.0f, 0.0f, 0.0f, //
+                           0.0f, 0.0f, 1.0f, 0.0f, //
+                           0.0f, 0.0f, 0.0f, 1.0f};
+    scene->AddMeshInstance(mesh1, xform);
+
+    // Add camera
+    const float view_origin[] = {-0.278f, 0.273f, 0.8f};
+    const float view_dir[] = {0.0f, 0.0f, -1.0f};
+
+    Ray::camera_desc_t cam_desc;
+    cam_desc.type = Ray::eCamType::Persp;
+    memcpy(&cam_desc.origin[0], &view_origin[0], 3 * sizeof(float));
+    memcpy(&cam_desc.fwd[0], &view_dir[0], 3 * sizeof(float));
+    cam_desc.fov = 39.1463f;
+
+    const Ray::CameraHandle cam = scene->AddCamera(cam_desc);
+    scene->set_current_cam(cam);
+
+    scene->Finalize();
+}
+
+std::vector<Ray::RegionContext> CreateRegions(const int first_sample) {
+    std::vector<Ray::RegionContext> regions;
+    for (int y = 0; y < IMG_H; y += BUCKET_SIZE) {
+        for (int x = 0; x < IMG_W; x += BUCKET_SIZE) {
+            regions.emplace_back(Ray::rect_t{x, y, BUCKET_SIZE, BUCKET_SIZE}, first_sample);
+        }
+    }
+    return regions;
+}
+
+// Renders part of the work and sends it to coordinator, either samples range or every n-th image tile is rendered
+void RunWorker(const int index, const int workers_count, const bool split_tiles, const int fd) {
+    Ray::settings_t s;
+    s.w = IMG_W;
+    s.h = IMG_H;
+
+    // Each worker is single-threaded, parallelism comes from processes
+    Ray::RendererBase *renderer = Ray::CreateRenderer(s, &Ray::g_null_log, Ray::parallel_for_serial, Ray::RendererCPU);
+    Ray::SceneBase *scene = renderer->CreateScene();
+    SetupScene(scene);
+
+    std::vector<Ray::RegionContext> regions;
+    if (split_tiles) {
+        regions = CreateRegions(0);
+        for (int i = index; i < int(regions.size()); i += workers_count) {
+            for (int j = 0; j < SAMPLE_COUNT; ++j) {
+                renderer->RenderScene(*scene, regions[i]);
+            }
+        }
+    } else {
+        // Samples are offset to produce the same sequence as a single renderer would
+        const int first_sample = (SAMPLE_COUNT * index) / workers_count,
+                  last_sample = (SAMPLE_COUNT * (index + 1)) / workers_count;
+        regions = CreateRegions(first_sample);
+        for (Ray::RegionContext &region : regions) {
+            for (int j = first_sample; j < last_sample; ++j) {
+                renderer->RenderScene(*scene, region);
+            }
+        }
+    }
+
+    FdStreamBuf buf(fd);
+    std::ostream out(&buf);
+    if (!renderer->SaveCheckpoint(*scene, regions, out)) {
+        fprintf(stderr, "Worker %i failed to send result\n", index);
+    }
+
+    delete scene;
+    delete renderer;
+}
+
+// Renders image with several worker processes, returns time in seconds
+double RenderDistributed(const int workers_count, const bool split_tiles, const char *out_name) {
+    using namespace std::chrono;
+
+    const auto time_start = high_resolution_clock::now();
+
+    std::vector<pid_t> workers;
+    std::vector<int> sockets;
+    for (int i = 0; i < workers_count; ++i) {
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+            fprintf(stderr, "Failed to create socket pair\n");
+            break;
+        }
+
+        const pid_t pid = fork();
+        if (pid == 0) {
+            close(fds[0]);
+            RunWorker(i, workers_count, split_tiles, fds[1]);
+            close(fds[1]);
+            _exit(0);
+        }
+        close(fds[1]);
+        if (pid < 0) {
+            fprintf(stderr, "Failed to start worker\n");
+            close(fds[0]);
+            break;
+        }
+        workers.push_back(pid);
+        sockets.push_back(fds[0]);
+    }
+
+    // Coordinator only merges results of workers (scene is needed to match the interface)
+    Ray::settings_t s;
+    s.w = IMG_W;
+    s.h = IMG_H;
+
+    Ray::RendererBase *renderer =
+        Ray::CreateRenderer(s, &Ray::g_stdout_log, Ray::parallel_for_serial, Ray::RendererCPU);
+    Ray::SceneBase *scene = renderer->CreateScene();
+    SetupScene(scene);
+
+    std::vector<Ray::RegionContext> regions = CreateRegions(0);
+    for (const int fd : sockets) {
+        FdStreamBuf buf(fd);
+        std::istream in(&buf);
+        if (!renderer->MergeCheckpoint(*scene, regions, in)) {
+            fprintf(stderr, "Failed to merge worker result\n");
+        }
+        close(fd);
+    }
+    for (const pid_t pid : workers) {
+        waitpid(pid, nullptr, 0);
+    }
+
+    const auto time_end = high_resolution_clock::now();
+
+    const Ray::color_data_rgba_t pixels = renderer->get_pixels_ref();
+    WriteTGA(pixels.ptr, pixels.pitch, IMG_W, IMG_H, 3, out_name);
+
+    delete scene;
+    delete renderer;
+
+    return duration<double>{time_end - time_start}.count();
+}
+
+int main(int argc, char *argv[]) {
+    // Usage: 06_distributed [workers count] [tiles]
+    const int workers_count = (argc > 1) ? std::max(atoi(argv[1]), 1) : 4;
+    const bool split_tiles = (argc > 2) && strcmp(argv[2], "tiles") == 0;
+
+    printf("Rendering with 1 worker...\n");
+    const double time_single = RenderDistributed(1, split_tiles, "06_distributed_ref.tga");
+    printf("Rendering with %i workers (%s)...\n", workers_count, split_tiles ? "tiles" : "samples");
+    const double time_multi = RenderDistributed(workers_count, split_tiles, "06_distributed.tga");
+
+    // Ideal scaling gives N times lower render time
+    printf("Time: %.2fs (1 worker), %.2fs (%i workers)\n", time_single, time_multi, workers_count);
+    printf("Scaling efficiency: %.1f%%\n", 100.0 * time_single / (workers_count * time_multi));
+    printf("Image saved as samples/06_distributed.tga\n");
+}
+
+#define float_to_byte(val)                                                                                             \
+    (((val) <= 0.0f) ? 0 : (((val) > (1.0f - 0.5f / 255.0f)) ? 255 : uint8_t((255.0f * (val)) + 0.5f)))
+
+void WriteTGA(const Ray::color_rgba_t *data, int pitch, const int w, const int h, const int bpp, const char *name) {
+    if (!pitch) {
+        pitch = w;
+    }
+
+    std::ofstream file(name, std::ios::binary);
+
+    unsigned char header[18] = {0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    header[12] = w & 0xFF;
+    header[13] = (w >> 8) & 0xFF;
+    header[14] = (h) & 0xFF;
+    header[15] = (h >> 8) & 0xFF;
+    header[16] = bpp * 8;
+    header[17] |= (1 << 5); // set origin to upper left corner
+
+    file.write((char *)&header[0], sizeof(header));
+
+    auto out_data = std::unique_ptr<uint8_t[]>{new uint8_t[size_t(w) * h * bpp]};
+    for (int j = 0; j < h; ++j) {
+        for (int i = 0; i < w; ++i) {
+            out_data[(j * w + i) * bpp + 0] = float_to_byte(data[j * pitch + i].v[2]);
+            out_data[(j * w + i) * bpp + 1] = float_to_byte(data[j * pitch + i].v[1]);
+            out_data[(j * w + i) * bpp + 2] = float_to_byte(data[j * pitch + i].v[0]);
+            if (bpp == 4) {
+                out_data[i * 4 + 3] = float_to_byte(data[j * pitch + i].v[3]);
+            }
+        }
+    }
+
+    file.write((const char *)&out_data[0], size_t(w) * h * bpp);
+
+    static const char footer[26] = "\0\0\0\0"         // no extension area
+                                   "\0\0\0\0"         // no developer directory
+                                   "TRUEVISION-XFILE" // yep, this is a TGA file
+                                   ".";
+    file.write(footer, sizeof(footer));
+}
+
+std::vector<uint8_t> GenerateCheckerboard(const int res, const int square_size) {
+    std::vector<uint8_t> ret(4 * res * res);
+
+    for (int i = 0; i < res; i++) {
+        for (int j = 0; j < res; j++) {
+            const int index = i * res + j;
+            const int square_x = j / square_size;
+            const int square_y = i / square_size;
+
+            if ((square_x + square_y) % 2 == 0) {
+                ret[4 * index + 0] = 10;
+                ret[4 * index + 1] = 10;
+                ret[4 * index + 2] = 10;
+                ret[4 * index + 3] = 255;
+            } else {
+                ret[4 * index + 0] = 250;
+                ret[4 * index + 1] = 250;
+                ret[4 * index + 2] = 250;
+                ret[4 * index + 3] = 255;
+            }
+        }
+    }
+
+    return ret;
+}
\ No newline at end of file
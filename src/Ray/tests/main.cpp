@@ -20,6 +20,8 @@ void test_freelist_alloc();
 void test_span();
 void test_sparse_storage();
 void test_tex_storage();
+void test_bvh_build();
+void test_spatial_cache();
 
 void test_aux_channels(const char *arch_list[], const char *preferred_device);
 void test_ray_flags(const char *arch_list[], const char *preferred_device);
@@ -111,6 +113,17 @@ void test_complex_mat6_dir_light(const char *arch_list[], const char *preferred_
 void test_complex_mat6_hdri_light(const char *arch_list[], const char *preferred_device);
 void test_complex_mat7_refractive(const char *arch_list[], const char *preferred_device);
 void test_complex_mat7_principled(const char *arch_list[], const char *preferred_device);
+void test_unet_precision(const char *arch_list[], const char *preferred_device);
+void test_bvh_quantized(const char *arch_list[], const char *preferred_device);
+void test_packet_traversal(const char *arch_list[], const char *preferred_device);
+void test_adaptive_sampling(const char *arch_list[], const char *preferred_device);
+void test_compact_buffers(const char *arch_list[], const char *preferred_device);
+void test_checkpoint(const char *arch_list[], const char *preferred_device);
+void test_distributed(const char *arch_list[], const char *preferred_device);
+void test_scene_cache(const char *arch_list[], const char *preferred_device);
+void test_tlas_refit(const char *arch_list[], const char *preferred_device);
+void test_nlm_simd(const char *arch_list[], const char *preferred_device);
+void test_resolve_simd(const char *arch_list[], const char *preferred_device);
 void assemble_material_test_images(const char *arch_list[]);
 
 bool g_stop_on_fail = false;
@@ -207,6 +220,8 @@ int main(int argc, char *argv[]) {
     test_span();
     test_sparse_storage();
     test_tex_storage();
+    test_bvh_build();
+    test_spatial_cache();
     puts(" ---------------");
 
 #ifdef _WIN32
@@ -286,6 +301,17 @@ int main(int argc, char *argv[]) {
         futures.push_back(mt_run_pool.Enqueue(test_complex_mat6_hdri_light, arch_list, device_name));
         futures.push_back(mt_run_pool.Enqueue(test_complex_mat7_refractive, arch_list, device_name));
         futures.push_back(mt_run_pool.Enqueue(test_complex_mat7_principled, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_unet_precision, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_bvh_quantized, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_packet_traversal, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_adaptive_sampling, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_compact_buffers, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_checkpoint, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_distributed, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_scene_cache, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_tlas_refit, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_nlm_simd, arch_list, device_name));
+        futures.push_back(mt_run_pool.Enqueue(test_resolve_simd, arch_list, device_name));
 
         for (auto &f : futures) {
             f.wait();
@@ -0,0 +1,99 @@
+#include "test_common.h"
+
+#include <cstring>
+
+#include "../Ray.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+namespace {
+struct frame_t {
+    std::vector<Ray::color_rgba_t> pixels, base_color, depth_normals;
+};
+
+frame_t capture_frame(const Ray::RendererBase &renderer, const int w, const int h) {
+    frame_t ret;
+    ret.pixels = copy_pixels(renderer.get_raw_pixels_ref(), w, h);
+    ret.base_color.resize(w * h);
+    renderer.GetAUXPixels(Ray::eAUXBuffer::BaseColor, ret.base_color.data(), w);
+    ret.depth_normals.resize(w * h);
+    renderer.GetAUXPixels(Ray::eAUXBuffer::DepthNormals, ret.depth_normals.data(), w);
+    return ret;
+}
+
+bool same_pixel(const frame_t &f1, const frame_t &f2, const int i) {
+    return memcmp(&f1.pixels[i], &f2.pixels[i], sizeof(Ray::color_rgba_t)) == 0 &&
+           memcmp(&f1.base_color[i], &f2.base_color[i], sizeof(Ray::color_rgba_t)) == 0 &&
+           memcmp(&f1.depth_normals[i], &f2.depth_normals[i], sizeof(Ray::color_rgba_t)) == 0;
+}
+} // namespace
+
+void test_adaptive_sampling(const char *arch_list[], const char *preferred_device) {
+    using namespace std::placeholders;
+
+    const char TestName[] = "adaptive_sampling";
+
+    const int ImgW = 128, ImgH = 128;
+    Ray::settings_t s = swrt_test_settings(ImgW, ImgH, preferred_device, g_validation_level);
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+    auto parallel_for = std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+    const int MinSamples = 4, SampleStep = 8;
+    const float VarianceThreshold = 0.2f;
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+        if ((Ray::RendererCPU & Ray::Bitmask<Ray::eRendererType>{rt}) != rt) {
+            // active pixel compaction is done on CPU backends only
+            continue;
+        }
+
+        auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+        if (!renderer || renderer->type() != rt) {
+            // skip unsupported (we fell back to some other renderer)
+            continue;
+        }
+
+        auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+        setup_metal_test_scene(threads, *scene, MinSamples, VarianceThreshold);
+
+        std::vector<Ray::RegionContext> regions = split_into_regions(ImgW, ImgH);
+
+        frame_t frames[3];
+        for (frame_t &f : frames) {
+            render_samples(threads, *renderer, *scene, regions, SampleStep);
+            f = capture_frame(*renderer, ImgW, ImgH);
+        }
+
+        // pixel that was left untouched by a whole round of samples is converged, it must not change anymore
+        int converged_count = 0, changed_count = 0;
+        for (int i = 0; i < ImgW * ImgH; ++i) {
+            if (same_pixel(frames[0], frames[1], i)) {
+                ++converged_count;
+                require(same_pixel(frames[1], frames[2], i));
+            } else {
+                ++changed_count;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(%.1f%% converged)\n", 100.0 * double(converged_count) / double(ImgW * ImgH));
+            fflush(stdout);
+        }
+
+        // both converged and active pixels must be present for the test to be meaningful
+        require(converged_count > 0);
+        require(changed_count > 0);
+    }
+}
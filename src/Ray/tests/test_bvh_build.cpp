@@ -0,0 +1,165 @@
+#include "test_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+#include "../internal/Core.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+namespace {
+float CalcSAHCost(const std::vector<Ray::bvh_node_t> &nodes) {
+    const auto surface_area = [](const Ray::bvh_node_t &n) {
+        const float d[3] = {n.bbox_max[0] - n.bbox_min[0], n.bbox_max[1] - n.bbox_min[1],
+                            n.bbox_max[2] - n.bbox_min[2]};
+        return 2.0f * (d[0] * d[1] + d[0] * d[2] + d[1] * d[2]);
+    };
+
+    double cost = 0.0;
+    for (const Ray::bvh_node_t &n : nodes) {
+        if (n.prim_index & Ray::LEAF_NODE_BIT) {
+            cost += double(surface_area(n)) * (n.prim_count & Ray::PRIM_COUNT_BITS);
+        } else {
+            cost += surface_area(n);
+        }
+    }
+    return float(cost / surface_area(nodes[0]));
+}
+
+// Hash of tree structure, which does not depend on nodes layout in memory and order of primitives inside of leaves
+uint64_t CalcTopologyHash(const std::vector<Ray::bvh_node_t> &nodes, const std::vector<uint32_t> &tri_indices,
+                          const uint32_t node_index = 0) {
+    const Ray::bvh_node_t &n = nodes[node_index];
+    if (n.prim_index & Ray::LEAF_NODE_BIT) {
+        const uint32_t beg = (n.prim_index & Ray::PRIM_INDEX_BITS);
+        std::vector<uint32_t> prims(tri_indices.begin() + beg,
+                                    tri_indices.begin() + beg + (n.prim_count & Ray::PRIM_COUNT_BITS));
+        std::sort(prims.begin(), prims.end());
+
+        uint64_t hash = 1469598103934665603ull;
+        for (const uint32_t i : prims) {
+            hash ^= i;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+    const uint64_t left = CalcTopologyHash(nodes, tri_indices, n.left_child & Ray::LEFT_CHILD_BITS),
+                   right = CalcTopologyHash(nodes, tri_indices, n.right_child & Ray::RIGHT_CHILD_BITS);
+    return (left * 31) ^ (right * 1000003ull) ^ 0x9e3779b97f4a7c15ull;
+}
+} // namespace
+
+void test_bvh_build() {
+    using namespace std::placeholders;
+
+    printf("Test bvh_build          | ");
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+    const auto parallel_for =
+        std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+    // spatial splits are too slow to be used with big meshes
+    const struct {
+        const char *name;
+        bool spatial_splits;
+    } Meshes[] = {{"model", false}, {"core", false}, {"base", true}, {"text", true}};
+    const int MeshesCount = int(sizeof(Meshes) / sizeof(Meshes[0]));
+
+    // Reference values produced by sequential builder (before parallelization), indexed by [mesh][spatial_splits]
+    const struct {
+        uint32_t nodes_count;
+        uint64_t topology_hash;
+        float sah_cost;
+    } Reference[][2] = {{{26901, 0x632b0f3cdd7e70a4ull, 73.9946f}, {26939, 0xca58b66af62d2a7bull, 73.9642f}},
+                        {{11425, 0x0267da594cabfa8dull, 48.1085f}, {11425, 0x056608a96c33c0f7ull, 48.1099f}},
+                        {{955, 0xfd1b4b0dc534f0f1ull, 33.0039f}, {955, 0xfd1b4b0dc534f0f1ull, 33.0039f}},
+                        {{1169, 0xefaa401a899d937aull, 4.1266f}, {1289, 0xa7188b64de9ac1e6ull, 3.9473f}}};
+
+    struct result_t {
+        size_t tris_count;
+        double serial_ms[2], parallel_ms[2];
+        float cost[2];
+    } results[MeshesCount];
+
+    for (int i = 0; i < MeshesCount; ++i) {
+        char file_name[256];
+        snprintf(file_name, sizeof(file_name), "test_data/meshes/mat_test/%s.bin", Meshes[i].name);
+
+        std::vector<float> attrs;
+        std::vector<uint32_t> indices, groups;
+        std::tie(attrs, indices, groups) = LoadBIN(file_name);
+        require(!indices.empty());
+
+        results[i].tris_count = indices.size() / 3;
+
+        for (const bool spatial_splits : {false, true}) {
+            if (spatial_splits && !Meshes[i].spatial_splits) {
+                continue;
+            }
+
+            Ray::bvh_settings_t s;
+            s.oversplit_threshold = -1.0f;
+            s.allow_spatial_splits = spatial_splits;
+            s.min_primitives_in_leaf = 8;
+            s.primitive_alignment = 8;
+
+            std::vector<Ray::bvh_node_t> nodes[2];
+            Ray::aligned_vector<Ray::tri_accel_t> tris[2];
+            Ray::aligned_vector<Ray::mtri_accel_t> mtris[2];
+            std::vector<uint32_t> tri_indices[2];
+
+            const auto t1 = std::chrono::high_resolution_clock::now();
+            Ray::PreprocessMesh({attrs, 0, 8}, indices, 0, s, nodes[0], tris[0], tri_indices[0], mtris[0]);
+            const auto t2 = std::chrono::high_resolution_clock::now();
+            Ray::PreprocessMesh({attrs, 0, 8}, indices, 0, s, nodes[1], tris[1], tri_indices[1], mtris[1],
+                                parallel_for);
+            const auto t3 = std::chrono::high_resolution_clock::now();
+
+            // parallel build must give exactly the same tree
+            require(nodes[0].size() == nodes[1].size());
+            require(memcmp(nodes[0].data(), nodes[1].data(), nodes[0].size() * sizeof(Ray::bvh_node_t)) == 0);
+            require(tri_indices[0] == tri_indices[1]);
+
+            // tree must be the same as the one produced by sequential builder
+            const float sah_cost = CalcSAHCost(nodes[1]);
+            require(nodes[1].size() == Reference[i][spatial_splits].nodes_count);
+            require(CalcTopologyHash(nodes[1], tri_indices[1]) == Reference[i][spatial_splits].topology_hash);
+            require(std::abs(sah_cost - Reference[i][spatial_splits].sah_cost) < 0.001f);
+
+            // tree must reference only valid nodes and triangles
+            for (const Ray::bvh_node_t &n : nodes[1]) {
+                if (n.prim_index & Ray::LEAF_NODE_BIT) {
+                    const uint32_t beg = (n.prim_index & Ray::PRIM_INDEX_BITS);
+                    require(beg + (n.prim_count & Ray::PRIM_COUNT_BITS) <= tri_indices[1].size());
+                    for (uint32_t j = beg; j < beg + (n.prim_count & Ray::PRIM_COUNT_BITS); ++j) {
+                        require(tri_indices[1][j] < indices.size() / 3);
+                    }
+                } else {
+                    require((n.left_child & Ray::LEFT_CHILD_BITS) < nodes[1].size());
+                    require((n.right_child & Ray::RIGHT_CHILD_BITS) < nodes[1].size());
+                }
+            }
+
+            results[i].serial_ms[spatial_splits] = std::chrono::duration<double, std::milli>(t2 - t1).count();
+            results[i].parallel_ms[spatial_splits] = std::chrono::duration<double, std::milli>(t3 - t2).count();
+            results[i].cost[spatial_splits] = sah_cost;
+        }
+    }
+
+    printf("OK\n");
+
+    printf("\tBVH build (%i threads):\n", int(threads.workers_count()));
+    for (int i = 0; i < MeshesCount; ++i) {
+        const result_t &res = results[i];
+        printf("\t\t%-6s (%6i tris): %7.2fms -> %7.2fms (SAH %.2f)", Meshes[i].name, int(res.tris_count),
+               res.serial_ms[0], res.parallel_ms[0], res.cost[0]);
+        if (Meshes[i].spatial_splits) {
+            printf(", spatial splits: %7.2fms -> %7.2fms (SAH %.2f)", res.serial_ms[1], res.parallel_ms[1],
+                   res.cost[1]);
+        }
+        printf("\n");
+    }
+}
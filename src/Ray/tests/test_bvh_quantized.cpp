@@ -0,0 +1,108 @@
+#include "test_common.h"
+
+#include <chrono>
+
+#include "../Ray.h"
+#include "../internal/Core.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+void test_bvh_quantized(const char *arch_list[], const char *preferred_device) {
+    using namespace std::chrono;
+
+    const char TestName[] = "bvh_quantized";
+
+    int test_img_w, test_img_h;
+    const auto test_img = LoadTGA("test_data/complex_mat5/ref.tga", test_img_w, test_img_h);
+    require_return(!test_img.empty());
+
+    Ray::settings_t s = swrt_test_settings(test_img_w, test_img_h, preferred_device, g_validation_level);
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+
+    const int SampleCount = 16;
+    // only traversal order can differ (decoded boxes are slightly bigger), hit results must be the same
+    const double MinPSNR = 45.0;
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+        if ((Ray::RendererCPU & Ray::Bitmask<Ray::eRendererType>{rt}) != rt || rt == Ray::eRendererType::Reference) {
+            // quantized nodes are implemented for SIMD CPU backends only
+            continue;
+        }
+
+        std::vector<Ray::color_rgba_t> pixels[2];
+        size_t nodes_size[2] = {};
+        double render_ms[2] = {}, primary_mrays[2] = {}, secondary_trace_ms[2] = {};
+
+        for (const bool use_compressed_bvh : {false, true}) {
+            s.use_compressed_bvh = use_compressed_bvh;
+
+            using namespace std::placeholders;
+            auto parallel_for =
+                std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+            auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+            if (!renderer || renderer->type() != rt) {
+                // skip unsupported (we fell back to some other renderer)
+                break;
+            }
+
+            auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+            setup_metal_test_scene(threads, *scene);
+
+            nodes_size[use_compressed_bvh] =
+                size_t(scene->node_count()) *
+                (use_compressed_bvh ? sizeof(Ray::qwbvh_node_t) : sizeof(Ray::wbvh_node_t));
+
+            char name_buf[1024];
+            snprintf(name_buf, sizeof(name_buf), "Test %-25s", TestName);
+
+            renderer->ResetStats();
+
+            const auto t1 = high_resolution_clock::now();
+            schedule_render_jobs(threads, *renderer, scene.get(), s, SampleCount, eDenoiseMethod::None, false,
+                                 name_buf);
+            render_ms[use_compressed_bvh] = duration<double, std::milli>(high_resolution_clock::now() - t1).count();
+
+            Ray::RendererBase::stats_t st = {};
+            renderer->GetStats(st);
+
+            // trace time is accumulated across all threads, so this is a single-thread rate
+            primary_mrays[use_compressed_bvh] =
+                double(test_img_w) * test_img_h * SampleCount / double(std::max(st.time_primary_trace_us, 1ull));
+            secondary_trace_ms[use_compressed_bvh] = double(st.time_secondary_trace_us) / 1000.0;
+
+            pixels[use_compressed_bvh] = copy_pixels(renderer->get_pixels_ref(), test_img_w, test_img_h);
+        }
+
+        if (pixels[0].empty() || pixels[1].empty()) {
+            continue;
+        }
+
+        const double psnr = calc_psnr(pixels[0], pixels[1]);
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(PSNR: %.2f/%.2f dB)\n", psnr, MinPSNR);
+            printf("\tBVH nodes full/quantized: %.2f/%.2f MB\n", double(nodes_size[0]) / (1024.0 * 1024.0),
+                   double(nodes_size[1]) / (1024.0 * 1024.0));
+            printf("\tPrimary trace: %.2f/%.2f Mrays/s, secondary trace: %.1f/%.1f ms, total: %.1f/%.1f ms\n",
+                   primary_mrays[0], primary_mrays[1], secondary_trace_ms[0], secondary_trace_ms[1], render_ms[0],
+                   render_ms[1]);
+            fflush(stdout);
+        }
+
+        require(nodes_size[1] < nodes_size[0]);
+        require(psnr >= MinPSNR);
+    }
+}
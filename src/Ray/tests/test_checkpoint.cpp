@@ -0,0 +1,138 @@
+#include "test_common.h"
+
+#include <sstream>
+
+#include "../Ray.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+void test_checkpoint(const char *arch_list[], const char *preferred_device) {
+    const char TestName[] = "checkpoint";
+
+    Ray::settings_t s = swrt_test_settings(128, 128, preferred_device, g_validation_level);
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+
+    // samples rendered before and after interruption
+    const int SampleCountBefore = 5, SampleCountAfter = 4;
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+        if ((Ray::RendererCPU & Ray::Bitmask<Ray::eRendererType>{rt}) != rt) {
+            // checkpoints are implemented for CPU backends only
+            continue;
+        }
+
+        // checkpoint sizes (in bytes) for full and compact buffers
+        size_t checkpoint_size[2] = {};
+
+        int config = 0;
+        for (; config < 4; ++config) {
+            const bool use_spatial_cache = (config & 2) != 0, use_compact_buffers = (config & 1) != 0;
+            s.use_spatial_cache = use_spatial_cache;
+            s.use_compact_buffers = use_compact_buffers;
+
+            using namespace std::placeholders;
+            auto parallel_for =
+                std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+            // Uninterrupted render
+            auto ref_renderer =
+                std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+            if (!ref_renderer || ref_renderer->type() != rt) {
+                // skip unsupported (we fell back to some other renderer)
+                break;
+            }
+            auto ref_scene = std::unique_ptr<Ray::SceneBase>(ref_renderer->CreateScene());
+            setup_metal_test_scene(threads, *ref_scene);
+
+            std::vector<Ray::RegionContext> ref_regions = split_into_regions(s.w, s.h);
+            render_samples(threads, *ref_renderer, *ref_scene, ref_regions, SampleCountBefore + SampleCountAfter);
+
+            // Interrupted render
+            std::stringstream checkpoint;
+            {
+                auto renderer =
+                    std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+                auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+                setup_metal_test_scene(threads, *scene);
+
+                std::vector<Ray::RegionContext> regions = split_into_regions(s.w, s.h);
+                render_samples(threads, *renderer, *scene, regions, SampleCountBefore);
+                require(renderer->SaveCheckpoint(*scene, regions, checkpoint));
+
+                { // Failed load leaves renderer and scene state untouched
+                    const std::string data = checkpoint.str();
+                    std::stringstream truncated(data.substr(0, data.size() - 16));
+                    require(!renderer->LoadCheckpoint(*scene, regions, truncated));
+                    require(regions[0].iteration == SampleCountBefore);
+
+                    std::stringstream checkpoint_after;
+                    require(renderer->SaveCheckpoint(*scene, regions, checkpoint_after));
+                    require(checkpoint_after.str() == data);
+                }
+            }
+            if (!use_spatial_cache) {
+                checkpoint_size[use_compact_buffers] = checkpoint.str().size();
+            }
+
+            // Resumed render (from scratch, as if the process was restarted)
+            auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+            auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+            setup_metal_test_scene(threads, *scene);
+
+            std::vector<Ray::RegionContext> regions = split_into_regions(s.w, s.h);
+            { // Truncated checkpoint is rejected and leaves regions untouched
+                const std::string data = checkpoint.str();
+                std::stringstream truncated(data.substr(0, data.size() / 2));
+                require(!renderer->LoadCheckpoint(*scene, regions, truncated));
+                require(regions[0].iteration == 0);
+            }
+            { // Regions must match
+                std::vector<Ray::RegionContext> other_regions = split_into_regions(s.w / 2, s.h);
+                checkpoint.seekg(0);
+                require(!renderer->LoadCheckpoint(*scene, other_regions, checkpoint));
+            }
+            checkpoint.clear();
+            checkpoint.seekg(0);
+            require_return(renderer->LoadCheckpoint(*scene, regions, checkpoint));
+            require(regions[0].iteration == SampleCountBefore);
+
+            render_samples(threads, *renderer, *scene, regions, SampleCountAfter);
+
+            // Result must be exactly the same
+            require(regions[0].iteration == ref_regions[0].iteration);
+            {
+                std::vector<Ray::color_rgba_t> raw(s.w * s.h), ref_raw(s.w * s.h);
+                renderer->GetRawPixels(raw.data(), s.w);
+                ref_renderer->GetRawPixels(ref_raw.data(), s.w);
+                require(compare_images({raw.data(), s.w}, {ref_raw.data(), s.w}, s.w, s.h));
+            }
+            for (const Ray::eAUXBuffer buf : {Ray::eAUXBuffer::BaseColor, Ray::eAUXBuffer::DepthNormals}) {
+                std::vector<Ray::color_rgba_t> aux(s.w * s.h), ref_aux(s.w * s.h);
+                renderer->GetAUXPixels(buf, aux.data(), s.w);
+                ref_renderer->GetAUXPixels(buf, ref_aux.data(), s.w);
+                require(compare_images({aux.data(), s.w}, {ref_aux.data(), s.w}, s.w, s.h));
+            }
+        }
+        if (config != 4) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(checkpoint size: %.2f/%.2f MB)\n", double(checkpoint_size[0]) / (1024.0 * 1024.0),
+                   double(checkpoint_size[1]) / (1024.0 * 1024.0));
+            fflush(stdout);
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#include "test_common.h"
+
+#include <cmath>
+
+#include "../Ray.h"
+#include "../internal/Core.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+void test_compact_buffers(const char *arch_list[], const char *preferred_device) {
+    const char TestName[] = "compact_buffers";
+
+    { // Shared exponent packing
+        const float values[][3] = {{0.0f, 0.0f, 0.0f},     {1.0f, 0.5f, 0.25f}, {0.8f, 0.001f, 0.3f},
+                                   {1.0f, 1.0f, 1.0f},     {0.999f, 0.0f, 0.0f}, {-1.0f, 2.0f, 70000.0f},
+                                   {1e-7f, 1e-6f, 1e-5f}};
+        for (const float(&v)[3] : values) {
+            float res[3];
+            Ray::rgb9e5_to_rgb(Ray::rgb_to_rgb9e5(v), res);
+
+            const float max_val = std::max(std::max(v[0], v[1]), v[2]);
+            for (int k = 0; k < 3; ++k) {
+                const float expected = std::min(std::max(v[k], 0.0f), 65408.0f);
+                // error is bounded by mantissa step of the largest channel (or of the smallest exponent)
+                require(std::abs(res[k] - expected) <= std::max(max_val / 256.0f, std::ldexp(1.0f, -25)));
+            }
+        }
+    }
+
+    int test_img_w, test_img_h;
+    const auto test_img = LoadTGA("test_data/complex_mat5/ref.tga", test_img_w, test_img_h);
+    require_return(!test_img.empty());
+
+    Ray::settings_t s = swrt_test_settings(test_img_w, test_img_h, preferred_device, g_validation_level);
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+
+    const int SampleCount = 32;
+    // accumulation is done in full precision, only denoiser inputs are quantized
+    const double MinPSNR = 40.0, MinAuxPSNR = 45.0;
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+        if ((Ray::RendererCPU & Ray::Bitmask<Ray::eRendererType>{rt}) != rt) {
+            // compact buffers are implemented for CPU backends only
+            continue;
+        }
+
+        std::vector<Ray::color_rgba_t> pixels[2], base_color[2], depth_normals[2];
+
+        for (const bool use_compact_buffers : {false, true}) {
+            s.use_compact_buffers = use_compact_buffers;
+
+            using namespace std::placeholders;
+            auto parallel_for =
+                std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+            auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+            if (!renderer || renderer->type() != rt) {
+                // skip unsupported (we fell back to some other renderer)
+                break;
+            }
+
+            auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+            setup_metal_test_scene(threads, *scene);
+
+            char name_buf[1024];
+            snprintf(name_buf, sizeof(name_buf), "Test %-25s", TestName);
+            schedule_render_jobs(threads, *renderer, scene.get(), s, SampleCount, eDenoiseMethod::NLM, false,
+                                 name_buf);
+
+            pixels[use_compact_buffers].resize(test_img_w * test_img_h);
+            renderer->GetPixels(pixels[use_compact_buffers].data(), test_img_w);
+            // output and auxiliary buffers are not kept in full precision in compact mode
+            require(!use_compact_buffers || !renderer->get_pixels_ref().ptr);
+            require(!use_compact_buffers || !renderer->get_raw_pixels_ref().ptr);
+            require(!use_compact_buffers || !renderer->get_aux_pixels_ref(Ray::eAUXBuffer::BaseColor).ptr);
+            base_color[use_compact_buffers].resize(test_img_w * test_img_h);
+            renderer->GetAUXPixels(Ray::eAUXBuffer::BaseColor, base_color[use_compact_buffers].data(), test_img_w);
+            depth_normals[use_compact_buffers].resize(test_img_w * test_img_h);
+            renderer->GetAUXPixels(Ray::eAUXBuffer::DepthNormals, depth_normals[use_compact_buffers].data(),
+                                   test_img_w);
+        }
+
+        if (pixels[0].empty() || pixels[1].empty()) {
+            continue;
+        }
+
+        // compare normals only (depth is out of [0, 1] range)
+        for (int i = 0; i < 2; ++i) {
+            for (Ray::color_rgba_t &p : depth_normals[i]) {
+                for (int k = 0; k < 3; ++k) {
+                    p.v[k] = 0.5f * p.v[k] + 0.5f;
+                }
+            }
+        }
+
+        const double psnr = calc_psnr(pixels[0], pixels[1]);
+        const double base_color_psnr = calc_psnr(base_color[0], base_color[1]);
+        const double normals_psnr = calc_psnr(depth_normals[0], depth_normals[1]);
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(PSNR: %.2f/%.2f dB)\n", psnr, MinPSNR);
+            printf("\tBase color/normals PSNR: %.2f/%.2f dB\n", base_color_psnr, normals_psnr);
+            fflush(stdout);
+        }
+
+        require(psnr >= MinPSNR);
+        require(base_color_psnr >= MinAuxPSNR);
+        require(normals_psnr >= MinAuxPSNR);
+    }
+}
@@ -0,0 +1,205 @@
+#include "test_common.h"
+
+#include <cmath>
+
+#include <sstream>
+
+#include "../Ray.h"
+#include "../internal/CompressedStream.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+namespace {
+// Extracts half buffer (used for variance estimation) from checkpoint, compact buffers are not handled
+std::vector<Ray::color_rgba_t> ReadHalfBuffer(std::istream &in, const int w, const int h) {
+    Ray::CompressedReader reader(in);
+
+    uint32_t header[6] = {};
+    if (!reader.Read(header, sizeof(header))) {
+        return {};
+    }
+    // skip regions, view transform, gamma and variance threshold
+    std::vector<uint8_t> params(header[5] * 7 * sizeof(int32_t) + 3 * sizeof(uint32_t));
+    std::vector<Ray::color_rgba_t> full(w * h), half(w * h);
+    if (!reader.Read(params.data(), params.size()) ||
+        !reader.Read(full.data(), full.size() * sizeof(Ray::color_rgba_t), sizeof(float)) ||
+        !reader.Read(half.data(), half.size() * sizeof(Ray::color_rgba_t), sizeof(float))) {
+        return {};
+    }
+    return half;
+}
+} // namespace
+
+void test_distributed(const char *arch_list[], const char *preferred_device) {
+    const char TestName[] = "distributed";
+
+    Ray::settings_t s = swrt_test_settings(128, 128, preferred_device, g_validation_level);
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+
+    const int SampleCount = 16, WorkersCount = 2;
+    // merging changes only rounding of accumulated values
+    const double MinPSNR = 60.0;
+
+    const int AdaptiveMinSamples = 4;
+    const float VarianceThreshold = 0.004f;
+    // class A samples (accumulated into half buffer) start from the third one
+    const int AdaptiveSamples[] = {0, 2, SampleCount};
+    const float MaxHalfError = 0.0001f;
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+        if ((Ray::RendererCPU & Ray::Bitmask<Ray::eRendererType>{rt}) != rt) {
+            // merging is implemented for CPU backends only
+            continue;
+        }
+
+        using namespace std::placeholders;
+        auto parallel_for =
+            std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+        auto create_renderer = [&]() {
+            auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+            if (renderer && renderer->type() != rt) {
+                // skip unsupported (we fell back to some other renderer)
+                renderer = {};
+            }
+            return renderer;
+        };
+
+        // Reference render
+        auto ref_renderer = create_renderer();
+        if (!ref_renderer) {
+            continue;
+        }
+        auto scene = std::unique_ptr<Ray::SceneBase>(ref_renderer->CreateScene());
+        setup_metal_test_scene(threads, *scene);
+
+        std::vector<Ray::RegionContext> ref_regions = split_into_regions(s.w, s.h);
+        parallel_for(0, int(ref_regions.size()), [&](const int i) {
+            for (int j = 0; j < SampleCount; ++j) {
+                ref_renderer->RenderScene(*scene, ref_regions[i]);
+            }
+        });
+
+        // Workers render either a range of samples or a subset of tiles
+        std::stringstream sample_results[WorkersCount], tile_results[WorkersCount];
+        for (int w = 0; w < WorkersCount; ++w) {
+            const int first_sample = (w * SampleCount) / WorkersCount,
+                      last_sample = ((w + 1) * SampleCount) / WorkersCount;
+
+            auto renderer = create_renderer();
+            std::vector<Ray::RegionContext> regions = split_into_regions(s.w, s.h, first_sample);
+            parallel_for(0, int(regions.size()), [&](const int i) {
+                for (int j = first_sample; j < last_sample; ++j) {
+                    renderer->RenderScene(*scene, regions[i]);
+                }
+            });
+            require(renderer->SaveCheckpoint(*scene, regions, sample_results[w]));
+
+            renderer = create_renderer();
+            regions = split_into_regions(s.w, s.h);
+            parallel_for(0, int(regions.size()), [&](const int i) {
+                if ((i % WorkersCount) != w) {
+                    return;
+                }
+                for (int j = 0; j < SampleCount; ++j) {
+                    renderer->RenderScene(*scene, regions[i]);
+                }
+            });
+            require(renderer->SaveCheckpoint(*scene, regions, tile_results[w]));
+        }
+
+        double psnr = 0.0;
+        float max_half_error = 0.0f;
+        { // Merge sample ranges (in reverse order)
+            auto renderer = create_renderer();
+            std::vector<Ray::RegionContext> regions = split_into_regions(s.w, s.h);
+            for (int w = WorkersCount - 1; w >= 0; --w) {
+                require(renderer->MergeCheckpoint(*scene, regions, sample_results[w]));
+            }
+            require(regions[0].base_iteration == 0 && regions[0].iteration == SampleCount);
+
+            { // Overlapping samples are rejected
+                sample_results[0].clear();
+                sample_results[0].seekg(0);
+                require(!renderer->MergeCheckpoint(*scene, regions, sample_results[0]));
+            }
+
+            psnr = calc_psnr(copy_pixels(renderer->get_raw_pixels_ref(), s.w, s.h),
+                             copy_pixels(ref_renderer->get_raw_pixels_ref(), s.w, s.h));
+            require(psnr >= MinPSNR);
+        }
+        { // Merge tiles
+            auto renderer = create_renderer();
+            std::vector<Ray::RegionContext> regions = split_into_regions(s.w, s.h);
+            for (int w = 0; w < WorkersCount; ++w) {
+                require(renderer->MergeCheckpoint(*scene, regions, tile_results[w]));
+            }
+            for (const Ray::RegionContext &region : regions) {
+                require(region.iteration == SampleCount);
+            }
+
+            // tiles are rendered with exactly the same samples
+            require(compare_images(renderer->get_raw_pixels_ref(), ref_renderer->get_raw_pixels_ref(), s.w, s.h));
+        }
+
+        { // Merge sample ranges rendered with adaptive sampling
+            auto adaptive_scene = std::unique_ptr<Ray::SceneBase>(ref_renderer->CreateScene());
+            setup_metal_test_scene(threads, *adaptive_scene, AdaptiveMinSamples, VarianceThreshold);
+
+            // first range contains no class A samples, so merged half buffer must match the one of second range
+            std::stringstream results[2];
+            for (int w = 0; w < 2; ++w) {
+                auto renderer = create_renderer();
+                std::vector<Ray::RegionContext> regions = split_into_regions(s.w, s.h, AdaptiveSamples[w]);
+                render_samples(threads, *renderer, *adaptive_scene, regions,
+                               AdaptiveSamples[w + 1] - AdaptiveSamples[w]);
+                require(renderer->SaveCheckpoint(*adaptive_scene, regions, results[w]));
+            }
+            const std::vector<Ray::color_rgba_t> expected_half = ReadHalfBuffer(results[1], s.w, s.h);
+            require(!expected_half.empty());
+
+            for (const bool reverse : {false, true}) {
+                auto renderer = create_renderer();
+                std::vector<Ray::RegionContext> regions = split_into_regions(s.w, s.h);
+                for (int i = 0; i < 2; ++i) {
+                    std::stringstream &result = results[reverse ? 1 - i : i];
+                    result.clear();
+                    result.seekg(0);
+                    require(renderer->MergeCheckpoint(*adaptive_scene, regions, result));
+                }
+                require(regions[0].base_iteration == 0 && regions[0].iteration == SampleCount);
+
+                std::stringstream merged;
+                require(renderer->SaveCheckpoint(*adaptive_scene, regions, merged));
+                const std::vector<Ray::color_rgba_t> half = ReadHalfBuffer(merged, s.w, s.h);
+                require(half.size() == expected_half.size());
+                for (size_t i = 0; i < half.size() && i < expected_half.size(); ++i) {
+                    for (int k = 0; k < 3; ++k) {
+                        max_half_error = std::max(
+                            max_half_error, std::abs(half[i].v[k] - expected_half[i].v[k]) /
+                                                std::max(std::abs(expected_half[i].v[k]), 1.0f));
+                    }
+                }
+            }
+            require(max_half_error < MaxHalfError);
+        }
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(PSNR: %.2f/%.2f dB)\n", psnr, MinPSNR);
+            printf("\tAdaptive half buffer error: %f/%f\n", max_half_error, MaxHalfError);
+            fflush(stdout);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+#include "test_common.h"
+
+#include <chrono>
+#include <future>
+#include <sstream>
+
+#include "../Ray.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+void test_nlm_simd(const char *arch_list[], const char *preferred_device) {
+    using namespace std::chrono;
+    using namespace std::placeholders;
+
+    const char TestName[] = "nlm_simd";
+
+    Ray::settings_t s = swrt_test_settings(256, 256, preferred_device, g_validation_level);
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+    auto parallel_for = std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+    const int SampleCount = 8;
+    const int TileSize = 64;
+    // only rounding differences are expected
+    const double MinPSNR = 50.0;
+
+    std::vector<Ray::RegionContext> regions;
+    for (int y = 0; y < s.h; y += TileSize) {
+        for (int x = 0; x < s.w; x += TileSize) {
+            regions.emplace_back(Ray::rect_t{x, y, std::min(s.w - x, TileSize), std::min(s.h - y, TileSize)});
+        }
+    }
+
+    // Noisy image is rendered once and shared between backends through checkpoint
+    std::stringstream checkpoint;
+    {
+        auto renderer = std::unique_ptr<Ray::RendererBase>(
+            Ray::CreateRenderer(s, &g_log_err, parallel_for, Ray::eRendererType::Reference));
+        auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+        setup_metal_test_scene(threads, *scene);
+
+        for (int i = 0; i < SampleCount; ++i) {
+            parallel_for(0, int(regions.size()), [&](const int j) { renderer->RenderScene(*scene, regions[j]); });
+        }
+        require_return(renderer->SaveCheckpoint(*scene, regions, checkpoint));
+    }
+
+    // Returns denoising time in milliseconds (or negative value if backend is not supported)
+    auto denoise = [&](const Ray::eRendererType rt, std::vector<Ray::color_rgba_t> &out_pixels) -> double {
+        auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+        if (!renderer || renderer->type() != rt) {
+            // skip unsupported (we fell back to some other renderer)
+            return -1.0;
+        }
+        auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+
+        std::vector<Ray::RegionContext> denoise_regions = regions;
+        checkpoint.clear();
+        checkpoint.seekg(0);
+        const bool loaded = renderer->LoadCheckpoint(*scene, denoise_regions, checkpoint);
+        require(loaded);
+        if (!loaded) {
+            return -1.0;
+        }
+
+        const auto t1 = high_resolution_clock::now();
+
+        std::vector<std::future<void>> job_res;
+        for (Ray::RegionContext &region : denoise_regions) {
+            job_res.push_back(threads.Enqueue([&renderer, &region]() { renderer->DenoiseImage(region); }));
+        }
+        for (auto &res : job_res) {
+            res.wait();
+        }
+
+        const double time_ms = duration<double, std::milli>(high_resolution_clock::now() - t1).count();
+
+        out_pixels = copy_pixels(renderer->get_pixels_ref(), s.w, s.h);
+
+        return time_ms;
+    };
+
+    std::vector<Ray::color_rgba_t> ref_pixels;
+    const double ref_time_ms = denoise(Ray::eRendererType::Reference, ref_pixels);
+    if (ref_time_ms < 0.0) {
+        return;
+    }
+
+    const double megapixels = double(s.w) * s.h / 1000000.0;
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+        if ((Ray::RendererCPU & Ray::Bitmask<Ray::eRendererType>{rt}) != rt || rt == Ray::eRendererType::Reference) {
+            // SIMD denoiser is compared against reference implementation
+            continue;
+        }
+
+        std::vector<Ray::color_rgba_t> pixels;
+        const double time_ms = denoise(rt, pixels);
+        if (time_ms < 0.0) {
+            continue;
+        }
+
+        const double psnr = calc_psnr(pixels, ref_pixels);
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(PSNR: %.2f/%.2f dB)\n", psnr, MinPSNR);
+            printf("\tNLM denoise REF/%s (ms per megapixel): %.1f/%.1f\n", Ray::RendererTypeName(rt),
+                   ref_time_ms / megapixels, time_ms / megapixels);
+            fflush(stdout);
+        }
+
+        require(psnr >= MinPSNR);
+    }
+}
@@ -0,0 +1,105 @@
+#include "test_common.h"
+
+#include <chrono>
+
+#include "../Ray.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+void test_packet_traversal(const char *arch_list[], const char *preferred_device) {
+    using namespace std::chrono;
+
+    const char TestName[] = "packet_traversal";
+
+    int test_img_w, test_img_h;
+    const auto test_img = LoadTGA("test_data/complex_mat5/ref.tga", test_img_w, test_img_h);
+    require_return(!test_img.empty());
+
+    Ray::settings_t s = swrt_test_settings(test_img_w, test_img_h, preferred_device, g_validation_level);
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+
+    const int SampleCount = 16;
+    // only traversal order differs, hit results must be the same
+    const double MinPSNR = 45.0;
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+        if ((Ray::RendererCPU & Ray::Bitmask<Ray::eRendererType>{rt}) != rt || rt == Ray::eRendererType::Reference) {
+            // packet traversal is implemented for SIMD CPU backends only
+            continue;
+        }
+
+        std::vector<Ray::color_rgba_t> pixels[2];
+        Ray::RendererBase::stats_t stats[2] = {};
+
+        for (const bool use_packet_traversal : {false, true}) {
+            s.use_packet_traversal = use_packet_traversal;
+
+            using namespace std::placeholders;
+            auto parallel_for =
+                std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+            auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+            if (!renderer || renderer->type() != rt) {
+                // skip unsupported (we fell back to some other renderer)
+                break;
+            }
+
+            auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+            setup_metal_test_scene(threads, *scene);
+
+            char name_buf[1024];
+            snprintf(name_buf, sizeof(name_buf), "Test %-25s", TestName);
+
+            renderer->ResetStats();
+            schedule_render_jobs(threads, *renderer, scene.get(), s, SampleCount, eDenoiseMethod::None, false,
+                                 name_buf);
+            renderer->GetStats(stats[use_packet_traversal]);
+
+            pixels[use_packet_traversal] = copy_pixels(renderer->get_pixels_ref(), test_img_w, test_img_h);
+        }
+
+        if (pixels[0].empty() || pixels[1].empty()) {
+            continue;
+        }
+
+        const double psnr = calc_psnr(pixels[0], pixels[1]);
+
+        // trace time is accumulated across all threads, so these are single-thread rates
+        auto mrays_per_sec = [](const unsigned long long rays, const unsigned long long time_us) {
+            return double(rays) / double(std::max(time_us, 1ull));
+        };
+
+        const double primary_mrays[2] = {
+            mrays_per_sec(1ull * test_img_w * test_img_h * SampleCount, stats[0].time_primary_trace_us),
+            mrays_per_sec(1ull * test_img_w * test_img_h * SampleCount, stats[1].time_primary_trace_us)};
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(PSNR: %.2f/%.2f dB)\n", psnr, MinPSNR);
+            printf("\tPrimary trace single/auto: %.2f/%.2f Mrays/s\n", primary_mrays[0], primary_mrays[1]);
+            for (int i = 0; i < 2; ++i) {
+                const Ray::RendererBase::stats_t &st = stats[i];
+                printf("\tSecondary trace (%s): single %.2f Mrays (%.2f Mrays/s), packet %.2f Mrays (%.2f Mrays/s)\n",
+                       i ? "auto" : "single", double(st.secondary_rays_single) / 1000000.0,
+                       mrays_per_sec(st.secondary_rays_single, st.time_secondary_trace_single_us),
+                       double(st.secondary_rays_packet) / 1000000.0,
+                       mrays_per_sec(st.secondary_rays_packet, st.time_secondary_trace_packet_us));
+            }
+            fflush(stdout);
+        }
+
+        require(stats[0].secondary_rays_packet == 0);
+        require(psnr >= MinPSNR);
+    }
+}
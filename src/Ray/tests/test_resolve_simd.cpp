@@ -0,0 +1,111 @@
+#include "test_common.h"
+
+#include <cmath>
+
+#include <sstream>
+
+#include "../Ray.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+void test_resolve_simd(const char *arch_list[], const char *preferred_device) {
+    using namespace std::placeholders;
+
+    const char TestName[] = "resolve_simd";
+
+    Ray::settings_t s = swrt_test_settings(128, 128, preferred_device, g_validation_level);
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+    auto parallel_for = std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+    const int SampleCount = 4;
+    const int TileSize = 32;
+
+    const struct {
+        Ray::eViewTransform view_transform;
+        float gamma;
+    } configs[] = {{Ray::eViewTransform::Standard, 1.0f},
+                   {Ray::eViewTransform::AgX, 2.2f},
+                   {Ray::eViewTransform::Filmic_HighContrast, 1.0f}};
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+        if ((Ray::RendererCPU & Ray::Bitmask<Ray::eRendererType>{rt}) != rt) {
+            // resolve pass is implemented for CPU backends only
+            continue;
+        }
+
+        float max_diff = 0.0f;
+
+        int config_index = 0;
+        for (; config_index < int(sizeof(configs) / sizeof(configs[0])); ++config_index) {
+            auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+            if (!renderer || renderer->type() != rt) {
+                // skip unsupported (we fell back to some other renderer)
+                break;
+            }
+
+            auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+            setup_metal_test_scene(threads, *scene);
+
+            Ray::camera_desc_t cam_desc;
+            scene->GetCamera(scene->current_cam(), cam_desc);
+            cam_desc.view_transform = configs[config_index].view_transform;
+            cam_desc.gamma = configs[config_index].gamma;
+            scene->SetCamera(scene->current_cam(), cam_desc);
+
+            std::vector<Ray::RegionContext> regions;
+            for (int y = 0; y < s.h; y += TileSize) {
+                for (int x = 0; x < s.w; x += TileSize) {
+                    regions.emplace_back(Ray::rect_t{x, y, std::min(s.w - x, TileSize), std::min(s.h - y, TileSize)});
+                }
+            }
+            for (int i = 0; i < SampleCount; ++i) {
+                parallel_for(0, int(regions.size()),
+                             [&](const int j) { renderer->RenderScene(*scene, regions[j]); });
+            }
+
+            // Loaded checkpoint is tonemapped from scratch with scalar code
+            std::stringstream checkpoint;
+            require_return(renderer->SaveCheckpoint(*scene, regions, checkpoint));
+
+            auto loaded_renderer =
+                std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+            auto loaded_scene = std::unique_ptr<Ray::SceneBase>(loaded_renderer->CreateScene());
+            const bool loaded = loaded_renderer->LoadCheckpoint(*loaded_scene, regions, checkpoint);
+            require_return(loaded);
+
+            const Ray::color_data_rgba_t pixels = renderer->get_pixels_ref(),
+                                         ref_pixels = loaded_renderer->get_pixels_ref();
+            for (int y = 0; y < s.h; ++y) {
+                for (int x = 0; x < s.w; ++x) {
+                    for (int k = 0; k < 4; ++k) {
+                        max_diff = std::max(max_diff, std::abs(pixels.ptr[y * pixels.pitch + x].v[k] -
+                                                               ref_pixels.ptr[y * ref_pixels.pitch + x].v[k]));
+                    }
+                }
+            }
+        }
+        if (config_index != int(sizeof(configs) / sizeof(configs[0]))) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(max difference: %f)\n", max_diff);
+            fflush(stdout);
+        }
+
+        // only rounding differences are expected
+        require(max_diff < 0.0001f);
+    }
+}
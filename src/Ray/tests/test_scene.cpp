@@ -1,5 +1,6 @@
 #include "test_scene.h"
 
+#include <cmath>
 #include <cstring>
 
 #include "test_common.h"
@@ -1188,3 +1189,94 @@ void schedule_render_jobs(ThreadPool &threads, Ray::RendererBase &renderer, cons
         }
     }
 }
+
+Ray::settings_t swrt_test_settings(const int w, const int h, const char *preferred_device,
+                                   const int validation_level) {
+    Ray::settings_t s;
+    s.w = w;
+    s.h = h;
+    s.preferred_device = preferred_device;
+    s.validation_level = validation_level;
+    s.use_hwrt = false;
+    return s;
+}
+
+void setup_metal_test_scene(ThreadPool &threads, Ray::SceneBase &scene, const int min_samples,
+                            const float variance_threshold) {
+    Ray::principled_mat_desc_t metal_mat_desc;
+    metal_mat_desc.base_texture = Ray::TextureHandle{0};
+    metal_mat_desc.roughness = 1.0f;
+    metal_mat_desc.roughness_texture = Ray::TextureHandle{2};
+    metal_mat_desc.metallic = 1.0f;
+    metal_mat_desc.metallic_texture = Ray::TextureHandle{3};
+    metal_mat_desc.normal_map = Ray::TextureHandle{1};
+
+    const char *textures[] = {
+        "test_data/textures/gold-scuffed_basecolor-boosted.tga", "test_data/textures/gold-scuffed_normal.tga",
+        "test_data/textures/gold-scuffed_roughness.tga", "test_data/textures/gold-scuffed_metallic.tga"};
+
+    setup_test_scene(threads, scene, min_samples, variance_threshold, metal_mat_desc, textures, eTestScene::Standard);
+}
+
+std::vector<Ray::RegionContext> split_into_regions(const int w, const int h, const int first_sample) {
+    static const int BucketSize = 16;
+
+    std::vector<Ray::RegionContext> regions;
+    for (int y = 0; y < h; y += BucketSize) {
+        for (int x = 0; x < w; x += BucketSize) {
+            regions.emplace_back(Ray::rect_t{x, y, std::min(w - x, BucketSize), std::min(h - y, BucketSize)},
+                                 first_sample);
+        }
+    }
+    return regions;
+}
+
+void render_samples(ThreadPool &threads, Ray::RendererBase &renderer, const Ray::SceneBase &scene,
+                    std::vector<Ray::RegionContext> &regions, const int sample_count) {
+    using namespace std::placeholders;
+    auto parallel_for = std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+    for (int i = 0; i < sample_count; ++i) {
+        if (renderer.is_spatial_caching_enabled()) {
+            parallel_for(0, int(regions.size()), [&](const int j) { renderer.UpdateSpatialCache(scene, regions[j]); });
+            renderer.ResolveSpatialCache(scene, parallel_for);
+        }
+        parallel_for(0, int(regions.size()), [&](const int j) { renderer.RenderScene(scene, regions[j]); });
+    }
+}
+
+std::vector<Ray::color_rgba_t> copy_pixels(const Ray::color_data_rgba_t &data, const int w, const int h) {
+    std::vector<Ray::color_rgba_t> out;
+    out.reserve(size_t(w) * h);
+    for (int j = 0; j < h; ++j) {
+        out.insert(out.end(), data.ptr + j * data.pitch, data.ptr + j * data.pitch + w);
+    }
+    return out;
+}
+
+double calc_psnr(const std::vector<Ray::color_rgba_t> &img1, const std::vector<Ray::color_rgba_t> &img2) {
+    require(img1.size() == img2.size());
+
+    double mse = 0.0;
+    for (size_t i = 0; i < img1.size(); ++i) {
+        for (int k = 0; k < 3; ++k) {
+            const float v1 = std::min(std::max(img1[i].v[k], 0.0f), 1.0f);
+            const float v2 = std::min(std::max(img2[i].v[k], 0.0f), 1.0f);
+            const int diff = std::abs(int(v1 * 255) - int(v2 * 255));
+            mse += diff * diff;
+        }
+    }
+    mse /= 3.0 * double(img1.size());
+
+    const double psnr = mse > 0.0 ? -10.0 * std::log10(mse / (255.0 * 255.0)) : 100.0;
+    return std::floor(psnr * 100.0) / 100.0;
+}
+
+bool compare_images(const Ray::color_data_rgba_t &img1, const Ray::color_data_rgba_t &img2, const int w, const int h) {
+    for (int y = 0; y < h; ++y) {
+        if (memcmp(img1.ptr + y * img1.pitch, img2.ptr + y * img2.pitch, w * sizeof(Ray::color_rgba_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
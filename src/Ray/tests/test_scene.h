@@ -5,8 +5,10 @@
 
 #include <atomic>
 #include <mutex>
+#include <vector>
 
 #include "../Log.h"
+#include "../Types.h"
 
 enum class eTestScene {
     Standard,
@@ -33,6 +35,7 @@ enum class eDenoiseMethod { None, NLM, UNet };
 class ThreadPool;
 
 namespace Ray {
+class RegionContext;
 class RendererBase;
 class SceneBase;
 
@@ -80,4 +83,18 @@ void setup_test_scene(ThreadPool &threads, Ray::SceneBase &scene, int min_sample
 
 void schedule_render_jobs(ThreadPool &threads, Ray::RendererBase &renderer, const Ray::SceneBase *scene,
                           const Ray::settings_t &settings, int max_samples, eDenoiseMethod denoise, bool partial,
-                          const char *log_str);
\ No newline at end of file
+                          const char *log_str);
+
+// Helpers for tests that compare two renderer configurations on the standard scene
+Ray::settings_t swrt_test_settings(int w, int h, const char *preferred_device, int validation_level);
+void setup_metal_test_scene(ThreadPool &threads, Ray::SceneBase &scene, int min_samples = -1,
+                            float variance_threshold = 0.0f);
+
+std::vector<Ray::RegionContext> split_into_regions(int w, int h, int first_sample = 0);
+void render_samples(ThreadPool &threads, Ray::RendererBase &renderer, const Ray::SceneBase &scene,
+                    std::vector<Ray::RegionContext> &regions, int sample_count);
+
+std::vector<Ray::color_rgba_t> copy_pixels(const Ray::color_data_rgba_t &data, int w, int h);
+// PSNR of LDR-clamped 8-bit values (rounded down to 0.01 dB, 100 for identical images)
+double calc_psnr(const std::vector<Ray::color_rgba_t> &img1, const std::vector<Ray::color_rgba_t> &img2);
+bool compare_images(const Ray::color_data_rgba_t &img1, const Ray::color_data_rgba_t &img2, int w, int h);
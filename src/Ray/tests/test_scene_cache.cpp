@@ -0,0 +1,236 @@
+#include "test_common.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include "../Ray.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+namespace {
+const char CacheFileName[] = "test_data/scene_cache.bin";
+
+struct scene_inputs_t {
+    std::vector<float> base_attrs, model_attrs;
+    std::vector<uint32_t> base_indices, base_groups, model_indices, model_groups;
+    std::vector<uint8_t> env_data;
+    Ray::principled_mat_desc_t base_mat_desc, model_mat_desc;
+    Ray::mesh_desc_t base_mesh_desc, model_mesh_desc;
+    Ray::sphere_light_desc_t light_desc;
+    uint64_t hash = 0;
+};
+
+void LoadInputs(scene_inputs_t &in) {
+    std::tie(in.base_attrs, in.base_indices, in.base_groups) = LoadBIN("test_data/meshes/mat_test/base.bin");
+    std::tie(in.model_attrs, in.model_indices, in.model_groups) = LoadBIN("test_data/meshes/mat_test/model.bin");
+    require(!in.base_indices.empty() && !in.model_indices.empty());
+
+    // small procedural environment map (RGBE-encoded)
+    const int EnvRes = 64;
+    in.env_data.resize(EnvRes * EnvRes * 4);
+    for (int y = 0; y < EnvRes; ++y) {
+        for (int x = 0; x < EnvRes; ++x) {
+            uint8_t *px = &in.env_data[4 * (y * EnvRes + x)];
+            px[0] = uint8_t(255 - 2 * y);
+            px[1] = uint8_t(128 + y);
+            px[2] = uint8_t(4 * x);
+            px[3] = uint8_t(x < 8 && y < 8 ? 136 : 128);
+        }
+    }
+
+    in.base_mat_desc.base_color[0] = in.base_mat_desc.base_color[1] = in.base_mat_desc.base_color[2] = 0.5f;
+    in.base_mat_desc.roughness = 0.3f;
+
+    in.model_mat_desc.base_color[0] = 0.9f;
+    in.model_mat_desc.base_color[1] = in.model_mat_desc.base_color[2] = 0.2f;
+    in.model_mat_desc.metallic = 1.0f;
+    in.model_mat_desc.roughness = 0.2f;
+
+    in.base_mesh_desc.prim_type = in.model_mesh_desc.prim_type = Ray::ePrimType::TriangleList;
+    in.base_mesh_desc.vtx_positions = {in.base_attrs, 0, 8};
+    in.base_mesh_desc.vtx_normals = {in.base_attrs, 3, 8};
+    in.base_mesh_desc.vtx_uvs = {in.base_attrs, 6, 8};
+    in.base_mesh_desc.vtx_indices = in.base_indices;
+    in.model_mesh_desc.vtx_positions = {in.model_attrs, 0, 8};
+    in.model_mesh_desc.vtx_normals = {in.model_attrs, 3, 8};
+    in.model_mesh_desc.vtx_uvs = {in.model_attrs, 6, 8};
+    in.model_mesh_desc.vtx_indices = in.model_indices;
+
+    in.light_desc.color[0] = in.light_desc.color[1] = in.light_desc.color[2] = 5.0f;
+    in.light_desc.position[0] = -0.1f;
+    in.light_desc.position[1] = 0.3f;
+    in.light_desc.position[2] = 0.1f;
+    in.light_desc.radius = 0.05f;
+
+    // material handles referenced by mesh groups are assigned in order, so hashing descriptions is enough
+    in.hash = Ray::HashInputs(in.base_mat_desc);
+    in.hash = Ray::HashInputs(in.model_mat_desc, in.hash);
+    in.hash = Ray::HashInputs(in.base_mesh_desc, in.hash);
+    in.hash = Ray::HashInputs(in.model_mesh_desc, in.hash);
+    const float light_params[] = {in.light_desc.color[0],    in.light_desc.color[1],    in.light_desc.color[2],
+                                  in.light_desc.position[0], in.light_desc.position[1], in.light_desc.position[2],
+                                  in.light_desc.radius};
+    in.hash = Ray::HashInputs(Ray::Span<const uint8_t>((const uint8_t *)light_params, sizeof(light_params)), in.hash);
+}
+
+// Textures and cameras are not a part of the cache
+void SetupNonCachedState(const scene_inputs_t &in, Ray::SceneBase &scene, Ray::TextureHandle &env_tex) {
+    Ray::tex_desc_t tex_desc;
+    tex_desc.format = Ray::eTextureFormat::RGBA8888;
+    tex_desc.data = in.env_data;
+    tex_desc.w = tex_desc.h = 64;
+    tex_desc.generate_mipmaps = false;
+    tex_desc.is_srgb = false;
+    tex_desc.force_no_compression = true;
+    env_tex = scene.AddTexture(tex_desc);
+
+    Ray::camera_desc_t cam_desc;
+    cam_desc.filter = Ray::ePixelFilter::Box;
+    const float view_origin[] = {0.16149f, 0.294997f, 0.332965f};
+    const float view_dir[] = {-0.364128768f, -0.555621922f, -0.747458696f};
+    const float view_up[] = {0.0f, 1.0f, 0.0f};
+    memcpy(cam_desc.origin, view_origin, 3 * sizeof(float));
+    memcpy(cam_desc.fwd, view_dir, 3 * sizeof(float));
+    memcpy(cam_desc.up, view_up, 3 * sizeof(float));
+    cam_desc.fov = 18.1806f;
+
+    scene.set_current_cam(scene.AddCamera(cam_desc));
+}
+
+Ray::MeshHandle BuildScene(ThreadPool &threads, const scene_inputs_t &in, Ray::SceneBase &scene,
+                           const Ray::TextureHandle env_tex) {
+    using namespace std::placeholders;
+    auto parallel_for = std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+    const Ray::MaterialHandle base_mat = scene.AddMaterial(in.base_mat_desc);
+    const Ray::MaterialHandle model_mat = scene.AddMaterial(in.model_mat_desc);
+
+    Ray::mesh_desc_t base_mesh_desc = in.base_mesh_desc, model_mesh_desc = in.model_mesh_desc;
+    const Ray::mat_group_desc_t base_groups[] = {{base_mat, in.base_groups[0], in.base_groups[1]}};
+    base_mesh_desc.groups = base_groups;
+    const Ray::mat_group_desc_t model_groups[] = {{model_mat, in.model_groups[0], in.model_groups[1]}};
+    model_mesh_desc.groups = model_groups;
+
+    const Ray::MeshHandle base_mesh = scene.AddMesh(base_mesh_desc, parallel_for);
+    const Ray::MeshHandle model_mesh = scene.AddMesh(model_mesh_desc, parallel_for);
+
+    static const float identity[16] = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+                                       0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+    scene.AddMeshInstance(base_mesh, identity);
+    scene.AddMeshInstance(model_mesh, identity);
+
+    scene.AddLight(in.light_desc);
+
+    Ray::environment_desc_t env_desc;
+    env_desc.env_col[0] = env_desc.env_col[1] = env_desc.env_col[2] = 0.5f;
+    env_desc.back_col[0] = env_desc.back_col[1] = env_desc.back_col[2] = 0.5f;
+    env_desc.env_map = env_desc.back_map = env_tex;
+    scene.SetEnvironment(env_desc);
+
+    scene.Finalize(parallel_for);
+
+    return model_mesh;
+}
+
+void Render(ThreadPool &threads, Ray::RendererBase &renderer, const Ray::SceneBase &scene, const int w, const int h,
+            const int sample_count) {
+    std::vector<Ray::RegionContext> regions = split_into_regions(w, h);
+
+    renderer.Clear({0.0f, 0.0f, 0.0f, 0.0f});
+    render_samples(threads, renderer, scene, regions, sample_count);
+}
+} // namespace
+
+void test_scene_cache(const char *arch_list[], const char *preferred_device) {
+    const char TestName[] = "scene_cache";
+
+    Ray::settings_t s;
+    s.w = 64;
+    s.h = 64;
+    s.preferred_device = preferred_device;
+    s.validation_level = g_validation_level;
+    s.use_hwrt = false;
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+
+    const int SampleCount = 4;
+
+    scene_inputs_t inputs;
+    LoadInputs(inputs);
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+        if ((Ray::RendererCPU & Ray::Bitmask<Ray::eRendererType>{rt}) != rt) {
+            // scene cache is implemented for CPU backends only
+            continue;
+        }
+
+        using namespace std::placeholders;
+        auto parallel_for =
+            std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+        auto ref_renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+        if (!ref_renderer || ref_renderer->type() != rt) {
+            // skip unsupported (we fell back to some other renderer)
+            continue;
+        }
+        auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+
+        remove(CacheFileName);
+
+        // First run builds the scene and writes the cache
+        auto ref_scene = std::unique_ptr<Ray::SceneBase>(ref_renderer->CreateScene());
+        Ray::TextureHandle env_tex;
+        SetupNonCachedState(inputs, *ref_scene, env_tex);
+        require(!ref_scene->LoadCache(CacheFileName, inputs.hash));
+        const Ray::MeshHandle model_mesh = BuildScene(threads, inputs, *ref_scene, env_tex);
+        const bool saved = ref_scene->SaveCache(CacheFileName, inputs.hash);
+        require_return(saved);
+
+        // Subsequent runs load it instead of building
+        auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+        SetupNonCachedState(inputs, *scene, env_tex);
+        require(!scene->LoadCache(CacheFileName, inputs.hash + 1));
+        const bool loaded = scene->LoadCache(CacheFileName, inputs.hash);
+        require_return(loaded);
+        require(scene->triangle_count() == ref_scene->triangle_count());
+        require(scene->node_count() == ref_scene->node_count());
+        // Only empty scene can be loaded
+        require(!scene->LoadCache(CacheFileName, inputs.hash));
+
+        // Result must be exactly the same
+        Render(threads, *ref_renderer, *ref_scene, s.w, s.h, SampleCount);
+        Render(threads, *renderer, *scene, s.w, s.h, SampleCount);
+        require(compare_images(renderer->get_raw_pixels_ref(), ref_renderer->get_raw_pixels_ref(), s.w, s.h));
+
+        // Loaded scene stays editable (handles are preserved, mapped storages are copied on growth)
+        static const float xform[16] = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+                                        0.0f, 0.0f, 1.0f, 0.0f, -0.1f, 0.0f, 0.05f, 1.0f};
+        for (Ray::SceneBase *sc : {ref_scene.get(), scene.get()}) {
+            sc->AddMeshInstance(model_mesh, xform);
+            sc->Finalize(parallel_for);
+        }
+        Render(threads, *ref_renderer, *ref_scene, s.w, s.h, SampleCount);
+        Render(threads, *renderer, *scene, s.w, s.h, SampleCount);
+        require(compare_images(renderer->get_raw_pixels_ref(), ref_renderer->get_raw_pixels_ref(), s.w, s.h));
+
+        // Scene must be destroyed before the file can be removed on some platforms
+        scene = {};
+        remove(CacheFileName);
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(OK)\n");
+            fflush(stdout);
+        }
+    }
+}
@@ -236,6 +236,30 @@ using namespace Ray::NS;
     require(v20[2] == Approx(-9));
     require(v20[3] == Approx(-11));
 
+    const uint16_t bf16_bits[4] = {0x3f80, 0xc000, 0x4040, 0x3f00};
+    const fvec4 v21 = load_bf16<4>(bf16_bits);
+
+    require(v21[0] == 1.0f);
+    require(v21[1] == -2.0f);
+    require(v21[2] == 3.0f);
+    require(v21[3] == 0.5f);
+
+    const uint16_t f16_bits[4] = {0x3c00, 0xc000, 0x0001, 0x7c00};
+    const fvec4 v22 = load_f16<4>(f16_bits);
+
+    require(v22[0] == 1.0f);
+    require(v22[1] == -2.0f);
+    require(v22[2] == 5.9604645e-08f);
+    require(v22[3] == INFINITY);
+
+    const int8_t i8_vals[4] = {1, -2, 127, -128};
+    const fvec4 v23 = load_i8<4>(i8_vals);
+
+    require(v23[0] == 1.0f);
+    require(v23[1] == -2.0f);
+    require(v23[2] == 127.0f);
+    require(v23[3] == -128.0f);
+
     printf("OK\n");
 }
 
@@ -937,6 +961,42 @@ using namespace Ray::NS;
     require(v20[6] == Approx(-15));
     require(v20[7] == Approx(-3));
 
+    const uint16_t bf16_bits[8] = {0x3f80, 0xc000, 0x4040, 0x3f00, 0x4100, 0xbe80, 0x4480, 0x0000};
+    const fvec8 v21 = load_bf16<8>(bf16_bits);
+
+    require(v21[0] == 1.0f);
+    require(v21[1] == -2.0f);
+    require(v21[2] == 3.0f);
+    require(v21[3] == 0.5f);
+    require(v21[4] == 8.0f);
+    require(v21[5] == -0.25f);
+    require(v21[6] == 1024.0f);
+    require(v21[7] == 0.0f);
+
+    const uint16_t f16_bits[8] = {0x3c00, 0xc000, 0x4200, 0x3800, 0x7bff, 0x8000, 0x0001, 0x7c00};
+    const fvec8 v22 = load_f16<8>(f16_bits);
+
+    require(v22[0] == 1.0f);
+    require(v22[1] == -2.0f);
+    require(v22[2] == 3.0f);
+    require(v22[3] == 0.5f);
+    require(v22[4] == 65504.0f);
+    require(v22[5] == 0.0f);
+    require(v22[6] == 5.9604645e-08f);
+    require(v22[7] == INFINITY);
+
+    const int8_t i8_vals[8] = {1, -2, 127, -128, 0, 5, -7, 64};
+    const fvec8 v23 = load_i8<8>(i8_vals);
+
+    require(v23[0] == 1.0f);
+    require(v23[1] == -2.0f);
+    require(v23[2] == 127.0f);
+    require(v23[3] == -128.0f);
+    require(v23[4] == 0.0f);
+    require(v23[5] == 5.0f);
+    require(v23[6] == -7.0f);
+    require(v23[7] == 64.0f);
+
     printf("OK\n");
 }
 
@@ -1940,6 +2000,56 @@ using namespace Ray::NS;
     require(v20[14] == Approx(-15));
     require(v20[15] == Approx(-3));
 
+    const uint16_t bf16_bits[16] = {0x3f80, 0xc000, 0x4040, 0x3f00, 0x4100, 0xbe80, 0x4480, 0x0000,
+                                    0x3f80, 0xc000, 0x4040, 0x3f00, 0x4100, 0xbe80, 0x4480, 0x0000};
+    const fvec16 v21 = load_bf16<16>(bf16_bits);
+
+    require(v21[0] == 1.0f);
+    require(v21[1] == -2.0f);
+    require(v21[2] == 3.0f);
+    require(v21[3] == 0.5f);
+    require(v21[4] == 8.0f);
+    require(v21[5] == -0.25f);
+    require(v21[6] == 1024.0f);
+    require(v21[7] == 0.0f);
+    require(v21[8] == 1.0f);
+    require(v21[9] == -2.0f);
+    require(v21[10] == 3.0f);
+    require(v21[11] == 0.5f);
+    require(v21[12] == 8.0f);
+    require(v21[13] == -0.25f);
+    require(v21[14] == 1024.0f);
+    require(v21[15] == 0.0f);
+
+    const uint16_t f16_bits[16] = {0x3c00, 0xc000, 0x4200, 0x3800, 0x7bff, 0x8000, 0x0001, 0x7c00,
+                                   0x3c00, 0xc000, 0x4200, 0x3800, 0x7bff, 0x8000, 0x0001, 0x7c00};
+    const fvec16 v22 = load_f16<16>(f16_bits);
+
+    for (int i = 0; i < 16; i += 8) {
+        require(v22[i + 0] == 1.0f);
+        require(v22[i + 1] == -2.0f);
+        require(v22[i + 2] == 3.0f);
+        require(v22[i + 3] == 0.5f);
+        require(v22[i + 4] == 65504.0f);
+        require(v22[i + 5] == 0.0f);
+        require(v22[i + 6] == 5.9604645e-08f);
+        require(v22[i + 7] == INFINITY);
+    }
+
+    const int8_t i8_vals[16] = {1, -2, 127, -128, 0, 5, -7, 64, 1, -2, 127, -128, 0, 5, -7, 64};
+    const fvec16 v23 = load_i8<16>(i8_vals);
+
+    for (int i = 0; i < 16; i += 8) {
+        require(v23[i + 0] == 1.0f);
+        require(v23[i + 1] == -2.0f);
+        require(v23[i + 2] == 127.0f);
+        require(v23[i + 3] == -128.0f);
+        require(v23[i + 4] == 0.0f);
+        require(v23[i + 5] == 5.0f);
+        require(v23[i + 6] == -7.0f);
+        require(v23[i + 7] == 64.0f);
+    }
+
     printf("OK\n");
 }
 
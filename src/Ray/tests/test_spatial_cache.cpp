@@ -0,0 +1,256 @@
+#include "test_common.h"
+
+#include <cstring>
+
+#include <map>
+#include <vector>
+
+#include "../internal/RadCacheRef.h"
+#include "thread_pool.h"
+
+namespace {
+std::map<uint64_t, Ray::packed_cache_voxel_t> CollectVoxels(const std::vector<uint64_t> &entries,
+                                                            const std::vector<Ray::packed_cache_voxel_t> &voxels) {
+    std::map<uint64_t, Ray::packed_cache_voxel_t> ret;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i] != Ray::HASH_GRID_INVALID_HASH_KEY) {
+            ret[entries[i]] = voxels[i];
+        }
+    }
+    return ret;
+}
+
+struct cache_state_t {
+    std::vector<uint64_t> entries;
+    std::vector<Ray::packed_cache_voxel_t> voxels_curr, voxels_prev;
+};
+
+// Runs both resolve passes, blocks of each pass are processed in given order (or concurrently if pool is provided)
+void ResolveBlocks(const Ray::cache_grid_params_t &params, cache_state_t &cache, const std::vector<int> &blocks_order,
+                   const int block_size, ThreadPool *threads) {
+    for (int pass = 0; pass < 2; ++pass) {
+        auto resolve_block = [&, pass](const int block) {
+            if (pass == 0) {
+                Ray::Ref::SpatialCacheResolve(params, cache.entries, cache.voxels_curr, cache.voxels_prev,
+                                              block * block_size, block_size);
+            } else {
+                Ray::Ref::SpatialCacheCompact(cache.entries, cache.voxels_curr, cache.voxels_prev, block * block_size,
+                                              block_size);
+            }
+        };
+
+        if (threads) {
+            std::vector<std::future<void>> futures;
+            for (const int block : blocks_order) {
+                futures.push_back(threads->Enqueue(resolve_block, block));
+            }
+            for (auto &f : futures) {
+                f.wait();
+            }
+        } else {
+            for (const int block : blocks_order) {
+                resolve_block(block);
+            }
+        }
+    }
+}
+
+bool EqualVoxels(const std::vector<Ray::packed_cache_voxel_t> &lhs, const std::vector<Ray::packed_cache_voxel_t> &rhs) {
+    return lhs.size() == rhs.size() && memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(lhs[0])) == 0;
+}
+} // namespace
+
+void test_spatial_cache() {
+    using namespace Ray;
+
+    printf("Test spatial_cache      | ");
+
+    cache_grid_params_t params;
+    params.cam_pos_curr[2] = params.cam_pos_prev[2] = -10.0f;
+
+    { // Full bucket does not alias other entries
+        std::vector<uint64_t> entries(HASH_GRID_HASH_MAP_BUCKET_SIZE, HASH_GRID_INVALID_HASH_KEY);
+
+        const Ref::fvec4 N = {0.0f, 0.0f, -1.0f, 0.0f};
+        for (int i = 0; i < int(HASH_GRID_HASH_MAP_BUCKET_SIZE) + 8; ++i) {
+            const Ref::fvec4 P = {10.0f * float(i), 0.0f, 0.0f, 0.0f};
+            const uint32_t cache_entry = Ref::insert_entry(entries, P, N, params);
+            if (i < int(HASH_GRID_HASH_MAP_BUCKET_SIZE)) {
+                require(cache_entry == uint32_t(i));
+                // repeated insertion returns the same entry
+                require(Ref::insert_entry(entries, P, N, params) == cache_entry);
+            } else {
+                require(cache_entry == HASH_GRID_INVALID_CACHE_ENTRY);
+            }
+        }
+    }
+
+    const int ImgW = 256, ImgH = 256;
+    const int CacheW = ImgW / RAD_CACHE_DOWNSAMPLING_FACTOR, CacheH = ImgH / RAD_CACHE_DOWNSAMPLING_FACTOR;
+    const int EntriesCount = 65536, BlockSize = 4096;
+
+    std::vector<Ref::ray_data_t> rays(CacheW * CacheH);
+    std::vector<Ref::hit_data_t> inters(CacheW * CacheH);
+    std::vector<color_rgba_t> radiance(ImgW * ImgH), depth_normals(ImgW * ImgH);
+
+    for (int y = 0; y < CacheH; ++y) {
+        for (int x = 0; x < CacheW; ++x) {
+            Ref::ray_data_t &r = rays[y * CacheW + x];
+            r = {};
+            // group pixels so that several rays hit each voxel
+            r.o[0] = float(x / 4);
+            r.o[1] = float(y / 4);
+            r.d[2] = 1.0f;
+            r.c[0] = r.c[1] = r.c[2] = 1.0f;
+            r.xy = uint32_t((x << 16) | y);
+
+            Ref::hit_data_t &inter = inters[y * CacheW + x];
+            inter.obj_index = 0;
+            inter.prim_index = 0;
+            inter.t = 1.0f;
+            inter.u = inter.v = 0.25f;
+
+            radiance[y * ImgW + x] = color_rgba_t{0.01f * float(x % 7), 0.02f * float(y % 5), 0.5f, 1.0f};
+            depth_normals[y * ImgW + x] = color_rgba_t{0.0f, 0.0f, -1.0f, 1.0f};
+        }
+    }
+
+    std::vector<uint64_t> entries_serial(EntriesCount, HASH_GRID_INVALID_HASH_KEY);
+    std::vector<packed_cache_voxel_t> voxels_serial(EntriesCount);
+    { // Single-threaded reference
+        std::vector<cache_data_t> cache_data(CacheW * CacheH, cache_data_t{});
+        Ref::SpatialCacheUpdate(params, inters, rays, cache_data, radiance.data(), depth_normals.data(), ImgW,
+                                entries_serial, voxels_serial);
+    }
+
+    ThreadPool threads(8);
+
+    std::vector<uint64_t> entries(EntriesCount, HASH_GRID_INVALID_HASH_KEY);
+    std::vector<packed_cache_voxel_t> voxels_curr(EntriesCount), voxels_prev(EntriesCount);
+    { // Concurrent update from interleaved rows
+        std::vector<cache_data_t> cache_data(CacheW * CacheH, cache_data_t{});
+
+        std::vector<std::future<void>> futures;
+        for (int y = 0; y < CacheH; ++y) {
+            futures.push_back(threads.Enqueue([&, y]() {
+                const int i = (y % 2) ? y : (CacheH - y - 2);
+                Ref::SpatialCacheUpdate(params, Span<const Ref::hit_data_t>{&inters[i * CacheW], CacheW},
+                                        Span<const Ref::ray_data_t>{&rays[i * CacheW], CacheW}, cache_data,
+                                        radiance.data(), depth_normals.data(), ImgW, entries, voxels_curr);
+            }));
+        }
+        for (auto &f : futures) {
+            f.wait();
+        }
+    }
+
+    // Result must not depend on update order
+    const std::map<uint64_t, packed_cache_voxel_t> serial = CollectVoxels(entries_serial, voxels_serial),
+                                                    concurrent = CollectVoxels(entries, voxels_curr);
+    require(serial.size() > 1 && serial.size() == concurrent.size());
+
+    uint32_t total_samples = 0;
+    for (const auto &kv : serial) {
+        const auto it = concurrent.find(kv.first);
+        require(it != concurrent.end());
+        if (it == concurrent.end()) {
+            continue;
+        }
+        for (int i = 0; i < 4; ++i) {
+            require(kv.second.v[i] == it->second.v[i]);
+        }
+        total_samples += kv.second.v[3];
+    }
+    require(total_samples == uint32_t(CacheW * CacheH));
+
+    const int BlocksCount = EntriesCount / BlockSize;
+
+    std::vector<int> blocks_order(BlocksCount);
+    for (int i = 0; i < BlocksCount; ++i) {
+        blocks_order[i] = BlocksCount - i - 1;
+    }
+
+    { // Blocks are resolved independently in arbitrary order
+        cache_state_t cache = {entries, voxels_curr, voxels_prev};
+        ResolveBlocks(params, cache, blocks_order, BlockSize, &threads);
+
+        for (const packed_cache_voxel_t &v : cache.voxels_curr) {
+            require(v.v[0] == 0 && v.v[1] == 0 && v.v[2] == 0 && v.v[3] == 0);
+        }
+
+        const std::map<uint64_t, packed_cache_voxel_t> resolved = CollectVoxels(cache.entries, cache.voxels_prev);
+        require(resolved.size() == serial.size());
+        for (const auto &kv : serial) {
+            const auto it = resolved.find(kv.first);
+            require(it != resolved.end());
+            if (it == resolved.end()) {
+                continue;
+            }
+            for (int i = 0; i < 3; ++i) {
+                require(kv.second.v[i] == it->second.v[i]);
+            }
+            require((it->second.v[3] & RAD_CACHE_SAMPLE_COUNTER_BIT_MASK) == kv.second.v[3]);
+        }
+    }
+
+    { // Resolve with moved camera does not depend on blocks order (adjacent level lookups cross blocks)
+        cache_grid_params_t params_prev, params_moved, params_static;
+        params_prev.cam_pos_curr[2] = params_prev.cam_pos_prev[2] = -10.0f;
+        params_moved.cam_pos_prev[2] = -10.0f;
+        params_moved.cam_pos_curr[2] = params_static.cam_pos_curr[2] = params_static.cam_pos_prev[2] = -4.0f;
+
+        cache_state_t initial;
+        initial.entries.resize(EntriesCount, HASH_GRID_INVALID_HASH_KEY);
+        initial.voxels_curr.resize(EntriesCount);
+        initial.voxels_prev.resize(EntriesCount);
+
+        const Ref::fvec4 N = {0.0f, 0.0f, -1.0f, 0.0f};
+        for (int y = -40, point_index = 0; y <= 40; ++y) {
+            for (int x = -40; x <= 40; ++x, ++point_index) {
+                const Ref::fvec4 P = {0.5f * float(x), 0.5f * float(y), 2.0f, 0.0f};
+                // the same point lands on different grid levels before and after camera movement
+                const uint32_t prev_entry = Ref::insert_entry(initial.entries, P, N, params_prev);
+                const uint32_t curr_entry = Ref::insert_entry(initial.entries, P, N, params_moved);
+                if (prev_entry == HASH_GRID_INVALID_CACHE_ENTRY || curr_entry == HASH_GRID_INVALID_CACHE_ENTRY ||
+                    prev_entry == curr_entry) {
+                    continue;
+                }
+
+                const uint32_t rad = 1000u * uint32_t(1 + (point_index % 13));
+                if ((point_index % 3) == 0) {
+                    // stale voxel, its entry is released (other entries of its bucket are moved)
+                    const uint32_t stale_frames = uint32_t(RAD_CACHE_STALE_FRAME_NUM_MAX)
+                                                  << RAD_CACHE_SAMPLE_COUNTER_BIT_NUM;
+                    initial.voxels_prev[prev_entry] = {rad, rad, rad, 16u | stale_frames};
+                } else {
+                    initial.voxels_prev[prev_entry] = {rad, 2 * rad, 3 * rad, 16u};
+                    initial.voxels_curr[prev_entry] = {rad, rad, rad, 4u};
+                }
+                // few new samples, adjacent level voxel gets mixed in
+                initial.voxels_curr[curr_entry] = {rad / 4, rad / 4, rad / 4, 2u};
+            }
+        }
+
+        cache_state_t forward = initial, backward = initial, concurrent = initial, no_filter = initial;
+
+        std::vector<int> forward_order(BlocksCount);
+        for (int i = 0; i < BlocksCount; ++i) {
+            forward_order[i] = i;
+        }
+
+        ResolveBlocks(params_moved, forward, forward_order, BlockSize, nullptr);
+        ResolveBlocks(params_moved, backward, blocks_order, BlockSize, nullptr);
+        ResolveBlocks(params_moved, concurrent, blocks_order, BlockSize, &threads);
+        ResolveBlocks(params_static, no_filter, forward_order, BlockSize, nullptr);
+
+        require(forward.entries == backward.entries && forward.entries == concurrent.entries);
+        require(EqualVoxels(forward.voxels_prev, backward.voxels_prev));
+        require(EqualVoxels(forward.voxels_prev, concurrent.voxels_prev));
+
+        // Adjacent level voxels must have been used
+        require(forward.entries == no_filter.entries);
+        require(!EqualVoxels(forward.voxels_prev, no_filter.voxels_prev));
+    }
+
+    printf("OK\n");
+}
@@ -2,8 +2,10 @@
 
 #include "../internal/TextureStorageCPU.h"
 
+#include <atomic>
 #include <memory>
 #include <random>
+#include <thread>
 
 void test_tex_storage() {
     printf("Test tex_storage        | ");
@@ -98,5 +100,219 @@ void test_tex_storage() {
         }
     }
 
+    { // Test paged storages
+        Ray::Cpu::TexPageCache page_cache(4 * 1024 * 1024, nullptr);
+        require_fatal(page_cache.ready());
+
+        Ray::Cpu::TexStorageTiled<uint8_t, 4> storage_tiled;
+        Ray::Cpu::TexStorageSwizzled<uint8_t, 4> storage_swizzled;
+        Ray::Cpu::TexStorageBCn<2> storage_bc5;
+        storage_tiled.SetPageCache(&page_cache);
+        storage_swizzled.SetPageCache(&page_cache);
+        storage_bc5.SetPageCache(&page_cache);
+
+        const int TextureRes = 1021;
+        std::vector<Ray::color_t<uint8_t, 4>> test_pixels(TextureRes * TextureRes);
+        std::vector<Ray::color_t<uint8_t, 2>> test_pixels_rg(TextureRes * TextureRes);
+
+        { // Fill test pixels
+            std::uniform_int_distribution<int> dist(0, 255);
+            std::mt19937 gen(42);
+
+            for (int j = 0; j < TextureRes; j++) {
+                for (int i = 0; i < TextureRes; i++) {
+                    for (int k = 0; k < 4; ++k) {
+                        test_pixels[j * TextureRes + i].v[k] = static_cast<uint8_t>(dist(gen));
+                    }
+                    test_pixels_rg[j * TextureRes + i].v[0] = static_cast<uint8_t>((i + j) % 255);
+                    test_pixels_rg[j * TextureRes + i].v[1] = static_cast<uint8_t>((i + j) % 255);
+                }
+            }
+        }
+
+        const int res[2] = {TextureRes, TextureRes};
+        require_fatal(storage_tiled.Allocate(test_pixels, res, false) == 0);
+        require_fatal(storage_swizzled.Allocate(test_pixels, res, false) == 0);
+        require_fatal(storage_bc5.Allocate(test_pixels_rg, res, false) == 0);
+
+        // data does not fit into cache budget, so pages are evicted and loaded again
+        for (int i = 0; i < 2; ++i) {
+            for (int y = 0; y < TextureRes; ++y) {
+                for (int x = 0; x < TextureRes; ++x) {
+                    const Ray::color_t<uint8_t, 4> sampled_color1 = storage_tiled.Get(0, x, y, 0),
+                                                   sampled_color2 = storage_swizzled.Get(0, x, y, 0);
+                    const Ray::color_t<uint8_t, 2> sampled_color3 = storage_bc5.Get(0, x, y, 0);
+
+                    const Ray::color_t<uint8_t, 4> &test_color = test_pixels[y * TextureRes + x];
+                    const Ray::color_t<uint8_t, 2> &test_color_rg = test_pixels_rg[y * TextureRes + x];
+                    for (int k = 0; k < 4; ++k) {
+                        require_fatal(sampled_color1.v[k] == test_color.v[k]);
+                        require_fatal(sampled_color2.v[k] == test_color.v[k]);
+                    }
+                    require_fatal(std::abs(int(sampled_color3.v[0]) - test_color_rg.v[0]) < 8);
+                    require_fatal(std::abs(int(sampled_color3.v[1]) - test_color_rg.v[1]) < 8);
+                }
+            }
+        }
+
+        uint64_t hits, misses;
+        page_cache.TakeStats(hits, misses);
+        require(hits > 0 && misses > 0);
+
+        // file space of freed image is reused, pages pinned by this thread are not valid anymore
+        const uint64_t file_size = page_cache.file_size();
+        storage_tiled.Get(0, 0, 0, 0);
+        require_fatal(storage_tiled.Free(0));
+        for (Ray::color_t<uint8_t, 4> &col : test_pixels) {
+            col.v[0] = ~col.v[0];
+        }
+        require_fatal(storage_tiled.Allocate(test_pixels, res, false) == 0);
+        require(page_cache.file_size() == file_size);
+
+        for (int y = 0; y < TextureRes; ++y) {
+            for (int x = 0; x < TextureRes; ++x) {
+                const Ray::color_t<uint8_t, 4> sampled_color = storage_tiled.Get(0, x, y, 0);
+                const Ray::color_t<uint8_t, 4> &test_color = test_pixels[y * TextureRes + x];
+                for (int k = 0; k < 4; ++k) {
+                    require_fatal(sampled_color.v[k] == test_color.v[k]);
+                }
+            }
+        }
+
+        // same applies to compressed images
+        require_fatal(storage_bc5.Free(0));
+        require_fatal(storage_bc5.Allocate(test_pixels_rg, res, false) == 0);
+        require(page_cache.file_size() == file_size);
+
+        // pages are loaded concurrently by several threads (each of them walks the image in different order)
+        std::atomic<int> mismatches{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t]() {
+                for (int j = 0; j < TextureRes; ++j) {
+                    const int y = (j + t * TextureRes / 4) % TextureRes;
+                    for (int x = 0; x < TextureRes; ++x) {
+                        const Ray::color_t<uint8_t, 4> sampled_color = storage_swizzled.Get(0, x, y, 0);
+                        const Ray::color_t<uint8_t, 4> &test_color = test_pixels[y * TextureRes + x];
+                        // first channel was inverted only in tiled storage
+                        if (uint8_t(~sampled_color.v[0]) != test_color.v[0] ||
+                            sampled_color.v[1] != test_color.v[1]) {
+                            ++mismatches;
+                        }
+                    }
+                }
+            });
+        }
+        for (std::thread &t : threads) {
+            t.join();
+        }
+        require(mismatches == 0);
+    }
+
+    { // Test decoding of raw blocks
+        const int TextureRes = 64, BlocksCount = (TextureRes / 4) * (TextureRes / 4);
+
+        // two textures of each format are sampled alternately
+        std::vector<uint8_t> bc1_data[2], bc3_data[2], bc4_data[2], bc5_data[2];
+
+        Ray::Cpu::TexStorageBCn<3> storage_bc1;
+        Ray::Cpu::TexStorageBCn<4> storage_bc3;
+        Ray::Cpu::TexStorageBCn<1> storage_bc4;
+        Ray::Cpu::TexStorageBCn<2> storage_bc5;
+
+        std::uniform_int_distribution<int> dist(0, 255);
+        std::mt19937 gen(42);
+
+        const int res[2] = {TextureRes, TextureRes};
+        for (int i = 0; i < 2; ++i) {
+            bc1_data[i].resize(BlocksCount * Ray::BlockSize_BC1);
+            bc3_data[i].resize(BlocksCount * Ray::BlockSize_BC3);
+            bc4_data[i].resize(BlocksCount * Ray::BlockSize_BC4);
+            bc5_data[i].resize(BlocksCount * Ray::BlockSize_BC5);
+            for (std::vector<uint8_t> *data : {&bc1_data[i], &bc3_data[i], &bc4_data[i], &bc5_data[i]}) {
+                for (uint8_t &v : *data) {
+                    v = static_cast<uint8_t>(dist(gen));
+                }
+            }
+
+            require_fatal(storage_bc1.AllocateRaw(bc1_data[i], res, 1, false, false) == i);
+            require_fatal(storage_bc3.AllocateRaw(bc3_data[i], res, 1, false, false) == i);
+            require_fatal(storage_bc4.AllocateRaw(bc4_data[i], res, 1, false, false) == i);
+            require_fatal(storage_bc5.AllocateRaw(bc5_data[i], res, 1, false, false) == i);
+        }
+
+        // Straightforward per-texel decoding
+        auto expand_bits = [](const int c, const int bits) {
+            const int b = (1 << (bits - 1)) + c * 255;
+            return (b + (b >> bits)) >> bits;
+        };
+        auto decode_color = [&](const uint8_t block[], const int texel, const int ch) -> int {
+            const int c[2] = {block[0] | (block[1] << 8), block[2] | (block[3] << 8)};
+            int endpoints[2];
+            for (int i = 0; i < 2; ++i) {
+                const int shift = 11 - 6 * ch + (ch == 2);
+                endpoints[i] = expand_bits((c[i] >> shift) & (ch == 1 ? 63 : 31), ch == 1 ? 6 : 5);
+            }
+            const int index = (block[4 + texel / 4] >> (2 * (texel % 4))) & 3;
+            if (index < 2) {
+                return endpoints[index];
+            }
+            return index == 2 ? (2 * endpoints[0] + endpoints[1]) / 3 : (endpoints[0] + 2 * endpoints[1]) / 3;
+        };
+        auto decode_alpha = [](const uint8_t block[], const int texel) -> int {
+            const int a0 = block[0], a1 = block[1];
+            int index = 0;
+            for (int i = 0; i < 3; ++i) {
+                const int bit = 16 + 3 * texel + i;
+                index |= ((block[bit / 8] >> (bit % 8)) & 1) << i;
+            }
+            if (index < 2) {
+                return index ? a1 : a0;
+            }
+            if (a0 > a1) {
+                return ((8 - index) * a0 + (index - 1) * a1) / 7;
+            }
+            if (index < 6) {
+                return ((6 - index) * a0 + (index - 1) * a1) / 5;
+            }
+            return index == 6 ? 0 : 255;
+        };
+
+        // make sure counters are not affected by previous tests
+        Ray::Cpu::InvalidateBCCaches();
+        uint64_t hits, misses;
+        Ray::Cpu::TakeBCCacheStats(hits, misses);
+
+        for (int y = 0; y < TextureRes; ++y) {
+            for (int x = 0; x < TextureRes; ++x) {
+                const int block = (y / 4) * (TextureRes / 4) + (x / 4), texel = (y % 4) * 4 + (x % 4);
+                for (int i = 0; i < 2; ++i) {
+                    const Ray::color_t<uint8_t, 3> bc1_color = storage_bc1.Get(i, x, y, 0);
+                    const Ray::color_t<uint8_t, 4> bc3_color = storage_bc3.Get(i, x, y, 0);
+                    const Ray::color_t<uint8_t, 1> bc4_color = storage_bc4.Get(i, x, y, 0);
+                    const Ray::color_t<uint8_t, 2> bc5_color = storage_bc5.Get(i, x, y, 0);
+
+                    const uint8_t *bc1_block = &bc1_data[i][block * Ray::BlockSize_BC1];
+                    const uint8_t *bc3_block = &bc3_data[i][block * Ray::BlockSize_BC3];
+                    const uint8_t *bc4_block = &bc4_data[i][block * Ray::BlockSize_BC4];
+                    const uint8_t *bc5_block = &bc5_data[i][block * Ray::BlockSize_BC5];
+                    for (int ch = 0; ch < 3; ++ch) {
+                        require_fatal(bc1_color.v[ch] == decode_color(bc1_block, texel, ch));
+                        require_fatal(bc3_color.v[ch] == decode_color(&bc3_block[Ray::BlockSize_BC4], texel, ch));
+                    }
+                    require_fatal(bc3_color.v[3] == decode_alpha(bc3_block, texel));
+                    require_fatal(bc4_color.v[0] == decode_alpha(bc4_block, texel));
+                    require_fatal(bc5_color.v[0] == decode_alpha(bc5_block, texel));
+                    require_fatal(bc5_color.v[1] == decode_alpha(&bc5_block[Ray::BlockSize_BC4], texel));
+                }
+            }
+        }
+
+        // each block is decoded exactly once
+        Ray::Cpu::TakeBCCacheStats(hits, misses);
+        require(misses == 4 * 2 * BlocksCount);
+        require(hits == 4 * 2 * TextureRes * TextureRes - misses);
+    }
+
     printf("OK\n");
 }
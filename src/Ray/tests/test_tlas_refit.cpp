@@ -0,0 +1,289 @@
+#include "test_common.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cstring>
+#include <random>
+
+#include "../Ray.h"
+#include "../internal/BVHSplit.h"
+#include "../internal/Core.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+namespace {
+bool bbox_test(const float o[3], const float inv_d[3], const float bbox_min[3], const float bbox_max[3]) {
+    float tmin = 0.0f, tmax = FLT_MAX;
+    for (int i = 0; i < 3; ++i) {
+        const float t1 = (bbox_min[i] - o[i]) * inv_d[i], t2 = (bbox_max[i] - o[i]) * inv_d[i];
+        tmin = std::max(tmin, std::min(t1, t2));
+        tmax = std::min(tmax, std::max(t1, t2));
+    }
+    return tmin <= tmax;
+}
+
+// Returns sorted list of primitives which bounding boxes are hit by ray
+std::vector<uint32_t> TraverseTree(const std::vector<Ray::bvh_node_t> &nodes, const std::vector<uint32_t> &indices,
+                                   const float o[3], const float inv_d[3]) {
+    std::vector<uint32_t> ret;
+
+    std::vector<uint32_t> stack = {0};
+    while (!stack.empty()) {
+        const Ray::bvh_node_t &n = nodes[stack.back()];
+        stack.pop_back();
+
+        if (!bbox_test(o, inv_d, n.bbox_min, n.bbox_max)) {
+            continue;
+        }
+
+        if (n.prim_index & Ray::LEAF_NODE_BIT) {
+            const uint32_t beg = (n.prim_index & Ray::PRIM_INDEX_BITS);
+            for (uint32_t j = beg; j < beg + (n.prim_count & Ray::PRIM_COUNT_BITS); ++j) {
+                ret.push_back(indices[j]);
+            }
+        } else {
+            stack.push_back(n.left_child & Ray::LEFT_CHILD_BITS);
+            stack.push_back(n.right_child & Ray::RIGHT_CHILD_BITS);
+        }
+    }
+
+    std::sort(ret.begin(), ret.end());
+    return ret;
+}
+
+std::vector<uint32_t> TraversePrims(Ray::Span<const Ray::prim_t> prims, const float o[3], const float inv_d[3]) {
+    std::vector<uint32_t> ret;
+    for (uint32_t i = 0; i < uint32_t(prims.size()); ++i) {
+        float bbox_min[4], bbox_max[4];
+        prims[i].bbox_min.store_to(bbox_min);
+        prims[i].bbox_max.store_to(bbox_max);
+        if (bbox_test(o, inv_d, bbox_min, bbox_max)) {
+            ret.push_back(i);
+        }
+    }
+    return ret;
+}
+
+void test_tlas_refit_tree() {
+    const int InstancesCount = 512;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> pos_dist(-50.0f, 50.0f), size_dist(0.5f, 2.0f), jitter_dist(-0.5f, 0.5f),
+        dir_dist(-1.0f, 1.0f);
+
+    Ray::aligned_vector<Ray::prim_t> prims;
+    for (int i = 0; i < InstancesCount; ++i) {
+        const Ray::Ref::fvec4 bbox_min = {pos_dist(gen), pos_dist(gen), pos_dist(gen), 0.0f};
+        const Ray::Ref::fvec4 bbox_max = bbox_min + Ray::Ref::fvec4{size_dist(gen), size_dist(gen), size_dist(gen), 0.0f};
+        prims.push_back({0, 0, 0, bbox_min, bbox_max});
+    }
+
+    // same settings as used for TLAS
+    Ray::bvh_settings_t s = {};
+    s.oversplit_threshold = -1.0f;
+    s.min_primitives_in_leaf = 1;
+
+    std::vector<Ray::bvh_node_t> nodes;
+    std::vector<uint32_t> indices;
+    Ray::PreprocessPrims_SAH(prims, {}, s, nodes, indices);
+    const float built_cost = Ray::CalcBVHCost(nodes);
+
+    // refitted tree must give the same hits as the brute force search
+    auto check_intersections = [&]() {
+        for (int i = 0; i < 1000; ++i) {
+            const float o[3] = {pos_dist(gen), pos_dist(gen), pos_dist(gen)};
+            float d[3] = {dir_dist(gen), dir_dist(gen), dir_dist(gen)};
+            const float len = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+            float inv_d[3];
+            for (int j = 0; j < 3; ++j) {
+                d[j] /= len;
+                inv_d[j] = (std::abs(d[j]) > FLT_EPSILON) ? 1.0f / d[j] : std::copysign(FLT_MAX, d[j]);
+            }
+            require(TraverseTree(nodes, indices, o, inv_d) == TraversePrims(prims, o, inv_d));
+        }
+    };
+
+    { // small movement, refit is enough
+        for (Ray::prim_t &p : prims) {
+            const Ray::Ref::fvec4 offset = {jitter_dist(gen), jitter_dist(gen), jitter_dist(gen), 0.0f};
+            p.bbox_min += offset;
+            p.bbox_max += offset;
+        }
+        Ray::RefitBVH(prims, indices, nodes);
+        check_intersections();
+        require(Ray::CalcBVHCost(nodes) <= Ray::TLASRebuildThreshold * built_cost);
+    }
+
+    { // instances are scattered, tree quality drops past rebuild threshold
+        for (Ray::prim_t &p : prims) {
+            const Ray::Ref::fvec4 size = p.bbox_max - p.bbox_min;
+            p.bbox_min = Ray::Ref::fvec4{pos_dist(gen), pos_dist(gen), pos_dist(gen), 0.0f};
+            p.bbox_max = p.bbox_min + size;
+        }
+        Ray::RefitBVH(prims, indices, nodes);
+        check_intersections();
+        const float refit_cost = Ray::CalcBVHCost(nodes);
+        require(refit_cost > Ray::TLASRebuildThreshold * built_cost);
+
+        nodes.clear();
+        indices.clear();
+        Ray::PreprocessPrims_SAH(prims, {}, s, nodes, indices);
+        check_intersections();
+        require(Ray::CalcBVHCost(nodes) < refit_cost);
+    }
+}
+
+void MakeTransforms(const int instances_count, const float amplitude, std::mt19937 &gen, std::vector<float> &xforms) {
+    std::uniform_real_distribution<float> offset_dist(-amplitude, amplitude);
+
+    xforms.resize(16 * instances_count);
+    for (int i = 0; i < instances_count; ++i) {
+        float *xform = &xforms[16 * i];
+        memset(xform, 0, 16 * sizeof(float));
+        xform[0] = xform[5] = xform[10] = 0.1f;
+        xform[12] = 0.25f * float(i % 8) - 0.875f + offset_dist(gen);
+        xform[13] = 0.25f * float(i / 8) - 0.875f + offset_dist(gen);
+        xform[14] = offset_dist(gen);
+        xform[15] = 1.0f;
+    }
+}
+
+void SetupScene(Ray::SceneBase &scene, const int instances_count, const float xforms[],
+                std::vector<Ray::MeshInstanceHandle> &out_instances) {
+    Ray::camera_desc_t cam_desc;
+    cam_desc.type = Ray::eCamType::Persp;
+    cam_desc.filter = Ray::ePixelFilter::Box;
+    cam_desc.origin[2] = 4.0f;
+    cam_desc.fwd[2] = -1.0f;
+    cam_desc.fov = 45.0f;
+    cam_desc.max_total_depth = 2;
+    scene.set_current_cam(scene.AddCamera(cam_desc));
+
+    Ray::environment_desc_t env_desc;
+    env_desc.env_col[0] = env_desc.env_col[1] = env_desc.env_col[2] = 1.0f;
+    env_desc.back_col[0] = env_desc.back_col[1] = env_desc.back_col[2] = 0.5f;
+    scene.SetEnvironment(env_desc);
+
+    Ray::principled_mat_desc_t mat_desc;
+    mat_desc.base_color[1] = 0.5f;
+    const Ray::MaterialHandle mat = scene.AddMaterial(mat_desc);
+
+    std::vector<float> box_attrs;
+    std::vector<uint32_t> box_indices, box_groups;
+    std::tie(box_attrs, box_indices, box_groups) = LoadBIN("test_data/meshes/mat_test/box.bin");
+
+    Ray::mesh_desc_t box_mesh_desc;
+    box_mesh_desc.prim_type = Ray::ePrimType::TriangleList;
+    box_mesh_desc.vtx_positions = {box_attrs, 0, 8};
+    box_mesh_desc.vtx_normals = {box_attrs, 3, 8};
+    box_mesh_desc.vtx_uvs = {box_attrs, 6, 8};
+    box_mesh_desc.vtx_indices = box_indices;
+
+    const Ray::mat_group_desc_t groups[] = {{mat, box_groups[0], box_groups[1]}};
+    box_mesh_desc.groups = groups;
+    const Ray::MeshHandle box_mesh = scene.AddMesh(box_mesh_desc);
+
+    out_instances.clear();
+    for (int i = 0; i < instances_count; ++i) {
+        out_instances.push_back(scene.AddMeshInstance(box_mesh, &xforms[16 * i]));
+    }
+}
+
+std::vector<Ray::color_rgba_t> RenderImage(ThreadPool &threads, Ray::RendererBase &renderer,
+                                           const Ray::SceneBase &scene, const int w, const int h) {
+    using namespace std::placeholders;
+    auto parallel_for = std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+    renderer.Clear({0, 0, 0, 0});
+
+    Ray::RegionContext region(Ray::rect_t{0, 0, w, h});
+    renderer.RenderScene(scene, region);
+
+    const Ray::color_data_rgba_t pixels = renderer.get_raw_pixels_ref();
+
+    std::vector<Ray::color_rgba_t> ret(w * h);
+    for (int y = 0; y < h; ++y) {
+        memcpy(&ret[y * w], &pixels.ptr[y * pixels.pitch], w * sizeof(Ray::color_rgba_t));
+    }
+    return ret;
+}
+} // namespace
+
+void test_tlas_refit(const char *arch_list[], const char *preferred_device) {
+    const char TestName[] = "tlas_refit";
+
+    test_tlas_refit_tree();
+
+    Ray::settings_t s;
+    s.w = 64;
+    s.h = 64;
+    s.preferred_device = preferred_device;
+    s.validation_level = g_validation_level;
+    s.use_hwrt = false;
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+
+    const int InstancesCount = 64;
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+
+        using namespace std::placeholders;
+        auto parallel_for =
+            std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+        auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+        if (!renderer || renderer->type() != rt) {
+            // skip unsupported (we fell back to some other renderer)
+            continue;
+        }
+
+        std::mt19937 gen(123);
+
+        std::vector<float> xforms;
+        MakeTransforms(InstancesCount, 0.0f, gen, xforms);
+
+        std::vector<Ray::MeshInstanceHandle> instances;
+        auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+        SetupScene(*scene, InstancesCount, xforms.data(), instances);
+        scene->Finalize(parallel_for);
+
+        // small movement is handled with refit, scattering triggers full rebuild
+        double update_ms[2] = {};
+        for (const int i : {0, 1}) {
+            MakeTransforms(InstancesCount, i ? 1.0f : 0.05f, gen, xforms);
+
+            const auto t1 = std::chrono::high_resolution_clock::now();
+            scene->SetMeshInstanceTransforms(instances, xforms, parallel_for);
+            update_ms[i] =
+                std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - t1).count();
+
+            // reference scene with TLAS built from scratch
+            std::vector<Ray::MeshInstanceHandle> ref_instances;
+            auto ref_scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+            SetupScene(*ref_scene, InstancesCount, xforms.data(), ref_instances);
+            ref_scene->Finalize(parallel_for);
+
+            // only traversal order differs, hit results must be the same
+            const std::vector<Ray::color_rgba_t> pixels = RenderImage(threads, *renderer, *scene, s.w, s.h);
+            const std::vector<Ray::color_rgba_t> ref_pixels = RenderImage(threads, *renderer, *ref_scene, s.w, s.h);
+            require(memcmp(pixels.data(), ref_pixels.data(), pixels.size() * sizeof(Ray::color_rgba_t)) == 0);
+        }
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(TLAS update: refit %.3fms, rebuild %.3fms)\n", update_ms[0], update_ms[1]);
+            fflush(stdout);
+        }
+    }
+}
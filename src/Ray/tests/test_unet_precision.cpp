@@ -0,0 +1,140 @@
+#include "test_common.h"
+
+#include <chrono>
+#include <future>
+
+#include "../Ray.h"
+
+#include "test_scene.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+extern bool g_minimal_output;
+extern std::mutex g_stdout_mtx;
+extern int g_validation_level;
+
+void test_unet_precision(const char *arch_list[], const char *preferred_device) {
+    using namespace std::chrono;
+
+    const char TestName[] = "unet_precision";
+
+    int test_img_w, test_img_h;
+    const auto test_img = LoadTGA("test_data/complex_mat5_unet_filter/ref.tga", test_img_w, test_img_h);
+    require_return(!test_img.empty());
+
+    Ray::settings_t s = swrt_test_settings(test_img_w, test_img_h, preferred_device, g_validation_level);
+
+    ThreadPool threads(std::thread::hardware_concurrency());
+
+    const int SampleCount = 24;
+    const int TileSize = 64;
+
+    struct precision_t {
+        Ray::eUNetPrecision precision;
+        const char *name;
+        // difference from full precision result must stay well below visible level (int8 weights keep only 7 bits
+        // of magnitude, so their error accumulates faster through the layers)
+        double min_psnr;
+    };
+    const precision_t Precisions[] = {{Ray::eUNetPrecision::FP32, "fp32", 0.0},
+                                      {Ray::eUNetPrecision::BF16, "bf16", 40.0},
+                                      {Ray::eUNetPrecision::FP16, "fp16", 50.0},
+                                      {Ray::eUNetPrecision::Int8, "int8", 35.0}};
+    const int PrecisionsCount = sizeof(Precisions) / sizeof(Precisions[0]);
+
+    std::vector<Ray::RegionContext> region_contexts;
+    for (int y = 0; y < test_img_h; y += TileSize) {
+        for (int x = 0; x < test_img_w; x += TileSize) {
+            region_contexts.emplace_back(
+                Ray::rect_t{x, y, std::min(test_img_w - x, TileSize), std::min(test_img_h - y, TileSize)});
+        }
+    }
+
+    for (const char **arch = arch_list; *arch; ++arch) {
+        const auto rt = Ray::RendererTypeFromName(*arch);
+        if ((Ray::RendererCPU & Ray::Bitmask<Ray::eRendererType>{rt}) != rt) {
+            // reduced precision is implemented for CPU backends only
+            continue;
+        }
+
+        std::vector<Ray::color_rgba_t> denoised[PrecisionsCount];
+        std::vector<double> pass_ms[PrecisionsCount];
+
+        for (int i = 0; i < PrecisionsCount; ++i) {
+            s.unet_precision = Precisions[i].precision;
+
+            using namespace std::placeholders;
+            auto parallel_for =
+                std::bind(&ThreadPool::ParallelFor<Ray::ParallelForFunction>, std::ref(threads), _1, _2, _3);
+
+            auto renderer = std::unique_ptr<Ray::RendererBase>(Ray::CreateRenderer(s, &g_log_err, parallel_for, rt));
+            if (!renderer || renderer->type() != rt) {
+                // skip unsupported (we fell back to some other renderer)
+                break;
+            }
+
+            auto scene = std::unique_ptr<Ray::SceneBase>(renderer->CreateScene());
+            setup_metal_test_scene(threads, *scene);
+
+            char name_buf[1024];
+            snprintf(name_buf, sizeof(name_buf), "Test %-25s", TestName);
+            schedule_render_jobs(threads, *renderer, scene.get(), s, SampleCount, eDenoiseMethod::None, false,
+                                 name_buf);
+
+            // passes are run one by one to measure each of them separately
+            const Ray::unet_filter_properties_t props = renderer->InitUNetFilter(true, parallel_for);
+            for (int pass = 0; pass < props.pass_count; ++pass) {
+                const auto t1 = high_resolution_clock::now();
+
+                std::vector<std::future<void>> job_res;
+                for (Ray::RegionContext &region : region_contexts) {
+                    job_res.push_back(threads.Enqueue([&renderer, &region, pass]() {
+                        renderer->DenoiseImage(pass, region);
+                    }));
+                }
+                for (auto &res : job_res) {
+                    res.wait();
+                }
+
+                pass_ms[i].push_back(duration<double, std::milli>(high_resolution_clock::now() - t1).count());
+            }
+
+            denoised[i] = copy_pixels(renderer->get_pixels_ref(), test_img_w, test_img_h);
+        }
+
+        if (denoised[PrecisionsCount - 1].empty()) {
+            continue;
+        }
+
+        double psnr[PrecisionsCount] = {};
+        for (int i = 1; i < PrecisionsCount; ++i) {
+            psnr[i] = calc_psnr(denoised[0], denoised[i]);
+        }
+
+        {
+            std::lock_guard<std::mutex> _(g_stdout_mtx);
+            if (g_minimal_output) {
+                printf("\rTest %-25s (%6s, %s): %.1f%% ", TestName, Ray::RendererTypeName(rt), "SWRT", 100.0);
+            }
+            printf("(PSNR:");
+            for (int i = 1; i < PrecisionsCount; ++i) {
+                printf(" %s %.2f/%.2f dB", Precisions[i].name, psnr[i], Precisions[i].min_psnr);
+            }
+            printf(")\n");
+            for (int i = 0; i < PrecisionsCount; ++i) {
+                printf("\tUNet passes %s (ms):", Precisions[i].name);
+                double total_ms = 0.0;
+                for (const double ms : pass_ms[i]) {
+                    printf(" %.1f", ms);
+                    total_ms += ms;
+                }
+                printf(", total %.1f\n", total_ms);
+            }
+            fflush(stdout);
+        }
+
+        for (int i = 1; i < PrecisionsCount; ++i) {
+            require(psnr[i] >= Precisions[i].min_psnr);
+        }
+    }
+}